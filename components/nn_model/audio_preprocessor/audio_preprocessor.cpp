@@ -20,39 +20,132 @@
  * Description: MFCC feature extraction to match with TensorFlow MFCC Op
  */
 
+#include <algorithm>
 #include <cfloat>
 #include <cstring>
 
 #include "audio_preprocessor.h"
+#include "feature_kernels.h"
+
+// log2(1 + i / 32) in Q16, interpolated linearly by Log2Q16.
+static const int32_t kLog2TableQ16[33] = {
+  0,     2909,  5732,  8473,  11136, 13727, 16248, 18704, 21098,
+  23433, 25711, 27936, 30109, 32234, 34312, 36346, 38336, 40286,
+  42196, 44068, 45904, 47705, 49472, 51207, 52911, 54584, 56229,
+  57845, 59434, 60997, 62534, 64047, 65536};
+// ln(2) in Q30.
+static constexpr int64_t kLn2Q30 = 744261118;
+// logf(FLT_MIN) in Q16, what the float path yields for a silent frame.
+static constexpr int32_t kLogFltMinQ16 = -5723688;
+
+// log2(x) in Q16 for x > 0, max error 1.8e-4.
+static int32_t Log2Q16(uint64_t x) {
+  const int32_t e = 63 - __builtin_clzll(x);
+  // Mantissa without the leading one, Q31.
+  const uint32_t m =
+    (e >= 31 ? uint32_t(x >> (e - 31)) : uint32_t(x << (31 - e))) & 0x7fffffff;
+  const uint32_t idx = m >> 26;
+  const int32_t frac = (m >> 10) & 0xffff;
+  const int32_t y0 = kLog2TableQ16[idx];
+  const int32_t y1 = kLog2TableQ16[idx + 1];
+  return e * 65536 + y0 + (((y1 - y0) * frac) >> 16);
+}
+
+// Rounded integer square root.
+static uint32_t ISqrt32(uint32_t x) {
+  uint32_t res = 0;
+  uint32_t bit = 1u << 30;
+  while (bit > x)
+    bit >>= 2;
+  while (bit) {
+    if (x >= res + bit) {
+      x -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  // x now holds the remainder of res^2.
+  return x > res ? res + 1 : res;
+}
+
+template <typename T> static void ReleaseVector(std::vector<T> &v) {
+  std::vector<T>().swap(v);
+}
 
 AudioPreprocessor::AudioPreprocessor(int numMfccFeatures, int frameLen,
                                      int numFbankBins, int melLowF,
-                                     int melHighF)
-  : numMfccFeatures(numMfccFeatures), frameLen(frameLen),
-    numFbankBins(numFbankBins) {
+                                     int melHighF, Arithmetic arithmetic)
+  : arithmetic(arithmetic), numMfccFeatures(numMfccFeatures),
+    frameLen(frameLen), numFbankBins(numFbankBins) {
   // Round-up to nearest power of 2.
   frameLenPadded = pow(2, ceil((log(frameLen) / log(2))));
 
-  frame = std::vector<float>(frameLenPadded, 0.0);
-  buffer = std::vector<float>(frameLenPadded, 0.0);
   melEnergies = std::vector<float>(numFbankBins, 0.0);
 
   // Create window function.
   windowFunc = std::vector<float>(frameLen, 0.0);
   for (int i = 0; i < frameLen; i++)
     windowFunc[i] =
-      0.5 - 0.5 * riscv_cos_f32(M_2PI * (static_cast<float>(i)) / (frameLen));
+      0.5 - 0.5 * cosf(M_2PI * (static_cast<float>(i)) / (frameLen));
 
   // Create mel filterbank.
-  fbankFilterFirst = std::vector<int32_t>(numFbankBins, 0);
-  fbankFilterLast = std::vector<int32_t>(numFbankBins, 0);
-  melFbank = CreateMelFbank(melLowF, melHighF);
+  fbank = CreateMelFbank(numFbankBins, frameLenPadded, melLowF, melHighF);
+
+  if (arithmetic == Arithmetic::Fixed) {
+    // Create DCT matrix.
+    dctMatrix = CreateDctMatrix(numFbankBins, numMfccFeatures);
+    InitFixed();
+    return;
+  }
+
+  // Create folded DCT table.
+  dctTable = std::vector<float>(
+    feature_kernels::FoldedDctTableSize(numMfccFeatures, numFbankBins));
+  feature_kernels::CreateFoldedDct(
+    numMfccFeatures, numFbankBins, sqrt(2.0 / numFbankBins),
+    [](double x) { return cos(x); }, dctTable.data());
 
-  // Create DCT matrix.
-  dctMatrix = CreateDctMatrix(numFbankBins, numMfccFeatures);
+  frame = std::vector<float>(frameLenPadded, 0.0);
+  buffer = std::vector<float>(frameLenPadded, 0.0);
 
   // Initialize FFT.
-  riscv_rfft_fast_init_f32(&fft, frameLenPadded);
+  ready = fft.Init(frameLenPadded) == 0;
+}
+
+void AudioPreprocessor::InitFixed() {
+  int32_t i;
+
+  // The Q15 real FFT downscales by 2 per stage of its N/2 complex FFT.
+  fftUpscaleBits = 0;
+  while ((2 << fftUpscaleBits) < frameLenPadded)
+    fftUpscaleBits++;
+
+  frameQ15 = std::vector<int16_t>(frameLenPadded, 0);
+  bufferQ15 = std::vector<int16_t>(frameLenPadded * 2, 0);
+  spectrumQ = std::vector<uint32_t>(frameLenPadded / 2, 0);
+  melLogQ16 = std::vector<int32_t>(numFbankBins, 0);
+
+  // Quantize the float tables once and drop them.
+  windowFuncQ15 = std::vector<int16_t>(frameLen);
+  for (i = 0; i < frameLen; i++)
+    windowFuncQ15[i] = lrintf(windowFunc[i] * INT16_MAX);
+
+  fbankWeightsQ15 = std::vector<int16_t>(fbank.weights.size());
+  for (i = 0; i < static_cast<int32_t>(fbank.weights.size()); i++)
+    fbankWeightsQ15[i] = lrintf(fbank.weights[i] * INT16_MAX);
+
+  dctMatrixQ15 = std::vector<int16_t>(dctMatrix.size());
+  for (i = 0; i < static_cast<int32_t>(dctMatrix.size()); i++)
+    dctMatrixQ15[i] = lrintf(dctMatrix[i] * INT16_MAX);
+
+  ReleaseVector(windowFunc);
+  ReleaseVector(fbank.weights);
+  ReleaseVector(dctMatrix);
+  ReleaseVector(melEnergies);
+
+  ready = fftQ15.Init(frameLenPadded) == 0;
 }
 
 std::vector<float>
@@ -65,16 +158,18 @@ AudioPreprocessor::CreateDctMatrix(int32_t inputLength,
   for (k = 0; k < coefficientCount; k++) {
     for (n = 0; n < inputLength; n++) {
       M[k * inputLength + n] =
-        normalizer * riscv_cos_f32((static_cast<double>(M_PI)) / inputLength *
-                                   (n + 0.5) * k);
+        normalizer * cosf((static_cast<double>(M_PI)) / inputLength *
+                          (n + 0.5) * k);
     }
   }
   return M;
 }
 
-std::vector<std::vector<float>>
-AudioPreprocessor::CreateMelFbank(int melLowF, int melHighF) {
+AudioPreprocessor::MelFbank
+AudioPreprocessor::CreateMelFbank(int numFbankBins, int frameLenPadded,
+                                  int melLowF, int melHighF) {
   int32_t bin, i;
+  MelFbank fbank;
 
   int32_t numFftBins = frameLenPadded / 2;
   float fftBinWidth = (static_cast<float>(SAMP_FREQ)) / frameLenPadded;
@@ -82,8 +177,10 @@ AudioPreprocessor::CreateMelFbank(int melLowF, int melHighF) {
   float melHighFreq = MelScale(melHighF);
   float melFreqDelta = (melHighFreq - melLowFreq) / (numFbankBins + 1);
 
-  std::vector<float> thisBin(numFftBins);
-  std::vector<std::vector<float>> melFbank(numFbankBins);
+  fbank.filterFirst = std::vector<int32_t>(numFbankBins, 0);
+  fbank.filterLen = std::vector<int32_t>(numFbankBins, 0);
+  fbank.spanFirst = numFftBins;
+  fbank.spanLast = -1;
 
   for (bin = 0; bin < numFbankBins; bin++) {
     float leftMel = melLowFreq + bin * melFreqDelta;
@@ -96,7 +193,6 @@ AudioPreprocessor::CreateMelFbank(int melLowF, int melHighF) {
 
       float freq = (fftBinWidth * i); // Center freq of this FFT bin.
       float mel = MelScale(freq);
-      thisBin[i] = 0.0;
 
       if (mel > leftMel && mel < rightMel) {
         float weight;
@@ -105,91 +201,181 @@ AudioPreprocessor::CreateMelFbank(int melLowF, int melHighF) {
         } else {
           weight = (rightMel - mel) / (rightMel - centerMel);
         }
-        thisBin[i] = weight;
+        // Bins inside a triangle are contiguous, so weights can be packed.
+        fbank.weights.push_back(weight);
         if (firstIndex == -1)
           firstIndex = i;
         lastIndex = i;
       }
     }
 
-    fbankFilterFirst[bin] = firstIndex;
-    fbankFilterLast[bin] = lastIndex;
-
-    // Copy the part we care about.
-    for (i = firstIndex; i <= lastIndex; i++) {
-      melFbank[bin].push_back(thisBin[i]);
+    if (firstIndex == -1) {
+      // Filter is narrower than an FFT bin and covers nothing.
+      continue;
     }
+    fbank.filterFirst[bin] = firstIndex;
+    fbank.filterLen[bin] = lastIndex - firstIndex + 1;
+    fbank.spanFirst = std::min(fbank.spanFirst, firstIndex);
+    fbank.spanLast = std::max(fbank.spanLast, lastIndex);
   }
-
-  return melFbank;
+  fbank.weights.shrink_to_fit();
+  return fbank;
 }
 
 void AudioPreprocessor::LogMelCompute(const int16_t *audioData, float *outData,
                                       size_t max_abs) {
-  int32_t i, j, bin;
+  int32_t bin;
 
-  // Normalize data to (-1,1).
-  for (i = 0; i < frameLen; i++) {
-    frame[i] = static_cast<float>(audioData[i]) / max_abs;
+  if (arithmetic == Arithmetic::Fixed) {
+    LogMelComputeFixed(audioData, melLogQ16.data(), max_abs);
+    for (bin = 0; bin < numFbankBins; bin++) {
+      outData[bin] = melLogQ16[bin] * (1.0f / (1 << 16));
+    }
+    return;
   }
 
-  // Fill up remaining with zeros.
-  memset(&frame[frameLen], 0, sizeof(float) * (frameLenPadded - frameLen));
+  // Normalize data to (-1,1) and apply the window.
+  feature_kernels::NormalizeWindow(audioData, windowFunc.data(), frameLen,
+                                   frameLenPadded, max_abs, frame.data());
+
+  // Compute FFT.
+  fft.Forward(frame.data(), buffer.data());
+
+  // Convert to power spectrum, then magnitude.
+  // frame is stored as [real0, realN/2-1, real1, im1, real2, im2, ...]
+  feature_kernels::PowerSpectrum(buffer.data(), frameLenPadded);
+  feature_kernels::MagnitudeSpectrum(buffer.data(), fbank.spanFirst,
+                                     fbank.spanLast);
+
+  // Apply mel filterbanks.
+  feature_kernels::ApplyMelFbank(buffer.data(), fbank.filterFirst.data(),
+                                 fbank.filterLen.data(), fbank.weights.data(),
+                                 numFbankBins, melEnergies.data());
+
+  feature_kernels::Log(melEnergies.data(), outData, numFbankBins);
+}
+
+void AudioPreprocessor::LogMelComputeFixed(const int16_t *audioData,
+                                           int32_t *logMelQ16,
+                                           size_t max_abs) {
+  int32_t i, bin;
 
+  // Block scaling: move the frame peak to [2^14, 2^15) so the Q15 FFT keeps
+  // as many significant bits as possible. The shift is undone in log domain.
+  int32_t peak = 0;
   for (i = 0; i < frameLen; i++) {
-    frame[i] *= windowFunc[i];
+    peak = std::max(peak, abs(static_cast<int32_t>(audioData[i])));
+  }
+  if (peak == 0) {
+    for (bin = 0; bin < numFbankBins; bin++) {
+      logMelQ16[bin] = kLogFltMinQ16;
+    }
+    return;
   }
+  const int32_t shift = 14 - (31 - __builtin_clz(peak));
 
-  // Compute FFT.
-  riscv_rfft_fast_f32(&fft, frame.data(), buffer.data(), 0);
+  for (i = 0; i < frameLen; i++) {
+    const int32_t sample = shift >= 0 ? audioData[i] * (1 << shift)
+                                      : audioData[i] >> -shift;
+    frameQ15[i] = (sample * windowFuncQ15[i] + (1 << 14)) >> 15;
+  }
+  memset(&frameQ15[frameLen], 0,
+         sizeof(int16_t) * (frameLenPadded - frameLen));
 
-  // Convert to power spectrum.
-  // frame is stored as [real0, realN/2-1, real1, im1, real2, im2, ...]
-  int32_t halfDim = frameLenPadded / 2;
-  float firstEnergy = buffer[0] * buffer[0],
-        lastEnergy = buffer[1] * buffer[1]; // Handle this special case.
-  for (i = 1; i < halfDim; i++) {
-    float real = buffer[i * 2], im = buffer[i * 2 + 1];
-    buffer[i] = real * real + im * im;
+  // Compute FFT.
+  // bufferQ15 is stored as [real0, 0, real1, im1, real2, im2, ...]
+  fftQ15.Forward(frameQ15.data(), bufferQ15.data());
+
+  // Magnitude of the bins covered by the filterbank.
+  for (i = fbank.spanFirst; i <= fbank.spanLast; i++) {
+    const int32_t real = bufferQ15[i * 2], im = bufferQ15[i * 2 + 1];
+    spectrumQ[i] = ISqrt32(static_cast<uint32_t>(real * real) +
+                           static_cast<uint32_t>(im * im));
   }
-  buffer[0] = firstEnergy;
-  buffer[halfDim] = lastEnergy;
 
-  float sqrtData;
+  // log2 of the factor between integer mel sums and the float path: Q15
+  // weights, FFT downscaling, block shift and normalization by max_abs.
+  const int32_t scaleLog2Q16 = (fftUpscaleBits - shift - 15) * 65536 -
+                               (max_abs ? Log2Q16(max_abs) : 0);
+
   // Apply mel filterbanks.
+  const int16_t *weights = fbankWeightsQ15.data();
   for (bin = 0; bin < numFbankBins; bin++) {
-    j = 0;
-    float melEnergy = 0;
-    int32_t firstIndex = fbankFilterFirst[bin];
-    int32_t lastIndex = fbankFilterLast[bin];
-    for (i = firstIndex; i <= lastIndex; i++) {
-      sqrtData = sqrt(buffer[i]);
-      melEnergy += (sqrtData)*melFbank[bin][j++];
+    const uint32_t *bins = &spectrumQ[fbank.filterFirst[bin]];
+    const int32_t len = fbank.filterLen[bin];
+    uint64_t melEnergy = 0;
+    for (i = 0; i < len; i++) {
+      melEnergy += bins[i] * static_cast<uint32_t>(weights[i]);
     }
-    melEnergies[bin] = melEnergy;
+    weights += len;
 
-    // Avoid log of zero.
-    if (melEnergy == 0.0)
-      melEnergies[bin] = FLT_MIN;
+    // Empty bins sit below the quantization step, clamp them to it.
+    const int32_t log2Q16 = Log2Q16(std::max<uint64_t>(melEnergy, 1));
+    logMelQ16[bin] = ((log2Q16 + scaleLog2Q16) * kLn2Q30) >> 30;
   }
+}
 
+void AudioPreprocessor::LogMelCompute(const int16_t *audioData,
+                                      int8_t *outData, size_t max_abs,
+                                      const QuantParams &quant) {
+  int32_t bin;
+
+  if (arithmetic == Arithmetic::Fixed) {
+    LogMelComputeFixed(audioData, melLogQ16.data(), max_abs);
+    const float invScale = 1.0f / (quant.scale * (1 << 16));
+    for (bin = 0; bin < numFbankBins; bin++) {
+      outData[bin] =
+        feature_kernels::Quantize(melLogQ16[bin], invScale, quant.zeroPoint);
+    }
+    return;
+  }
+
+  LogMelCompute(audioData, melEnergies.data(), max_abs);
+  const float invScale = 1.0f / quant.scale;
   for (bin = 0; bin < numFbankBins; bin++) {
-    outData[bin] = logf(melEnergies[bin]);
+    outData[bin] =
+      feature_kernels::Quantize(melEnergies[bin], invScale, quant.zeroPoint);
   }
 }
 
 void AudioPreprocessor::MfccCompute(const int16_t *audioData, float *outData,
                                     size_t max_abs) {
-  LogMelCompute(audioData, melEnergies.data(), max_abs);
   int32_t i, j;
 
-  // Take DCT. Uses matrix mul.
-  for (i = 0; i < numMfccFeatures; i++) {
-    float sum = 0.0;
-    for (j = 0; j < numFbankBins; j++) {
-      sum += dctMatrix[i * numFbankBins + j] * melEnergies[j];
+  if (arithmetic == Arithmetic::Fixed) {
+    LogMelComputeFixed(audioData, melLogQ16.data(), max_abs);
+
+    // Take DCT, Q15 matrix by Q16 log-mels.
+    for (i = 0; i < numMfccFeatures; i++) {
+      int64_t sum = 0;
+      for (j = 0; j < numFbankBins; j++) {
+        sum += dctMatrixQ15[i * numFbankBins + j] *
+               static_cast<int64_t>(melLogQ16[j]);
+      }
+      outData[i] = sum * (1.0f / (1u << 31));
     }
+    return;
+  }
+
+  LogMelCompute(audioData, melEnergies.data(), max_abs);
 
-    outData[i] = sum;
+  // Take DCT, folding melEnergies in place.
+  feature_kernels::FoldedDct(dctTable.data(), melEnergies.data(), outData,
+                             numMfccFeatures, numFbankBins);
+}
+
+void AudioPreprocessor::MfccCompute(const int16_t *audioData, int32_t hop,
+                                    int32_t numFrames, float *outData,
+                                    size_t max_abs) {
+  for (int32_t i = 0; i < numFrames; i++) {
+    MfccCompute(&audioData[i * hop], &outData[i * numMfccFeatures], max_abs);
+  }
+}
+
+void AudioPreprocessor::LogMelCompute(const int16_t *audioData, int32_t hop,
+                                      int32_t numFrames, float *outData,
+                                      size_t max_abs) {
+  for (int32_t i = 0; i < numFrames; i++) {
+    LogMelCompute(&audioData[i * hop], &outData[i * numFbankBins], max_abs);
   }
 }
@@ -24,19 +24,58 @@ extern "C" {
 #include <string.h>
 }
 
-#include "dsp/fast_math_functions.h"
-#include "dsp/transform_functions.h"
+#include "real_fft.h"
+#include <cstdint>
 #include <vector>
 
+#ifndef CONFIG_SAMPLE_RATE
+// Host builds have no sdkconfig, use the project default.
+#define CONFIG_SAMPLE_RATE 16000
+#endif
 #define SAMP_FREQ CONFIG_SAMPLE_RATE
 
 #define M_2PI 6.283185307179586476925286766559005
-#ifndef M_PI    /* M_PI might not be defined for non-gcc based tc */
-#define M_PI PI /* Comes from math.h */
-#endif          /* M_PI */
+#ifndef M_PI /* M_PI might not be defined for non-gcc based tc */
+#define M_PI 3.14159265358979323846
+#endif /* M_PI */
 
 class AudioPreprocessor {
+public:
+  enum class Arithmetic {
+    // float normalize, window, FFT, mel sums, logf and DCT.
+    Float,
+    // Q15 window and real FFT with block scaling, integer magnitude and mel
+    // accumulation, table based log2 and Q15 DCT. Against Float, log-mel
+    // bins within 30 dB of the loudest bin of the frame differ by less than
+    // 0.1, bins within 40 dB by less than 0.5 and the median error is below
+    // 0.01 (host_test/test_fixed_point). Quieter bins have no bound: they
+    // are lifted to the noise floor of the Q15 FFT, which downscales by 2
+    // per stage, and are off by up to 0.4 on the test audio, MFCC by 0.14.
+    // This mode trades accuracy for cycles where the Q15 FFT is fast, see
+    // CONFIG_PREPROCESSING_FIXED_POINT.
+    Fixed,
+  };
+
+  // Mel filterbank in CSR-like layout: filter `bin` covers FFT bins
+  // [filterFirst[bin], filterFirst[bin] + filterLen[bin]) and its weights
+  // are packed one after another in weights.
+  struct MelFbank {
+    std::vector<int32_t> filterFirst;
+    std::vector<int32_t> filterLen;
+    std::vector<float> weights;
+    // Range of FFT bins touched by any filter.
+    int32_t spanFirst;
+    int32_t spanLast;
+  };
+
+  // Affine int8 quantization of a model input: q = x / scale + zeroPoint.
+  struct QuantParams {
+    float scale;
+    int32_t zeroPoint;
+  };
+
 private:
+  Arithmetic arithmetic;
   int numMfccFeatures;
   int frameLen;
   int frameLenPadded;
@@ -45,14 +84,30 @@ private:
   std::vector<float> buffer;
   std::vector<float> melEnergies;
   std::vector<float> windowFunc;
-  std::vector<int32_t> fbankFilterFirst;
-  std::vector<int32_t> fbankFilterLast;
-  std::vector<std::vector<float>> melFbank;
+  MelFbank fbank;
+  // Dense DCT matrix, only used to build dctMatrixQ15.
   std::vector<float> dctMatrix;
-  riscv_rfft_fast_instance_f32 fft;
+  // feature_kernels::FoldedDct weights.
+  std::vector<float> dctTable;
+  RealFftF32 fft;
+  bool ready = false;
+
+  // Fixed point pipeline state, allocated for Arithmetic::Fixed only.
+  int32_t fftUpscaleBits;
+  std::vector<int16_t> frameQ15;
+  std::vector<int16_t> bufferQ15;
+  std::vector<uint32_t> spectrumQ;
+  std::vector<int32_t> melLogQ16;
+  std::vector<int16_t> windowFuncQ15;
+  std::vector<int16_t> fbankWeightsQ15;
+  std::vector<int16_t> dctMatrixQ15;
+  RealFftQ15 fftQ15;
+
   static std::vector<float> CreateDctMatrix(int32_t inputLength,
                                             int32_t coefficientCount);
-  std::vector<std::vector<float>> CreateMelFbank(int melLowF, int melHighF);
+  void InitFixed();
+  void LogMelComputeFixed(const int16_t *data, int32_t *logMelQ16,
+                          size_t max_abs);
 
   static inline float InverseMelScale(float melFreq) {
     return 700.0f * (expf(melFreq / 1127.0f) - 1.0f);
@@ -64,11 +119,31 @@ private:
 
 public:
   AudioPreprocessor(int numMfccFeatures, int frameLen, int numFbankBins,
-                    int melLowF, int melHighF);
+                    int melLowF, int melHighF,
+                    Arithmetic arithmetic = Arithmetic::Float);
   ~AudioPreprocessor() = default;
 
+  // False when the FFT could not be initialized, the features are invalid.
+  bool IsReady() const { return ready; }
+
+  static MelFbank CreateMelFbank(int numFbankBins, int frameLenPadded,
+                                 int melLowF, int melHighF);
+
   void MfccCompute(const int16_t *data, float *mfccOut, size_t max_abs);
   void LogMelCompute(const int16_t *data, float *mfccOut, size_t max_abs);
+  // Log-mel features quantized (rounded and saturated) for an int8 model.
+  void LogMelCompute(const int16_t *data, int8_t *mfccOut, size_t max_abs,
+                     const QuantParams &quant);
+
+  // Batched variants for buffered audio: frame i starts at data[i * hop],
+  // its features are row i of the numFrames x numFeatures output. They call
+  // the single frame variants in turn and share nothing else across frames,
+  // streaming callers that hold one frame at a time lose nothing by calling
+  // those directly.
+  void MfccCompute(const int16_t *data, int32_t hop, int32_t numFrames,
+                   float *mfccOut, size_t max_abs);
+  void LogMelCompute(const int16_t *data, int32_t hop, int32_t numFrames,
+                     float *mfccOut, size_t max_abs);
 };
 
 #endif
@@ -0,0 +1,180 @@
+#ifndef __FEATURE_KERNELS_H__
+#define __FEATURE_KERNELS_H__
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Float feature extraction stages shared by AudioPreprocessor and
+ * StaticAudioPreprocessor. Everything is inline so that fixed sizes coming
+ * from template parameters reach the loops.
+ */
+namespace feature_kernels {
+
+// frame = data / max_abs * window, zero padded up to paddedLen.
+inline void NormalizeWindow(const int16_t *data, const float *window,
+                            int32_t len, int32_t paddedLen, size_t max_abs,
+                            float *frame) {
+  for (int32_t i = 0; i < len; i++) {
+    frame[i] = static_cast<float>(data[i]) / max_abs;
+    frame[i] *= window[i];
+  }
+  memset(&frame[len], 0, sizeof(float) * (paddedLen - len));
+}
+
+// Convert a packed real FFT [real0, realN/2, real1, im1, ...] into power
+// spectrum bins [0, N/2] in place.
+inline void PowerSpectrum(float *buffer, int32_t paddedLen) {
+  const int32_t halfDim = paddedLen / 2;
+  float firstEnergy = buffer[0] * buffer[0],
+        lastEnergy = buffer[1] * buffer[1]; // Handle this special case.
+  for (int32_t i = 1; i < halfDim; i++) {
+    float real = buffer[i * 2], im = buffer[i * 2 + 1];
+    buffer[i] = real * real + im * im;
+  }
+  buffer[0] = firstEnergy;
+  buffer[halfDim] = lastEnergy;
+}
+
+// Only bins covered by the filterbank are ever read, and each of them is
+// shared by up to two overlapping triangles: take the square root once.
+inline void MagnitudeSpectrum(float *buffer, int32_t first, int32_t last) {
+  for (int32_t i = first; i <= last; i++) {
+    buffer[i] = sqrtf(buffer[i]);
+  }
+}
+
+// Project a spectrum on a CSR-like filterbank: filter `bin` covers spectrum
+// bins [first[bin], first[bin] + len[bin]) with weights packed back to back.
+inline void ApplyMelFbank(const float *spectrum, const int32_t *first,
+                          const int32_t *len, const float *weights,
+                          int32_t numBins, float *melOut) {
+  for (int32_t bin = 0; bin < numBins; bin++) {
+    const float *bins = &spectrum[first[bin]];
+    float melEnergy = 0;
+    for (int32_t i = 0; i < len[bin]; i++) {
+      melEnergy += bins[i] * weights[i];
+    }
+    weights += len[bin];
+
+    // Avoid log of zero.
+    melOut[bin] = melEnergy == 0.0f ? FLT_MIN : melEnergy;
+  }
+}
+
+// Natural log of positive normal floats (mel energies are clamped to at least
+// FLT_MIN), no special values. x = m * 2^e with m in [sqrt(1/2), sqrt(2)),
+// log(m) = 2 atanh(t), t = (m - 1) / (m + 1), |t| < 0.18, by its series up
+// to t^9. Branch free so the loop vectorizes. Within 2 ulp of the exact
+// result: absolute error below 8e-6 over all normal floats and below 2e-6
+// for x in [2^-7, 2^31), where logf itself is off by up to 1e-6.
+inline void Log(const float *in, float *out, int32_t len) {
+  for (int32_t i = 0; i < len; i++) {
+    uint32_t bits;
+    memcpy(&bits, &in[i], sizeof(bits));
+    // 0x3f3504f3 is sqrt(1/2): exponent relative to it, then strip it.
+    const int32_t e = static_cast<int32_t>(bits - 0x3f3504f3) >> 23;
+    bits -= static_cast<uint32_t>(e) << 23;
+    float m;
+    memcpy(&m, &bits, sizeof(m));
+
+    const float t = (m - 1.0f) / (m + 1.0f), t2 = t * t;
+    const float series =
+      t2 * (1.0f / 3 + t2 * (1.0f / 5 + t2 * (1.0f / 7 + t2 * (1.0f / 9))));
+    out[i] = 2.0f * t + 2.0f * t * series + e * 0.693147180559945f;
+  }
+}
+
+/*
+ * DCT-II by even/odd folding. With s[n] = x[n] + x[N-1-n] and
+ * d[n] = x[n] - x[N-1-n] for n < N/2, odd coefficients only need d and the
+ * even ones are the DCT-II of s, of length N/2. Folding repeats while the
+ * length is even and more than one coefficient is left, the rest is a dense
+ * product. Only the first numOut coefficients are computed, for 10 of 40
+ * bins this is 135 multiplies instead of 400. The table is laid out by
+ * CreateFoldedDct. For inputs in [-1, 1] and numOut <= numIn <= 80, results
+ * are within 2e-6 of the exact DCT, like the dense float product.
+ */
+
+// Number of weights in the FoldedDct table.
+constexpr int32_t FoldedDctTableSize(int32_t numOut, int32_t numIn) {
+  int32_t size = 0;
+  while (numIn % 2 == 0 && numOut > 1) {
+    size += numOut / 2 * (numIn / 2);
+    numIn /= 2;
+    numOut = (numOut + 1) / 2;
+  }
+  return size + numOut * numIn;
+}
+
+// Fill the FoldedDct table: per folding level one row per odd coefficient,
+// reversed to match the in place difference layout, then the dense rows.
+// Weights are scaled by normalizer; cosFn(x) returns cos(x), constexpr
+// evaluation is possible with a constexpr cosFn.
+template <typename CosFn>
+constexpr void CreateFoldedDct(int32_t numOut, int32_t numIn,
+                               double normalizer, CosFn cosFn, float *table) {
+  const double pi = 3.14159265358979323846;
+  while (numIn % 2 == 0 && numOut > 1) {
+    const int32_t half = numIn / 2;
+    for (int32_t k = 1; k < numOut; k += 2) {
+      for (int32_t i = 0; i < half; i++) {
+        const int32_t n = half - 1 - i;
+        *table++ = normalizer * cosFn(pi / numIn * (n + 0.5) * k);
+      }
+    }
+    numIn = half;
+    numOut = (numOut + 1) / 2;
+  }
+  for (int32_t k = 0; k < numOut; k++)
+    for (int32_t n = 0; n < numIn; n++)
+      *table++ = normalizer * cosFn(pi / numIn * (n + 0.5) * k);
+}
+
+// First numOut DCT-II coefficients of in, which is overwritten.
+inline void FoldedDct(const float *table, float *in, float *out,
+                      int32_t numOut, int32_t numIn) {
+  int32_t stride = 1;
+  while (numIn % 2 == 0 && numOut > 1) {
+    const int32_t half = numIn / 2;
+    // Sums go to the first half, differences to the second, reversed.
+    for (int32_t n = 0; n < half; n++) {
+      const float a = in[n], b = in[numIn - 1 - n];
+      in[n] = a + b;
+      in[numIn - 1 - n] = a - b;
+    }
+    for (int32_t k = 1; k < numOut; k += 2) {
+      float sum = 0.0;
+      for (int32_t i = 0; i < half; i++) {
+        sum += table[i] * in[half + i];
+      }
+      table += half;
+      out[stride * k] = sum;
+    }
+    numIn = half;
+    numOut = (numOut + 1) / 2;
+    stride *= 2;
+  }
+  for (int32_t k = 0; k < numOut; k++) {
+    float sum = 0.0;
+    for (int32_t n = 0; n < numIn; n++) {
+      sum += table[n] * in[n];
+    }
+    table += numIn;
+    out[stride * k] = sum;
+  }
+}
+
+// Round and saturate x / scale + zeroPoint to int8.
+inline int8_t Quantize(float x, float invScale, int32_t zeroPoint) {
+  const int32_t q = lrintf(x * invScale) + zeroPoint;
+  return std::min<int32_t>(std::max<int32_t>(q, INT8_MIN), INT8_MAX);
+}
+
+} // namespace feature_kernels
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef __REAL_FFT_H__
+#define __REAL_FFT_H__
+
+#include <cstdint>
+#include <vector>
+
+#if __has_include("sdkconfig.h")
+#include "sdkconfig.h"
+#endif
+
+#if CONFIG_AUDIO_PREPROCESSOR_FFT_NMSIS
+#include "dsp/transform_functions.h"
+#elif !CONFIG_AUDIO_PREPROCESSOR_FFT_ESP_DSP
+// Host builds have no sdkconfig and get the portable backend.
+#define AUDIO_PREPROCESSOR_FFT_PORTABLE 1
+#endif
+
+/*
+ * Forward real FFTs of the audio preprocessors. The backend is selected with
+ * CONFIG_AUDIO_PREPROCESSOR_FFT_*; every backend produces the NMSIS layout so
+ * callers do not care which one is built. Both classes use `in` as scratch.
+ */
+
+/*!
+ * \brief Float real FFT, unscaled.
+ * Output is [real0, realN/2, real1, im1, ..., realN/2-1, imN/2-1].
+ */
+class RealFftF32 {
+public:
+  RealFftF32() = default;
+  RealFftF32(const RealFftF32 &) = delete;
+  RealFftF32 &operator=(const RealFftF32 &) = delete;
+
+  /*!
+   * \brief Prepare tables.
+   * \param len FFT length, power of 2.
+   * \return Result.
+   */
+  int Init(int len);
+  void Forward(float *in, float *out);
+
+private:
+  int len = 0;
+#if CONFIG_AUDIO_PREPROCESSOR_FFT_NMSIS
+  riscv_rfft_fast_instance_f32 instance;
+#else
+  // cos/sin pairs of the N/2 complex FFT (portable) and of the split step
+  // that turns it into the spectrum of N real samples.
+  std::vector<float> twiddle;
+  std::vector<float> splitTwiddle;
+  void SplitSpectrum(const float *z, float *out) const;
+#endif
+};
+
+/*!
+ * \brief Q15 real FFT, downscaled by N/2 like riscv_rfft_q15.
+ * Output is [real0, 0, real1, im1, ..., realN/2, 0], only bins [0, N/2] are
+ * written.
+ */
+class RealFftQ15 {
+public:
+  RealFftQ15() = default;
+  RealFftQ15(const RealFftQ15 &) = delete;
+  RealFftQ15 &operator=(const RealFftQ15 &) = delete;
+
+  /*!
+   * \brief Prepare tables.
+   * \param len FFT length, power of 2.
+   * \return Result.
+   */
+  int Init(int len);
+  void Forward(int16_t *in, int16_t *out);
+
+private:
+  int len = 0;
+#if CONFIG_AUDIO_PREPROCESSOR_FFT_NMSIS
+  riscv_rfft_instance_q15 instance;
+#else
+  std::vector<int16_t> twiddle;
+  std::vector<int16_t> splitTwiddle;
+#endif
+};
+
+/*!
+ * \brief Print us per frame of the built backend for 512 and 1024 points.
+ * \param iterations Number of transforms per measurement.
+ */
+void real_fft_benchmark(int iterations);
+
+#endif
@@ -0,0 +1,49 @@
+#include "real_fft.h"
+
+#include <chrono>
+#include <cstdio>
+
+#if CONFIG_AUDIO_PREPROCESSOR_FFT_ESP_DSP
+#define REAL_FFT_BACKEND "esp-dsp"
+#elif CONFIG_AUDIO_PREPROCESSOR_FFT_NMSIS
+#define REAL_FFT_BACKEND "nmsis"
+#else
+#define REAL_FFT_BACKEND "portable"
+#endif
+
+namespace {
+
+template <typename Fft, typename T>
+float MeasureUs(int len, int iterations) {
+  Fft fft;
+  if (fft.Init(len) != 0)
+    return -1.0f;
+  std::vector<T> in(len), scratch(len), out(2 * len);
+  for (int i = 0; i < len; i++)
+    in[i] = static_cast<T>((i * 7919) % 2001 - 1000);
+
+  int64_t total = 0;
+  for (int it = 0; it < iterations; it++) {
+    // Forward() consumes its input.
+    scratch = in;
+    const auto start = std::chrono::steady_clock::now();
+    fft.Forward(scratch.data(), out.data());
+    total += std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start)
+               .count();
+  }
+  return total / 1000.0f / iterations;
+}
+
+} // namespace
+
+void real_fft_benchmark(int iterations) {
+  static const int lens[] = {512, 1024};
+  printf("real FFT benchmark, backend %s, %d iterations\n", REAL_FFT_BACKEND,
+         iterations);
+  for (int len : lens) {
+    printf("  %4d points: f32 %8.1f us, q15 %8.1f us\n", len,
+           MeasureUs<RealFftF32, float>(len, iterations),
+           MeasureUs<RealFftQ15, int16_t>(len, iterations));
+  }
+}
@@ -0,0 +1,54 @@
+#include "real_fft.h"
+
+#include <cmath>
+#include <mutex>
+
+#include "dsps_fft2r.h"
+#include "esp_log.h"
+
+/*
+ * esp-dsp runs the N/2 point complex FFT with its assembly radix-2 kernel,
+ * the split step comes from the portable backend. esp-dsp has no Q15 real
+ * FFT with the riscv_rfft_q15 scaling, so RealFftQ15 stays portable.
+ *
+ * The esp-dsp twiddle table is global. It is sized for the largest complex
+ * FFT initialized so far rather than CONFIG_DSP_MAX_FFT_SIZE, and grows by
+ * reallocating it: create the preprocessors before any of them runs.
+ */
+
+static std::mutex tableLock;
+static int tableSize = 0;
+
+int RealFftF32::Init(int len) {
+  if (len < 4 || (len & (len - 1)) || len / 2 > CONFIG_DSP_MAX_FFT_SIZE) {
+    ESP_LOGE(__FUNCTION__, "Unsupported FFT length %d", len);
+    return -1;
+  }
+  {
+    std::lock_guard<std::mutex> lock(tableLock);
+    if (len / 2 > tableSize) {
+      if (tableSize) {
+        dsps_fft2r_deinit_fc32();
+        tableSize = 0;
+      }
+      if (dsps_fft2r_init_fc32(NULL, len / 2) != ESP_OK) {
+        ESP_LOGE(__FUNCTION__, "dsps_fft2r_init_fc32 failed");
+        return -1;
+      }
+      tableSize = len / 2;
+    }
+  }
+  this->len = len;
+  splitTwiddle.resize(len);
+  for (int k = 0; k < len / 2; k++) {
+    splitTwiddle[2 * k] = cosf(2 * M_PI * k / len);
+    splitTwiddle[2 * k + 1] = sinf(2 * M_PI * k / len);
+  }
+  return 0;
+}
+
+void RealFftF32::Forward(float *in, float *out) {
+  dsps_fft2r_fc32(in, len / 2);
+  dsps_bit_rev_fc32(in, len / 2);
+  SplitSpectrum(in, out);
+}
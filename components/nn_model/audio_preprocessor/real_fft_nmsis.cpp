@@ -0,0 +1,21 @@
+#include "real_fft.h"
+
+int RealFftF32::Init(int len) {
+  this->len = len;
+  return riscv_rfft_fast_init_f32(&instance, len) == RISCV_MATH_SUCCESS ? 0
+                                                                        : -1;
+}
+
+void RealFftF32::Forward(float *in, float *out) {
+  riscv_rfft_fast_f32(&instance, in, out, 0);
+}
+
+int RealFftQ15::Init(int len) {
+  this->len = len;
+  return riscv_rfft_init_q15(&instance, len, 0, 1) == RISCV_MATH_SUCCESS ? 0
+                                                                         : -1;
+}
+
+void RealFftQ15::Forward(int16_t *in, int16_t *out) {
+  riscv_rfft_q15(&instance, in, out);
+}
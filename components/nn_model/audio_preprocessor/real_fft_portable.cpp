@@ -0,0 +1,159 @@
+#include "real_fft.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*
+ * Plain C++ real FFTs: an N/2 point complex radix-2 FFT over the even/odd
+ * samples packed as complex numbers, followed by the split step. Used as is
+ * by the portable backend, the esp-dsp backend only takes the split step and
+ * the Q15 transform from here.
+ */
+
+namespace {
+
+void BitReverse(float *z, int n) {
+  for (int i = 1, j = 0; i < n; i++) {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      std::swap(z[2 * i], z[2 * j]);
+      std::swap(z[2 * i + 1], z[2 * j + 1]);
+    }
+  }
+}
+
+void BitReverse(int16_t *z, int n) {
+  for (int i = 1, j = 0; i < n; i++) {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      std::swap(z[2 * i], z[2 * j]);
+      std::swap(z[2 * i + 1], z[2 * j + 1]);
+    }
+  }
+}
+
+int16_t SaturateQ15(int32_t x) {
+  return std::min<int32_t>(std::max<int32_t>(x, INT16_MIN), INT16_MAX);
+}
+
+int16_t ToQ15(double x) { return SaturateQ15(lrint(x * 32768.0)); }
+
+// cos/sin pairs of 2 * pi * k / len for k in [0, count).
+template <typename T, typename Convert>
+void MakeTwiddle(std::vector<T> &table, int len, int count, Convert convert) {
+  table.resize(2 * count);
+  for (int k = 0; k < count; k++) {
+    table[2 * k] = convert(cos(2 * M_PI * k / len));
+    table[2 * k + 1] = convert(sin(2 * M_PI * k / len));
+  }
+}
+
+} // namespace
+
+#if AUDIO_PREPROCESSOR_FFT_PORTABLE
+int RealFftF32::Init(int len) {
+  if (len < 4 || (len & (len - 1)))
+    return -1;
+  this->len = len;
+  auto toFloat = [](double x) { return static_cast<float>(x); };
+  MakeTwiddle(twiddle, len / 2, len / 4, toFloat);
+  MakeTwiddle(splitTwiddle, len, len / 2, toFloat);
+  return 0;
+}
+
+void RealFftF32::Forward(float *in, float *out) {
+  const int n = len / 2;
+  BitReverse(in, n);
+  for (int half = 1; half < n; half <<= 1) {
+    const int step = n / (2 * half);
+    for (int start = 0; start < n; start += 2 * half) {
+      for (int k = 0; k < half; k++) {
+        const float c = twiddle[2 * k * step], s = twiddle[2 * k * step + 1];
+        float *a = &in[2 * (start + k)], *b = &in[2 * (start + k + half)];
+        const float tr = b[0] * c + b[1] * s;
+        const float ti = b[1] * c - b[0] * s;
+        b[0] = a[0] - tr;
+        b[1] = a[1] - ti;
+        a[0] += tr;
+        a[1] += ti;
+      }
+    }
+  }
+  SplitSpectrum(in, out);
+}
+#endif
+
+// X[k] = (Z[k] + conj(Z[n-k])) / 2 - j W^k (Z[k] - conj(Z[n-k])) / 2 with
+// W = exp(-2 pi j / len), Z the spectrum of the packed even/odd samples.
+void RealFftF32::SplitSpectrum(const float *z, float *out) const {
+  const int n = len / 2;
+  out[0] = z[0] + z[1];
+  out[1] = z[0] - z[1];
+  for (int k = 1; k < n; k++) {
+    const float c = splitTwiddle[2 * k], s = splitTwiddle[2 * k + 1];
+    const float ar = z[2 * k] + z[2 * (n - k)];
+    const float ai = z[2 * k + 1] - z[2 * (n - k) + 1];
+    const float br = z[2 * k] - z[2 * (n - k)];
+    const float bi = z[2 * k + 1] + z[2 * (n - k) + 1];
+    out[2 * k] = 0.5f * (ar + c * bi - s * br);
+    out[2 * k + 1] = 0.5f * (ai - c * br - s * bi);
+  }
+}
+
+int RealFftQ15::Init(int len) {
+  if (len < 4 || (len & (len - 1)))
+    return -1;
+  this->len = len;
+  MakeTwiddle(twiddle, len / 2, len / 4, ToQ15);
+  MakeTwiddle(splitTwiddle, len, len / 2 + 1, ToQ15);
+  return 0;
+}
+
+// Every butterfly stage halves its outputs, which scales the complex FFT by
+// 2 / len; the split step keeps the scale, hence the riscv_rfft_q15 one.
+void RealFftQ15::Forward(int16_t *in, int16_t *out) {
+  const int n = len / 2;
+  BitReverse(in, n);
+  for (int half = 1; half < n; half <<= 1) {
+    const int step = n / (2 * half);
+    for (int start = 0; start < n; start += 2 * half) {
+      for (int k = 0; k < half; k++) {
+        const int32_t c = twiddle[2 * k * step], s = twiddle[2 * k * step + 1];
+        int16_t *a = &in[2 * (start + k)], *b = &in[2 * (start + k + half)];
+        const int32_t tr = (b[0] * c + b[1] * s + (1 << 14)) >> 15;
+        const int32_t ti = (b[1] * c - b[0] * s + (1 << 14)) >> 15;
+        const int32_t ar = a[0], ai = a[1];
+        a[0] = SaturateQ15((ar + tr + 1) >> 1);
+        a[1] = SaturateQ15((ai + ti + 1) >> 1);
+        b[0] = SaturateQ15((ar - tr + 1) >> 1);
+        b[1] = SaturateQ15((ai - ti + 1) >> 1);
+      }
+    }
+  }
+
+  out[0] = SaturateQ15(in[0] + in[1]);
+  out[1] = 0;
+  out[2 * n] = SaturateQ15(in[0] - in[1]);
+  out[2 * n + 1] = 0;
+  for (int k = 1; k < n; k++) {
+    const int64_t c = splitTwiddle[2 * k], s = splitTwiddle[2 * k + 1];
+    const int64_t ar = in[2 * k] + in[2 * (n - k)];
+    const int64_t ai = in[2 * k + 1] - in[2 * (n - k) + 1];
+    const int64_t br = in[2 * k] - in[2 * (n - k)];
+    const int64_t bi = in[2 * k + 1] + in[2 * (n - k) + 1];
+    // Sums of doubled Q15 values in Q30, one extra shift for the / 2.
+    out[2 * k] = SaturateQ15((ar * 32768 + c * bi - s * br + (1 << 15)) >> 16);
+    out[2 * k + 1] =
+      SaturateQ15((ai * 32768 - c * br - s * bi + (1 << 15)) >> 16);
+  }
+}
@@ -0,0 +1,91 @@
+#include <algorithm>
+
+#include "feature_kernels.h"
+#include "spectrum_service.h"
+
+// The shared spectrum is normalized to full scale, views shift their log-mel
+// by log(kFullScale / max_abs) instead of rescaling the frame.
+static constexpr float kFullScale = 1 << 15;
+
+SpectrumService::SpectrumService(int frameLen) : frameLen(frameLen) {
+  frameLenPadded = 1;
+  while (frameLenPadded < frameLen)
+    frameLenPadded <<= 1;
+
+  windowFunc = std::vector<float>(frameLen, 0.0);
+  for (int i = 0; i < frameLen; i++)
+    windowFunc[i] =
+      0.5 - 0.5 * cosf(M_2PI * (static_cast<float>(i)) / (frameLen));
+
+  frame = std::vector<float>(frameLenPadded, 0.0);
+  buffer = std::vector<float>(frameLenPadded, 0.0);
+  spanFirst = frameLenPadded / 2;
+  spanLast = -1;
+
+  fft.Init(frameLenPadded);
+}
+
+int SpectrumService::AddView(const ViewConfig &config) {
+  View view;
+  view.config = config;
+  view.fbank = AudioPreprocessor::CreateMelFbank(
+    config.numFbankBins, frameLenPadded, config.melLowF, config.melHighF);
+  view.melEnergies = std::vector<float>(config.numFbankBins, 0.0);
+  if (config.numMfccFeatures > 0) {
+    view.dctTable = std::vector<float>(feature_kernels::FoldedDctTableSize(
+      config.numMfccFeatures, config.numFbankBins));
+    feature_kernels::CreateFoldedDct(
+      config.numMfccFeatures, config.numFbankBins,
+      sqrt(2.0 / config.numFbankBins), [](double x) { return cos(x); },
+      view.dctTable.data());
+  }
+
+  spanFirst = std::min(spanFirst, view.fbank.spanFirst);
+  spanLast = std::max(spanLast, view.fbank.spanLast);
+  views.push_back(std::move(view));
+  return views.size() - 1;
+}
+
+void SpectrumService::Compute(const int16_t *data) {
+  feature_kernels::NormalizeWindow(data, windowFunc.data(), frameLen,
+                                   frameLenPadded, kFullScale, frame.data());
+  fft.Forward(frame.data(), buffer.data());
+  feature_kernels::PowerSpectrum(buffer.data(), frameLenPadded);
+  feature_kernels::MagnitudeSpectrum(buffer.data(), spanFirst, spanLast);
+}
+
+void SpectrumService::LogMelCompute(int view, float *mfccOut, size_t max_abs) {
+  View &v = views[view];
+  const int32_t numBins = v.config.numFbankBins;
+
+  feature_kernels::ApplyMelFbank(buffer.data(), v.fbank.filterFirst.data(),
+                                 v.fbank.filterLen.data(),
+                                 v.fbank.weights.data(), numBins,
+                                 v.melEnergies.data());
+  feature_kernels::Log(v.melEnergies.data(), mfccOut, numBins);
+
+  if (max_abs != kFullScale) {
+    const float offset = logf(kFullScale / max_abs);
+    for (int32_t bin = 0; bin < numBins; bin++)
+      mfccOut[bin] += offset;
+  }
+}
+
+void SpectrumService::LogMelCompute(
+  int view, int8_t *mfccOut, size_t max_abs,
+  const AudioPreprocessor::QuantParams &quant) {
+  View &v = views[view];
+  LogMelCompute(view, v.melEnergies.data(), max_abs);
+  const float invScale = 1.0f / quant.scale;
+  for (int32_t bin = 0; bin < v.config.numFbankBins; bin++) {
+    mfccOut[bin] =
+      feature_kernels::Quantize(v.melEnergies[bin], invScale, quant.zeroPoint);
+  }
+}
+
+void SpectrumService::MfccCompute(int view, float *mfccOut, size_t max_abs) {
+  View &v = views[view];
+  LogMelCompute(view, v.melEnergies.data(), max_abs);
+  feature_kernels::FoldedDct(v.dctTable.data(), v.melEnergies.data(), mfccOut,
+                             v.config.numMfccFeatures, v.config.numFbankBins);
+}
@@ -0,0 +1,59 @@
+#ifndef __SPECTRUM_SERVICE_H__
+#define __SPECTRUM_SERVICE_H__
+
+#include "audio_preprocessor.h"
+
+/*
+ * Window and FFT computed once per hop and shared by any number of feature
+ * views. Compute() turns a frame into a magnitude spectrum, each view then
+ * applies its own mel filterbank, log and optional DCT, so the KWS MFCC and
+ * SED log-mel front ends can run on the same audio for the cost of one FFT.
+ * Views share the frame length and sample rate. Float arithmetic only.
+ */
+class SpectrumService {
+public:
+  struct ViewConfig {
+    int numFbankBins;
+    // 0 for a log-mel view.
+    int numMfccFeatures;
+    int melLowF;
+    int melHighF;
+  };
+
+  explicit SpectrumService(int frameLen);
+  ~SpectrumService() = default;
+
+  // Register a view before the first Compute(), returns its id.
+  int AddView(const ViewConfig &config);
+
+  // Window and FFT one frame into the shared spectrum.
+  void Compute(const int16_t *data);
+
+  // Features of a view for the last computed frame, normalized to data /
+  // max_abs like AudioPreprocessor does.
+  void MfccCompute(int view, float *mfccOut, size_t max_abs);
+  void LogMelCompute(int view, float *mfccOut, size_t max_abs);
+  void LogMelCompute(int view, int8_t *mfccOut, size_t max_abs,
+                     const AudioPreprocessor::QuantParams &quant);
+
+private:
+  struct View {
+    ViewConfig config;
+    AudioPreprocessor::MelFbank fbank;
+    std::vector<float> dctTable;
+    std::vector<float> melEnergies;
+  };
+
+  int frameLen;
+  int frameLenPadded;
+  std::vector<float> windowFunc;
+  std::vector<float> frame;
+  std::vector<float> buffer;
+  // Union of the filterbank spans of all views, where magnitudes are taken.
+  int32_t spanFirst;
+  int32_t spanLast;
+  std::vector<View> views;
+  RealFftF32 fft;
+};
+
+#endif
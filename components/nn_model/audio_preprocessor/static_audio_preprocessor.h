@@ -0,0 +1,229 @@
+#ifndef __STATIC_AUDIO_PREPROCESSOR_H__
+#define __STATIC_AUDIO_PREPROCESSOR_H__
+
+#include "audio_preprocessor.h"
+#include "feature_kernels.h"
+
+/*
+ * constexpr replacements for the libm calls used to build the tables, so
+ * that they can be evaluated by the compiler. The float variants round the
+ * double results, like a correctly rounded cosf/logf.
+ */
+namespace static_pp_math {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kLn2 = 0.69314718055994530942;
+
+constexpr double Cos(double x) {
+  // Reduce to [-pi, pi].
+  x -= 2 * kPi * static_cast<long long>(x / (2 * kPi));
+  if (x > kPi)
+    x -= 2 * kPi;
+  else if (x < -kPi)
+    x += 2 * kPi;
+  const double x2 = x * x;
+  double term = 1.0, sum = 1.0;
+  for (int i = 1; i < 20; i++) {
+    term *= -x2 / ((2 * i - 1) * (2 * i));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double Log(double x) {
+  // x = m * 2^e, m in [0.75, 1.5), then log(m) = 2 * atanh((m - 1) / (m + 1)).
+  int e = 0;
+  while (x >= 1.5) {
+    x /= 2;
+    e++;
+  }
+  while (x < 0.75) {
+    x *= 2;
+    e--;
+  }
+  const double y = (x - 1) / (x + 1), y2 = y * y;
+  double term = y, sum = 0.0;
+  for (int i = 1; i < 40; i += 2) {
+    sum += term / i;
+    term *= y2;
+  }
+  return 2 * sum + e * kLn2;
+}
+
+constexpr float Cosf(float x) { return static_cast<float>(Cos(x)); }
+
+constexpr float Logf(float x) { return static_cast<float>(Log(x)); }
+
+constexpr double Sqrt(double x) {
+  double r = x > 1.0 ? x : 1.0;
+  for (int i = 0; i < 64; i++)
+    r = 0.5 * (r + x / r);
+  return r;
+}
+
+constexpr int NextPow2(int x) {
+  int p = 1;
+  while (p < x)
+    p <<= 1;
+  return p;
+}
+
+} // namespace static_pp_math
+
+/*
+ * AudioPreprocessor specialized at compile time. Window, mel filterbank and
+ * DCT weights are constexpr tables in rodata, computed with the same float
+ * expressions as AudioPreprocessor, and the compiler sees all loop bounds.
+ * The object holds the working buffers and the FFT, whose backend may still
+ * build twiddle tables at startup. Float arithmetic only, use
+ * AudioPreprocessor for the fixed point pipeline or sizes known at runtime.
+ */
+template <int FrameLen, int NumFbankBins, int NumMfccFeatures, int MelLowF,
+          int MelHighF, int SampleRate = SAMP_FREQ>
+class StaticAudioPreprocessor {
+public:
+  StaticAudioPreprocessor() {
+    // NMSIS binds precomputed twiddle tables, the esp-dsp and portable
+    // backends compute theirs into heap vectors.
+    ready = fft.Init(kFrameLenPadded) == 0;
+  }
+
+  // False when the FFT could not be initialized, the features are invalid.
+  bool IsReady() const { return ready; }
+
+  void MfccCompute(const int16_t *data, float *mfccOut, size_t max_abs) {
+    LogMelCompute(data, melEnergies, max_abs);
+    feature_kernels::FoldedDct(kTables.dctTable, melEnergies, mfccOut,
+                               NumMfccFeatures, NumFbankBins);
+  }
+
+  void LogMelCompute(const int16_t *data, float *mfccOut, size_t max_abs) {
+    feature_kernels::NormalizeWindow(data, kTables.windowFunc, FrameLen,
+                                     kFrameLenPadded, max_abs, frame);
+    fft.Forward(frame, buffer);
+    feature_kernels::PowerSpectrum(buffer, kFrameLenPadded);
+    feature_kernels::MagnitudeSpectrum(buffer, kTables.fbankSpanFirst,
+                                       kTables.fbankSpanLast);
+    feature_kernels::ApplyMelFbank(buffer, kTables.fbankFilterFirst,
+                                   kTables.fbankFilterLen, kTables.fbankWeights,
+                                   NumFbankBins, melEnergies);
+    feature_kernels::Log(melEnergies, mfccOut, NumFbankBins);
+  }
+
+  void LogMelCompute(const int16_t *data, int8_t *mfccOut, size_t max_abs,
+                     const AudioPreprocessor::QuantParams &quant) {
+    LogMelCompute(data, melEnergies, max_abs);
+    const float invScale = 1.0f / quant.scale;
+    for (int bin = 0; bin < NumFbankBins; bin++) {
+      mfccOut[bin] =
+        feature_kernels::Quantize(melEnergies[bin], invScale, quant.zeroPoint);
+    }
+  }
+
+  // Batched variants, see AudioPreprocessor.
+  void MfccCompute(const int16_t *data, int32_t hop, int32_t numFrames,
+                   float *mfccOut, size_t max_abs) {
+    for (int32_t i = 0; i < numFrames; i++)
+      MfccCompute(&data[i * hop], &mfccOut[i * NumMfccFeatures], max_abs);
+  }
+
+  void LogMelCompute(const int16_t *data, int32_t hop, int32_t numFrames,
+                     float *mfccOut, size_t max_abs) {
+    for (int32_t i = 0; i < numFrames; i++)
+      LogMelCompute(&data[i * hop], &mfccOut[i * NumFbankBins], max_abs);
+  }
+
+private:
+  static constexpr int kFrameLenPadded = static_pp_math::NextPow2(FrameLen);
+  static constexpr int kNumFftBins = kFrameLenPadded / 2;
+
+  // AudioPreprocessor::MelScale.
+  static constexpr float MelScale(float freq) {
+    return 1127.0f * static_pp_math::Logf(1.0f + freq / 700.0f);
+  }
+
+  // Weight of FFT bin i in mel filter bin, 0 outside of the triangle, as
+  // computed by AudioPreprocessor::CreateMelFbank.
+  static constexpr float FbankWeight(int bin, int i) {
+    const float melLowFreq = MelScale(MelLowF);
+    const float melHighFreq = MelScale(MelHighF);
+    const float melFreqDelta = (melHighFreq - melLowFreq) / (NumFbankBins + 1);
+    const float leftMel = melLowFreq + bin * melFreqDelta;
+    const float centerMel = melLowFreq + (bin + 1) * melFreqDelta;
+    const float rightMel = melLowFreq + (bin + 2) * melFreqDelta;
+    const float fftBinWidth = static_cast<float>(SampleRate) / kFrameLenPadded;
+    const float mel = MelScale(fftBinWidth * i);
+    if (!(mel > leftMel && mel < rightMel))
+      return 0.0f;
+    return mel <= centerMel ? (mel - leftMel) / (centerMel - leftMel)
+                            : (rightMel - mel) / (rightMel - centerMel);
+  }
+
+  static constexpr int CountFbankWeights() {
+    int count = 0;
+    for (int bin = 0; bin < NumFbankBins; bin++)
+      for (int i = 0; i < kNumFftBins; i++)
+        count += FbankWeight(bin, i) > 0.0f;
+    return count;
+  }
+
+  static constexpr int kNumFbankWeights = CountFbankWeights();
+
+  static constexpr int kDctTableSize =
+    feature_kernels::FoldedDctTableSize(NumMfccFeatures, NumFbankBins);
+
+  struct Tables {
+    float windowFunc[FrameLen];
+    int32_t fbankFilterFirst[NumFbankBins];
+    int32_t fbankFilterLen[NumFbankBins];
+    float fbankWeights[kNumFbankWeights > 0 ? kNumFbankWeights : 1];
+    int32_t fbankSpanFirst;
+    int32_t fbankSpanLast;
+    float dctTable[kDctTableSize > 0 ? kDctTableSize : 1];
+  };
+
+  static constexpr Tables MakeTables() {
+    using namespace static_pp_math;
+    Tables t{};
+
+    for (int i = 0; i < FrameLen; i++)
+      t.windowFunc[i] = 0.5 - 0.5 * Cosf(2 * kPi * i / FrameLen);
+
+    int w = 0;
+    t.fbankSpanFirst = kNumFftBins;
+    t.fbankSpanLast = -1;
+    for (int bin = 0; bin < NumFbankBins; bin++) {
+      for (int i = 0; i < kNumFftBins; i++) {
+        const float weight = FbankWeight(bin, i);
+        if (weight <= 0.0f)
+          continue;
+        if (t.fbankFilterLen[bin] == 0)
+          t.fbankFilterFirst[bin] = i;
+        t.fbankFilterLen[bin]++;
+        t.fbankWeights[w++] = weight;
+      }
+      if (t.fbankFilterLen[bin] == 0)
+        continue;
+      const int last = t.fbankFilterFirst[bin] + t.fbankFilterLen[bin] - 1;
+      if (t.fbankFilterFirst[bin] < t.fbankSpanFirst)
+        t.fbankSpanFirst = t.fbankFilterFirst[bin];
+      if (last > t.fbankSpanLast)
+        t.fbankSpanLast = last;
+    }
+
+    feature_kernels::CreateFoldedDct(NumMfccFeatures, NumFbankBins,
+                                     Sqrt(2.0 / NumFbankBins), Cos,
+                                     t.dctTable);
+    return t;
+  }
+
+  static constexpr Tables kTables = MakeTables();
+
+  float frame[kFrameLenPadded];
+  float buffer[kFrameLenPadded];
+  float melEnergies[NumFbankBins];
+  RealFftF32 fft;
+  bool ready;
+};
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef _CUSTOM_OP_KERNELS_H_
+#define _CUSTOM_OP_KERNELS_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "quant_math.h"
+
+/*
+ * Integer loops of the custom ops, without the TFLM headers: the ops parse
+ * their options and tensors in Prepare and call these from Eval, the host
+ * tests compare them with the reference kernels they replace.
+ */
+namespace custom_op_kernels {
+
+// Geometry and quantization of a GRC_DS_CONV_BLOCK, see ds_conv_block.h.
+struct DsConvBlockParams {
+  int in_height;
+  int in_width;
+  int channels;
+  int filter_height;
+  int filter_width;
+  int out_height;
+  int out_width;
+  int out_channels;
+  int stride_width;
+  int stride_height;
+  int dilation_width;
+  int dilation_height;
+  int pad_width;
+  int pad_height;
+  int32_t input_offset;
+  int32_t mid_zero_point;
+  int32_t output_offset;
+  // Per channel requantization of the depthwise and pointwise outputs.
+  const int32_t *dw_multiplier;
+  const int32_t *dw_shift;
+  const int32_t *pw_multiplier;
+  const int32_t *pw_shift;
+  int32_t dw_min;
+  int32_t dw_max;
+  int32_t pw_min;
+  int32_t pw_max;
+};
+
+// Depthwise output row by row, each consumed by the pointwise convolution
+// right away. row holds out_width * channels int8, acc channels int32. The
+// biases are optional.
+inline void DsConvBlock(const DsConvBlockParams &p, const int8_t *in,
+                        const int8_t *dw_f, const int32_t *dw_b,
+                        const int8_t *pw_f, const int32_t *pw_b, int8_t *out,
+                        int8_t *row, int32_t *acc) {
+  const int channels = p.channels;
+  const int32_t mid_offset = -p.mid_zero_point;
+  for (int oy = 0; oy < p.out_height; oy++) {
+    const int iy0 = oy * p.stride_height - p.pad_height;
+
+    // Depthwise output row, the only part of the intermediate tensor.
+    for (int ox = 0; ox < p.out_width; ox++) {
+      const int ix0 = ox * p.stride_width - p.pad_width;
+      for (int c = 0; c < channels; c++) {
+        acc[c] = dw_b ? dw_b[c] : 0;
+      }
+      for (int ky = 0; ky < p.filter_height; ky++) {
+        const int iy = iy0 + ky * p.dilation_height;
+        if (iy < 0 || iy >= p.in_height) {
+          continue;
+        }
+        for (int kx = 0; kx < p.filter_width; kx++) {
+          const int ix = ix0 + kx * p.dilation_width;
+          if (ix < 0 || ix >= p.in_width) {
+            continue;
+          }
+          const int8_t *src = &in[(iy * p.in_width + ix) * channels];
+          const int8_t *f = &dw_f[(ky * p.filter_width + kx) * channels];
+          for (int c = 0; c < channels; c++) {
+            acc[c] += (src[c] + p.input_offset) * f[c];
+          }
+        }
+      }
+      int8_t *dst = &row[ox * channels];
+      for (int c = 0; c < channels; c++) {
+        const int32_t val =
+          quant_math::MultiplyByQuantizedMultiplier(acc[c], p.dw_multiplier[c],
+                                                    p.dw_shift[c]) +
+          p.mid_zero_point;
+        dst[c] = std::min(std::max(val, p.dw_min), p.dw_max);
+      }
+    }
+
+    // Pointwise convolution of the row.
+    for (int ox = 0; ox < p.out_width; ox++) {
+      const int8_t *src = &row[ox * channels];
+      int8_t *dst = &out[(oy * p.out_width + ox) * p.out_channels];
+      for (int o = 0; o < p.out_channels; o++) {
+        const int8_t *f = &pw_f[o * channels];
+        int32_t sum = pw_b ? pw_b[o] : 0;
+        for (int c = 0; c < channels; c++) {
+          sum += (src[c] + mid_offset) * f[c];
+        }
+        const int32_t val =
+          quant_math::MultiplyByQuantizedMultiplier(sum, p.pw_multiplier[o],
+                                                    p.pw_shift[o]) +
+          p.output_offset;
+        dst[o] = std::min(std::max(val, p.pw_min), p.pw_max);
+      }
+    }
+  }
+}
+
+// Geometry and quantization of a GRC_SPARSE_FC, see sparse_fc.h.
+struct SparseFcParams {
+  int in_features;
+  int out_features;
+  int block;
+  int blocks_num;
+  int bitmap_row_bytes;
+  int32_t input_offset;
+  int32_t output_offset;
+  int32_t multiplier;
+  int shift;
+  int32_t act_min;
+  int32_t act_max;
+};
+
+// FullyConnected of batches input rows on the stored weight blocks only,
+// the bias is optional.
+inline void SparseFc(const SparseFcParams &p, int batches, const int8_t *in,
+                     const int8_t *weights, const uint8_t *bitmap,
+                     const int32_t *bias, int8_t *out) {
+  for (int batch = 0; batch < batches; batch++) {
+    const int8_t *x = &in[batch * p.in_features];
+    const int8_t *w = weights;
+    const uint8_t *bits = bitmap;
+    for (int o = 0; o < p.out_features; o++) {
+      int32_t acc = bias ? bias[o] : 0;
+      for (int blk = 0; blk < p.blocks_num; blk++) {
+        if (!(bits[blk >> 3] & (1 << (blk & 7)))) {
+          continue;
+        }
+        const int base = blk * p.block;
+        const int len = std::min(p.block, p.in_features - base);
+        for (int k = 0; k < len; k++) {
+          acc += (x[base + k] + p.input_offset) * w[k];
+        }
+        w += p.block;
+      }
+      bits += p.bitmap_row_bytes;
+      const int32_t val = quant_math::MultiplyByQuantizedMultiplier(
+                            acc, p.multiplier, p.shift) +
+                          p.output_offset;
+      out[batch * p.out_features + o] =
+        std::min(std::max(val, p.act_min), p.act_max);
+    }
+  }
+}
+
+// Geometry of a GRC_STREAM_BUFFER, see stream_buffer.h.
+struct StreamBufferParams {
+  int input_rows;
+  int state_rows;
+  // Bytes of a state row, of its padding on each side.
+  size_t row_bytes;
+  size_t left_bytes;
+  size_t right_bytes;
+  // Rows of the stream standing for padding, see stream_buffer.h.
+  int skip;
+  // Byte value of a zero.
+  uint8_t zero;
+};
+
+// Append the input rows to the state and output it padded in width. seen
+// counts the rows since the state was reset up to skip, it may be null
+// without rows to skip.
+inline void StreamBuffer(const StreamBufferParams &p, const uint8_t *in,
+                         uint8_t *rows, int32_t *seen, uint8_t *out) {
+  const size_t row_bytes = p.row_bytes;
+
+  // Oldest rows out, input rows in at the end.
+  const int appended = std::min(p.input_rows, p.state_rows);
+  const int kept = p.state_rows - appended;
+  memmove(rows, &rows[appended * row_bytes], kept * row_bytes);
+  memcpy(&rows[kept * row_bytes], &in[(p.input_rows - appended) * row_bytes],
+         appended * row_bytes);
+  if (seen && *seen < p.skip) {
+    // Rows an earlier layer computed before the start of the stream, the
+    // SAME padding of the full-window model has zeros there.
+    const int first = *seen + p.input_rows - appended;
+    const int zeroed = std::min(p.skip - first, appended);
+    if (zeroed > 0) {
+      memset(&rows[kept * row_bytes], p.zero, zeroed * row_bytes);
+    }
+    *seen = std::min(*seen + p.input_rows, p.skip);
+  }
+
+  if (!p.left_bytes && !p.right_bytes) {
+    memcpy(out, rows, p.state_rows * row_bytes);
+    return;
+  }
+  for (int i = 0; i < p.state_rows; i++) {
+    memset(out, p.zero, p.left_bytes);
+    out += p.left_bytes;
+    memcpy(out, &rows[i * row_bytes], row_bytes);
+    out += row_bytes;
+    memset(out, p.zero, p.right_bytes);
+    out += p.right_bytes;
+  }
+}
+
+} // namespace custom_op_kernels
+
+#endif // _CUSTOM_OP_KERNELS_H_
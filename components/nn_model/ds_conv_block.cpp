@@ -0,0 +1,267 @@
+#include "ds_conv_block.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "custom_op_kernels.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/padding.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace {
+
+constexpr int kInput = 0;
+constexpr int kDwFilter = 1;
+constexpr int kDwBias = 2;
+constexpr int kPwFilter = 3;
+constexpr int kPwBias = 4;
+constexpr int kOutput = 0;
+
+constexpr uint8_t kVersion = 1;
+constexpr size_t kOptionsSize = 20;
+
+struct OpData {
+  // Parsed custom options.
+  bool options_valid;
+  uint8_t padding;
+  uint8_t dw_activation;
+  uint8_t pw_activation;
+  int stride_width;
+  int stride_height;
+  int dilation_width;
+  int dilation_height;
+  float mid_scale;
+  int32_t mid_zero_point;
+
+  custom_op_kernels::DsConvBlockParams kernel;
+  // Depthwise output row and its accumulators.
+  int row_index;
+  int acc_index;
+};
+
+template <typename T> T ReadLE(const uint8_t *p) {
+  T val;
+  memcpy(&val, p, sizeof(T));
+  return val;
+}
+
+void *Init(TfLiteContext *context, const char *buffer, size_t length) {
+  OpData *data = static_cast<OpData *>(
+    context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (!data) {
+    return nullptr;
+  }
+  memset(data, 0, sizeof(OpData));
+  const uint8_t *options = reinterpret_cast<const uint8_t *>(buffer);
+  if (!options || length < kOptionsSize || options[0] != kVersion) {
+    return data;
+  }
+  data->padding = options[1];
+  data->dw_activation = options[2];
+  data->pw_activation = options[3];
+  data->stride_width = ReadLE<uint16_t>(&options[4]);
+  data->stride_height = ReadLE<uint16_t>(&options[6]);
+  data->dilation_width = ReadLE<uint16_t>(&options[8]);
+  data->dilation_height = ReadLE<uint16_t>(&options[10]);
+  data->mid_scale = ReadLE<float>(&options[12]);
+  data->mid_zero_point = ReadLE<int32_t>(&options[16]);
+  data->options_valid = true;
+  return data;
+}
+
+// Same range as CalculateActivationRangeQuantized for a tensor of the given
+// quantization.
+TfLiteStatus ActivationRange(TfLiteContext *context, uint8_t activation,
+                             float scale, int32_t zero_point, int32_t *min,
+                             int32_t *max) {
+  *min = INT8_MIN;
+  *max = INT8_MAX;
+  switch (activation) {
+  case kTfLiteActNone:
+    break;
+  case kTfLiteActRelu:
+    *min = std::max<int32_t>(*min, zero_point);
+    break;
+  case kTfLiteActRelu6:
+    *min = std::max<int32_t>(*min, zero_point);
+    *max = std::min<int32_t>(
+      *max, zero_point + static_cast<int32_t>(TfLiteRound(6.f / scale)));
+    break;
+  default:
+    TF_LITE_KERNEL_LOG(context, "unsupported activation %d", activation);
+    return kTfLiteError;
+  }
+  return kTfLiteOk;
+}
+
+// Per channel multipliers as PopulateConvolutionQuantizationParams computes
+// them, so that results match the unfused kernels bit for bit.
+TfLiteStatus ChannelMultipliers(TfLiteContext *context,
+                                const TfLiteTensor *filter, float input_scale,
+                                float output_scale, int channels,
+                                int32_t **multiplier, int32_t **shift) {
+  const auto *quant =
+    static_cast<const TfLiteAffineQuantization *>(filter->quantization.params);
+  TF_LITE_ENSURE(context, filter->quantization.type ==
+                            kTfLiteAffineQuantization &&
+                            quant && quant->scale);
+  const bool per_channel = quant->scale->size > 1;
+  TF_LITE_ENSURE(context, !per_channel || quant->scale->size == channels);
+  for (int i = 0; quant->zero_point && i < quant->zero_point->size; i++) {
+    TF_LITE_ENSURE_EQ(context, quant->zero_point->data[i], 0);
+  }
+
+  *multiplier = static_cast<int32_t *>(
+    context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  *shift = static_cast<int32_t *>(
+    context->AllocatePersistentBuffer(context, channels * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, *multiplier && *shift);
+  for (int c = 0; c < channels; c++) {
+    const double filter_scale =
+      static_cast<double>(quant->scale->data[per_channel ? c : 0]);
+    const double effective_scale = static_cast<double>(input_scale) *
+                                   filter_scale /
+                                   static_cast<double>(output_scale);
+    int channel_shift;
+    tflite::QuantizeMultiplier(effective_scale, &(*multiplier)[c],
+                               &channel_shift);
+    (*shift)[c] = channel_shift;
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus Prepare(TfLiteContext *context, TfLiteNode *node) {
+  OpData *data = static_cast<OpData *>(node->user_data);
+  TF_LITE_ENSURE(context, data != nullptr);
+  if (!data->options_valid) {
+    TF_LITE_KERNEL_LOG(context, "%s: bad options", DS_CONV_BLOCK_OP_NAME);
+    return kTfLiteError;
+  }
+  TF_LITE_ENSURE_EQ(context, node->inputs->size, 5);
+  TF_LITE_ENSURE_EQ(context, node->outputs->size, 1);
+
+  tflite::MicroContext *micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor *input = micro_context->AllocateTempInputTensor(node, kInput);
+  TfLiteTensor *dw_filter =
+    micro_context->AllocateTempInputTensor(node, kDwFilter);
+  TfLiteTensor *pw_filter =
+    micro_context->AllocateTempInputTensor(node, kPwFilter);
+  TfLiteTensor *output = micro_context->AllocateTempOutputTensor(node, kOutput);
+  TF_LITE_ENSURE(context, input && dw_filter && pw_filter && output);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, dw_filter->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, pw_filter->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+
+  // NHWC input, [1, H, W, C] depthwise filter, [O, 1, 1, C] pointwise one.
+  TF_LITE_ENSURE_EQ(context, input->dims->size, 4);
+  TF_LITE_ENSURE_EQ(context, input->dims->data[0], 1);
+  const int in_height = input->dims->data[1];
+  const int in_width = input->dims->data[2];
+  const int channels = input->dims->data[3];
+  TF_LITE_ENSURE_EQ(context, dw_filter->dims->size, 4);
+  TF_LITE_ENSURE_EQ(context, dw_filter->dims->data[3], channels);
+  const int filter_height = dw_filter->dims->data[1];
+  const int filter_width = dw_filter->dims->data[2];
+  TF_LITE_ENSURE_EQ(context, pw_filter->dims->size, 4);
+  TF_LITE_ENSURE_EQ(context, pw_filter->dims->data[1], 1);
+  TF_LITE_ENSURE_EQ(context, pw_filter->dims->data[2], 1);
+  TF_LITE_ENSURE_EQ(context, pw_filter->dims->data[3], channels);
+  const int out_channels = pw_filter->dims->data[0];
+
+  custom_op_kernels::DsConvBlockParams &kernel = data->kernel;
+  int out_height, out_width;
+  const TfLitePaddingValues padding_values = tflite::ComputePaddingHeightWidth(
+    data->stride_height, data->stride_width, data->dilation_height,
+    data->dilation_width, in_height, in_width, filter_height, filter_width,
+    data->padding == 0 ? kTfLitePaddingSame : kTfLitePaddingValid,
+    &out_height, &out_width);
+  TF_LITE_ENSURE_EQ(context, output->dims->size, 4);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[1], out_height);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[2], out_width);
+  TF_LITE_ENSURE_EQ(context, output->dims->data[3], out_channels);
+  kernel.in_height = in_height;
+  kernel.in_width = in_width;
+  kernel.channels = channels;
+  kernel.filter_height = filter_height;
+  kernel.filter_width = filter_width;
+  kernel.out_height = out_height;
+  kernel.out_width = out_width;
+  kernel.out_channels = out_channels;
+  kernel.stride_width = data->stride_width;
+  kernel.stride_height = data->stride_height;
+  kernel.dilation_width = data->dilation_width;
+  kernel.dilation_height = data->dilation_height;
+  kernel.pad_width = padding_values.width;
+  kernel.pad_height = padding_values.height;
+
+  kernel.input_offset = -input->params.zero_point;
+  kernel.mid_zero_point = data->mid_zero_point;
+  kernel.output_offset = output->params.zero_point;
+  int32_t *multiplier, *shift;
+  TF_LITE_ENSURE_STATUS(ChannelMultipliers(context, dw_filter,
+                                           input->params.scale, data->mid_scale,
+                                           channels, &multiplier, &shift));
+  kernel.dw_multiplier = multiplier;
+  kernel.dw_shift = shift;
+  TF_LITE_ENSURE_STATUS(ChannelMultipliers(context, pw_filter, data->mid_scale,
+                                           output->params.scale, out_channels,
+                                           &multiplier, &shift));
+  kernel.pw_multiplier = multiplier;
+  kernel.pw_shift = shift;
+  TF_LITE_ENSURE_STATUS(ActivationRange(context, data->dw_activation,
+                                        data->mid_scale, data->mid_zero_point,
+                                        &kernel.dw_min, &kernel.dw_max));
+  TF_LITE_ENSURE_STATUS(ActivationRange(
+    context, data->pw_activation, output->params.scale,
+    output->params.zero_point, &kernel.pw_min, &kernel.pw_max));
+
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+    context, out_width * channels, &data->row_index));
+  TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+    context, channels * sizeof(int32_t), &data->acc_index));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(dw_filter);
+  micro_context->DeallocateTempTfLiteTensor(pw_filter);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext *context, TfLiteNode *node) {
+  const OpData &data = *static_cast<const OpData *>(node->user_data);
+  const TfLiteEvalTensor *input =
+    tflite::micro::GetEvalInput(context, node, kInput);
+  const TfLiteEvalTensor *dw_filter =
+    tflite::micro::GetEvalInput(context, node, kDwFilter);
+  const TfLiteEvalTensor *dw_bias =
+    tflite::micro::GetEvalInput(context, node, kDwBias);
+  const TfLiteEvalTensor *pw_filter =
+    tflite::micro::GetEvalInput(context, node, kPwFilter);
+  const TfLiteEvalTensor *pw_bias =
+    tflite::micro::GetEvalInput(context, node, kPwBias);
+  TfLiteEvalTensor *output =
+    tflite::micro::GetEvalOutput(context, node, kOutput);
+
+  int8_t *row =
+    static_cast<int8_t *>(context->GetScratchBuffer(context, data.row_index));
+  int32_t *acc =
+    static_cast<int32_t *>(context->GetScratchBuffer(context, data.acc_index));
+  custom_op_kernels::DsConvBlock(
+    data.kernel, tflite::micro::GetTensorData<int8_t>(input),
+    tflite::micro::GetTensorData<int8_t>(dw_filter),
+    tflite::micro::GetOptionalTensorData<int32_t>(dw_bias),
+    tflite::micro::GetTensorData<int8_t>(pw_filter),
+    tflite::micro::GetOptionalTensorData<int32_t>(pw_bias),
+    tflite::micro::GetTensorData<int8_t>(output), row, acc);
+  return kTfLiteOk;
+}
+
+} // namespace
+
+TFLMRegistration Register_DS_CONV_BLOCK() {
+  return tflite::micro::RegisterOp(Init, Prepare, Eval);
+}
@@ -0,0 +1,25 @@
+#ifndef _DS_CONV_BLOCK_H_
+#define _DS_CONV_BLOCK_H_
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+/*
+ * Custom op of a depthwise-separable block produced by tools/fuse_ds_conv.py:
+ * int8 DepthwiseConv2D (depth multiplier 1) then Conv2D 1x1, each with its
+ * ReLU or ReLU6. The depthwise output is computed one output row at a time
+ * and consumed by the pointwise convolution right away, the intermediate
+ * tensor only exists as that row in a scratch buffer.
+ *
+ * Inputs: input, depthwise filter, depthwise bias, pointwise filter,
+ * pointwise bias, as the fused ops had them. Custom options, little endian:
+ * - u8 version (1);
+ * - u8 padding, tflite::Padding;
+ * - u8 depthwise activation, u8 pointwise activation, TfLiteFusedActivation;
+ * - u16 stride width, stride height, dilation width, dilation height;
+ * - f32 scale, i32 zero point of the intermediate tensor.
+ */
+#define DS_CONV_BLOCK_OP_NAME "GRC_DS_CONV_BLOCK"
+
+TFLMRegistration Register_DS_CONV_BLOCK();
+
+#endif // _DS_CONV_BLOCK_H_
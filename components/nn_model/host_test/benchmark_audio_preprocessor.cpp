@@ -0,0 +1,151 @@
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include "audio_preprocessor.h"
+#include "golden_features.h"
+#include "real_fft.h"
+#include "static_audio_preprocessor.h"
+
+/*
+ * ns per frame, frames per second and heap allocations of the KWS (MFCC) and
+ * SED (int8 log-mel) front ends, for every preprocessor flavour. Exits with
+ * an error if computing a frame allocates.
+ *
+ *   benchmark_audio_preprocessor [frames]
+ */
+
+#define KWS_BINS      40
+#define KWS_MFCC      10
+#define KWS_LOW_FREQ  20
+#define KWS_HIGH_FREQ 4000
+
+#define SED_BINS      40
+#define SED_LOW_FREQ  0
+#define SED_HIGH_FREQ 8000
+#define SED_MAX_ABS   (1 << 15)
+
+namespace {
+
+size_t s_allocs = 0;
+size_t s_alloc_bytes = 0;
+
+struct AllocCount {
+  size_t allocs;
+  size_t bytes;
+};
+
+AllocCount Allocs() { return {s_allocs, s_alloc_bytes}; }
+
+AllocCount Since(const AllocCount &start) {
+  return {s_allocs - start.allocs, s_alloc_bytes - start.bytes};
+}
+
+const AudioPreprocessor::QuantParams kSedQuant = {0.0957f, 13};
+
+struct Result {
+  AllocCount init;
+  AllocCount frames;
+  double nsPerFrame;
+};
+
+// Construct with make, then run compute(pp, frame) over the golden audio.
+template <typename Make, typename Compute>
+Result Measure(int frames, Make make, Compute compute) {
+  Result result;
+  const AllocCount start = Allocs();
+  auto pp = make();
+  result.init = Since(start);
+
+  // Warm up the caches and the branch predictors.
+  for (int i = 0; i < GOLDEN_FRAMES; i++)
+    compute(*pp, &kGoldenAudio[i * GOLDEN_FRAME_SHIFT]);
+
+  const AllocCount framesStart = Allocs();
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; i++)
+    compute(*pp, &kGoldenAudio[(i % GOLDEN_FRAMES) * GOLDEN_FRAME_SHIFT]);
+  const auto t1 = std::chrono::steady_clock::now();
+  result.frames = Since(framesStart);
+  result.nsPerFrame =
+    std::chrono::duration<double, std::nano>(t1 - t0).count() / frames;
+  return result;
+}
+
+bool Report(const char *config, const char *name, const Result &r) {
+  printf("%-4s %-26s %9.0f ns/frame %9.0f fps  init %3zu allocs %7zu B  "
+         "frames %zu allocs\n",
+         config, name, r.nsPerFrame, 1e9 / r.nsPerFrame, r.init.allocs,
+         r.init.bytes, r.frames.allocs);
+  return r.frames.allocs == 0;
+}
+
+template <AudioPreprocessor::Arithmetic A> auto MakeKws() {
+  return std::make_unique<AudioPreprocessor>(KWS_MFCC, GOLDEN_FRAME_LEN,
+                                             KWS_BINS, KWS_LOW_FREQ,
+                                             KWS_HIGH_FREQ, A);
+}
+
+template <AudioPreprocessor::Arithmetic A> auto MakeSed() {
+  return std::make_unique<AudioPreprocessor>(
+    0, GOLDEN_FRAME_LEN, SED_BINS, SED_LOW_FREQ, SED_HIGH_FREQ, A);
+}
+
+typedef StaticAudioPreprocessor<GOLDEN_FRAME_LEN, KWS_BINS, KWS_MFCC,
+                                KWS_LOW_FREQ, KWS_HIGH_FREQ>
+  StaticKws;
+typedef StaticAudioPreprocessor<GOLDEN_FRAME_LEN, SED_BINS, 0, SED_LOW_FREQ,
+                                SED_HIGH_FREQ>
+  StaticSed;
+
+} // namespace
+
+void *operator new(size_t size) {
+  s_allocs++;
+  s_alloc_bytes += size;
+  if (void *p = malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+int main(int argc, char **argv) {
+  const int frames = argc > 1 ? atoi(argv[1]) : 2000;
+  if (frames <= 0) {
+    printf("usage: %s [frames]\n", argv[0]);
+    return 1;
+  }
+  using Arithmetic = AudioPreprocessor::Arithmetic;
+  float mfcc[KWS_MFCC];
+  int8_t logMel[SED_BINS];
+  auto kws = [&](auto &pp, const int16_t *frame) {
+    pp.MfccCompute(frame, mfcc, GOLDEN_AUDIO_PEAK);
+  };
+  auto sed = [&](auto &pp, const int16_t *frame) {
+    pp.LogMelCompute(frame, logMel, SED_MAX_ABS, kSedQuant);
+  };
+
+  printf("%d frames of %d samples\n", frames, GOLDEN_FRAME_LEN);
+  bool ok = true;
+  ok &= Report("KWS", "AudioPreprocessor float",
+               Measure(frames, MakeKws<Arithmetic::Float>, kws));
+  ok &= Report("KWS", "AudioPreprocessor fixed",
+               Measure(frames, MakeKws<Arithmetic::Fixed>, kws));
+  ok &= Report("KWS", "StaticAudioPreprocessor",
+               Measure(frames, std::make_unique<StaticKws>, kws));
+  ok &= Report("SED", "AudioPreprocessor float",
+               Measure(frames, MakeSed<Arithmetic::Float>, sed));
+  ok &= Report("SED", "AudioPreprocessor fixed",
+               Measure(frames, MakeSed<Arithmetic::Fixed>, sed));
+  ok &= Report("SED", "StaticAudioPreprocessor",
+               Measure(frames, std::make_unique<StaticSed>, sed));
+
+  real_fft_benchmark(frames);
+  return ok ? 0 : 1;
+}
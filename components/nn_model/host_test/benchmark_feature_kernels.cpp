@@ -0,0 +1,104 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "feature_kernels.h"
+
+/*
+ * ns per call of the feature_kernels routines against the plain code they
+ * replace.
+ *
+ *   benchmark_feature_kernels [iterations]
+ */
+
+namespace {
+
+// Keeps results alive so the measured loops are not optimized out.
+volatile float s_sink;
+
+template <typename Fn> double MeasureNs(int iterations, Fn fn) {
+  fn();
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+    fn();
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() /
+         iterations;
+}
+
+// Log of one frame of mel energies and of a 49 frame KWS word.
+void BenchmarkLog(int iterations) {
+  static const int kLens[] = {40, 49 * 40};
+  for (int len : kLens) {
+    std::vector<float> in(len), out(len);
+    for (int i = 0; i < len; i++)
+      in[i] = 1e-3f + i * 0.37f;
+    const double fast = MeasureNs(iterations, [&] {
+      feature_kernels::Log(in.data(), out.data(), len);
+      s_sink = out[len - 1];
+    });
+    const double libm = MeasureNs(iterations, [&] {
+      for (int i = 0; i < len; i++)
+        out[i] = logf(in[i]);
+      s_sink = out[len - 1];
+    });
+    printf("log %4d values: Log %8.0f ns, logf %8.0f ns\n", len, fast, libm);
+  }
+}
+
+// FoldedDct against the dense matrix product it replaced, across bin and
+// coefficient counts.
+void BenchmarkDct(int iterations) {
+  static const int kSizes[][2] = {{40, 10}, {40, 13}, {40, 40}, {64, 20},
+                                  {80, 13}, {80, 40}, {49, 10}};
+  printf("DCT-II       folded            dense\n");
+  for (const auto &size : kSizes) {
+    const int numIn = size[0], numOut = size[1];
+    const double normalizer = sqrt(2.0 / numIn);
+    const int tableSize = feature_kernels::FoldedDctTableSize(numOut, numIn);
+    std::vector<float> table(tableSize), matrix(numOut * numIn);
+    feature_kernels::CreateFoldedDct(
+      numOut, numIn, normalizer, [](double x) { return cos(x); },
+      table.data());
+    for (int k = 0; k < numOut; k++)
+      for (int n = 0; n < numIn; n++)
+        matrix[k * numIn + n] =
+          normalizer * cos(M_PI / numIn * (n + 0.5) * k);
+
+    std::vector<float> in(numIn), scratch(numIn), out(numOut);
+    for (int n = 0; n < numIn; n++)
+      in[n] = -5.0f + n * 0.25f;
+    const double folded = MeasureNs(iterations, [&] {
+      // FoldedDct overwrites its input.
+      memcpy(scratch.data(), in.data(), numIn * sizeof(float));
+      feature_kernels::FoldedDct(table.data(), scratch.data(), out.data(),
+                                 numOut, numIn);
+      s_sink = out[numOut - 1];
+    });
+    const double dense = MeasureNs(iterations, [&] {
+      for (int k = 0; k < numOut; k++) {
+        float sum = 0.0f;
+        for (int n = 0; n < numIn; n++)
+          sum += matrix[k * numIn + n] * in[n];
+        out[k] = sum;
+      }
+      s_sink = out[numOut - 1];
+    });
+    printf("%2d of %2d: %6.0f ns %4d mul  %6.0f ns %4d mul\n", numOut, numIn,
+           folded, tableSize, dense, numOut * numIn);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const int iterations = argc > 1 ? atoi(argv[1]) : 10000;
+  if (iterations <= 0) {
+    printf("usage: %s [iterations]\n", argv[0]);
+    return 1;
+  }
+  BenchmarkLog(iterations);
+  BenchmarkDct(iterations);
+  return 0;
+}
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Generate golden_features.h for the audio preprocessor host tests.
+
+The reference audio is a deterministic mix of tones, a chirp and noise. Its
+features are computed here in double precision with a plain radix-2 FFT,
+independently of the C++ code, following the AudioPreprocessor definitions:
+periodic Hann window over frame_len samples normalized by max_abs, zero
+padding to a power of 2, magnitude spectrum, triangular mel filters on
+1127 ln(1 + f / 700) sampled at bins [0, N/2), natural log and an unscaled
+DCT-II times sqrt(2 / bins).
+
+    gen_golden_features.py > golden_features.h
+"""
+
+import cmath
+import math
+import sys
+
+SAMPLE_RATE = 16000
+FRAME_LEN = 640
+FRAME_SHIFT = 320
+FRAMES = 8
+AUDIO_LEN = (FRAMES - 1) * FRAME_SHIFT + FRAME_LEN
+
+# name, bins, mfcc (0 for log-mel), mel low, mel high, max_abs (0: peak)
+CONFIGS = [
+    ("Kws", 40, 10, 20, 4000, 0),
+    ("Sed", 40, 0, 0, 8000, 1 << 15),
+]
+
+
+def reference_audio():
+    seed = 12345
+    audio = []
+    for i in range(AUDIO_LEN):
+        t = i / SAMPLE_RATE
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        noise = (seed >> 16) / 32768.0 - 0.5
+        # Chirp from 200 Hz to 6 kHz over the clip.
+        rate = (6000 - 200) / (AUDIO_LEN / SAMPLE_RATE)
+        chirp = math.sin(2 * math.pi * (200 * t + rate * t * t / 2))
+        x = (6000 * math.sin(2 * math.pi * 440 * t) +
+             3000 * math.sin(2 * math.pi * 1800 * t + 0.3) + 4000 * chirp +
+             1000 * noise)
+        audio.append(max(-32768, min(32767, int(round(x)))))
+    return audio
+
+
+def fft(x):
+    n = len(x)
+    if n == 1:
+        return list(x)
+    even = fft(x[0::2])
+    odd = fft(x[1::2])
+    out = [0j] * n
+    for k in range(n // 2):
+        t = cmath.exp(-2j * math.pi * k / n) * odd[k]
+        out[k] = even[k] + t
+        out[k + n // 2] = even[k] - t
+    return out
+
+
+def mel(freq):
+    return 1127.0 * math.log(1.0 + freq / 700.0)
+
+
+def features(frame, max_abs, bins, mfcc, low, high):
+    padded = 1
+    while padded < FRAME_LEN:
+        padded *= 2
+    x = [0.0] * padded
+    for i in range(FRAME_LEN):
+        window = 0.5 - 0.5 * math.cos(2 * math.pi * i / FRAME_LEN)
+        x[i] = frame[i] / max_abs * window
+    spectrum = [abs(v) for v in fft(x)[:padded // 2]]
+
+    delta = (mel(high) - mel(low)) / (bins + 1)
+    log_mel = []
+    for b in range(bins):
+        left = mel(low) + b * delta
+        center = mel(low) + (b + 1) * delta
+        right = mel(low) + (b + 2) * delta
+        energy = 0.0
+        for i in range(padded // 2):
+            m = mel(SAMPLE_RATE / padded * i)
+            if left < m < right:
+                if m <= center:
+                    energy += spectrum[i] * (m - left) / (center - left)
+                else:
+                    energy += spectrum[i] * (right - m) / (right - center)
+        log_mel.append(math.log(energy))
+    if not mfcc:
+        return log_mel
+    norm = math.sqrt(2.0 / bins)
+    return [
+        norm * sum(log_mel[n] * math.cos(math.pi / bins * (n + 0.5) * k)
+                   for n in range(bins)) for k in range(mfcc)
+    ]
+
+
+def array(name, ctype, values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(fmt(v) for v in values[i:i + per_line]) +
+                     ",")
+    return f"static const {ctype} {name}[] = {{\n" + "\n".join(
+        lines) + "\n};\n"
+
+
+def main():
+    audio = reference_audio()
+    peak = max(abs(v) for v in audio)
+    out = sys.stdout
+    out.write("// Generated by gen_golden_features.py, do not edit.\n\n")
+    out.write("#ifndef __GOLDEN_FEATURES_H__\n")
+    out.write("#define __GOLDEN_FEATURES_H__\n\n")
+    out.write("#include <cstdint>\n\n")
+    out.write(f"#define GOLDEN_SAMPLE_RATE {SAMPLE_RATE}\n")
+    out.write(f"#define GOLDEN_FRAME_LEN   {FRAME_LEN}\n")
+    out.write(f"#define GOLDEN_FRAME_SHIFT {FRAME_SHIFT}\n")
+    out.write(f"#define GOLDEN_FRAMES      {FRAMES}\n")
+    out.write(f"#define GOLDEN_AUDIO_PEAK  {peak}\n\n")
+    out.write(array("kGoldenAudio", "int16_t", audio, 10, str))
+    for name, bins, mfcc, low, high, max_abs in CONFIGS:
+        values = []
+        for f in range(FRAMES):
+            frame = audio[f * FRAME_SHIFT:f * FRAME_SHIFT + FRAME_LEN]
+            values += features(frame, max_abs or peak, bins, mfcc, low, high)
+        out.write(f"\n// {name}: {bins} bins, {mfcc} MFCC, {low}-{high} Hz, "
+                  f"max_abs {max_abs or 'peak'}.\n")
+        out.write(
+            array(f"kGolden{name}", "float", values, 4, lambda v: f"{v:.8e}f"))
+    out.write("\n#endif\n")
+
+
+if __name__ == "__main__":
+    main()
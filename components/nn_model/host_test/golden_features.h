@@ -0,0 +1,413 @@
+// Generated by gen_golden_features.py, do not edit.
+
+#ifndef __GOLDEN_FEATURES_H__
+#define __GOLDEN_FEATURES_H__
+
+#include <cstdint>
+
+#define GOLDEN_SAMPLE_RATE 16000
+#define GOLDEN_FRAME_LEN   640
+#define GOLDEN_FRAME_SHIFT 320
+#define GOLDEN_FRAMES      8
+#define GOLDEN_AUDIO_PEAK  13137
+
+static const int16_t kGoldenAudio[] = {
+  1042, 3687, 5809, 5508, 5144, 4203, 4177, 5058, 7115, 9676,
+  11843, 11438, 10218, 8176, 5860, 4453, 3967, 4410, 5550, 6027,
+  4712, 2873, -129, -2601, -4810, -4698, -3201, -1547, -1076, -1405,
+  -1998, -4632, -5526, -6067, -4421, -2029, 461, 2044, 2903, 2046,
+  80, -462, -690, 86, 2447, 3804, 5175, 4460, 2598, 219,
+  -2432, -2939, -2742, -2095, -575, -651, -1385, -3851, -6596, -7705,
+  -8735, -7489, -5213, -2383, -1519, -1645, -2785, -4208, -4162, -3176,
+  -592, 2357, 6051, 7568, 7364, 6504, 4693, 5026, 4824, 6698,
+  9136, 10503, 10578, 8262, 5969, 2321, 1030, -860, -503, 978,
+  772, -987, -3233, -6028, -9459, -10472, -11065, -9358, -7835, -6663,
+  -5603, -7062, -7484, -8784, -8477, -6328, -2814, 580, 3973, 5461,
+  5145, 4410, 4375, 4767, 6726, 8522, 10769, 12415, 12394, 9821,
+  6920, 3941, 2510, 2544, 2452, 2927, 2392, 339, -2431, -5835,
+  -8953, -10469, -10100, -8646, -6930, -5895, -6649, -7848, -9385, -9359,
+  -8180, -5764, -1699, 2009, 4249, 5299, 4960, 4268, 3839, 4653,
+  6841, 9631, 10563, 10941, 9923, 7618, 4695, 1834, 1226, 1313,
+  2057, 2438, 1385, -1453, -4725, -7022, -8643, -9125, -7473, -6322,
+  -3829, -3236, -3516, -5209, -5708, -6143, -4776, -1123, 1750, 4257,
+  4502, 3886, 2379, 1187, 1027, 1242, 3356, 5672, 6051, 5453,
+  3760, 1956, -11, -1054, -863, 569, 2861, 3281, 3654, 2182,
+  -578, -1972, -2899, -1750, -192, 1142, 1384, 1283, -986, -4275,
+  -6516, -6823, -6610, -4802, -3642, -1992, -3146, -4443, -5191, -6097,
+  -4488, -2242, 1100, 4349, 7244, 7687, 7168, 6560, 5396, 6726,
+  8186, 9577, 10027, 10091, 7132, 3538, 101, -3104, -5117, -5700,
+  -5566, -5094, -5416, -7695, -9527, -10923, -11345, -10111, -7446, -3203,
+  -144, 2342, 2306, 2410, 1069, 1811, 2126, 5127, 6697, 7507,
+  7540, 5374, 2893, 212, -1102, -812, 1257, 2519, 4087, 4280,
+  3494, 849, -406, -1046, -87, 892, 2721, 2783, 1370, -1423,
+  -5480, -8227, -9696, -9738, -8143, -7000, -5043, -5466, -5762, -5728,
+  -5792, -3560, -111, 3747, 7409, 10719, 11255, 9920, 8288, 6105,
+  4763, 5496, 5360, 6111, 4474, 2503, -483, -3055, -5799, -5298,
+  -3772, -1845, 69, 1466, 866, -698, -3525, -5028, -5581, -5027,
+  -3344, -2598, -2932, -4117, -6539, -8371, -8494, -6481, -3316, 782,
+  5022, 7096, 8100, 7638, 7261, 6768, 7049, 8015, 9217, 8426,
+  7431, 4177, -279, -4007, -5224, -5971, -3902, -2553, -918, 11,
+  -584, -2240, -3869, -5213, -4444, -2929, -2104, -2017, -3327, -5500,
+  -7880, -9045, -8132, -5831, -2374, 2458, 5606, 7550, 7897, 7415,
+  6273, 6200, 7276, 7848, 8793, 7409, 4869, 2043, -1891, -3772,
+  -4685, -3619, -1290, 1179, 2974, 2234, 281, -2506, -4761, -5650,
+  -6198, -6011, -5466, -5863, -6702, -7915, -9218, -8544, -5847, -1700,
+  3017, 6585, 9257, 9195, 7537, 5377, 3421, 3114, 2671, 4248,
+  4339, 4390, 3451, 2246, 788, 709, 2140, 4095, 5156, 6140,
+  3961, 992, -3872, -7626, -10343, -11105, -10123, -8008, -6310, -4050,
+  -3933, -3415, -3718, -2899, -332, 1353, 3482, 4482, 2780, 786,
+  -730, -2589, -1150, 1331, 5077, 8272, 10677, 11725, 9882, 7910,
+  5014, 1725, 792, -356, -384, -976, -2780, -4602, -6893, -6648,
+  -5882, -3909, -1820, 225, 118, -1603, -5039, -8327, -10527, -10336,
+  -8069, -4499, -726, 3183, 5134, 5158, 5219, 5411, 4746, 5648,
+  6797, 7146, 5551, 3648, 2225, -252, 76, 1874, 4254, 6875,
+  7642, 6744, 2837, -1673, -5967, -9062, -10738, -10069, -7717, -4882,
+  -3879, -3016, -3435, -3184, -4031, -3207, -2492, -920, -485, -484,
+  -1912, -2045, -1973, 2, 3977, 7553, 10909, 12267, 12094, 9004,
+  4665, 84, -1812, -1694, -167, 2404, 3534, 4043, 3820, 1232,
+  -1832, -3362, -5307, -5993, -6227, -7112, -7724, -7986, -8180, -7355,
+  -4886, -2055, 956, 3507, 3280, 2200, -574, -3587, -4781, -2759,
+  738, 5197, 9207, 12284, 12037, 9503, 6329, 2799, 603, -72,
+  704, 1138, 2008, 2186, 1713, -291, -1216, -2721, -2581, -3433,
+  -4164, -6083, -7970, -9291, -10486, -8679, -5522, -1814, 1156, 3518,
+  3143, 1029, -2863, -4898, -4919, -2089, 1814, 6763, 10546, 12389,
+  11117, 8523, 4694, 1194, 62, 692, 1863, 2938, 4534, 3475,
+  2751, 860, -1034, -3307, -4008, -4590, -5678, -7118, -8200, -7789,
+  -7044, -5154, -3605, -480, 57, 580, -1994, -4023, -5226, -4846,
+  -2537, 2124, 7309, 10969, 12009, 9794, 6896, 2327, -220, -1532,
+  1116, 4017, 7186, 9159, 8956, 5447, 1102, -3549, -6522, -7631,
+  -6609, -4482, -3363, -1875, -2463, -4374, -5102, -6497, -6929, -6853,
+  -5819, -4196, -2984, -1746, -619, 942, 3252, 4597, 5637, 4987,
+  4202, 3082, 2245, 2143, 4033, 6186, 9086, 10325, 8604, 5395,
+  1408, -3085, -4884, -5415, -2890, -8, 2020, 2797, 443, -4133,
+  -9206, -12456, -12680, -10001, -6227, -1439, 2355, 2354, 513, -2751,
+  -5323, -6335, -4949, -345, 4845, 8854, 10383, 9633, 6453, 3722,
+  892, 808, 2670, 5189, 7592, 8330, 7741, 4483, 837, -3086,
+  -4626, -5005, -4437, -2605, -2180, -1820, -3758, -4841, -6459, -7388,
+  -7725, -7109, -5185, -4048, -2502, -1059, -520, 192, 458, 1588,
+  2239, 2504, 3156, 4456, 5218, 6664, 7597, 7288, 7454, 5739,
+  3346, 2323, 891, 1416, 1678, 2288, 2079, 1496, -1478, -3967,
+  -6905, -8399, -8056, -6525, -3993, -2690, -2420, -2793, -4797, -6688,
+  -7915, -6471, -2770, 1062, 4470, 5666, 5181, 3331, 932, 70,
+  936, 4235, 7355, 9927, 10840, 8993, 5416, 877, -1295, -2038,
+  265, 2899, 3770, 3466, 1643, -3202, -7006, -9502, -9596, -7959,
+  -3707, -1581, -773, -1971, -5767, -8281, -8677, -7013, -3380, 808,
+  4789, 6433, 5257, 2367, 197, -393, 799, 5011, 8552, 10748,
+  10211, 7777, 3758, 881, -1316, 352, 2060, 4164, 4611, 3066,
+  -630, -5059, -7540, -8880, -6889, -5061, -2403, -1871, -2949, -5321,
+  -8206, -8286, -7088, -3998, -1202, 1776, 3073, 2125, 544, -447,
+  398, 2308, 4629, 7109, 8593, 7581, 6655, 4099, 2968, 3095,
+  4181, 4362, 3977, 2998, 1252, -1591, -2598, -3608, -3122, -3315,
+  -4013, -4811, -6297, -6883, -6920, -5913, -4560, -3545, -3592, -3899,
+  -4775, -3725, -2805, 877, 3166, 4862, 5201, 4165, 2292, 1902,
+  2595, 5630, 8166, 10455, 10051, 6737, 2134, -1139, -2484, -456,
+  2571, 5194, 4228, 1059, -4618, -8852, -11218, -9222, -4622, -500,
+  1140, -1079, -5101, -9634, -11176, -9682, -4255, 1845, 5293, 5353,
+  2829, -1891, -3273, -1699, 2485, 7454, 11368, 11317, 8266, 4131,
+  624, 629, 2081, 5093, 7259, 6553, 3555, -1114, -3507, -4700,
+  -3790, -3249, -2832, -3433, -5122, -6357, -6972, -6321, -4561, -3746,
+  -4972, -5881, -5685, -4101, -1554, 1999, 4100, 3535, 1530, -368,
+  -504, 2297, 5802, 10370, 12405, 9440, 4417, -9, -1864, 261,
+  4249, 8229, 8759, 4719, -839, -6778, -8651, -7044, -3107, 590,
+  1057, -1779, -6791, -10665, -10851, -8024, -4379, -1775, -348, -1731,
+  -2321, -2356, -879, 1501, 3195, 3342, 3374, 2927, 3946, 6993,
+  8861, 8726, 6553, 3749, 679, 433, 2904, 6562, 8159, 6302,
+  490, -5054, -9303, -7793, -3684, 214, 2028, -1222, -5599, -10460,
+  -12654, -9621, -5050, -480, 903, -767, -3044, -3814, -2472, -243,
+  2991, 4186, 3435, 2963, 4647, 6610, 7693, 8078, 5849, 3006,
+  1285, 1266, 4434, 8425, 8078, 4475, -1688, -6691, -8751, -5310,
+  -783, 1896, 1245, -3264, -9358, -11919, -10967, -6886, -2065, -976,
+  -1674, -4033, -4936, -2659, -240, 1594, 1992, 737, 1165, 3070,
+  6723, 9802, 9192, 5609, 1670, -273, 1377, 5877, 9740, 9854,
+  5683, -490, -5973, -6046, -2778, 1204, 1978, 107, -5061, -8190,
+  -8985, -6984, -5379, -4892, -5774, -6340, -4927, -2573, 581, 1133,
+  -1648, -3757, -4441, -1148, 5544, 9606, 10449, 7653, 2333, -1272,
+  530, 5668, 10002, 10842, 7428, 3250, -578, -159, 667, 1078,
+  101, -3398, -4331, -3218, -1863, -904, -3600, -8090, -11843, -10919,
+  -5855, -611, 1754, 512, -4686, -8309, -6907, -2001, 3113, 6587,
+  5969, 3367, 2018, 3781, 6119, 6863, 5378, 3644, 3339, 4992,
+  8949, 9673, 5885, 241, -4509, -5110, -1244, 2712, 4370, 411,
+  -4866, -9511, -9620, -6731, -4462, -3911, -5418, -6866, -5027, -2892,
+  -751, -1360, -5072, -6297, -3338, 2373, 8283, 9215, 5797, 944,
+  -782, 1401, 6301, 10458, 9663, 6271, 3222, 3191, 3552, 3831,
+  2234, -1316, -3921, -1945, 1133, 3296, -145, -6398, -11383, -12229,
+  -7588, -1987, 562, -2203, -6214, -7568, -6019, -2538, -1292, -848,
+  -1688, -566, 3922, 7285, 7336, 4421, 126, -673, 3700, 9335,
+  12230, 10050, 4561, 887, 111, 2682, 3571, 1951, -601, -2455,
+  -632, 863, -353, -4602, -10322, -11522, -8102, -2343, 1193, -1406,
+  -6305, -8995, -8176, -4619, -381, 50, -757, -504, 2594, 6000,
+  6929, 3807, -360, -235, 4272, 10424, 12627, 9723, 3366, 352,
+  904, 3193, 5031, 2984, -106, -1563, 897, 1256, -625, -6802,
+  -11118, -10530, -4678, 233, -175, -4278, -8681, -9147, -6645, -2079,
+  -1476, -2513, -1977, 842, 5624, 6941, 3255, -1368, -1845, 2182,
+  9458, 12656, 10060, 4997, 2285, 3022, 4606, 4679, 2028, -386,
+  755, 3587, 4883, 273, -6546, -11110, -9266, -4202, -767, -1562,
+  -5409, -8398, -6923, -4424, -4368, -6388, -6671, -4091, 2688, 6806,
+  5082, -146, -3414, -1105, 4079, 8572, 8485, 6043, 5002, 6312,
+  7822, 6555, 1125, -2009, 692, 5747, 8185, 5284, -1963, -7229,
+  -6886, -3717, -2334, -4462, -6952, -6484, -2911, -881, -4582, -10263,
+  -11779, -7457, -136, 3730, 2126, -1183, -2377, 995, 3853, 3455,
+  1424, 1940, 6237, 11193, 11671, 6293, 846, -293, 3455, 6602,
+  6844, 3019, 760, 1635, 2266, -176, -5723, -9428, -8291, -1858,
+  1017, -667, -7307, -10374, -7948, -4595, -4283, -6187, -6490, -2270,
+  3189, 4516, 547, -4094, -4366, 1961, 7513, 8748, 6030, 4908,
+  6125, 8833, 6883, 1940, -580, 1983, 7778, 9472, 5172, -1001,
+  -4349, -2879, -786, -2722, -5908, -6611, -2516, 298, -1576, -8760,
+  -12596, -10421, -3984, -806, -1871, -3871, -2129, 1416, 2148, -445,
+  -4727, -2304, 5078, 10245, 9940, 5794, 2209, 4156, 6557, 5972,
+  2222, 1489, 5344, 9259, 7630, 381, -5194, -5172, -2098, 176,
+  -2986, -5299, -4457, -1286, -2130, -7176, -12619, -11550, -4585, 680,
+  -486, -3384, -4503, -1474, 1664, -173, -3489, -2251, 5378, 11201,
+  9725, 4791, 1633, 3514, 7079, 6700, 2601, 2853, 6577, 9778,
+  7392, -681, -6116, -3778, 340, 138, -2643, -4804, -2929, -567,
+  -3494, -9776, -13137, -8827, -2168, 579, -2356, -5079, -3114, -348,
+  -618, -3769, -4434, 1387, 8417, 9833, 5745, 2440, 3551, 6260,
+  6039, 2536, 2195, 5880, 10953, 9060, 2396, -3573, -2457, 600,
+  396, -2570, -4927, -910, 1257, -2227, -9608, -12845, -8836, -3283,
+  -2732, -5016, -5137, -1400, 1042, -2759, -6821, -6206, 370, 6997,
+  6370, 3528, 2892, 6017, 7286, 3666, -384, 2981, 8996, 12251,
+  7230, 2308, 1352, 2873, 2041, -3230, -4654, -1456, 3712, 2227,
+  -4518, -9775, -7627, -5176, -5843, -8487, -8004, -1578, 1952, -2078,
+  -7928, -8666, -3228, 1113, 727, -770, 3625, 8382, 8473, 2858,
+  -1554, 1711, 7862, 9212, 5520, 4358, 7642, 9020, 3751, -3257,
+  -4292, 1403, 4580, 1679, -2822, -2766, -965, -3264, -9061, -12344,
+  -7810, -1844, -1350, -4877, -6444, -2795, -1903, -5613, -8197, -4534,
+  3897, 6912, 3969, 845, 3361, 6262, 4246, 460, 903, 7704,
+  12761, 9148, 3369, 2469, 4939, 3284, -1761, -3104, 1244, 6147,
+  3444, -3881, -7514, -4721, -4145, -7389, -10055, -5811, 236, -16,
+  -6290, -9198, -6281, -1807, -3291, -5071, -1576, 6130, 8317, 2876,
+  -1570, 1904, 5636, 4988, 2210, 5325, 11214, 11795, 5947, -145,
+  1048, 4189, 2915, -1118, -1059, 3976, 4782, -2220, -9126, -7879,
+  -4545, -4252, -7822, -6723, -1777, 773, -5445, -10538, -8852, -2658,
+  -2024, -4226, -2226, 4953, 7717, 2336, -2815, 235, 6013, 6121,
+  4063, 5133, 10777, 11462, 5177, -1230, 830, 5228, 3843, 121,
+  564, 4733, 4668, -3734, -9434, -6937, -2879, -4554, -8076, -5440,
+  184, -1378, -7825, -11248, -6242, -2162, -3489, -4927, 792, 6414,
+  4327, -1575, -3005, 2373, 6424, 3559, 3715, 8613, 12358, 8048,
+  1338, 426, 5307, 4965, 359, 809, 5957, 7220, 20, -6477,
+  -6136, -3125, -5073, -8427, -5304, -236, -697, -7374, -11006, -6654,
+  -3698, -6326, -6975, -694, 5597, 3580, -2572, -1730, 3009, 3224,
+  447, 1756, 9642, 12082, 6763, 1966, 4795, 6676, 2415, -1122,
+  2816, 9013, 6292, -362, -2685, -491, -2101, -8229, -8289, -2239,
+  1597, -3140, -7962, -6696, -3911, -8201, -10869, -7058, 978, 2423,
+  -2350, -1488, 2217, 2529, -2591, -2749, 4775, 10130, 6510, 4423,
+  8218, 9446, 3585, -1753, 2259, 8323, 6373, 2397, 2733, 5843,
+  960, -6265, -7395, -2408, -832, -4965, -5079, -942, -1563, -8957,
+  -12431, -7088, -2917, -5128, -5527, -239, 4729, 283, -5201, -2886,
+  3214, 1945, 372, 4744, 11784, 9901, 2580, 2265, 5893, 5547,
+  1127, 2704, 8777, 9775, 1569, -1399, 1061, -186, -6730, -7693,
+  -1128, 2246, -3282, -7051, -4713, -3850, -9656, -11991, -5493, 78,
+  -1648, -4597, -174, 2054, -2661, -6883, -1644, 5981, 5212, 2831,
+  7584, 10831, 5794, 104, 1775, 7397, 5987, 2600, 6417, 9985,
+  5070, -2244, -2993, 187, -1720, -6197, -3321, 2314, -461, -7675,
+  -8522, -4340, -7597, -11738, -6862, 676, 439, -4924, -4065, 560,
+  -2056, -6207, -2671, 6009, 6350, 3160, 5840, 9314, 5453, -784,
+  1973, 8398, 7244, 4068, 6694, 9793, 4424, -3424, -2278, 876,
+  -1918, -5079, -929, 3355, -2162, -9005, -7462, -5024, -8439, -11260,
+  -4958, 1336, -2081, -5815, -3154, -125, -5012, -6908, 953, 6577,
+  4148, 2808, 7384, 8177, 1642, -1096, 5842, 8771, 4842, 4641,
+  10471, 8969, 410, -2294, 1682, 320, -4693, -2179, 3451, 735,
+  -6430, -6925, -4161, -7532, -12511, -6690, -332, -2340, -6612, -2942,
+  -625, -6236, -8837, -1056, 3866, 1791, 1590, 7994, 8549, 1483,
+  -139, 6082, 6844, 2698, 6265, 12381, 9203, 1884, 898, 3920,
+  -604, -4788, 254, 5168, -261, -4345, -1902, -2233, -10021, -12240,
+  -5423, -2199, -6312, -5450, 241, -2102, -8860, -7307, -803, -1698,
+  -3477, 3720, 9456, 4405, 194, 3986, 6282, 1203, 1812, 9444,
+  11329, 5842, 4685, 7697, 3631, -3362, -300, 4182, 1561, -2274,
+  1751, 2860, -5789, -9860, -4970, -5416, -9362, -6569, 68, -1713,
+  -7737, -6015, -2477, -7254, -8776, -519, 4642, 843, 1713, 6732,
+  5093, -1747, 1093, 7392, 6508, 4081, 9335, 12502, 4506, 182,
+  3983, 2893, -2673, -554, 6549, 3307, -2712, -1861, -502, -8295,
+  -11776, -4631, -1910, -6891, -4886, 357, -4165, -10530, -7058, -2471,
+  -5353, -4903, 3712, 6693, 201, 788, 5310, 2055, -1673, 4450,
+  10555, 7313, 5142, 10299, 8687, 136, -533, 4869, 2803, -995,
+  4431, 6965, -1367, -5797, -2367, -4853, -10618, -6638, -590, -3771,
+  -6914, -2483, -3028, -10133, -9672, -2841, -2152, -4532, 1431, 6309,
+  650, -2442, 3018, 2850, -1498, 3848, 11391, 8334, 4812, 9019,
+  7831, -353, 91, 5534, 3637, -72, 4630, 6284, -1484, -6062,
+  -2355, -4915, -10249, -5064, 170, -4038, -6937, -2083, -5101, -12093,
+  -8850, -1452, -4028, -4173, 3594, 5099, -1892, -1454, 4044, 436,
+  -1065, 7589, 10758, 5473, 6213, 9638, 3977, -1501, 3202, 6734,
+  1640, 3196, 8121, 3389, -4278, -2247, -1897, -8745, -7107, 35,
+  -2186, -7156, -3441, -2374, -10506, -10795, -3859, -4851, -6057, 1692,
+  4738, -2515, -2786, 2753, -716, -3271, 4857, 9155, 5251, 6662,
+  11457, 5568, -92, 4577, 5943, 517, 3716, 9826, 4193, -1717,
+  1308, -1057, -8253, -6051, 566, -4232, -5419, -576, -3061, -10932,
+  -8989, -4910, -8882, -6899, 1970, 820, -3898, 488, 1683, -4989,
+  -2959, 5133, 4411, 3306, 10116, 10233, 3087, 3874, 7244, 2215,
+  433, 7994, 8537, 2843, 4624, 5383, -3556, -5686, -557, -3715,
+  -6925, 232, 576, -7156, -6551, -3534, -10033, -12159, -3486, -2478,
+  -5309, -399, 3018, -4136, -4779, 1015, -1220, -1605, 6535, 9085,
+  3729, 6337, 9705, 1555, 762, 7593, 5673, 2806, 8519, 9073,
+  857, -98, 2715, -4758, -6386, 1177, -275, -4805, -758, -1361,
+  -9824, -9392, -5228, -9655, -8580, 251, -856, -4677, -739, 429,
+  -6591, -3985, 3714, 1044, 1715, 10444, 8202, 1504, 5660, 5672,
+  -830, 4106, 9670, 5167, 4902, 9758, 4170, -2911, 885, -677,
+  -6028, -1655, 3734, -2800, -4733, -1211, -7588, -12130, -5669, -5833,
+  -9233, -1257, 1935, -5468, -4092, -220, -5879, -5744, 3014, 3342,
+  1829, 8435, 8675, 1215, 4093, 6126, 770, 3471, 11415, 6937,
+  4169, 9625, 3565, -3688, 887, 965, -4743, 404, 4196, -2921,
+  -5013, -1871, -8490, -12046, -4906, -5664, -7664, -366, 132, -7022,
+  -4404, -1667, -7609, -4331, 4758, 1732, 2790, 9521, 4702, -60,
+  5636, 5006, -207, 7286, 10784, 5394, 7381, 8872, -99, -1547,
+  3352, -1928, -3278, 4889, 1564, -4346, -939, -4465, -11922, -7611,
+  -4183, -8451, -3408, 1342, -5387, -6070, -1941, -7183, -7730, 1065,
+  1139, -455, 7894, 6548, 65, 4859, 4730, -625, 5866, 10084,
+  5574, 7629, 10936, 2136, -319, 4222, -1765, -2366, 4930, 1939,
+  -2627, 2127, -2602, -10766, -5868, -5483, -10604, -3788, 4, -6701,
+  -4260, -2104, -9075, -7298, -466, -4162, -583, 7899, 3084, 572,
+  6686, 1786, -2048, 6336, 6986, 4122, 10994, 9708, 2002, 4945,
+  4441, -3164, 1876, 4788, -1136, 2067, 5005, -4761, -5300, -2655,
+  -10146, -8974, -913, -5251, -5731, 105, -5557, -10001, -3632, -6486,
+  -7786, 1697, 2235, -420, 6453, 4053, -2653, 3516, 4316, 217,
+  7996, 11336, 4919, 8453, 8468, -669, 2250, 4825, -1312, 2699,
+  7143, -496, 5, 1570, -8151, -8025, -3182, -8544, -6046, 599,
+  -4948, -6380, -1777, -9297, -10307, -2408, -5065, -3352, 5630, 1677,
+  -579, 5377, 202, -2166, 5485, 4327, 4125, 12112, 9226, 3643,
+  7802, 3138, -1897, 4968, 3394, 27, 7466, 3959, -3651, 186,
+  -4146, -10477, -3866, -3770, -7019, -91, -2586, -8828, -4164, -6554,
+  -12074, -3559, -1704, -4507, 4129, 2906, -2591, 2466, 1334, -3274,
+  5292, 7307, 3735, 11416, 9318, 2111, 6130, 3628, -1422, 5514,
+  6189, 967, 7433, 3406, -4217, -800, -4390, -10223, -1770, -2466,
+  -6396, -308, -3223, -9990, -4585, -8500, -11366, -1714, -2353, -3667,
+  4796, 742, -3341, 2583, -1253, -2037, 7666, 6000, 4680, 12042,
+  6099, 2253, 6983, 1629, 505, 8661, 3864, 3721, 8426, 391,
+  -2104, 532, -7888, -6046, -394, -5414, -2711, 893, -8000, -7216,
+  -5477, -12569, -6540, -1813, -5211, 796, 3141, -4158, 422, -224,
+  -4531, 3176, 6076, 3255, 11138, 8636, 2575, 7642, 3612, -875,
+  7170, 4771, 3933, 10278, 3289, -252, 2459, -5340, -6002, 353,
+  -5354, -2169, 2027, -7165, -5546, -4807, -12992, -7517, -3612, -8260,
+  370, 1725, -4469, 1337, -2166, -5968, 2298, 1202, 1620, 10552,
+  6993, 4988, 9260, 2070, 1136, 7429, 1854, 5562, 10480, 2332,
+  4761, 3769, -5960, -1996, -1316, -6405, 980, -351, -5824, -480,
+  -6667, -11135, -4604, -9684, -7673, 864, -3792, -2188, 1251, -6197,
+  -3317, 489, -4781, 4642, 7046, 2977, 9583, 6853, 1133, 6839,
+  1669, 1693, 9570, 5430, 5993, 10414, 482, 1265, 1542, -6124,
+  -935, 616, -4284, 1758, -1691, -8272, -3927, -9837, -10838, -3387,
+  -7589, -3539, 2086, -6106, -1907, -1927, -7891, -746, 508, -1033,
+  8385, 5774, 3692, 8841, 1698, 1367, 7792, 1450, 7128, 10594,
+  3543, 7935, 4121, -3989, 2412, -2311, -4131, 3541, -2381, -1685,
+  501, -9125, -7191, -6047, -12522, -3493, -3073, -5781, 1082, -4368,
+  -6683, -1110, -7452, -2597, 3971, -900, 6736, 7311, 1451, 6438,
+  2210, 70, 8096, 4375, 6732, 11977, 3798, 6382, 4839, -4008,
+  2074, -686, -3204, 5113, -1595, -2324, 319, -9418, -7294, -6103,
+  -11421, -2125, -3662, -5798, 1326, -6552, -6845, -2489, -8204, -1121,
+  2689, -295, 7829, 4832, 1043, 6575, -170, 1940, 8003, 3280,
+  9800, 9987, 2941, 8314, 1277, -2403, 3984, -2193, 1399, 4814,
+  -3047, 1271, -3364, -9822, -4598, -9305, -8224, -664, -6680, -1735,
+  -1768, -9085, -2901, -6408, -7226, 2450, -1286, 3223, 7514, -329,
+  5073, 2723, -1815, 7022, 3650, 6917, 12489, 4703, 7900, 4958,
+  -2426, 4531, -372, 78, 6411, -1097, 2346, 52, -8194, -3354,
+  -7873, -9596, -1480, -6512, -2725, -598, -9202, -3665, -6977, -9336,
+  369, -4440, 1590, 5666, -432, 5219, 1513, -2157, 5993, 1381,
+};
+
+// Kws: 40 bins, 10 MFCC, 20-4000 Hz, max_abs peak.
+static const float kGoldenKws[] = {
+  1.80782157e+01f, 7.43377826e-01f, -6.96730316e+00f, -5.59610866e+00f,
+  -1.76091093e+00f, -4.03779998e-01f, 5.88863601e-03f, -4.44734790e-01f,
+  1.19116551e+00f, 2.47586470e+00f, 1.47894321e+01f, -3.78855800e+00f,
+  -5.94272249e+00f, 2.29303097e+00f, -7.25010864e-02f, -6.24591807e+00f,
+  -3.29377682e-01f, 2.16756806e+00f, 2.27575964e+00f, 3.28832098e+00f,
+  1.38508895e+01f, -5.61390233e+00f, -1.11817079e+00f, 2.44765752e+00f,
+  -6.66440794e+00f, -6.40149344e-01f, 1.01130319e+00f, -8.30909615e-01f,
+  3.98639483e+00f, 2.25328846e+00f, 1.27981222e+01f, -6.36509395e+00f,
+  2.80235877e+00f, -8.00677513e-01f, -5.01851067e+00f, -4.65195279e-01f,
+  -2.87108516e+00f, 2.79476696e+00f, 4.21930505e-01f, 4.29554916e+00f,
+  1.21034432e+01f, -6.35332310e+00f, 3.12347369e+00f, -3.70053762e+00f,
+  -1.27602636e+00f, -4.82470134e+00f, 1.13215652e+00f, 1.84480637e-01f,
+  1.65080037e+00f, 3.85979798e+00f, 8.72483333e+00f, -3.70090856e+00f,
+  7.71843915e-01f, -2.22521699e+00f, -2.11012612e+00f, -4.16996381e+00f,
+  1.99764126e+00f, -5.51484045e-01f, 2.87165633e+00f, 3.25725846e+00f,
+  8.28204518e+00f, -2.74346142e+00f, -7.97375186e-01f, -6.58655429e-01f,
+  -3.20586846e+00f, -3.83891337e+00f, 4.01033504e-01f, 5.00845307e-01f,
+  2.07665112e+00f, 3.97600849e+00f, 8.66451896e+00f, -2.22158557e+00f,
+  -8.11443715e-01f, -5.67293370e-01f, -3.38844887e+00f, -3.04688666e+00f,
+  1.15213735e+00f, 4.54800534e-01f, 1.98743925e+00f, 3.57907496e+00f,
+};
+
+// Sed: 40 bins, 0 MFCC, 0-8000 Hz, max_abs 32768.
+static const float kGoldenSed[] = {
+  -1.03487151e+00f, -1.56472505e+00f, -1.15459146e+00f, -5.43012751e-01f,
+  -1.47361973e-01f, 6.74855119e-01f, 2.89273527e+00f, 4.29095875e+00f,
+  2.88095648e+00f, 2.93347398e+00f, 3.20043677e+00f, 3.41995701e+00f,
+  3.49611706e+00f, 3.48320855e+00f, 3.32254826e+00f, 2.95892585e+00f,
+  2.24604238e+00f, 1.01063277e+00f, 2.00228788e-02f, 2.68294274e+00f,
+  3.54783102e+00f, 8.88607367e-02f, 1.94726864e-01f, 3.61766058e-01f,
+  5.37805995e-01f, 7.30089517e-01f, 7.92948557e-01f, 5.35294756e-01f,
+  5.04578064e-01f, 6.95964096e-01f, 8.70387636e-01f, 6.61568278e-01f,
+  9.77600259e-01f, 9.44486980e-01f, 1.14987792e+00f, 1.14566904e+00f,
+  1.09583748e+00f, 1.36909368e+00f, 1.23335292e+00f, 1.41703981e+00f,
+  -1.54674760e+00f, -9.52547595e-01f, -8.16906338e-01f, -9.06696261e-01f,
+  -1.49079493e+00f, -7.05930785e-01f, 2.69296225e+00f, 4.29179460e+00f,
+  2.17056718e+00f, -5.93755030e-01f, -9.20954390e-01f, -8.42437620e-01f,
+  -5.78735109e-02f, 1.17130758e+00f, 2.27117263e+00f, 3.03507414e+00f,
+  3.49440385e+00f, 3.78105309e+00f, 3.83289356e+00f, 3.82036748e+00f,
+  3.81439890e+00f, 1.90997236e+00f, 4.06066489e-01f, 2.03837137e-01f,
+  2.14078852e-01f, 4.89673169e-01f, 7.22678552e-01f, 8.58702843e-01f,
+  6.90831163e-01f, 1.00615971e+00f, 1.11696489e+00f, 7.25744219e-01f,
+  9.19913763e-01f, 9.21459018e-01f, 8.91573214e-01f, 1.07669268e+00f,
+  1.17732098e+00f, 1.12243895e+00f, 1.31646829e+00f, 1.64902159e+00f,
+  -1.46466235e+00f, -7.23741483e-01f, -4.88892712e-01f, -8.70225027e-01f,
+  -1.59703730e+00f, -1.11740957e+00f, 2.68336475e+00f, 4.28872891e+00f,
+  2.17162585e+00f, -4.46954704e-01f, -4.64753358e-01f, -4.27274400e-01f,
+  -2.38245310e-01f, 3.27123632e-01f, -4.39345402e-02f, 2.80775826e-01f,
+  2.45140548e-02f, 2.63394177e-01f, 1.01560859e+00f, 3.14328088e+00f,
+  3.98383899e+00f, 3.92290575e+00f, 4.06638879e+00f, 3.82708864e+00f,
+  2.97477166e+00f, 1.19077688e+00f, 5.69971896e-01f, 8.44181779e-01f,
+  6.48555725e-01f, 9.63079959e-01f, 1.11785485e+00f, 9.72478005e-01f,
+  8.55797314e-01f, 1.00596686e+00f, 1.15500560e+00f, 1.07369027e+00f,
+  1.24141385e+00f, 1.25098594e+00f, 1.11571383e+00f, 1.36172028e+00f,
+  -9.68506955e-01f, -1.00837262e+00f, -8.47457404e-01f, -8.85695808e-01f,
+  -7.19749256e-01f, -4.42774930e-01f, 2.69084220e+00f, 4.29836670e+00f,
+  2.17944638e+00f, -8.44993582e-01f, -1.41128048e+00f, -5.23154220e-01f,
+  -4.24074864e-01f, -3.97150700e-01f, -3.34609665e-01f, -1.93613993e-01f,
+  -3.06623588e-01f, -1.08208157e-02f, -3.04022363e-01f, 2.68629127e+00f,
+  3.54703957e+00f, -1.85603135e-01f, 1.16909364e+00f, 2.97454379e+00f,
+  3.90196864e+00f, 4.25536245e+00f, 4.06705412e+00f, 3.10541168e+00f,
+  1.07002685e+00f, 8.12243097e-01f, 7.46136765e-01f, 8.63215941e-01f,
+  8.54473759e-01f, 1.20587022e+00f, 1.22398912e+00f, 1.15599888e+00f,
+  1.17419571e+00f, 1.03763277e+00f, 1.31249189e+00f, 1.36188292e+00f,
+  -1.87877119e+00f, -9.84429344e-01f, -8.95028775e-01f, -7.14631204e-01f,
+  -1.15446534e+00f, -6.52682463e-01f, 2.68530748e+00f, 4.28861008e+00f,
+  2.14933105e+00f, -7.38428371e-01f, -7.43977745e-01f, -1.63450256e-01f,
+  -8.66149289e-01f, -5.24040781e-01f, 7.69405004e-02f, 2.42298126e-01f,
+  -7.24556598e-02f, -1.22666790e-01f, -1.75569874e-01f, 2.70785993e+00f,
+  3.55305960e+00f, -1.03121585e-01f, 4.63583314e-01f, 4.76208724e-01f,
+  5.33249195e-01f, 1.20016718e+00f, 3.02119302e+00f, 4.12088967e+00f,
+  4.42070791e+00f, 3.93269717e+00f, 2.25947783e+00f, 9.38797290e-01f,
+  9.18063126e-01f, 8.16810984e-01f, 1.13633867e+00f, 1.17232134e+00f,
+  1.17714978e+00f, 1.25789374e+00f, 1.41589278e+00f, 1.54372167e+00f,
+  -1.55851063e+00f, -9.74859686e-01f, -1.25552766e+00f, -1.10000907e+00f,
+  -1.43849019e+00f, -9.84769151e-01f, 2.69916939e+00f, 4.29827189e+00f,
+  2.17306436e+00f, -9.11529553e-01f, -6.68944532e-01f, -4.87645075e-01f,
+  -2.53645681e-01f, -2.69376189e-01f, -1.70448387e-01f, -3.36144296e-02f,
+  -5.51582916e-01f, -2.16240558e-01f, -5.15046059e-03f, 2.68892218e+00f,
+  3.55263614e+00f, -3.92033549e-02f, 1.51249644e-02f, 3.18413439e-01f,
+  1.36263020e-01f, 5.37928694e-01f, 6.74436046e-01f, 6.90559820e-01f,
+  1.89015296e+00f, 3.79458307e+00f, 4.51348647e+00f, 4.25895063e+00f,
+  2.68790801e+00f, 8.48855453e-01f, 1.08852101e+00f, 1.14057781e+00f,
+  1.30301444e+00f, 1.34380020e+00f, 1.12225858e+00f, 1.39615705e+00f,
+  -7.93475223e-01f, -1.31695984e+00f, -1.82255240e+00f, -1.31735075e+00f,
+  -7.82198067e-01f, -4.78930114e-01f, 2.70134682e+00f, 4.29592156e+00f,
+  2.15730033e+00f, -9.56412887e-01f, -9.30978800e-01f, -4.62448354e-01f,
+  -3.89226255e-01f, -4.73428993e-01f, 1.52357682e-01f, 1.31812033e-01f,
+  1.93464956e-01f, 1.10743590e-01f, 5.34237860e-01f, 2.67865279e+00f,
+  3.54278171e+00f, 1.99121034e-01f, 3.68034978e-01f, 7.07531060e-02f,
+  4.12930364e-01f, 4.89603000e-01f, 6.12322186e-01f, 8.63437956e-01f,
+  8.84832811e-01f, 9.07939160e-01f, 1.57456163e+00f, 3.61463825e+00f,
+  4.58814127e+00f, 4.33356164e+00f, 2.58743884e+00f, 1.26979754e+00f,
+  1.06480200e+00f, 1.32709212e+00f, 1.19518867e+00f, 1.14469620e+00f,
+  -1.08236658e+00f, -9.97313155e-01f, -9.73903818e-01f, -1.21424107e+00f,
+  -1.04152687e+00f, -8.19346154e-01f, 2.68473441e+00f, 4.29446217e+00f,
+  2.16718355e+00f, -5.42401005e-01f, -5.13253899e-01f, -3.76866093e-01f,
+  1.22046112e-01f, -2.59778600e-01f, -4.15922955e-01f, 1.78555109e-02f,
+  2.70499559e-02f, 2.34148735e-01f, 1.14335560e-01f, 2.73326944e+00f,
+  3.56151155e+00f, 3.71167427e-01f, 3.59395008e-01f, 5.41843246e-01f,
+  2.40469035e-01f, 4.69524885e-01f, 5.39692891e-01f, 4.59799980e-01f,
+  7.07817432e-01f, 9.10463053e-01f, 8.90380670e-01f, 9.71241827e-01f,
+  1.40287407e+00f, 3.81138395e+00f, 4.72159802e+00f, 4.13039019e+00f,
+  1.82600572e+00f, 1.16778493e+00f, 1.31649529e+00f, 1.42256929e+00f,
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef __HOST_TEST_H__
+#define __HOST_TEST_H__
+
+#include <cmath>
+#include <cstdio>
+
+/*
+ * Minimal checks for the host tests, no framework needed: a failed CHECK
+ * prints its location and message and the test's main returns
+ * HOST_TEST_RESULT().
+ */
+
+static int s_host_test_failures = 0;
+
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL %s:%d: %s: ", __FILE__, __LINE__, #cond);                   \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+      s_host_test_failures++;                                                  \
+    }                                                                          \
+  } while (0)
+
+#define HOST_TEST_RESULT()                                                     \
+  (printf("%s\n", s_host_test_failures ? "FAILED" : "PASSED"),                 \
+   s_host_test_failures ? 1 : 0)
+
+template <typename A, typename B>
+static double MaxAbsDiff(const A *a, const B *b, int len) {
+  double diff = 0.0;
+  for (int i = 0; i < len; i++)
+    diff = std::max(diff, std::fabs(static_cast<double>(a[i]) - b[i]));
+  return diff;
+}
+
+#endif
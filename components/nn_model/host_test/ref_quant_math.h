@@ -0,0 +1,68 @@
+#ifndef __REF_QUANT_MATH_H__
+#define __REF_QUANT_MATH_H__
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/*
+ * Transcriptions of the gemmlowp and TFLite fixed point helpers shared by
+ * the reference kernels of the host tests (gemmlowp/fixedpoint/
+ * fixedpoint.h, tensorflow/lite/kernels/internal/common.h without
+ * TFLITE_SINGLE_ROUNDING and quantization_util.cc). The code under test
+ * has its own copies in quant_math.h.
+ */
+
+namespace ref {
+
+inline int32_t SaturatingRoundingDoublingHighMul(int32_t a, int32_t b) {
+  bool overflow = a == b && a == std::numeric_limits<int32_t>::min();
+  int64_t a_64(a);
+  int64_t b_64(b);
+  int64_t ab_64 = a_64 * b_64;
+  int32_t nudge = ab_64 >= 0 ? (1 << 30) : (1 - (1 << 30));
+  int32_t ab_x2_high32 = static_cast<int32_t>((ab_64 + nudge) / (1ll << 31));
+  return overflow ? std::numeric_limits<int32_t>::max() : ab_x2_high32;
+}
+
+inline int32_t RoundingDivideByPOT(int32_t x, int exponent) {
+  const int32_t mask = static_cast<int32_t>((1ll << exponent) - 1);
+  const int32_t remainder = x & mask;
+  const int32_t threshold = (mask >> 1) + ((x < 0) ? 1 : 0);
+  return (x >> exponent) + ((remainder > threshold) ? 1 : 0);
+}
+
+inline int32_t MultiplyByQuantizedMultiplier(int32_t x,
+                                             int32_t quantized_multiplier,
+                                             int shift) {
+  int left_shift = shift > 0 ? shift : 0;
+  int right_shift = shift > 0 ? 0 : -shift;
+  return RoundingDivideByPOT(
+    SaturatingRoundingDoublingHighMul(x * (1 << left_shift),
+                                      quantized_multiplier),
+    right_shift);
+}
+
+inline void QuantizeMultiplier(double double_multiplier,
+                               int32_t *quantized_multiplier, int *shift) {
+  if (double_multiplier == 0.) {
+    *quantized_multiplier = 0;
+    *shift = 0;
+    return;
+  }
+  const double q = std::frexp(double_multiplier, shift);
+  auto q_fixed = static_cast<int64_t>(std::round(q * (1ll << 31)));
+  if (q_fixed == (1ll << 31)) {
+    q_fixed /= 2;
+    ++*shift;
+  }
+  if (*shift < -31) {
+    *shift = 0;
+    q_fixed = 0;
+  }
+  *quantized_multiplier = static_cast<int32_t>(q_fixed);
+}
+
+} // namespace ref
+
+#endif
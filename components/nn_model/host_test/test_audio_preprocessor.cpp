@@ -0,0 +1,150 @@
+#include <memory>
+#include <vector>
+
+#include "audio_preprocessor.h"
+#include "golden_features.h"
+#include "host_test.h"
+#include "spectrum_service.h"
+#include "static_audio_preprocessor.h"
+
+/*
+ * Float front ends against golden_features.h, computed in double precision
+ * by gen_golden_features.py. Feature configurations match main/kws and
+ * main/sed.
+ */
+
+#define KWS_BINS      40
+#define KWS_MFCC      10
+#define KWS_LOW_FREQ  20
+#define KWS_HIGH_FREQ 4000
+
+#define SED_BINS      40
+#define SED_LOW_FREQ  0
+#define SED_HIGH_FREQ 8000
+#define SED_MAX_ABS   (1 << 15)
+
+// Float FFT and mel sums against double precision.
+#define MFCC_TOLERANCE    5e-5
+#define LOG_MEL_TOLERANCE 5e-5
+
+// StaticAudioPreprocessor against AudioPreprocessor: same float math, the
+// tables only differ by libm rounding.
+#define STATIC_TOLERANCE 1e-5
+
+// Input quantization of the shipped SED models.
+static const AudioPreprocessor::QuantParams kSedQuant = {0.0957f, 13};
+
+static const int16_t *Frame(int i) {
+  return &kGoldenAudio[i * GOLDEN_FRAME_SHIFT];
+}
+
+template <typename Pp> static void TestKws(const char *name, Pp &pp) {
+  CHECK(pp.IsReady(), "%s not ready", name);
+  std::vector<float> mfcc(GOLDEN_FRAMES * KWS_MFCC);
+  for (int i = 0; i < GOLDEN_FRAMES; i++)
+    pp.MfccCompute(Frame(i), &mfcc[i * KWS_MFCC], GOLDEN_AUDIO_PEAK);
+  const double diff = MaxAbsDiff(mfcc.data(), kGoldenKws, mfcc.size());
+  printf("%s KWS MFCC: max error %.3g\n", name, diff);
+  CHECK(diff < MFCC_TOLERANCE, "%s", name);
+
+  // The batched call computes the same frames.
+  std::vector<float> batch(mfcc.size());
+  pp.MfccCompute(kGoldenAudio, GOLDEN_FRAME_SHIFT, GOLDEN_FRAMES, batch.data(),
+                 GOLDEN_AUDIO_PEAK);
+  CHECK(batch == mfcc, "%s batched MFCC differ", name);
+}
+
+template <typename Pp> static void TestSed(const char *name, Pp &pp) {
+  CHECK(pp.IsReady(), "%s not ready", name);
+  std::vector<float> logMel(GOLDEN_FRAMES * SED_BINS);
+  std::vector<int8_t> logMelQ(logMel.size());
+  for (int i = 0; i < GOLDEN_FRAMES; i++) {
+    pp.LogMelCompute(Frame(i), &logMel[i * SED_BINS], SED_MAX_ABS);
+    pp.LogMelCompute(Frame(i), &logMelQ[i * SED_BINS], SED_MAX_ABS, kSedQuant);
+  }
+  const double diff = MaxAbsDiff(logMel.data(), kGoldenSed, logMel.size());
+  printf("%s SED log-mel: max error %.3g\n", name, diff);
+  CHECK(diff < LOG_MEL_TOLERANCE, "%s", name);
+
+  // Quantized features round the float ones.
+  for (size_t i = 0; i < logMel.size(); i++) {
+    const int8_t expected = feature_kernels::Quantize(
+      logMel[i], 1.0f / kSedQuant.scale, kSedQuant.zeroPoint);
+    CHECK(logMelQ[i] == expected, "%s int8 log-mel %zu: %d, expected %d", name,
+          i, logMelQ[i], expected);
+  }
+
+  std::vector<float> batch(logMel.size());
+  pp.LogMelCompute(kGoldenAudio, GOLDEN_FRAME_SHIFT, GOLDEN_FRAMES,
+                   batch.data(), SED_MAX_ABS);
+  CHECK(batch == logMel, "%s batched log-mel differ", name);
+}
+
+// Features of both over the golden audio, MFCC or log-mel.
+template <typename Static>
+static void TestStatic(const char *name, AudioPreprocessor &pp, Static &spp,
+                       int numFeatures, bool mfcc, size_t maxAbs) {
+  std::vector<float> ref(numFeatures), out(numFeatures);
+  double diff = 0.0;
+  for (int i = 0; i < GOLDEN_FRAMES; i++) {
+    if (mfcc) {
+      pp.MfccCompute(Frame(i), ref.data(), maxAbs);
+      spp.MfccCompute(Frame(i), out.data(), maxAbs);
+    } else {
+      pp.LogMelCompute(Frame(i), ref.data(), maxAbs);
+      spp.LogMelCompute(Frame(i), out.data(), maxAbs);
+    }
+    diff = std::max(diff, MaxAbsDiff(ref.data(), out.data(), numFeatures));
+  }
+  printf("StaticAudioPreprocessor %s against AudioPreprocessor: max "
+         "difference %.3g\n",
+         name, diff);
+  CHECK(diff < STATIC_TOLERANCE, "%s", name);
+}
+
+static void TestSpectrumService() {
+  SpectrumService service(GOLDEN_FRAME_LEN);
+  const int kws = service.AddView(
+    {KWS_BINS, KWS_MFCC, KWS_LOW_FREQ, KWS_HIGH_FREQ});
+  const int sed = service.AddView({SED_BINS, 0, SED_LOW_FREQ, SED_HIGH_FREQ});
+
+  std::vector<float> mfcc(GOLDEN_FRAMES * KWS_MFCC);
+  std::vector<float> logMel(GOLDEN_FRAMES * SED_BINS);
+  for (int i = 0; i < GOLDEN_FRAMES; i++) {
+    service.Compute(Frame(i));
+    service.MfccCompute(kws, &mfcc[i * KWS_MFCC], GOLDEN_AUDIO_PEAK);
+    service.LogMelCompute(sed, &logMel[i * SED_BINS], SED_MAX_ABS);
+  }
+  const double mfccDiff = MaxAbsDiff(mfcc.data(), kGoldenKws, mfcc.size());
+  const double logMelDiff =
+    MaxAbsDiff(logMel.data(), kGoldenSed, logMel.size());
+  printf("SpectrumService: KWS MFCC max error %.3g, SED log-mel %.3g\n",
+         mfccDiff, logMelDiff);
+  CHECK(mfccDiff < MFCC_TOLERANCE, "SpectrumService");
+  CHECK(logMelDiff < LOG_MEL_TOLERANCE, "SpectrumService");
+}
+
+int main() {
+  AudioPreprocessor kws(KWS_MFCC, GOLDEN_FRAME_LEN, KWS_BINS, KWS_LOW_FREQ,
+                        KWS_HIGH_FREQ);
+  TestKws("AudioPreprocessor", kws);
+  AudioPreprocessor sed(0, GOLDEN_FRAME_LEN, SED_BINS, SED_LOW_FREQ,
+                        SED_HIGH_FREQ);
+  TestSed("AudioPreprocessor", sed);
+
+  // Large members, keep them off the stack.
+  auto staticKws =
+    std::make_unique<StaticAudioPreprocessor<GOLDEN_FRAME_LEN, KWS_BINS,
+                                             KWS_MFCC, KWS_LOW_FREQ,
+                                             KWS_HIGH_FREQ>>();
+  TestKws("StaticAudioPreprocessor", *staticKws);
+  auto staticSed =
+    std::make_unique<StaticAudioPreprocessor<GOLDEN_FRAME_LEN, SED_BINS, 0,
+                                             SED_LOW_FREQ, SED_HIGH_FREQ>>();
+  TestSed("StaticAudioPreprocessor", *staticSed);
+  TestStatic("KWS", kws, *staticKws, KWS_MFCC, true, GOLDEN_AUDIO_PEAK);
+  TestStatic("SED", sed, *staticSed, SED_BINS, false, SED_MAX_ABS);
+
+  TestSpectrumService();
+  return HOST_TEST_RESULT();
+}
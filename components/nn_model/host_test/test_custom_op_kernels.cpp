@@ -0,0 +1,768 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "custom_op_kernels.h"
+#include "host_test.h"
+#include "ref_quant_math.h"
+
+/*
+ * The custom op kernels against transcriptions of the TFLite reference
+ * kernels they replace (tensorflow/lite/kernels/internal/reference/
+ * integer_ops, the per channel quantization of
+ * PopulateConvolutionQuantizationParams and the padding of
+ * ComputePaddingHeightWidth): DepthwiseConv2D then Conv2D 1x1 for
+ * GRC_DS_CONV_BLOCK, FullyConnected for GRC_SPARSE_FC. Outputs have to be
+ * equal bit for bit.
+ */
+
+namespace ref {
+
+// tensorflow/lite/kernels/padding.h.
+int ComputePaddingWithOffset(int stride, int dilation_rate, int in_size,
+                             int filter_size, int out_size, int *offset) {
+  int effective_filter_size = (filter_size - 1) * dilation_rate + 1;
+  int total_padding =
+    ((out_size - 1) * stride + effective_filter_size - in_size);
+  total_padding = total_padding > 0 ? total_padding : 0;
+  *offset = total_padding % 2;
+  return total_padding / 2;
+}
+
+int ComputeOutSize(bool same, int image_size, int filter_size, int stride,
+                   int dilation_rate) {
+  int effective_filter_size = (filter_size - 1) * dilation_rate + 1;
+  if (stride == 0)
+    return 0;
+  return same ? (image_size + stride - 1) / stride
+              : (image_size + stride - effective_filter_size) / stride;
+}
+
+// kernel_util.cc, CalculateActivationRangeQuantizedImpl for int8.
+enum Activation { kNone, kRelu, kRelu6 };
+
+void ActivationRange(Activation activation, float scale, int32_t zero_point,
+                     int32_t *act_min, int32_t *act_max) {
+  const int32_t qmin = std::numeric_limits<int8_t>::min();
+  const int32_t qmax = std::numeric_limits<int8_t>::max();
+  auto quantize = [scale, zero_point](float f) {
+    return zero_point + static_cast<int32_t>(std::round(f / scale));
+  };
+  if (activation == kRelu) {
+    *act_min = std::max(qmin, quantize(0.0));
+    *act_max = qmax;
+  } else if (activation == kRelu6) {
+    *act_min = std::max(qmin, quantize(0.0));
+    *act_max = std::min(qmax, quantize(6.0));
+  } else {
+    *act_min = qmin;
+    *act_max = qmax;
+  }
+}
+
+struct ConvParams {
+  int32_t input_offset;
+  int32_t output_offset;
+  int stride_width;
+  int stride_height;
+  int dilation_width_factor;
+  int dilation_height_factor;
+  int pad_width;
+  int pad_height;
+  int depth_multiplier;
+  int32_t quantized_activation_min;
+  int32_t quantized_activation_max;
+};
+
+// NHWC with a batch of 1, [1, H, W, C * depth_multiplier] filter.
+void DepthwiseConvPerChannel(const ConvParams &params,
+                             const int32_t *output_multiplier,
+                             const int32_t *output_shift, int input_height,
+                             int input_width, int input_depth,
+                             const int8_t *input_data, int filter_height,
+                             int filter_width, const int8_t *filter_data,
+                             const int32_t *bias_data, int output_height,
+                             int output_width, int8_t *output_data) {
+  const int depth_multiplier = params.depth_multiplier;
+  const int output_depth = input_depth * depth_multiplier;
+  for (int out_y = 0; out_y < output_height; ++out_y) {
+    for (int out_x = 0; out_x < output_width; ++out_x) {
+      for (int in_channel = 0; in_channel < input_depth; ++in_channel) {
+        for (int m = 0; m < depth_multiplier; ++m) {
+          const int output_channel = m + in_channel * depth_multiplier;
+          const int in_x_origin =
+            (out_x * params.stride_width) - params.pad_width;
+          const int in_y_origin =
+            (out_y * params.stride_height) - params.pad_height;
+          int32_t acc = 0;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+              const int in_x =
+                in_x_origin + params.dilation_width_factor * filter_x;
+              const int in_y =
+                in_y_origin + params.dilation_height_factor * filter_y;
+              const bool is_point_inside_image =
+                (in_x >= 0) && (in_x < input_width) && (in_y >= 0) &&
+                (in_y < input_height);
+              if (is_point_inside_image) {
+                int32_t input_val =
+                  input_data[(in_y * input_width + in_x) * input_depth +
+                             in_channel];
+                int32_t filter_val =
+                  filter_data[(filter_y * filter_width + filter_x) *
+                                output_depth +
+                              output_channel];
+                acc += filter_val * (input_val + params.input_offset);
+              }
+            }
+          }
+          if (bias_data) {
+            acc += bias_data[output_channel];
+          }
+          acc = MultiplyByQuantizedMultiplier(
+            acc, output_multiplier[output_channel],
+            output_shift[output_channel]);
+          acc += params.output_offset;
+          acc = std::max(acc, params.quantized_activation_min);
+          acc = std::min(acc, params.quantized_activation_max);
+          output_data[(out_y * output_width + out_x) * output_depth +
+                      output_channel] = static_cast<int8_t>(acc);
+        }
+      }
+    }
+  }
+}
+
+// NHWC with a batch of 1, [O, H, W, C] filter.
+void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                    const int32_t *output_shift, int input_height,
+                    int input_width, int input_depth, const int8_t *input_data,
+                    int output_depth, int filter_height, int filter_width,
+                    const int8_t *filter_data, const int32_t *bias_data,
+                    int output_height, int output_width,
+                    int8_t *output_data) {
+  for (int out_y = 0; out_y < output_height; ++out_y) {
+    const int in_y_origin = (out_y * params.stride_height) - params.pad_height;
+    for (int out_x = 0; out_x < output_width; ++out_x) {
+      const int in_x_origin = (out_x * params.stride_width) - params.pad_width;
+      for (int out_channel = 0; out_channel < output_depth; ++out_channel) {
+        int32_t acc = 0;
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+          const int in_y =
+            in_y_origin + params.dilation_height_factor * filter_y;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+            const int in_x =
+              in_x_origin + params.dilation_width_factor * filter_x;
+            const bool is_point_inside_image =
+              (in_x >= 0) && (in_x < input_width) && (in_y >= 0) &&
+              (in_y < input_height);
+            if (!is_point_inside_image) {
+              continue;
+            }
+            for (int in_channel = 0; in_channel < input_depth; ++in_channel) {
+              int32_t input_val =
+                input_data[(in_y * input_width + in_x) * input_depth +
+                           in_channel];
+              int32_t filter_val =
+                filter_data[((out_channel * filter_height + filter_y) *
+                               filter_width +
+                             filter_x) *
+                              input_depth +
+                            in_channel];
+              acc += filter_val * (input_val + params.input_offset);
+            }
+          }
+        }
+        if (bias_data) {
+          acc += bias_data[out_channel];
+        }
+        acc = MultiplyByQuantizedMultiplier(
+          acc, output_multiplier[out_channel], output_shift[out_channel]);
+        acc += params.output_offset;
+        acc = std::max(acc, params.quantized_activation_min);
+        acc = std::min(acc, params.quantized_activation_max);
+        output_data[(out_y * output_width + out_x) * output_depth +
+                    out_channel] = static_cast<int8_t>(acc);
+      }
+    }
+  }
+}
+
+// [O, I] filter of zero point 0, per tensor quantization.
+void FullyConnected(const ConvParams &params, int32_t output_multiplier,
+                    int output_shift, int batches, int accum_depth,
+                    const int8_t *input_data, int output_depth,
+                    const int8_t *filter_data, const int32_t *bias_data,
+                    int8_t *output_data) {
+  const int32_t filter_offset = 0;
+  for (int b = 0; b < batches; ++b) {
+    for (int out_c = 0; out_c < output_depth; ++out_c) {
+      int32_t acc = 0;
+      for (int d = 0; d < accum_depth; ++d) {
+        int32_t input_val = input_data[b * accum_depth + d];
+        int32_t filter_val = filter_data[out_c * accum_depth + d];
+        acc += (filter_val + filter_offset) * (input_val + params.input_offset);
+      }
+      if (bias_data) {
+        acc += bias_data[out_c];
+      }
+      acc = MultiplyByQuantizedMultiplier(acc, output_multiplier, output_shift);
+      acc += params.output_offset;
+      acc = std::max(acc, params.quantized_activation_min);
+      acc = std::min(acc, params.quantized_activation_max);
+      output_data[out_c + output_depth * b] = static_cast<int8_t>(acc);
+    }
+  }
+}
+
+} // namespace ref
+
+// Per channel (or per tensor) multipliers of a filter, as
+// PopulateConvolutionQuantizationParams.
+static void ChannelMultipliers(float input_scale,
+                               const std::vector<float> &filter_scales,
+                               float output_scale, int channels,
+                               std::vector<int32_t> &multiplier,
+                               std::vector<int32_t> &shift) {
+  multiplier.resize(channels);
+  shift.resize(channels);
+  for (int c = 0; c < channels; c++) {
+    const double filter_scale =
+      filter_scales[filter_scales.size() > 1 ? c : 0];
+    const double effective_scale =
+      static_cast<double>(input_scale) * filter_scale / output_scale;
+    int channel_shift;
+    ref::QuantizeMultiplier(effective_scale, &multiplier[c], &channel_shift);
+    shift[c] = channel_shift;
+  }
+}
+
+template <typename T>
+static std::vector<T> RandomVector(std::mt19937 &rng, size_t len, int min,
+                                   int max) {
+  std::uniform_int_distribution<int> dist(min, max);
+  std::vector<T> v(len);
+  for (T &x : v)
+    x = static_cast<T>(dist(rng));
+  return v;
+}
+
+static float Uniform(std::mt19937 &rng, float min, float max) {
+  return std::uniform_real_distribution<float>(min, max)(rng);
+}
+
+// DsConvBlock against DepthwiseConvPerChannel then ConvPerChannel 1x1 on
+// the int8 intermediate tensor, for random geometries and quantizations.
+static void TestDsConvBlock(std::mt19937 &rng) {
+  std::uniform_int_distribution<int> dim(1, 12), small(1, 5), two(1, 2),
+    act(0, 2);
+  int cases = 0, mismatches = 0;
+  size_t outputs = 0, saturated = 0;
+  while (cases < 300) {
+    const int in_height = dim(rng), in_width = dim(rng);
+    const int channels = 2 * dim(rng), out_channels = 2 * dim(rng);
+    const int filter_height = small(rng), filter_width = small(rng);
+    const int stride_height = two(rng), stride_width = two(rng);
+    const int dilation_height = two(rng), dilation_width = two(rng);
+    const bool same = two(rng) == 1;
+    const int out_height = ref::ComputeOutSize(
+      same, in_height, filter_height, stride_height, dilation_height);
+    const int out_width = ref::ComputeOutSize(same, in_width, filter_width,
+                                              stride_width, dilation_width);
+    if (out_height <= 0 || out_width <= 0)
+      continue;
+    int offset;
+    const int pad_height =
+      ref::ComputePaddingWithOffset(stride_height, dilation_height, in_height,
+                                    filter_height, out_height, &offset);
+    const int pad_width =
+      ref::ComputePaddingWithOffset(stride_width, dilation_width, in_width,
+                                    filter_width, out_width, &offset);
+
+    // Scales keeping most outputs inside the int8 range.
+    const float input_scale = Uniform(rng, 0.01f, 0.1f);
+    const int32_t input_zero_point = dim(rng) * 10 - 70;
+    const bool per_channel = cases % 4 != 0;
+    std::vector<float> dw_scales(per_channel ? channels : 1);
+    for (float &s : dw_scales)
+      s = Uniform(rng, 0.002f, 0.02f);
+    std::vector<float> pw_scales(per_channel ? out_channels : 1);
+    for (float &s : pw_scales)
+      s = Uniform(rng, 0.002f, 0.02f);
+    const float mid_scale = input_scale * 0.01f * 128.f *
+                            std::sqrt(filter_height * filter_width) *
+                            Uniform(rng, 0.2f, 1.f);
+    const int32_t mid_zero_point = dim(rng) * 10 - 70;
+    const float output_scale = mid_scale * 0.01f * 128.f *
+                               std::sqrt(channels) * Uniform(rng, 0.2f, 1.f);
+    const int32_t output_zero_point = dim(rng) * 10 - 70;
+    const auto dw_act = static_cast<ref::Activation>(act(rng));
+    const auto pw_act = static_cast<ref::Activation>(act(rng));
+
+    const auto input =
+      RandomVector<int8_t>(rng, in_height * in_width * channels, -128, 127);
+    const auto dw_filter = RandomVector<int8_t>(
+      rng, filter_height * filter_width * channels, -127, 127);
+    const auto pw_filter =
+      RandomVector<int8_t>(rng, out_channels * channels, -127, 127);
+    const auto dw_bias = RandomVector<int32_t>(rng, channels, -20000, 20000);
+    const auto pw_bias =
+      RandomVector<int32_t>(rng, out_channels, -20000, 20000);
+    const bool bias = cases % 3 != 0;
+
+    std::vector<int32_t> dw_multiplier, dw_shift, pw_multiplier, pw_shift;
+    ChannelMultipliers(input_scale, dw_scales, mid_scale, channels,
+                       dw_multiplier, dw_shift);
+    ChannelMultipliers(mid_scale, pw_scales, output_scale, out_channels,
+                       pw_multiplier, pw_shift);
+
+    // Unfused reference.
+    ref::ConvParams dw_params = {};
+    dw_params.input_offset = -input_zero_point;
+    dw_params.output_offset = mid_zero_point;
+    dw_params.stride_width = stride_width;
+    dw_params.stride_height = stride_height;
+    dw_params.dilation_width_factor = dilation_width;
+    dw_params.dilation_height_factor = dilation_height;
+    dw_params.pad_width = pad_width;
+    dw_params.pad_height = pad_height;
+    dw_params.depth_multiplier = 1;
+    ref::ActivationRange(dw_act, mid_scale, mid_zero_point,
+                         &dw_params.quantized_activation_min,
+                         &dw_params.quantized_activation_max);
+    std::vector<int8_t> mid(out_height * out_width * channels);
+    ref::DepthwiseConvPerChannel(
+      dw_params, dw_multiplier.data(), dw_shift.data(), in_height, in_width,
+      channels, input.data(), filter_height, filter_width, dw_filter.data(),
+      bias ? dw_bias.data() : nullptr, out_height, out_width, mid.data());
+
+    ref::ConvParams pw_params = {};
+    pw_params.input_offset = -mid_zero_point;
+    pw_params.output_offset = output_zero_point;
+    pw_params.stride_width = 1;
+    pw_params.stride_height = 1;
+    pw_params.dilation_width_factor = 1;
+    pw_params.dilation_height_factor = 1;
+    ref::ActivationRange(pw_act, output_scale, output_zero_point,
+                         &pw_params.quantized_activation_min,
+                         &pw_params.quantized_activation_max);
+    std::vector<int8_t> expected(out_height * out_width * out_channels);
+    ref::ConvPerChannel(pw_params, pw_multiplier.data(), pw_shift.data(),
+                        out_height, out_width, channels, mid.data(),
+                        out_channels, 1, 1, pw_filter.data(),
+                        bias ? pw_bias.data() : nullptr, out_height,
+                        out_width, expected.data());
+
+    // Fused kernel, the parameters as GRC_DS_CONV_BLOCK prepares them.
+    custom_op_kernels::DsConvBlockParams p = {};
+    p.in_height = in_height;
+    p.in_width = in_width;
+    p.channels = channels;
+    p.filter_height = filter_height;
+    p.filter_width = filter_width;
+    p.out_height = out_height;
+    p.out_width = out_width;
+    p.out_channels = out_channels;
+    p.stride_width = stride_width;
+    p.stride_height = stride_height;
+    p.dilation_width = dilation_width;
+    p.dilation_height = dilation_height;
+    p.pad_width = pad_width;
+    p.pad_height = pad_height;
+    p.input_offset = -input_zero_point;
+    p.mid_zero_point = mid_zero_point;
+    p.output_offset = output_zero_point;
+    p.dw_multiplier = dw_multiplier.data();
+    p.dw_shift = dw_shift.data();
+    p.pw_multiplier = pw_multiplier.data();
+    p.pw_shift = pw_shift.data();
+    p.dw_min = dw_params.quantized_activation_min;
+    p.dw_max = dw_params.quantized_activation_max;
+    p.pw_min = pw_params.quantized_activation_min;
+    p.pw_max = pw_params.quantized_activation_max;
+    std::vector<int8_t> row(out_width * channels);
+    std::vector<int32_t> acc(channels);
+    std::vector<int8_t> out(expected.size());
+    custom_op_kernels::DsConvBlock(
+      p, input.data(), dw_filter.data(), bias ? dw_bias.data() : nullptr,
+      pw_filter.data(), bias ? pw_bias.data() : nullptr, out.data(),
+      row.data(), acc.data());
+
+    mismatches += out != expected;
+    for (int8_t q : expected)
+      saturated += q == INT8_MIN || q == INT8_MAX;
+    outputs += expected.size();
+    cases++;
+  }
+  printf("DsConvBlock: %d cases, %d mismatches, %.1f%% saturated outputs\n",
+         cases, mismatches, 100. * saturated / outputs);
+  CHECK(mismatches == 0, "%d of %d cases", mismatches, cases);
+}
+
+// Stored blocks row after row and the LSB first bitmap of each row, as
+// tools/sparsify_fc.py packs them.
+static void PackBlocks(const std::vector<int8_t> &dense, int out_features,
+                       int in_features, int block, std::vector<int8_t> &packed,
+                       std::vector<uint8_t> &bitmap) {
+  const int blocks_num = (in_features + block - 1) / block;
+  const int row_bytes = (blocks_num + 7) / 8;
+  packed.clear();
+  bitmap.assign(out_features * row_bytes, 0);
+  for (int o = 0; o < out_features; o++) {
+    for (int blk = 0; blk < blocks_num; blk++) {
+      const int base = blk * block;
+      const int len = std::min(block, in_features - base);
+      const int8_t *w = &dense[o * in_features + base];
+      if (std::all_of(w, w + len, [](int8_t x) { return x == 0; }))
+        continue;
+      bitmap[o * row_bytes + blk / 8] |= 1 << (blk % 8);
+      packed.insert(packed.end(), w, w + len);
+      packed.insert(packed.end(), block - len, 0);
+    }
+  }
+}
+
+// SparseFc against the dense FullyConnected, for random block sparsities
+// and shapes, input features not always a multiple of the block.
+static void TestSparseFc(std::mt19937 &rng) {
+  const int block = 4;
+  std::uniform_int_distribution<int> features(1, 80), batch(1, 3), act(0, 2);
+  std::uniform_int_distribution<int> zero_point(-100, 100);
+  int mismatches = 0;
+  size_t outputs = 0, saturated = 0;
+  for (int i = 0; i < 300; i++) {
+    const int in_features = features(rng), out_features = features(rng);
+    const int batches = batch(rng);
+    // Some layers fully dense, some with no stored block at all.
+    const float density = i % 10 == 0 ? 1.f : Uniform(rng, 0.f, 0.5f);
+    std::vector<int8_t> dense =
+      RandomVector<int8_t>(rng, out_features * in_features, -127, 127);
+    for (int o = 0; o < out_features; o++) {
+      for (int base = 0; base < in_features; base += block) {
+        if (Uniform(rng, 0.f, 1.f) < density)
+          continue;
+        const int len = std::min(block, in_features - base);
+        std::fill_n(&dense[o * in_features + base], len, 0);
+      }
+    }
+    std::vector<int8_t> packed;
+    std::vector<uint8_t> bitmap;
+    PackBlocks(dense, out_features, in_features, block, packed, bitmap);
+
+    const float input_scale = Uniform(rng, 0.01f, 0.1f);
+    const float weights_scale = Uniform(rng, 0.002f, 0.02f);
+    const float output_scale = input_scale * weights_scale * 64.f *
+                               std::sqrt(in_features * (density + 0.05f)) *
+                               Uniform(rng, 0.5f, 2.f);
+    const int32_t input_zero_point = zero_point(rng);
+    const int32_t output_zero_point = zero_point(rng);
+    // As GetQuantizedConvolutionMultipler.
+    const double input_product_scale =
+      static_cast<double>(input_scale) * static_cast<double>(weights_scale);
+    int32_t multiplier;
+    int shift;
+    ref::QuantizeMultiplier(input_product_scale /
+                              static_cast<double>(output_scale),
+                            &multiplier, &shift);
+
+    ref::ConvParams params = {};
+    params.input_offset = -input_zero_point;
+    params.output_offset = output_zero_point;
+    ref::ActivationRange(static_cast<ref::Activation>(act(rng)), output_scale,
+                         output_zero_point, &params.quantized_activation_min,
+                         &params.quantized_activation_max);
+    const auto input =
+      RandomVector<int8_t>(rng, batches * in_features, -128, 127);
+    const auto bias_data =
+      RandomVector<int32_t>(rng, out_features, -20000, 20000);
+    const int32_t *bias = i % 3 ? bias_data.data() : nullptr;
+    std::vector<int8_t> expected(batches * out_features);
+    ref::FullyConnected(params, multiplier, shift, batches, in_features,
+                        input.data(), out_features, dense.data(), bias,
+                        expected.data());
+
+    // The parameters as GRC_SPARSE_FC prepares them.
+    custom_op_kernels::SparseFcParams p = {};
+    p.in_features = in_features;
+    p.out_features = out_features;
+    p.block = block;
+    p.blocks_num = (in_features + block - 1) / block;
+    p.bitmap_row_bytes = (p.blocks_num + 7) / 8;
+    p.input_offset = -input_zero_point;
+    p.output_offset = output_zero_point;
+    p.multiplier = multiplier;
+    p.shift = shift;
+    p.act_min = params.quantized_activation_min;
+    p.act_max = params.quantized_activation_max;
+    std::vector<int8_t> out(expected.size());
+    custom_op_kernels::SparseFc(p, batches, input.data(), packed.data(),
+                                bitmap.data(), bias, out.data());
+
+    mismatches += out != expected;
+    for (int8_t q : expected)
+      saturated += q == INT8_MIN || q == INT8_MAX;
+    outputs += expected.size();
+  }
+  printf("SparseFc: 300 cases, %d mismatches, %.1f%% saturated outputs\n",
+         mismatches, 100. * saturated / outputs);
+  CHECK(mismatches == 0, "%d of 300 cases", mismatches);
+}
+
+// A layer on the time axis of a streaming test model: Conv2D or
+// DepthwiseConv2D, SAME or VALID, with its quantization.
+struct TimeLayer {
+  bool depthwise;
+  int kt, kw, st, sw, dt;
+  int out_channels;
+  bool same;
+};
+
+// A TimeLayer with the shapes and weights of the full-window model.
+struct StreamLayer : TimeLayer {
+  int in_rows, in_width, in_channels;
+  int out_rows, out_width;
+  int32_t input_zero_point;
+  std::vector<int8_t> filter;
+  std::vector<int32_t> bias, multiplier, shift;
+  int32_t output_zero_point, act_min, act_max;
+  // As tools/stream_model.py converts the layer.
+  int n_in, n_out, top, padding_rows, state_rows, left, right;
+};
+
+static int SamePadding(int size, int kernel, int stride, int dilation,
+                       int *out_size) {
+  int offset;
+  *out_size = ref::ComputeOutSize(true, size, kernel, stride, dilation);
+  return ref::ComputePaddingWithOffset(stride, dilation, size, kernel,
+                                       *out_size, &offset);
+}
+
+// Shapes, random weights and quantization of the full-window model on
+// frames x width x channels windows, then the stream conversion. The last
+// layer pools the time axis. Returns the frames per step.
+static int BuildStreamModel(const std::vector<TimeLayer> &model,
+                            std::vector<StreamLayer> &layers, int frames,
+                            int width, int channels, std::mt19937 &rng) {
+  float scale = Uniform(rng, 0.02f, 0.1f);
+  int32_t zero_point = static_cast<int32_t>(Uniform(rng, -60.f, 60.f));
+  int rows = frames;
+  layers.resize(model.size());
+  for (size_t i = 0; i < model.size(); i++) {
+    StreamLayer &l = layers[i];
+    static_cast<TimeLayer &>(l) = model[i];
+    l.in_rows = rows;
+    l.in_width = width;
+    l.in_channels = channels;
+    if (&l == &layers.back())
+      l.kt = rows;
+    const int eff = (l.kt - 1) * l.dt + 1;
+    int out_width;
+    l.top = l.same ? SamePadding(rows, l.kt, l.st, l.dt, &l.out_rows) : 0;
+    SamePadding(width, l.kw, l.sw, 1, &out_width);
+    l.out_width = l.same ? out_width : (width - l.kw) / l.sw + 1;
+    if (!l.same)
+      l.out_rows = (rows - eff) / l.st + 1;
+    if (l.depthwise)
+      l.out_channels = channels;
+
+    const int filter_channels = l.depthwise ? 1 : channels;
+    l.filter = RandomVector<int8_t>(
+      rng, l.out_channels * l.kt * l.kw * filter_channels, -127, 127);
+    l.bias = RandomVector<int32_t>(rng, l.out_channels, -5000, 5000);
+    const float filter_scale = Uniform(rng, 0.005f, 0.02f);
+    const float out_scale =
+      scale * filter_scale * 64.f * std::sqrt(l.kt * l.kw * filter_channels);
+    ChannelMultipliers(scale, {filter_scale}, out_scale, l.out_channels,
+                       l.multiplier, l.shift);
+    l.input_zero_point = zero_point;
+    zero_point = static_cast<int32_t>(Uniform(rng, -60.f, 60.f));
+    l.output_zero_point = zero_point;
+    ref::ActivationRange(l.depthwise ? ref::kRelu : ref::kNone, out_scale,
+                         zero_point, &l.act_min, &l.act_max);
+    scale = out_scale;
+    rows = l.out_rows;
+    width = l.out_width;
+    channels = l.out_channels;
+  }
+  CHECK(rows == 1, "the last layer pools %d rows", rows);
+
+  // stream_model.py: rows per step, padding rows, alignment and state.
+  int step = 1;
+  for (size_t i = 0; i + 1 < layers.size(); i++)
+    step *= layers[i].st;
+  int n_in = step, padding_rows = 0;
+  for (StreamLayer &l : layers) {
+    const bool end = &l == &layers.back();
+    const int st = end ? 1 : l.st;
+    const int eff = (l.kt - 1) * l.dt + 1;
+    l.n_in = n_in;
+    l.n_out = n_in / st;
+    l.padding_rows = padding_rows;
+    const int end_row =
+      padding_rows + eff - l.top + (l.kt == 1 ? st - 1 : 0);
+    CHECK(n_in % st == 0 && end_row % st == 0, "unaligned layer");
+    padding_rows = end_row / st - 1;
+    l.state_rows = eff + st * (l.n_out - 1);
+    const int total =
+      std::max((l.out_width - 1) * l.sw + l.kw - l.in_width, 0);
+    l.left = l.same ? total / 2 : 0;
+    l.right = l.same ? total - total / 2 : 0;
+    n_in = l.n_out;
+  }
+  return step;
+}
+
+// in_rows x in_width x in_channels in, out_rows x out_width out.
+static void RunLayer(const StreamLayer &l, const int8_t *in, int in_rows,
+                     int in_width, int pad_top, int pad_left, int stride,
+                     int out_rows, int8_t *out) {
+  ref::ConvParams params = {};
+  params.input_offset = -l.input_zero_point;
+  params.output_offset = l.output_zero_point;
+  params.stride_width = l.sw;
+  params.stride_height = stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = l.dt;
+  params.pad_width = pad_left;
+  params.pad_height = pad_top;
+  params.depth_multiplier = 1;
+  params.quantized_activation_min = l.act_min;
+  params.quantized_activation_max = l.act_max;
+  if (l.depthwise) {
+    ref::DepthwiseConvPerChannel(params, l.multiplier.data(), l.shift.data(),
+                                 in_rows, in_width, l.in_channels, in, l.kt,
+                                 l.kw, l.filter.data(), l.bias.data(),
+                                 out_rows, l.out_width, out);
+  } else {
+    ref::ConvPerChannel(params, l.multiplier.data(), l.shift.data(), in_rows,
+                        in_width, l.in_channels, in, l.out_channels, l.kt,
+                        l.kw, l.filter.data(), l.bias.data(), out_rows,
+                        l.out_width, out);
+  }
+}
+
+// The converted model against the full-window one run on the whole stream:
+// every row a streaming layer computes past the padding rows has to be the
+// row of the full-window layers, SAME padding before the stream included.
+static void TestStreamBuffer(const std::vector<TimeLayer> &model,
+                             const char *name, std::mt19937 &rng) {
+  const int frames = 49, width = 8, channels = 2, steps = 60;
+  std::vector<StreamLayer> layers;
+  const int step =
+    BuildStreamModel(model, layers, frames, width, channels, rng);
+  const int stream_rows = steps * step;
+  const auto stream = RandomVector<int8_t>(
+    rng, stream_rows * width * channels, -128, 127);
+
+  // Full-window layers on the stream, rows after its end are not computed.
+  std::vector<std::vector<int8_t>> expected(layers.size());
+  std::vector<int> expected_rows(layers.size());
+  const int8_t *in = stream.data();
+  int rows = stream_rows;
+  for (size_t i = 0; i < layers.size(); i++) {
+    const StreamLayer &l = layers[i];
+    const bool end = i + 1 == layers.size();
+    const int st = end ? 1 : l.st;
+    const int eff = (l.kt - 1) * l.dt + 1;
+    const int out_rows = (rows + l.top - eff) / st + 1;
+    expected[i].resize(out_rows * l.out_width * l.out_channels);
+    RunLayer(l, in, rows, l.in_width, l.top, l.left, st, out_rows,
+             expected[i].data());
+    expected_rows[i] = out_rows;
+    in = expected[i].data();
+    rows = out_rows;
+  }
+
+  // Streaming layers, the state as nn_model_reset_state leaves it.
+  std::vector<std::vector<uint8_t>> state(layers.size());
+  std::vector<int32_t> seen(layers.size(), 0);
+  for (size_t i = 0; i < layers.size(); i++) {
+    const StreamLayer &l = layers[i];
+    state[i].assign(l.state_rows * l.in_width * l.in_channels,
+                    static_cast<uint8_t>(l.input_zero_point));
+  }
+  int compared = 0, mismatches = 0, results = 0;
+  for (int s = 0; s < steps; s++) {
+    std::vector<int8_t> cur(&stream[s * step * width * channels],
+                            &stream[(s + 1) * step * width * channels]);
+    for (size_t i = 0; i < layers.size(); i++) {
+      const StreamLayer &l = layers[i];
+      const bool end = i + 1 == layers.size();
+      const int st = end ? 1 : l.st;
+      std::vector<int8_t> out(l.n_out * l.out_width * l.out_channels);
+      if (l.kt > 1) {
+        custom_op_kernels::StreamBufferParams p = {};
+        p.input_rows = l.n_in;
+        p.state_rows = l.state_rows;
+        p.row_bytes = l.in_width * l.in_channels;
+        p.left_bytes = l.left * l.in_channels;
+        p.right_bytes = l.right * l.in_channels;
+        p.skip = l.padding_rows;
+        p.zero = static_cast<uint8_t>(l.input_zero_point);
+        const int padded_width = l.in_width + l.left + l.right;
+        std::vector<int8_t> buffer(l.state_rows * padded_width *
+                                   l.in_channels);
+        custom_op_kernels::StreamBuffer(
+          p, reinterpret_cast<const uint8_t *>(cur.data()), state[i].data(),
+          l.padding_rows ? &seen[i] : nullptr,
+          reinterpret_cast<uint8_t *>(buffer.data()));
+        RunLayer(l, buffer.data(), l.state_rows, padded_width, 0, 0, st,
+                 l.n_out, out.data());
+      } else {
+        RunLayer(l, cur.data(), l.n_in, l.in_width, 0, l.left, st, l.n_out,
+                 out.data());
+      }
+
+      // Stream rows of this step's output.
+      const size_t row_size = l.out_width * l.out_channels;
+      const int next_padding = i + 1 < layers.size()
+                                 ? layers[i + 1].padding_rows
+                                 : l.padding_rows + l.kt - 1;
+      for (int r = 0; r < l.n_out; r++) {
+        const int row = s * l.n_out + r - next_padding;
+        if (row < 0 || row >= expected_rows[i])
+          continue;
+        compared++;
+        results += end;
+        mismatches += !std::equal(&out[r * row_size],
+                                  &out[(r + 1) * row_size],
+                                  &expected[i][row * row_size]);
+      }
+      cur.swap(out);
+    }
+  }
+  printf("StreamBuffer %s: %d frames per step, %d rows compared, %d "
+         "results, %d mismatches\n",
+         name, step, compared, results, mismatches);
+  CHECK(results > 0 && mismatches == 0, "%s", name);
+}
+
+int main() {
+  std::mt19937 rng(2024);
+  TestDsConvBlock(rng);
+  TestSparseFc(rng);
+  // The sound events models: a strided first convolution, depthwise-
+  // separable blocks and average pooling of the time axis.
+  TestStreamBuffer({{false, 10, 4, 2, 2, 1, 8, true},
+                    {true, 3, 3, 1, 1, 1, 0, true},
+                    {false, 1, 1, 1, 1, 1, 8, true},
+                    {true, 3, 3, 1, 1, 2, 0, true},
+                    {false, 1, 1, 1, 1, 1, 8, true},
+                    {false, 0, 1, 1, 1, 1, 4, false}},
+                   "sed", rng);
+  TestStreamBuffer({{false, 3, 3, 1, 1, 1, 6, true},
+                    {true, 4, 3, 2, 1, 1, 0, true},
+                    {false, 1, 1, 1, 1, 1, 6, true},
+                    {true, 5, 3, 1, 1, 1, 0, false},
+                    {false, 0, 1, 1, 1, 1, 4, false}},
+                   "strided", rng);
+  TestStreamBuffer({{false, 1, 3, 2, 1, 1, 6, true},
+                    {true, 5, 1, 1, 1, 1, 0, true},
+                    {false, 0, 1, 1, 1, 1, 4, false}},
+                   "pointwise stride", rng);
+  return HOST_TEST_RESULT();
+}
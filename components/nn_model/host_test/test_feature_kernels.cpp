@@ -0,0 +1,83 @@
+#include <random>
+#include <vector>
+
+#include "feature_kernels.h"
+#include "host_test.h"
+
+/*
+ * Accuracy of the feature_kernels approximations against double precision
+ * libm, with the bounds documented in feature_kernels.h.
+ */
+
+// Log over every 101st positive normal float.
+static void TestLog() {
+  const int kBatch = 4096;
+  std::vector<float> in(kBatch), out(kBatch);
+  double maxError = 0.0, maxErrorMid = 0.0, maxUlp = 0.0, maxLogfError = 0.0;
+  uint32_t bits = 0x00800000;
+  while (bits < 0x7f800000) {
+    int n = 0;
+    for (; n < kBatch && bits < 0x7f800000; n++, bits += 101)
+      memcpy(&in[n], &bits, sizeof(float));
+    feature_kernels::Log(in.data(), out.data(), n);
+
+    for (int i = 0; i < n; i++) {
+      const double exact = log(static_cast<double>(in[i]));
+      const double error = fabs(out[i] - exact);
+      maxError = std::max(maxError, error);
+      if (in[i] >= 0x1p-7f && in[i] < 0x1p31f)
+        maxErrorMid = std::max(maxErrorMid, error);
+      const float rounded = fabsf(static_cast<float>(exact));
+      if (rounded != 0.0f)
+        maxUlp = std::max<double>(
+          maxUlp, error / (nextafterf(rounded, INFINITY) - rounded));
+      maxLogfError = std::max(maxLogfError, fabs(logf(in[i]) - exact));
+    }
+  }
+  printf("Log: max error %.3g, %.3g in [2^-7, 2^31), %.2f ulp; logf %.3g\n",
+         maxError, maxErrorMid, maxUlp, maxLogfError);
+  CHECK(maxError < 8e-6, "Log");
+  CHECK(maxErrorMid < 2e-6, "Log in [2^-7, 2^31)");
+  CHECK(maxUlp < 2.0, "Log ulp");
+}
+
+// FoldedDct for every numIn <= 80 and numOut <= numIn on random inputs in
+// [-1, 1], against the DCT-II in double precision.
+static void TestFoldedDct() {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+  double maxError = 0.0;
+  for (int numIn = 1; numIn <= 80; numIn++) {
+    const double normalizer = sqrt(2.0 / numIn);
+    for (int numOut = 1; numOut <= numIn; numOut++) {
+      std::vector<float> table(
+        feature_kernels::FoldedDctTableSize(numOut, numIn));
+      feature_kernels::CreateFoldedDct(
+        numOut, numIn, normalizer, [](double x) { return cos(x); },
+        table.data());
+
+      std::vector<float> in(numIn), scratch(numIn), out(numOut);
+      for (int trial = 0; trial < 4; trial++) {
+        for (float &x : in)
+          x = uniform(rng);
+        scratch = in;
+        feature_kernels::FoldedDct(table.data(), scratch.data(), out.data(),
+                                   numOut, numIn);
+        for (int k = 0; k < numOut; k++) {
+          double exact = 0.0;
+          for (int n = 0; n < numIn; n++)
+            exact += normalizer * cos(M_PI / numIn * (n + 0.5) * k) * in[n];
+          maxError = std::max(maxError, fabs(out[k] - exact));
+        }
+      }
+    }
+  }
+  printf("FoldedDct: max error %.3g\n", maxError);
+  CHECK(maxError < 2e-6, "FoldedDct");
+}
+
+int main() {
+  TestLog();
+  TestFoldedDct();
+  return HOST_TEST_RESULT();
+}
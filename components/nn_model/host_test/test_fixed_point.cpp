@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <vector>
+
+#include "audio_preprocessor.h"
+#include "golden_features.h"
+#include "host_test.h"
+
+/*
+ * Arithmetic::Fixed against Arithmetic::Float on the golden audio, at full
+ * level and attenuated, checking the error bound documented with
+ * AudioPreprocessor::Arithmetic: log-mel bins within 30 dB of the loudest
+ * bin of their frame are within 0.1, bins within 40 dB within 0.5, and the
+ * median error is below 0.01. Quieter bins are not bounded, MFCC, which mix
+ * all bins, are checked against the measured 0.14 with some margin.
+ */
+
+#define KWS_BINS      40
+#define KWS_MFCC      10
+#define KWS_LOW_FREQ  20
+#define KWS_HIGH_FREQ 4000
+
+#define SED_BINS      40
+#define SED_LOW_FREQ  0
+#define SED_HIGH_FREQ 8000
+#define SED_MAX_ABS   (1 << 15)
+
+// Log-mel is the log of a magnitude: 20 dB per ln(10).
+static float DbToNats(float db) { return db / 20.0f * logf(10.0f); }
+
+struct Errors {
+  std::vector<float> all;
+  float within30Db = 0.0f;
+  float within40Db = 0.0f;
+};
+
+static void Compare(const float *ref, const float *fixed, int bins,
+                    Errors &errors) {
+  const float peak = *std::max_element(ref, ref + bins);
+  for (int i = 0; i < bins; i++) {
+    const float err = fabsf(fixed[i] - ref[i]);
+    errors.all.push_back(err);
+    if (ref[i] >= peak - DbToNats(30))
+      errors.within30Db = std::max(errors.within30Db, err);
+    if (ref[i] >= peak - DbToNats(40))
+      errors.within40Db = std::max(errors.within40Db, err);
+  }
+}
+
+static void Check(const char *name, Errors &errors) {
+  std::sort(errors.all.begin(), errors.all.end());
+  const float median = errors.all[errors.all.size() / 2];
+  printf("%s: max error %.3g within 30 dB, %.3g within 40 dB, %.3g overall, "
+         "median %.3g\n",
+         name, errors.within30Db, errors.within40Db, errors.all.back(),
+         median);
+  CHECK(errors.within30Db < 0.1f, "%s", name);
+  CHECK(errors.within40Db < 0.5f, "%s", name);
+  CHECK(median < 0.01f, "%s", name);
+}
+
+// Golden audio scaled by gain, saturated.
+static std::vector<int16_t> Scaled(float gain) {
+  const int len = (GOLDEN_FRAMES - 1) * GOLDEN_FRAME_SHIFT + GOLDEN_FRAME_LEN;
+  std::vector<int16_t> audio(len);
+  for (int i = 0; i < len; i++) {
+    const long x = lrintf(kGoldenAudio[i] * gain);
+    audio[i] = std::min<long>(std::max<long>(x, INT16_MIN), INT16_MAX);
+  }
+  return audio;
+}
+
+int main() {
+  using Arithmetic = AudioPreprocessor::Arithmetic;
+  AudioPreprocessor kwsFloat(KWS_MFCC, GOLDEN_FRAME_LEN, KWS_BINS,
+                             KWS_LOW_FREQ, KWS_HIGH_FREQ, Arithmetic::Float);
+  AudioPreprocessor kwsFixed(KWS_MFCC, GOLDEN_FRAME_LEN, KWS_BINS,
+                             KWS_LOW_FREQ, KWS_HIGH_FREQ, Arithmetic::Fixed);
+  AudioPreprocessor sedFloat(0, GOLDEN_FRAME_LEN, SED_BINS, SED_LOW_FREQ,
+                             SED_HIGH_FREQ, Arithmetic::Float);
+  AudioPreprocessor sedFixed(0, GOLDEN_FRAME_LEN, SED_BINS, SED_LOW_FREQ,
+                             SED_HIGH_FREQ, Arithmetic::Fixed);
+
+  // Close to full scale, the golden level, quiet speech and background.
+  static const float kGainsDb[] = {7.9f, 0.0f, -20.0f, -40.0f};
+  Errors kwsErrors, sedErrors;
+  float mfccError = 0.0f;
+  for (float gainDb : kGainsDb) {
+    const std::vector<int16_t> audio = Scaled(powf(10.0f, gainDb / 20.0f));
+    size_t peak = 0;
+    for (int16_t x : audio)
+      peak = std::max<size_t>(peak, abs(x));
+
+    for (int i = 0; i < GOLDEN_FRAMES; i++) {
+      const int16_t *frame = &audio[i * GOLDEN_FRAME_SHIFT];
+      float ref[KWS_BINS], fixed[KWS_BINS];
+      static_assert(SED_BINS <= KWS_BINS);
+
+      // KWS scales words to their peak, SED to full scale.
+      kwsFloat.LogMelCompute(frame, ref, peak);
+      kwsFixed.LogMelCompute(frame, fixed, peak);
+      Compare(ref, fixed, KWS_BINS, kwsErrors);
+      sedFloat.LogMelCompute(frame, ref, SED_MAX_ABS);
+      sedFixed.LogMelCompute(frame, fixed, SED_MAX_ABS);
+      Compare(ref, fixed, SED_BINS, sedErrors);
+
+      float mfccRef[KWS_MFCC], mfccFixed[KWS_MFCC];
+      kwsFloat.MfccCompute(frame, mfccRef, peak);
+      kwsFixed.MfccCompute(frame, mfccFixed, peak);
+      mfccError = std::max<float>(mfccError,
+                                  MaxAbsDiff(mfccRef, mfccFixed, KWS_MFCC));
+    }
+  }
+  Check("KWS log-mel", kwsErrors);
+  Check("SED log-mel", sedErrors);
+  printf("KWS MFCC: max error %.3g\n", mfccError);
+  CHECK(mfccError < 0.2f, "KWS MFCC");
+
+  // A silent frame gives the float path's log(FLT_MIN) everywhere.
+  const std::vector<int16_t> silence(GOLDEN_FRAME_LEN, 0);
+  float ref[SED_BINS], fixed[SED_BINS];
+  sedFloat.LogMelCompute(silence.data(), ref, SED_MAX_ABS);
+  sedFixed.LogMelCompute(silence.data(), fixed, SED_MAX_ABS);
+  CHECK(MaxAbsDiff(ref, fixed, SED_BINS) < 1e-3, "silence");
+  return HOST_TEST_RESULT();
+}
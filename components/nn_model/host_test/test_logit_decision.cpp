@@ -0,0 +1,356 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "host_test.h"
+#include "logit_decision.h"
+#include "ref_quant_math.h"
+
+/*
+ * QuantizedSoftmax and FloatSoftmax against transcriptions of TFLite's
+ * reference Softmax kernels (tensorflow/lite/kernels/internal/reference/
+ * softmax.h, with gemmlowp's fixed point and the Prepare of
+ * tensorflow/lite/micro/kernels/softmax_common.cc). Every output has to be
+ * equal, which makes the logit decision the Softmax one.
+ */
+
+namespace ref {
+
+// gemmlowp/fixedpoint/fixedpoint.h, scalar int32.
+template <int Exponent> int32_t SaturatingRoundingMultiplyByPOT(int32_t x) {
+  if constexpr (Exponent == 0) {
+    return x;
+  } else if constexpr (Exponent < 0) {
+    return RoundingDivideByPOT(x, -Exponent);
+  } else {
+    const int32_t min = std::numeric_limits<int32_t>::min();
+    const int32_t max = std::numeric_limits<int32_t>::max();
+    const int32_t threshold = ((1 << (32 - 1 - Exponent)) - 1);
+    if (x > threshold)
+      return max;
+    if (x < -threshold)
+      return min;
+    return static_cast<int32_t>(static_cast<uint32_t>(x) << Exponent);
+  }
+}
+
+template <int IntegerBits> struct FixedPoint {
+  static constexpr int kIntegerBits = IntegerBits;
+  static constexpr int kFractionalBits = 31 - IntegerBits;
+  int32_t raw;
+
+  static FixedPoint FromRaw(int32_t x) { return {x}; }
+  static FixedPoint Zero() { return {0}; }
+  static FixedPoint One() {
+    return {IntegerBits == 0 ? std::numeric_limits<int32_t>::max()
+                             : int32_t(1) << kFractionalBits};
+  }
+  template <int Exponent> static FixedPoint ConstantPOT() {
+    return {int32_t(1) << (kFractionalBits + Exponent)};
+  }
+};
+
+template <int A, int B>
+FixedPoint<A + B> operator*(FixedPoint<A> a, FixedPoint<B> b) {
+  return {SaturatingRoundingDoublingHighMul(a.raw, b.raw)};
+}
+template <int A> FixedPoint<A> operator+(FixedPoint<A> a, FixedPoint<A> b) {
+  return {a.raw + b.raw};
+}
+template <int A> FixedPoint<A> operator-(FixedPoint<A> a, FixedPoint<A> b) {
+  return {a.raw - b.raw};
+}
+template <int A> FixedPoint<A> operator&(FixedPoint<A> a, FixedPoint<A> b) {
+  return {a.raw & b.raw};
+}
+
+template <int Dst, int Src> FixedPoint<Dst> Rescale(FixedPoint<Src> x) {
+  return {SaturatingRoundingMultiplyByPOT<Src - Dst>(x.raw)};
+}
+
+template <int Exponent, int A>
+FixedPoint<A> SaturatingMulByPOT(FixedPoint<A> x) {
+  return {SaturatingRoundingMultiplyByPOT<Exponent>(x.raw)};
+}
+
+template <int Exponent, int A>
+FixedPoint<A + Exponent> ExactMulByPot(FixedPoint<A> a) {
+  return {a.raw};
+}
+
+FixedPoint<0>
+exp_on_interval_between_negative_one_quarter_and_0_excl(FixedPoint<0> a) {
+  typedef FixedPoint<0> F;
+  const F constant_term = F::FromRaw(1895147668);
+  const F constant_1_over_3 = F::FromRaw(715827883);
+  F x = a + F::ConstantPOT<-3>();
+  F x2 = x * x;
+  F x3 = x2 * x;
+  F x4 = x2 * x2;
+  F x4_over_4 = SaturatingMulByPOT<-2>(x4);
+  F x4_over_24_plus_x3_over_6_plus_x2_over_2 =
+    SaturatingMulByPOT<-1>(((x4_over_4 + x3) * constant_1_over_3) + x2);
+  return constant_term +
+         constant_term * (x + x4_over_24_plus_x3_over_6_plus_x2_over_2);
+}
+
+template <int IntegerBits>
+FixedPoint<0> exp_on_negative_values(FixedPoint<IntegerBits> a) {
+  typedef FixedPoint<IntegerBits> InputF;
+  typedef FixedPoint<0> ResultF;
+  constexpr int kFractionalBits = InputF::kFractionalBits;
+  constexpr int kIntegerBits = InputF::kIntegerBits;
+  const InputF kOneQuarter = InputF::template ConstantPOT<-2>();
+  InputF mask = kOneQuarter - InputF::FromRaw(1);
+  InputF a_mod_quarter_minus_one_quarter = (a & mask) - kOneQuarter;
+  ResultF result = exp_on_interval_between_negative_one_quarter_and_0_excl(
+    Rescale<0>(a_mod_quarter_minus_one_quarter));
+  int32_t remainder = (a_mod_quarter_minus_one_quarter - a).raw;
+
+#define EXP_BARREL_SHIFTER(Exponent, FixedPointMultiplier)                     \
+  if (kIntegerBits > Exponent) {                                               \
+    const ResultF kMultiplier = ResultF::FromRaw(FixedPointMultiplier);        \
+    constexpr int kShiftAmount =                                               \
+      kIntegerBits > Exponent ? kFractionalBits + Exponent : 0;                \
+    if (remainder & (1 << kShiftAmount))                                       \
+      result = result * kMultiplier;                                           \
+  }
+
+  EXP_BARREL_SHIFTER(-2, 1672461947);
+  EXP_BARREL_SHIFTER(-1, 1302514674);
+  EXP_BARREL_SHIFTER(+0, 790015084);
+  EXP_BARREL_SHIFTER(+1, 290630308);
+  EXP_BARREL_SHIFTER(+2, 39332535);
+  EXP_BARREL_SHIFTER(+3, 720401);
+  EXP_BARREL_SHIFTER(+4, 242);
+
+#undef EXP_BARREL_SHIFTER
+
+  if (a.raw == 0)
+    result = ResultF::One();
+  return result;
+}
+
+FixedPoint<0> one_over_one_plus_x_for_x_in_0_1(FixedPoint<0> a) {
+  typedef FixedPoint<0> F0;
+  typedef FixedPoint<2> F2;
+  const int64_t sum = int64_t(a.raw) + F0::One().raw;
+  const int64_t sign = sum >= 0 ? 1 : -1;
+  F0 half_denominator = F0::FromRaw(static_cast<int32_t>((sum + sign) / 2));
+  const F2 constant_48_over_17 = F2::FromRaw(1515870810);
+  const F2 constant_neg_32_over_17 = F2::FromRaw(-1010580540);
+  F2 x = constant_48_over_17 + half_denominator * constant_neg_32_over_17;
+  for (int i = 0; i < 3; i++) {
+    F2 half_denominator_times_x = half_denominator * x;
+    F2 one_minus_half_denominator_times_x =
+      F2::One() - half_denominator_times_x;
+    x = x + Rescale<2>(x * one_minus_half_denominator_times_x);
+  }
+  return Rescale<0>(ExactMulByPot<-1>(x));
+}
+
+// tensorflow/lite/kernels/internal/common.h and quantization_util.cc.
+int32_t GetReciprocal(int32_t x, int x_integer_digits,
+                      int *num_bits_over_unit) {
+  int headroom_plus_one = __builtin_clz(static_cast<uint32_t>(x));
+  *num_bits_over_unit = x_integer_digits - headroom_plus_one;
+  const int32_t shifted_sum_minus_one =
+    static_cast<int32_t>((static_cast<uint32_t>(x) << headroom_plus_one) -
+                         (static_cast<uint32_t>(1) << 31));
+  return one_over_one_plus_x_for_x_in_0_1(
+           FixedPoint<0>::FromRaw(shifted_sum_minus_one))
+    .raw;
+}
+
+int32_t MultiplyByQuantizedMultiplierGreaterThanOne(int32_t x,
+                                                    int32_t multiplier,
+                                                    int left_shift) {
+  return SaturatingRoundingDoublingHighMul(x * (1 << left_shift), multiplier);
+}
+
+int CalculateInputRadius(int input_integer_bits, int input_left_shift) {
+  const double max_input_rescaled = 1.0 * ((1 << input_integer_bits) - 1) *
+                                    (1ll << (31 - input_integer_bits)) /
+                                    (1ll << input_left_shift);
+  return static_cast<int>(std::floor(max_input_rescaled));
+}
+
+struct SoftmaxParams {
+  int32_t input_multiplier;
+  int input_left_shift;
+  int diff_min;
+};
+
+SoftmaxParams Prepare(float beta, float input_scale) {
+  constexpr int kScaledDiffIntegerBits = 5;
+  SoftmaxParams params;
+  const double input_beta_real_multiplier = std::min<double>(
+    static_cast<double>(beta) * static_cast<double>(input_scale) *
+      (1 << (31 - kScaledDiffIntegerBits)),
+    (1ll << 31) - 1.0);
+  QuantizeMultiplier(input_beta_real_multiplier, &params.input_multiplier,
+                     &params.input_left_shift);
+  params.diff_min =
+    -1.0 * CalculateInputRadius(kScaledDiffIntegerBits,
+                                params.input_left_shift);
+  return params;
+}
+
+void Softmax(const SoftmaxParams &params, const int8_t *input_data,
+             int depth, int8_t *output_data) {
+  static const int kScaledDiffIntegerBits = 5;
+  static const int kAccumulationIntegerBits = 12;
+  using FixedPointScaledDiff = FixedPoint<kScaledDiffIntegerBits>;
+  using FixedPointAccum = FixedPoint<kAccumulationIntegerBits>;
+  using FixedPoint0 = FixedPoint<0>;
+
+  int8_t max_in_row = std::numeric_limits<int8_t>::min();
+  for (int c = 0; c < depth; ++c)
+    max_in_row = std::max(max_in_row, input_data[c]);
+
+  FixedPointAccum sum_of_exps = FixedPointAccum::Zero();
+  for (int c = 0; c < depth; ++c) {
+    int32_t input_diff = static_cast<int32_t>(input_data[c]) - max_in_row;
+    if (input_diff >= params.diff_min) {
+      const int32_t input_diff_rescaled =
+        MultiplyByQuantizedMultiplierGreaterThanOne(
+          input_diff, params.input_multiplier, params.input_left_shift);
+      const FixedPointScaledDiff scaled_diff_f8 =
+        FixedPointScaledDiff::FromRaw(input_diff_rescaled);
+      sum_of_exps = sum_of_exps + Rescale<kAccumulationIntegerBits>(
+                                    exp_on_negative_values(scaled_diff_f8));
+    }
+  }
+
+  int num_bits_over_unit;
+  FixedPoint0 shifted_scale = FixedPoint0::FromRaw(GetReciprocal(
+    sum_of_exps.raw, kAccumulationIntegerBits, &num_bits_over_unit));
+
+  for (int c = 0; c < depth; ++c) {
+    int32_t input_diff = static_cast<int32_t>(input_data[c]) - max_in_row;
+    if (input_diff >= params.diff_min) {
+      const int32_t input_diff_rescaled =
+        MultiplyByQuantizedMultiplierGreaterThanOne(
+          input_diff, params.input_multiplier, params.input_left_shift);
+      const FixedPointScaledDiff scaled_diff_f8 =
+        FixedPointScaledDiff::FromRaw(input_diff_rescaled);
+      FixedPoint0 exp_in_0 = exp_on_negative_values(scaled_diff_f8);
+      int32_t unsat_output = RoundingDivideByPOT(
+        (shifted_scale * exp_in_0).raw, num_bits_over_unit + 31 - 8);
+      const int32_t shifted_output = unsat_output - 128;
+      output_data[c] = static_cast<int8_t>(
+        std::max(std::min(shifted_output, int32_t(127)), int32_t(-128)));
+    } else {
+      output_data[c] = -128;
+    }
+  }
+}
+
+void Softmax(float beta, const float *input_data, int depth,
+             float *output_data) {
+  float max = std::numeric_limits<float>::lowest();
+  for (int c = 0; c < depth; ++c)
+    max = std::max(max, input_data[c]);
+  float sum = 0.f;
+  for (int c = 0; c < depth; ++c) {
+    const float exp_c = std::exp((input_data[c] - max) * beta);
+    output_data[c] = exp_c;
+    sum += exp_c;
+  }
+  for (int c = 0; c < depth; ++c)
+    output_data[c] = output_data[c] / sum;
+}
+
+} // namespace ref
+
+#define MAX_CLASSES 16
+
+// Every output of random rows, ties and extreme logits included.
+static void TestQuantized(float beta, float scale, std::mt19937 &rng) {
+  const ref::SoftmaxParams params = ref::Prepare(beta, scale);
+  QuantizedSoftmax softmax(beta, scale);
+  CHECK(softmax.supported(), "beta %g, scale %g", beta, scale);
+
+  std::uniform_int_distribution<int> classes(1, MAX_CLASSES);
+  std::uniform_int_distribution<int> logit(INT8_MIN, INT8_MAX);
+  std::uniform_int_distribution<int> spread(1, 256);
+  int mismatches = 0;
+  for (int row = 0; row < 20000; row++) {
+    const int num = classes(rng);
+    // Narrow rows for close logits and ties, wide ones for skipped classes.
+    const int width = spread(rng);
+    const int base = std::uniform_int_distribution<int>(
+      INT8_MIN, INT8_MAX - width + 1)(rng);
+    int8_t logits[MAX_CLASSES], expected[MAX_CLASSES];
+    for (int i = 0; i < num; i++)
+      logits[i] = row % 7 ? base + logit(rng) % width
+                          : static_cast<int8_t>(logit(rng));
+    ref::Softmax(params, logits, num, expected);
+    softmax.prepare(logits, num);
+    for (int i = 0; i < num; i++)
+      mismatches += softmax.output(logits[i]) != expected[i];
+  }
+  printf("QuantizedSoftmax beta %g, scale %g: %d mismatches\n", beta, scale,
+         mismatches);
+  CHECK(mismatches == 0, "beta %g, scale %g", beta, scale);
+}
+
+// Every pair of logits of a two class model.
+static void TestPairs(float beta, float scale) {
+  const ref::SoftmaxParams params = ref::Prepare(beta, scale);
+  QuantizedSoftmax softmax(beta, scale);
+  int mismatches = 0;
+  for (int a = INT8_MIN; a <= INT8_MAX; a++) {
+    for (int b = INT8_MIN; b <= INT8_MAX; b++) {
+      const int8_t logits[2] = {static_cast<int8_t>(a),
+                                static_cast<int8_t>(b)};
+      int8_t expected[2];
+      ref::Softmax(params, logits, 2, expected);
+      softmax.prepare(logits, 2);
+      mismatches += softmax.output(logits[0]) != expected[0] ||
+                    softmax.output(logits[1]) != expected[1];
+    }
+  }
+  printf("QuantizedSoftmax pairs, beta %g, scale %g: %d mismatches\n", beta,
+         scale, mismatches);
+  CHECK(mismatches == 0, "pairs, beta %g, scale %g", beta, scale);
+}
+
+static void TestFloat(float beta, std::mt19937 &rng) {
+  FloatSoftmax softmax(beta);
+  std::uniform_int_distribution<int> classes(1, MAX_CLASSES);
+  std::normal_distribution<float> logit(0.f, 4.f);
+  int mismatches = 0;
+  for (int row = 0; row < 20000; row++) {
+    const int num = classes(rng);
+    float logits[MAX_CLASSES], expected[MAX_CLASSES];
+    for (int i = 0; i < num; i++)
+      logits[i] = row % 5 ? logit(rng) : std::round(logit(rng));
+    ref::Softmax(beta, logits, num, expected);
+    softmax.prepare(logits, num);
+    for (int i = 0; i < num; i++)
+      mismatches += softmax.output(logits[i]) != expected[i];
+  }
+  printf("FloatSoftmax beta %g: %d mismatches\n", beta, mismatches);
+  CHECK(mismatches == 0, "beta %g", beta);
+}
+
+int main() {
+  std::mt19937 rng(2024);
+  // Logit scales of small and large dynamic range, up to one where
+  // Softmax only keeps the top logit.
+  static const float kScales[] = {0.0123f, 0.0625f, 0.1f, 0.171f, 0.5f, 1.3f};
+  static const float kBetas[] = {1.f, 0.5f, 2.f};
+  for (float beta : kBetas) {
+    for (float scale : kScales)
+      TestQuantized(beta, scale, rng);
+    TestFloat(beta, rng);
+  }
+  TestPairs(1.f, 0.0625f);
+  TestPairs(1.f, 0.171f);
+  return HOST_TEST_RESULT();
+}
@@ -0,0 +1,114 @@
+#ifndef _LOGIT_DECISION_H_
+#define _LOGIT_DECISION_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "quant_math.h"
+
+/*
+ * Softmax outputs recomputed from the logits of a row, for
+ * CONFIG_NN_MODEL_LOGIT_DECISION. Both classes reproduce TFLite's reference
+ * Softmax bit for bit (the esp-nn int8 kernel takes the same fixed-point
+ * steps), so deciding on them is deciding on the Softmax output.
+ */
+
+// int8 Softmax of int8 logits, with exp() of every logit distance to the
+// top one tabulated at construction.
+class QuantizedSoftmax {
+public:
+  QuantizedSoftmax(float beta, float logit_scale) {
+    // Softmax Prepare: the distances are rescaled to Q5.26 by beta * scale.
+    constexpr int kScaledDiffIntegerBits = 5;
+    const double real_multiplier = std::min<double>(
+      static_cast<double>(beta) * static_cast<double>(logit_scale) *
+        (1 << (31 - kScaledDiffIntegerBits)),
+      (1ll << 31) - 1.0);
+    quant_math::QuantizeMultiplier(real_multiplier, &multiplier_,
+                                   &left_shift_);
+    const double radius = std::floor(
+      1.0 * ((1 << kScaledDiffIntegerBits) - 1) *
+      (1ll << (31 - kScaledDiffIntegerBits)) / (1ll << left_shift_));
+    const int32_t diff_min = -static_cast<int32_t>(radius);
+
+    // Softmax skips the distances below diff_min, a 0 exp does the same.
+    for (int d = 0; d <= UINT8_MAX; d++) {
+      exp_[d] =
+        supported() && -d >= diff_min
+          ? quant_math::ExpOnNegativeValues(
+              quant_math::SaturatingRoundingDoublingHighMul(
+                static_cast<int32_t>(-d * (1ll << left_shift_)),
+                multiplier_))
+          : 0;
+    }
+  }
+
+  // Softmax Prepare rejects beta * scale below 2^-26.
+  bool supported() const { return left_shift_ >= 0; }
+
+  // Sum the exps of a row of logits and take its reciprocal.
+  void prepare(const int8_t *logits, size_t num) {
+    max_ = std::numeric_limits<int8_t>::min();
+    for (size_t i = 0; i < num; i++)
+      max_ = std::max(max_, logits[i]);
+    // Q12.19 accumulator.
+    int32_t sum = 0;
+    for (size_t i = 0; i < num; i++)
+      sum += quant_math::RoundingDivideByPOT(exp_[max_ - logits[i]], 12);
+    const int headroom_plus_one = __builtin_clz(static_cast<uint32_t>(sum));
+    bits_over_unit_ = 12 - headroom_plus_one;
+    const int32_t shifted_sum_minus_one = static_cast<int32_t>(
+      (static_cast<uint32_t>(sum) << headroom_plus_one) - (1u << 31));
+    reciprocal_ = quant_math::OneOverOnePlusX(shifted_sum_minus_one);
+  }
+
+  // Softmax output of a logit of the prepared row, zero point -128 and
+  // scale 1 / 256.
+  int8_t output(int8_t logit) const {
+    const int32_t out = quant_math::RoundingDivideByPOT(
+      quant_math::SaturatingRoundingDoublingHighMul(reciprocal_,
+                                                    exp_[max_ - logit]),
+      bits_over_unit_ + 31 - 8);
+    return std::min<int32_t>(std::max<int32_t>(out + INT8_MIN, INT8_MIN),
+                             INT8_MAX);
+  }
+
+private:
+  int32_t multiplier_;
+  int left_shift_;
+  // exp(-beta * scale * d) in Q0.31 per distance d.
+  int32_t exp_[UINT8_MAX + 1];
+  int8_t max_;
+  // 1 / sum in Q0.31, times 2^-bits_over_unit_.
+  int32_t reciprocal_;
+  int bits_over_unit_;
+};
+
+// Float Softmax of float logits.
+class FloatSoftmax {
+public:
+  explicit FloatSoftmax(float beta = 1.f) : beta_(beta) {}
+
+  void prepare(const float *logits, size_t num) {
+    max_ = std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < num; i++)
+      max_ = std::max(max_, logits[i]);
+    sum_ = 0.f;
+    for (size_t i = 0; i < num; i++)
+      sum_ += std::exp((logits[i] - max_) * beta_);
+  }
+
+  float output(float logit) const {
+    return std::exp((logit - max_) * beta_) / sum_;
+  }
+
+private:
+  float beta_;
+  float max_;
+  float sum_;
+};
+
+#endif // _LOGIT_DECISION_H_
@@ -0,0 +1,166 @@
+#include "model_pack.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include "esp_partition.h"
+#endif
+
+static constexpr uint32_t kMagic = 0x504d4e4e; // "NNMP"
+static constexpr uint16_t kVersion = 1;
+static constexpr size_t kHeaderSize = 16;
+static constexpr size_t kEntrySize = 56;
+static constexpr size_t kNameLen = 32;
+
+static std::mutex s_mutex;
+
+static uint32_t read_u32(const uint8_t *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+
+static uint16_t read_u16(const uint8_t *p) { return p[0] | p[1] << 8; }
+
+// zlib CRC-32, a nibble at a time: the pack is only checked at init.
+static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len) {
+  static const uint32_t table[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
+    0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+    0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    crc = (crc >> 4) ^ table[crc & 0xf];
+    crc = (crc >> 4) ^ table[crc & 0xf];
+  }
+  return ~crc;
+}
+
+int ModelPack::map() {
+  if (data_) {
+    return 0;
+  }
+#if CONFIG_IDF_TARGET_LINUX
+  const int fd = open(CONFIG_NN_MODEL_PACK_FILE, O_RDONLY);
+  if (fd < 0) {
+    ESP_LOGE(__FUNCTION__, "unable to open %s", CONFIG_NN_MODEL_PACK_FILE);
+    return -1;
+  }
+  struct stat st;
+  void *ptr = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (ptr == MAP_FAILED) {
+    ESP_LOGE(__FUNCTION__, "unable to map %s", CONFIG_NN_MODEL_PACK_FILE);
+    return -1;
+  }
+  size_ = st.st_size;
+#else
+  const esp_partition_t *partition =
+    esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                             CONFIG_NN_MODEL_PACK_PARTITION);
+  if (!partition) {
+    ESP_LOGE(__FUNCTION__, "no %s partition", CONFIG_NN_MODEL_PACK_PARTITION);
+    return -1;
+  }
+  // The mapping lives as long as the application.
+  const void *ptr = NULL;
+  esp_partition_mmap_handle_t handle;
+  if (esp_partition_mmap(partition, 0, partition->size,
+                         ESP_PARTITION_MMAP_DATA, &ptr, &handle) != ESP_OK) {
+    ESP_LOGE(__FUNCTION__, "unable to map %s partition",
+             CONFIG_NN_MODEL_PACK_PARTITION);
+    return -1;
+  }
+  size_ = partition->size;
+#endif
+  data_ = static_cast<const uint8_t *>(ptr);
+  return 0;
+}
+
+int ModelPack::find(const char *name, Model *model) {
+  ModelPack &instance = getInstance();
+  std::lock_guard<std::mutex> lock(s_mutex);
+  if (instance.map() < 0) {
+    return -1;
+  }
+  const uint8_t *data = instance.data_;
+  const size_t size = instance.size_;
+
+  if (size < kHeaderSize || read_u32(data) != kMagic ||
+      read_u16(&data[4]) != kVersion) {
+    ESP_LOGE(__FUNCTION__, "no model pack v%d found", kVersion);
+    return -1;
+  }
+  const size_t count = read_u16(&data[6]);
+  if (kHeaderSize + count * kEntrySize > size ||
+      crc32(0, &data[kHeaderSize], count * kEntrySize) != read_u32(&data[8])) {
+    ESP_LOGE(__FUNCTION__, "corrupted model pack table");
+    return -1;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    const uint8_t *entry = &data[kHeaderSize + i * kEntrySize];
+    if (strncmp(reinterpret_cast<const char *>(entry), name, kNameLen)) {
+      continue;
+    }
+    const uint32_t model_offset = read_u32(&entry[kNameLen]);
+    const uint32_t model_size = read_u32(&entry[kNameLen + 4]);
+    const uint32_t labels_offset = read_u32(&entry[kNameLen + 8]);
+    const uint32_t labels_size = read_u32(&entry[kNameLen + 12]);
+    const uint32_t labels_num = read_u32(&entry[kNameLen + 16]);
+    const uint32_t crc = read_u32(&entry[kNameLen + 20]);
+    if (model_offset > size || model_size > size - model_offset ||
+        labels_offset > size || labels_size > size - labels_offset ||
+        (labels_num &&
+         (!labels_size || data[labels_offset + labels_size - 1]))) {
+      ESP_LOGE(__FUNCTION__, "model %s: bad entry", name);
+      return -1;
+    }
+    const uint32_t actual_crc =
+      crc32(crc32(0, &data[model_offset], model_size), &data[labels_offset],
+            labels_size);
+    if (actual_crc != crc) {
+      ESP_LOGE(__FUNCTION__,
+               "model %s: CRC %08" PRIx32 ", expected %08" PRIx32, name,
+               actual_crc, crc);
+      return -1;
+    }
+
+    model->data = &data[model_offset];
+    model->size = model_size;
+    model->labels = NULL;
+    model->labels_num = 0;
+    if (labels_num) {
+      model->labels = new (std::nothrow) const char *[labels_num];
+      if (!model->labels) {
+        ESP_LOGE(__FUNCTION__, "unable to allocate labels");
+        return -1;
+      }
+      // Strings are NUL separated, the last one is terminated.
+      const char *label = reinterpret_cast<const char *>(&data[labels_offset]);
+      const char *end = label + labels_size;
+      for (; model->labels_num < labels_num && label < end;
+           label += strlen(label) + 1) {
+        model->labels[model->labels_num++] = label;
+      }
+    }
+    ESP_LOGI(__FUNCTION__, "model %s: %" PRIu32 " bytes, %u labels", name,
+             model_size, model->labels_num);
+    return 0;
+  }
+  ESP_LOGE(__FUNCTION__, "model %s not in the pack", name);
+  return -1;
+}
@@ -0,0 +1,51 @@
+#ifndef _MODEL_PACK_H_
+#define _MODEL_PACK_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Models stored outside of the application image, in a pack built by
+ * tools/pack_models.py. The pack is memory mapped once and models are used in
+ * place: from the data partition CONFIG_NN_MODEL_PACK_PARTITION on the
+ * target, from the file CONFIG_NN_MODEL_PACK_FILE on Linux builds.
+ *
+ * Layout, little endian, offsets from the start of the pack:
+ * - header: magic "NNMP", u16 version, u16 entry count, u32 CRC-32 of the
+ *   entry table, u32 reserved;
+ * - entries: char name[32] (NUL terminated), u32 model offset (16 byte
+ *   aligned), u32 model size, u32 labels offset, u32 labels size, u32 labels
+ *   count, u32 CRC-32 of the model then the labels;
+ * - data: .tflite flatbuffers and NUL separated label strings.
+ * CRC-32 is the zlib one.
+ */
+class ModelPack {
+public:
+  struct Model {
+    const unsigned char *data;
+    size_t size;
+    // Allocated with new[], pointing into the pack, NULL without labels.
+    const char **labels;
+    unsigned int labels_num;
+  };
+
+  // Look a model up by name, mapping the pack on first use. The model and
+  // its labels are checked against the entry CRC.
+  static int find(const char *name, Model *model);
+
+  ModelPack(ModelPack const &) = delete;
+  void operator=(ModelPack const &) = delete;
+
+private:
+  static ModelPack &getInstance() {
+    static ModelPack instance;
+    return instance;
+  }
+  ModelPack() : data_(nullptr), size_(0) {}
+  int map();
+
+  const uint8_t *data_;
+  size_t size_;
+};
+
+#endif // _MODEL_PACK_H_
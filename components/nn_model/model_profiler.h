@@ -0,0 +1,136 @@
+#ifndef _MODEL_PROFILER_H_
+#define _MODEL_PROFILER_H_
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_cpu.h"
+#include "sdkconfig.h"
+
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+/*
+ * CPU cycles per layer accumulated over invocations. The interpreter opens
+ * one event per op in execution order, so the n-th event of an invocation is
+ * layer n. Dump() prints the layers and a summary per op type, as a table or
+ * CSV.
+ */
+class ModelProfiler : public tflite::MicroProfilerInterface {
+public:
+  static constexpr size_t kMaxLayers = 64;
+
+  ModelProfiler() { Reset(); }
+
+  void Reset() {
+    memset(layers_, 0, sizeof(layers_));
+    layers_num_ = 0;
+    invocations_ = 0;
+    next_layer_ = 0;
+  }
+
+  // Called before each Invoke(), events restart from the first layer.
+  void StartInvoke() {
+    invocations_++;
+    next_layer_ = 0;
+  }
+
+  uint32_t BeginEvent(const char *tag) override {
+    const uint32_t idx = next_layer_++;
+    if (idx >= kMaxLayers)
+      return idx;
+    Layer &layer = layers_[idx];
+    layer.tag = tag;
+    layer.calls++;
+    layers_num_ = std::max(layers_num_, idx + 1);
+    layer.start = esp_cpu_get_cycle_count();
+    return idx;
+  }
+
+  void EndEvent(uint32_t event_handle) override {
+    const uint32_t end = esp_cpu_get_cycle_count();
+    if (event_handle >= kMaxLayers)
+      return;
+    Layer &layer = layers_[event_handle];
+    // Unsigned difference survives one wrap of the 32-bit counter.
+    layer.cycles += static_cast<uint32_t>(end - layer.start);
+  }
+
+  void Dump(const char *name, bool csv) const {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < layers_num_; i++)
+      total += layers_[i].cycles;
+    if (!invocations_ || !total) {
+      printf("%s: no invocations profiled\n", name);
+      return;
+    }
+
+    if (csv) {
+      printf("model,layer,op,calls,cycles,cycles_per_call\n");
+    } else {
+      printf("%s: %" PRIu32 " invocations, %" PRIu64 " cycles/invoke "
+             "(%.1f us @ %d MHz)\n",
+             name, invocations_, total / invocations_,
+             static_cast<float>(total) / invocations_ / kCpuMhz, kCpuMhz);
+      printf("%5s  %-20s %12s %10s %6s\n", "layer", "op", "cycles/call",
+             "us/call", "%");
+    }
+    for (uint32_t i = 0; i < layers_num_; i++) {
+      PrintRow(name, i, layers_[i].tag, layers_[i].calls, layers_[i].cycles,
+               total, csv);
+    }
+
+    // Summary per op type, tags are interned op names.
+    if (!csv)
+      printf("%5s  %-20s %12s %10s %6s\n", "", "op type", "cycles/inv",
+             "us/inv", "%");
+    bool done[kMaxLayers] = {false};
+    for (uint32_t i = 0; i < layers_num_; i++) {
+      if (done[i])
+        continue;
+      uint64_t cycles = 0;
+      for (uint32_t j = i; j < layers_num_; j++) {
+        if (!done[j] && !strcmp(layers_[j].tag, layers_[i].tag)) {
+          cycles += layers_[j].cycles;
+          done[j] = true;
+        }
+      }
+      PrintRow(name, -1, layers_[i].tag, invocations_, cycles, total, csv);
+    }
+  }
+
+private:
+  struct Layer {
+    const char *tag;
+    uint32_t calls;
+    uint32_t start;
+    uint64_t cycles;
+  };
+
+  static constexpr int kCpuMhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+
+  // layer < 0 for an op type summary row.
+  static void PrintRow(const char *name, int layer, const char *tag,
+                       uint32_t calls, uint64_t cycles, uint64_t total,
+                       bool csv) {
+    const uint64_t per_call = calls ? cycles / calls : 0;
+    if (csv) {
+      printf("%s,%d,%s,%" PRIu32 ",%" PRIu64 ",%" PRIu64 "\n", name, layer,
+             tag, calls, cycles, per_call);
+    } else if (layer < 0) {
+      printf("%5s  %-20s %12" PRIu64 " %10.1f %6.1f\n", "", tag, per_call,
+             static_cast<float>(per_call) / kCpuMhz, 100.0f * cycles / total);
+    } else {
+      printf("%5d  %-20s %12" PRIu64 " %10.1f %6.1f\n", layer, tag, per_call,
+             static_cast<float>(per_call) / kCpuMhz, 100.0f * cycles / total);
+    }
+  }
+
+  Layer layers_[kMaxLayers];
+  uint32_t layers_num_;
+  uint32_t invocations_;
+  uint32_t next_layer_;
+};
+
+#endif // _MODEL_PROFILER_H_
@@ -0,0 +1,372 @@
+#include "nn_engine.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+#define NN_ENGINE_BUFFERS_NUM 2
+#define NN_ENGINE_STACK_SIZE  (configMINIMAL_STACK_SIZE + 1024 * 8)
+
+// Buffer index of the request stopping the engine task.
+static constexpr uint8_t kStopRequest = UINT8_MAX;
+
+struct nn_engine_request_t {
+  uint8_t buffer;
+  uint32_t id;
+  int64_t submit_time;
+  // Clear the model states before running the request.
+  bool reset;
+};
+
+struct nn_engine_model_t {
+  nn_model_handle_t handle;
+  // Models with another input quantization than the buffers get a
+  // requantized copy.
+  bool requant;
+  float requant_scale;
+  int32_t zero_point;
+  // Running inference time estimate for the scheduler.
+  int64_t cost_us;
+};
+
+struct __nn_engine_t {
+  nn_engine_config_t cfg;
+  nn_engine_model_t models[NN_ENGINE_MODELS_MAX];
+  // Input of models[0], which buffers are laid out as unless float_input,
+  // with the producer quantization.
+  nn_model_tensor_t input;
+  size_t input_len;
+  size_t buffer_bytes;
+  // The input tensor of the model only with in_place.
+  uint8_t *buffers[NN_ENGINE_BUFFERS_NUM];
+  size_t buffers_num;
+  int8_t *requant_buffer;
+  // Indexes of the buffers available to producers.
+  QueueHandle_t free_queue;
+  QueueHandle_t request_queue;
+  QueueHandle_t result_queue;
+  bool own_result_queue;
+  TaskHandle_t task_handle;
+  TaskHandle_t release_task;
+  uint32_t next_id;
+  // The next submitted request resets the model states, producer side.
+  bool reset_next;
+  // Model the next request starts from.
+  size_t next;
+};
+
+typedef __nn_engine_t *__nn_engine_handle_t;
+
+static int run_model(__nn_engine_handle_t engine, nn_engine_model_t *model,
+                     const uint8_t *buffer, int *category) {
+  const nn_model_tensor_t &input = engine->input;
+  if (engine->cfg.in_place) {
+    return nn_model_invoke(model->handle, category);
+  }
+  if (engine->cfg.float_input || input.type == NN_MODEL_TENSOR_FLOAT32) {
+    return nn_model_inference(model->handle,
+                              reinterpret_cast<const float *>(buffer),
+                              engine->input_len, category);
+  }
+  const int8_t *data = reinterpret_cast<const int8_t *>(buffer);
+  if (model->requant) {
+    for (size_t i = 0; i < input.bytes; i++) {
+      const int32_t val =
+        lrintf((data[i] - input.zero_point) * model->requant_scale) +
+        model->zero_point;
+      engine->requant_buffer[i] =
+        std::min<int32_t>(std::max<int32_t>(val, INT8_MIN), INT8_MAX);
+    }
+    data = engine->requant_buffer;
+  }
+  return nn_model_inference_q(model->handle, data, input.bytes, category);
+}
+
+// Run the models on a buffer, round robin from where the previous request
+// stopped, until the next one would exceed the time budget. At least one
+// model runs per request.
+static void run_request(__nn_engine_handle_t engine, const uint8_t *buffer,
+                        nn_engine_result_t *result) {
+  const nn_engine_config_t &cfg = engine->cfg;
+  const int64_t start = esp_timer_get_time();
+  size_t ran = 0;
+  result->models_num = 0;
+  for (; ran < cfg.models_num; ran++) {
+    const size_t idx = (engine->next + ran) % cfg.models_num;
+    nn_engine_model_t *model = &engine->models[idx];
+    const int64_t t1 = esp_timer_get_time();
+    if (cfg.budget_us && ran && t1 - start + model->cost_us > cfg.budget_us)
+      break;
+
+    nn_engine_model_result_t *model_result =
+      &result->models[result->models_num];
+    model_result->model = idx;
+    model_result->category = -1;
+    model_result->scores_num = 0;
+    const int ret = run_model(engine, model, buffer, &model_result->category);
+    if (ret < 0) {
+      ESP_LOGE(__FUNCTION__, "model %d: inference error", idx);
+      continue;
+    }
+    model_result->gated = ret > 0;
+    result->models_num++;
+    if (model_result->gated) {
+      // Only full runs count towards the cost, the budget holds when the
+      // gate opens.
+      continue;
+    }
+    // Shared scratch outputs only last until the next model runs.
+    const int scores_num = nn_model_get_scores(
+      model->handle, model_result->scores, NN_ENGINE_SCORES_MAX);
+    model_result->scores_num = std::max(scores_num, 0);
+
+    const int64_t cost_us = esp_timer_get_time() - t1;
+    model->cost_us =
+      model->cost_us ? (3 * model->cost_us + cost_us) / 4 : cost_us;
+    ESP_LOGV(__FUNCTION__, "model %d: %lld us", idx, cost_us);
+  }
+  engine->next = (engine->next + ran) % cfg.models_num;
+}
+
+static void engine_task(void *pv) {
+  __nn_engine_handle_t engine = static_cast<__nn_engine_handle_t>(pv);
+  for (;;) {
+    nn_engine_request_t request;
+    xQueueReceive(engine->request_queue, &request, portMAX_DELAY);
+    if (request.buffer == kStopRequest)
+      break;
+
+    for (size_t i = 0; request.reset && i < engine->cfg.models_num; i++) {
+      if (nn_model_reset_state(engine->models[i].handle) < 0) {
+        ESP_LOGE(__FUNCTION__, "model %d: unable to reset state", i);
+      }
+    }
+
+    nn_engine_result_t result;
+    result.engine = engine;
+    result.request_id = request.id;
+    run_request(engine, engine->buffers[request.buffer], &result);
+    xQueueSend(engine->free_queue, &request.buffer, 0);
+
+    result.latency_us = esp_timer_get_time() - request.submit_time;
+    ESP_LOGD(__FUNCTION__, "request %u: %d models, %lld us", request.id,
+             result.models_num, result.latency_us);
+    // Producers are held back by the buffers, not the consumer.
+    xQueueSend(engine->result_queue, &result, portMAX_DELAY);
+  }
+  xTaskNotifyGive(engine->release_task);
+  vTaskDelete(NULL);
+}
+
+static void release_engine(__nn_engine_handle_t engine) {
+  if (engine->free_queue)
+    vQueueDelete(engine->free_queue);
+  if (engine->request_queue)
+    vQueueDelete(engine->request_queue);
+  if (engine->own_result_queue && engine->result_queue)
+    vQueueDelete(engine->result_queue);
+  for (size_t i = 0; i < NN_ENGINE_BUFFERS_NUM && !engine->cfg.in_place; i++)
+    delete[] engine->buffers[i];
+  delete[] engine->requant_buffer;
+  delete engine;
+}
+
+static size_t tensor_len(const nn_model_tensor_t &tensor) {
+  return tensor.type == NN_MODEL_TENSOR_INT8 ? tensor.bytes
+                                             : tensor.bytes / sizeof(float);
+}
+
+static int init_models(__nn_engine_handle_t engine) {
+  const nn_engine_config_t &cfg = engine->cfg;
+  if (nn_model_get_input(cfg.models[0], &engine->input) < 0) {
+    return -1;
+  }
+  if (cfg.input_scale) {
+    engine->input.scale = cfg.input_scale;
+    engine->input.zero_point = cfg.input_zero_point;
+  }
+  engine->input_len = tensor_len(engine->input);
+  engine->buffer_bytes = cfg.float_input ? engine->input_len * sizeof(float)
+                                         : engine->input.bytes;
+  bool requant = false;
+  for (size_t i = 0; i < cfg.models_num; i++) {
+    nn_engine_model_t *model = &engine->models[i];
+    model->handle = cfg.models[i];
+    nn_model_tensor_t input;
+    if (nn_model_get_input(model->handle, &input) < 0) {
+      return -1;
+    }
+    // Float buffers are quantized per model, only the lengths have to match.
+    if ((!cfg.float_input && input.type != engine->input.type) ||
+        tensor_len(input) != engine->input_len) {
+      ESP_LOGE(__FUNCTION__, "model %d: input mismatch: type=%d, bytes=%d", i,
+               input.type, input.bytes);
+      return -1;
+    }
+    if (!cfg.float_input && input.type == NN_MODEL_TENSOR_INT8) {
+      model->zero_point = input.zero_point;
+      model->requant_scale = engine->input.scale / input.scale;
+      model->requant = input.scale != engine->input.scale ||
+                       input.zero_point != engine->input.zero_point;
+      requant |= model->requant;
+    }
+  }
+  if (cfg.in_place) {
+    if (cfg.models_num != 1 || cfg.float_input || requant ||
+        engine->input.type != NN_MODEL_TENSOR_INT8) {
+      ESP_LOGE(__FUNCTION__, "in place input needs a single int8 model");
+      return -1;
+    }
+    return 0;
+  }
+  if (requant) {
+    engine->requant_buffer = new (std::nothrow) int8_t[engine->input.bytes];
+    if (!engine->requant_buffer) {
+      ESP_LOGE(__FUNCTION__, "unable to allocate requant buffer");
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int nn_engine_create(nn_engine_handle_t *engine_handle,
+                     nn_engine_config_t cfg) {
+  if (cfg.models_num == 0 || cfg.models_num > NN_ENGINE_MODELS_MAX) {
+    ESP_LOGE(__FUNCTION__, "unsupported number of models %d", cfg.models_num);
+    return -1;
+  }
+  __nn_engine_handle_t engine = new (std::nothrow) __nn_engine_t();
+  if (!engine) {
+    ESP_LOGE(__FUNCTION__, "unable to allocate engine");
+    return -1;
+  }
+  engine->cfg = cfg;
+  if (init_models(engine) < 0) {
+    release_engine(engine);
+    return -1;
+  }
+
+  engine->buffers_num = cfg.in_place ? 1 : NN_ENGINE_BUFFERS_NUM;
+  engine->free_queue = xQueueCreate(engine->buffers_num, sizeof(uint8_t));
+  engine->request_queue =
+    xQueueCreate(NN_ENGINE_BUFFERS_NUM + 1, sizeof(nn_engine_request_t));
+  engine->own_result_queue = !cfg.result_queue;
+  engine->result_queue =
+    cfg.result_queue
+      ? cfg.result_queue
+      : xQueueCreate(NN_ENGINE_BUFFERS_NUM, sizeof(nn_engine_result_t));
+  if (!engine->free_queue || !engine->request_queue || !engine->result_queue) {
+    ESP_LOGE(__FUNCTION__, "unable to create engine queues");
+    release_engine(engine);
+    return -1;
+  }
+  for (uint8_t i = 0; i < engine->buffers_num; i++) {
+    engine->buffers[i] =
+      cfg.in_place ? static_cast<uint8_t *>(engine->input.data)
+                   : new (std::nothrow) uint8_t[engine->buffer_bytes]();
+    if (!engine->buffers[i]) {
+      ESP_LOGE(__FUNCTION__, "unable to allocate input buffers");
+      release_engine(engine);
+      return -1;
+    }
+    xQueueSend(engine->free_queue, &i, 0);
+  }
+
+  if (xTaskCreatePinnedToCore(engine_task, "nn_engine", NN_ENGINE_STACK_SIZE,
+                              engine, cfg.priority, &engine->task_handle,
+                              cfg.core_id) != pdPASS) {
+    ESP_LOGE(__FUNCTION__, "unable to create engine task");
+    release_engine(engine);
+    return -1;
+  }
+  ESP_LOGI(__FUNCTION__, "%d models, input %d bytes, core %d", cfg.models_num,
+           engine->buffer_bytes, cfg.core_id);
+  *engine_handle = engine;
+  return 0;
+}
+
+void nn_engine_release(nn_engine_handle_t engine_handle) {
+  if (!engine_handle) {
+    return;
+  }
+  __nn_engine_handle_t engine =
+    static_cast<__nn_engine_handle_t>(engine_handle);
+  // Let the task finish its request rather than deleting it in the middle of
+  // an inference, unblocking it when results are no longer consumed.
+  engine->release_task = xTaskGetCurrentTaskHandle();
+  const nn_engine_request_t request = {.buffer = kStopRequest};
+  xQueueSend(engine->request_queue, &request, portMAX_DELAY);
+  while (!ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10))) {
+    xQueueReset(engine->result_queue);
+  }
+  release_engine(engine);
+}
+
+void *nn_engine_get_buffer(nn_engine_handle_t engine_handle, TickType_t wait) {
+  if (!engine_handle) {
+    ESP_LOGE(__FUNCTION__, "nn engine is not initialized");
+    return NULL;
+  }
+  __nn_engine_handle_t engine =
+    static_cast<__nn_engine_handle_t>(engine_handle);
+  uint8_t idx;
+  if (xQueueReceive(engine->free_queue, &idx, wait) != pdPASS) {
+    return NULL;
+  }
+  return engine->buffers[idx];
+}
+
+int nn_engine_submit(nn_engine_handle_t engine_handle, void *buffer,
+                     uint32_t *request_id) {
+  if (!engine_handle) {
+    ESP_LOGE(__FUNCTION__, "nn engine is not initialized");
+    return -1;
+  }
+  __nn_engine_handle_t engine =
+    static_cast<__nn_engine_handle_t>(engine_handle);
+  const auto it = std::find(engine->buffers,
+                            engine->buffers + engine->buffers_num, buffer);
+  if (it == engine->buffers + engine->buffers_num) {
+    ESP_LOGE(__FUNCTION__, "not an engine buffer");
+    return -1;
+  }
+  const nn_engine_request_t request = {
+    .buffer = static_cast<uint8_t>(it - engine->buffers),
+    .id = engine->next_id++,
+    .submit_time = esp_timer_get_time(),
+    .reset = engine->reset_next};
+  engine->reset_next = false;
+  // A buffer is only submitted once taken, the queue always has room.
+  xQueueSend(engine->request_queue, &request, 0);
+  if (request_id) {
+    *request_id = request.id;
+  }
+  return 0;
+}
+
+int nn_engine_reset_state(nn_engine_handle_t engine_handle) {
+  if (!engine_handle) {
+    ESP_LOGE(__FUNCTION__, "nn engine is not initialized");
+    return -1;
+  }
+  static_cast<__nn_engine_handle_t>(engine_handle)->reset_next = true;
+  return 0;
+}
+
+int nn_engine_get_result(nn_engine_handle_t engine_handle,
+                         nn_engine_result_t *result, TickType_t wait) {
+  if (!engine_handle) {
+    ESP_LOGE(__FUNCTION__, "nn engine is not initialized");
+    return -1;
+  }
+  __nn_engine_handle_t engine =
+    static_cast<__nn_engine_handle_t>(engine_handle);
+  if (!engine->own_result_queue) {
+    ESP_LOGE(__FUNCTION__, "results go to the config queue");
+    return -1;
+  }
+  return xQueueReceive(engine->result_queue, result, wait) == pdPASS ? 0 : -1;
+}
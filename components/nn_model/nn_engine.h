@@ -0,0 +1,125 @@
+#ifndef _NN_ENGINE_H_
+#define _NN_ENGINE_H_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+#include "nn_model.h"
+
+/*
+ * Inference task owning a set of models. Producers take one of two input
+ * buffers, fill it and submit it: the next one can be filled while the
+ * engine infers the previous. An in_place engine has a single buffer. Every
+ * request runs the models on the same input and completes with an
+ * nn_engine_result_t.
+ */
+
+typedef void *nn_engine_handle_t;
+
+#define NN_ENGINE_MODELS_MAX 4
+#define NN_ENGINE_SCORES_MAX 16
+
+struct nn_engine_config_t {
+  /*! Models sharing the input of models[0]. */
+  nn_model_handle_t models[NN_ENGINE_MODELS_MAX];
+  size_t models_num;
+  /*! Quantization of int8 buffers as filled by the producer, every model
+   * with other input params gets a requantized copy. A 0 scale takes the
+   * input params of models[0]. */
+  float input_scale;
+  int32_t input_zero_point;
+  /*! Buffers hold floats whatever the input type, quantized for each model
+   * by nn_model_inference. */
+  bool float_input;
+  /*! Single model engines: the model input tensor is the only buffer. It
+   * saves copying the buffer into the tensor, but the producer can't fill
+   * the next one while the model runs. Only for int8 models that need no
+   * requantization and have a private arena, see nn_model_get_input. */
+  bool in_place;
+  /*! Inference time per request: models run round robin, starting where
+   * the previous request stopped, until the next would exceed it. At least
+   * one runs. 0 runs all of them. */
+  int64_t budget_us;
+  /*! Core of the engine task or tskNO_AFFINITY. */
+  BaseType_t core_id;
+  UBaseType_t priority;
+  /*! Queue of nn_engine_result_t, shared by engines or NULL for a private
+   * one. */
+  QueueHandle_t result_queue;
+};
+
+struct nn_engine_model_result_t {
+  /*! Index in nn_engine_config_t::models. */
+  size_t model;
+  int category;
+  /*! The model gate was closed, see nn_model_set_gate: no category and no
+   * scores. */
+  bool gated;
+  size_t scores_num;
+  float scores[NN_ENGINE_SCORES_MAX];
+};
+
+struct nn_engine_result_t {
+  nn_engine_handle_t engine;
+  uint32_t request_id;
+  /*! From submit to completion. */
+  int64_t latency_us;
+  /*! Models run for the request. */
+  size_t models_num;
+  nn_engine_model_result_t models[NN_ENGINE_MODELS_MAX];
+};
+
+/*!
+ * \brief Create an engine and start its task.
+ * \param engine_handle Engine handle.
+ * \param cfg Engine config.
+ * \return Result.
+ */
+int nn_engine_create(nn_engine_handle_t *engine_handle,
+                     nn_engine_config_t cfg);
+/*!
+ * \brief Stop the engine task and free the engine.
+ * \param engine_handle Engine handle.
+ */
+void nn_engine_release(nn_engine_handle_t engine_handle);
+/*!
+ * \brief Take a free input buffer, laid out as the input tensor of
+ * models[0] (see nn_model_get_input) or as floats with float_input.
+ * \param engine_handle Engine handle.
+ * \param wait Ticks to wait for a buffer.
+ * \return Buffer or NULL when all are in use.
+ */
+void *nn_engine_get_buffer(nn_engine_handle_t engine_handle, TickType_t wait);
+/*!
+ * \brief Queue inference of a buffer from nn_engine_get_buffer, which goes
+ * back to the engine.
+ * \param engine_handle Engine handle.
+ * \param buffer Filled input buffer.
+ * \param request_id Id of the request in its result, may be NULL.
+ * \return Result.
+ */
+int nn_engine_submit(nn_engine_handle_t engine_handle, void *buffer,
+                     uint32_t *request_id);
+/*!
+ * \brief Clear the states of the models (nn_model_reset_state) before the
+ * next submitted request runs, for a producer that dropped a step of
+ * streaming models. Requests already submitted run on the old state. Call
+ * it from the producer task.
+ * \param engine_handle Engine handle.
+ * \return Result.
+ */
+int nn_engine_reset_state(nn_engine_handle_t engine_handle);
+/*!
+ * \brief Wait for a completed request on the private result queue. It holds
+ * two results, the engine waits for room before taking the next request:
+ * read them before waiting for a buffer.
+ * \param engine_handle Engine handle.
+ * \param result Completed request.
+ * \param wait Ticks to wait.
+ * \return Result, -1 on timeout.
+ */
+int nn_engine_get_result(nn_engine_handle_t engine_handle,
+                         nn_engine_result_t *result, TickType_t wait);
+
+#endif // _NN_ENGINE_H_
@@ -3,16 +3,63 @@
 
 #include "string.h"
 
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <new>
+
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+#include "logit_decision.h"
+#endif
+#include "model_pack.h"
+#include "model_profiler.h"
 #include "nn_model.h"
 #include "tensor_arena.h"
 #include "tflite_op_resolver.h"
 
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
 
 struct __nn_model_t {
   tflite::MicroInterpreter *interpreter;
   nn_model_config_t cfg;
+  // Private arena or persistent region, see TensorArena.
+  uint8_t *arena;
+  bool shared_scratch;
+  size_t persistent_bytes;
+  size_t scratch_bytes;
+  // Labels array of a model from the pack.
+  const char **pack_labels;
+  // Variable tensors carry state from one inference to the next.
+  bool stateful;
+#if CONFIG_NN_MODEL_PROFILER
+  ModelProfiler *profiler;
+#endif
+  // inference_threshold in the int8 output domain: score > threshold is
+  // q > threshold_q.
+  int32_t threshold_q;
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  // The output holds the logits of the Softmax producing it, see
+  // TFLiteOpResolver.
+  bool logits;
+  float logit_scale;
+  int32_t logit_zero_point;
+  // Softmax of the last inference's logits, the scores derive from it.
+  QuantizedSoftmax *softmax_q;
+  FloatSoftmax softmax_f;
+#endif
+  // First stage of the cascade, see nn_model_set_gate.
+  bool gated;
+  nn_model_gate_t gate;
+  float *gate_weights;
+  // The linear gate score is gate_offset + gate_scale / rows *
+  // sum(weights[i] * gate_sums[i]), with the int8 sums of each feature over
+  // the rows of the input.
+  float gate_offset;
+  float gate_scale;
+  int32_t *gate_sums;
+  nn_model_gate_stats_t gate_stats;
 };
 
 typedef __nn_model_t *__nn_model_handle_t;
@@ -20,9 +67,12 @@ typedef __nn_model_t *__nn_model_handle_t;
 static void set_input(const float *src, TfLiteTensor *tensor, size_t len,
                       bool is_qnn) {
   if (is_qnn) {
+    const float inv_scale = 1.f / tensor->params.scale;
     for (int i = 0; i < len; i++) {
+      const int32_t val =
+        lrintf(src[i] * inv_scale) + tensor->params.zero_point;
       tensor->data.int8[i] =
-        (int8_t)(src[i] / tensor->params.scale + tensor->params.zero_point);
+        std::min<int32_t>(std::max<int32_t>(val, INT8_MIN), INT8_MAX);
     }
   } else {
     for (int i = 0; i < len; i++) {
@@ -31,21 +81,7 @@ static void set_input(const float *src, TfLiteTensor *tensor, size_t len,
   }
 }
 
-static void get_output(const TfLiteTensor *tensor, float *dst, size_t len,
-                       bool is_qnn) {
-  if (is_qnn) {
-    for (int i = 0; i < len; i++) {
-      dst[i] = (tensor->data.int8[i] - tensor->params.zero_point) *
-               tensor->params.scale;
-    }
-  } else {
-    for (int i = 0; i < len; i++) {
-      dst[i] = tflite::GetTensorData<float>(tensor)[i];
-    }
-  }
-}
-
-static size_t argmax(float *array, size_t len) {
+template <typename T> static size_t argmax(const T *array, size_t len) {
   size_t idx = 0;
   for (size_t i = 0; i < len; i++) {
     if (array[i] > array[idx])
@@ -54,44 +90,299 @@ static size_t argmax(float *array, size_t len) {
   return idx;
 }
 
+static void release_interpreter(__nn_model_handle_t __nn_model_handle) {
+  delete __nn_model_handle->interpreter;
+  __nn_model_handle->interpreter = NULL;
+}
+
+static void release_arena(__nn_model_handle_t __nn_model_handle) {
+  release_interpreter(__nn_model_handle);
+  if (__nn_model_handle->arena) {
+    TensorArena::release(__nn_model_handle->arena,
+                         __nn_model_handle->shared_scratch);
+    __nn_model_handle->arena = NULL;
+  }
+}
+
+static void release_handle(__nn_model_handle_t __nn_model_handle) {
+  release_arena(__nn_model_handle);
+  delete[] __nn_model_handle->pack_labels;
+  delete[] __nn_model_handle->gate_weights;
+  delete[] __nn_model_handle->gate_sums;
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  delete __nn_model_handle->softmax_q;
+#endif
+#if CONFIG_NN_MODEL_PROFILER
+  delete __nn_model_handle->profiler;
+#endif
+  free(__nn_model_handle);
+}
+
+// Build the interpreter over the first arena_size bytes of the arena
+// (persistent region only with a shared scratch). With measure, also measure
+// what it uses: the probe stays allocated, the interpreter has to be rebuilt.
+static int create_interpreter(__nn_model_handle_t __nn_model_handle,
+                              const tflite::Model *model, size_t arena_size,
+                              bool measure) {
+  tflite::MicroAllocator *allocator =
+    TensorArena::createAllocator(__nn_model_handle->arena, arena_size,
+                                 __nn_model_handle->shared_scratch);
+  if (!allocator) {
+    ESP_LOGE(__FUNCTION__, "unable to get tensor arena");
+    return -1;
+  }
+  // Build an interpreter to run the model with.
+#if CONFIG_NN_MODEL_PROFILER
+  __nn_model_handle->interpreter = new tflite::MicroInterpreter(
+    model, TFLiteOpResolver::getInstance(), allocator, nullptr,
+    __nn_model_handle->profiler);
+#else
+  __nn_model_handle->interpreter = new tflite::MicroInterpreter(
+    model, TFLiteOpResolver::getInstance(), allocator);
+#endif
+
+  // Allocate memory from the tensor_arena for the model's tensors. Kernels
+  // prepare in the scratch region, another model may be running in it.
+  std::unique_lock<std::mutex> lock(TensorArena::scratchLock(),
+                                    std::defer_lock);
+  if (__nn_model_handle->shared_scratch) {
+    lock.lock();
+  }
+  TfLiteStatus allocate_status =
+    __nn_model_handle->interpreter->AllocateTensors();
+  if (allocate_status != kTfLiteOk) {
+    ESP_LOGE(__FUNCTION__, "AllocateTensors() failed, arena %u bytes",
+             arena_size);
+    return -1;
+  }
+  if (!measure) {
+    return 0;
+  }
+
+  const size_t used_bytes = __nn_model_handle->interpreter->arena_used_bytes();
+  __nn_model_handle->persistent_bytes = TensorArena::persistentUsed(
+    allocator, __nn_model_handle->arena, arena_size);
+  __nn_model_handle->scratch_bytes =
+    used_bytes - std::min(used_bytes, __nn_model_handle->persistent_bytes);
+  ESP_LOGI(__FUNCTION__, "arena: %s %u, persistent %u, scratch %u bytes",
+           __nn_model_handle->shared_scratch ? "shared scratch" : "private",
+           arena_size, __nn_model_handle->persistent_bytes,
+           __nn_model_handle->scratch_bytes);
+  return 0;
+}
+
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+// Softmax is a copy in every model, it may only produce the output. Its
+// outputs are recomputed from the logits with the kernel's own arithmetic,
+// see logit_decision.h, so the decision is the one on the Softmax output.
+static int init_logits(__nn_model_handle_t __nn_model_handle,
+                       const tflite::Model *model,
+                       const nn_model_config_t &cfg) {
+  const tflite::SubGraph *subgraph = model->subgraphs()->Get(0);
+  const int32_t output_idx = subgraph->outputs()->Get(0);
+  const tflite::Operator *softmax = NULL;
+  size_t softmax_num = 0;
+  for (const tflite::Operator *op : *subgraph->operators()) {
+    const tflite::OperatorCode *code =
+      model->operator_codes()->Get(op->opcode_index());
+    if (tflite::GetBuiltinCode(code) != tflite::BuiltinOperator_SOFTMAX) {
+      continue;
+    }
+    softmax_num++;
+    if (op->outputs()->Get(0) == output_idx) {
+      softmax = op;
+    }
+  }
+  if (softmax_num != (softmax ? 1 : 0)) {
+    ESP_LOGE(__FUNCTION__, "Softmax only allowed on the model output");
+    return -1;
+  }
+  if (!softmax) {
+    return 0;
+  }
+
+  const tflite::SoftmaxOptions *options =
+    softmax->builtin_options_as_SoftmaxOptions();
+  const float beta = options ? options->beta() : 1.f;
+  if (cfg.is_quantized) {
+    const tflite::QuantizationParameters *quant =
+      subgraph->tensors()->Get(softmax->inputs()->Get(0))->quantization();
+    if (!quant || !quant->scale() || !quant->scale()->size()) {
+      ESP_LOGE(__FUNCTION__, "logits are not quantized");
+      return -1;
+    }
+    __nn_model_handle->logit_scale = quant->scale()->Get(0);
+    __nn_model_handle->logit_zero_point =
+      quant->zero_point() && quant->zero_point()->size()
+        ? quant->zero_point()->Get(0)
+        : 0;
+    __nn_model_handle->softmax_q = new (std::nothrow)
+      QuantizedSoftmax(beta, __nn_model_handle->logit_scale);
+    if (!__nn_model_handle->softmax_q) {
+      ESP_LOGE(__FUNCTION__, "unable to allocate Softmax table");
+      return -1;
+    }
+    if (!__nn_model_handle->softmax_q->supported()) {
+      ESP_LOGE(__FUNCTION__, "Softmax beta * scale %g too small",
+               beta * __nn_model_handle->logit_scale);
+      return -1;
+    }
+  } else {
+    __nn_model_handle->softmax_f = FloatSoftmax(beta);
+  }
+  __nn_model_handle->logits = true;
+  ESP_LOGI(__FUNCTION__, "logit decision: beta %.3f", beta);
+  return 0;
+}
+
+// Softmax output of a label from the last inference's logits, quantized
+// like the Softmax output for int8 models.
+static int8_t logit_output_q(const __nn_model_t *__nn_model_handle,
+                             size_t idx) {
+  const TfLiteTensor *output = __nn_model_handle->interpreter->output(0);
+  return __nn_model_handle->softmax_q->output(output->data.int8[idx]);
+}
+
+static float logit_output_f(const __nn_model_t *__nn_model_handle,
+                            size_t idx) {
+  const TfLiteTensor *output = __nn_model_handle->interpreter->output(0);
+  return __nn_model_handle->softmax_f.output(output->data.f[idx]);
+}
+#endif
+
+static float get_score(const __nn_model_t *__nn_model_handle, size_t idx) {
+  const TfLiteTensor *output = __nn_model_handle->interpreter->output(0);
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  if (__nn_model_handle->logits) {
+    if (__nn_model_handle->cfg.is_quantized) {
+      return (logit_output_q(__nn_model_handle, idx) -
+              output->params.zero_point) *
+             output->params.scale;
+    }
+    return logit_output_f(__nn_model_handle, idx);
+  }
+#endif
+  if (__nn_model_handle->cfg.is_quantized) {
+    return (output->data.int8[idx] - output->params.zero_point) *
+           output->params.scale;
+  }
+  return output->data.f[idx];
+}
+
 int nn_model_init(nn_model_handle_t *model_handle, nn_model_config_t cfg) {
   __nn_model_handle_t __nn_model_handle =
-    static_cast<__nn_model_handle_t>(malloc(sizeof(__nn_model_t)));
+    static_cast<__nn_model_handle_t>(calloc(1, sizeof(__nn_model_t)));
   if (!__nn_model_handle) {
     ESP_LOGW(__FUNCTION__, "unable to allocate model_handle");
     return -1;
   }
 
+  if (!cfg.model_ptr) {
+    ModelPack::Model packed;
+    if (!cfg.model_name || ModelPack::find(cfg.model_name, &packed) < 0) {
+      ESP_LOGE(__FUNCTION__, "model %s not found",
+               cfg.model_name ? cfg.model_name : "(null)");
+      free(__nn_model_handle);
+      return -1;
+    }
+    cfg.model_ptr = packed.data;
+    __nn_model_handle->pack_labels = packed.labels;
+    if (!cfg.labels) {
+      cfg.labels = packed.labels;
+      cfg.labels_num = packed.labels_num;
+    }
+  }
+
   const tflite::Model *model = tflite::GetModel(cfg.model_ptr);
   if (model->version() != TFLITE_SCHEMA_VERSION) {
     ESP_LOGE(
       __FUNCTION__,
       "Model provided is schema version %ld not equal to supported version %d",
       model->version(), TFLITE_SCHEMA_VERSION);
-    free(__nn_model_handle);
+    release_handle(__nn_model_handle);
     return -1;
   }
 
-  uint8_t *tensor_arena = TensorArena::getBuffer();
-  if (!tensor_arena) {
-    ESP_LOGE(__FUNCTION__, "unable to get tensor arena");
-    free(__nn_model_handle);
+#if CONFIG_NN_MODEL_PROFILER
+  __nn_model_handle->profiler = new ModelProfiler();
+#endif
+  __nn_model_handle->shared_scratch =
+    cfg.arena_mode == NN_MODEL_ARENA_SHARED_SCRATCH;
+  size_t arena_size = cfg.arena_size;
+  if (!arena_size) {
+    arena_size = __nn_model_handle->shared_scratch
+                   ? TensorArena::kDefaultPersistentSize
+                   : TensorArena::kDefaultSize;
+  }
+  __nn_model_handle->arena =
+    TensorArena::allocate(arena_size, __nn_model_handle->shared_scratch);
+  if (!__nn_model_handle->arena ||
+      create_interpreter(__nn_model_handle, model, arena_size, true) < 0) {
+    release_handle(__nn_model_handle);
     return -1;
   }
-  // Build an interpreter to run the model with.
-  __nn_model_handle->interpreter =
-    new tflite::MicroInterpreter(model, TFLiteOpResolver::getInstance(),
-                                 tensor_arena, TensorArena::getSize());
 
-  // Allocate memory from the tensor_arena for the model's tensors.
-  TfLiteStatus allocate_status =
-    __nn_model_handle->interpreter->AllocateTensors();
-  if (allocate_status != kTfLiteOk) {
-    ESP_LOGE(__FUNCTION__, "AllocateTensors() failed");
-    free(__nn_model_handle);
+  size_t used_size = arena_size;
+#if CONFIG_NN_MODEL_ARENA_RIGHT_SIZE
+  // Default sized arenas are cut to the measured size. Set arena_size to
+  // this value to keep the default one from being allocated.
+  const size_t needed = TensorArena::kRightSizeMargin +
+                        __nn_model_handle->persistent_bytes +
+                        (__nn_model_handle->shared_scratch
+                           ? 0
+                           : __nn_model_handle->scratch_bytes);
+  if (!cfg.arena_size && needed < arena_size) {
+    ESP_LOGI(__FUNCTION__, "right-sizing arena to %u bytes", needed);
+    used_size = needed;
+  }
+#endif
+  // Drop the measuring interpreter and its probe, the heap trims the tail of
+  // the block in place before the final one is built.
+  release_interpreter(__nn_model_handle);
+  if (used_size < arena_size) {
+    __nn_model_handle->arena =
+      TensorArena::shrink(__nn_model_handle->arena, used_size);
+  }
+  if (create_interpreter(__nn_model_handle, model, used_size, false) < 0) {
+    release_handle(__nn_model_handle);
+    return -1;
+  }
+
+  const TfLiteTensor *output = __nn_model_handle->interpreter->output(0);
+  if (output->type != (cfg.is_quantized ? kTfLiteInt8 : kTfLiteFloat32)) {
+    ESP_LOGE(__FUNCTION__, "unexpected output type %d", output->type);
+    release_handle(__nn_model_handle);
+    return -1;
+  }
+  if (cfg.is_quantized) {
+    // q > zero_point + threshold / scale, q is an integer.
+    const float threshold_q = floorf(output->params.zero_point +
+                                     cfg.inference_threshold /
+                                       output->params.scale);
+    __nn_model_handle->threshold_q = std::min<float>(
+      std::max<float>(threshold_q, INT8_MIN - 1), INT8_MAX);
+  }
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  if (init_logits(__nn_model_handle, model, cfg) < 0) {
+    release_handle(__nn_model_handle);
+    return -1;
+  }
+#endif
+  const auto *tensors = model->subgraphs()->Get(0)->tensors();
+  for (size_t i = 0; tensors && i < tensors->size(); i++) {
+    __nn_model_handle->stateful |= tensors->Get(i)->is_variable();
+  }
+  // Streams start on state rows at the zero point, the padding in time of
+  // the full-window model.
+  if (nn_model_reset_state(__nn_model_handle) < 0) {
+    release_handle(__nn_model_handle);
     return -1;
   }
 
+#if CONFIG_NN_MODEL_PROFILER
+  // Drop the events of AllocateTensors.
+  __nn_model_handle->profiler->Reset();
+#endif
   *model_handle = __nn_model_handle;
   memcpy(&__nn_model_handle->cfg, &cfg, sizeof(nn_model_config_t));
   return 0;
@@ -99,13 +390,42 @@ int nn_model_init(nn_model_handle_t *model_handle, nn_model_config_t cfg) {
 
 int nn_model_release(nn_model_handle_t model_handle) {
   if (model_handle) {
-    TensorArena::releaseBuffer();
-    __nn_model_handle_t __nn_model_handle =
-      static_cast<__nn_model_handle_t>(model_handle);
-    delete __nn_model_handle->interpreter;
-    free(__nn_model_handle);
+    release_handle(static_cast<__nn_model_handle_t>(model_handle));
+  }
+  return 0;
+}
+
+int nn_model_profiler_dump(nn_model_handle_t model_handle, const char *name,
+                           bool csv) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+#if CONFIG_NN_MODEL_PROFILER
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  __nn_model_handle->profiler->Dump(name, csv);
+  return 0;
+#else
+  ESP_LOGE(__FUNCTION__, "NN_MODEL_PROFILER is disabled");
+  return -1;
+#endif
+}
+
+int nn_model_profiler_reset(nn_model_handle_t model_handle) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
   }
+#if CONFIG_NN_MODEL_PROFILER
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  __nn_model_handle->profiler->Reset();
   return 0;
+#else
+  ESP_LOGE(__FUNCTION__, "NN_MODEL_PROFILER is disabled");
+  return -1;
+#endif
 }
 
 int nn_model_get_label(nn_model_handle_t model_handle, int category,
@@ -127,6 +447,68 @@ int nn_model_get_label(nn_model_handle_t model_handle, int category,
   return 0;
 }
 
+static int invoke(__nn_model_handle_t __nn_model_handle, int64_t t1,
+                  int *category) {
+  nn_model_config_t &cfg = __nn_model_handle->cfg;
+
+#if CONFIG_NN_MODEL_PROFILER
+  __nn_model_handle->profiler->StartInvoke();
+#endif
+  TfLiteStatus invoke_status = __nn_model_handle->interpreter->Invoke();
+  if (invoke_status != kTfLiteOk) {
+    ESP_LOGE(__FUNCTION__, "Invoke failed");
+    return -1;
+  }
+
+  // Decide on the output tensor itself, dequantization keeps the order.
+  const TfLiteTensor *output = __nn_model_handle->interpreter->output(0);
+  size_t idx;
+  bool detected;
+  if (cfg.is_quantized) {
+    idx = argmax(output->data.int8, cfg.labels_num);
+    detected = output->data.int8[idx] > __nn_model_handle->threshold_q;
+  } else {
+    idx = argmax(output->data.f, cfg.labels_num);
+    detected = output->data.f[idx] > cfg.inference_threshold;
+  }
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  if (__nn_model_handle->logits) {
+    // Close logits may round to the same Softmax output, the first of them
+    // is the top one as for argmax on the output.
+    idx = 0;
+    if (cfg.is_quantized) {
+      __nn_model_handle->softmax_q->prepare(output->data.int8,
+                                            cfg.labels_num);
+      int8_t top = logit_output_q(__nn_model_handle, 0);
+      for (size_t i = 1; i < cfg.labels_num; i++) {
+        const int8_t val = logit_output_q(__nn_model_handle, i);
+        if (val > top) {
+          top = val;
+          idx = i;
+        }
+      }
+      detected = top > __nn_model_handle->threshold_q;
+    } else {
+      __nn_model_handle->softmax_f.prepare(output->data.f, cfg.labels_num);
+      float top = logit_output_f(__nn_model_handle, 0);
+      for (size_t i = 1; i < cfg.labels_num; i++) {
+        const float val = logit_output_f(__nn_model_handle, i);
+        if (val > top) {
+          top = val;
+          idx = i;
+        }
+      }
+      detected = top > cfg.inference_threshold;
+    }
+  }
+#endif
+
+  ESP_LOGD(__FUNCTION__, "%d, %d, %lld", idx, detected,
+           esp_timer_get_time() - t1);
+  *category = detected ? idx : -1;
+  return 0;
+}
+
 int nn_model_inference(nn_model_handle_t model_handle, const float *input_data,
                        size_t len, int *category) {
   if (!model_handle) {
@@ -135,36 +517,417 @@ int nn_model_inference(nn_model_handle_t model_handle, const float *input_data,
   }
   __nn_model_handle_t __nn_model_handle =
     static_cast<__nn_model_handle_t>(model_handle);
-  nn_model_config_t &cfg = __nn_model_handle->cfg;
+
+  std::unique_lock<std::mutex> lock(TensorArena::scratchLock(),
+                                    std::defer_lock);
+  if (__nn_model_handle->shared_scratch) {
+    lock.lock();
+  }
 
   const int64_t t1 = esp_timer_get_time();
   set_input(input_data, __nn_model_handle->interpreter->input(0), len,
-            cfg.is_quantized);
+            __nn_model_handle->cfg.is_quantized);
 
-  TfLiteStatus invoke_status = __nn_model_handle->interpreter->Invoke();
-  if (invoke_status != kTfLiteOk) {
-    ESP_LOGE(__FUNCTION__, "Invoke failed");
+  return invoke(__nn_model_handle, t1, category);
+}
+
+int nn_model_get_input_quant(nn_model_handle_t model_handle, float *scale,
+                             int *zero_point) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  const TfLiteTensor *tensor = __nn_model_handle->interpreter->input(0);
+  if (tensor->type != kTfLiteInt8) {
+    ESP_LOGE(__FUNCTION__, "model input is not int8");
     return -1;
   }
+  *scale = tensor->params.scale;
+  *zero_point = tensor->params.zero_point;
+  return 0;
+}
 
-  float *out_buffer = new float[cfg.labels_num];
-  if (!out_buffer) {
-    ESP_LOGE(__FUNCTION__, "unable to allocate out buffer");
+// Gate score of an int8 input of len bytes.
+static int gate_score(__nn_model_handle_t __nn_model_handle,
+                      const int8_t *input_data, size_t len, float *score) {
+  const nn_model_gate_t &gate = __nn_model_handle->gate;
+  if (gate.model) {
+    __nn_model_handle_t gate_handle =
+      static_cast<__nn_model_handle_t>(gate.model);
+    // Read the score before another model reuses a shared scratch.
+    std::unique_lock<std::mutex> lock(TensorArena::scratchLock(),
+                                      std::defer_lock);
+    if (gate_handle->shared_scratch) {
+      lock.lock();
+    }
+    memcpy(gate_handle->interpreter->input(0)->data.int8, input_data, len);
+    int category;
+    if (invoke(gate_handle, esp_timer_get_time(), &category) < 0) {
+      return -1;
+    }
+    *score = get_score(gate_handle, gate.category);
+    return 0;
+  }
+
+  const size_t rows = len / gate.features_num;
+  if (!rows) {
+    ESP_LOGE(__FUNCTION__, "input shorter than a row: len=%d", len);
     return -1;
   }
-  get_output(__nn_model_handle->interpreter->output(0), out_buffer,
-             cfg.labels_num, cfg.is_quantized);
+  int32_t *sums = __nn_model_handle->gate_sums;
+  memset(sums, 0, gate.features_num * sizeof(int32_t));
+  for (size_t i = 0; i + gate.features_num <= len; i += gate.features_num) {
+    for (size_t j = 0; j < gate.features_num; j++) {
+      sums[j] += input_data[i + j];
+    }
+  }
+  float acc = 0;
+  for (size_t j = 0; j < gate.features_num; j++) {
+    acc += __nn_model_handle->gate_weights[j] * sums[j];
+  }
+  *score = __nn_model_handle->gate_offset +
+           __nn_model_handle->gate_scale / rows * acc;
+  return 0;
+}
 
-  const size_t idx = argmax(out_buffer, cfg.labels_num);
-  char result[32];
-  nn_model_get_label(model_handle, idx, result, sizeof(result));
+// 1 with category -1 when the gate of the model is closed on an int8 input,
+// 0 when it is open or there is none.
+static int apply_gate(__nn_model_handle_t __nn_model_handle,
+                      const int8_t *input_data, size_t len, int *category) {
+  if (!__nn_model_handle->gated) {
+    return 0;
+  }
+  float score;
+  if (gate_score(__nn_model_handle, input_data, len, &score) < 0) {
+    return -1;
+  }
+  const bool passed = score >= __nn_model_handle->gate.threshold;
+  __nn_model_handle->gate_stats.windows++;
+  __nn_model_handle->gate_stats.passed += passed;
+  ESP_LOGD(__FUNCTION__, "gate %.3f, %d", score, passed);
+  if (!passed) {
+    *category = -1;
+    return 1;
+  }
+  return 0;
+}
 
-  ESP_LOGI(__FUNCTION__, "%f, %s, %lld", out_buffer[idx], result,
-           esp_timer_get_time() - t1);
-  *category = -1;
-  if (out_buffer[idx] > cfg.inference_threshold) {
-    *category = idx;
+int nn_model_set_gate(nn_model_handle_t model_handle,
+                      const nn_model_gate_t *gate) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  __nn_model_handle->gated = false;
+  delete[] __nn_model_handle->gate_weights;
+  __nn_model_handle->gate_weights = NULL;
+  delete[] __nn_model_handle->gate_sums;
+  __nn_model_handle->gate_sums = NULL;
+  __nn_model_handle->gate_stats = nn_model_gate_stats_t{};
+  if (!gate) {
+    return 0;
+  }
+
+  const TfLiteTensor *input = __nn_model_handle->interpreter->input(0);
+  if (input->type != kTfLiteInt8) {
+    ESP_LOGE(__FUNCTION__, "model input is not int8");
+    return -1;
+  }
+  // Skipped inputs would be missing from the state.
+  if (__nn_model_handle->stateful) {
+    ESP_LOGE(__FUNCTION__, "streaming models can't be gated");
+    return -1;
+  }
+  if (gate->model) {
+    __nn_model_handle_t gate_handle =
+      static_cast<__nn_model_handle_t>(gate->model);
+    const TfLiteTensor *gate_input = gate_handle->interpreter->input(0);
+    // Both models take the same buffer as is.
+    if (gate_handle == __nn_model_handle || gate_handle->gated ||
+        gate_input->type != kTfLiteInt8 || gate_input->bytes != input->bytes ||
+        gate_input->params.scale != input->params.scale ||
+        gate_input->params.zero_point != input->params.zero_point ||
+        gate->category < 0 ||
+        gate->category >= static_cast<int>(gate_handle->cfg.labels_num)) {
+      ESP_LOGE(__FUNCTION__, "gating model mismatch");
+      return -1;
+    }
+    // The input tensor of a shared scratch model is in the scratch the
+    // gating model runs in, nn_model_invoke would score it in place.
+    if (gate_handle->shared_scratch && __nn_model_handle->shared_scratch) {
+      ESP_LOGE(__FUNCTION__, "gating model and model share the scratch");
+      return -1;
+    }
+  } else {
+    if (!gate->weights || !gate->features_num ||
+        input->bytes % gate->features_num) {
+      ESP_LOGE(__FUNCTION__, "linear gate mismatch: features=%d, bytes=%d",
+               gate->features_num, input->bytes);
+      return -1;
+    }
+    // Freed with the handle or the next gate if the other one fails.
+    __nn_model_handle->gate_weights =
+      new (std::nothrow) float[gate->features_num];
+    __nn_model_handle->gate_sums =
+      new (std::nothrow) int32_t[gate->features_num];
+    if (!__nn_model_handle->gate_weights || !__nn_model_handle->gate_sums) {
+      ESP_LOGE(__FUNCTION__, "unable to allocate gate");
+      return -1;
+    }
+    // mean[i] = scale * (sums[i] / rows - zero_point), rows of the input
+    // scored.
+    float weights_sum = 0;
+    for (size_t i = 0; i < gate->features_num; i++) {
+      __nn_model_handle->gate_weights[i] = gate->weights[i];
+      weights_sum += gate->weights[i];
+    }
+    __nn_model_handle->gate_scale = input->params.scale;
+    __nn_model_handle->gate_offset =
+      gate->bias - input->params.scale * input->params.zero_point * weights_sum;
+  }
+  __nn_model_handle->gate = *gate;
+  __nn_model_handle->gate.weights = __nn_model_handle->gate_weights;
+  __nn_model_handle->gated = true;
+  return 0;
+}
+
+int nn_model_get_gate_stats(nn_model_handle_t model_handle,
+                            nn_model_gate_stats_t *stats) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  if (!__nn_model_handle->gated) {
+    ESP_LOGE(__FUNCTION__, "model has no gate");
+    return -1;
+  }
+  *stats = __nn_model_handle->gate_stats;
+  return 0;
+}
+
+int nn_model_inference_q(nn_model_handle_t model_handle,
+                         const int8_t *input_data, size_t len, int *category) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  TfLiteTensor *tensor = __nn_model_handle->interpreter->input(0);
+  if (tensor->type != kTfLiteInt8 || len > tensor->bytes) {
+    ESP_LOGE(__FUNCTION__, "input mismatch: type=%d, bytes=%d, len=%d",
+             tensor->type, tensor->bytes, len);
+    return -1;
+  }
+
+  const int gate = apply_gate(__nn_model_handle, input_data, len, category);
+  if (gate) {
+    return gate;
+  }
+
+  std::unique_lock<std::mutex> lock(TensorArena::scratchLock(),
+                                    std::defer_lock);
+  if (__nn_model_handle->shared_scratch) {
+    lock.lock();
+  }
+
+  const int64_t t1 = esp_timer_get_time();
+  memcpy(tensor->data.int8, input_data, len);
+
+  return invoke(__nn_model_handle, t1, category);
+}
+
+static int describe_tensor(const TfLiteTensor *src, nn_model_tensor_t *dst) {
+  switch (src->type) {
+  case kTfLiteInt8:
+    dst->type = NN_MODEL_TENSOR_INT8;
+    break;
+  case kTfLiteFloat32:
+    dst->type = NN_MODEL_TENSOR_FLOAT32;
+    break;
+  default:
+    ESP_LOGE(__FUNCTION__, "unsupported tensor type %d", src->type);
+    return -1;
+  }
+  if (src->dims->size > NN_MODEL_TENSOR_DIMS_MAX) {
+    ESP_LOGE(__FUNCTION__, "unsupported tensor rank %d", src->dims->size);
+    return -1;
   }
-  delete[] out_buffer;
+  dst->data = src->data.data;
+  dst->bytes = src->bytes;
+  dst->dims_num = src->dims->size;
+  for (int i = 0; i < src->dims->size; i++) {
+    dst->dims[i] = src->dims->data[i];
+  }
+  dst->scale = src->params.scale;
+  dst->zero_point = src->params.zero_point;
+  return 0;
+}
+
+int nn_model_get_input(nn_model_handle_t model_handle,
+                       nn_model_tensor_t *tensor) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  return describe_tensor(__nn_model_handle->interpreter->input(0), tensor);
+}
+
+int nn_model_get_output(nn_model_handle_t model_handle,
+                        nn_model_tensor_t *tensor) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  if (describe_tensor(__nn_model_handle->interpreter->output(0), tensor) < 0) {
+    return -1;
+  }
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  if (__nn_model_handle->logits) {
+    tensor->scale = __nn_model_handle->logit_scale;
+    tensor->zero_point = __nn_model_handle->logit_zero_point;
+  }
+#endif
+  return 0;
+}
+
+int nn_model_invoke(nn_model_handle_t model_handle, int *category) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+
+  // Gates only take int8 inputs.
+  const TfLiteTensor *tensor = __nn_model_handle->interpreter->input(0);
+  const int gate = apply_gate(__nn_model_handle, tensor->data.int8,
+                              tensor->bytes, category);
+  if (gate) {
+    return gate;
+  }
+
+  std::unique_lock<std::mutex> lock(TensorArena::scratchLock(),
+                                    std::defer_lock);
+  if (__nn_model_handle->shared_scratch) {
+    lock.lock();
+  }
+
+  return invoke(__nn_model_handle, esp_timer_get_time(), category);
+}
+
+int nn_model_reset_state(nn_model_handle_t model_handle) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  if (!__nn_model_handle->stateful) {
+    return 0;
+  }
+  std::unique_lock<std::mutex> lock(TensorArena::scratchLock(),
+                                    std::defer_lock);
+  if (__nn_model_handle->shared_scratch) {
+    lock.lock();
+  }
+  if (__nn_model_handle->interpreter->ResetVariableTensors() != kTfLiteOk) {
+    ESP_LOGE(__FUNCTION__, "unable to reset model state");
+    return -1;
+  }
+  return 0;
+}
+
+int nn_model_get_scores(nn_model_handle_t model_handle, float *scores,
+                        size_t len) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  const size_t num = std::min<size_t>(len, __nn_model_handle->cfg.labels_num);
+  for (size_t i = 0; i < num; i++) {
+    scores[i] = get_score(__nn_model_handle, i);
+  }
+  return num;
+}
+
+int nn_model_get_scores_q(nn_model_handle_t model_handle, int8_t *scores,
+                          size_t len) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  if (!__nn_model_handle->cfg.is_quantized) {
+    ESP_LOGE(__FUNCTION__, "model output is not int8");
+    return -1;
+  }
+  const size_t num = std::min<size_t>(len, __nn_model_handle->cfg.labels_num);
+  const TfLiteTensor *output = __nn_model_handle->interpreter->output(0);
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  if (__nn_model_handle->logits) {
+    for (size_t i = 0; i < num; i++) {
+      scores[i] = logit_output_q(__nn_model_handle, i);
+    }
+    return num;
+  }
+#endif
+  memcpy(scores, output->data.int8, num);
+  return num;
+}
+
+int nn_model_get_top_k(nn_model_handle_t model_handle,
+                       nn_model_result_t *results, size_t k) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  const size_t labels_num = __nn_model_handle->cfg.labels_num;
+  k = std::min(k, labels_num);
+
+  // Insertion into the sorted results, k and labels_num are small.
+  size_t num = 0;
+  for (size_t i = 0; i < labels_num; i++) {
+    const float score = get_score(__nn_model_handle, i);
+    size_t pos = num;
+    while (pos > 0 && results[pos - 1].score < score) {
+      if (pos < k) {
+        results[pos] = results[pos - 1];
+      }
+      pos--;
+    }
+    if (pos < k) {
+      results[pos] = {.category = static_cast<int>(i), .score = score};
+      num = std::min(num + 1, k);
+    }
+  }
+  return num;
+}
+
+int nn_model_get_arena_usage(nn_model_handle_t model_handle,
+                             size_t *persistent_bytes, size_t *scratch_bytes) {
+  if (!model_handle) {
+    ESP_LOGE(__FUNCTION__, "nn model is not initialized");
+    return -1;
+  }
+  __nn_model_handle_t __nn_model_handle =
+    static_cast<__nn_model_handle_t>(model_handle);
+  *persistent_bytes = __nn_model_handle->persistent_bytes;
+  *scratch_bytes = __nn_model_handle->scratch_bytes;
   return 0;
 }
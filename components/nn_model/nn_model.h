@@ -1,18 +1,35 @@
 #ifndef _NN_MODEL_H_
 #define _NN_MODEL_H_
 
+#include <cstdint>
 #include <cstring>
 #include <stdio.h>
 #include <stdlib.h>
 
 typedef void *nn_model_handle_t;
 
+/*! \brief Tensor arena layout, see tensor_arena.h. */
+enum nn_model_arena_mode_t {
+  /*! Private arena for persistent data and scratch. */
+  NN_MODEL_ARENA_PRIVATE = 0,
+  /*! Private persistent region, scratch shared with other models in this
+   * mode. Their inferences are serialized and output tensors are only valid
+   * until another of them runs. */
+  NN_MODEL_ARENA_SHARED_SCRATCH,
+};
+
 struct nn_model_config_t {
   const unsigned char *model_ptr;
   const char **labels;
   unsigned int labels_num;
   bool is_quantized;
   float inference_threshold;
+  nn_model_arena_mode_t arena_mode;
+  /*! Private arena or persistent region bytes, 0 for the default. */
+  size_t arena_size;
+  /*! Name in the model pack, see model_pack.h. Used when model_ptr is NULL,
+   * labels are taken from the pack when labels is NULL too. */
+  const char *model_name;
 };
 
 /*!
@@ -38,6 +55,187 @@ int nn_model_release(nn_model_handle_t model_handle);
  */
 int nn_model_inference(nn_model_handle_t model_handle, const float *input_data,
                        size_t len, int *category);
+/*!
+ * \brief Get quantization params of the int8 model input.
+ * \param model_handle NN model handle.
+ * \param scale Input scale.
+ * \param zero_point Input zero point.
+ * \return Result.
+ */
+int nn_model_get_input_quant(nn_model_handle_t model_handle, float *scale,
+                             int *zero_point);
+/*!
+ * \brief Model inference on input already quantized with the params from
+ * nn_model_get_input_quant.
+ * \param model_handle NN model handle.
+ * \param input_data int8 input data.
+ * \param len input data len.
+ * \param category inferred category.
+ * \return Result, 1 when the gate skipped the model.
+ */
+int nn_model_inference_q(nn_model_handle_t model_handle,
+                         const int8_t *input_data, size_t len, int *category);
+/*!
+ * \brief First stage of a cascade: a cheap score on the int8 input deciding
+ * whether the model runs at all, see nn_model_set_gate.
+ */
+struct nn_model_gate_t {
+  /*! Small gating model taking the same int8 input, NULL for a linear gate.
+   * Its score for category is the gate score. */
+  nn_model_handle_t model;
+  int category;
+  /*! Linear gate: the input is pooled into the mean of each of its
+   * features_num features over the rows, dequantized, and scored as
+   * bias + sum(weights[i] * mean[i]). weights is copied. */
+  const float *weights;
+  size_t features_num;
+  float bias;
+  /*! Operating point: the model runs when the gate score is at least
+   * threshold. */
+  float threshold;
+};
+
+/*! \brief Gate decisions since it was set. */
+struct nn_model_gate_stats_t {
+  uint32_t windows;
+  uint32_t passed;
+};
+
+/*!
+ * \brief Set the gate of nn_model_inference_q. A closed gate skips the
+ * model, the call then returns 1 with no category and leaves the scores of
+ * the last inference. Streaming models need all their inputs and can't be
+ * gated. A gating model and the model it gates can't both use
+ * NN_MODEL_ARENA_SHARED_SCRATCH.
+ * \param model_handle NN model handle.
+ * \param gate Gate config, NULL to remove it.
+ * \return Result.
+ */
+int nn_model_set_gate(nn_model_handle_t model_handle,
+                      const nn_model_gate_t *gate);
+/*!
+ * \brief Get the pass-through stats of the gate.
+ * \param model_handle NN model handle.
+ * \param stats Gate stats.
+ * \return Result.
+ */
+int nn_model_get_gate_stats(nn_model_handle_t model_handle,
+                            nn_model_gate_stats_t *stats);
+/*! \brief Element type of a model tensor. */
+enum nn_model_tensor_type_t {
+  NN_MODEL_TENSOR_INT8 = 0,
+  NN_MODEL_TENSOR_FLOAT32,
+};
+
+#define NN_MODEL_TENSOR_DIMS_MAX 4
+
+/*! \brief Buffer of a model tensor with its layout. */
+struct nn_model_tensor_t {
+  void *data;
+  nn_model_tensor_type_t type;
+  size_t bytes;
+  size_t dims_num;
+  int dims[NN_MODEL_TENSOR_DIMS_MAX];
+  /*! Quantization params of int8 tensors. */
+  float scale;
+  int zero_point;
+};
+
+/*!
+ * \brief Get the model input tensor, to be filled in place before
+ * nn_model_invoke. The buffer may be reused for activations: it has to be
+ * filled again before every invoke. Models with a shared scratch arena lose
+ * it whenever another of them runs, they are better served by the copying
+ * inference calls.
+ * \param model_handle NN model handle.
+ * \param tensor Input tensor description.
+ * \return Result.
+ */
+int nn_model_get_input(nn_model_handle_t model_handle,
+                       nn_model_tensor_t *tensor);
+/*!
+ * \brief Get the model output tensor, holding the scores of the last
+ * inference until the next one. With CONFIG_NN_MODEL_LOGIT_DECISION it holds
+ * the logits of the model Softmax, with their quantization params.
+ * \param model_handle NN model handle.
+ * \param tensor Output tensor description.
+ * \return Result.
+ */
+int nn_model_get_output(nn_model_handle_t model_handle,
+                        nn_model_tensor_t *tensor);
+/*!
+ * \brief Model inference on the input tensor as filled in place.
+ * \param model_handle NN model handle.
+ * \param category inferred category.
+ * \return Result, 1 when the gate skipped the model.
+ */
+int nn_model_invoke(nn_model_handle_t model_handle, int *category);
+/*!
+ * \brief Clear the state of a streaming model (tools/stream_model.py) as it
+ * was after init, the next inference starts a new stream. Does nothing for
+ * other models.
+ * \param model_handle NN model handle.
+ * \return Result.
+ */
+int nn_model_reset_state(nn_model_handle_t model_handle);
+/*! \brief Class index with its dequantized score. */
+struct nn_model_result_t {
+  int category;
+  float score;
+};
+
+/*!
+ * \brief Scores of the last inference, valid until the next one.
+ * \param model_handle NN model handle.
+ * \param scores Buffer for one dequantized score per label.
+ * \param len Buffer len.
+ * \return Number of scores written or -1.
+ */
+int nn_model_get_scores(nn_model_handle_t model_handle, float *scores,
+                        size_t len);
+/*!
+ * \brief Raw int8 scores of the last inference of a quantized model.
+ * \param model_handle NN model handle.
+ * \param scores Buffer for one score per label.
+ * \param len Buffer len.
+ * \return Number of scores written or -1.
+ */
+int nn_model_get_scores_q(nn_model_handle_t model_handle, int8_t *scores,
+                          size_t len);
+/*!
+ * \brief Best classes of the last inference, highest score first.
+ * \param model_handle NN model handle.
+ * \param results Buffer for k results.
+ * \param k Number of results wanted.
+ * \return Number of results written or -1.
+ */
+int nn_model_get_top_k(nn_model_handle_t model_handle,
+                       nn_model_result_t *results, size_t k);
+/*!
+ * \brief Tensor arena bytes used by the model.
+ * \param model_handle NN model handle.
+ * \param persistent_bytes Bytes of data living as long as the model.
+ * \param scratch_bytes Bytes only used during inference.
+ * \return Result.
+ */
+int nn_model_get_arena_usage(nn_model_handle_t model_handle,
+                             size_t *persistent_bytes, size_t *scratch_bytes);
+/*!
+ * \brief Print the cycles per layer and per op type of the inferences since
+ * init or the last reset. Needs NN_MODEL_PROFILER.
+ * \param model_handle NN model handle.
+ * \param name Model name for the report.
+ * \param csv CSV instead of a table.
+ * \return Result.
+ */
+int nn_model_profiler_dump(nn_model_handle_t model_handle, const char *name,
+                           bool csv);
+/*!
+ * \brief Clear the profiled cycles. Needs NN_MODEL_PROFILER.
+ * \param model_handle NN model handle.
+ * \return Result.
+ */
+int nn_model_profiler_reset(nn_model_handle_t model_handle);
 /*!
  * \brief Get label string.
  * \param model_handle NN model handle.
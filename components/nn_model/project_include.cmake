@@ -0,0 +1,68 @@
+# nn_model_embed(<prefix> <model.tflite> <labels.txt>)
+#
+# Link a .tflite model and its labels (one per line) into the calling
+# component, to be called after idf_component_register. The model goes to a
+# read-only section with 16 byte alignment through .incbin, and the labels to
+# a generated source, with the symbols models are passed to nn_model_init by:
+#
+#   const unsigned char *<prefix>_model_ptr;
+#   unsigned int <prefix>_model_len;
+#   const char *<prefix>_labels[];
+#   unsigned int <prefix>_labels_num;
+function(nn_model_embed prefix tflite labels)
+  get_filename_component(tflite "${tflite}" ABSOLUTE BASE_DIR
+                         "${CMAKE_CURRENT_SOURCE_DIR}")
+  get_filename_component(labels "${labels}" ABSOLUTE BASE_DIR
+                         "${CMAKE_CURRENT_SOURCE_DIR}")
+
+  set(asm_file "${CMAKE_CURRENT_BINARY_DIR}/${prefix}_model.S")
+  file(
+    WRITE "${asm_file}.in"
+    "/* Generated by nn_model_embed() from ${tflite}. */\n"
+    "  .section .rodata.${prefix}_model, \"a\"\n"
+    "  .balign 16\n"
+    "  .global ${prefix}_model_data\n"
+    "${prefix}_model_data:\n"
+    "  .incbin \"${tflite}\"\n"
+    "${prefix}_model_end:\n"
+    "  .balign 4\n"
+    "  .global ${prefix}_model_len\n"
+    "${prefix}_model_len:\n"
+    "  .long ${prefix}_model_end - ${prefix}_model_data\n"
+    "#if defined(__linux__) && defined(__ELF__)\n"
+    "  .section .note.GNU-stack, \"\", %progbits\n"
+    "#endif\n")
+  configure_file("${asm_file}.in" "${asm_file}" COPYONLY)
+
+  file(STRINGS "${labels}" label_list)
+  set(label_lines "")
+  set(labels_num 0)
+  foreach(label ${label_list})
+    string(STRIP "${label}" label)
+    if(NOT label STREQUAL "")
+      string(APPEND label_lines "  \"${label}\",\n")
+      math(EXPR labels_num "${labels_num} + 1")
+    endif()
+  endforeach()
+
+  set(src_file "${CMAKE_CURRENT_BINARY_DIR}/${prefix}_labels.cpp")
+  file(
+    WRITE "${src_file}.in"
+    "// Generated by nn_model_embed() from ${labels}.\n"
+    "extern const unsigned char ${prefix}_model_data[];\n"
+    "const unsigned char *${prefix}_model_ptr = ${prefix}_model_data;\n"
+    "const char *${prefix}_labels[] = {\n"
+    "${label_lines}"
+    "};\n"
+    "unsigned int ${prefix}_labels_num = ${labels_num};\n")
+  configure_file("${src_file}.in" "${src_file}" COPYONLY)
+
+  # A new model only needs the object rebuilt, new labels a reconfigure.
+  set_source_files_properties("${asm_file}" PROPERTIES OBJECT_DEPENDS
+                                                       "${tflite}")
+  set_property(
+    DIRECTORY
+    APPEND
+    PROPERTY CMAKE_CONFIGURE_DEPENDS "${labels}")
+  target_sources(${COMPONENT_LIB} PRIVATE "${asm_file}" "${src_file}")
+endfunction()
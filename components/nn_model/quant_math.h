@@ -0,0 +1,134 @@
+#ifndef _QUANT_MATH_H_
+#define _QUANT_MATH_H_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/*
+ * Integer arithmetic of TFLite's quantized kernels (gemmlowp fixed point and
+ * tensorflow/lite/kernels/internal/common.h), without the TFLM headers so
+ * that the custom ops and the logit decision can be checked on the host.
+ * Results are bit-exact with the reference kernels built without
+ * TFLITE_SINGLE_ROUNDING, the esp-tflite-micro default.
+ */
+namespace quant_math {
+
+// Rounded high 32 bits of 2 * a * b, saturated.
+inline int32_t SaturatingRoundingDoublingHighMul(int32_t a, int32_t b) {
+  if (a == b && a == std::numeric_limits<int32_t>::min())
+    return std::numeric_limits<int32_t>::max();
+  const int64_t ab = static_cast<int64_t>(a) * b;
+  const int32_t nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+  return static_cast<int32_t>((ab + nudge) / (1ll << 31));
+}
+
+// x / 2^exponent rounded to nearest, ties away from zero.
+inline int32_t RoundingDivideByPOT(int32_t x, int exponent) {
+  const int32_t mask = static_cast<int32_t>((1ll << exponent) - 1);
+  const int32_t remainder = x & mask;
+  const int32_t threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+  return (x >> exponent) + (remainder > threshold ? 1 : 0);
+}
+
+// x * 2^exponent, saturated.
+inline int32_t SaturatingMultiplyByPOT(int32_t x, int exponent) {
+  const int32_t threshold = (1 << (31 - exponent)) - 1;
+  if (x > threshold)
+    return std::numeric_limits<int32_t>::max();
+  if (x < -threshold)
+    return std::numeric_limits<int32_t>::min();
+  return static_cast<int32_t>(static_cast<uint32_t>(x) << exponent);
+}
+
+// x * multiplier * 2^shift, the multiplier in Q0.31.
+inline int32_t MultiplyByQuantizedMultiplier(int32_t x, int32_t multiplier,
+                                             int shift) {
+  const int left_shift = shift > 0 ? shift : 0;
+  const int right_shift = shift > 0 ? 0 : -shift;
+  return RoundingDivideByPOT(
+    SaturatingRoundingDoublingHighMul(x * (1 << left_shift), multiplier),
+    right_shift);
+}
+
+// multiplier in Q0.31 and shift such that real = multiplier * 2^shift.
+inline void QuantizeMultiplier(double real, int32_t *multiplier, int *shift) {
+  if (real == 0.) {
+    *multiplier = 0;
+    *shift = 0;
+    return;
+  }
+  const double q = std::frexp(real, shift);
+  int64_t q_fixed = static_cast<int64_t>(std::round(q * (1ll << 31)));
+  if (q_fixed == (1ll << 31)) {
+    q_fixed /= 2;
+    ++*shift;
+  }
+  if (*shift < -31) {
+    *shift = 0;
+    q_fixed = 0;
+  }
+  *multiplier = static_cast<int32_t>(q_fixed);
+}
+
+// exp(a) of a in Q5.26, a <= 0, in Q0.31.
+inline int32_t ExpOnNegativeValues(int32_t a) {
+  constexpr int kFractionalBits = 26;
+  const int32_t one_quarter = 1 << (kFractionalBits - 2);
+  const int32_t a_mod_quarter_minus_one_quarter =
+    (a & (one_quarter - 1)) - one_quarter;
+
+  // exp(x) on [-1/4, 0) in Q0.31: Taylor expansion around -1/8.
+  const int32_t constant_term = 1895147668;
+  const int32_t constant_1_over_3 = 715827883;
+  const int32_t x = a_mod_quarter_minus_one_quarter * 32 + (1 << 28);
+  const int32_t x2 = SaturatingRoundingDoublingHighMul(x, x);
+  const int32_t x3 = SaturatingRoundingDoublingHighMul(x2, x);
+  const int32_t x4 = SaturatingRoundingDoublingHighMul(x2, x2);
+  const int32_t x4_over_4 = RoundingDivideByPOT(x4, 2);
+  const int32_t x4_over_24_plus_x3_over_6_plus_x2_over_2 = RoundingDivideByPOT(
+    SaturatingRoundingDoublingHighMul(x4_over_4 + x3, constant_1_over_3) + x2,
+    1);
+  int32_t result =
+    constant_term +
+    SaturatingRoundingDoublingHighMul(
+      constant_term, x + x4_over_24_plus_x3_over_6_plus_x2_over_2);
+
+  // Multiply by exp(-2^k) for every bit k of the remainder.
+  static const int32_t kMultipliers[] = {1672461947, 1302514674, 790015084,
+                                         290630308,  39332535,   720401,
+                                         242};
+  const int32_t remainder = a_mod_quarter_minus_one_quarter - a;
+  for (int k = -2; k <= 4; k++) {
+    if (remainder & (1 << (kFractionalBits + k)))
+      result = SaturatingRoundingDoublingHighMul(result, kMultipliers[k + 2]);
+  }
+  return a == 0 ? std::numeric_limits<int32_t>::max() : result;
+}
+
+// 1 / (1 + a) of a in Q0.31, a in [0, 1), in Q0.31.
+inline int32_t OneOverOnePlusX(int32_t a) {
+  const int64_t sum = static_cast<int64_t>(a) + INT32_MAX;
+  const int32_t half_denominator =
+    static_cast<int32_t>((sum + (sum >= 0 ? 1 : -1)) / 2);
+  // Newton-Raphson in Q2.29, from 48/17 - 32/17 * d.
+  const int32_t constant_48_over_17 = 1515870810;
+  const int32_t constant_neg_32_over_17 = -1010580540;
+  int32_t x = constant_48_over_17 +
+              SaturatingRoundingDoublingHighMul(half_denominator,
+                                                constant_neg_32_over_17);
+  for (int i = 0; i < 3; i++) {
+    const int32_t half_denominator_times_x =
+      SaturatingRoundingDoublingHighMul(half_denominator, x);
+    const int32_t one_minus_half_denominator_times_x =
+      (1 << 29) - half_denominator_times_x;
+    x += SaturatingMultiplyByPOT(
+      SaturatingRoundingDoublingHighMul(x, one_minus_half_denominator_times_x),
+      2);
+  }
+  return SaturatingMultiplyByPOT(x, 1);
+}
+
+} // namespace quant_math
+
+#endif // _QUANT_MATH_H_
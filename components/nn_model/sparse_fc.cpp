@@ -0,0 +1,165 @@
+#include "sparse_fc.h"
+
+#include <cstring>
+
+#include "custom_op_kernels.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace {
+
+constexpr int kInput = 0;
+constexpr int kWeights = 1;
+constexpr int kBitmap = 2;
+constexpr int kBias = 3;
+constexpr int kOutput = 0;
+
+constexpr uint8_t kVersion = 1;
+constexpr size_t kOptionsSize = 12;
+
+struct OpData {
+  // Parsed custom options.
+  bool options_valid;
+  uint8_t activation;
+  int block;
+  int in_features;
+  int out_features;
+
+  custom_op_kernels::SparseFcParams kernel;
+};
+
+template <typename T> T ReadLE(const uint8_t *p) {
+  T val;
+  memcpy(&val, p, sizeof(T));
+  return val;
+}
+
+void *Init(TfLiteContext *context, const char *buffer, size_t length) {
+  OpData *data = static_cast<OpData *>(
+    context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (!data) {
+    return nullptr;
+  }
+  memset(data, 0, sizeof(OpData));
+  const uint8_t *options = reinterpret_cast<const uint8_t *>(buffer);
+  if (!options || length < kOptionsSize || options[0] != kVersion) {
+    return data;
+  }
+  data->activation = options[1];
+  data->block = ReadLE<uint16_t>(&options[2]);
+  data->in_features = ReadLE<uint32_t>(&options[4]);
+  data->out_features = ReadLE<uint32_t>(&options[8]);
+  data->options_valid = true;
+  return data;
+}
+
+TfLiteStatus Prepare(TfLiteContext *context, TfLiteNode *node) {
+  OpData *data = static_cast<OpData *>(node->user_data);
+  TF_LITE_ENSURE(context, data != nullptr);
+  if (!data->options_valid || data->block != SPARSE_FC_BLOCK ||
+      data->in_features <= 0 || data->out_features <= 0) {
+    TF_LITE_KERNEL_LOG(context, "%s: bad options", SPARSE_FC_OP_NAME);
+    return kTfLiteError;
+  }
+  TF_LITE_ENSURE_EQ(context, node->inputs->size, 4);
+  TF_LITE_ENSURE_EQ(context, node->outputs->size, 1);
+
+  tflite::MicroContext *micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor *input = micro_context->AllocateTempInputTensor(node, kInput);
+  TfLiteTensor *weights =
+    micro_context->AllocateTempInputTensor(node, kWeights);
+  TfLiteTensor *bitmap = micro_context->AllocateTempInputTensor(node, kBitmap);
+  TfLiteTensor *output = micro_context->AllocateTempOutputTensor(node, kOutput);
+  TF_LITE_ENSURE(context, input && weights && bitmap && output);
+  TF_LITE_ENSURE_TYPES_EQ(context, input->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, weights->type, kTfLiteInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, bitmap->type, kTfLiteUInt8);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteInt8);
+  TF_LITE_ENSURE(context, tflite::IsConstantTensor(weights) &&
+                            tflite::IsConstantTensor(bitmap));
+  TF_LITE_ENSURE_EQ(context, input->bytes % data->in_features, 0);
+  TF_LITE_ENSURE_EQ(context, output->bytes,
+                    input->bytes / data->in_features * data->out_features);
+
+  // The stored blocks are the set bits of the bitmap.
+  custom_op_kernels::SparseFcParams &kernel = data->kernel;
+  kernel.in_features = data->in_features;
+  kernel.out_features = data->out_features;
+  kernel.block = data->block;
+  kernel.blocks_num = (data->in_features + data->block - 1) / data->block;
+  kernel.bitmap_row_bytes = (kernel.blocks_num + 7) / 8;
+  TF_LITE_ENSURE_EQ(context, bitmap->bytes,
+                    kernel.bitmap_row_bytes * data->out_features);
+  size_t stored = 0;
+  for (size_t i = 0; i < bitmap->bytes; i++) {
+    stored += __builtin_popcount(bitmap->data.uint8[i]);
+  }
+  TF_LITE_ENSURE_EQ(context, weights->bytes, stored * data->block);
+
+  // One multiplier for all outputs, and zero weights only contribute
+  // nothing with a zero point of 0.
+  const auto *quant =
+    static_cast<const TfLiteAffineQuantization *>(weights->quantization.params);
+  TF_LITE_ENSURE(context, weights->quantization.type ==
+                            kTfLiteAffineQuantization &&
+                            quant && quant->scale);
+  if (quant->scale->size != 1) {
+    TF_LITE_KERNEL_LOG(context, "%s: per-channel weights are not supported",
+                       SPARSE_FC_OP_NAME);
+    return kTfLiteError;
+  }
+  for (int i = 0; quant->zero_point && i < quant->zero_point->size; i++) {
+    TF_LITE_ENSURE_EQ(context, quant->zero_point->data[i], 0);
+  }
+  kernel.input_offset = -input->params.zero_point;
+  kernel.output_offset = output->params.zero_point;
+  // The dense kernel's multiplier, for its results.
+  double effective_scale;
+  TF_LITE_ENSURE_STATUS(tflite::GetQuantizedConvolutionMultipler(
+    context, input, weights, output, &effective_scale));
+  tflite::QuantizeMultiplier(effective_scale, &kernel.multiplier,
+                             &kernel.shift);
+  TF_LITE_ENSURE_STATUS(tflite::CalculateActivationRangeQuantized(
+    context, static_cast<TfLiteFusedActivation>(data->activation), output,
+    &kernel.act_min, &kernel.act_max));
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(weights);
+  micro_context->DeallocateTempTfLiteTensor(bitmap);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext *context, TfLiteNode *node) {
+  const OpData &data = *static_cast<const OpData *>(node->user_data);
+  const TfLiteEvalTensor *input =
+    tflite::micro::GetEvalInput(context, node, kInput);
+  const TfLiteEvalTensor *weights =
+    tflite::micro::GetEvalInput(context, node, kWeights);
+  const TfLiteEvalTensor *bitmap =
+    tflite::micro::GetEvalInput(context, node, kBitmap);
+  const TfLiteEvalTensor *bias =
+    tflite::micro::GetEvalInput(context, node, kBias);
+  TfLiteEvalTensor *output =
+    tflite::micro::GetEvalOutput(context, node, kOutput);
+
+  const int batches =
+    tflite::micro::GetTensorShape(output).FlatSize() / data.out_features;
+  custom_op_kernels::SparseFc(
+    data.kernel, batches, tflite::micro::GetTensorData<int8_t>(input),
+    tflite::micro::GetTensorData<int8_t>(weights),
+    tflite::micro::GetTensorData<uint8_t>(bitmap),
+    tflite::micro::GetOptionalTensorData<int32_t>(bias),
+    tflite::micro::GetTensorData<int8_t>(output));
+  return kTfLiteOk;
+}
+
+} // namespace
+
+TFLMRegistration Register_SPARSE_FC() {
+  return tflite::micro::RegisterOp(Init, Prepare, Eval);
+}
@@ -0,0 +1,24 @@
+#ifndef _SPARSE_FC_H_
+#define _SPARSE_FC_H_
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+/*
+ * Custom op of an int8 FullyConnected layer with block-sparse weights,
+ * produced by tools/sparsify_fc.py. Each weight row is split into blocks of
+ * SPARSE_FC_BLOCK inputs, all-zero blocks are neither stored nor computed.
+ *
+ * Inputs: input, packed weights (int8, the non-zero blocks row after row,
+ * the last block of a row zero padded), bitmap (uint8, one bit per block,
+ * LSB first, rows padded to bytes), bias (int32, optional). Weights keep
+ * the per-tensor quantization of the dense ones, with a zero point of 0;
+ * Prepare rejects per-channel weights. Custom options, little endian: u8 version (1), u8 activation
+ * (TfLiteFusedActivation), u16 block size, u32 input features, u32 output
+ * features.
+ */
+#define SPARSE_FC_OP_NAME "GRC_SPARSE_FC"
+#define SPARSE_FC_BLOCK   4
+
+TFLMRegistration Register_SPARSE_FC();
+
+#endif // _SPARSE_FC_H_
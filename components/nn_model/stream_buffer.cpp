@@ -0,0 +1,148 @@
+#include "stream_buffer.h"
+
+#include <cstring>
+
+#include "custom_op_kernels.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/micro_context.h"
+
+namespace {
+
+constexpr int kInput = 0;
+constexpr int kState = 1;
+constexpr int kSeen = 2;
+constexpr int kOutput = 0;
+
+constexpr uint8_t kVersion = 2;
+constexpr size_t kOptionsSize = 7;
+
+struct OpData {
+  // Parsed custom options.
+  bool options_valid;
+  int pad_left;
+  int pad_right;
+  int skip;
+
+  custom_op_kernels::StreamBufferParams kernel;
+};
+
+template <typename T> T ReadLE(const uint8_t *p) {
+  T val;
+  memcpy(&val, p, sizeof(T));
+  return val;
+}
+
+void *Init(TfLiteContext *context, const char *buffer, size_t length) {
+  OpData *data = static_cast<OpData *>(
+    context->AllocatePersistentBuffer(context, sizeof(OpData)));
+  if (!data) {
+    return nullptr;
+  }
+  memset(data, 0, sizeof(OpData));
+  const uint8_t *options = reinterpret_cast<const uint8_t *>(buffer);
+  if (!options || length < kOptionsSize || options[0] != kVersion) {
+    return data;
+  }
+  data->pad_left = ReadLE<uint16_t>(&options[1]);
+  data->pad_right = ReadLE<uint16_t>(&options[3]);
+  data->skip = ReadLE<uint16_t>(&options[5]);
+  data->options_valid = true;
+  return data;
+}
+
+TfLiteStatus Prepare(TfLiteContext *context, TfLiteNode *node) {
+  OpData *data = static_cast<OpData *>(node->user_data);
+  TF_LITE_ENSURE(context, data != nullptr);
+  if (!data->options_valid) {
+    TF_LITE_KERNEL_LOG(context, "%s: bad options", STREAM_BUFFER_OP_NAME);
+    return kTfLiteError;
+  }
+  TF_LITE_ENSURE_EQ(context, node->inputs->size, data->skip ? 3 : 2);
+  TF_LITE_ENSURE_EQ(context, node->outputs->size, 1);
+
+  tflite::MicroContext *micro_context = tflite::GetMicroContext(context);
+  TfLiteTensor *input = micro_context->AllocateTempInputTensor(node, kInput);
+  TfLiteTensor *state = micro_context->AllocateTempInputTensor(node, kState);
+  TfLiteTensor *output = micro_context->AllocateTempOutputTensor(node, kOutput);
+  TF_LITE_ENSURE(context, input && state && output);
+  TF_LITE_ENSURE(context, input->type == kTfLiteInt8 ||
+                            input->type == kTfLiteFloat32);
+  TF_LITE_ENSURE_TYPES_EQ(context, state->type, input->type);
+  TF_LITE_ENSURE_TYPES_EQ(context, output->type, input->type);
+  TF_LITE_ENSURE(context, state->is_variable);
+  TF_LITE_ENSURE_EQ(context, tflite::NumDimensions(input), 4);
+  TF_LITE_ENSURE_EQ(context, tflite::NumDimensions(state), 4);
+  TF_LITE_ENSURE_EQ(context, tflite::NumDimensions(output), 4);
+
+  if (data->skip) {
+    TfLiteTensor *seen = micro_context->AllocateTempInputTensor(node, kSeen);
+    TF_LITE_ENSURE(context, seen != nullptr);
+    TF_LITE_ENSURE_TYPES_EQ(context, seen->type, kTfLiteInt32);
+    TF_LITE_ENSURE(context, seen->is_variable);
+    TF_LITE_ENSURE_EQ(context, tflite::NumElements(seen), 1);
+    micro_context->DeallocateTempTfLiteTensor(seen);
+  }
+
+  // Rows are copied as they are, the next layer sees the input params.
+  custom_op_kernels::StreamBufferParams &kernel = data->kernel;
+  if (input->type == kTfLiteInt8) {
+    TF_LITE_ENSURE_EQ(context, state->params.zero_point,
+                      input->params.zero_point);
+    TF_LITE_ENSURE_EQ(context, output->params.zero_point,
+                      input->params.zero_point);
+    TF_LITE_ENSURE_EQ(context, state->params.scale, input->params.scale);
+    TF_LITE_ENSURE_EQ(context, output->params.scale, input->params.scale);
+    kernel.zero = static_cast<uint8_t>(input->params.zero_point);
+  }
+
+  const int width = tflite::SizeOfDimension(input, 2);
+  const int channels = tflite::SizeOfDimension(input, 3);
+  kernel.input_rows = tflite::SizeOfDimension(input, 1);
+  kernel.state_rows = tflite::SizeOfDimension(state, 1);
+  kernel.skip = data->skip;
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(input, 0), 1);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(state, 2), width);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(state, 3), channels);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(output, 1),
+                    kernel.state_rows);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(output, 2),
+                    width + data->pad_left + data->pad_right);
+  TF_LITE_ENSURE_EQ(context, tflite::SizeOfDimension(output, 3), channels);
+
+  const size_t pixel_bytes = input->bytes / (kernel.input_rows * width);
+  kernel.row_bytes = width * pixel_bytes;
+  kernel.left_bytes = data->pad_left * pixel_bytes;
+  kernel.right_bytes = data->pad_right * pixel_bytes;
+
+  micro_context->DeallocateTempTfLiteTensor(input);
+  micro_context->DeallocateTempTfLiteTensor(state);
+  micro_context->DeallocateTempTfLiteTensor(output);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Eval(TfLiteContext *context, TfLiteNode *node) {
+  const OpData &data = *static_cast<const OpData *>(node->user_data);
+  const TfLiteEvalTensor *input =
+    tflite::micro::GetEvalInput(context, node, kInput);
+  TfLiteEvalTensor *state =
+    tflite::micro::GetMutableEvalInput(context, node, kState);
+  TfLiteEvalTensor *seen =
+    data.skip ? tflite::micro::GetMutableEvalInput(context, node, kSeen)
+              : nullptr;
+  TfLiteEvalTensor *output =
+    tflite::micro::GetEvalOutput(context, node, kOutput);
+
+  custom_op_kernels::StreamBuffer(data.kernel, input->data.uint8,
+                                  state->data.uint8,
+                                  seen ? seen->data.i32 : nullptr,
+                                  output->data.uint8);
+  return kTfLiteOk;
+}
+
+} // namespace
+
+TFLMRegistration Register_STREAM_BUFFER() {
+  return tflite::micro::RegisterOp(Init, Prepare, Eval);
+}
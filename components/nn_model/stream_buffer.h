@@ -0,0 +1,29 @@
+#ifndef _STREAM_BUFFER_H_
+#define _STREAM_BUFFER_H_
+
+#include "tensorflow/lite/micro/micro_common.h"
+
+/*
+ * Custom op keeping the last rows of a time-major NHWC tensor across
+ * inferences, inserted by tools/stream_model.py in front of the layers with
+ * a time kernel. Each inference appends the rows of the input to the state
+ * and outputs the state, so the next layer computes only the output rows of
+ * the new input with VALID padding in time.
+ *
+ * The state starts as rows at the zero point, see nn_model_reset_state:
+ * they are the SAME padding in time before the first rows of the stream.
+ * Earlier layers compute skip rows of their own padding before those first
+ * rows, which are replaced by zero point rows as they come in.
+ *
+ * Inputs: input (1 x n x W x C), state (variable, 1 x rows x W x C, with the
+ * input quantization), seen (variable int32 of 1 element, the rows since
+ * the reset, only with skip rows). Output: 1 x rows x (W + left + right) x
+ * C, the width padded with zeros on both sides to stand for the SAME padding
+ * of the next layer. Custom options, little endian: u8 version (2), u16
+ * left, u16 right padding, u16 skip.
+ */
+#define STREAM_BUFFER_OP_NAME "GRC_STREAM_BUFFER"
+
+TFLMRegistration Register_STREAM_BUFFER();
+
+#endif // _STREAM_BUFFER_H_
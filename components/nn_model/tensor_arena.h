@@ -1,22 +1,101 @@
 #ifndef _TENSOR_ARENA_H_
 #define _TENSOR_ARENA_H_
 
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
 #include "esp_log.h"
+#include "sdkconfig.h"
+
+#include "tensorflow/lite/micro/micro_allocator.h"
 
+/*
+ * Tensor arenas of the loaded models. TFLM splits an arena into persistent
+ * allocations (tensor and op data, living as long as the interpreter) and
+ * scratch (activations and kernel buffers, only used during Invoke):
+ * - private: the model owns a single arena holding both;
+ * - shared scratch: the model owns its persistent region, the scratch region
+ *   is shared by every model in this mode. Such models must not run at the
+ *   same time, inference holds scratchLock() to enforce it.
+ */
 class TensorArena {
 public:
-  static uint8_t *getBuffer() {
+  static constexpr size_t kDefaultSize = 108 * 1024;
+  static constexpr size_t kDefaultPersistentSize = 32 * 1024;
+  // Slack over the measured usage when right-sizing, covers the alignment
+  // of a buffer moved by shrink().
+  static constexpr size_t kRightSizeMargin = 64;
+
+  // New private arena or persistent region of size bytes, the shared scratch
+  // region is allocated with the first persistent region. Free with
+  // release().
+  static uint8_t *allocate(size_t size, bool shared) {
+    if (shared) {
+      TensorArena &instance = getInstance();
+      std::lock_guard<std::mutex> lock(instance.scratch_mutex_);
+      if (!instance.scratch_) {
+        instance.scratch_ = new (std::nothrow) uint8_t[kSharedScratchSize_];
+        if (!instance.scratch_) {
+          ESP_LOGE(__FUNCTION__, "Unable to allocate shared scratch arena");
+          return nullptr;
+        }
+      }
+      instance.shared_users_++;
+    }
+    // malloc() for shrink().
+    uint8_t *buffer = static_cast<uint8_t *>(malloc(size));
+    if (!buffer) {
+      ESP_LOGE(__FUNCTION__, "Unable to allocate %u bytes arena", size);
+      release(nullptr, shared);
+    }
+    return buffer;
+  }
+
+  // Allocator over the first size bytes of a buffer from allocate(), and the
+  // shared scratch region for a persistent region.
+  static tflite::MicroAllocator *createAllocator(uint8_t *buffer, size_t size,
+                                                 bool shared) {
+    if (!shared)
+      return tflite::MicroAllocator::Create(buffer, size);
+    return tflite::MicroAllocator::Create(buffer, size, getInstance().scratch_,
+                                          kSharedScratchSize_);
+  }
+
+  // Shrink a buffer from allocate() to size bytes. The ESP-IDF heap trims
+  // the block in place, the buffer only moves if it could not.
+  static uint8_t *shrink(uint8_t *buffer, size_t size) {
+    uint8_t *shrunk = static_cast<uint8_t *>(realloc(buffer, size));
+    return shrunk ? shrunk : buffer;
+  }
+
+  // Free a buffer from allocate(), the scratch region goes with its last
+  // user.
+  static void release(uint8_t *buffer, bool shared) {
+    free(buffer);
+    if (!shared)
+      return;
     TensorArena &instance = getInstance();
-    if (!instance.used_) {
-      instance.used_ = true;
-      return instance.buffer_;
-    } else {
-      ESP_LOGW(__FUNCTION__, "Tensor arena buffer is used");
-      return nullptr;
+    std::lock_guard<std::mutex> lock(instance.scratch_mutex_);
+    if (--instance.shared_users_ == 0) {
+      delete[] instance.scratch_;
+      instance.scratch_ = nullptr;
     }
   }
-  static void releaseBuffer() { getInstance().used_ = false; }
-  static size_t getSize() { return kTensorArenaSize_; }
+
+  // Persistent bytes used in [buffer, buffer + size): persistent data grows
+  // down from the end, a probe allocation lands right below it. The probe
+  // stays allocated, only measure with an allocator that is then discarded.
+  static size_t persistentUsed(tflite::MicroAllocator *allocator,
+                               const uint8_t *buffer, size_t size) {
+    const uint8_t *probe =
+      static_cast<uint8_t *>(allocator->AllocatePersistentBuffer(1));
+    return probe ? buffer + size - probe : 0;
+  }
+
+  static std::mutex &scratchLock() { return getInstance().invoke_mutex_; }
+  static size_t getSharedScratchSize() { return kSharedScratchSize_; }
+
   TensorArena(TensorArena const &) = delete;
   void operator=(TensorArena const &) = delete;
 
@@ -25,15 +104,14 @@ private:
     static TensorArena instance;
     return instance;
   }
-  TensorArena() : used_(false) {
-    buffer_ = new uint8_t[kTensorArenaSize_];
-    if (!buffer_) {
-      ESP_LOGE(__FUNCTION__, "Unable to allocate tensor arena buffer");
-    }
-  }
-  bool used_;
-  uint8_t *buffer_;
-  static constexpr size_t kTensorArenaSize_ = 108 * 1024;
+  TensorArena() : scratch_(nullptr), shared_users_(0) {}
+  uint8_t *scratch_;
+  size_t shared_users_;
+  // scratch_mutex_ guards the region itself, invoke_mutex_ its contents.
+  std::mutex scratch_mutex_;
+  std::mutex invoke_mutex_;
+  static constexpr size_t kSharedScratchSize_ =
+    CONFIG_NN_MODEL_SHARED_SCRATCH_SIZE * 1024;
 };
 
-#endif // _TENSOR_ARENA_H_
\ No newline at end of file
+#endif // _TENSOR_ARENA_H_
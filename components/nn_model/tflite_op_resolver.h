@@ -1,9 +1,19 @@
 #ifndef _TFLITE_OP_RESOLVER_H_
 #define _TFLITE_OP_RESOLVER_H_
 
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_context.h"
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 
+#include "ds_conv_block.h"
+#include "sdkconfig.h"
+#include "sparse_fc.h"
+#include "stream_buffer.h"
+
+#include <cstring>
+
 class TFLiteOpResolver {
 public:
   static const tflite::MicroOpResolver &getInstance() {
@@ -14,15 +24,55 @@ public:
   void operator=(TFLiteOpResolver const &) = delete;
 
 private:
-  tflite::MicroMutableOpResolver<7> op_resolver_;
-  TFLiteOpResolver() {
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+  // Softmax copying its input: the output tensor holds the logits, which
+  // nn_model decides on.
+  static TfLiteStatus LogitsPrepare(TfLiteContext *context, TfLiteNode *node) {
+    tflite::MicroContext *micro_context = tflite::GetMicroContext(context);
+    TfLiteTensor *input = micro_context->AllocateTempInputTensor(node, 0);
+    TfLiteTensor *output = micro_context->AllocateTempOutputTensor(node, 0);
+    TF_LITE_ENSURE(context, input != nullptr && output != nullptr);
+    TF_LITE_ENSURE_TYPES_EQ(context, input->type, output->type);
+    TF_LITE_ENSURE_EQ(context, input->bytes, output->bytes);
+    micro_context->DeallocateTempTfLiteTensor(input);
+    micro_context->DeallocateTempTfLiteTensor(output);
+    return kTfLiteOk;
+  }
+  static TfLiteStatus LogitsEval(TfLiteContext *context, TfLiteNode *node) {
+    const TfLiteEvalTensor *input =
+      tflite::micro::GetEvalInput(context, node, 0);
+    TfLiteEvalTensor *output = tflite::micro::GetEvalOutput(context, node, 0);
+    size_t bytes = 0;
+    TF_LITE_ENSURE_STATUS(tflite::TfLiteEvalTensorByteLength(input, &bytes));
+    memcpy(output->data.raw, input->data.raw, bytes);
+    return kTfLiteOk;
+  }
+#endif
+
+  tflite::MicroMutableOpResolver<10> op_resolver_;
+  // Custom ops are registered by pointer.
+  TFLMRegistration ds_conv_block_;
+  TFLMRegistration sparse_fc_;
+  TFLMRegistration stream_buffer_;
+  TFLiteOpResolver()
+    : ds_conv_block_(Register_DS_CONV_BLOCK()),
+      sparse_fc_(Register_SPARSE_FC()),
+      stream_buffer_(Register_STREAM_BUFFER()) {
     op_resolver_.AddAveragePool2D();
     op_resolver_.AddConv2D();
     op_resolver_.AddDepthwiseConv2D();
     op_resolver_.AddFullyConnected();
     op_resolver_.AddRelu();
+#if CONFIG_NN_MODEL_LOGIT_DECISION
+    op_resolver_.AddSoftmax(
+      tflite::micro::RegisterOp(nullptr, LogitsPrepare, LogitsEval));
+#else
     op_resolver_.AddSoftmax();
+#endif
     op_resolver_.AddReshape();
+    op_resolver_.AddCustom(DS_CONV_BLOCK_OP_NAME, &ds_conv_block_);
+    op_resolver_.AddCustom(SPARSE_FC_OP_NAME, &sparse_fc_);
+    op_resolver_.AddCustom(STREAM_BUFFER_OP_NAME, &stream_buffer_);
   }
 };
 
@@ -10,9 +10,16 @@ static const char *TAG = "KWS";
 static TaskHandle_t xTaskHandle = NULL;
 static nn_model_handle_t s_model_handle = NULL;
 
+#if CONFIG_MODELS_FROM_PARTITION
+// Model and labels are looked up by name in the model pack.
+static const unsigned char *kws_model_ptr = NULL;
+static const char **kws_labels = NULL;
+static unsigned int kws_labels_num = 0;
+#else
 extern const unsigned char *kws_model_ptr;
 extern const char *kws_labels[];
 extern unsigned int kws_labels_num;
+#endif
 
 static void kws_event_task(void *pv) {
   nn_model_handle_t model_handle = static_cast<nn_model_handle_t>(pv);
@@ -48,6 +55,7 @@ int initKWS() {
                       .labels_num = kws_labels_num,
                       .is_quantized = false,
                       .inference_threshold = KWS_INFERENCE_THRESHOLD,
+                      .model_name = "kws",
                     }) < 0) {
     ESP_LOGE(TAG, "KWS model init error");
     return -1;
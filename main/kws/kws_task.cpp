@@ -5,9 +5,11 @@
 #include "esp_vad.h"
 
 #include "audio_preprocessor.h"
+#include "static_audio_preprocessor.h"
 #include "i2s_rx_slot.h"
 #include "kws_task.h"
 #include "mic_reader.h"
+#include "nn_engine.h"
 
 static const char *TAG = "kws_task";
 
@@ -21,9 +23,19 @@ EventGroupHandle_t xKWSEventGroup = NULL;
 static TaskHandle_t xVADTaskHandle = NULL;
 static TaskHandle_t xKWSTaskHandle = NULL;
 
+#if CONFIG_PREPROCESSING_FIXED_POINT
+typedef AudioPreprocessor kws_preprocessor_t;
+#else
+typedef StaticAudioPreprocessor<KWS_FRAME_LEN, KWS_NUM_FBANK_BINS, KWS_NUM_MFCC,
+                                KWS_MEL_LOW_FREQ, KWS_MEL_HIGH_FREQ>
+  kws_preprocessor_t;
+#endif
+
 struct kws_task_param_t {
   nn_model_handle_t model_handle = NULL;
-  AudioPreprocessor *pp = NULL;
+  // Infers a word while the next one is preprocessed.
+  nn_engine_handle_t engine = NULL;
+  kws_preprocessor_t *pp = NULL;
 } static s_kws_task_params;
 
 static void *s_agc_handle = NULL;
@@ -37,7 +49,6 @@ static vad_handle_t s_vad_handle = NULL;
 
 #define KWS_FRAME_SZ          KWS_FRAME_LEN *ELEM_BYTES
 #define KWS_FRAME_SHIFT_BYTES KWS_FRAME_SHIFT *ELEM_BYTES
-#define MFCC_BUF_SZ           (KWS_FRAME_NUM * KWS_NUM_MFCC * sizeof(float))
 #define MFCC_PROC_FRAME_NUM   (KWS_FRAME_SHIFT / FRAME_LEN)
 
 #define PROC_BUF_SZ        KWS_FRAME_SZ
@@ -128,11 +139,34 @@ static void vad_task(void *pv) {
   }
 }
 
+// Log and post the category of a completed word.
+static void report_word(nn_model_handle_t model,
+                        const nn_engine_result_t &engine_result, size_t word) {
+  if (engine_result.models_num == 0) {
+    ESP_LOGE(TAG, "inference error");
+    return;
+  }
+  const nn_engine_model_result_t &word_result = engine_result.models[0];
+  const int category = word_result.category;
+  const float best_score =
+    word_result.scores_num
+      ? *std::max_element(word_result.scores,
+                          word_result.scores + word_result.scores_num)
+      : 0.0f;
+  char result[32] = {0};
+  nn_model_get_label(model, category, result, sizeof(result));
+  ESP_LOGI(TAG, ">> kws[%d]=%s (%.2f), %lld us", word, result, best_score,
+           engine_result.latency_us);
+  xQueueSend(xKWSResultQueue, &category, 0);
+}
+
 void kws_task(void *pv) {
   kws_task_param_t *params = static_cast<kws_task_param_t *>(pv);
-  AudioPreprocessor *preprocessor = params->pp;
+  kws_preprocessor_t *preprocessor = params->pp;
   nn_model_handle_t model = params->model_handle;
-  uint8_t proc_buf[PROC_BUF_SZ] = {0};
+  nn_engine_handle_t engine = params->engine;
+  audio_t proc_buf[KWS_FRAME_LEN] = {0};
+  audio_t *half_proc_buf = &proc_buf[KWS_FRAME_SHIFT];
 
   xStreamBufferSetTriggerLevel(xWordFramesBuffer, KWS_FRAME_SHIFT_BYTES);
 
@@ -145,11 +179,11 @@ void kws_task(void *pv) {
     }
     ESP_LOGD(TAG, "recogninze req_words=%d", req_words);
 
-    float *mfcc_buffer = new float[req_words * KWS_FRAME_NUM * KWS_NUM_MFCC];
-    memset(mfcc_buffer, 0, req_words * MFCC_BUF_SZ);
-
     i2s_rx_slot_start();
     size_t det_words = 0;
+    size_t pending = 0;
+    size_t reported = 0;
+    nn_engine_result_t engine_result;
     for (; det_words < req_words;) {
       WordDesc_t word = {.frame_num = 0, .max_abs = 0};
       while (xQueueReceive(xWordQueue, &word, pdMS_TO_TICKS(1)) == pdFAIL) {
@@ -165,8 +199,15 @@ void kws_task(void *pv) {
         ESP_LOGD(TAG, "got word: frame_num=%d, max_abs=%d", word.frame_num,
                  word.max_abs);
       }
+      // Words complete in order. Reading them before taking a buffer keeps
+      // the engine from blocking on a full result queue.
+      for (; pending && nn_engine_get_result(engine, &engine_result, 0) == 0;
+           pending--) {
+        report_word(model, engine_result, reported++);
+      }
+      // Waits for the inference of the word before the previous one.
       float *mfcc_coeffs =
-        &mfcc_buffer[det_words * KWS_FRAME_NUM * KWS_NUM_MFCC];
+        static_cast<float *>(nn_engine_get_buffer(engine, portMAX_DELAY));
       memset(proc_buf, 0, PROC_BUF_SZ);
 
       const int64_t t1 = esp_timer_get_time();
@@ -179,30 +220,26 @@ void kws_task(void *pv) {
                                                  KWS_FRAME_SHIFT_BYTES, 0);
       ESP_LOGV(TAG, "recv bytes=%d", xReceivedBytes);
 
-      audio_t *half_proc_buf = (audio_t *)&proc_buf[KWS_FRAME_SHIFT_BYTES];
-
+      // One hop at a time, a frame is computed when its last hop got at
+      // least one sample, the tail is zero padded.
       size_t proc_frames = 0;
-      for (; proc_frames < mfcc_frames;) {
+      for (; proc_frames < mfcc_frames; proc_frames++) {
         const auto xReceivedBytes = xStreamBufferReceive(
           xWordFramesBuffer, half_proc_buf, KWS_FRAME_SHIFT_BYTES, 0);
         ESP_LOGV(TAG, "recv bytes=%d", xReceivedBytes);
+        if (xReceivedBytes == 0) {
+          break;
+        }
 
-        preprocessor->MfccCompute((audio_t *)proc_buf,
-                                  &mfcc_coeffs[proc_frames * KWS_NUM_MFCC],
-                                  word.max_abs);
+        preprocessor->MfccCompute(
+          proc_buf, &mfcc_coeffs[proc_frames * KWS_NUM_MFCC], word.max_abs);
 
         memmove(proc_buf, half_proc_buf, KWS_FRAME_SHIFT_BYTES);
         memset(half_proc_buf, 0, KWS_FRAME_SHIFT_BYTES);
-
-        if (xReceivedBytes == 0) {
-          break;
-        } else {
-          proc_frames++;
-        }
       }
 
-      memset(proc_buf, 0, PROC_BUF_SZ);
-      for (size_t i = mfcc_frames; i < KWS_FRAME_NUM; i++) {
+      // Frames missing from the stream count as silence too.
+      for (size_t i = proc_frames; i < KWS_FRAME_NUM; i++) {
         memcpy(&mfcc_coeffs[i * KWS_NUM_MFCC], silence_mfcc_coeffs,
                KWS_NUM_MFCC * sizeof(float));
       }
@@ -213,31 +250,32 @@ void kws_task(void *pv) {
         xStreamBufferReset(xWordFramesBuffer);
         ESP_LOGD(TAG, "cleared %d frames", word.frame_num - WORD_BUF_FRAME_NUM);
       }
+      nn_engine_submit(engine, mfcc_coeffs, NULL);
+      pending++;
       det_words++;
     }
     ESP_LOGD(TAG, "detected words %d out of %d requested", det_words,
              req_words);
 
-    for (size_t i = 0; i < det_words; i++) {
-      float *mfcc_coeffs = &mfcc_buffer[i * KWS_FRAME_NUM * KWS_NUM_MFCC];
-      char result[32] = {0};
-      int category = -1;
-      if (nn_model_inference(model, mfcc_coeffs, KWS_FEATURES_LEN, &category) <
-          0) {
-        ESP_LOGE(TAG, "inference error");
-        continue;
-      }
-      nn_model_get_label(model, category, result, sizeof(result));
-      ESP_LOGI(TAG, ">> kws[%d]=%s", det_words, result);
-      xQueueSend(xKWSResultQueue, &category, 0);
+    for (; pending; pending--) {
+      nn_engine_get_result(engine, &engine_result, portMAX_DELAY);
+      report_word(model, engine_result, reported++);
+    }
+#if CONFIG_NN_MODEL_PROFILER
+    if (det_words) {
+      nn_model_profiler_dump(model, "kws", false);
     }
+#endif
 
   CLEANUP:
+    // Words of a canceled request are still being inferred.
+    for (; pending; pending--) {
+      nn_engine_get_result(engine, &engine_result, portMAX_DELAY);
+    }
     xQueueReceive(xKWSRequestQueue, &req_words, 0);
     i2s_rx_slot_stop();
     xQueueReset(xWordQueue);
     xStreamBufferReset(xWordFramesBuffer);
-    delete[] mfcc_buffer;
     xEventGroupSetBits(xKWSEventGroup, KWS_STOP_MSK);
   }
 }
@@ -311,10 +349,39 @@ int kws_task_init(kws_task_conf_t conf) {
     return -1;
   }
 
+#if CONFIG_PREPROCESSING_FIXED_POINT
   s_kws_task_params.pp =
     new AudioPreprocessor(KWS_NUM_MFCC, KWS_FRAME_LEN, KWS_NUM_FBANK_BINS,
-                          KWS_MEL_LOW_FREQ, KWS_MEL_HIGH_FREQ);
+                          KWS_MEL_LOW_FREQ, KWS_MEL_HIGH_FREQ,
+                          AudioPreprocessor::Arithmetic::Fixed);
+#else
+  s_kws_task_params.pp = new kws_preprocessor_t();
+#endif
+  if (!s_kws_task_params.pp->IsReady()) {
+    ESP_LOGE(TAG, "Error initializing the KWS preprocessor");
+    return -1;
+  }
   s_kws_task_params.model_handle = conf.model_handle;
+  nn_model_tensor_t input;
+  if (nn_model_get_input(conf.model_handle, &input) < 0 ||
+      input.bytes != KWS_FEATURES_LEN * (input.type == NN_MODEL_TENSOR_INT8
+                                           ? sizeof(int8_t)
+                                           : sizeof(float))) {
+    ESP_LOGE(TAG, "KWS model input must be %d features", KWS_FEATURES_LEN);
+    return -1;
+  }
+  // MFCC are floats, quantized by the engine for a quantized model.
+  if (nn_engine_create(&s_kws_task_params.engine,
+                       nn_engine_config_t{.models = {conf.model_handle},
+                                          .models_num = 1,
+                                          .float_input = true,
+                                          .budget_us = 0,
+                                          .core_id = tskNO_AFFINITY,
+                                          .priority = 1,
+                                          .result_queue = NULL}) < 0) {
+    ESP_LOGE(TAG, "Error creating KWS engine");
+    return -1;
+  }
   xReturned =
     xTaskCreate(kws_task, "kws_task", configMINIMAL_STACK_SIZE + 1024 * 2,
                 &s_kws_task_params, 1, &xKWSTaskHandle);
@@ -376,6 +443,8 @@ void kws_task_release() {
     vTaskDelete(xKWSTaskHandle);
     xKWSTaskHandle = NULL;
   }
+  nn_engine_release(s_kws_task_params.engine);
+  s_kws_task_params.engine = NULL;
   if (s_kws_task_params.pp) {
     delete s_kws_task_params.pp;
     s_kws_task_params.pp = NULL;
@@ -1,8 +1,12 @@
 #include "App.hpp"
 #include "git_version.h"
+#include "real_fft.h"
 
 extern "C" void app_main(void) {
   printf("VERSION: %s\n", VERSION_STRING);
+#if CONFIG_AUDIO_PREPROCESSOR_FFT_BENCHMARK
+  real_fft_benchmark(100);
+#endif
   App app;
   app.run();
 }
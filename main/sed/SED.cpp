@@ -3,11 +3,22 @@
 #include "git_version.h"
 #include "sed_task.h"
 
+#include <algorithm>
+
 #ifndef _countof
 #define _countof(arr) (sizeof(arr) / sizeof(arr[0]))
 #endif
 
 static constexpr char TAG[] = "SED";
+
+#if CONFIG_MODELS_FROM_PARTITION
+// Models and labels are looked up by name in the model pack.
+#define SED_MODEL_DATA(model) .model_ptr = NULL, .labels = NULL, .labels_num = 0
+#else
+#define SED_MODEL_DATA(model)                                                  \
+  .model_ptr = sed_##model##_model_ptr, .labels = sed_##model##_labels,        \
+  .labels_num = sed_##model##_labels_num
+
 extern const unsigned char *sed_baby_cry_model_ptr;
 extern const char *sed_baby_cry_labels[];
 extern unsigned int sed_baby_cry_labels_num;
@@ -23,35 +34,55 @@ extern unsigned int sed_bark_labels_num;
 extern const unsigned char *sed_coughing_model_ptr;
 extern const char *sed_coughing_labels[];
 extern unsigned int sed_coughing_labels_num;
+#endif
 
-static nn_model_handle_t s_model_handle = NULL;
-
-struct {
+struct model_desc_t {
   const char *name;
   const unsigned char *model_ptr;
   const char **labels;
   unsigned int labels_num;
+  int category;
+  float threshold;
+  size_t window;
+  size_t detect_count;
   int mic_gain;
-} static const model_desc {
+};
+
+static const model_desc_t model_descs[] = {
 #if CONFIG_SOUND_EVENTS_BABY_CRY
-  .name = "baby_cry", .model_ptr = sed_baby_cry_model_ptr,
-  .labels = sed_baby_cry_labels, .labels_num = sed_baby_cry_labels_num,
-  .mic_gain = 25,
-#elif CONFIG_SOUND_EVENTS_GLASS_BREAKING
-  .name = "glass_breaking", .model_ptr = sed_glass_breaking_model_ptr,
-  .labels = sed_glass_breaking_labels,
-  .labels_num = sed_glass_breaking_labels_num, .mic_gain = 6,
-#elif CONFIG_SOUND_EVENTS_BARK
-  .name = "bark", .model_ptr = sed_bark_model_ptr, .labels = sed_bark_labels,
-  .labels_num = sed_bark_labels_num, .mic_gain = 20,
-#elif CONFIG_SOUND_EVENTS_COUGHING
-  .name = "coughing", .model_ptr = sed_coughing_model_ptr,
-  .labels = sed_coughing_labels, .labels_num = sed_coughing_labels_num,
-  .mic_gain = 25,
-#else
-#error "set sound events type"
+  {.name = "baby_cry", SED_MODEL_DATA(baby_cry), .category = 2,
+   .threshold = SED_INFERENCE_THRESHOLD, .window = 3, .detect_count = 3,
+   .mic_gain = 25},
+#endif
+#if CONFIG_SOUND_EVENTS_GLASS_BREAKING
+  {.name = "glass_breaking", SED_MODEL_DATA(glass_breaking), .category = 2,
+   .threshold = SED_INFERENCE_THRESHOLD, .window = 3, .detect_count = 3,
+   .mic_gain = 6},
+#endif
+#if CONFIG_SOUND_EVENTS_BARK
+  {.name = "bark", SED_MODEL_DATA(bark), .category = 2,
+   .threshold = SED_INFERENCE_THRESHOLD, .window = 3, .detect_count = 3,
+   .mic_gain = 20},
+#endif
+#if CONFIG_SOUND_EVENTS_COUGHING
+  {.name = "coughing", SED_MODEL_DATA(coughing), .category = 2,
+   .threshold = SED_INFERENCE_THRESHOLD, .window = 3, .detect_count = 3,
+   .mic_gain = 25},
 #endif
 };
+#if !(CONFIG_SOUND_EVENTS_BABY_CRY || CONFIG_SOUND_EVENTS_GLASS_BREAKING ||  \
+      CONFIG_SOUND_EVENTS_BARK || CONFIG_SOUND_EVENTS_COUGHING)
+#error "set sound events type"
+#endif
+
+static constexpr size_t s_models_num = _countof(model_descs);
+static_assert(s_models_num <= SED_MODELS_MAX, "too many SED models");
+static nn_model_handle_t s_model_handles[s_models_num] = {NULL};
+
+// The name of a single model, "SED" for a bank.
+static const char *header_name() {
+  return s_models_num == 1 ? model_descs[0].name : "SED";
+}
 
 namespace SED {
 struct Main : State {
@@ -66,7 +97,7 @@ struct Main : State {
     app->p_display->print_header(
       "%s"
       " " TOSTRING(MAJOR_VERSION) "." TOSTRING(MINOR_VERSION),
-      model_desc.name);
+      header_name());
     app->p_display->print_string("OFF");
     app->p_display->send();
   }
@@ -76,28 +107,32 @@ struct Main : State {
   }
   void update(App *app) override final {
     static char label[32];
-    static int category;
-    if (xQueuePeek(xSEDResultQueue, &category, 0) == pdPASS) {
+    static sed_result_t result;
+    if (xQueuePeek(xSEDResultQueue, &result, 0) == pdPASS) {
       xEventGroupSetBits(xStatusEventGroup, STATUS_UNLOCKED_MSK);
       gpio_set_level(LOCK_PIN, 1);
       gpio_set_level(LOCK_PIN_INV, 0);
-      nn_model_get_label(s_model_handle, category, label, sizeof(label));
+      nn_model_get_label(s_model_handles[result.model], result.category, label,
+                         sizeof(label));
       ESP_LOGI(TAG, "Detected: %s", label);
       app->p_display->print_header(
         "%s"
         " " TOSTRING(MAJOR_VERSION) "." TOSTRING(MINOR_VERSION),
-        model_desc.name);
-      app->p_display->print_string("ON");
+        header_name());
+      if (s_models_num == 1)
+        app->p_display->print_string("ON");
+      else
+        app->p_display->print_string("%s", label);
       app->p_display->send();
       vTaskDelay(pdMS_TO_TICKS(1000));
-      xQueueReceive(xSEDResultQueue, &category, 0);
+      xQueueReceive(xSEDResultQueue, &result, 0);
       gpio_set_level(LOCK_PIN, 0);
       gpio_set_level(LOCK_PIN_INV, 1);
       xEventGroupClearBits(xStatusEventGroup, STATUS_UNLOCKED_MSK);
       app->p_display->print_header(
         "%s"
         " " TOSTRING(MAJOR_VERSION) "." TOSTRING(MINOR_VERSION),
-        model_desc.name);
+        header_name());
       app->p_display->print_string("OFF");
       app->p_display->send();
     }
@@ -108,26 +143,49 @@ struct Main : State {
 void releaseScenario(App *app) {
   ESP_LOGI(TAG, "Exiting SED scenairo");
   sed_task_release();
-  if (s_model_handle) {
-    nn_model_release(s_model_handle);
-    s_model_handle = NULL;
+  for (size_t i = 0; i < s_models_num; i++) {
+    if (s_model_handles[i]) {
+      nn_model_release(s_model_handles[i]);
+      s_model_handles[i] = NULL;
+    }
   }
 }
 
 void initScenario(App *app) {
-  ESP_LOGI(TAG, "Entering SED (%s) scenairo", model_desc.name);
-  int errors = nn_model_init(&s_model_handle,
-                             nn_model_config_t{
-                               .model_ptr = model_desc.model_ptr,
-                               .labels = model_desc.labels,
-                               .labels_num = model_desc.labels_num,
-                               .is_quantized = true,
-                               .inference_threshold = SED_INFERENCE_THRESHOLD,
-                             }) < 0;
-  errors += sed_task_init(sed_task_conf_t{
-              .model_handle = s_model_handle,
-              .mic_gain = model_desc.mic_gain,
-            }) < 0;
+  ESP_LOGI(TAG, "Entering SED (%s) scenairo", header_name());
+  int errors = 0;
+  sed_task_conf_t conf = {.models_num = s_models_num};
+  conf.mic_gain = model_descs[0].mic_gain;
+  for (size_t i = 0; i < s_models_num; i++) {
+    const model_desc_t &desc = model_descs[i];
+    ESP_LOGI(TAG, "model %d: %s", i, desc.name);
+    // Models taking turns on the same worker share the scratch arena.
+    const bool shared_scratch =
+      SED_MODEL_WORKER(i) == 0 && s_models_num > SED_WORKERS_NUM;
+    errors += nn_model_init(&s_model_handles[i],
+                            nn_model_config_t{
+                              .model_ptr = desc.model_ptr,
+                              .labels = desc.labels,
+                              .labels_num = desc.labels_num,
+                              .is_quantized = true,
+                              .inference_threshold = desc.threshold,
+                              .arena_mode = shared_scratch
+                                              ? NN_MODEL_ARENA_SHARED_SCRATCH
+                                              : NN_MODEL_ARENA_PRIVATE,
+                              .model_name = desc.name,
+                            }) < 0;
+    conf.models[i] = sed_model_conf_t{
+      .model_handle = s_model_handles[i],
+      .category = desc.category,
+      .window = desc.window,
+      .detect_count = desc.detect_count,
+    };
+    // One microphone for all: the lowest gain keeps the loudest events
+    // from clipping.
+    conf.mic_gain = std::min(conf.mic_gain, desc.mic_gain);
+  }
+  if (!errors)
+    errors += sed_task_init(conf) < 0;
   if (errors) {
     ESP_LOGE(TAG, "SED init errors=%d", errors);
     app->transition(nullptr);
@@ -1,3961 +0,0 @@
-const unsigned char sed_baby_cry_ds_cnn_quantized_tflite[] = {
-  0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x30, 0x60, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x68, 0xb8, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x64, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x9a, 0x9f, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xdc, 0xff, 0xff, 0xff, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
-  0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00,
-  0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x5f, 0x00, 0x00, 0x40, 0x5f, 0x00, 0x00, 0x20, 0x5f, 0x00, 0x00,
-  0x08, 0x5f, 0x00, 0x00, 0xec, 0x5e, 0x00, 0x00, 0x1c, 0x5e, 0x00, 0x00,
-  0x0c, 0x5d, 0x00, 0x00, 0xfc, 0x4c, 0x00, 0x00, 0xec, 0x4b, 0x00, 0x00,
-  0x9c, 0x49, 0x00, 0x00, 0x8c, 0x48, 0x00, 0x00, 0x7c, 0x38, 0x00, 0x00,
-  0x6c, 0x37, 0x00, 0x00, 0x1c, 0x35, 0x00, 0x00, 0x0c, 0x34, 0x00, 0x00,
-  0xfc, 0x23, 0x00, 0x00, 0xec, 0x22, 0x00, 0x00, 0x9c, 0x20, 0x00, 0x00,
-  0x8c, 0x1f, 0x00, 0x00, 0x7c, 0x0f, 0x00, 0x00, 0x6c, 0x0e, 0x00, 0x00,
-  0x1c, 0x0c, 0x00, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-  0xf4, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
-  0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
-  0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xae, 0xa0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x32, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x12, 0xa1, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
-  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x4a, 0xff, 0xff, 0x64, 0x4a, 0xff, 0xff, 0x68, 0x4a, 0xff, 0xff,
-  0x6c, 0x4a, 0xff, 0xff, 0x70, 0x4a, 0xff, 0xff, 0x74, 0x4a, 0xff, 0xff,
-  0x78, 0x4a, 0xff, 0xff, 0x7c, 0x4a, 0xff, 0xff, 0x80, 0x4a, 0xff, 0xff,
-  0x84, 0x4a, 0xff, 0xff, 0x88, 0x4a, 0xff, 0xff, 0x8c, 0x4a, 0xff, 0xff,
-  0x90, 0x4a, 0xff, 0xff, 0x94, 0x4a, 0xff, 0xff, 0x66, 0xa1, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xec, 0x3b, 0xcd, 0xdf,
-  0x0b, 0xb4, 0xfe, 0x35, 0xf6, 0xea, 0xdc, 0x4c, 0x96, 0x16, 0xf4, 0x04,
-  0x81, 0xa0, 0x9d, 0xc0, 0xf1, 0xe1, 0x25, 0x24, 0xc1, 0xd5, 0xe9, 0xa2,
-  0xe6, 0xf8, 0xff, 0x3a, 0xdb, 0x24, 0x05, 0x39, 0xfa, 0xc1, 0x31, 0xc4,
-  0x3c, 0xf3, 0xe8, 0xf2, 0x7f, 0xff, 0x08, 0xad, 0x7f, 0xea, 0x3b, 0xc0,
-  0x23, 0x1f, 0x29, 0xec, 0xe4, 0xe5, 0x1f, 0xdd, 0x32, 0x27, 0xd9, 0x2b,
-  0x0c, 0x32, 0xd7, 0xa0, 0xf8, 0x3d, 0xfd, 0xf2, 0x38, 0x33, 0x22, 0xe9,
-  0xd6, 0x0f, 0x47, 0xf9, 0xce, 0x81, 0xe0, 0x9e, 0x0f, 0x58, 0x07, 0x73,
-  0xcd, 0x04, 0x9a, 0x10, 0xc6, 0x0b, 0xd7, 0xe2, 0xc3, 0x4d, 0x4b, 0x25,
-  0x4d, 0x9d, 0xc0, 0x19, 0x2a, 0xf2, 0x68, 0xdb, 0x07, 0xa7, 0x17, 0xf5,
-  0x0a, 0x37, 0xe6, 0x20, 0x18, 0xd1, 0x48, 0xc0, 0x53, 0xdd, 0xe2, 0x99,
-  0xf5, 0x09, 0x28, 0xbc, 0xe9, 0x25, 0x81, 0xf3, 0x2d, 0x00, 0x94, 0xbf,
-  0x85, 0x9e, 0xd3, 0xdb, 0xb5, 0x41, 0xda, 0xf6, 0xe7, 0xe5, 0x9d, 0x4d,
-  0x3b, 0xca, 0xf3, 0xc1, 0x18, 0xe6, 0xca, 0x91, 0x01, 0x79, 0x31, 0xe9,
-  0xc0, 0x2e, 0x07, 0x57, 0x08, 0xd5, 0xc4, 0x07, 0xe2, 0xf2, 0x2a, 0x02,
-  0xec, 0xe6, 0x32, 0xd6, 0x1f, 0x7f, 0x4e, 0x52, 0x47, 0xdf, 0x2b, 0x1f,
-  0xed, 0xb0, 0xb2, 0xe7, 0xfc, 0x23, 0xd1, 0x16, 0xab, 0x33, 0x0d, 0xd7,
-  0xc3, 0xd1, 0xbf, 0xdc, 0xff, 0xed, 0x1d, 0xf4, 0x0b, 0x03, 0x01, 0xa3,
-  0xda, 0xf7, 0xc5, 0xfe, 0xc0, 0xd2, 0x3f, 0xab, 0x81, 0xe8, 0xfd, 0xac,
-  0x2f, 0xdf, 0x19, 0xd8, 0xbc, 0x1f, 0x1a, 0xad, 0x2a, 0x19, 0x45, 0x5e,
-  0xd0, 0x4d, 0x3b, 0x57, 0x1f, 0x4d, 0xde, 0x56, 0x57, 0x7b, 0xaf, 0x30,
-  0x7f, 0x3b, 0x9b, 0x3a, 0x7e, 0x52, 0x1e, 0xfe, 0x3d, 0x22, 0xe4, 0x88,
-  0x5e, 0x05, 0x16, 0x0d, 0x3f, 0xe3, 0x29, 0xbd, 0x02, 0xba, 0x98, 0x4e,
-  0xdc, 0x25, 0x3b, 0x33, 0xc2, 0x8d, 0x98, 0xff, 0x2e, 0xdc, 0xcc, 0xba,
-  0x50, 0xcc, 0x63, 0xb3, 0x4b, 0x91, 0xe5, 0x38, 0x2d, 0xba, 0xa9, 0x34,
-  0xa0, 0xe9, 0x2a, 0x98, 0x17, 0xfc, 0x28, 0xc0, 0x26, 0x60, 0xde, 0xd5,
-  0xaf, 0x12, 0xec, 0xb3, 0xb3, 0xae, 0x07, 0x96, 0x81, 0x1c, 0x99, 0x0d,
-  0xd2, 0x19, 0xec, 0x44, 0xa0, 0x81, 0xc0, 0x9e, 0x97, 0xd2, 0xd3, 0x3a,
-  0xb5, 0x1f, 0xf4, 0x2a, 0x34, 0xec, 0x25, 0xc7, 0xee, 0xd7, 0xec, 0xce,
-  0x50, 0xb1, 0xf0, 0x49, 0x4d, 0x05, 0xe4, 0xe9, 0x35, 0xf8, 0xc7, 0x21,
-  0xf7, 0xfd, 0xe2, 0x0b, 0xc3, 0xe4, 0xeb, 0xdb, 0x4d, 0x7b, 0x09, 0x9c,
-  0x4c, 0x7a, 0x48, 0x17, 0x7f, 0xe9, 0x20, 0x11, 0xb8, 0xc5, 0xec, 0xba,
-  0xc7, 0xe1, 0xae, 0xb8, 0x17, 0x9d, 0xdd, 0xa5, 0x1a, 0x59, 0x58, 0x1f,
-  0x79, 0xe3, 0xba, 0xbb, 0x0e, 0x60, 0xfa, 0x45, 0x2d, 0xdc, 0xe3, 0xcf,
-  0x01, 0x1e, 0x23, 0x22, 0xfd, 0xdc, 0xce, 0xc8, 0x31, 0x18, 0x1f, 0xd7,
-  0xc6, 0xc6, 0xd4, 0xd3, 0xb5, 0xa3, 0x94, 0xec, 0xec, 0x18, 0xed, 0xfc,
-  0xd9, 0x02, 0xd8, 0xee, 0x0c, 0xe7, 0x35, 0x08, 0xf9, 0xf9, 0xa3, 0xd1,
-  0x81, 0xa7, 0xed, 0xb5, 0xb3, 0xdf, 0x8f, 0x71, 0xcb, 0x5c, 0x81, 0x6e,
-  0x4f, 0xc6, 0xb9, 0xc2, 0xb0, 0x9c, 0x99, 0x20, 0x06, 0xec, 0x0a, 0xb4,
-  0xf3, 0xbb, 0xab, 0x25, 0x59, 0x4c, 0x0f, 0xd5, 0x3c, 0xb6, 0x3e, 0xfe,
-  0xf7, 0xb4, 0x1c, 0x46, 0xff, 0x09, 0x64, 0xc7, 0x11, 0x14, 0x1e, 0xa4,
-  0x02, 0xe5, 0x53, 0x96, 0xb9, 0x53, 0x26, 0x14, 0x06, 0x06, 0x7f, 0x0c,
-  0xfd, 0x4f, 0xfc, 0xf6, 0xd6, 0x38, 0x25, 0xdd, 0x41, 0xd2, 0x5c, 0xbf,
-  0x01, 0xdb, 0x32, 0xde, 0x16, 0x0c, 0xe4, 0xa7, 0xd6, 0x07, 0x0a, 0xaf,
-  0xd7, 0xe7, 0x2c, 0xfa, 0x42, 0xfa, 0xe3, 0x1a, 0x7f, 0x1a, 0x0c, 0xfa,
-  0xdc, 0x0b, 0x96, 0x0e, 0x3b, 0x21, 0xbf, 0x3f, 0x05, 0xf5, 0xb5, 0xc1,
-  0x5c, 0x0a, 0xc1, 0xd5, 0x61, 0x4a, 0x02, 0x4e, 0x36, 0x34, 0xc4, 0xfd,
-  0xf2, 0x24, 0xda, 0xf0, 0xe1, 0xdb, 0xf7, 0x63, 0x38, 0x18, 0x40, 0xe9,
-  0xcb, 0xce, 0xda, 0x21, 0xcf, 0xb8, 0xac, 0xbd, 0xf5, 0x16, 0x2d, 0x81,
-  0xc6, 0x22, 0xf4, 0xc1, 0xe1, 0x03, 0x1a, 0xe8, 0x09, 0xcd, 0xfe, 0xea,
-  0x3b, 0x28, 0xcc, 0xb7, 0xf5, 0x35, 0xff, 0xc1, 0x09, 0x92, 0xcf, 0x09,
-  0x15, 0xc6, 0x81, 0x2b, 0xc4, 0x49, 0xcd, 0x16, 0xb9, 0xe4, 0x22, 0xb4,
-  0xf6, 0x95, 0x1e, 0xc7, 0xe2, 0xcf, 0x33, 0xa7, 0x9e, 0x12, 0xdb, 0x92,
-  0xad, 0xf4, 0x08, 0x41, 0xbd, 0xf8, 0x0c, 0x36, 0xcc, 0x0a, 0x2e, 0xfd,
-  0x50, 0xf8, 0x14, 0x26, 0x7f, 0x7f, 0xb6, 0x2c, 0x3e, 0xfb, 0xbb, 0x27,
-  0x0a, 0x74, 0x99, 0x59, 0xbe, 0xe4, 0xfd, 0x3b, 0x17, 0xfc, 0xbe, 0x24,
-  0xc5, 0x39, 0x9f, 0x16, 0xc7, 0xbe, 0xe4, 0xe4, 0x33, 0xe5, 0xf5, 0xde,
-  0xbd, 0xb9, 0x2c, 0xe1, 0xef, 0x48, 0xee, 0x41, 0x4c, 0xb4, 0x3b, 0xb2,
-  0x2e, 0x30, 0xec, 0x5a, 0x58, 0x96, 0x07, 0x45, 0x3f, 0x0f, 0x84, 0x26,
-  0xc2, 0xc1, 0x06, 0x81, 0xb3, 0x14, 0x14, 0x07, 0xb4, 0xb6, 0x40, 0xc4,
-  0xdf, 0x95, 0xd0, 0x8a, 0x2b, 0x51, 0x47, 0x9c, 0xe1, 0x0a, 0xce, 0x07,
-  0x21, 0xe6, 0x19, 0xd2, 0xc2, 0x01, 0xf3, 0xaa, 0xfa, 0x0e, 0xf5, 0xc3,
-  0x20, 0x0f, 0x09, 0x47, 0x50, 0x7f, 0xd6, 0x3b, 0x2c, 0x62, 0x07, 0xfb,
-  0xcf, 0xf6, 0xec, 0x1d, 0x19, 0xe2, 0xfc, 0xec, 0xf5, 0x1e, 0xfe, 0x14,
-  0x95, 0xea, 0xb4, 0x98, 0xf8, 0xb0, 0xdf, 0x81, 0x26, 0x29, 0x54, 0x61,
-  0xf7, 0x12, 0x45, 0x45, 0x05, 0xfa, 0x6a, 0x27, 0x51, 0xc8, 0x23, 0x35,
-  0x1d, 0xdd, 0x2c, 0x55, 0x94, 0xd1, 0xb9, 0x3a, 0xcc, 0xae, 0x93, 0x24,
-  0xdc, 0xb6, 0x2f, 0xe9, 0x37, 0xec, 0x11, 0xf9, 0xf9, 0xe8, 0x01, 0x20,
-  0xc4, 0xdc, 0x6d, 0xcd, 0x03, 0x03, 0x4f, 0x1f, 0xfa, 0xf4, 0x46, 0x1c,
-  0x13, 0x03, 0x7c, 0xe3, 0x92, 0x35, 0x7f, 0x72, 0x3b, 0x08, 0xeb, 0x4f,
-  0xe5, 0x18, 0xe3, 0x42, 0xca, 0x8a, 0x20, 0x50, 0x81, 0xef, 0xb6, 0x0b,
-  0x8d, 0xc8, 0xcb, 0x44, 0x1c, 0xf3, 0xef, 0xd7, 0x11, 0xc8, 0xba, 0xc6,
-  0xab, 0x17, 0x95, 0x06, 0x46, 0x52, 0xa0, 0x06, 0x51, 0x38, 0x33, 0xad,
-  0x87, 0x1c, 0xb9, 0x43, 0xbe, 0x2b, 0x8f, 0x00, 0x3f, 0x04, 0x47, 0xe5,
-  0x40, 0xf4, 0x4d, 0xaf, 0x18, 0x28, 0x10, 0xd3, 0x6f, 0xed, 0x01, 0xfa,
-  0x7f, 0xd8, 0x5d, 0xee, 0x5c, 0xc9, 0xe4, 0xa5, 0x54, 0xd3, 0xe6, 0x9e,
-  0xb8, 0x04, 0x35, 0x07, 0xeb, 0x1d, 0x32, 0x41, 0xef, 0x24, 0x23, 0xa3,
-  0x16, 0x15, 0xd2, 0x9b, 0xd5, 0x1b, 0x5e, 0x7f, 0xd6, 0xd3, 0x45, 0x21,
-  0x0a, 0x18, 0x20, 0x22, 0xd8, 0x06, 0x2e, 0xd6, 0xf0, 0x00, 0x06, 0x1b,
-  0xe9, 0xd9, 0xe5, 0x25, 0x28, 0xf6, 0xf6, 0x27, 0xe4, 0xf7, 0xe2, 0x1e,
-  0x1b, 0x07, 0xee, 0xd6, 0xf7, 0xd3, 0x19, 0xe9, 0x18, 0x06, 0xcd, 0xa4,
-  0x1d, 0xb8, 0x00, 0x2a, 0xfc, 0xb1, 0x24, 0x52, 0x2b, 0x42, 0x23, 0x45,
-  0x7f, 0x39, 0x4f, 0x0c, 0xc1, 0xd7, 0x3f, 0x59, 0xe2, 0x93, 0x37, 0xb1,
-  0x18, 0x0a, 0x97, 0xb1, 0xd3, 0xbe, 0xdd, 0x0e, 0x4f, 0x4f, 0xa7, 0xc4,
-  0xb2, 0xf6, 0xf8, 0x60, 0x9f, 0x0b, 0xbe, 0x16, 0x9a, 0xd4, 0x52, 0x2a,
-  0x81, 0xdb, 0x45, 0x39, 0x1e, 0x06, 0x02, 0xd8, 0xad, 0x19, 0xba, 0xe2,
-  0xdf, 0xcc, 0xd4, 0x18, 0x08, 0x24, 0xb6, 0x41, 0xef, 0xf9, 0x9c, 0x30,
-  0x16, 0xf3, 0xb8, 0x14, 0xe8, 0x1d, 0x0a, 0x1f, 0xdb, 0xe8, 0xde, 0x1b,
-  0x45, 0xd2, 0xf0, 0x1c, 0x7f, 0x32, 0x01, 0x62, 0x62, 0x98, 0x3f, 0xd2,
-  0x07, 0xe3, 0x1d, 0xec, 0xf2, 0x9b, 0x39, 0x07, 0xd6, 0xfa, 0x37, 0xd9,
-  0xc1, 0x0a, 0x39, 0x0c, 0xdd, 0xd4, 0x0c, 0xcf, 0xe8, 0xea, 0x50, 0x2b,
-  0xd6, 0x3c, 0x0b, 0xea, 0x01, 0xdc, 0x01, 0x1b, 0xd8, 0xf5, 0xec, 0x28,
-  0xf6, 0xe9, 0xeb, 0xf3, 0x0a, 0x2a, 0x13, 0x2e, 0xf6, 0xe0, 0xcd, 0x20,
-  0xdc, 0x3c, 0xa8, 0xc8, 0x18, 0x02, 0xa4, 0x1e, 0xb4, 0x81, 0xd3, 0xaf,
-  0x33, 0x23, 0xd1, 0xee, 0xdc, 0xda, 0xd9, 0x0c, 0x13, 0xf9, 0x29, 0x07,
-  0x36, 0xd6, 0x48, 0x01, 0x47, 0xf0, 0x17, 0xeb, 0xfe, 0x1f, 0x7f, 0x44,
-  0x19, 0xe2, 0x78, 0xcd, 0xb1, 0xcd, 0x3f, 0xc0, 0xbd, 0xc8, 0x46, 0x2a,
-  0xca, 0xa7, 0x30, 0x24, 0x52, 0xe5, 0x36, 0x3f, 0xd6, 0x14, 0x43, 0xe3,
-  0x48, 0x2b, 0x7f, 0x38, 0x15, 0xf4, 0x27, 0x43, 0x2c, 0xc4, 0x38, 0xfe,
-  0x18, 0x04, 0x1a, 0xcb, 0xc8, 0xba, 0x17, 0x33, 0x08, 0xef, 0x09, 0x11,
-  0xf0, 0xf9, 0x02, 0xd4, 0x2c, 0xc4, 0x36, 0x07, 0xb7, 0x05, 0xc0, 0xd6,
-  0xd1, 0xb7, 0x16, 0xbc, 0xdb, 0xc7, 0x55, 0x36, 0x1e, 0x57, 0x27, 0xcc,
-  0x21, 0xd1, 0xfb, 0x25, 0xf0, 0xca, 0x7f, 0x4f, 0x61, 0x57, 0xe9, 0x31,
-  0xff, 0x15, 0x28, 0x44, 0xf7, 0xb6, 0x6e, 0x4b, 0xec, 0xea, 0xe9, 0x47,
-  0x14, 0x50, 0xcd, 0xef, 0x63, 0x49, 0xca, 0xc8, 0x46, 0xf8, 0x2d, 0x81,
-  0x36, 0x0a, 0x12, 0xf5, 0xf3, 0x08, 0x14, 0xf9, 0xf8, 0xe0, 0xbb, 0x18,
-  0x99, 0xc1, 0xe6, 0xdd, 0x27, 0xb3, 0xfc, 0x0f, 0xe5, 0xf3, 0xe6, 0x94,
-  0xf6, 0xf1, 0xcc, 0xe9, 0xc1, 0x90, 0xee, 0x65, 0x3a, 0x30, 0x4b, 0x26,
-  0xf2, 0x95, 0x17, 0x67, 0xa5, 0xbf, 0x52, 0x3c, 0x56, 0xfb, 0x68, 0x9f,
-  0xa4, 0xaf, 0xd5, 0xc3, 0xcf, 0x46, 0x18, 0xa5, 0xda, 0x43, 0x50, 0xa9,
-  0x01, 0x6c, 0x34, 0x08, 0xc2, 0xe5, 0x7f, 0x42, 0xe5, 0x0b, 0xcd, 0x13,
-  0xf5, 0xab, 0x07, 0xbc, 0x48, 0x9c, 0x41, 0x81, 0xb0, 0x3f, 0xff, 0x03,
-  0x05, 0xae, 0xec, 0x0d, 0x9e, 0xc9, 0xc2, 0xed, 0xb9, 0x01, 0x0c, 0x81,
-  0xf6, 0xc2, 0x3d, 0x97, 0x59, 0x0d, 0xc1, 0x05, 0xe1, 0x31, 0x4d, 0x59,
-  0x27, 0xb4, 0xfb, 0x0e, 0x69, 0x2b, 0xfd, 0xa7, 0x3f, 0x37, 0xe9, 0x7f,
-  0x31, 0xb8, 0x49, 0x62, 0x55, 0xc3, 0x9a, 0xc8, 0x2b, 0xe1, 0xf9, 0x38,
-  0x3a, 0xb1, 0xae, 0x08, 0xa1, 0x9a, 0x9a, 0x19, 0xb2, 0x34, 0xcc, 0x0b,
-  0x69, 0x68, 0x05, 0xe6, 0xf8, 0xb2, 0x22, 0xdf, 0xf4, 0xee, 0x40, 0x36,
-  0x1d, 0x08, 0x2f, 0x22, 0x2f, 0x14, 0x31, 0x7f, 0xde, 0xd6, 0xce, 0x3d,
-  0xe8, 0xd2, 0x21, 0x11, 0xd7, 0xf4, 0xe6, 0x36, 0x25, 0xf1, 0xef, 0xe7,
-  0xdb, 0x1f, 0xf7, 0x09, 0x0a, 0xd4, 0xe8, 0x1b, 0xef, 0xa9, 0x12, 0x37,
-  0xfb, 0x0c, 0xd8, 0xbf, 0x9f, 0x65, 0x12, 0xf1, 0x3d, 0x0c, 0x1b, 0xe3,
-  0xba, 0x54, 0xe5, 0xfa, 0xfe, 0x29, 0xe2, 0xbf, 0xeb, 0x16, 0xe2, 0xc5,
-  0x81, 0x8e, 0x17, 0xba, 0x0c, 0xef, 0xe8, 0x99, 0xf9, 0xcd, 0x1c, 0x0c,
-  0x3b, 0x9f, 0xe2, 0x05, 0x9c, 0x2e, 0xe9, 0x18, 0x88, 0x27, 0xda, 0xaf,
-  0x02, 0xf2, 0x1e, 0x94, 0x22, 0xad, 0xcd, 0xee, 0x96, 0x5c, 0x5a, 0x31,
-  0xc7, 0xcc, 0xf2, 0x3a, 0x12, 0xdd, 0x06, 0x9e, 0x1d, 0x9e, 0x81, 0xd8,
-  0xba, 0x17, 0x33, 0xc8, 0xdf, 0x02, 0xb2, 0xe6, 0xd8, 0x22, 0xe6, 0xf1,
-  0xfc, 0xf0, 0x08, 0x15, 0xb4, 0x23, 0xd4, 0x16, 0xb1, 0x88, 0xcf, 0xa3,
-  0x12, 0xef, 0x81, 0xd5, 0xf4, 0xa9, 0xc1, 0x26, 0xd6, 0x2a, 0x1b, 0x40,
-  0x90, 0xd1, 0x2c, 0xe6, 0x82, 0x11, 0x13, 0xf1, 0x8f, 0xd1, 0x9b, 0xed,
-  0xe5, 0x22, 0xcd, 0xb9, 0xd5, 0x84, 0x9a, 0x23, 0xfd, 0xf4, 0xc5, 0x50,
-  0xb5, 0xe9, 0xd8, 0xe4, 0xdc, 0xfd, 0x5c, 0xe8, 0x9d, 0x3e, 0xda, 0xa7,
-  0xd8, 0x1c, 0xac, 0x4f, 0xf4, 0xbb, 0xec, 0x81, 0xe3, 0xf8, 0x62, 0x2e,
-  0xc0, 0x4e, 0xc5, 0x58, 0xf0, 0x5c, 0x93, 0x44, 0x40, 0x00, 0xca, 0x21,
-  0xe6, 0x04, 0xb8, 0x3e, 0x4f, 0x81, 0x45, 0x79, 0x2a, 0xa0, 0xff, 0x7b,
-  0xff, 0xea, 0x43, 0xea, 0xc0, 0xa6, 0x20, 0x38, 0x25, 0x92, 0x52, 0x1e,
-  0xb2, 0x34, 0xd1, 0xff, 0x3d, 0xc1, 0xb6, 0xe6, 0xab, 0x18, 0x81, 0xd4,
-  0x0f, 0xfe, 0x04, 0x9c, 0x17, 0xa8, 0x19, 0x33, 0x0e, 0x40, 0xa3, 0xc2,
-  0x2f, 0xb9, 0xe4, 0x5b, 0x36, 0xbb, 0xe0, 0xd5, 0x2c, 0x48, 0xe6, 0x42,
-  0xcc, 0xb4, 0xdc, 0x48, 0xa9, 0xad, 0xe0, 0xf5, 0xdf, 0x3f, 0x40, 0x7f,
-  0x9f, 0x29, 0xb9, 0xc3, 0x20, 0xf0, 0x3a, 0xb5, 0x96, 0x3a, 0x9d, 0xfc,
-  0x30, 0xdb, 0xf3, 0xf9, 0x0e, 0xe5, 0xb0, 0xe2, 0x9b, 0xc3, 0x33, 0xdf,
-  0xc1, 0x5c, 0x0a, 0xa9, 0xe5, 0x06, 0x0a, 0x41, 0x27, 0xbe, 0x94, 0xcc,
-  0x81, 0xe8, 0xb4, 0xef, 0xf5, 0xd6, 0x12, 0xa4, 0xb3, 0xce, 0xea, 0x04,
-  0x3a, 0x39, 0xee, 0xc3, 0xfe, 0xb4, 0xc1, 0xeb, 0x2d, 0x05, 0xfa, 0xc3,
-  0xb5, 0xb2, 0x0c, 0xac, 0x32, 0x0a, 0x3d, 0x2e, 0xf2, 0xcc, 0x38, 0x1b,
-  0x64, 0x5a, 0xd3, 0x00, 0x11, 0x30, 0xac, 0x2c, 0x11, 0x3d, 0x27, 0x21,
-  0x89, 0xba, 0xea, 0x19, 0xf5, 0x39, 0xe5, 0xb7, 0x3c, 0xe7, 0x9c, 0xc5,
-  0xdc, 0xf3, 0x81, 0x11, 0x1d, 0xd5, 0x87, 0x8d, 0xc8, 0x12, 0xcd, 0xa9,
-  0xe7, 0x4d, 0xcf, 0x20, 0xd8, 0x8c, 0x2c, 0xaf, 0xdc, 0xfe, 0x81, 0xb4,
-  0xdb, 0xcc, 0xc1, 0xac, 0xf3, 0xa5, 0x54, 0x20, 0xa0, 0xba, 0xd7, 0x13,
-  0x61, 0xd9, 0x95, 0xaf, 0x3c, 0x85, 0x49, 0xca, 0x3f, 0x4a, 0xe9, 0x82,
-  0xec, 0x5e, 0xe8, 0xb9, 0x01, 0x2b, 0x56, 0x1e, 0xe9, 0x2f, 0x7a, 0x71,
-  0xcf, 0x81, 0x98, 0xe2, 0xae, 0xa6, 0x43, 0xca, 0xf4, 0xeb, 0xbe, 0x22,
-  0x09, 0x24, 0xdf, 0x31, 0xfb, 0x20, 0xd6, 0xef, 0xaf, 0x0d, 0x38, 0x00,
-  0x31, 0x8f, 0x46, 0x2c, 0x57, 0x33, 0xb8, 0x58, 0xc3, 0x05, 0x6f, 0x21,
-  0x5b, 0x5f, 0x5e, 0x02, 0x8b, 0xa8, 0xd7, 0x4a, 0xd7, 0xc4, 0x3f, 0xa1,
-  0x25, 0x8c, 0xbd, 0x2d, 0x06, 0x49, 0xff, 0xaa, 0x14, 0x57, 0xcf, 0x26,
-  0x3d, 0x45, 0xab, 0xb0, 0x44, 0x8f, 0x17, 0xd2, 0xc1, 0x81, 0xdc, 0xdb,
-  0xad, 0x0b, 0x81, 0xe9, 0x20, 0x39, 0x9a, 0x33, 0xf9, 0x7f, 0x12, 0xfd,
-  0x21, 0x31, 0xe9, 0xe6, 0x32, 0x67, 0x35, 0x36, 0x00, 0x38, 0x16, 0x19,
-  0xe4, 0x37, 0x38, 0xe9, 0xdf, 0x2e, 0x10, 0x05, 0x1f, 0x40, 0xdc, 0xf6,
-  0xeb, 0x24, 0xf7, 0x02, 0x2a, 0xea, 0xcf, 0x22, 0xdb, 0xca, 0x0d, 0xf4,
-  0xa5, 0x8b, 0x81, 0xc0, 0x26, 0xdc, 0xc0, 0x27, 0xf8, 0x03, 0xd4, 0xcb,
-  0xbf, 0x0b, 0x31, 0x34, 0xb4, 0x31, 0xb0, 0xe7, 0xf8, 0x0e, 0x32, 0x19,
-  0x05, 0x25, 0xf7, 0x03, 0xfd, 0x26, 0xf2, 0xed, 0x37, 0x0d, 0x12, 0x0a,
-  0x21, 0xac, 0xfa, 0x34, 0x55, 0xda, 0xd7, 0x14, 0x15, 0xdb, 0x02, 0x7f,
-  0xd3, 0xf5, 0xfd, 0x5f, 0x22, 0xbf, 0xf6, 0x3f, 0x11, 0x0f, 0x09, 0x1f,
-  0x16, 0x16, 0x05, 0xf3, 0x08, 0x2f, 0xd3, 0x42, 0xc2, 0x28, 0xec, 0x0a,
-  0x43, 0xea, 0x05, 0x3b, 0xdd, 0xe3, 0xd4, 0x6c, 0xc9, 0x4f, 0xab, 0x2e,
-  0x9d, 0xdf, 0x4c, 0xc8, 0xdf, 0xa7, 0xe0, 0xf6, 0x3a, 0xa3, 0xfc, 0xfe,
-  0xea, 0x08, 0x11, 0xb6, 0xd0, 0xb2, 0x81, 0xcf, 0x9f, 0xc7, 0x01, 0xc8,
-  0x5b, 0x02, 0xd9, 0xf3, 0x16, 0x10, 0xc4, 0xd8, 0xd6, 0x4d, 0xf2, 0x16,
-  0xef, 0x3f, 0x3d, 0xb5, 0xf4, 0xd6, 0xd8, 0xa5, 0x07, 0x49, 0xe3, 0xd6,
-  0xaf, 0x07, 0xf2, 0x31, 0x31, 0x46, 0x65, 0x0f, 0x03, 0xcb, 0xb1, 0x36,
-  0xb0, 0xc1, 0x02, 0xd5, 0xbf, 0xa8, 0x59, 0xf2, 0xf2, 0x81, 0xae, 0xab,
-  0xf4, 0xfe, 0x4a, 0x49, 0x0c, 0xcb, 0x2e, 0xc5, 0x40, 0x07, 0x66, 0x06,
-  0x21, 0x42, 0xff, 0xea, 0x50, 0x15, 0x44, 0x1b, 0x5d, 0x0c, 0xde, 0x5b,
-  0xcf, 0xd5, 0x01, 0x06, 0xf2, 0xd4, 0xf8, 0x0d, 0x41, 0x1a, 0x7f, 0x45,
-  0x50, 0x23, 0x49, 0xfe, 0x3f, 0x14, 0xda, 0xe5, 0x94, 0xaa, 0x06, 0x9d,
-  0x54, 0x5f, 0xb8, 0x8e, 0xd8, 0x4d, 0x07, 0x2e, 0xb6, 0x3e, 0xd7, 0xea,
-  0x15, 0x09, 0xbc, 0x04, 0x81, 0x76, 0x48, 0xf9, 0xaf, 0x02, 0x1e, 0x91,
-  0xba, 0xcd, 0x78, 0xee, 0xb5, 0xec, 0x59, 0x98, 0x5d, 0x30, 0xc9, 0x55,
-  0xfa, 0xbb, 0xf4, 0x49, 0x9e, 0xbb, 0x18, 0x24, 0xb7, 0xfc, 0xc3, 0x9d,
-  0x32, 0x81, 0xcf, 0x8a, 0x10, 0x20, 0x2a, 0xd5, 0x40, 0x99, 0xdc, 0x43,
-  0xfe, 0xb3, 0xe9, 0x11, 0xff, 0xd9, 0x4b, 0xb9, 0xe3, 0x16, 0x09, 0x33,
-  0x3c, 0x48, 0xdb, 0xbf, 0xc7, 0x6e, 0x94, 0xd1, 0x14, 0xc4, 0x9f, 0x55,
-  0xf9, 0x37, 0xdc, 0xdc, 0xd2, 0x6a, 0x43, 0x21, 0x2a, 0x5c, 0x3e, 0xe3,
-  0xd6, 0x7f, 0x0f, 0x25, 0xe4, 0x22, 0xf0, 0x1a, 0xd8, 0x46, 0x31, 0x43,
-  0x95, 0x2b, 0x26, 0xf6, 0xa6, 0x32, 0x78, 0xed, 0xe0, 0xc6, 0xe2, 0xfd,
-  0x3a, 0xbd, 0xa4, 0xa1, 0x53, 0xc4, 0x92, 0x0d, 0x4e, 0x02, 0x81, 0xd5,
-  0x1d, 0xb1, 0xc8, 0x05, 0x38, 0xec, 0x15, 0xe3, 0x0a, 0x02, 0x11, 0x99,
-  0xa7, 0x9d, 0x4e, 0xa3, 0x95, 0x30, 0xb1, 0x03, 0xf7, 0x38, 0x19, 0xe1,
-  0x81, 0x45, 0x40, 0x34, 0xa4, 0x6b, 0x38, 0x4e, 0x1d, 0x61, 0x2b, 0x63,
-  0xd1, 0xc8, 0xb2, 0xf6, 0x2d, 0xad, 0xb1, 0xe9, 0x3f, 0x33, 0x1c, 0xcc,
-  0xae, 0xb1, 0x3c, 0xd8, 0x07, 0xab, 0xfa, 0xd8, 0xfe, 0xc0, 0xfc, 0x0f,
-  0xfe, 0xfc, 0xba, 0x07, 0x01, 0xde, 0xc4, 0x44, 0x04, 0xbf, 0xf0, 0x48,
-  0xb8, 0x5f, 0xe5, 0xe6, 0xbf, 0xfa, 0xcb, 0x9f, 0x81, 0x98, 0x46, 0xff,
-  0xd5, 0x40, 0x5f, 0x17, 0xf2, 0xa9, 0xe5, 0xf5, 0x0e, 0xb8, 0xd1, 0x41,
-  0x2f, 0x11, 0x3a, 0x2e, 0x4a, 0x68, 0x5d, 0x1a, 0xda, 0xa7, 0xdb, 0x43,
-  0xc4, 0x08, 0x53, 0x34, 0xf3, 0xda, 0xb6, 0xd1, 0x23, 0xb9, 0x26, 0xfc,
-  0x0a, 0xc2, 0xdd, 0x6b, 0x81, 0xc1, 0x46, 0x2d, 0x2f, 0x9b, 0xab, 0xed,
-  0xff, 0x09, 0x3c, 0x68, 0x4f, 0x5d, 0xac, 0x73, 0x73, 0xea, 0xc0, 0x61,
-  0x3a, 0xe7, 0x06, 0xd4, 0xc0, 0xe5, 0xe8, 0x50, 0xc7, 0xe3, 0x37, 0xe5,
-  0x1a, 0xb6, 0xd8, 0x1e, 0xbc, 0xc8, 0x79, 0xcc, 0x20, 0xcc, 0x3a, 0xc8,
-  0x02, 0xb3, 0xf5, 0xf4, 0xdf, 0x42, 0x00, 0xdd, 0xaf, 0xe4, 0xb1, 0x86,
-  0x68, 0x7f, 0x66, 0xfd, 0x26, 0xe8, 0xf7, 0xb8, 0xdf, 0xe7, 0xfe, 0x39,
-  0xb3, 0xba, 0xeb, 0x81, 0xc0, 0xbb, 0xa7, 0xcc, 0xc7, 0x14, 0x99, 0x00,
-  0x46, 0xdc, 0xab, 0xd5, 0xda, 0xcb, 0xe4, 0x3b, 0xdb, 0x99, 0xf9, 0x3b,
-  0xd5, 0xd5, 0xee, 0xc1, 0xc6, 0xf5, 0x34, 0x4c, 0xec, 0xb1, 0xc3, 0x82,
-  0xcf, 0xaa, 0x31, 0xc7, 0x8f, 0xec, 0x28, 0xb6, 0x81, 0x2d, 0xb6, 0xd4,
-  0xee, 0xac, 0x13, 0xe2, 0xce, 0xd9, 0xd0, 0x41, 0x54, 0x06, 0x92, 0xf6,
-  0x63, 0xb9, 0x77, 0x7c, 0x92, 0x62, 0xdc, 0x83, 0x97, 0x44, 0x24, 0x25,
-  0x72, 0xab, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xf5, 0xd8, 0xff, 0xff, 0xad, 0x11, 0x00, 0x00, 0x2f, 0xfd, 0xff, 0xff,
-  0x95, 0xd4, 0xff, 0xff, 0x2d, 0xfd, 0xff, 0xff, 0x70, 0xfe, 0xff, 0xff,
-  0xbe, 0x06, 0x00, 0x00, 0x5b, 0xd8, 0xff, 0xff, 0x74, 0xe3, 0xff, 0xff,
-  0xbf, 0x05, 0x00, 0x00, 0x19, 0xd8, 0xff, 0xff, 0x8b, 0xf6, 0xff, 0xff,
-  0xd9, 0x04, 0x00, 0x00, 0x9b, 0x03, 0x00, 0x00, 0x0b, 0xe9, 0xff, 0xff,
-  0xc6, 0xce, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x01, 0xf5, 0xff, 0xff,
-  0xf6, 0x0a, 0x00, 0x00, 0x0e, 0xf9, 0xff, 0xff, 0xa9, 0x1f, 0x00, 0x00,
-  0xd0, 0xdb, 0xff, 0xff, 0xe1, 0x05, 0x00, 0x00, 0x1a, 0x07, 0x00, 0x00,
-  0xbe, 0x01, 0x00, 0x00, 0xe1, 0xe9, 0xff, 0xff, 0x17, 0x06, 0x00, 0x00,
-  0x0e, 0xe8, 0xff, 0xff, 0x4d, 0x10, 0x00, 0x00, 0x87, 0x18, 0x00, 0x00,
-  0xda, 0x16, 0x00, 0x00, 0xa0, 0xeb, 0xff, 0xff, 0x75, 0x08, 0x00, 0x00,
-  0x79, 0xe3, 0xff, 0xff, 0x6a, 0xff, 0xff, 0xff, 0xf9, 0x09, 0x00, 0x00,
-  0x42, 0xe3, 0xff, 0xff, 0xc4, 0xe0, 0xff, 0xff, 0xcf, 0xcc, 0xff, 0xff,
-  0xd4, 0xcd, 0xff, 0xff, 0x6e, 0x07, 0x00, 0x00, 0x0b, 0xe0, 0xff, 0xff,
-  0x64, 0xe6, 0xff, 0xff, 0x7c, 0xea, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff,
-  0x25, 0xe4, 0xff, 0xff, 0x9e, 0x06, 0x00, 0x00, 0xfe, 0xd4, 0xff, 0xff,
-  0x05, 0x1d, 0x00, 0x00, 0x19, 0xf1, 0xff, 0xff, 0xaa, 0x10, 0x00, 0x00,
-  0x99, 0xd7, 0xff, 0xff, 0xaf, 0xe1, 0xff, 0xff, 0x25, 0x2e, 0x00, 0x00,
-  0x63, 0xf1, 0xff, 0xff, 0x30, 0xea, 0xff, 0xff, 0xc1, 0x1b, 0x00, 0x00,
-  0x07, 0xd5, 0xff, 0xff, 0x86, 0xf4, 0xff, 0xff, 0xd6, 0xfc, 0xff, 0xff,
-  0xf0, 0x02, 0x00, 0x00, 0x83, 0xee, 0xff, 0xff, 0x4c, 0xd1, 0xff, 0xff,
-  0xff, 0xd9, 0xff, 0xff, 0x7e, 0xac, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0x12, 0x5a, 0x81, 0x43, 0x81, 0xf4, 0x65, 0xf9,
-  0x7f, 0xda, 0x84, 0x85, 0xc9, 0x7f, 0x07, 0xa2, 0xbb, 0x05, 0xdd, 0xac,
-  0x17, 0x10, 0x86, 0xb5, 0x7f, 0xfc, 0x7f, 0x06, 0x16, 0x26, 0x77, 0xb9,
-  0x21, 0xca, 0x6b, 0x92, 0xa3, 0xa1, 0x71, 0x81, 0x7d, 0xf4, 0xff, 0x81,
-  0x46, 0x19, 0x77, 0x27, 0x36, 0x4b, 0x41, 0xc3, 0x70, 0xdc, 0x1a, 0xfb,
-  0x29, 0x7c, 0x37, 0x08, 0xf7, 0x3f, 0x87, 0xb2, 0x65, 0x7f, 0xbc, 0x7f,
-  0x97, 0x55, 0x7f, 0x7f, 0xf2, 0x81, 0x81, 0xec, 0x5c, 0xc2, 0x3c, 0x87,
-  0x33, 0x81, 0x43, 0x3c, 0xe8, 0x5e, 0x3e, 0x05, 0x6d, 0x53, 0x08, 0x77,
-  0xde, 0x76, 0x7f, 0x9f, 0x81, 0x7f, 0x78, 0x87, 0x0c, 0x7f, 0x2e, 0xd7,
-  0xde, 0x1a, 0x69, 0xee, 0x30, 0xe3, 0xc6, 0x0d, 0x5a, 0x08, 0x64, 0x7f,
-  0xab, 0xaf, 0x3b, 0x17, 0xd8, 0x4e, 0x7f, 0x21, 0xc0, 0xd1, 0x7f, 0x04,
-  0xb8, 0xae, 0xc5, 0xe2, 0x14, 0x81, 0xff, 0xf2, 0x9b, 0x4e, 0xa8, 0x08,
-  0x0d, 0xc2, 0x89, 0x91, 0x7f, 0x28, 0x41, 0x81, 0x7f, 0x63, 0x70, 0x7f,
-  0x43, 0xca, 0xaf, 0xfe, 0x39, 0x5e, 0x79, 0xc7, 0x4d, 0x78, 0xf0, 0xbc,
-  0x31, 0xe0, 0x17, 0x60, 0xcb, 0x00, 0x2a, 0xb8, 0x5d, 0xf9, 0xb8, 0x39,
-  0x58, 0xab, 0x81, 0x2a, 0x79, 0x3c, 0x1a, 0xa4, 0xdb, 0x8a, 0xa4, 0x7f,
-  0x65, 0x0f, 0x5f, 0xd0, 0x59, 0xba, 0x42, 0x25, 0xe9, 0x49, 0xb8, 0x14,
-  0xc5, 0x9e, 0xef, 0x8b, 0x20, 0x10, 0x9e, 0x7f, 0xb3, 0x38, 0xb0, 0x0a,
-  0xba, 0x3c, 0xcb, 0xee, 0x13, 0x16, 0x0f, 0xa6, 0x9b, 0xb6, 0x0e, 0x6e,
-  0x04, 0x06, 0x81, 0x5f, 0x78, 0xa5, 0x9a, 0x86, 0xe4, 0x55, 0x7f, 0xbb,
-  0x25, 0x7f, 0x18, 0x3a, 0xeb, 0x3c, 0xd3, 0x81, 0x7f, 0xfa, 0x07, 0xda,
-  0x81, 0x17, 0xef, 0xbb, 0x27, 0x3b, 0x5e, 0xa1, 0xf2, 0x1c, 0x2c, 0x4d,
-  0x9d, 0x56, 0xfa, 0x63, 0x0c, 0x27, 0xbe, 0x81, 0x76, 0xf3, 0x73, 0xda,
-  0x65, 0xf3, 0x81, 0x4e, 0xa5, 0xea, 0xe0, 0xf9, 0x65, 0xbe, 0x56, 0x3b,
-  0x85, 0x1a, 0x0d, 0x81, 0x93, 0x3a, 0x9e, 0x50, 0xfc, 0x4e, 0xce, 0x8e,
-  0xe7, 0x2b, 0xf2, 0xf1, 0xc2, 0x29, 0x40, 0x3d, 0x07, 0xde, 0xef, 0xe6,
-  0xff, 0xb1, 0x42, 0x81, 0x44, 0x20, 0x59, 0x3c, 0xa1, 0x7f, 0x8c, 0x94,
-  0x7f, 0xea, 0xed, 0x4a, 0x1d, 0x42, 0x54, 0x69, 0xac, 0xf5, 0x03, 0x69,
-  0x81, 0xa1, 0xb7, 0x64, 0xb7, 0x55, 0x09, 0xd7, 0x3e, 0x2d, 0x2d, 0x51,
-  0x5d, 0x42, 0xab, 0xf4, 0x7f, 0x7f, 0x3f, 0x18, 0x6d, 0x0b, 0xf4, 0x7f,
-  0x7f, 0x12, 0x20, 0x0f, 0x25, 0x07, 0xda, 0xb6, 0x07, 0xac, 0x7f, 0x7f,
-  0x23, 0x5f, 0x4e, 0x96, 0xa0, 0x7b, 0x69, 0xe6, 0x45, 0x58, 0x01, 0x55,
-  0x31, 0x29, 0x9e, 0x23, 0x42, 0x1f, 0xf7, 0xfb, 0xcf, 0x8f, 0x16, 0x0a,
-  0x1d, 0xc7, 0x28, 0x41, 0x09, 0x32, 0x44, 0xee, 0x7f, 0x3b, 0x0e, 0xd5,
-  0x0c, 0x57, 0xb0, 0x01, 0x81, 0xed, 0x1d, 0x91, 0x0f, 0x0f, 0xbd, 0x46,
-  0xcb, 0x1b, 0xfc, 0x43, 0x4c, 0x4a, 0x81, 0x3e, 0x81, 0x7f, 0x37, 0x03,
-  0xcc, 0x27, 0x27, 0xb3, 0x81, 0x9a, 0x64, 0xba, 0xb4, 0x36, 0x28, 0x49,
-  0xa1, 0x81, 0x1e, 0xc8, 0x3d, 0xf7, 0x77, 0x81, 0x9e, 0x81, 0x0a, 0xe2,
-  0xcb, 0x26, 0xa8, 0x6d, 0xfb, 0x93, 0x26, 0xef, 0x2c, 0x6a, 0xfb, 0x29,
-  0x7a, 0xb7, 0x11, 0xd2, 0x12, 0x0b, 0x54, 0xc4, 0x63, 0x81, 0xf7, 0x37,
-  0xcd, 0xa3, 0x4f, 0xa5, 0x0f, 0xdf, 0x6d, 0x93, 0xe0, 0x6c, 0xa4, 0x49,
-  0x15, 0x09, 0xc5, 0xc7, 0xf5, 0x4f, 0xff, 0xfd, 0xcb, 0x24, 0x04, 0xad,
-  0xd5, 0x81, 0xaa, 0xad, 0x5d, 0x17, 0xa7, 0x28, 0x7f, 0x87, 0x10, 0xeb,
-  0xee, 0xd3, 0x12, 0xd6, 0xf4, 0xc8, 0x30, 0x31, 0x2e, 0x22, 0x99, 0x6d,
-  0x34, 0x1a, 0x81, 0xe5, 0xa4, 0xb7, 0xaf, 0x1c, 0x10, 0x7f, 0x81, 0xe9,
-  0xf6, 0x54, 0x0a, 0x81, 0x19, 0xf2, 0x64, 0x2b, 0x33, 0x42, 0x86, 0x54,
-  0xc4, 0x77, 0x09, 0x37, 0x46, 0x7c, 0x84, 0x05, 0x81, 0x55, 0x5f, 0x2d,
-  0xf7, 0x81, 0x8e, 0x0f, 0xff, 0x64, 0x7f, 0x57, 0xce, 0x52, 0x43, 0xe6,
-  0xe3, 0xbf, 0x7c, 0x48, 0xca, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x90, 0xf6, 0xff, 0xff, 0x35, 0x04, 0x00, 0x00,
-  0xd9, 0x06, 0x00, 0x00, 0xdd, 0xf2, 0xff, 0xff, 0xb8, 0x12, 0x00, 0x00,
-  0xd2, 0xfc, 0xff, 0xff, 0xf1, 0xf6, 0xff, 0xff, 0xcf, 0xe7, 0xff, 0xff,
-  0x06, 0x02, 0x00, 0x00, 0xdc, 0x0c, 0x00, 0x00, 0x2d, 0x14, 0x00, 0x00,
-  0x69, 0x04, 0x00, 0x00, 0xb6, 0xf7, 0xff, 0xff, 0x54, 0xfc, 0xff, 0xff,
-  0x74, 0x07, 0x00, 0x00, 0xee, 0x05, 0x00, 0x00, 0x68, 0xf6, 0xff, 0xff,
-  0xe6, 0x01, 0x00, 0x00, 0xc2, 0x06, 0x00, 0x00, 0x27, 0x06, 0x00, 0x00,
-  0xcd, 0xfc, 0xff, 0xff, 0x72, 0xe8, 0xff, 0xff, 0x64, 0x04, 0x00, 0x00,
-  0xd2, 0xff, 0xff, 0xff, 0x0d, 0xf1, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
-  0x28, 0xfc, 0xff, 0xff, 0x73, 0x03, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00,
-  0xc6, 0xf4, 0xff, 0xff, 0x33, 0xe5, 0xff, 0xff, 0x83, 0x0a, 0x00, 0x00,
-  0x8a, 0x00, 0x00, 0x00, 0x90, 0xf0, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-  0x68, 0xfe, 0xff, 0xff, 0xe4, 0xf5, 0xff, 0xff, 0x22, 0xf1, 0xff, 0xff,
-  0x5b, 0x07, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x99, 0xff, 0xff, 0xff,
-  0x58, 0xec, 0xff, 0xff, 0x1b, 0xfb, 0xff, 0xff, 0x67, 0x12, 0x00, 0x00,
-  0xa7, 0xff, 0xff, 0xff, 0x86, 0xf3, 0xff, 0xff, 0xfd, 0xf3, 0xff, 0xff,
-  0xc0, 0xf0, 0xff, 0xff, 0x1c, 0xfd, 0xff, 0xff, 0x52, 0x03, 0x00, 0x00,
-  0xda, 0xfd, 0xff, 0xff, 0x1a, 0x0e, 0x00, 0x00, 0x81, 0xfd, 0xff, 0xff,
-  0xe5, 0xfe, 0xff, 0xff, 0x7a, 0xee, 0xff, 0xff, 0xad, 0x08, 0x00, 0x00,
-  0xab, 0x03, 0x00, 0x00, 0xaa, 0xf5, 0xff, 0xff, 0x32, 0xf8, 0xff, 0xff,
-  0x9f, 0xf8, 0xff, 0xff, 0x6a, 0xf9, 0xff, 0xff, 0xd7, 0xfb, 0xff, 0xff,
-  0x99, 0xf3, 0xff, 0xff, 0x39, 0x13, 0x00, 0x00, 0xd6, 0xaf, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x53, 0x0b, 0xa0, 0x54,
-  0xcf, 0xdd, 0x1d, 0xe7, 0x4e, 0xe7, 0x5d, 0xa3, 0x12, 0xd7, 0x3e, 0xc9,
-  0x07, 0xc1, 0xe2, 0x37, 0x29, 0x8e, 0x1e, 0x47, 0xc9, 0xbe, 0xfc, 0x24,
-  0xf8, 0x04, 0x84, 0x68, 0xb8, 0xdf, 0xcf, 0xb0, 0x2d, 0x91, 0x8f, 0xac,
-  0xb0, 0xdd, 0x5d, 0xc1, 0xa0, 0xce, 0xd5, 0x38, 0x4f, 0x3b, 0x15, 0xac,
-  0xc7, 0xc2, 0x03, 0x17, 0xdd, 0x89, 0xea, 0x19, 0x66, 0x92, 0x81, 0x4d,
-  0x03, 0x0d, 0x86, 0x47, 0x81, 0xdc, 0xf4, 0xbc, 0x13, 0xcb, 0x52, 0x11,
-  0xb9, 0x13, 0xe2, 0x2b, 0x59, 0x41, 0x4d, 0xe6, 0xc0, 0x31, 0xc8, 0xa0,
-  0x4c, 0x13, 0xdb, 0xc2, 0x99, 0x98, 0x0c, 0x20, 0x8f, 0xba, 0x43, 0x0f,
-  0x10, 0x01, 0x1b, 0x49, 0x49, 0xf6, 0x50, 0x23, 0x2a, 0xb4, 0x9f, 0x35,
-  0x85, 0xf9, 0xba, 0x13, 0xbb, 0xd0, 0x40, 0x2f, 0x41, 0xeb, 0xb5, 0x65,
-  0xd6, 0x4e, 0x3c, 0xd6, 0xd4, 0x10, 0xda, 0xc7, 0xb8, 0x45, 0x30, 0xed,
-  0x3d, 0xf9, 0xf6, 0xb1, 0xf3, 0x44, 0x64, 0x10, 0xf5, 0xd9, 0x57, 0xda,
-  0x31, 0xa4, 0x14, 0xc0, 0x54, 0x32, 0x55, 0xd6, 0x22, 0x69, 0x21, 0xb7,
-  0xff, 0x63, 0x1b, 0xca, 0x3a, 0xcc, 0xf7, 0x1d, 0x7f, 0x55, 0x4f, 0xbc,
-  0x3e, 0xd6, 0x29, 0x30, 0x1a, 0xd6, 0x5a, 0x52, 0x6a, 0x6c, 0x41, 0xcb,
-  0xbf, 0x2a, 0x17, 0xe4, 0xf9, 0x37, 0x3f, 0xb7, 0xff, 0x45, 0x44, 0xc1,
-  0xa0, 0x21, 0x72, 0x57, 0x70, 0xb0, 0xee, 0xb6, 0x22, 0xfd, 0xc9, 0xdb,
-  0x9f, 0xce, 0xe8, 0x60, 0x79, 0x70, 0x03, 0x40, 0x98, 0x30, 0x0f, 0x22,
-  0xea, 0x52, 0x24, 0x1d, 0xab, 0xe1, 0x81, 0xc9, 0xfd, 0x2f, 0xce, 0x7c,
-  0x50, 0x5c, 0x5f, 0x08, 0x2f, 0x07, 0x72, 0x50, 0xbf, 0xf6, 0xdf, 0x59,
-  0xc4, 0x23, 0x39, 0x1d, 0xbd, 0xad, 0x0b, 0xa8, 0xa4, 0x93, 0xa1, 0x77,
-  0xc0, 0x81, 0x29, 0xc1, 0xc4, 0x7b, 0xce, 0xf6, 0xe1, 0xde, 0x7b, 0x95,
-  0x52, 0xb7, 0x2a, 0x9c, 0x00, 0x09, 0x55, 0x2f, 0x79, 0xeb, 0x06, 0xe8,
-  0x1e, 0xbc, 0xb3, 0x9d, 0x41, 0x41, 0x33, 0xee, 0xf6, 0xcd, 0xc1, 0x37,
-  0xc6, 0x3a, 0x96, 0xad, 0xdf, 0x09, 0xff, 0xe2, 0xdd, 0x29, 0xba, 0x0a,
-  0xff, 0xbf, 0x99, 0xc3, 0x34, 0x32, 0xe3, 0x74, 0x08, 0x62, 0x6a, 0x7c,
-  0xd0, 0xbe, 0x0e, 0x27, 0xf7, 0x2f, 0x4f, 0xd6, 0x0d, 0x39, 0xdd, 0xc6,
-  0x31, 0xda, 0xfd, 0x43, 0x65, 0x2a, 0xc3, 0xbc, 0x61, 0x99, 0xcc, 0x65,
-  0xf4, 0x55, 0xe4, 0xb7, 0x36, 0x49, 0x13, 0x8f, 0xc6, 0x81, 0x81, 0x1c,
-  0x90, 0x03, 0x0c, 0xfc, 0xae, 0x0d, 0xf7, 0xd4, 0xab, 0x28, 0x12, 0x46,
-  0xa7, 0x11, 0xf8, 0x3c, 0xd5, 0x5b, 0x3f, 0x74, 0xf2, 0x2c, 0xed, 0xb7,
-  0x98, 0x59, 0xeb, 0xb0, 0xe7, 0xb3, 0x6f, 0x37, 0x61, 0x11, 0x41, 0x45,
-  0x67, 0xa5, 0xa8, 0x68, 0xd5, 0xdd, 0x27, 0xdd, 0x2e, 0x0d, 0x46, 0xa8,
-  0x17, 0xbd, 0xa6, 0xa6, 0x36, 0x3f, 0x52, 0xb5, 0x39, 0x5a, 0x81, 0xc0,
-  0x51, 0xfe, 0x91, 0xbe, 0x56, 0xdf, 0x0e, 0xd3, 0xf1, 0x31, 0x5c, 0xe0,
-  0xef, 0x14, 0x46, 0x57, 0x29, 0x1a, 0x2c, 0x16, 0xcf, 0x00, 0x05, 0xff,
-  0x96, 0x28, 0xb9, 0xa6, 0x61, 0xa5, 0x50, 0xb8, 0x37, 0xca, 0xe3, 0x13,
-  0x02, 0x21, 0x6b, 0xcc, 0xa8, 0xd6, 0x39, 0xdb, 0xba, 0x14, 0x1a, 0x0b,
-  0xd3, 0x32, 0xc8, 0xed, 0xdc, 0xdc, 0x54, 0xfd, 0xa2, 0x23, 0x24, 0x7f,
-  0x33, 0xdc, 0x41, 0x02, 0x25, 0xe4, 0x91, 0xc2, 0xbb, 0x44, 0xd9, 0xbb,
-  0xd6, 0x37, 0x07, 0x10, 0x29, 0xe5, 0x3c, 0x32, 0xd0, 0xfe, 0xb4, 0xe9,
-  0x41, 0xbe, 0xd7, 0xfe, 0x2a, 0xd2, 0x39, 0x3b, 0x0d, 0xdb, 0xab, 0xf0,
-  0xe4, 0xd6, 0x1c, 0xfa, 0xc8, 0x84, 0x3a, 0xd1, 0xf9, 0xbd, 0x4e, 0x4c,
-  0x34, 0xfe, 0xc9, 0x81, 0x5f, 0x5a, 0xeb, 0x1f, 0xb4, 0xae, 0x91, 0xc5,
-  0x84, 0x1e, 0x45, 0x8e, 0x9f, 0x66, 0x0b, 0x4b, 0xec, 0x33, 0x5c, 0xf6,
-  0x9e, 0x24, 0xe1, 0x6d, 0xe4, 0x11, 0x12, 0xc6, 0x4f, 0x98, 0x93, 0x5e,
-  0x5c, 0x33, 0xa1, 0x94, 0x3a, 0xa7, 0x57, 0x24, 0x2e, 0xb8, 0x33, 0x4e,
-  0xd5, 0x30, 0x24, 0x4d, 0xf8, 0xa8, 0x4d, 0xa0, 0x2b, 0x27, 0x6a, 0xd7,
-  0xd8, 0x62, 0x90, 0x61, 0xd5, 0x8a, 0x52, 0xd1, 0xd4, 0xcd, 0x3f, 0x17,
-  0x5b, 0x54, 0x7f, 0x35, 0x76, 0x5e, 0x31, 0xd2, 0x18, 0xde, 0x29, 0x32,
-  0x52, 0x8d, 0x54, 0xde, 0xa4, 0x70, 0x0e, 0xf1, 0xfb, 0x02, 0xdf, 0xa2,
-  0x9b, 0xff, 0x01, 0x6e, 0xe4, 0x42, 0xb1, 0x42, 0xaf, 0x10, 0xf2, 0xe1,
-  0x14, 0xc3, 0x8e, 0x00, 0x69, 0x44, 0xad, 0x7a, 0xde, 0xab, 0x4b, 0x18,
-  0xbb, 0xb9, 0xbf, 0x00, 0x24, 0x57, 0xe1, 0x9e, 0xb2, 0xe1, 0x6c, 0xd8,
-  0x5c, 0x06, 0xae, 0x99, 0x94, 0xbe, 0x58, 0x0b, 0x53, 0x5b, 0x3e, 0xce,
-  0x00, 0xbc, 0x65, 0x66, 0x61, 0x9b, 0xcb, 0x87, 0xc2, 0xed, 0xb2, 0x9c,
-  0x58, 0x66, 0x63, 0x3c, 0x71, 0x48, 0xf9, 0x3b, 0x79, 0x1c, 0x3c, 0x8f,
-  0x18, 0x42, 0x0b, 0x7f, 0xd9, 0x6a, 0xd8, 0x1a, 0xac, 0xd9, 0x03, 0x2a,
-  0xf9, 0x5c, 0x6f, 0xf6, 0x8c, 0xef, 0x44, 0x64, 0x5b, 0xe8, 0xa0, 0x64,
-  0x42, 0x48, 0x21, 0x36, 0x13, 0x0a, 0x23, 0x31, 0x10, 0x6a, 0x4d, 0xb3,
-  0x24, 0x58, 0x4a, 0xf6, 0x08, 0x5c, 0xba, 0x8b, 0x67, 0xec, 0xf3, 0x87,
-  0x60, 0x08, 0x1e, 0xd8, 0xae, 0x76, 0xf1, 0xe8, 0xdc, 0x1c, 0xd4, 0x74,
-  0x42, 0x66, 0xca, 0xad, 0xb9, 0x8a, 0x4a, 0x97, 0x34, 0xbb, 0x7f, 0xca,
-  0x67, 0x3a, 0xf3, 0x90, 0xaf, 0x8e, 0x99, 0x68, 0xd8, 0x81, 0x21, 0x04,
-  0xb1, 0xc8, 0xa5, 0x04, 0xc3, 0x09, 0xe1, 0x15, 0x08, 0x9f, 0x35, 0x58,
-  0xf9, 0x19, 0x55, 0x11, 0x45, 0xa7, 0xe0, 0x0e, 0xfc, 0x11, 0x7c, 0xd8,
-  0xb4, 0x5f, 0x55, 0x5f, 0xc8, 0xff, 0xa8, 0x15, 0xd8, 0x06, 0x18, 0xc9,
-  0x09, 0xfe, 0x58, 0x4a, 0xdd, 0xfa, 0xd7, 0x3e, 0x2a, 0xd7, 0xaf, 0xbf,
-  0xee, 0xc2, 0xfd, 0x04, 0xfe, 0xbb, 0xce, 0xbf, 0xac, 0x2f, 0x45, 0x52,
-  0xe3, 0xac, 0xe6, 0x3c, 0x67, 0xce, 0xec, 0x3f, 0x06, 0x2c, 0x4f, 0x0e,
-  0xa5, 0xa9, 0x46, 0x65, 0xb2, 0xfc, 0x9a, 0xc5, 0x24, 0x40, 0xfa, 0x26,
-  0xdb, 0x6d, 0xfc, 0x28, 0x81, 0x2c, 0xcf, 0xdc, 0xde, 0xe0, 0x1b, 0x91,
-  0x1a, 0xe2, 0x3b, 0x28, 0xe1, 0x22, 0x8c, 0x15, 0xdc, 0xb2, 0x56, 0x47,
-  0x1a, 0x7a, 0xfe, 0x6d, 0xdc, 0x05, 0xb2, 0xfc, 0x08, 0x95, 0x1e, 0xee,
-  0xff, 0x27, 0x12, 0x64, 0x25, 0x2c, 0x0a, 0xbf, 0x30, 0x25, 0xc5, 0xd0,
-  0xca, 0xab, 0x11, 0xe6, 0x91, 0xdd, 0x19, 0x12, 0xbc, 0x04, 0x9a, 0x1a,
-  0x42, 0xaf, 0x08, 0x13, 0x28, 0x55, 0xc7, 0x47, 0x0c, 0x87, 0xeb, 0xec,
-  0x12, 0x9a, 0xa2, 0xd2, 0x2e, 0x53, 0xdb, 0x3f, 0xa7, 0x85, 0x12, 0xc1,
-  0xcf, 0x1f, 0x34, 0xea, 0x0d, 0x04, 0x48, 0xe1, 0xb8, 0x7f, 0xec, 0x9e,
-  0xfc, 0x4d, 0xc4, 0xa0, 0x1e, 0xac, 0xfc, 0xb9, 0x1a, 0x5d, 0xf9, 0xe2,
-  0x22, 0x2b, 0x0c, 0x4e, 0x00, 0x88, 0xa7, 0xc6, 0x7f, 0xe4, 0xe9, 0xae,
-  0xd3, 0xfa, 0x95, 0xe8, 0xd3, 0x9d, 0xd0, 0xd7, 0x61, 0x53, 0xfb, 0x25,
-  0x5f, 0x57, 0x5b, 0x08, 0xd6, 0x17, 0xcc, 0xf5, 0x1f, 0xa6, 0x28, 0xca,
-  0xb9, 0xce, 0x4c, 0x61, 0xc1, 0xe6, 0x2f, 0xbd, 0xd0, 0xcb, 0xce, 0xcc,
-  0x43, 0x05, 0x41, 0xe4, 0x2b, 0x35, 0xbf, 0xf4, 0x1e, 0xe9, 0x55, 0x55,
-  0x06, 0xe4, 0x38, 0x65, 0x4c, 0xce, 0xeb, 0x1b, 0x9a, 0x96, 0xf7, 0x92,
-  0x9f, 0x47, 0x31, 0xa0, 0x17, 0x48, 0xb4, 0x20, 0x06, 0x1c, 0x0d, 0x40,
-  0xf8, 0xb5, 0xff, 0x3b, 0xcf, 0xb3, 0xd3, 0x96, 0x6e, 0x2e, 0x49, 0x50,
-  0x67, 0xc3, 0x38, 0xb7, 0x4d, 0xf6, 0x93, 0x37, 0x1a, 0x23, 0x2a, 0x63,
-  0x22, 0x4b, 0x98, 0x1b, 0xce, 0xdb, 0x5f, 0x3c, 0xba, 0x67, 0x4f, 0x44,
-  0x7f, 0xf8, 0xc3, 0xf3, 0x77, 0x03, 0xbd, 0x6f, 0xb3, 0x65, 0xf2, 0x8c,
-  0x92, 0xfe, 0xdd, 0x64, 0xd5, 0xa6, 0x30, 0x44, 0xf1, 0x70, 0xa3, 0xfe,
-  0x1f, 0x1b, 0xb9, 0x8b, 0xdb, 0x57, 0x72, 0x52, 0xad, 0x2c, 0x86, 0x29,
-  0xf1, 0x24, 0xbd, 0xe9, 0x16, 0xc1, 0x41, 0xd7, 0x67, 0xc3, 0x65, 0x16,
-  0x37, 0xcb, 0x34, 0x00, 0x69, 0xf7, 0x13, 0x6c, 0x1c, 0x67, 0xe0, 0x02,
-  0x81, 0x1d, 0xda, 0xa0, 0xbd, 0x11, 0xc2, 0x64, 0x1f, 0x38, 0xfc, 0xd7,
-  0x4d, 0x14, 0xdd, 0x4e, 0xb9, 0x43, 0x47, 0xbe, 0xf6, 0x4f, 0xc5, 0xe6,
-  0x07, 0xd6, 0xb3, 0x53, 0xc0, 0xec, 0x4e, 0xad, 0x0b, 0xa6, 0x25, 0x46,
-  0xdf, 0xf9, 0xd4, 0xe0, 0x6e, 0xaf, 0xba, 0xab, 0x19, 0xc5, 0xe0, 0xf0,
-  0x7f, 0x01, 0xac, 0xbb, 0xae, 0x21, 0x12, 0x1b, 0x28, 0x3a, 0xb9, 0xb1,
-  0x49, 0xbb, 0x50, 0x11, 0x01, 0x5d, 0x14, 0xbe, 0x11, 0x24, 0x04, 0x08,
-  0x5f, 0x33, 0x24, 0x0e, 0x81, 0xc2, 0xed, 0x92, 0x10, 0xf7, 0x11, 0x15,
-  0xee, 0xcb, 0xbf, 0x9d, 0x2e, 0xd0, 0xd3, 0xf8, 0xc0, 0x5b, 0x06, 0xc1,
-  0xb0, 0x44, 0xf1, 0xdd, 0x0b, 0x13, 0x07, 0xcb, 0xb9, 0xed, 0x62, 0x93,
-  0x51, 0xe0, 0x2c, 0x13, 0x9c, 0x04, 0x53, 0xe2, 0x4e, 0x50, 0x04, 0x2f,
-  0x93, 0x28, 0x31, 0x23, 0x40, 0xa7, 0x11, 0x93, 0x3b, 0xf0, 0xdd, 0x11,
-  0xaf, 0xbf, 0xf5, 0xa7, 0x38, 0x34, 0x9d, 0x08, 0x49, 0x50, 0x62, 0xb7,
-  0x84, 0xa9, 0x25, 0xad, 0xa5, 0x2d, 0xde, 0xba, 0x7f, 0xaf, 0xc4, 0xa6,
-  0x65, 0x4e, 0x54, 0xd5, 0x15, 0xfa, 0x29, 0x5d, 0x14, 0x0e, 0x3c, 0x38,
-  0x24, 0x5c, 0xc4, 0xcf, 0xc5, 0x3c, 0x97, 0x24, 0xb4, 0x55, 0x97, 0x66,
-  0x32, 0x76, 0x22, 0x20, 0x14, 0x8b, 0xfc, 0x09, 0x1b, 0x37, 0x57, 0x07,
-  0xa2, 0xd0, 0x09, 0x1f, 0x98, 0xf9, 0xfd, 0xab, 0xff, 0xcd, 0xa0, 0x99,
-  0xdb, 0x9c, 0x35, 0xad, 0xd9, 0x44, 0xf1, 0x6e, 0x0a, 0x71, 0x25, 0x12,
-  0x41, 0xc1, 0x09, 0xe0, 0x0d, 0x01, 0xc1, 0x43, 0x47, 0xc2, 0xa3, 0x0c,
-  0x7f, 0x65, 0x2d, 0x9b, 0x26, 0xa2, 0x0b, 0x00, 0xe5, 0x3a, 0xc6, 0xe5,
-  0xcd, 0x6b, 0x4f, 0xb4, 0x58, 0x1d, 0xa3, 0x42, 0x38, 0x36, 0x39, 0x93,
-  0xf8, 0x47, 0xfa, 0xd1, 0xd5, 0xa5, 0x3f, 0xdd, 0xc9, 0xe2, 0x14, 0x0d,
-  0x43, 0xf2, 0xa9, 0x5b, 0x52, 0xda, 0x81, 0xa8, 0xca, 0x4e, 0xdf, 0x69,
-  0xd4, 0xa3, 0x3f, 0x4f, 0x2d, 0x14, 0xcd, 0x25, 0x0c, 0x02, 0x12, 0x21,
-  0x95, 0x5b, 0x8a, 0xb8, 0xb1, 0x9b, 0xf4, 0xc1, 0x1f, 0x28, 0x97, 0x27,
-  0xc3, 0x31, 0xff, 0xa8, 0xa1, 0xb5, 0xe2, 0x37, 0xd3, 0xee, 0x46, 0x4c,
-  0x4e, 0x41, 0xde, 0x4a, 0x22, 0xde, 0x12, 0xc6, 0xec, 0x40, 0x5c, 0xb6,
-  0x17, 0xc9, 0x0c, 0xe8, 0x6e, 0xfb, 0xa1, 0xc8, 0x98, 0xa8, 0xbd, 0x2b,
-  0x34, 0xee, 0x1a, 0x28, 0x1c, 0x38, 0xfb, 0x45, 0x40, 0x24, 0x63, 0xe8,
-  0x71, 0x8d, 0xe0, 0x56, 0xe5, 0xeb, 0xe9, 0x1f, 0xd9, 0x37, 0x61, 0x7f,
-  0xd1, 0xa2, 0x04, 0x01, 0x37, 0xd2, 0xaa, 0x95, 0x29, 0xf1, 0xa2, 0x66,
-  0x5e, 0xf5, 0xff, 0xb3, 0xa5, 0xb9, 0x0c, 0x96, 0x08, 0xb0, 0xdf, 0xc2,
-  0x56, 0x6c, 0x06, 0x0d, 0xc8, 0xa3, 0x2d, 0xc0, 0xc6, 0xbc, 0x6c, 0xd5,
-  0xf7, 0xfd, 0x34, 0x62, 0x5e, 0x5b, 0x13, 0xd9, 0x94, 0xe5, 0x1e, 0xb2,
-  0x3b, 0x63, 0x06, 0xca, 0xe5, 0xc0, 0xdb, 0x60, 0x94, 0xf1, 0x32, 0x71,
-  0x30, 0xa7, 0xcf, 0x93, 0x6a, 0x9c, 0x35, 0x6c, 0x3c, 0x9d, 0xa6, 0x9b,
-  0xd2, 0xfc, 0x33, 0x59, 0x5a, 0x47, 0x1c, 0x6b, 0xc2, 0xd5, 0x0e, 0x75,
-  0xae, 0xf9, 0x5b, 0x01, 0x39, 0xbc, 0x32, 0x8f, 0x69, 0x7f, 0x6c, 0xaf,
-  0xbf, 0xa7, 0x7c, 0xf1, 0x34, 0xbc, 0x2d, 0x41, 0x19, 0xaa, 0xd6, 0x18,
-  0xb8, 0xaf, 0xf6, 0x3f, 0x34, 0x10, 0x0c, 0x67, 0x81, 0xd3, 0xc1, 0xfd,
-  0x47, 0x25, 0x24, 0xef, 0x89, 0xb5, 0x54, 0xcb, 0x39, 0xa4, 0x56, 0x9e,
-  0xed, 0x34, 0xa8, 0x9b, 0x62, 0xa9, 0xa5, 0x63, 0xef, 0xe5, 0x98, 0x1a,
-  0xe5, 0xd9, 0xd1, 0x5f, 0x2f, 0x01, 0x35, 0x4c, 0xe4, 0x0b, 0x57, 0x3f,
-  0xcb, 0x42, 0x69, 0xab, 0xcb, 0x46, 0x3b, 0x52, 0x07, 0xae, 0x42, 0x28,
-  0x30, 0x51, 0xb1, 0x76, 0xef, 0x2c, 0x6c, 0xa2, 0xc3, 0xd8, 0xe3, 0x62,
-  0xf3, 0xa8, 0x49, 0xb2, 0xa3, 0xeb, 0x5f, 0x6b, 0x6c, 0xdb, 0x18, 0x97,
-  0x71, 0xd4, 0x19, 0xef, 0x22, 0xc2, 0x86, 0x9f, 0xa2, 0x7c, 0x33, 0xa9,
-  0x2c, 0xb9, 0x64, 0xf0, 0xf1, 0x9e, 0x6c, 0xad, 0x5a, 0x63, 0xf8, 0x81,
-  0x43, 0xa3, 0xb7, 0xd8, 0xda, 0xc3, 0x51, 0xcf, 0x32, 0xcc, 0xe7, 0xaf,
-  0xfa, 0x2f, 0x39, 0xfe, 0x53, 0xb1, 0x14, 0x4b, 0x1f, 0x72, 0x05, 0x0e,
-  0xb7, 0xc3, 0x2e, 0x60, 0x29, 0xd3, 0x8d, 0x01, 0xab, 0x98, 0xcc, 0xeb,
-  0x59, 0x31, 0x7f, 0xdb, 0x5d, 0xb0, 0xe2, 0x5c, 0xe7, 0x41, 0xc0, 0x54,
-  0x57, 0x49, 0x27, 0x51, 0xf3, 0x4c, 0x57, 0x0f, 0x28, 0x2a, 0xb2, 0xe8,
-  0x19, 0xf1, 0x31, 0xc7, 0x1d, 0x59, 0x12, 0x01, 0xe1, 0x60, 0xc5, 0xd7,
-  0xc4, 0x00, 0x1e, 0xb5, 0x87, 0x9f, 0xf4, 0x1c, 0xc0, 0xcd, 0x6c, 0xcc,
-  0x49, 0xdf, 0xc4, 0x1d, 0x73, 0x10, 0x1d, 0x47, 0x76, 0xa2, 0x8d, 0x25,
-  0x6b, 0x4b, 0x0e, 0x35, 0xd7, 0x98, 0x89, 0xa3, 0x67, 0x55, 0x0e, 0xe6,
-  0xc9, 0x4f, 0x6e, 0xa8, 0x2b, 0x31, 0xe0, 0xf5, 0x99, 0x83, 0x55, 0x92,
-  0x77, 0x5b, 0xad, 0xb9, 0x69, 0xb4, 0x4f, 0xb1, 0xa8, 0x93, 0x97, 0xa9,
-  0x4a, 0x2d, 0x81, 0xb1, 0x10, 0x40, 0x1e, 0x33, 0x0a, 0xe3, 0xa1, 0x15,
-  0xf8, 0x01, 0xc7, 0xdf, 0xbd, 0x5c, 0xf8, 0x0d, 0x98, 0x4f, 0xde, 0x08,
-  0xfd, 0xc2, 0xb4, 0xcb, 0x00, 0xdb, 0xdc, 0x15, 0x81, 0xed, 0xb8, 0xcf,
-  0x96, 0x40, 0x1c, 0x46, 0x04, 0x58, 0xa8, 0x21, 0xec, 0x3d, 0xed, 0x65,
-  0x22, 0xb9, 0xdf, 0x01, 0xea, 0xe4, 0xe8, 0xa8, 0xf9, 0xea, 0x39, 0x44,
-  0x38, 0xd2, 0x26, 0xec, 0xcc, 0xd7, 0xf1, 0x5c, 0x41, 0xc3, 0xa5, 0x5a,
-  0xc9, 0xc9, 0x23, 0x51, 0x06, 0x2e, 0x44, 0xe8, 0xbc, 0x3c, 0x2f, 0x3f,
-  0xf1, 0x4a, 0x3c, 0x2e, 0xdb, 0xcc, 0x85, 0x22, 0xbb, 0xab, 0xe0, 0xbf,
-  0x0d, 0x0c, 0xf7, 0xc5, 0xcc, 0x08, 0x55, 0x7f, 0x1e, 0xc3, 0x67, 0xd0,
-  0x6b, 0xc5, 0xaa, 0xa8, 0x5c, 0x24, 0x2a, 0x48, 0xbc, 0xa9, 0x6b, 0xdc,
-  0x50, 0x54, 0xe0, 0x63, 0xd3, 0xc3, 0xa4, 0x31, 0xb6, 0xd9, 0xef, 0x23,
-  0x5e, 0x67, 0xb1, 0x4f, 0x4f, 0x29, 0xf7, 0x39, 0xc8, 0xfd, 0xef, 0xeb,
-  0x27, 0xac, 0xc2, 0x49, 0x14, 0x04, 0xc6, 0xe9, 0x5d, 0xe1, 0xf9, 0x22,
-  0xa9, 0x11, 0x3d, 0x68, 0x32, 0x04, 0x1a, 0xb7, 0x08, 0xba, 0xe4, 0x4b,
-  0x18, 0xb7, 0xe0, 0xb3, 0xbc, 0xf6, 0x6b, 0xb6, 0x1e, 0xb1, 0x60, 0x4b,
-  0xaa, 0x68, 0x81, 0x62, 0x3f, 0x93, 0xf5, 0x15, 0xaa, 0xb7, 0xb2, 0xcf,
-  0xc3, 0x52, 0x37, 0xe8, 0xad, 0xdc, 0x1b, 0x25, 0x1d, 0xed, 0xa0, 0x2f,
-  0x9a, 0xce, 0xdd, 0x03, 0xe3, 0xe4, 0x44, 0xef, 0x14, 0x45, 0xf8, 0xbb,
-  0x96, 0x39, 0x47, 0x81, 0x1b, 0x5e, 0x2a, 0x26, 0x82, 0xc4, 0xe3, 0x40,
-  0xd0, 0xd4, 0x5c, 0xf1, 0xb0, 0xa3, 0xec, 0xa6, 0x9c, 0x17, 0x48, 0x35,
-  0x15, 0xf5, 0x1f, 0x10, 0x32, 0x57, 0x16, 0x35, 0xba, 0xfc, 0xe5, 0x3b,
-  0xc0, 0x53, 0xb6, 0xee, 0x9f, 0xfa, 0xd6, 0x4b, 0xf8, 0x7f, 0x4d, 0xf7,
-  0x41, 0x1b, 0x64, 0xd8, 0x18, 0xcf, 0xe0, 0x18, 0xcb, 0x1b, 0xa0, 0xca,
-  0x4f, 0xf5, 0x1a, 0x59, 0x3e, 0xc7, 0xed, 0xbe, 0xaf, 0xb1, 0x18, 0xb3,
-  0xcb, 0xf6, 0x08, 0xf1, 0x56, 0xf7, 0xc8, 0x14, 0xd8, 0x36, 0xee, 0x49,
-  0x36, 0x2c, 0xb1, 0x14, 0x39, 0x49, 0xca, 0x57, 0xe2, 0x13, 0x3a, 0x09,
-  0x12, 0x0e, 0xa9, 0xb2, 0x40, 0xa7, 0x59, 0xb4, 0xdb, 0xa4, 0x53, 0xf8,
-  0xb6, 0x35, 0xd0, 0xb8, 0xd4, 0x9a, 0xb2, 0x1e, 0x8c, 0x1e, 0xf2, 0xd5,
-  0xdb, 0x78, 0x0c, 0xfc, 0xd4, 0xa4, 0xc5, 0x5e, 0x2f, 0x2c, 0xfa, 0x10,
-  0x22, 0x7f, 0x01, 0x1b, 0x35, 0xd0, 0xc1, 0x3e, 0x8f, 0x56, 0xb9, 0xe3,
-  0x37, 0xce, 0x3b, 0xfb, 0x20, 0xcd, 0xd6, 0x94, 0x92, 0x1c, 0xe1, 0x1a,
-  0xdf, 0xf8, 0x2b, 0xd5, 0xb2, 0x26, 0x2a, 0xc8, 0x71, 0x59, 0x41, 0x92,
-  0x60, 0x5f, 0xfe, 0xf3, 0xa2, 0x3c, 0xfa, 0xee, 0x7b, 0xd9, 0xb7, 0x43,
-  0x4e, 0x10, 0xd8, 0x50, 0xe0, 0x1c, 0xcd, 0x21, 0x56, 0x56, 0x98, 0x36,
-  0xa6, 0x29, 0x29, 0x83, 0xa1, 0x97, 0x88, 0xaa, 0x00, 0xee, 0x20, 0xea,
-  0xb4, 0x8f, 0x91, 0xaf, 0x81, 0x3a, 0x7d, 0xde, 0x10, 0xb1, 0x73, 0x65,
-  0x3c, 0x90, 0x65, 0x69, 0xab, 0x11, 0x34, 0x7c, 0x16, 0x5f, 0x05, 0xef,
-  0xc3, 0x10, 0x3f, 0xf8, 0x16, 0xa3, 0xdb, 0xf1, 0x01, 0x6e, 0x9b, 0xe2,
-  0x44, 0x87, 0x53, 0x68, 0xd6, 0xbb, 0xa9, 0x43, 0xe3, 0x21, 0x2b, 0xe5,
-  0x0a, 0xf5, 0xe0, 0xbd, 0x7f, 0x3d, 0xbe, 0xe0, 0xc6, 0x87, 0xfa, 0x27,
-  0xaa, 0xc8, 0xc0, 0x49, 0xe1, 0xcb, 0xde, 0xaf, 0x05, 0xb4, 0xed, 0x5e,
-  0x50, 0x1f, 0x49, 0xe7, 0xf0, 0x0a, 0xc7, 0xd2, 0x4e, 0x3a, 0xf1, 0x57,
-  0xde, 0xc9, 0x58, 0x75, 0x48, 0x30, 0xff, 0x3e, 0x99, 0x94, 0x64, 0x71,
-  0x9f, 0xfb, 0x02, 0xa7, 0x0a, 0xca, 0xdf, 0x1c, 0x9d, 0x34, 0x7f, 0x24,
-  0x30, 0xd6, 0xa3, 0x0e, 0xaa, 0xbf, 0x61, 0xc9, 0x5f, 0x98, 0xc7, 0xf8,
-  0x39, 0x56, 0x22, 0xf2, 0x5a, 0xc6, 0xcd, 0x1a, 0x44, 0x47, 0x15, 0x6e,
-  0x4d, 0x31, 0x58, 0x5f, 0xf0, 0xbb, 0x43, 0x20, 0x2a, 0xd3, 0x30, 0x3a,
-  0xde, 0xe8, 0x06, 0xd5, 0xcb, 0x4e, 0xad, 0x53, 0x22, 0x9c, 0xa0, 0xbe,
-  0x07, 0xc4, 0xba, 0x49, 0x4c, 0xc1, 0xc0, 0x9a, 0x92, 0x4e, 0x42, 0x49,
-  0xef, 0xe4, 0xf9, 0xfb, 0x11, 0x0c, 0x39, 0xe2, 0x7f, 0xa1, 0x12, 0x96,
-  0x2b, 0xa0, 0x36, 0xd0, 0x52, 0x4d, 0xc5, 0xce, 0x74, 0xf2, 0xb7, 0xb7,
-  0x6d, 0xf1, 0x24, 0xf5, 0xee, 0x9d, 0x27, 0xfd, 0xc3, 0xf7, 0x4d, 0x5c,
-  0x51, 0xb9, 0x60, 0xed, 0xfe, 0xa2, 0x5f, 0x44, 0xbb, 0xa4, 0xb2, 0x57,
-  0xab, 0x9d, 0x61, 0xcb, 0x44, 0xf6, 0x17, 0x1a, 0xfd, 0x85, 0xe2, 0xa3,
-  0x67, 0xe1, 0xe0, 0x13, 0xd6, 0x17, 0xc5, 0x01, 0x44, 0xf6, 0x56, 0xe4,
-  0xcd, 0xc2, 0x74, 0x0d, 0x28, 0x0e, 0x1c, 0x45, 0xd6, 0x5d, 0x9d, 0xcb,
-  0x51, 0x0b, 0x4d, 0x38, 0xf9, 0x7f, 0x18, 0xd0, 0x92, 0x1b, 0x3f, 0x96,
-  0x9c, 0x17, 0x60, 0xf8, 0xd5, 0x93, 0x4e, 0xb7, 0x65, 0x6d, 0x1c, 0x82,
-  0x60, 0xc9, 0xba, 0xd4, 0xf8, 0xe8, 0xd9, 0x36, 0x64, 0x73, 0x3c, 0x4c,
-  0x28, 0xae, 0xc5, 0xcd, 0xcb, 0xe3, 0x81, 0x16, 0x9c, 0x2f, 0x43, 0xb5,
-  0x12, 0x84, 0xc6, 0xc0, 0xb7, 0x27, 0x02, 0x4c, 0xdb, 0x00, 0x40, 0xff,
-  0xbe, 0x63, 0xc7, 0xa9, 0x46, 0xe0, 0xeb, 0x9d, 0xcf, 0x3f, 0x3a, 0x5a,
-  0xe4, 0xdc, 0xd0, 0x32, 0xf8, 0xb4, 0x31, 0x65, 0x4f, 0x6b, 0x1c, 0x14,
-  0xe2, 0xb3, 0xa7, 0x45, 0x12, 0xcc, 0xc3, 0xa3, 0x5c, 0xf3, 0x98, 0x90,
-  0x17, 0x09, 0x02, 0xfa, 0xf7, 0x12, 0x38, 0x0c, 0xe1, 0x11, 0x46, 0x06,
-  0xfc, 0xd0, 0xff, 0xd2, 0xe7, 0x9d, 0x02, 0xc4, 0x72, 0xa5, 0xf8, 0xdc,
-  0xf8, 0xc4, 0x30, 0x42, 0x6a, 0x70, 0xf5, 0x7f, 0x24, 0x45, 0x04, 0x37,
-  0xd6, 0x59, 0xbe, 0xfd, 0xfb, 0xfc, 0xe3, 0x00, 0x64, 0x33, 0xb1, 0xa5,
-  0x21, 0x9c, 0xc5, 0x2e, 0x1d, 0x1b, 0x48, 0xa9, 0xba, 0x26, 0x62, 0xcd,
-  0xe6, 0x95, 0x45, 0x15, 0xf3, 0xfd, 0xbe, 0x69, 0xe4, 0xd3, 0x02, 0x18,
-  0xf1, 0xc7, 0x7d, 0x02, 0xb3, 0x09, 0x1c, 0x1b, 0xd7, 0x81, 0x66, 0x9e,
-  0xa5, 0xb0, 0x04, 0x9e, 0xc6, 0xd2, 0x09, 0x81, 0x22, 0x0e, 0xfc, 0xc7,
-  0x1c, 0xc4, 0x3f, 0x55, 0xb6, 0x61, 0xf4, 0xe8, 0xf8, 0x4a, 0xa1, 0x10,
-  0xb7, 0xed, 0xf1, 0x39, 0xcf, 0xa1, 0x12, 0xc0, 0x5d, 0x02, 0x09, 0xe4,
-  0xb0, 0x0e, 0xef, 0xc2, 0x31, 0xa4, 0x26, 0x55, 0xa9, 0x6b, 0x18, 0x5b,
-  0x37, 0x32, 0xc9, 0x06, 0xd4, 0xce, 0x26, 0x47, 0x13, 0xce, 0x70, 0x20,
-  0x40, 0x4b, 0xb1, 0xc7, 0xc8, 0x43, 0x1a, 0x3c, 0xc7, 0xf2, 0x98, 0x0d,
-  0x90, 0x3e, 0x6d, 0x09, 0xd7, 0x13, 0xa7, 0x0c, 0x2c, 0xea, 0xee, 0xb2,
-  0x78, 0x19, 0x3d, 0xcf, 0xa7, 0x7f, 0x1b, 0xf9, 0x81, 0xa2, 0x5b, 0xe1,
-  0x89, 0xd3, 0xcc, 0xc1, 0xaf, 0xb0, 0x24, 0x53, 0xe5, 0x03, 0x02, 0x12,
-  0xe0, 0x41, 0xa6, 0xeb, 0x5a, 0x37, 0x7d, 0xda, 0xb4, 0xbc, 0x63, 0xbe,
-  0xc7, 0x66, 0xb9, 0x94, 0x27, 0x6c, 0x1d, 0x9e, 0x18, 0xa2, 0x50, 0x8b,
-  0x70, 0x92, 0xd4, 0xba, 0x01, 0x44, 0x06, 0xce, 0x70, 0x30, 0x75, 0x49,
-  0x81, 0x27, 0xe9, 0x73, 0xf8, 0xcf, 0x7f, 0xc4, 0xf1, 0x6c, 0x09, 0xf7,
-  0xa7, 0xec, 0x04, 0xc7, 0x16, 0x19, 0x3d, 0x02, 0x60, 0x31, 0x11, 0x69,
-  0xf1, 0x9f, 0xc3, 0x78, 0xd1, 0x14, 0x6e, 0xb6, 0x58, 0x43, 0xe5, 0x9a,
-  0x9d, 0xfe, 0x99, 0xad, 0x3e, 0x03, 0x34, 0xd8, 0xe3, 0xb4, 0x21, 0xfc,
-  0xeb, 0x1f, 0xbb, 0xb9, 0x81, 0x6e, 0xf5, 0xf1, 0xcb, 0x0e, 0x2d, 0x59,
-  0xe3, 0x05, 0xa8, 0xc4, 0xa1, 0x59, 0xf0, 0x65, 0xbf, 0x4e, 0xc0, 0xe2,
-  0xa5, 0xa0, 0x99, 0x33, 0x58, 0xc0, 0x57, 0x33, 0x05, 0x1f, 0xde, 0x27,
-  0x25, 0xe0, 0x35, 0x0f, 0xdb, 0xf4, 0xe8, 0xfa, 0xde, 0x15, 0x1c, 0x13,
-  0xf4, 0x4b, 0xef, 0xf9, 0x55, 0x4a, 0xbb, 0x9a, 0x1b, 0x70, 0x51, 0xd4,
-  0xc4, 0x9d, 0x4c, 0xb8, 0xd3, 0xbd, 0x02, 0x94, 0xf5, 0xd8, 0x1f, 0xb0,
-  0xa7, 0x55, 0x3c, 0x00, 0xb6, 0x35, 0x37, 0xe9, 0xb4, 0x8e, 0xec, 0xdd,
-  0x29, 0x60, 0x32, 0x1c, 0xcc, 0x03, 0xbe, 0x54, 0x38, 0x03, 0x90, 0x53,
-  0xf6, 0xab, 0xcd, 0x96, 0xf9, 0xce, 0x57, 0x21, 0x07, 0x0f, 0x59, 0x4d,
-  0x7f, 0xde, 0x48, 0x4d, 0xcc, 0xd2, 0x00, 0x9d, 0xf9, 0x7b, 0xca, 0x01,
-  0x17, 0x0c, 0x19, 0x5d, 0x27, 0x6a, 0xa6, 0xb6, 0x26, 0x68, 0x2f, 0x0b,
-  0x6d, 0x71, 0x58, 0x9d, 0xb4, 0xfe, 0x10, 0xb4, 0xe1, 0x25, 0x6d, 0xce,
-  0x27, 0x6c, 0xce, 0xa5, 0x42, 0xfc, 0x5e, 0xcc, 0x46, 0xee, 0x5d, 0x0e,
-  0x30, 0xf2, 0x5e, 0xcc, 0x56, 0x3b, 0xe8, 0xe2, 0xde, 0x95, 0xb4, 0xe5,
-  0x81, 0xc2, 0x39, 0x94, 0x9f, 0x33, 0xd4, 0xe7, 0x3f, 0xc5, 0xe3, 0xd1,
-  0x4d, 0x9d, 0xb5, 0xc3, 0x14, 0x58, 0x25, 0xe1, 0x2c, 0x49, 0x6e, 0xe2,
-  0x74, 0x07, 0x9d, 0x35, 0x29, 0x06, 0xf5, 0x7f, 0xb1, 0x11, 0x0a, 0xf7,
-  0x5a, 0xb7, 0xc0, 0x39, 0xcc, 0xd8, 0xc9, 0xde, 0xd2, 0xaa, 0xe3, 0xa7,
-  0x28, 0xee, 0xd0, 0x62, 0x37, 0x31, 0x3f, 0xaf, 0xb9, 0x4f, 0x4d, 0x9c,
-  0xf3, 0x70, 0x74, 0xd9, 0x9a, 0xdb, 0x89, 0xdd, 0x34, 0x43, 0xc0, 0xc4,
-  0x72, 0x73, 0x55, 0xed, 0x20, 0xa2, 0xf3, 0x1c, 0xcb, 0xee, 0x09, 0xd6,
-  0xf9, 0x1b, 0xba, 0x2f, 0xe6, 0x1b, 0xba, 0xb0, 0x96, 0x4e, 0xd6, 0x3b,
-  0x4f, 0xf4, 0x9e, 0xd6, 0xd7, 0x2a, 0x36, 0x12, 0x5d, 0xeb, 0x36, 0xc5,
-  0x62, 0x18, 0x3a, 0xdb, 0x46, 0x5a, 0x51, 0xff, 0xde, 0x68, 0x4a, 0xe5,
-  0xc7, 0xeb, 0x76, 0x81, 0xdf, 0x0d, 0x39, 0x43, 0xa2, 0xb5, 0x4e, 0xf1,
-  0xc8, 0x9b, 0x07, 0xa9, 0xe5, 0x5b, 0xd3, 0x81, 0xd0, 0xfd, 0x2a, 0x51,
-  0xe3, 0x8b, 0x67, 0xc0, 0xa7, 0x48, 0xe7, 0x44, 0xc5, 0xbb, 0x10, 0xf1,
-  0x39, 0x0c, 0xc5, 0xba, 0x3e, 0xe3, 0x5a, 0xa5, 0x49, 0x21, 0x58, 0x9e,
-  0x4d, 0xbd, 0x36, 0x3d, 0xbb, 0xf6, 0x08, 0x2b, 0x2a, 0xf7, 0xe2, 0xca,
-  0x1a, 0x2e, 0xec, 0x18, 0xbf, 0x05, 0x18, 0x70, 0x84, 0x6e, 0x34, 0x03,
-  0x84, 0xd9, 0xd6, 0x59, 0x18, 0xb7, 0x1f, 0xc7, 0xdd, 0xa6, 0xe7, 0xe3,
-  0xe9, 0x17, 0xd2, 0xf9, 0x6b, 0x6f, 0x00, 0xa6, 0x28, 0x4c, 0x1f, 0xa0,
-  0xa9, 0xf2, 0x68, 0x02, 0x86, 0x2a, 0x2b, 0x81, 0x47, 0xc0, 0x68, 0x0c,
-  0x16, 0x4a, 0xe9, 0x59, 0x35, 0xbe, 0xd1, 0xef, 0x21, 0x45, 0xda, 0xf9,
-  0xdb, 0x30, 0xb8, 0x11, 0x29, 0x04, 0x11, 0x9a, 0xf3, 0xef, 0x95, 0x15,
-  0xc3, 0xff, 0xc6, 0x24, 0x93, 0xda, 0x6f, 0x1c, 0x9f, 0x57, 0xad, 0xb2,
-  0x1c, 0xe7, 0xaa, 0xf3, 0xac, 0x47, 0xf0, 0xbd, 0xec, 0xe5, 0x69, 0x0e,
-  0xf0, 0x7f, 0x55, 0x07, 0xa3, 0x53, 0xe8, 0xca, 0xdf, 0x1b, 0x01, 0xdf,
-  0x2a, 0xea, 0x4b, 0xaf, 0xd2, 0xb9, 0xdb, 0x0b, 0x2d, 0x60, 0xd3, 0x0a,
-  0x23, 0x04, 0xbd, 0xaa, 0x32, 0x20, 0xee, 0xd7, 0xbf, 0x6b, 0x40, 0x9d,
-  0x5c, 0x12, 0xad, 0x63, 0x54, 0x5c, 0x06, 0x3a, 0xf3, 0x99, 0x44, 0xd7,
-  0x54, 0x25, 0x4d, 0x47, 0xd6, 0xf6, 0xb4, 0x18, 0xc8, 0xd1, 0x57, 0x32,
-  0xd1, 0x9f, 0x75, 0x6a, 0x4a, 0x94, 0x7b, 0xec, 0x44, 0xbb, 0xea, 0x8c,
-  0x1a, 0x27, 0xb7, 0xe0, 0x42, 0x48, 0x74, 0xce, 0xb2, 0xe4, 0xf4, 0x2a,
-  0x1b, 0x87, 0x9e, 0x93, 0xda, 0x1f, 0xe8, 0x38, 0x63, 0x99, 0xa2, 0x58,
-  0x81, 0x17, 0x32, 0x92, 0x1e, 0xf8, 0x69, 0x10, 0xcd, 0x4d, 0xe3, 0x9d,
-  0x21, 0xa3, 0xe6, 0xe5, 0x46, 0x8a, 0x0c, 0xe1, 0x56, 0xc2, 0xa8, 0x04,
-  0x22, 0x6a, 0xe4, 0x3d, 0x3c, 0xde, 0xd9, 0xf1, 0xcc, 0xe0, 0xc0, 0xd6,
-  0x4e, 0x8b, 0x1b, 0xb9, 0x81, 0x1e, 0xfa, 0xf6, 0x5d, 0xa1, 0xe7, 0x4d,
-  0xe9, 0xd1, 0x1e, 0x7f, 0xeb, 0x95, 0xa3, 0xb3, 0x9a, 0x20, 0x1e, 0x74,
-  0x19, 0xb7, 0x6f, 0xb1, 0xd8, 0x75, 0x49, 0x2d, 0x16, 0x27, 0x7a, 0xf5,
-  0x82, 0x2d, 0x09, 0x30, 0x2a, 0xe6, 0x13, 0x3c, 0x4c, 0x83, 0xe2, 0xdf,
-  0x5f, 0xb9, 0x58, 0x54, 0x94, 0x6a, 0x81, 0x39, 0xad, 0xbd, 0x58, 0x26,
-  0xdc, 0x99, 0xc8, 0xe9, 0x0f, 0x04, 0x37, 0x6a, 0x1f, 0x61, 0xb5, 0x96,
-  0x41, 0x4f, 0xf0, 0xbb, 0xd0, 0xf1, 0x23, 0xc5, 0xbe, 0xb2, 0xfe, 0xfa,
-  0x3d, 0x1b, 0x66, 0xd9, 0xc3, 0x3a, 0x48, 0x11, 0x55, 0xc0, 0x9a, 0xae,
-  0x0e, 0x33, 0xd1, 0x5e, 0xb4, 0x08, 0xd0, 0xd8, 0xaf, 0xf0, 0xb9, 0x9b,
-  0x32, 0x4f, 0xef, 0xd6, 0x37, 0x5f, 0xff, 0xbf, 0x55, 0xe9, 0xba, 0xe0,
-  0xa7, 0xd8, 0x42, 0x5e, 0xbb, 0x39, 0x55, 0xa9, 0x44, 0x57, 0x23, 0xf5,
-  0x1c, 0x38, 0xd1, 0xe4, 0x54, 0x9b, 0x5c, 0x37, 0x58, 0x29, 0x89, 0x16,
-  0x22, 0x9c, 0xb4, 0xb3, 0xf3, 0xff, 0xaf, 0x4e, 0xc9, 0x07, 0x1f, 0x41,
-  0x19, 0x9f, 0x1e, 0xdb, 0x43, 0xbb, 0x7f, 0xe8, 0xaa, 0x1d, 0xfb, 0xae,
-  0x41, 0xe2, 0x57, 0x54, 0xcf, 0x2e, 0xeb, 0xbb, 0x2a, 0x81, 0x70, 0xe0,
-  0x04, 0x3a, 0x08, 0xdf, 0x10, 0x46, 0xd5, 0xde, 0xb9, 0xfe, 0x05, 0x15,
-  0x53, 0xa2, 0xb8, 0x12, 0xe8, 0xb7, 0x5f, 0x4a, 0x2f, 0x32, 0xc3, 0x3d,
-  0xd7, 0xcb, 0x00, 0x33, 0xa6, 0xa3, 0x09, 0x0c, 0x1a, 0x05, 0xb2, 0x97,
-  0x73, 0x49, 0xc5, 0xac, 0xa8, 0xb1, 0xa3, 0xbe, 0x5a, 0xce, 0xa8, 0x4b,
-  0x68, 0xe7, 0xb0, 0xc0, 0xd9, 0x21, 0x5a, 0xf6, 0xa5, 0xca, 0xe3, 0xca,
-  0x86, 0xb4, 0xd6, 0xa5, 0x3f, 0x97, 0xe8, 0xb8, 0x36, 0x9f, 0xc9, 0x74,
-  0xe5, 0xb8, 0x08, 0x2b, 0x6f, 0x5b, 0x6e, 0x20, 0x54, 0x12, 0x3d, 0x8c,
-  0x44, 0x03, 0x5a, 0x28, 0x46, 0x36, 0xbd, 0xe7, 0x2a, 0x32, 0xd6, 0x65,
-  0xda, 0xf1, 0x1f, 0x04, 0x06, 0xad, 0xab, 0xb8, 0x68, 0x81, 0xb9, 0xb1,
-  0x76, 0xc5, 0x46, 0x8f, 0x09, 0x47, 0x0a, 0xdb, 0x7c, 0xef, 0x26, 0x51,
-  0xf5, 0x0d, 0x51, 0xc7, 0x5b, 0x3f, 0x4b, 0x71, 0x14, 0x1b, 0x5e, 0xa3,
-  0x42, 0x6e, 0x09, 0x04, 0x0c, 0xed, 0x38, 0xa6, 0x41, 0xbf, 0x9e, 0x0f,
-  0xcd, 0x53, 0x77, 0xd5, 0xb8, 0x50, 0x98, 0x12, 0x91, 0x42, 0x11, 0x6a,
-  0xb6, 0x7f, 0xaa, 0xd0, 0xf4, 0x07, 0x3d, 0xc1, 0x64, 0xb8, 0xcd, 0x54,
-  0xfb, 0x91, 0x95, 0xff, 0x56, 0x6a, 0x92, 0xb1, 0x03, 0xd9, 0x69, 0x59,
-  0x34, 0x67, 0x9d, 0x4b, 0x3b, 0x01, 0xcf, 0xc0, 0xc4, 0x4d, 0x62, 0x44,
-  0x27, 0xbe, 0x50, 0xdf, 0xfd, 0x9d, 0x9f, 0x11, 0x4c, 0xa7, 0xe5, 0xc0,
-  0x87, 0x1b, 0x53, 0x02, 0xcb, 0x8b, 0x04, 0x5f, 0xa1, 0x97, 0xc6, 0x2f,
-  0x99, 0xbe, 0x15, 0x0c, 0x60, 0xb6, 0x48, 0x60, 0x27, 0x1c, 0xf7, 0x09,
-  0xae, 0x7f, 0x59, 0x72, 0x1d, 0xc7, 0x96, 0x19, 0x04, 0xf2, 0x83, 0x54,
-  0x6d, 0xae, 0xad, 0xff, 0x42, 0x37, 0xcc, 0xed, 0x9b, 0x58, 0x59, 0xf2,
-  0xb9, 0xd4, 0x33, 0x28, 0x86, 0x03, 0xf2, 0x7a, 0xf8, 0xce, 0x35, 0xa2,
-  0xdb, 0xf7, 0xaf, 0xf5, 0xc5, 0xaa, 0x92, 0x5c, 0xd7, 0x5e, 0x34, 0x14,
-  0xbc, 0x5d, 0x66, 0x20, 0x7f, 0x64, 0x39, 0xac, 0xe0, 0x2d, 0x82, 0x27,
-  0xe1, 0x42, 0x4a, 0x31, 0xc8, 0x1b, 0xe7, 0xb8, 0xa4, 0x7b, 0x1b, 0x7b,
-  0x3c, 0xce, 0x6e, 0xf4, 0x7b, 0x92, 0x5b, 0x03, 0x4c, 0xcd, 0x94, 0xbd,
-  0x03, 0xb5, 0xba, 0x14, 0xa7, 0x40, 0xfb, 0x42, 0x6b, 0x12, 0xb9, 0x63,
-  0x6d, 0x69, 0x4f, 0xa1, 0x06, 0x5a, 0x12, 0xad, 0x2a, 0xb9, 0xf9, 0x0b,
-  0x0e, 0xc4, 0x5d, 0x6f, 0xd1, 0x00, 0xe1, 0x7a, 0x09, 0x6a, 0xe5, 0xdb,
-  0xf7, 0x20, 0x81, 0x5b, 0xdf, 0xfd, 0xef, 0xe8, 0xb6, 0xaf, 0x53, 0x0d,
-  0xaa, 0x5e, 0x04, 0x31, 0xf5, 0xee, 0xdc, 0x48, 0xc6, 0xd4, 0xd8, 0xb1,
-  0x42, 0xd0, 0xe7, 0xd0, 0x1d, 0xe7, 0x5e, 0x4d, 0x81, 0xe2, 0xfa, 0x72,
-  0x2f, 0xbc, 0x68, 0xb4, 0xd4, 0xd8, 0xa9, 0x38, 0x56, 0x05, 0x10, 0xc4,
-  0x04, 0x6b, 0xa8, 0x62, 0x61, 0x86, 0xfe, 0xf9, 0xbf, 0x95, 0x74, 0xa4,
-  0x18, 0x25, 0x2c, 0x1e, 0x07, 0x55, 0x30, 0x05, 0x47, 0xa4, 0x2a, 0xfe,
-  0xa4, 0x1b, 0x4f, 0x8d, 0xd5, 0x0c, 0x7f, 0x03, 0x14, 0xc2, 0xad, 0x88,
-  0x77, 0x11, 0x24, 0x5a, 0x1a, 0x5a, 0xed, 0x9b, 0x35, 0x5e, 0x05, 0x32,
-  0xe2, 0xbf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xdb, 0x1e, 0x00, 0x00, 0x65, 0x0e, 0x00, 0x00, 0xf4, 0xe3, 0xff, 0xff,
-  0xf0, 0xef, 0xff, 0xff, 0x13, 0x07, 0x00, 0x00, 0x75, 0x07, 0x00, 0x00,
-  0x38, 0xfa, 0xff, 0xff, 0xdc, 0x04, 0x00, 0x00, 0x42, 0x07, 0x00, 0x00,
-  0x86, 0xe9, 0xff, 0xff, 0x2a, 0xf1, 0xff, 0xff, 0x17, 0xf2, 0xff, 0xff,
-  0xc7, 0x05, 0x00, 0x00, 0x8b, 0xfb, 0xff, 0xff, 0x9a, 0x23, 0x00, 0x00,
-  0xbd, 0xff, 0xff, 0xff, 0x5a, 0xec, 0xff, 0xff, 0x8b, 0xfe, 0xff, 0xff,
-  0xdc, 0x00, 0x00, 0x00, 0xf4, 0x13, 0x00, 0x00, 0x9a, 0xf7, 0xff, 0xff,
-  0x9c, 0x04, 0x00, 0x00, 0x23, 0x09, 0x00, 0x00, 0xec, 0x08, 0x00, 0x00,
-  0x4a, 0xed, 0xff, 0xff, 0x02, 0x0b, 0x00, 0x00, 0x29, 0x05, 0x00, 0x00,
-  0xb1, 0xe5, 0xff, 0xff, 0xde, 0x1b, 0x00, 0x00, 0x12, 0x0f, 0x00, 0x00,
-  0x87, 0xfd, 0xff, 0xff, 0x6a, 0xfe, 0xff, 0xff, 0xdd, 0x10, 0x00, 0x00,
-  0xa5, 0xfa, 0xff, 0xff, 0x8c, 0x08, 0x00, 0x00, 0xb1, 0x08, 0x00, 0x00,
-  0xe5, 0xf7, 0xff, 0xff, 0xaf, 0xfd, 0xff, 0xff, 0x4c, 0x04, 0x00, 0x00,
-  0x66, 0xf2, 0xff, 0xff, 0x8b, 0x19, 0x00, 0x00, 0xcd, 0xf9, 0xff, 0xff,
-  0x0c, 0x12, 0x00, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x21, 0xeb, 0xff, 0xff,
-  0x72, 0x12, 0x00, 0x00, 0x1e, 0xfc, 0xff, 0xff, 0x31, 0xfa, 0xff, 0xff,
-  0x1b, 0x09, 0x00, 0x00, 0x8c, 0xf7, 0xff, 0xff, 0x0c, 0x07, 0x00, 0x00,
-  0x87, 0x0e, 0x00, 0x00, 0x07, 0xf3, 0xff, 0xff, 0x2d, 0x16, 0x00, 0x00,
-  0x34, 0x01, 0x00, 0x00, 0x27, 0x0c, 0x00, 0x00, 0x25, 0xfa, 0xff, 0xff,
-  0x55, 0x1a, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x20, 0xe8, 0xff, 0xff,
-  0x86, 0xff, 0xff, 0xff, 0x56, 0xf3, 0xff, 0xff, 0xbe, 0xe6, 0xff, 0xff,
-  0xac, 0xef, 0xff, 0xff, 0xee, 0xc0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0x7f, 0xe5, 0x36, 0xf7, 0x52, 0x7f, 0xdc, 0x7f,
-  0x85, 0x21, 0x43, 0x19, 0x0a, 0x81, 0x0e, 0x67, 0x47, 0x7f, 0xe3, 0x2d,
-  0x22, 0x1b, 0xc2, 0x4e, 0xbe, 0xe4, 0xee, 0x0e, 0x81, 0x6a, 0xbb, 0x4d,
-  0x7f, 0x2e, 0x1c, 0xe6, 0x21, 0x46, 0x4a, 0xa6, 0x86, 0x95, 0xae, 0x24,
-  0x8f, 0x3d, 0xe0, 0x3c, 0x81, 0x52, 0xa7, 0xbc, 0x63, 0xb8, 0x48, 0x03,
-  0xdc, 0x09, 0xa4, 0x00, 0x4d, 0x1c, 0xbf, 0x83, 0x71, 0xc0, 0x49, 0x4d,
-  0x03, 0x48, 0x81, 0x7d, 0x8a, 0x7d, 0xa0, 0x39, 0x75, 0xfd, 0x81, 0xa8,
-  0xf2, 0xc7, 0x3d, 0x44, 0x24, 0x7f, 0xe0, 0x07, 0xf7, 0xf8, 0xd2, 0xa4,
-  0x21, 0x7f, 0x6c, 0xdc, 0x17, 0x8c, 0x29, 0x32, 0x7f, 0xf5, 0xad, 0x9f,
-  0xb9, 0xd3, 0xc3, 0x1b, 0x99, 0x60, 0x50, 0xc2, 0xb9, 0x73, 0x71, 0x7e,
-  0x84, 0xdb, 0x4e, 0x2b, 0xe5, 0xfb, 0x1d, 0x38, 0x2a, 0x3f, 0x36, 0xd1,
-  0xe2, 0xba, 0x7f, 0x29, 0xba, 0x00, 0xaa, 0x55, 0x81, 0x58, 0x3d, 0x97,
-  0xc0, 0xbb, 0xb1, 0xe4, 0xba, 0x3e, 0x63, 0xc6, 0x7f, 0x42, 0x0a, 0xf4,
-  0x1a, 0xad, 0x26, 0x68, 0xeb, 0x21, 0x81, 0x4c, 0xfa, 0x18, 0x3c, 0x40,
-  0x40, 0x10, 0xd0, 0x48, 0x7f, 0xbc, 0x70, 0x1c, 0xe8, 0xd0, 0x7f, 0x13,
-  0xbd, 0x71, 0xd9, 0xcf, 0x62, 0x90, 0x27, 0x56, 0x81, 0x48, 0xf9, 0x0b,
-  0x1e, 0x51, 0x44, 0xcd, 0xd8, 0xc6, 0x27, 0x63, 0x42, 0x72, 0x60, 0x10,
-  0x4b, 0x3d, 0x81, 0xf8, 0x31, 0xbf, 0x34, 0x5e, 0x57, 0x7c, 0xe8, 0xc4,
-  0x5e, 0x28, 0x81, 0x81, 0x1c, 0xd7, 0xd9, 0x46, 0xe4, 0xae, 0xb1, 0x7e,
-  0x6c, 0x6f, 0x69, 0x71, 0xc3, 0x96, 0x0c, 0xdf, 0xff, 0x13, 0xba, 0x70,
-  0xb2, 0x50, 0xac, 0x31, 0xa5, 0x91, 0x81, 0x8f, 0x9a, 0x64, 0xb9, 0x61,
-  0xd0, 0xf8, 0xc1, 0xdc, 0x5b, 0x7f, 0x10, 0x7f, 0xff, 0xe6, 0xfa, 0x4a,
-  0x38, 0x08, 0xa5, 0xe2, 0x99, 0x7f, 0x19, 0x46, 0xe1, 0xed, 0xdd, 0xf9,
-  0x7f, 0x36, 0x1c, 0xbf, 0x92, 0x1c, 0xbb, 0xc7, 0x7f, 0x13, 0x1d, 0xa3,
-  0x4e, 0x7a, 0x19, 0x81, 0xeb, 0x81, 0xff, 0x81, 0x92, 0x46, 0xcd, 0x22,
-  0x92, 0xe5, 0x92, 0xa7, 0xa1, 0x27, 0xa7, 0xe3, 0xea, 0x7f, 0xab, 0x5c,
-  0x7f, 0x4f, 0xa2, 0x7f, 0xf6, 0x84, 0xb6, 0x95, 0x17, 0x9e, 0x1d, 0x55,
-  0xe2, 0x0e, 0x40, 0xa2, 0x16, 0xb8, 0x7e, 0x54, 0x09, 0xe7, 0x1b, 0x7f,
-  0x54, 0xe5, 0xfd, 0xa1, 0x57, 0xb7, 0xb3, 0xdb, 0xa1, 0xdf, 0xae, 0xf2,
-  0x49, 0x17, 0xfa, 0xd6, 0xce, 0x64, 0xe6, 0x5d, 0x44, 0x44, 0x30, 0x6d,
-  0xd6, 0x08, 0x57, 0x92, 0xc8, 0x41, 0x7f, 0x24, 0xc6, 0xfe, 0x0c, 0x52,
-  0x1f, 0xeb, 0x3b, 0x1a, 0xa2, 0x81, 0xb8, 0xc8, 0xcc, 0x21, 0x81, 0x7d,
-  0x03, 0x58, 0x52, 0xa9, 0xce, 0x7f, 0xea, 0x15, 0xe1, 0xbb, 0x6f, 0x8a,
-  0xf0, 0x05, 0x1b, 0x66, 0x9b, 0xc0, 0x00, 0x08, 0xce, 0x3d, 0x66, 0x81,
-  0xc8, 0xa9, 0xca, 0xd9, 0x3f, 0xde, 0xce, 0x2b, 0x86, 0xc7, 0xb5, 0x46,
-  0xa8, 0x11, 0x7f, 0x93, 0x04, 0x81, 0x81, 0x7f, 0xc7, 0x81, 0xc3, 0x98,
-  0xed, 0x7b, 0x07, 0x40, 0xda, 0x28, 0xf5, 0x2b, 0xde, 0xf1, 0x1c, 0x99,
-  0x6b, 0x3f, 0x30, 0x38, 0x95, 0x14, 0x30, 0x30, 0x22, 0x3d, 0xf0, 0x81,
-  0x7f, 0x47, 0x4f, 0xd6, 0xe4, 0x90, 0x74, 0x91, 0xee, 0x50, 0xd9, 0x08,
-  0x86, 0x6c, 0x71, 0xe5, 0xe5, 0x2c, 0xd0, 0x4f, 0x88, 0x20, 0xea, 0x81,
-  0xa8, 0x1a, 0x33, 0xa0, 0x6c, 0xdd, 0x38, 0x29, 0x1b, 0x29, 0xc8, 0x50,
-  0x2a, 0xce, 0xe2, 0x32, 0x81, 0x33, 0x3d, 0x81, 0x11, 0xb3, 0xad, 0x81,
-  0xd0, 0x11, 0x81, 0xc4, 0xa8, 0x81, 0x33, 0x7f, 0x7f, 0xe0, 0x81, 0xdb,
-  0xbf, 0x2a, 0x2e, 0xc7, 0x41, 0xeb, 0xd9, 0x32, 0xc3, 0xd3, 0xac, 0x3d,
-  0x7f, 0xd1, 0x6e, 0x81, 0x0d, 0xb7, 0x7f, 0xd4, 0xef, 0x28, 0x4f, 0x55,
-  0xf5, 0x81, 0x81, 0x9a, 0x60, 0x72, 0xec, 0x52, 0x01, 0xd6, 0xc4, 0x7b,
-  0xcd, 0x96, 0xe1, 0x26, 0x43, 0x34, 0x43, 0x81, 0xa0, 0x81, 0x27, 0x41,
-  0x97, 0xc8, 0x84, 0x4d, 0xf6, 0xcd, 0xa3, 0xcb, 0x27, 0x62, 0xc1, 0x6a,
-  0x37, 0xbf, 0x59, 0x05, 0x3a, 0xc3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0xa1, 0xfd, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00,
-  0x6e, 0xf0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x8e, 0xf4, 0xff, 0xff,
-  0xeb, 0xf6, 0xff, 0xff, 0xa1, 0xfe, 0xff, 0xff, 0x4d, 0xf5, 0xff, 0xff,
-  0xe0, 0x13, 0x00, 0x00, 0x9c, 0xf5, 0xff, 0xff, 0x65, 0xff, 0xff, 0xff,
-  0xa5, 0xf7, 0xff, 0xff, 0x13, 0xf9, 0xff, 0xff, 0x4a, 0x0e, 0x00, 0x00,
-  0x7a, 0x04, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x7e, 0xfa, 0xff, 0xff,
-  0x85, 0xf4, 0xff, 0xff, 0x06, 0xf0, 0xff, 0xff, 0x56, 0x0c, 0x00, 0x00,
-  0x68, 0x01, 0x00, 0x00, 0x94, 0xf6, 0xff, 0xff, 0x4d, 0x11, 0x00, 0x00,
-  0x9f, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0xff, 0xff, 0xde, 0x09, 0x00, 0x00,
-  0x13, 0x09, 0x00, 0x00, 0xf9, 0x09, 0x00, 0x00, 0x88, 0x09, 0x00, 0x00,
-  0x8b, 0xeb, 0xff, 0xff, 0x8d, 0x08, 0x00, 0x00, 0x41, 0xf6, 0xff, 0xff,
-  0xd6, 0xf4, 0xff, 0xff, 0xd7, 0x01, 0x00, 0x00, 0x59, 0xef, 0xff, 0xff,
-  0x69, 0xf5, 0xff, 0xff, 0x77, 0x00, 0x00, 0x00, 0x2a, 0x05, 0x00, 0x00,
-  0xb1, 0x07, 0x00, 0x00, 0x70, 0xfd, 0xff, 0xff, 0x54, 0x08, 0x00, 0x00,
-  0x69, 0x0a, 0x00, 0x00, 0x6a, 0x06, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
-  0x5e, 0x1e, 0x00, 0x00, 0x15, 0xf5, 0xff, 0xff, 0x1f, 0xfc, 0xff, 0xff,
-  0xa1, 0xfb, 0xff, 0xff, 0x85, 0x11, 0x00, 0x00, 0xee, 0xf6, 0xff, 0xff,
-  0x1b, 0x11, 0x00, 0x00, 0xcb, 0xfe, 0xff, 0xff, 0x45, 0x03, 0x00, 0x00,
-  0x89, 0x09, 0x00, 0x00, 0xfa, 0x09, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0xff,
-  0xcc, 0x09, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x38, 0x0a, 0x00, 0x00,
-  0x11, 0xf4, 0xff, 0xff, 0x60, 0xf3, 0xff, 0xff, 0xe0, 0xf6, 0xff, 0xff,
-  0x19, 0xf8, 0xff, 0xff, 0x6a, 0x02, 0x00, 0x00, 0x46, 0xc4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xdd, 0xe1, 0xf8, 0x14,
-  0x2c, 0xe4, 0x47, 0x63, 0xce, 0xf5, 0x94, 0xf5, 0xe2, 0xb8, 0xae, 0x62,
-  0xd5, 0xdd, 0xbd, 0x0f, 0x67, 0xf4, 0xcd, 0x00, 0x34, 0x81, 0xe9, 0x1a,
-  0xb5, 0x2d, 0x6a, 0xb0, 0xcd, 0x62, 0xae, 0x1c, 0xe4, 0xde, 0x73, 0x10,
-  0x31, 0x92, 0x1f, 0x4f, 0x38, 0x17, 0xc6, 0xb7, 0xfe, 0xe5, 0xef, 0x62,
-  0x4b, 0xb5, 0x1e, 0xe6, 0x3c, 0x79, 0x1d, 0x42, 0x11, 0xba, 0x97, 0xb9,
-  0xad, 0x81, 0xf3, 0x03, 0xf3, 0x3a, 0x53, 0xa7, 0xfe, 0xe4, 0x7f, 0x6e,
-  0xf3, 0xa6, 0xa8, 0x1d, 0xf8, 0xc1, 0x12, 0x4e, 0x6f, 0x87, 0x07, 0xaf,
-  0x29, 0x5e, 0x54, 0xcf, 0xd9, 0x82, 0x06, 0x06, 0xcb, 0xd6, 0xa4, 0x1f,
-  0x34, 0x04, 0xc7, 0xbf, 0x40, 0xc4, 0xd2, 0x9d, 0x8e, 0x0f, 0xd1, 0x07,
-  0x86, 0xd4, 0xbd, 0x9f, 0x2d, 0x4b, 0xa1, 0xa9, 0x5f, 0xa4, 0xdf, 0x5c,
-  0xb6, 0x9c, 0x2c, 0xcf, 0xab, 0x0d, 0xc9, 0xf1, 0x24, 0xfc, 0x2c, 0xff,
-  0xe0, 0x7f, 0xc9, 0x3a, 0x1a, 0x55, 0xd9, 0xbf, 0xcb, 0xa1, 0x13, 0xee,
-  0xb7, 0xc8, 0x6a, 0x0b, 0xf8, 0x31, 0xc8, 0xb7, 0xc1, 0xd0, 0x8d, 0x16,
-  0x0a, 0x0e, 0x44, 0xf9, 0xd7, 0x6b, 0xfd, 0xea, 0x13, 0xda, 0xa2, 0x11,
-  0x9c, 0xf0, 0xf8, 0x4b, 0x5b, 0x2d, 0xf6, 0xb2, 0xe1, 0x8a, 0xc7, 0x7b,
-  0xe2, 0x9d, 0xcd, 0xbb, 0xc1, 0xfd, 0xec, 0x97, 0xbc, 0x3b, 0xbe, 0x3c,
-  0xcb, 0xc8, 0x16, 0x6e, 0xa9, 0xdc, 0x29, 0x8d, 0xca, 0x41, 0x23, 0x06,
-  0x27, 0x59, 0xb1, 0x22, 0x89, 0x44, 0x1b, 0xef, 0x34, 0x2b, 0x8e, 0xec,
-  0x3a, 0xf6, 0x23, 0x47, 0xc8, 0x5c, 0x52, 0x4a, 0x78, 0x34, 0xc9, 0x5e,
-  0x4e, 0x21, 0x3a, 0x19, 0x2a, 0x4b, 0xdc, 0x31, 0x55, 0xcd, 0x2a, 0x64,
-  0x2d, 0x20, 0x70, 0x3b, 0xaa, 0xed, 0x45, 0xd5, 0x81, 0xeb, 0xe2, 0x53,
-  0x11, 0x13, 0x68, 0x32, 0xde, 0xbf, 0x7d, 0x57, 0x45, 0xa8, 0xf9, 0xe0,
-  0x33, 0x61, 0xa6, 0xe6, 0xb2, 0x81, 0x26, 0xd0, 0xfd, 0x20, 0x08, 0xf8,
-  0x38, 0x96, 0xa2, 0xf3, 0xf8, 0xff, 0xf1, 0x76, 0xd9, 0xc8, 0x8a, 0xb4,
-  0x38, 0x3d, 0x44, 0xf1, 0xca, 0x15, 0xbe, 0xa7, 0xcc, 0xac, 0xa3, 0x37,
-  0x59, 0x8b, 0x3a, 0x3f, 0x27, 0x28, 0xc3, 0x01, 0x45, 0x42, 0x2f, 0xf3,
-  0xb4, 0x4b, 0x5a, 0xff, 0x87, 0xa6, 0x2b, 0x5f, 0x25, 0x11, 0xaa, 0x38,
-  0x01, 0x89, 0x60, 0x07, 0x47, 0xa2, 0xd7, 0xd7, 0x6b, 0xed, 0x66, 0x9b,
-  0xa6, 0x71, 0x0c, 0x1c, 0x9b, 0x19, 0x36, 0x7f, 0x97, 0x4e, 0x18, 0x9b,
-  0xfc, 0xd3, 0x5f, 0xfe, 0x94, 0x48, 0x3b, 0x9e, 0xfc, 0x19, 0xd2, 0x98,
-  0xcd, 0xa1, 0x8f, 0x23, 0xe6, 0x3e, 0x5a, 0x1e, 0x15, 0x1b, 0x22, 0x9d,
-  0xe5, 0x3b, 0x9d, 0x0a, 0x5f, 0xef, 0xa7, 0xc1, 0x44, 0x02, 0x29, 0x40,
-  0xdd, 0xc2, 0xb3, 0xf6, 0xf3, 0x44, 0x01, 0x29, 0x9f, 0xee, 0x43, 0x3d,
-  0x52, 0x5b, 0xe1, 0xd0, 0x75, 0xb3, 0xa8, 0x63, 0x49, 0x1b, 0x93, 0xc6,
-  0x4e, 0x2b, 0x57, 0x19, 0x42, 0x5a, 0xc3, 0x25, 0xfd, 0x9b, 0x19, 0xf3,
-  0x99, 0x89, 0x7f, 0xf4, 0x97, 0xa5, 0x28, 0xe8, 0x1f, 0x58, 0x4d, 0x62,
-  0xc0, 0xc0, 0x69, 0xf7, 0xb2, 0xab, 0x08, 0xe7, 0x68, 0x96, 0xc9, 0xa5,
-  0x35, 0x69, 0x29, 0x70, 0x39, 0xbb, 0xfb, 0xf9, 0x93, 0x6b, 0xf8, 0x98,
-  0x5a, 0x42, 0x3e, 0x5d, 0xe9, 0xde, 0xf2, 0x36, 0xeb, 0xda, 0x7f, 0xe1,
-  0x96, 0xf7, 0x4b, 0x0c, 0x87, 0xa0, 0xd8, 0x17, 0xb1, 0x46, 0xd6, 0xb0,
-  0x33, 0x78, 0x18, 0x9d, 0x2f, 0x12, 0xd1, 0x09, 0xb0, 0x39, 0x92, 0x99,
-  0x1c, 0x4e, 0x94, 0x64, 0x1e, 0x88, 0xfe, 0xf8, 0x3c, 0x22, 0xaf, 0x06,
-  0xb1, 0xc2, 0xb0, 0x10, 0xda, 0x59, 0x5b, 0x5e, 0x97, 0x42, 0x6b, 0x13,
-  0x82, 0x5c, 0x48, 0xfe, 0x1f, 0xe3, 0x29, 0xec, 0xdf, 0xe6, 0x91, 0x01,
-  0xf1, 0x99, 0xa9, 0x5b, 0xa5, 0x36, 0x8c, 0xa2, 0xd3, 0xb7, 0x73, 0x06,
-  0xba, 0x17, 0xbe, 0x5b, 0xc9, 0x2e, 0xa4, 0x5e, 0x20, 0x38, 0x75, 0x88,
-  0x81, 0xf0, 0xb8, 0xc2, 0x91, 0xaf, 0x2d, 0x70, 0x5f, 0x12, 0x11, 0x68,
-  0xfd, 0xab, 0x2f, 0x3d, 0x9c, 0x1c, 0x1a, 0x33, 0x1c, 0xa1, 0x02, 0x3d,
-  0x0e, 0xe9, 0xa9, 0x55, 0xbb, 0x6c, 0xe8, 0xe8, 0x95, 0xa0, 0x7a, 0x2f,
-  0xd8, 0xbf, 0x06, 0xc9, 0xca, 0x24, 0xc8, 0x4c, 0xca, 0xd7, 0xe6, 0x79,
-  0x6b, 0x54, 0x3a, 0x29, 0xa2, 0x5e, 0x61, 0xe0, 0x76, 0x04, 0xf0, 0x60,
-  0x05, 0x97, 0xb9, 0x53, 0xce, 0x20, 0xfe, 0xd1, 0x0b, 0x5d, 0x7b, 0xb1,
-  0x7f, 0x68, 0xfb, 0xfe, 0x16, 0x3e, 0xb4, 0xdc, 0x10, 0xf0, 0x86, 0x67,
-  0xfe, 0xb2, 0x01, 0x4b, 0x91, 0x20, 0x4d, 0xda, 0x15, 0x7f, 0x05, 0x27,
-  0x19, 0x07, 0xc2, 0x8c, 0xa7, 0x49, 0x62, 0xe4, 0x68, 0xb7, 0xb0, 0x52,
-  0xf6, 0x9a, 0xc5, 0x65, 0xc2, 0x6a, 0x00, 0xbd, 0xb3, 0xc6, 0x57, 0xdc,
-  0x16, 0x48, 0x33, 0x4c, 0x28, 0x56, 0x4e, 0xa1, 0xaa, 0xdd, 0x38, 0xe6,
-  0x5f, 0xe8, 0x18, 0xc1, 0xb6, 0xfe, 0x3e, 0x8f, 0xa9, 0x4c, 0x86, 0x09,
-  0xb0, 0x22, 0x98, 0x85, 0x51, 0x40, 0x3f, 0xf2, 0x07, 0xc6, 0x1a, 0xfc,
-  0xec, 0xea, 0x0b, 0x44, 0xa5, 0xdc, 0xb4, 0x3a, 0x3b, 0xcb, 0xa2, 0x9c,
-  0x7f, 0x43, 0xb5, 0xf1, 0x6d, 0xc1, 0x4d, 0x45, 0x19, 0x97, 0x65, 0x36,
-  0x5f, 0x49, 0x53, 0x7e, 0x5a, 0xc1, 0x65, 0xa3, 0xd6, 0x48, 0xab, 0xb4,
-  0xcb, 0x9d, 0xae, 0xb1, 0xbe, 0x77, 0x43, 0xca, 0x31, 0x8f, 0xe4, 0x5c,
-  0x39, 0xf2, 0x19, 0x1e, 0x9f, 0x65, 0x3b, 0x43, 0xeb, 0xeb, 0x3e, 0x54,
-  0xe6, 0xfd, 0x9d, 0xd6, 0x75, 0xd4, 0xeb, 0xc5, 0x8f, 0x58, 0xd9, 0x06,
-  0xeb, 0x32, 0x09, 0xf3, 0xe0, 0x11, 0x44, 0xd4, 0xf7, 0xb7, 0xbb, 0x2b,
-  0x42, 0x1f, 0x7f, 0x6d, 0xcd, 0xe5, 0x05, 0x58, 0xf5, 0x45, 0x6d, 0xde,
-  0xdc, 0x5f, 0x3b, 0x92, 0x94, 0x03, 0xfe, 0xe3, 0x36, 0x53, 0xc3, 0x6d,
-  0x9a, 0x04, 0xd5, 0xe9, 0xbe, 0x39, 0xc0, 0x42, 0x3a, 0xf7, 0xa0, 0xd2,
-  0x00, 0x17, 0x7d, 0xcc, 0xb3, 0xe4, 0x40, 0x51, 0xd7, 0xdd, 0xf9, 0xfc,
-  0xdb, 0xf4, 0x5d, 0xfd, 0x62, 0xc6, 0x2b, 0xc9, 0x2f, 0x2f, 0x17, 0xd3,
-  0x5d, 0x81, 0x67, 0xa1, 0x17, 0xc6, 0xae, 0x31, 0x32, 0x45, 0xce, 0x15,
-  0xe8, 0xe8, 0x66, 0x3e, 0xc8, 0xa3, 0x63, 0x4c, 0xa2, 0x28, 0x17, 0xcf,
-  0xd9, 0x36, 0x6e, 0x61, 0x73, 0xef, 0x69, 0xe3, 0xa6, 0x9f, 0xf3, 0x34,
-  0xcd, 0x72, 0xf6, 0x3d, 0x0d, 0xf2, 0xbd, 0x64, 0x92, 0x49, 0x9d, 0xfc,
-  0xed, 0xc6, 0x9e, 0x0d, 0xe4, 0xbe, 0xeb, 0x9c, 0xfe, 0x74, 0x61, 0x48,
-  0x5b, 0x4f, 0xcc, 0x33, 0x28, 0x27, 0x98, 0x5a, 0x55, 0xe8, 0xc9, 0xd4,
-  0xb3, 0xb1, 0xd5, 0x17, 0x6d, 0x95, 0x75, 0x2a, 0x58, 0x7f, 0x73, 0x4f,
-  0x8d, 0x2f, 0x6c, 0xd5, 0xd6, 0xfc, 0xe6, 0x0a, 0x9a, 0x33, 0x1c, 0x5f,
-  0xdd, 0x13, 0x20, 0xff, 0xfa, 0xf1, 0xb6, 0x28, 0xd7, 0x68, 0x1a, 0x53,
-  0x5c, 0xae, 0xb5, 0x60, 0xe2, 0xd8, 0x2f, 0xc5, 0x01, 0x54, 0xc0, 0xfb,
-  0x21, 0xf8, 0x39, 0x5e, 0xd4, 0x6f, 0x01, 0x56, 0xab, 0xc7, 0xe2, 0x41,
-  0x2e, 0xbb, 0x23, 0x6c, 0xff, 0xcf, 0x6e, 0x34, 0xf3, 0x3c, 0xd5, 0x87,
-  0xf4, 0x01, 0x15, 0x43, 0x0f, 0x9a, 0x95, 0x50, 0x7f, 0x74, 0x17, 0xfc,
-  0xef, 0x48, 0x07, 0x43, 0x43, 0x5b, 0x20, 0xd1, 0x77, 0x62, 0xa8, 0x22,
-  0x6b, 0xfb, 0x27, 0x50, 0xac, 0x6a, 0x57, 0x33, 0xea, 0xdc, 0xda, 0x11,
-  0xad, 0x51, 0xd6, 0xbc, 0x66, 0x16, 0xd4, 0x54, 0xa2, 0xf2, 0x81, 0xc4,
-  0xea, 0x4e, 0xb0, 0xfb, 0x6a, 0xc5, 0xe0, 0xc2, 0xfb, 0x97, 0x53, 0x17,
-  0x55, 0x5f, 0x4d, 0x4d, 0x3b, 0x51, 0x43, 0x19, 0xa2, 0x14, 0xce, 0x5b,
-  0xed, 0x68, 0x37, 0x11, 0x2b, 0x76, 0x13, 0x9a, 0x41, 0xd1, 0xf7, 0xf3,
-  0x3f, 0x75, 0x9c, 0x69, 0x03, 0xea, 0xb8, 0x07, 0xb5, 0x4b, 0xb4, 0xb3,
-  0xd9, 0xda, 0xd3, 0xca, 0xfb, 0xca, 0x50, 0xf3, 0x60, 0xf2, 0x26, 0x37,
-  0x7f, 0xae, 0xf6, 0x90, 0x89, 0xf6, 0x4b, 0xa7, 0x1f, 0x56, 0x1b, 0x46,
-  0xe8, 0x98, 0xb4, 0x56, 0x3e, 0xca, 0xcd, 0x8c, 0xbb, 0x40, 0x3b, 0xc6,
-  0x04, 0xc9, 0xb5, 0x9d, 0x01, 0xc7, 0x24, 0xc0, 0x59, 0xb0, 0x99, 0xfb,
-  0xbf, 0xc5, 0x65, 0x2e, 0x8e, 0x4c, 0xcd, 0xca, 0xea, 0x61, 0xa1, 0x2f,
-  0x3f, 0x33, 0xdb, 0x29, 0x89, 0x45, 0x85, 0x04, 0x3c, 0xde, 0x3b, 0x4a,
-  0x31, 0xad, 0x66, 0x5b, 0x73, 0xcd, 0x21, 0x51, 0xaa, 0xbf, 0x67, 0x14,
-  0x9d, 0xe5, 0xbf, 0x0e, 0x30, 0xf9, 0xfa, 0xde, 0x70, 0x21, 0xe4, 0x50,
-  0x1b, 0x62, 0x7a, 0x39, 0x25, 0x91, 0xd9, 0xfe, 0x66, 0xca, 0xcb, 0xd7,
-  0x0b, 0x81, 0xa5, 0x74, 0xb4, 0xdb, 0x3c, 0x1e, 0x3a, 0x93, 0x26, 0x19,
-  0x01, 0x78, 0x5a, 0x48, 0xe6, 0x8f, 0xe2, 0x32, 0x70, 0x50, 0x36, 0xf4,
-  0xc2, 0xc2, 0x9d, 0xb9, 0xef, 0x41, 0x04, 0x73, 0xa8, 0xaa, 0x37, 0x1f,
-  0x88, 0xcf, 0x74, 0x48, 0xe9, 0x99, 0x2f, 0x52, 0x29, 0xd7, 0x64, 0xd5,
-  0x99, 0x3f, 0x5a, 0xc2, 0x76, 0x75, 0xe8, 0x46, 0x53, 0x4f, 0x81, 0xc9,
-  0x1b, 0x58, 0x5f, 0x49, 0x15, 0x7f, 0x15, 0x55, 0x5d, 0x97, 0x1e, 0xcd,
-  0xe9, 0x5e, 0xfd, 0xe0, 0xeb, 0x03, 0xbb, 0x3c, 0xad, 0xcb, 0x52, 0x0c,
-  0xb4, 0x57, 0x0b, 0x4f, 0xdf, 0x36, 0xca, 0xf0, 0x4b, 0x4a, 0x2a, 0x3d,
-  0xc9, 0x58, 0x4c, 0xc8, 0x5e, 0xac, 0x2a, 0x21, 0xab, 0xe9, 0xe7, 0xf2,
-  0x4f, 0x1c, 0x22, 0x42, 0x20, 0x2d, 0x1d, 0x76, 0x5e, 0xa0, 0xe6, 0x3d,
-  0x5c, 0x4b, 0x05, 0xd8, 0xe2, 0xf2, 0xc2, 0x52, 0xd4, 0x55, 0x7f, 0xa5,
-  0x48, 0x1d, 0xaf, 0x5a, 0xaf, 0x69, 0x2b, 0xab, 0xe1, 0xb1, 0x30, 0x49,
-  0xf6, 0xd3, 0xff, 0xea, 0xe9, 0xb8, 0xc3, 0x29, 0xa3, 0xea, 0x12, 0xbf,
-  0x40, 0xda, 0x60, 0x31, 0xc9, 0xe9, 0x20, 0xc6, 0xa8, 0x0c, 0x49, 0x96,
-  0x6a, 0x1a, 0x42, 0x66, 0x11, 0xa1, 0x09, 0xd7, 0x54, 0x6b, 0xe8, 0xb5,
-  0x29, 0x7d, 0xe9, 0xbe, 0x5e, 0x0d, 0x2e, 0xe2, 0x35, 0x06, 0xeb, 0x3f,
-  0x5c, 0x6d, 0x3f, 0x1b, 0x5a, 0x31, 0x06, 0x2e, 0xde, 0x7f, 0xa4, 0x43,
-  0x94, 0x81, 0x12, 0xa9, 0xe3, 0x90, 0xed, 0x21, 0x62, 0xe3, 0xfd, 0x1e,
-  0x40, 0xcb, 0x22, 0xf9, 0xd8, 0x0b, 0x9a, 0x56, 0xcf, 0x0b, 0xa9, 0xba,
-  0x2a, 0xb3, 0xaf, 0xae, 0x15, 0xb7, 0x62, 0x38, 0x03, 0xfa, 0x24, 0x3a,
-  0xd9, 0x13, 0xb0, 0x16, 0x9d, 0xdd, 0xc3, 0x3f, 0xfe, 0xde, 0x1b, 0x70,
-  0x46, 0x73, 0x99, 0x3e, 0xd0, 0x18, 0x2b, 0x94, 0x16, 0xc9, 0x64, 0xfe,
-  0xc4, 0xb1, 0x3b, 0xf2, 0xc3, 0x25, 0xe5, 0xcf, 0x9d, 0x3a, 0x4a, 0xc9,
-  0xf0, 0xc9, 0x36, 0xdf, 0xf1, 0xdc, 0xfc, 0x0c, 0xac, 0x7f, 0xb2, 0x4d,
-  0x17, 0xa0, 0x38, 0xdc, 0x39, 0xff, 0xdf, 0x0f, 0x79, 0xb9, 0xe9, 0x4c,
-  0xfb, 0xe2, 0x56, 0xaa, 0xe4, 0x02, 0x3a, 0xe9, 0x24, 0xfd, 0x9b, 0x07,
-  0x3e, 0xac, 0xd1, 0x3f, 0xee, 0xef, 0xa0, 0xcc, 0xc8, 0xff, 0x28, 0xfe,
-  0x0f, 0x59, 0x39, 0xf4, 0x28, 0xa9, 0xf5, 0x06, 0xa4, 0x17, 0x60, 0xff,
-  0x81, 0x19, 0x2a, 0x32, 0xdd, 0xf8, 0x96, 0xd1, 0xc2, 0xec, 0xbf, 0x59,
-  0x46, 0x7a, 0xd5, 0x3d, 0xdd, 0xc5, 0x3c, 0x2a, 0x2c, 0x8e, 0x1a, 0x51,
-  0xab, 0x3d, 0xa2, 0x47, 0xe3, 0x6a, 0xf9, 0xf8, 0xd9, 0x97, 0xb4, 0x2a,
-  0xe1, 0xaa, 0xc8, 0x12, 0x08, 0xbf, 0xf0, 0x13, 0x9d, 0x97, 0xde, 0x52,
-  0x41, 0x01, 0x39, 0x50, 0x38, 0x51, 0xe5, 0x73, 0xfd, 0xf2, 0x1c, 0x62,
-  0xd4, 0xc8, 0x99, 0xd1, 0xcb, 0xe0, 0x44, 0x87, 0xe8, 0xac, 0x57, 0x0f,
-  0x9f, 0x55, 0x24, 0xd0, 0xff, 0xb7, 0xb7, 0xf7, 0x4b, 0xad, 0x81, 0xfc,
-  0xfa, 0x8f, 0x3d, 0x52, 0x29, 0x0c, 0x1f, 0xfc, 0x4c, 0x09, 0x91, 0xc0,
-  0x89, 0x41, 0x05, 0xea, 0x9f, 0x25, 0x0e, 0x36, 0x8e, 0xc5, 0xef, 0x1a,
-  0xf9, 0xf2, 0x5c, 0xc4, 0x38, 0x60, 0x49, 0xc3, 0x47, 0xfd, 0x94, 0x6f,
-  0x6e, 0x62, 0xcf, 0x9c, 0xb5, 0xd6, 0x15, 0x2b, 0x18, 0x12, 0x23, 0x00,
-  0xe9, 0x89, 0x17, 0x22, 0xbf, 0x44, 0xaa, 0x14, 0xc0, 0x35, 0xf2, 0x57,
-  0x10, 0xc0, 0x37, 0x68, 0x58, 0x3f, 0xe6, 0xf7, 0xff, 0x77, 0xcb, 0xeb,
-  0x55, 0x57, 0xc0, 0xc7, 0xf9, 0x4c, 0x09, 0xfc, 0x24, 0xd8, 0x2f, 0x4b,
-  0x5d, 0x62, 0xe4, 0xa0, 0xca, 0xfe, 0x7f, 0x0e, 0xf0, 0x6f, 0xc7, 0x2a,
-  0x2e, 0x91, 0xbe, 0x05, 0x4c, 0x60, 0xfc, 0x1a, 0x93, 0xfc, 0xbb, 0xfb,
-  0x16, 0x9e, 0x60, 0x2f, 0x09, 0xa0, 0x52, 0x59, 0x2e, 0xe3, 0xbd, 0x03,
-  0x4c, 0xf6, 0xf2, 0x18, 0xd5, 0x8c, 0xff, 0x5d, 0xbb, 0x18, 0x65, 0x3c,
-  0xed, 0x9f, 0x74, 0x9d, 0xaa, 0xfb, 0xc4, 0x5c, 0x8e, 0xb5, 0x73, 0x94,
-  0x16, 0xcf, 0x7f, 0x00, 0x30, 0xee, 0x91, 0xee, 0x07, 0x6c, 0xbf, 0x3d,
-  0xa5, 0x19, 0xf8, 0xa2, 0x65, 0x0d, 0x92, 0xde, 0x26, 0x64, 0xfb, 0x63,
-  0xd8, 0x13, 0xac, 0x4c, 0x0e, 0xf4, 0x24, 0x60, 0x2b, 0x2a, 0x41, 0xfa,
-  0xea, 0xc4, 0x6e, 0x74, 0x21, 0xa6, 0x06, 0x6a, 0xe0, 0xc0, 0x39, 0xe5,
-  0x35, 0xe4, 0x06, 0x62, 0xcf, 0x33, 0xee, 0x99, 0x57, 0xbd, 0x71, 0xa9,
-  0xf1, 0xe3, 0xde, 0x40, 0x94, 0x3c, 0x81, 0xb0, 0x76, 0x0b, 0x00, 0x43,
-  0x6e, 0xd2, 0xfd, 0xa5, 0x4f, 0x69, 0x44, 0xc5, 0xda, 0xc5, 0x3c, 0xa8,
-  0x20, 0x13, 0xbe, 0x20, 0xf7, 0xcc, 0xe3, 0xed, 0x00, 0xd0, 0x33, 0x43,
-  0x70, 0x4d, 0x93, 0xf7, 0xc2, 0xa7, 0x31, 0xf7, 0x08, 0xa6, 0x6f, 0x30,
-  0xcf, 0x7e, 0xcc, 0x15, 0xaf, 0xff, 0xf4, 0xa0, 0x5e, 0xe7, 0xd6, 0xca,
-  0xc1, 0x21, 0x1e, 0x9d, 0xc8, 0x78, 0x4a, 0xc1, 0xa5, 0x4e, 0x17, 0x1a,
-  0xc1, 0xd1, 0xee, 0x7d, 0x49, 0xb0, 0x18, 0x23, 0x35, 0x6d, 0x56, 0x2e,
-  0x81, 0xbd, 0xc8, 0x19, 0xfb, 0xb2, 0xea, 0x99, 0x64, 0x3f, 0x67, 0xfe,
-  0xd6, 0x23, 0x08, 0x57, 0x46, 0x77, 0x30, 0xb1, 0x3c, 0x5e, 0xd0, 0x4c,
-  0x38, 0x8b, 0xc0, 0x3b, 0x08, 0x75, 0x35, 0x81, 0x2b, 0xc4, 0xc6, 0x55,
-  0xbf, 0x00, 0xb9, 0xbe, 0xed, 0x62, 0x7b, 0x4f, 0xad, 0x77, 0x46, 0x0b,
-  0xcc, 0x20, 0x31, 0x44, 0x1a, 0x28, 0x0c, 0x54, 0x6d, 0x93, 0x04, 0xb3,
-  0xb7, 0x35, 0xe4, 0xc3, 0xd5, 0xe2, 0x8f, 0x4e, 0x0c, 0x18, 0x3e, 0xf2,
-  0xa7, 0xdc, 0x0d, 0xed, 0xcc, 0xaf, 0x65, 0xcb, 0xab, 0xe3, 0xeb, 0x49,
-  0xf1, 0xee, 0x46, 0x10, 0xae, 0xd8, 0x99, 0x01, 0x1d, 0x81, 0x36, 0x33,
-  0x39, 0xa9, 0xe9, 0xed, 0x47, 0x60, 0xc8, 0x4c, 0xfd, 0x20, 0x0a, 0x3c,
-  0xc8, 0xba, 0xc7, 0x22, 0x5a, 0x40, 0x34, 0x1a, 0x2a, 0x25, 0xc3, 0x4b,
-  0xba, 0x9d, 0x2b, 0xbb, 0x37, 0x8b, 0x49, 0xe9, 0xd3, 0x58, 0xef, 0xf9,
-  0x0b, 0xfe, 0x49, 0x37, 0x2b, 0x94, 0x14, 0x5c, 0x58, 0x5d, 0xfd, 0x2f,
-  0x8b, 0x5c, 0xd0, 0xbd, 0xd0, 0xbc, 0x58, 0x70, 0x91, 0x51, 0x15, 0xef,
-  0xdb, 0x21, 0x8d, 0x22, 0x35, 0x8e, 0xb8, 0xb1, 0xa4, 0x6a, 0xa5, 0xaf,
-  0x28, 0xfb, 0xf2, 0xb5, 0xbb, 0xe4, 0xbe, 0x07, 0x25, 0x31, 0xdd, 0x03,
-  0xb0, 0x7c, 0xf8, 0x7e, 0x8c, 0xb6, 0xf0, 0xe4, 0xc9, 0x42, 0xc4, 0x42,
-  0x5e, 0xa7, 0x7a, 0xd2, 0x2b, 0x04, 0x7f, 0xcf, 0xed, 0xa5, 0xf9, 0x32,
-  0xf3, 0x77, 0xac, 0xce, 0x3c, 0x0d, 0xe3, 0xb2, 0x59, 0x3f, 0xd1, 0xa6,
-  0xa9, 0x45, 0x29, 0xb7, 0x7a, 0xa1, 0x5c, 0x3c, 0x63, 0xb9, 0x0d, 0xae,
-  0x3e, 0x5b, 0xdb, 0x6f, 0x64, 0x9d, 0x32, 0x45, 0xbd, 0x6c, 0x81, 0x4b,
-  0xb4, 0xe2, 0xd4, 0x4a, 0xd1, 0x7d, 0xd3, 0xcd, 0xaf, 0x4a, 0x29, 0x6c,
-  0x42, 0xeb, 0xc4, 0x5c, 0x2f, 0x53, 0xf9, 0xf9, 0x95, 0xd2, 0xbb, 0x63,
-  0xa6, 0xc4, 0xa1, 0xd2, 0x5d, 0x20, 0xc3, 0x02, 0xf4, 0x62, 0xb0, 0x41,
-  0xdc, 0x22, 0x53, 0x0f, 0xab, 0xd2, 0xa5, 0xaf, 0xea, 0xbc, 0x2b, 0x53,
-  0xdd, 0xb1, 0x21, 0x63, 0xff, 0x4b, 0xbd, 0x34, 0x1e, 0x2b, 0xa5, 0xae,
-  0xd7, 0xce, 0xc3, 0xb8, 0xb5, 0xe0, 0x47, 0xa0, 0xd3, 0x2b, 0x1b, 0x1d,
-  0x0c, 0xfd, 0xf9, 0xe6, 0x3d, 0xde, 0x7f, 0x2d, 0xc5, 0xca, 0x4a, 0x49,
-  0x42, 0xa9, 0x2c, 0xeb, 0x47, 0xb3, 0xd5, 0xf8, 0xa0, 0x89, 0xf8, 0xa4,
-  0xba, 0x9d, 0xc9, 0xfe, 0x33, 0x61, 0x46, 0xfa, 0xf2, 0x25, 0xba, 0x9b,
-  0x46, 0x37, 0xc0, 0xc4, 0x19, 0x3f, 0xf3, 0x14, 0x54, 0x0d, 0xcb, 0x46,
-  0x2b, 0xa4, 0x11, 0xbf, 0xae, 0x1a, 0x45, 0x3a, 0x53, 0xbc, 0xb4, 0x33,
-  0xe1, 0x30, 0xc8, 0xb4, 0xb5, 0xd9, 0x59, 0x81, 0x98, 0x31, 0xbf, 0xd6,
-  0x6e, 0xbb, 0x01, 0x2b, 0x56, 0x12, 0x1f, 0xcf, 0xb1, 0x2f, 0xe5, 0xda,
-  0x17, 0x47, 0xce, 0x3d, 0xed, 0xbc, 0x92, 0x60, 0x0f, 0x0c, 0xdd, 0xb2,
-  0xbd, 0x61, 0xde, 0x13, 0xa4, 0xda, 0xbb, 0x14, 0x32, 0xd8, 0x30, 0x3c,
-  0xc8, 0xb5, 0x38, 0xd8, 0x05, 0x23, 0xd4, 0xc4, 0xfc, 0x58, 0xa5, 0xc2,
-  0xfc, 0x06, 0x0d, 0xcf, 0x21, 0x90, 0x1a, 0x0e, 0x96, 0xf2, 0x08, 0x7c,
-  0x7f, 0x32, 0x4a, 0xf5, 0x1c, 0x71, 0x00, 0xee, 0x6e, 0x54, 0xb2, 0xf9,
-  0xee, 0x12, 0x18, 0xc5, 0x11, 0xa4, 0x03, 0xfe, 0xbc, 0xb9, 0xe0, 0xb6,
-  0x46, 0x00, 0x24, 0x5e, 0xa8, 0x47, 0xf8, 0x12, 0x9c, 0x2c, 0x0a, 0xde,
-  0xfa, 0xe3, 0xf9, 0x1a, 0x54, 0x24, 0x7f, 0x0c, 0x26, 0x43, 0x15, 0xcc,
-  0x21, 0xf5, 0x4a, 0x07, 0x28, 0x35, 0x3f, 0xa6, 0xab, 0x33, 0x04, 0xdf,
-  0xdf, 0x54, 0xf2, 0x5e, 0xb9, 0xed, 0x89, 0xbb, 0xcd, 0x1a, 0x4a, 0xba,
-  0xd4, 0x67, 0xf0, 0x02, 0xbd, 0x35, 0x64, 0x35, 0xf0, 0x19, 0x11, 0x09,
-  0x18, 0xc4, 0xd6, 0x43, 0xac, 0x07, 0x49, 0xfa, 0xa6, 0x24, 0x6f, 0x32,
-  0x0b, 0x9b, 0x9c, 0xff, 0xfa, 0x01, 0x13, 0x55, 0x0d, 0x9d, 0xa0, 0x6e,
-  0xbe, 0xcd, 0xce, 0xd2, 0x0f, 0x47, 0x59, 0x29, 0x44, 0x49, 0xf2, 0xa9,
-  0x15, 0xf7, 0xfd, 0xe9, 0x14, 0x3b, 0x43, 0xbe, 0x00, 0x45, 0x2d, 0x45,
-  0xba, 0xba, 0x32, 0x41, 0x04, 0x4a, 0x45, 0x81, 0xdf, 0x58, 0x40, 0x44,
-  0xad, 0x0b, 0xe5, 0x14, 0x0a, 0xf8, 0x3f, 0x16, 0xcb, 0x22, 0x29, 0x6d,
-  0x29, 0x1e, 0xd6, 0x19, 0x26, 0x2d, 0x2a, 0xf6, 0x42, 0xac, 0xca, 0x62,
-  0x0e, 0xde, 0xec, 0xf8, 0x00, 0x5d, 0x36, 0xde, 0x7a, 0x48, 0xf4, 0xed,
-  0xa3, 0x57, 0xb5, 0x50, 0xa9, 0x0d, 0xbf, 0xb9, 0xf2, 0x4f, 0x8c, 0xa2,
-  0xd4, 0x9f, 0xaf, 0x9f, 0x2c, 0x2d, 0x02, 0x2a, 0xf4, 0x4e, 0x55, 0x7f,
-  0x16, 0x12, 0x2b, 0xac, 0xd4, 0x68, 0xc5, 0xd2, 0xff, 0x4d, 0xbb, 0x41,
-  0x8f, 0x43, 0x9f, 0x2f, 0x4b, 0x21, 0xf6, 0x8d, 0xfe, 0x3a, 0x32, 0x15,
-  0x77, 0x58, 0x8e, 0xfc, 0x6c, 0x4e, 0x64, 0x04, 0xae, 0xc7, 0x16, 0x35,
-  0xce, 0xc2, 0xb3, 0x46, 0xa9, 0xf0, 0xca, 0x48, 0xf5, 0xa5, 0x67, 0x70,
-  0xb6, 0x02, 0x7f, 0x97, 0x1a, 0xa3, 0x6c, 0x0d, 0x04, 0x51, 0x59, 0xab,
-  0x02, 0x0e, 0xd5, 0x7d, 0x96, 0xf3, 0xaa, 0xfa, 0xb6, 0x1b, 0xd4, 0x54,
-  0xc7, 0x55, 0x2f, 0xd7, 0x18, 0xa5, 0xd7, 0xc6, 0xcc, 0x46, 0x09, 0xcf,
-  0x33, 0xa4, 0xdb, 0x57, 0x6b, 0x66, 0xaa, 0x32, 0x18, 0xa5, 0x6c, 0x3c,
-  0xca, 0xa3, 0xdb, 0x40, 0x4c, 0xfd, 0xd4, 0x26, 0x27, 0x9d, 0x51, 0xfe,
-  0x65, 0x57, 0xe9, 0x2e, 0x81, 0x4c, 0xaa, 0x3a, 0xaf, 0xe7, 0x37, 0x68,
-  0x31, 0xe5, 0x4d, 0x40, 0x99, 0xb8, 0xbc, 0x6f, 0xf8, 0xed, 0x56, 0x01,
-  0xf4, 0xe7, 0x3c, 0x4c, 0x5e, 0x6f, 0xa5, 0x60, 0xed, 0xd3, 0x21, 0x36,
-  0xbd, 0x7b, 0x6b, 0x47, 0xef, 0xd0, 0xfe, 0x2b, 0xca, 0x16, 0xba, 0xb6,
-  0x06, 0x00, 0xa9, 0xf3, 0x13, 0x7f, 0xf6, 0xdc, 0x31, 0x4d, 0x50, 0x63,
-  0x55, 0x3e, 0xaf, 0xc0, 0x49, 0xe8, 0xe9, 0xb5, 0x3e, 0x42, 0x05, 0x09,
-  0x79, 0xa1, 0xbc, 0x2b, 0x30, 0x52, 0x57, 0x97, 0x3b, 0xd3, 0xd8, 0x08,
-  0x04, 0x59, 0x04, 0xbe, 0x4f, 0xc2, 0xf2, 0x55, 0x36, 0x5f, 0x54, 0x46,
-  0x52, 0x43, 0x49, 0xf0, 0xbd, 0xb7, 0x0b, 0x7e, 0xaa, 0x52, 0x72, 0x39,
-  0x8c, 0x71, 0x18, 0x7c, 0xc7, 0x30, 0x42, 0x03, 0x07, 0xe6, 0xdc, 0x2b,
-  0xd1, 0x6a, 0x06, 0xc4, 0x40, 0x11, 0xa0, 0x1c, 0x58, 0x50, 0xaa, 0xd8,
-  0x7f, 0xff, 0x29, 0xb4, 0xa6, 0x5c, 0x51, 0x3d, 0x1c, 0xa4, 0x0c, 0x77,
-  0x00, 0x7c, 0xc8, 0x04, 0x33, 0xf3, 0x2e, 0xbd, 0x54, 0x9a, 0xb5, 0x2d,
-  0xff, 0x1d, 0x11, 0x3e, 0x19, 0xdf, 0x1a, 0x81, 0xc2, 0x0b, 0xb2, 0xb3,
-  0x34, 0xe9, 0x13, 0x2b, 0xe4, 0x0c, 0xc3, 0xfe, 0x69, 0xa9, 0x99, 0x5c,
-  0xf2, 0xbe, 0xc1, 0xa7, 0x1f, 0xbc, 0x52, 0x97, 0xd0, 0xe6, 0x46, 0xd4,
-  0x1b, 0xb6, 0xb3, 0x71, 0x48, 0x0d, 0xf3, 0xb4, 0x43, 0x60, 0x9b, 0x56,
-  0x22, 0xf2, 0xb5, 0xff, 0x0b, 0x3d, 0xd9, 0xfd, 0xa1, 0xdf, 0x57, 0x6a,
-  0x07, 0xc8, 0xfa, 0x95, 0xe8, 0x15, 0x1e, 0x4e, 0xc6, 0xd7, 0x13, 0xfe,
-  0x2d, 0x4f, 0xdd, 0xe8, 0x1d, 0x19, 0x08, 0xa3, 0xb0, 0x9c, 0x9f, 0xa6,
-  0x03, 0xdf, 0x17, 0x01, 0xfe, 0x7f, 0xc1, 0x2b, 0x14, 0x06, 0xe0, 0x45,
-  0x3b, 0xe0, 0x36, 0xd0, 0xb4, 0x08, 0x30, 0x61, 0x0d, 0x1a, 0x0c, 0xf2,
-  0x33, 0xe9, 0xb9, 0x9f, 0xb7, 0x34, 0xd6, 0xc2, 0xa0, 0x36, 0xbd, 0x5b,
-  0x7f, 0x4d, 0xdc, 0xf0, 0xa0, 0xdd, 0xcc, 0x46, 0xe5, 0x66, 0x51, 0x11,
-  0x30, 0xe3, 0xcb, 0x3b, 0x3f, 0xeb, 0x0a, 0x43, 0x2f, 0x47, 0x3c, 0x24,
-  0x0a, 0xc3, 0xbd, 0x39, 0x3b, 0x26, 0x0e, 0xdd, 0xab, 0x09, 0x3f, 0x71,
-  0x37, 0xf5, 0xcb, 0x3b, 0xcc, 0xb7, 0x58, 0x3d, 0xc0, 0x5f, 0xd4, 0xb0,
-  0x22, 0x17, 0x0a, 0x65, 0xde, 0xd6, 0x2b, 0xca, 0xf5, 0xbd, 0x47, 0x00,
-  0xec, 0x28, 0x19, 0xd9, 0x4d, 0xb0, 0x01, 0x3b, 0x7f, 0x3f, 0x18, 0x81,
-  0x24, 0xbd, 0x56, 0xa2, 0x46, 0xaa, 0x0e, 0x91, 0xd6, 0x59, 0x09, 0x2d,
-  0xb0, 0xc2, 0x41, 0xdc, 0xd8, 0x49, 0x5c, 0x1e, 0x3e, 0xad, 0xb3, 0x22,
-  0xd3, 0x34, 0x44, 0x5f, 0x3d, 0xed, 0xf6, 0xe7, 0x3f, 0x9e, 0x34, 0x92,
-  0x69, 0x63, 0xe5, 0x3a, 0x44, 0xbf, 0xb4, 0xe0, 0xf2, 0x19, 0x19, 0x48,
-  0x26, 0x1d, 0xa7, 0xce, 0x36, 0xb8, 0xb0, 0xf6, 0x1c, 0xf9, 0x4d, 0x0f,
-  0xcf, 0x20, 0x44, 0xd8, 0x44, 0x58, 0x0e, 0x14, 0x8d, 0x5c, 0x7f, 0xea,
-  0xcd, 0x63, 0x90, 0x3c, 0xf9, 0xb0, 0xee, 0xd1, 0x07, 0xab, 0x46, 0x1a,
-  0x3e, 0x4b, 0x30, 0x5f, 0x1a, 0xf5, 0xeb, 0xca, 0x15, 0xa1, 0x18, 0x20,
-  0x11, 0x3c, 0xdd, 0x19, 0xd5, 0x0f, 0xb5, 0x37, 0x52, 0xae, 0xe6, 0x87,
-  0xc1, 0x7f, 0xee, 0xd1, 0xce, 0x52, 0xbb, 0x1b, 0xc9, 0x1a, 0xeb, 0xeb,
-  0x22, 0x01, 0x45, 0xd0, 0x1f, 0x1e, 0xcd, 0x20, 0xfe, 0xba, 0xbc, 0x38,
-  0xe5, 0x48, 0x47, 0x99, 0xcd, 0x6c, 0x37, 0xd4, 0x28, 0x02, 0xb6, 0xd1,
-  0x13, 0x05, 0xc6, 0x6b, 0x16, 0x03, 0x55, 0xdb, 0xeb, 0x9a, 0x23, 0xf9,
-  0x25, 0x8f, 0x1f, 0x79, 0x92, 0xaa, 0xce, 0xee, 0xe4, 0x7f, 0x16, 0xf1,
-  0xad, 0x38, 0x21, 0xb2, 0x40, 0x4c, 0x49, 0xe7, 0xab, 0xf5, 0x15, 0x04,
-  0x83, 0xfb, 0xf7, 0x1d, 0x91, 0x7f, 0x63, 0x4f, 0x3b, 0xba, 0xee, 0xe5,
-  0x20, 0xd6, 0x34, 0xd7, 0xa6, 0x1c, 0xbe, 0xbb, 0x38, 0xc1, 0xb9, 0xe7,
-  0x46, 0xa8, 0x14, 0x35, 0x11, 0x12, 0xf7, 0xce, 0x4e, 0x58, 0x28, 0x51,
-  0x22, 0x1e, 0x24, 0xdb, 0xb4, 0xd9, 0x49, 0x1c, 0x85, 0xc4, 0xab, 0x3f,
-  0xc3, 0xc6, 0xe3, 0x25, 0x47, 0xf2, 0xf1, 0x1a, 0xdf, 0x13, 0x00, 0x19,
-  0x4a, 0x8f, 0x5a, 0x0b, 0xc4, 0x19, 0x31, 0xa9, 0xd6, 0x1a, 0xfb, 0x0e,
-  0xb3, 0x3f, 0x64, 0xa0, 0xcf, 0x90, 0xed, 0x35, 0x5a, 0x20, 0x95, 0xee,
-  0x08, 0x38, 0x4f, 0x1c, 0xf5, 0xca, 0xef, 0xc1, 0xe5, 0x9c, 0xd4, 0xc3,
-  0xfa, 0xc6, 0x2a, 0xe7, 0x98, 0x4b, 0x11, 0xbd, 0x34, 0xde, 0x5b, 0x06,
-  0x07, 0x3c, 0x61, 0xa6, 0x3b, 0xd1, 0xa8, 0x8c, 0x20, 0xdf, 0x8d, 0x40,
-  0x64, 0xb8, 0xa7, 0x47, 0xe5, 0x81, 0x51, 0x8b, 0x2c, 0x25, 0x58, 0x33,
-  0x59, 0xcf, 0xcf, 0x5e, 0xff, 0x16, 0x21, 0x9e, 0x86, 0x0c, 0x31, 0xfb,
-  0x29, 0x51, 0x2f, 0xb7, 0xca, 0x3a, 0x3a, 0xe1, 0xf6, 0xcd, 0x44, 0x2b,
-  0xfa, 0x48, 0x9d, 0x2f, 0xfd, 0xd3, 0xf7, 0xe0, 0x3c, 0x2b, 0x6d, 0x03,
-  0xc6, 0xd5, 0x3b, 0xd2, 0x7f, 0x1d, 0xf0, 0xc5, 0xf3, 0x69, 0xc1, 0xf9,
-  0x5c, 0x4d, 0xf9, 0x96, 0xe2, 0x9e, 0x4f, 0x99, 0xa7, 0x17, 0x38, 0x6e,
-  0xdd, 0x07, 0x14, 0x99, 0xfd, 0x93, 0x4e, 0x0a, 0x99, 0x3b, 0xaa, 0xa4,
-  0xb7, 0xda, 0xbc, 0x31, 0xbf, 0xdb, 0xfe, 0xc5, 0xc1, 0x5f, 0xa8, 0x9e,
-  0x78, 0xb5, 0x86, 0xad, 0x54, 0x4b, 0xa3, 0x00, 0xec, 0xe5, 0x56, 0x3e,
-  0xbf, 0x35, 0x2b, 0x5b, 0x10, 0x3d, 0x2f, 0xd8, 0xb2, 0x9b, 0x81, 0x06,
-  0xd9, 0x3f, 0x45, 0x40, 0x39, 0x07, 0xc6, 0x4d, 0x3d, 0x2d, 0xcd, 0xd7,
-  0x7f, 0xbc, 0xb4, 0x1a, 0xf1, 0x34, 0xc0, 0x07, 0xfb, 0x47, 0x41, 0x8d,
-  0x1a, 0xc6, 0xf3, 0x68, 0xd3, 0xfd, 0x31, 0xcb, 0x38, 0x28, 0x0c, 0x52,
-  0x81, 0xd4, 0x5b, 0x4e, 0x3e, 0x1b, 0xf8, 0x1e, 0xce, 0xaf, 0xa1, 0x42,
-  0x93, 0xa5, 0xbc, 0x40, 0x28, 0x64, 0xb6, 0xff, 0x06, 0xa2, 0x85, 0xe7,
-  0x59, 0xfd, 0x3a, 0xd7, 0xd4, 0xf6, 0x47, 0xbd, 0xea, 0xb5, 0xdf, 0x2e,
-  0xec, 0xe8, 0xd5, 0x96, 0x91, 0x7e, 0x36, 0x12, 0x00, 0xfe, 0xec, 0x48,
-  0x21, 0x65, 0xa6, 0x72, 0xaf, 0xe0, 0x0c, 0x73, 0x39, 0xa1, 0x2b, 0xc7,
-  0x92, 0xd2, 0xc5, 0xc7, 0x70, 0x20, 0x1d, 0xd6, 0x63, 0x24, 0x18, 0x51,
-  0x6f, 0x5d, 0xe2, 0xe2, 0x57, 0x67, 0x36, 0x60, 0xd8, 0x13, 0x17, 0xe7,
-  0x7f, 0x50, 0x5a, 0x5a, 0x65, 0xbc, 0x4e, 0x06, 0x3b, 0xb6, 0xbc, 0xd7,
-  0x68, 0xc4, 0xeb, 0x4b, 0xb3, 0xf8, 0x36, 0xd2, 0x47, 0x59, 0xff, 0x19,
-  0xca, 0x57, 0x0b, 0x35, 0x17, 0xd7, 0x2e, 0x32, 0x22, 0xcc, 0xd1, 0x8e,
-  0xc5, 0x95, 0xd0, 0x67, 0x6b, 0xde, 0xcb, 0x27, 0x3d, 0xf5, 0x4f, 0x11,
-  0x93, 0xa1, 0xe5, 0x01, 0x9e, 0x1a, 0xb4, 0xbb, 0x2f, 0x28, 0xad, 0x0a,
-  0x14, 0xd8, 0xf2, 0x00, 0xfc, 0xe2, 0x24, 0x23, 0x1a, 0x9d, 0x4a, 0xdf,
-  0xd7, 0xe9, 0x6c, 0x17, 0x75, 0xef, 0xe0, 0xc2, 0xad, 0x45, 0xa4, 0x81,
-  0xf0, 0xca, 0x31, 0x6d, 0x46, 0x31, 0xc2, 0xcf, 0xd7, 0x17, 0xf7, 0xc9,
-  0xe3, 0xe6, 0x54, 0x7f, 0xc9, 0x17, 0x13, 0xe6, 0x53, 0x4b, 0x6a, 0x01,
-  0xc2, 0xaa, 0x4f, 0x03, 0x40, 0xde, 0xb0, 0xf7, 0x2a, 0xf5, 0x64, 0xbd,
-  0xe7, 0x97, 0x7b, 0x21, 0x44, 0x5c, 0xfb, 0xb0, 0x45, 0xcf, 0x48, 0xf3,
-  0x12, 0xdd, 0x27, 0xc5, 0xa4, 0xb6, 0x9b, 0xba, 0xc6, 0xbd, 0x01, 0x76,
-  0x07, 0x2c, 0xf3, 0x96, 0xe3, 0x67, 0x21, 0x24, 0xc9, 0x54, 0xa9, 0xd7,
-  0x14, 0x24, 0xe2, 0x64, 0x5c, 0x3d, 0x4f, 0x7f, 0x16, 0x13, 0x62, 0x1d,
-  0xe7, 0xf1, 0x65, 0xf1, 0x53, 0x46, 0xbf, 0xab, 0xc9, 0x30, 0x1e, 0xd0,
-  0x01, 0x34, 0xc4, 0xf8, 0xc9, 0xa1, 0xe4, 0x05, 0x47, 0xbe, 0x34, 0x1c,
-  0xd8, 0x22, 0xa3, 0xe2, 0x0b, 0x1d, 0x13, 0x48, 0x4b, 0xdb, 0x52, 0x1d,
-  0xbb, 0x32, 0xe0, 0x4a, 0xcd, 0x1f, 0xbb, 0x46, 0x8b, 0xe8, 0xb2, 0x39,
-  0xc3, 0x37, 0x29, 0xcd, 0xa5, 0xd4, 0xb3, 0x94, 0x2c, 0x0d, 0x56, 0x48,
-  0xeb, 0x67, 0x35, 0x58, 0xcc, 0xab, 0xcc, 0xde, 0xe5, 0x57, 0xbe, 0xe7,
-  0x7f, 0xdd, 0x8e, 0xfc, 0x9d, 0x5f, 0x9b, 0xfe, 0x20, 0xdc, 0xe7, 0x5b,
-  0x1c, 0x50, 0x64, 0x52, 0xa6, 0x5b, 0x1e, 0xf0, 0xfb, 0xe5, 0x07, 0x25,
-  0x60, 0x6c, 0xf6, 0xaf, 0x73, 0x6b, 0x65, 0xd3, 0xed, 0x27, 0xc6, 0x5d,
-  0xc3, 0x48, 0x41, 0x7b, 0xc8, 0xae, 0x15, 0x09, 0xad, 0xe1, 0x45, 0x67,
-  0xd0, 0x4d, 0x47, 0xd8, 0xe3, 0xef, 0xe5, 0x1b, 0x96, 0x9b, 0x7f, 0x9b,
-  0x71, 0xc0, 0x4a, 0x24, 0x6a, 0x36, 0x1a, 0x29, 0x1a, 0x42, 0x15, 0x1b,
-  0xa2, 0x66, 0x9a, 0x44, 0xb6, 0x8f, 0x47, 0x04, 0x25, 0xef, 0xb1, 0xc6,
-  0x4e, 0xa4, 0x68, 0x9e, 0x99, 0x6b, 0x2c, 0x31, 0x4e, 0x5d, 0xbc, 0x28,
-  0xf6, 0x26, 0x32, 0x5d, 0x50, 0x4e, 0xd2, 0xee, 0x1e, 0x36, 0x16, 0x4c,
-  0x18, 0x10, 0x63, 0xa0, 0x5e, 0x00, 0xdb, 0x21, 0x37, 0xe4, 0x2d, 0xe4,
-  0xec, 0x0e, 0xe7, 0x1f, 0xc7, 0xfb, 0x08, 0xc2, 0x4d, 0x41, 0x77, 0xd0,
-  0x16, 0xd6, 0x3e, 0xd2, 0xc2, 0x0f, 0x9e, 0x5a, 0xf5, 0xf7, 0xc7, 0x4a,
-  0x0d, 0x9b, 0xca, 0xc5, 0x18, 0x66, 0xe8, 0x10, 0xae, 0x0d, 0x05, 0xe8,
-  0x23, 0xd0, 0xa1, 0x7f, 0xfc, 0x81, 0x4a, 0x5c, 0x37, 0x20, 0xea, 0xed,
-  0x4e, 0xe4, 0x10, 0xf2, 0xd0, 0x2d, 0xdc, 0xc8, 0xa2, 0x56, 0x29, 0xec,
-  0x5b, 0x01, 0xa0, 0x15, 0xca, 0xd7, 0x27, 0xef, 0xf2, 0xb0, 0x35, 0x63,
-  0x34, 0x54, 0x19, 0x60, 0x17, 0x2d, 0x45, 0x27, 0x91, 0x9f, 0xaf, 0xd3,
-  0xe8, 0xcd, 0xd0, 0x81, 0xeb, 0xc1, 0xa7, 0x4c, 0x4a, 0x9c, 0x5a, 0x41,
-  0x38, 0xcb, 0x09, 0xa6, 0x98, 0xfd, 0xe0, 0xbd, 0x64, 0xbc, 0xc5, 0x50,
-  0x33, 0xb7, 0xdb, 0x2f, 0x2b, 0xb3, 0x29, 0xd8, 0x5a, 0xe6, 0x19, 0xf5,
-  0x83, 0xe5, 0xe7, 0x1b, 0x33, 0xc9, 0x3d, 0x3f, 0xa3, 0x10, 0xbf, 0x7f,
-  0xf7, 0x48, 0x6a, 0x17, 0xd3, 0xc0, 0x5e, 0x06, 0x1f, 0xca, 0x36, 0x91,
-  0x47, 0x51, 0xf8, 0x56, 0x48, 0x24, 0xd4, 0xcf, 0x68, 0x0d, 0x1a, 0xbb,
-  0xf6, 0x67, 0xb4, 0x2c, 0x62, 0x13, 0xdc, 0xf2, 0x1e, 0xd6, 0xfc, 0xb1,
-  0x3c, 0x5e, 0xcc, 0xe5, 0xbd, 0x02, 0x24, 0xd8, 0xef, 0x98, 0x31, 0x16,
-  0x52, 0xd4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xb3, 0x04, 0x00, 0x00, 0xe6, 0x1f, 0x00, 0x00, 0x7b, 0x15, 0x00, 0x00,
-  0xca, 0xe8, 0xff, 0xff, 0xf5, 0x01, 0x00, 0x00, 0x92, 0x05, 0x00, 0x00,
-  0xed, 0xfe, 0xff, 0xff, 0xe4, 0x06, 0x00, 0x00, 0x34, 0x07, 0x00, 0x00,
-  0x9d, 0xf5, 0xff, 0xff, 0xb0, 0x07, 0x00, 0x00, 0x95, 0xf8, 0xff, 0xff,
-  0x8b, 0xf9, 0xff, 0xff, 0xf0, 0xf4, 0xff, 0xff, 0x48, 0xf9, 0xff, 0xff,
-  0x8a, 0xe0, 0xff, 0xff, 0x48, 0xe8, 0xff, 0xff, 0x1b, 0x18, 0x00, 0x00,
-  0x53, 0xf9, 0xff, 0xff, 0x10, 0xe1, 0xff, 0xff, 0x09, 0xe8, 0xff, 0xff,
-  0x5e, 0xea, 0xff, 0xff, 0xf6, 0x0d, 0x00, 0x00, 0x1c, 0x09, 0x00, 0x00,
-  0x42, 0x04, 0x00, 0x00, 0x05, 0x0e, 0x00, 0x00, 0x29, 0xeb, 0xff, 0xff,
-  0x99, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0xfd, 0x03, 0x00, 0x00,
-  0x9d, 0xe5, 0xff, 0xff, 0xd3, 0x04, 0x00, 0x00, 0xc8, 0x06, 0x00, 0x00,
-  0xd8, 0xf4, 0xff, 0xff, 0x3d, 0x09, 0x00, 0x00, 0xa9, 0x0c, 0x00, 0x00,
-  0xb7, 0xff, 0xff, 0xff, 0xb4, 0xfb, 0xff, 0xff, 0x14, 0xf6, 0xff, 0xff,
-  0x5a, 0xf8, 0xff, 0xff, 0xe2, 0xf4, 0xff, 0xff, 0x72, 0x01, 0x00, 0x00,
-  0xd0, 0xe8, 0xff, 0xff, 0x3c, 0xd8, 0xff, 0xff, 0x9f, 0x0a, 0x00, 0x00,
-  0x90, 0x0c, 0x00, 0x00, 0x6e, 0xee, 0xff, 0xff, 0x1f, 0xf7, 0xff, 0xff,
-  0x7f, 0xf9, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00,
-  0x6a, 0x0d, 0x00, 0x00, 0x74, 0xfa, 0xff, 0xff, 0xb5, 0x0e, 0x00, 0x00,
-  0x74, 0x0a, 0x00, 0x00, 0x58, 0xe2, 0xff, 0xff, 0x93, 0x09, 0x00, 0x00,
-  0x65, 0x01, 0x00, 0x00, 0xa0, 0xf2, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff,
-  0xc8, 0xed, 0xff, 0xff, 0xca, 0xfc, 0xff, 0xff, 0xa2, 0x0e, 0x00, 0x00,
-  0x6e, 0xf5, 0xff, 0xff, 0x5e, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0x5b, 0x99, 0x20, 0x7f, 0x30, 0xe1, 0x4c, 0xd4,
-  0xad, 0x21, 0x53, 0x4a, 0xfb, 0x4a, 0xf7, 0xe1, 0x08, 0x20, 0x81, 0x9c,
-  0xc6, 0x6c, 0x81, 0x40, 0x07, 0x58, 0x79, 0xd3, 0xd3, 0x12, 0x0b, 0x3d,
-  0x14, 0x4e, 0xd2, 0x52, 0x70, 0x89, 0x7f, 0xdf, 0xf6, 0x67, 0x2b, 0x7f,
-  0x2a, 0xe4, 0x51, 0xb0, 0x0d, 0xac, 0x3f, 0x4c, 0x0a, 0x81, 0xfa, 0x76,
-  0x81, 0x56, 0xca, 0x9e, 0x81, 0x9c, 0xc2, 0xf0, 0x7f, 0x00, 0x0e, 0x6d,
-  0xba, 0x14, 0x00, 0xba, 0xf1, 0x51, 0x0e, 0xb8, 0xc0, 0x16, 0x42, 0x81,
-  0x81, 0xf2, 0xcf, 0x87, 0x7c, 0x6c, 0xbb, 0x38, 0x7f, 0x47, 0x7f, 0x40,
-  0x15, 0x3e, 0x07, 0x58, 0x55, 0xae, 0x1a, 0x13, 0x57, 0xad, 0x0a, 0x6b,
-  0x00, 0x49, 0x12, 0x6a, 0xc1, 0x81, 0x66, 0x48, 0xed, 0xfa, 0x66, 0x26,
-  0x81, 0xcf, 0xcb, 0x7f, 0xa2, 0x7f, 0x81, 0xa0, 0xd2, 0x17, 0xd2, 0x81,
-  0x19, 0xec, 0x08, 0x19, 0x12, 0x9f, 0x60, 0xb2, 0x60, 0xd3, 0xc4, 0xe5,
-  0x81, 0x81, 0x31, 0x51, 0x03, 0x81, 0xcc, 0xc0, 0x7c, 0xfa, 0x99, 0x96,
-  0x6b, 0x7b, 0x48, 0x7f, 0x81, 0x81, 0x2d, 0xef, 0xff, 0xbd, 0xc7, 0x7f,
-  0x7f, 0x54, 0x6d, 0x20, 0x39, 0xdf, 0x7e, 0xd4, 0xb0, 0xfb, 0x81, 0xc2,
-  0x39, 0xea, 0x7f, 0x92, 0xab, 0xdc, 0xed, 0xd9, 0x88, 0x73, 0x12, 0x78,
-  0x51, 0xaf, 0x7f, 0xc3, 0x06, 0x17, 0x7f, 0xf5, 0xe4, 0xf5, 0x11, 0xdd,
-  0x72, 0x66, 0x5a, 0x81, 0x3c, 0xbc, 0xef, 0x0c, 0xf6, 0x71, 0xcc, 0x74,
-  0x7d, 0x7f, 0xa9, 0xec, 0x02, 0x7f, 0xc8, 0x2c, 0xc0, 0xfa, 0xfb, 0x81,
-  0xc1, 0x7f, 0x17, 0x2b, 0xf1, 0x87, 0xad, 0xef, 0xef, 0x00, 0xd2, 0xed,
-  0xfb, 0xd1, 0x0e, 0xd2, 0x81, 0x2e, 0x2a, 0x3d, 0xa1, 0xea, 0x17, 0x3c,
-  0x61, 0x44, 0xe9, 0x12, 0xf5, 0x1e, 0xc2, 0x09, 0xf2, 0x48, 0x70, 0x34,
-  0xd5, 0xed, 0x32, 0xab, 0x87, 0x23, 0x54, 0x9f, 0x47, 0xfd, 0x7f, 0xf7,
-  0xd0, 0x62, 0xf1, 0x54, 0x0d, 0xd3, 0xb3, 0x43, 0x55, 0x48, 0x19, 0x5d,
-  0xb4, 0xe8, 0x81, 0xc6, 0xe9, 0x73, 0xca, 0xc6, 0x12, 0xff, 0x5d, 0x83,
-  0x7f, 0x81, 0x5e, 0x20, 0x81, 0xb6, 0xe9, 0x29, 0x41, 0x36, 0xc7, 0x4d,
-  0x27, 0xd7, 0xd9, 0x74, 0xc9, 0x14, 0x86, 0x6f, 0xf4, 0x81, 0xe1, 0xef,
-  0x0d, 0x49, 0x99, 0x38, 0x81, 0xfd, 0x18, 0xe8, 0xf9, 0x7f, 0xbc, 0xad,
-  0x45, 0x9a, 0x18, 0x8b, 0xc4, 0x9d, 0x0d, 0x43, 0x10, 0xea, 0xe8, 0xe6,
-  0x42, 0x58, 0xac, 0x1d, 0xcd, 0x98, 0xde, 0x18, 0xf7, 0x58, 0xf7, 0xf3,
-  0x52, 0x49, 0x1f, 0xbb, 0x7e, 0x3a, 0xcc, 0x06, 0x07, 0x3d, 0xc3, 0x81,
-  0x0e, 0x48, 0xd6, 0x81, 0x99, 0xe9, 0xa0, 0x40, 0x3f, 0xfc, 0x15, 0x63,
-  0xcf, 0x9b, 0x4a, 0xe1, 0x3a, 0x33, 0x6c, 0x2e, 0x20, 0x81, 0x0d, 0x9a,
-  0x7c, 0xfd, 0x36, 0x21, 0x01, 0xca, 0x1d, 0xca, 0x8d, 0x02, 0xe9, 0x7f,
-  0xff, 0x89, 0xe4, 0x2a, 0x18, 0x58, 0xcd, 0x2a, 0xe3, 0x5f, 0xf0, 0xa9,
-  0xe3, 0x9f, 0x8e, 0x06, 0x3d, 0x5f, 0x9c, 0x7f, 0xc0, 0x15, 0x2f, 0xca,
-  0x11, 0xfe, 0x0c, 0x87, 0x34, 0x25, 0xb3, 0xda, 0xcf, 0xf1, 0x12, 0x32,
-  0xe2, 0x34, 0x9b, 0xed, 0xa0, 0x44, 0xb8, 0xce, 0x00, 0x46, 0x55, 0xbb,
-  0x40, 0x36, 0xb5, 0x5f, 0x81, 0xaf, 0x7f, 0x32, 0x82, 0xdc, 0xbe, 0xd6,
-  0x40, 0x85, 0xdc, 0xf1, 0x81, 0x2f, 0x19, 0x4f, 0x1c, 0x39, 0x24, 0x07,
-  0x0e, 0x69, 0xa5, 0x45, 0x7f, 0xda, 0xb8, 0xb4, 0x4b, 0x81, 0xcb, 0x04,
-  0xd4, 0xb0, 0x81, 0x4c, 0x09, 0x8a, 0x3a, 0xcd, 0xf9, 0x7f, 0xbe, 0xf8,
-  0xa6, 0x3a, 0xd6, 0x05, 0x16, 0x2c, 0xe0, 0x7f, 0x1a, 0x02, 0x07, 0xb2,
-  0xd5, 0x7f, 0xe4, 0xab, 0xe4, 0x9b, 0x81, 0x81, 0x0c, 0xe6, 0x43, 0x1a,
-  0x59, 0x38, 0x14, 0x45, 0xdb, 0x58, 0xd1, 0xee, 0x9c, 0x41, 0xb8, 0x81,
-  0xc7, 0xa5, 0x89, 0x2b, 0x00, 0xd7, 0xe9, 0xd5, 0xe7, 0x14, 0x81, 0xc5,
-  0x22, 0x67, 0xc2, 0x5a, 0xa2, 0x3d, 0xf8, 0x16, 0x52, 0x1c, 0xcf, 0xec,
-  0x40, 0xdd, 0xc0, 0x0b, 0x2d, 0xcc, 0x81, 0xee, 0xc8, 0x17, 0x76, 0x4c,
-  0xf9, 0xb3, 0x2d, 0xfa, 0xaa, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0xf4, 0xf8, 0xff, 0xff, 0x23, 0xf7, 0xff, 0xff,
-  0xb1, 0xf5, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0x79, 0x02, 0x00, 0x00,
-  0x55, 0x08, 0x00, 0x00, 0x8f, 0xfe, 0xff, 0xff, 0x28, 0x0e, 0x00, 0x00,
-  0x76, 0xff, 0xff, 0xff, 0x35, 0xfa, 0xff, 0xff, 0xe3, 0xf5, 0xff, 0xff,
-  0x3a, 0x05, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00,
-  0x28, 0xfb, 0xff, 0xff, 0x28, 0x05, 0x00, 0x00, 0xe1, 0x08, 0x00, 0x00,
-  0x6d, 0xff, 0xff, 0xff, 0xc6, 0x0c, 0x00, 0x00, 0x5e, 0xfd, 0xff, 0xff,
-  0x48, 0xfc, 0xff, 0xff, 0xb2, 0xf9, 0xff, 0xff, 0xfc, 0x0e, 0x00, 0x00,
-  0xbd, 0xfe, 0xff, 0xff, 0xc1, 0xf6, 0xff, 0xff, 0x38, 0xf2, 0xff, 0xff,
-  0xb8, 0xfd, 0xff, 0xff, 0xe2, 0xf6, 0xff, 0xff, 0xbd, 0x0a, 0x00, 0x00,
-  0xdc, 0xff, 0xff, 0xff, 0x64, 0x06, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x00,
-  0xac, 0xfd, 0xff, 0xff, 0xdd, 0xfb, 0xff, 0xff, 0x8e, 0x0a, 0x00, 0x00,
-  0x46, 0xfe, 0xff, 0xff, 0xef, 0xf1, 0xff, 0xff, 0x48, 0x01, 0x00, 0x00,
-  0xae, 0xfe, 0xff, 0xff, 0x4f, 0xfd, 0xff, 0xff, 0xbd, 0xfd, 0xff, 0xff,
-  0xbe, 0xfe, 0xff, 0xff, 0xf3, 0xfd, 0xff, 0xff, 0x55, 0xf9, 0xff, 0xff,
-  0x96, 0x02, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x3e, 0x0a, 0x00, 0x00, 0xc7, 0xfc, 0xff, 0xff, 0x41, 0xfa, 0xff, 0xff,
-  0x93, 0xff, 0xff, 0xff, 0xa2, 0xff, 0xff, 0xff, 0x0e, 0x0d, 0x00, 0x00,
-  0x38, 0x07, 0x00, 0x00, 0xd4, 0x0a, 0x00, 0x00, 0xc2, 0xf4, 0xff, 0xff,
-  0x8f, 0x08, 0x00, 0x00, 0xfa, 0xf1, 0xff, 0xff, 0xfd, 0x07, 0x00, 0x00,
-  0xed, 0xf6, 0xff, 0xff, 0x1d, 0x05, 0x00, 0x00, 0x47, 0x09, 0x00, 0x00,
-  0xdb, 0xff, 0xff, 0xff, 0xa3, 0x0b, 0x00, 0x00, 0xb6, 0xd8, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xad, 0xf8, 0xf1,
-  0x1b, 0xcf, 0x0e, 0x21, 0xcf, 0x3b, 0xeb, 0xe6, 0xc1, 0x9a, 0x6e, 0x47,
-  0x4f, 0x61, 0x1a, 0xb3, 0xe1, 0x44, 0x03, 0x05, 0xf2, 0x3a, 0x15, 0xba,
-  0xa3, 0xd7, 0x00, 0xcd, 0x97, 0xb2, 0x4d, 0x48, 0xd2, 0x3b, 0x3c, 0x11,
-  0x4c, 0x6b, 0xd9, 0x7e, 0x7f, 0x79, 0x9d, 0xd4, 0x53, 0x49, 0xe2, 0x85,
-  0x15, 0xae, 0x03, 0xf6, 0x3b, 0x24, 0x38, 0xf1, 0x4e, 0x8c, 0x04, 0x33,
-  0xd4, 0xe0, 0x9d, 0x5d, 0x00, 0x4d, 0xcd, 0x3a, 0xf9, 0xf5, 0x60, 0x1b,
-  0x07, 0x3c, 0xc8, 0x48, 0x5e, 0x50, 0x7f, 0xea, 0xbe, 0x78, 0xaf, 0x26,
-  0x95, 0x94, 0x09, 0xc4, 0x3e, 0xa9, 0xeb, 0x18, 0xcf, 0x53, 0x59, 0x3c,
-  0xbb, 0xbc, 0x0c, 0x96, 0xa9, 0x90, 0xc8, 0x37, 0x34, 0xf9, 0x31, 0xbf,
-  0xcd, 0x66, 0xef, 0x12, 0x9f, 0xe8, 0x2d, 0xc8, 0xf9, 0xb3, 0x6e, 0x22,
-  0xf3, 0x33, 0x5c, 0x72, 0xb9, 0xf4, 0xda, 0xb2, 0x1d, 0xfb, 0xcb, 0x35,
-  0xfe, 0x66, 0xbf, 0xbf, 0x3d, 0x37, 0x1b, 0xcf, 0x6c, 0xdf, 0x43, 0x56,
-  0x06, 0x66, 0xb6, 0xce, 0xcb, 0x34, 0xc3, 0x3d, 0x1e, 0xf5, 0x54, 0x33,
-  0xcc, 0x1f, 0xc4, 0x46, 0x24, 0x35, 0xfe, 0x13, 0x2e, 0x56, 0x0e, 0xe2,
-  0xa2, 0x9b, 0xb2, 0xd7, 0x9d, 0xea, 0x5b, 0x1c, 0x75, 0xb5, 0x81, 0xda,
-  0x56, 0x48, 0xc8, 0xf1, 0x30, 0xee, 0x5b, 0x2e, 0x56, 0xbc, 0x02, 0xe7,
-  0xe0, 0x57, 0x55, 0x7f, 0x14, 0x64, 0x1e, 0x5a, 0xab, 0xed, 0x6b, 0xe5,
-  0x2a, 0x49, 0xa8, 0x92, 0x98, 0xd1, 0x0b, 0xad, 0xca, 0xa1, 0xdd, 0x63,
-  0x5d, 0x30, 0x11, 0xed, 0x68, 0x6c, 0x01, 0x90, 0x6c, 0x0f, 0x88, 0x9d,
-  0x1b, 0x49, 0x11, 0x6d, 0x0f, 0x00, 0x13, 0x60, 0xf0, 0x74, 0x17, 0x8a,
-  0x7a, 0x8d, 0xec, 0x47, 0x4d, 0xfb, 0x13, 0x2d, 0x76, 0xfd, 0x00, 0xc7,
-  0xf5, 0xbe, 0x4c, 0xab, 0xd4, 0x3a, 0x95, 0x75, 0xf6, 0xe5, 0x4c, 0xca,
-  0x0d, 0xed, 0x16, 0xb7, 0x14, 0xfa, 0xf8, 0xeb, 0x4d, 0xbd, 0x2b, 0xcc,
-  0xec, 0x74, 0x68, 0xf4, 0xca, 0xb7, 0x61, 0x4f, 0x9c, 0xb2, 0xd8, 0xeb,
-  0x12, 0x44, 0x0b, 0x24, 0x0f, 0x9e, 0xfd, 0xc4, 0xbc, 0x5f, 0xfe, 0x1d,
-  0x4d, 0xef, 0xe3, 0xd9, 0x0a, 0xc2, 0x2f, 0xc5, 0x81, 0xab, 0xaa, 0x45,
-  0xf0, 0x4a, 0xde, 0x35, 0x23, 0xb2, 0x62, 0xc2, 0xb5, 0xd7, 0xb4, 0x06,
-  0xcc, 0x63, 0x04, 0x21, 0xf7, 0xc2, 0x3a, 0xfe, 0x1c, 0x36, 0xd5, 0xde,
-  0x02, 0x03, 0x26, 0x07, 0x45, 0x06, 0xdf, 0x3d, 0x81, 0x3c, 0x56, 0x63,
-  0x1b, 0x21, 0x02, 0x49, 0xcd, 0xcd, 0xc5, 0x25, 0xce, 0xeb, 0x2a, 0x56,
-  0xcc, 0xc7, 0xdb, 0xbe, 0x02, 0x48, 0x69, 0x04, 0x01, 0x57, 0x2d, 0xe5,
-  0x10, 0x81, 0xf6, 0xb8, 0xee, 0x88, 0xd8, 0x56, 0xb1, 0x5b, 0xb3, 0xcb,
-  0x5f, 0x02, 0x12, 0xf2, 0x51, 0x41, 0x46, 0x81, 0x1b, 0x01, 0xee, 0xc1,
-  0x64, 0x28, 0x5b, 0x34, 0x76, 0x47, 0x48, 0xb6, 0x6f, 0xc1, 0xd6, 0xc7,
-  0x31, 0xe2, 0x42, 0xa4, 0xaf, 0x38, 0xb2, 0x0c, 0x07, 0x05, 0x10, 0xb7,
-  0x4f, 0x4f, 0xbb, 0xe5, 0x68, 0xc4, 0x36, 0x04, 0x48, 0x34, 0x1a, 0x94,
-  0x01, 0xc8, 0x05, 0xfd, 0x79, 0xf2, 0x7b, 0x1a, 0x4f, 0xf8, 0xe5, 0x31,
-  0x2d, 0x3b, 0xda, 0xb0, 0xa9, 0xd5, 0xf7, 0x31, 0xd1, 0x10, 0x5f, 0x68,
-  0x33, 0xc2, 0x81, 0x07, 0x34, 0xa5, 0x56, 0x98, 0xb8, 0xa5, 0x21, 0x25,
-  0x91, 0x73, 0x4d, 0x7f, 0xee, 0xce, 0xbb, 0xf5, 0xb1, 0xe9, 0x42, 0x1a,
-  0x15, 0xd8, 0x06, 0x0d, 0xb5, 0xe0, 0xf7, 0xe8, 0x3c, 0xb6, 0xf7, 0x03,
-  0x40, 0x27, 0xe5, 0xd4, 0xbc, 0x41, 0xa8, 0x4f, 0x2b, 0xd5, 0xec, 0x8f,
-  0x05, 0x0d, 0x51, 0x3d, 0x12, 0xf3, 0x54, 0xd7, 0x63, 0xca, 0xfb, 0x2f,
-  0xd6, 0xaa, 0xab, 0x48, 0xd8, 0x02, 0x00, 0x07, 0xda, 0x59, 0x21, 0x65,
-  0x22, 0xb1, 0x1c, 0x94, 0x12, 0xbc, 0xdb, 0xc8, 0x89, 0x26, 0xd8, 0x0e,
-  0xaf, 0xbb, 0xf6, 0xba, 0xaf, 0xe0, 0x1d, 0x12, 0xb4, 0xa3, 0xd2, 0xd1,
-  0xc0, 0xae, 0xc8, 0xf4, 0x91, 0xd9, 0x29, 0xb9, 0xdc, 0xd0, 0xc1, 0x91,
-  0x97, 0x9a, 0xf8, 0x15, 0xde, 0x81, 0x2c, 0x33, 0x1d, 0x21, 0x45, 0xfc,
-  0x19, 0x08, 0x25, 0x2a, 0x2d, 0x13, 0x12, 0x34, 0x0f, 0x15, 0x3f, 0xf8,
-  0xdd, 0xcc, 0x1a, 0xc0, 0xe1, 0x2c, 0x5e, 0x81, 0x23, 0x24, 0xd2, 0x9c,
-  0x3d, 0x36, 0x31, 0xa7, 0xc8, 0x1f, 0x10, 0xa7, 0xa7, 0xfe, 0x47, 0xaf,
-  0xe4, 0x28, 0xf6, 0x28, 0x04, 0x2b, 0xec, 0x0e, 0x01, 0x3b, 0x79, 0x95,
-  0xf0, 0x51, 0xb7, 0xb8, 0xaa, 0x15, 0xf1, 0xf1, 0x20, 0x25, 0x29, 0x31,
-  0x85, 0xd0, 0xbc, 0xec, 0xb4, 0xfb, 0xae, 0x2d, 0xff, 0x0e, 0x1e, 0x5d,
-  0x2b, 0x04, 0x17, 0x00, 0xaf, 0xf5, 0x52, 0xcf, 0xb1, 0xe8, 0xfc, 0x1d,
-  0xc6, 0x4d, 0xe4, 0xdd, 0x63, 0xc8, 0x21, 0x5f, 0x1c, 0xf5, 0x7f, 0xdb,
-  0xdf, 0xdc, 0x14, 0xda, 0x24, 0x4f, 0xbb, 0x49, 0x48, 0x00, 0x06, 0x1e,
-  0xae, 0x68, 0xbe, 0x34, 0x06, 0xdb, 0xf5, 0x2e, 0xac, 0x95, 0xdc, 0x49,
-  0x34, 0x44, 0x3f, 0x98, 0xda, 0xc7, 0xa6, 0x26, 0xa6, 0x3d, 0x18, 0x12,
-  0x1f, 0x73, 0x8f, 0x7f, 0x12, 0x4f, 0x2a, 0xe6, 0x2a, 0x4d, 0x1a, 0xa1,
-  0xb3, 0x4c, 0x52, 0x56, 0x29, 0xb4, 0xc5, 0x31, 0xa5, 0x11, 0x39, 0xc6,
-  0x02, 0x7d, 0xd3, 0xd3, 0xdc, 0x2a, 0x7b, 0x39, 0x28, 0xc1, 0x3a, 0xea,
-  0xce, 0x56, 0x5a, 0xe4, 0x5e, 0xff, 0x3b, 0x52, 0x39, 0x49, 0x49, 0x20,
-  0xb9, 0xa6, 0xbc, 0xbc, 0xe5, 0xfa, 0xae, 0x1d, 0x11, 0x37, 0xa0, 0x95,
-  0xab, 0x13, 0x42, 0x63, 0xf3, 0x48, 0xa3, 0x77, 0x2e, 0x11, 0xbd, 0x62,
-  0xe9, 0x97, 0x7b, 0x63, 0xd8, 0x2b, 0xaa, 0xa3, 0xcb, 0x99, 0x29, 0xa2,
-  0x21, 0x41, 0xd5, 0x1c, 0xc7, 0x3b, 0x21, 0xa2, 0x32, 0x3f, 0x71, 0x7f,
-  0xc4, 0x31, 0x9d, 0xbb, 0xc5, 0x14, 0x4b, 0x46, 0x27, 0x58, 0xb2, 0x05,
-  0xd0, 0xc2, 0xea, 0xf2, 0x42, 0xb3, 0x0c, 0xff, 0x8b, 0xa4, 0x37, 0xc5,
-  0x8a, 0x8d, 0xd9, 0xbe, 0x5b, 0xca, 0xdc, 0x58, 0xad, 0x36, 0x2c, 0x29,
-  0xe6, 0x15, 0xbd, 0x14, 0x0d, 0xd8, 0xf3, 0xbf, 0x48, 0xed, 0x60, 0xe4,
-  0x5b, 0xdf, 0x76, 0xcf, 0xa8, 0xcf, 0xe7, 0xfd, 0xeb, 0x5d, 0x6a, 0x3a,
-  0xf2, 0xe0, 0x5d, 0xf9, 0xa8, 0x62, 0x41, 0x26, 0x1f, 0xde, 0x8a, 0x2f,
-  0xb6, 0xe4, 0xe5, 0x81, 0x8d, 0x52, 0xba, 0x94, 0x47, 0xa7, 0x1f, 0x78,
-  0x60, 0x4e, 0xf5, 0x39, 0x99, 0xf1, 0x10, 0x27, 0x14, 0x55, 0xaf, 0xcd,
-  0x5f, 0xb3, 0x4f, 0xd0, 0x06, 0xcf, 0xf9, 0xa6, 0x9e, 0xf1, 0xe7, 0x49,
-  0xa5, 0xbe, 0x39, 0x0c, 0x7f, 0xd3, 0x1d, 0xc1, 0xe2, 0xd2, 0xba, 0x15,
-  0xc7, 0x36, 0xc8, 0x3e, 0xd9, 0xd4, 0xd6, 0xfc, 0xe6, 0x45, 0x34, 0xf3,
-  0x39, 0x57, 0x26, 0x4b, 0x3f, 0x38, 0x64, 0xe3, 0x88, 0xf3, 0x60, 0xbc,
-  0x61, 0x41, 0xf3, 0x67, 0xf7, 0xd6, 0xa6, 0xd7, 0x4e, 0xe4, 0x04, 0xcc,
-  0xe9, 0xd8, 0xc5, 0xc3, 0x42, 0xfe, 0x43, 0x2d, 0xdc, 0xfb, 0x12, 0xc7,
-  0x35, 0x0d, 0x46, 0xec, 0x1f, 0x67, 0x33, 0x5a, 0x1e, 0xd2, 0x47, 0x56,
-  0x56, 0xfa, 0xd6, 0x58, 0x9b, 0x95, 0xa1, 0xe9, 0x3d, 0x09, 0xea, 0x93,
-  0x98, 0xa6, 0x51, 0xd2, 0x4e, 0x9e, 0xb1, 0xeb, 0xea, 0xdb, 0xfc, 0xf9,
-  0xab, 0x3a, 0x5c, 0x85, 0x81, 0x98, 0xfd, 0xc5, 0x21, 0xd8, 0x0d, 0x17,
-  0x57, 0x03, 0xe4, 0xbb, 0xea, 0x11, 0x57, 0xf9, 0x9a, 0x7a, 0xcc, 0x2d,
-  0xc2, 0xbc, 0x52, 0xf9, 0xf0, 0x4d, 0xfb, 0x3f, 0x3d, 0xc5, 0xc5, 0x28,
-  0x2d, 0x18, 0xec, 0x06, 0x3c, 0x2b, 0x4c, 0xe7, 0x13, 0x2a, 0x43, 0xce,
-  0x05, 0x3b, 0x81, 0xd7, 0x58, 0x49, 0xc8, 0x44, 0xbe, 0xbe, 0x30, 0x6e,
-  0x3a, 0x63, 0x39, 0xfc, 0x1d, 0x34, 0x50, 0x39, 0x6b, 0xeb, 0x48, 0xc4,
-  0xcf, 0xa8, 0xef, 0x3c, 0xfd, 0x15, 0xdd, 0x17, 0xee, 0x0d, 0xcf, 0x19,
-  0xcd, 0x18, 0x0b, 0xd4, 0xe2, 0x28, 0xb7, 0xfd, 0x20, 0xf0, 0x4b, 0xf4,
-  0x17, 0xfe, 0xd5, 0x03, 0xd5, 0xff, 0x09, 0xfd, 0xe5, 0x0a, 0xa4, 0x0a,
-  0x48, 0xe3, 0xef, 0xf0, 0x05, 0xff, 0xf6, 0xe0, 0x4a, 0xdb, 0x09, 0xfd,
-  0x35, 0x16, 0xe5, 0xed, 0xc9, 0x0a, 0x01, 0x24, 0x81, 0xf7, 0x4d, 0xae,
-  0xbd, 0x9b, 0x2d, 0xe2, 0xcb, 0x48, 0xf6, 0xdd, 0xd1, 0x5b, 0x85, 0x47,
-  0x08, 0x4b, 0xb9, 0x32, 0x34, 0x50, 0xa5, 0xab, 0x32, 0x30, 0x2c, 0xe7,
-  0xe5, 0xe8, 0x75, 0x1c, 0xc8, 0xc3, 0xd4, 0xce, 0x2f, 0xee, 0xad, 0x35,
-  0x2b, 0x03, 0x3c, 0x3f, 0xf3, 0x92, 0x1f, 0xc6, 0x29, 0xd2, 0x1f, 0x77,
-  0x41, 0xe8, 0x1c, 0x83, 0x3e, 0xd9, 0x36, 0xdf, 0x6c, 0x2f, 0x11, 0x73,
-  0xd4, 0xc5, 0x05, 0x81, 0xab, 0x66, 0x2c, 0xdf, 0x3a, 0xcf, 0x0d, 0x1e,
-  0x57, 0x1f, 0xff, 0xb2, 0xe0, 0x7b, 0xc4, 0xbf, 0x42, 0x87, 0xfe, 0x42,
-  0xdc, 0x1f, 0x06, 0xab, 0x3e, 0x63, 0x46, 0x60, 0x3d, 0xfb, 0xc2, 0x3f,
-  0xb9, 0xb7, 0xac, 0x59, 0x9d, 0xa8, 0x5c, 0xd5, 0xef, 0x57, 0x07, 0x94,
-  0x27, 0x29, 0x0e, 0x1d, 0xa8, 0x22, 0x7f, 0x03, 0x4c, 0x6c, 0x04, 0x08,
-  0xf0, 0x8b, 0x4e, 0xf5, 0x07, 0x1f, 0xe4, 0x2d, 0x05, 0x6a, 0xce, 0xc3,
-  0x45, 0xc6, 0x36, 0x62, 0xc7, 0x61, 0xbb, 0xb2, 0xc6, 0xfc, 0x79, 0x10,
-  0xd2, 0x71, 0xb3, 0x0c, 0xdb, 0x6a, 0xff, 0xb1, 0x27, 0xb6, 0xf7, 0x45,
-  0xb4, 0x1e, 0xb9, 0xdc, 0xab, 0x2d, 0xe3, 0x9f, 0xb5, 0xf9, 0x1e, 0x9e,
-  0x78, 0xe9, 0x15, 0xfc, 0x45, 0x9d, 0xf9, 0xde, 0x4e, 0xaf, 0x66, 0x74,
-  0x05, 0xca, 0x33, 0x34, 0xed, 0x4f, 0x0d, 0xc4, 0xae, 0x3d, 0x99, 0x5e,
-  0xbf, 0xb4, 0xb9, 0x28, 0x45, 0x7f, 0x15, 0x1c, 0x0e, 0x6c, 0xb6, 0x08,
-  0x0e, 0xd9, 0xf2, 0x45, 0xe5, 0xed, 0x63, 0x02, 0xa8, 0xa0, 0x92, 0x05,
-  0x15, 0xf9, 0xef, 0x44, 0x1e, 0x3c, 0xe5, 0xe5, 0x12, 0xd8, 0x11, 0x7d,
-  0x4e, 0x9b, 0xe6, 0x10, 0xef, 0xc7, 0x08, 0x59, 0x7f, 0xd4, 0xfc, 0x4a,
-  0xb1, 0xec, 0xb5, 0x58, 0xfe, 0x5a, 0x26, 0x07, 0xb1, 0xaa, 0xf0, 0x42,
-  0xe4, 0x40, 0x0e, 0xeb, 0x3d, 0x2f, 0x23, 0xcb, 0xe1, 0xfe, 0x3e, 0x4e,
-  0xc6, 0xef, 0x37, 0x4f, 0xdd, 0x53, 0x98, 0xdd, 0x91, 0xa5, 0x4d, 0x1f,
-  0xf9, 0x61, 0xc5, 0xc6, 0x1e, 0x19, 0xc0, 0x41, 0xc4, 0xaa, 0x1d, 0x87,
-  0xdc, 0xbf, 0x17, 0xec, 0xd8, 0x0a, 0xf3, 0xd5, 0xe8, 0x2d, 0xf9, 0xe0,
-  0x32, 0x9c, 0xb0, 0xf8, 0xfd, 0xe8, 0xb6, 0xfc, 0x17, 0xd4, 0xb8, 0xfb,
-  0x2e, 0xd4, 0x44, 0x81, 0xce, 0xe1, 0xc2, 0x4a, 0x20, 0xbf, 0x1c, 0x16,
-  0x43, 0xad, 0xc5, 0x27, 0xcf, 0x73, 0x2a, 0xef, 0x4a, 0x15, 0xc1, 0x25,
-  0x40, 0x92, 0x2b, 0xec, 0x33, 0xad, 0xc6, 0x18, 0x96, 0x37, 0x75, 0xde,
-  0x00, 0x7f, 0xe9, 0x7a, 0x94, 0x30, 0x22, 0x34, 0x23, 0xeb, 0xc4, 0xfb,
-  0x11, 0xf6, 0x09, 0x11, 0xa4, 0x52, 0xa2, 0xd4, 0xde, 0x3d, 0xf3, 0x99,
-  0x11, 0xf8, 0xc4, 0x55, 0xd2, 0x4a, 0x9a, 0x35, 0x2b, 0x86, 0x43, 0xa5,
-  0xf2, 0x10, 0x2c, 0x00, 0x15, 0x6a, 0x4e, 0xbe, 0xfd, 0xf2, 0x11, 0x81,
-  0xab, 0x10, 0x31, 0x28, 0x46, 0x34, 0xdc, 0xe2, 0xd9, 0xfa, 0xde, 0xf7,
-  0xd5, 0xe2, 0x70, 0xf9, 0xbd, 0x6c, 0x4a, 0xc7, 0xb3, 0x1b, 0x96, 0x21,
-  0x0e, 0xc6, 0x00, 0xb7, 0xc9, 0xdd, 0x1a, 0xd8, 0x99, 0xd5, 0x45, 0x61,
-  0x07, 0x8b, 0xdf, 0xc4, 0xc3, 0x2a, 0x43, 0x52, 0x50, 0xda, 0x20, 0xb2,
-  0xa6, 0xa2, 0x39, 0x1f, 0x26, 0x3b, 0x33, 0x14, 0xf3, 0x38, 0xd4, 0x22,
-  0xd6, 0x34, 0x1f, 0x5e, 0xe1, 0x4e, 0xdd, 0xfb, 0xe5, 0x0a, 0xec, 0xbf,
-  0xf2, 0xfe, 0xd8, 0xb4, 0xf5, 0x10, 0x81, 0x4f, 0x51, 0xf6, 0x32, 0xfe,
-  0x8d, 0xc8, 0x0c, 0x9a, 0xd6, 0x1e, 0x54, 0x0e, 0x5b, 0xc5, 0x16, 0x15,
-  0xec, 0xd0, 0x5a, 0xdf, 0xaa, 0xf9, 0xe9, 0x5b, 0xef, 0x08, 0xfe, 0x2f,
-  0x2c, 0x48, 0xf6, 0x08, 0x12, 0x62, 0xae, 0xe6, 0xa7, 0xce, 0x0b, 0xd0,
-  0xab, 0xd7, 0x03, 0xab, 0xc2, 0x43, 0x92, 0x06, 0x62, 0x7f, 0x27, 0xeb,
-  0x5a, 0xd4, 0x27, 0xf0, 0xd7, 0xf9, 0xe6, 0xf6, 0xc5, 0x25, 0xf7, 0xcd,
-  0x2d, 0xb2, 0x28, 0x34, 0xd4, 0xfd, 0xf0, 0xeb, 0xb2, 0x17, 0x62, 0xd9,
-  0x10, 0x4d, 0xe4, 0x20, 0xf2, 0x4d, 0x27, 0xf0, 0x6d, 0x30, 0x1e, 0xc2,
-  0xe7, 0xb8, 0xb7, 0xc9, 0xca, 0xa8, 0x3e, 0x40, 0xdf, 0xe3, 0xfe, 0x0a,
-  0x54, 0xa3, 0xb5, 0xf0, 0xc8, 0xb0, 0x00, 0xb1, 0x11, 0xaf, 0xac, 0xaf,
-  0x15, 0x16, 0x5d, 0x4b, 0x23, 0xee, 0xd5, 0x03, 0xf2, 0x99, 0x00, 0x11,
-  0xf7, 0x4e, 0xb4, 0xf2, 0xb7, 0x52, 0xac, 0xcb, 0x5b, 0x00, 0x11, 0xf7,
-  0xe1, 0xae, 0x3c, 0xed, 0x09, 0x61, 0x02, 0x3d, 0x34, 0xb6, 0x73, 0xee,
-  0x9c, 0x12, 0xc8, 0xfd, 0x36, 0x28, 0x05, 0x3e, 0x57, 0xda, 0x4c, 0xce,
-  0x6c, 0x06, 0xce, 0x41, 0xd4, 0xcb, 0x6d, 0x81, 0xd9, 0xfa, 0xcf, 0xd6,
-  0x9b, 0x59, 0xb9, 0x7a, 0x56, 0x3a, 0x2d, 0x63, 0x45, 0x41, 0x81, 0xdc,
-  0x17, 0xcf, 0x30, 0x36, 0x3f, 0xc7, 0x07, 0x64, 0x5f, 0x20, 0x2b, 0xe9,
-  0x66, 0x3d, 0x16, 0xff, 0x66, 0xfe, 0x60, 0xe9, 0x6c, 0xbd, 0x18, 0xbb,
-  0xa5, 0x68, 0xb1, 0x3c, 0xc3, 0x62, 0x05, 0x2c, 0xeb, 0x07, 0xf3, 0x27,
-  0x1f, 0x79, 0xdb, 0x36, 0x9e, 0x3e, 0x16, 0x1d, 0x44, 0x08, 0x9a, 0x16,
-  0xf6, 0x10, 0xfa, 0x0a, 0xbe, 0xb0, 0xdc, 0xcf, 0x51, 0x2d, 0xbe, 0x6b,
-  0x1a, 0xb1, 0xd4, 0x5b, 0x15, 0x33, 0x1e, 0xa8, 0x01, 0xdd, 0x77, 0x32,
-  0xa8, 0xee, 0x12, 0x31, 0xb4, 0x5c, 0x20, 0xd3, 0x1f, 0xc0, 0xc8, 0x45,
-  0xac, 0x23, 0x11, 0xfb, 0xa7, 0x9a, 0x05, 0xe0, 0xd0, 0x19, 0x04, 0x46,
-  0xff, 0x39, 0x44, 0x7f, 0x1c, 0x3a, 0xc5, 0x3c, 0xde, 0x12, 0x42, 0xe5,
-  0xac, 0x04, 0x5b, 0x1c, 0xef, 0xd1, 0xe0, 0xd2, 0x18, 0xeb, 0xf5, 0x77,
-  0x17, 0xbe, 0x5a, 0x65, 0xdc, 0xec, 0x51, 0x02, 0xdd, 0x5a, 0x0d, 0xb9,
-  0x7b, 0x73, 0x06, 0xee, 0x7f, 0x34, 0x4a, 0x33, 0x46, 0xee, 0x40, 0x92,
-  0x56, 0xd5, 0xb1, 0x4c, 0xc3, 0xa2, 0x30, 0xd0, 0x81, 0x22, 0x47, 0xf2,
-  0x9e, 0x7e, 0xec, 0xd6, 0x1b, 0xe9, 0x4f, 0xcc, 0xda, 0x47, 0x13, 0x2e,
-  0x25, 0xa6, 0x26, 0xa3, 0x21, 0xb7, 0x48, 0x32, 0x00, 0x56, 0x96, 0xc7,
-  0x2a, 0x1f, 0x01, 0x5b, 0xb2, 0x0d, 0xb1, 0x4c, 0x4d, 0x4e, 0xc0, 0xac,
-  0x09, 0xb8, 0x57, 0x4f, 0x54, 0x1d, 0xa9, 0x57, 0xd6, 0xe5, 0x8f, 0x53,
-  0xd8, 0x42, 0xa2, 0x7f, 0x44, 0xb7, 0xb5, 0x1f, 0x2e, 0xa2, 0x26, 0x27,
-  0x18, 0x35, 0x31, 0x10, 0xd6, 0x1d, 0xa7, 0x4c, 0xfa, 0x3e, 0x2d, 0xc8,
-  0x28, 0x01, 0xe0, 0xe8, 0xc5, 0xec, 0xfe, 0xa8, 0x09, 0x3e, 0xa9, 0x00,
-  0xce, 0xe3, 0x11, 0x15, 0xe3, 0x33, 0x9f, 0x0c, 0x3d, 0x09, 0xdc, 0x39,
-  0xe3, 0x38, 0xd3, 0x3e, 0x5d, 0x64, 0x8e, 0x4c, 0x14, 0xe6, 0x4a, 0x81,
-  0x1e, 0x10, 0x0f, 0x44, 0xa4, 0x00, 0xa6, 0x56, 0xb1, 0xe1, 0xec, 0x23,
-  0xde, 0xa1, 0x39, 0x4a, 0x0e, 0x0c, 0xbd, 0x02, 0x14, 0x28, 0xaa, 0xb2,
-  0xac, 0xaf, 0x9e, 0x37, 0x48, 0x90, 0xe2, 0xbe, 0x18, 0x13, 0x5d, 0x35,
-  0x9f, 0xc1, 0x40, 0xb2, 0x3e, 0x3f, 0x31, 0x38, 0xd3, 0xcb, 0xc4, 0xd5,
-  0x28, 0xbc, 0xf5, 0xa5, 0xa5, 0xd6, 0x16, 0x03, 0xcb, 0x66, 0x17, 0xa2,
-  0x08, 0x46, 0xed, 0xf9, 0x1f, 0x3a, 0x35, 0x88, 0xa7, 0x56, 0x4f, 0xed,
-  0x29, 0x0d, 0xb5, 0x51, 0x3f, 0x0e, 0x13, 0xee, 0x81, 0x23, 0xc2, 0xe8,
-  0x8f, 0x84, 0x9b, 0x28, 0x22, 0x3c, 0x54, 0x92, 0x1f, 0x1c, 0x29, 0xd0,
-  0xb4, 0x4f, 0xc6, 0xcd, 0xe7, 0xa0, 0x0c, 0xdf, 0xf0, 0x06, 0x39, 0x0e,
-  0xd0, 0x22, 0xe7, 0x89, 0x3a, 0x5a, 0x6c, 0x24, 0xc2, 0x34, 0x21, 0xce,
-  0x15, 0xb6, 0x06, 0xe3, 0xd1, 0xa8, 0xe1, 0xbb, 0x0f, 0x3e, 0x2f, 0xdc,
-  0x1b, 0xc7, 0x0a, 0x02, 0xa7, 0xb1, 0xf9, 0x55, 0xc4, 0xdc, 0x81, 0x02,
-  0x6e, 0x45, 0x1f, 0xee, 0xfe, 0xb1, 0x5c, 0xeb, 0xe0, 0xe7, 0xee, 0xb0,
-  0xf9, 0x67, 0xf4, 0x03, 0x4d, 0xcc, 0x9f, 0x4b, 0x3c, 0x19, 0xbf, 0x2d,
-  0x07, 0x0b, 0xb2, 0x1b, 0xc5, 0xfd, 0xda, 0x3f, 0xc3, 0x00, 0xb6, 0x49,
-  0xb8, 0xad, 0x4f, 0x6f, 0x35, 0x53, 0x1f, 0x46, 0x9b, 0x71, 0x53, 0xdf,
-  0x6a, 0xe3, 0x5e, 0xe5, 0x4d, 0x04, 0xf1, 0xd0, 0x39, 0xee, 0x60, 0x43,
-  0x00, 0xbf, 0xfc, 0xc0, 0xc8, 0xad, 0xa8, 0xf8, 0xdc, 0x4a, 0x81, 0xa7,
-  0x5c, 0x33, 0x4f, 0x42, 0xf7, 0xbb, 0x32, 0x37, 0xdd, 0x63, 0x51, 0x60,
-  0xd3, 0xdc, 0x34, 0x16, 0xed, 0x4d, 0xf3, 0xd2, 0xcd, 0xfc, 0xd4, 0x66,
-  0xf1, 0x00, 0xca, 0xae, 0x42, 0x23, 0x48, 0x2f, 0x8e, 0x29, 0x74, 0x30,
-  0x58, 0x38, 0x40, 0x26, 0x37, 0x30, 0xd2, 0x52, 0x61, 0x0b, 0x2a, 0x02,
-  0x95, 0xe3, 0x14, 0xf4, 0x37, 0x9f, 0xf0, 0x97, 0x2c, 0xa0, 0xdf, 0x03,
-  0x4b, 0x15, 0x14, 0xfa, 0xd5, 0x7f, 0x35, 0x28, 0xd9, 0x5a, 0xbd, 0x11,
-  0xb2, 0xd4, 0x3b, 0x08, 0xcd, 0xc2, 0x4c, 0xfb, 0xab, 0xd0, 0x39, 0x2a,
-  0x30, 0x27, 0x4e, 0x44, 0xc0, 0x0b, 0xed, 0x45, 0xd6, 0x00, 0x8c, 0xd9,
-  0x94, 0xee, 0xed, 0x2e, 0x47, 0x4a, 0xc6, 0xc9, 0xf2, 0xb3, 0xef, 0x62,
-  0x5d, 0xa5, 0x48, 0xe6, 0x15, 0xc2, 0x25, 0xfc, 0xfa, 0x7f, 0xa0, 0x13,
-  0xa9, 0x43, 0x0a, 0x05, 0x38, 0xa5, 0x3c, 0x48, 0xc4, 0x27, 0x1c, 0xa0,
-  0x43, 0xcd, 0x16, 0xd4, 0xdb, 0xe4, 0x2b, 0x15, 0xa6, 0xc7, 0x3c, 0x1c,
-  0xa6, 0xae, 0x4e, 0x16, 0x77, 0x4c, 0xe6, 0x0e, 0xe6, 0xe1, 0x47, 0x04,
-  0x7d, 0xf8, 0xff, 0xc2, 0xf4, 0xa9, 0xb3, 0x59, 0xc1, 0x05, 0x06, 0x57,
-  0xb5, 0xe2, 0x06, 0x5d, 0x40, 0xf5, 0x0f, 0x47, 0xb8, 0xc9, 0x56, 0x5e,
-  0x27, 0x21, 0xd7, 0xd3, 0xf5, 0x7f, 0x47, 0x28, 0xd9, 0xf0, 0x68, 0x4d,
-  0xd2, 0x08, 0xa8, 0xea, 0x9b, 0xe6, 0x02, 0x66, 0x56, 0x2a, 0x25, 0xfc,
-  0x3d, 0xfa, 0x21, 0xc1, 0x2b, 0x39, 0xcf, 0x7f, 0x44, 0x49, 0xa2, 0xa5,
-  0xe8, 0xc9, 0x43, 0x9b, 0x66, 0x49, 0x42, 0x26, 0xc4, 0x0e, 0xa5, 0xa6,
-  0xff, 0x59, 0x0c, 0x1b, 0x53, 0xc8, 0xae, 0xed, 0xf3, 0xbb, 0x1b, 0x32,
-  0x44, 0x09, 0xcf, 0x05, 0x8c, 0xf0, 0xe1, 0x0d, 0x70, 0xec, 0x33, 0xdf,
-  0xa2, 0xfc, 0xd0, 0xb1, 0xde, 0xba, 0x9b, 0x24, 0xa5, 0x09, 0x46, 0x44,
-  0xf0, 0xd6, 0xae, 0x21, 0x33, 0xe4, 0xec, 0xee, 0xe8, 0x5e, 0x5c, 0x7f,
-  0x81, 0x37, 0xce, 0x20, 0xe6, 0x46, 0xd8, 0x48, 0xf4, 0xe7, 0x44, 0xaa,
-  0x10, 0x4a, 0x90, 0x5a, 0x5b, 0xdf, 0x16, 0x17, 0x29, 0x28, 0xcc, 0xdb,
-  0x82, 0x2b, 0xd0, 0xd5, 0x21, 0x44, 0xb9, 0xe5, 0xf8, 0x2f, 0x76, 0xda,
-  0xd2, 0x0a, 0xb8, 0xe2, 0xf5, 0x5e, 0xea, 0xdf, 0xde, 0x09, 0x52, 0x30,
-  0x24, 0xc6, 0xee, 0x5f, 0x91, 0xa5, 0xf9, 0x0e, 0xba, 0x15, 0xa3, 0x17,
-  0x2e, 0x4b, 0x33, 0x93, 0x35, 0xf0, 0xc2, 0x4d, 0x97, 0x95, 0xa0, 0xa8,
-  0x10, 0x59, 0xb4, 0x2b, 0x32, 0xda, 0xa2, 0x27, 0x64, 0xf7, 0x1e, 0x38,
-  0x78, 0x70, 0xaa, 0x9c, 0xba, 0x26, 0x67, 0x2a, 0xda, 0x47, 0x15, 0xa6,
-  0x45, 0xb5, 0xe2, 0xc2, 0xe9, 0xf7, 0x88, 0x63, 0xfa, 0x82, 0x6a, 0x7f,
-  0x52, 0x09, 0x15, 0xf7, 0x48, 0x70, 0xfe, 0x03, 0x0a, 0x16, 0x32, 0xc2,
-  0x77, 0x1a, 0xaf, 0x1d, 0x3d, 0x43, 0x8e, 0xfa, 0x7f, 0x23, 0xd6, 0xb7,
-  0x37, 0x1e, 0x5c, 0xf5, 0xd8, 0x2f, 0x47, 0xeb, 0x4c, 0x1d, 0xae, 0xe9,
-  0x26, 0xd5, 0xc4, 0x3f, 0xc6, 0x3d, 0xab, 0x34, 0x37, 0x2a, 0x22, 0x75,
-  0x3e, 0x08, 0xe0, 0xf0, 0xd9, 0x24, 0x15, 0x18, 0xf0, 0x2c, 0xe3, 0x19,
-  0xe0, 0x6f, 0x0f, 0xb4, 0x19, 0x0d, 0xc5, 0x32, 0x40, 0xf2, 0xe9, 0x17,
-  0xd9, 0x07, 0x9d, 0xef, 0x35, 0x1a, 0x10, 0xba, 0xcd, 0x10, 0x3b, 0x55,
-  0xa5, 0x03, 0xb0, 0xc2, 0xff, 0x47, 0xcf, 0xe1, 0x1d, 0xd2, 0xb9, 0xdf,
-  0x40, 0x46, 0x2c, 0x14, 0xd3, 0x1a, 0xea, 0xe7, 0xf0, 0xdc, 0xc2, 0x2f,
-  0x09, 0x0a, 0xcc, 0xbf, 0xfe, 0x32, 0xf3, 0x25, 0x3a, 0xc1, 0x7f, 0x47,
-  0x96, 0xdd, 0xd2, 0xc2, 0x0f, 0x3f, 0x10, 0xbe, 0x0c, 0xfc, 0xe8, 0xde,
-  0x52, 0x3e, 0xdd, 0xd4, 0xab, 0xf5, 0x29, 0xc4, 0xf6, 0xf2, 0xcf, 0x28,
-  0xb7, 0x26, 0xfd, 0x1d, 0x05, 0x73, 0x90, 0x39, 0x5d, 0x15, 0x18, 0x49,
-  0x42, 0x70, 0xd7, 0x6c, 0x13, 0x74, 0x17, 0xe0, 0x6a, 0xbe, 0x5f, 0x43,
-  0x16, 0xea, 0x10, 0xad, 0x5d, 0x3d, 0x5a, 0xda, 0xeb, 0x07, 0xf5, 0xb9,
-  0x06, 0x66, 0xb6, 0xac, 0xcb, 0xf7, 0x60, 0xc8, 0xb1, 0xa0, 0xea, 0xcf,
-  0x3f, 0x57, 0xd9, 0xb3, 0x61, 0x7f, 0xcd, 0xb8, 0x0f, 0x2b, 0x31, 0x30,
-  0x6b, 0xec, 0xbd, 0xe7, 0xce, 0xf8, 0xbf, 0x01, 0xb1, 0x08, 0x1b, 0xfd,
-  0x37, 0x69, 0xf3, 0x67, 0xf1, 0x37, 0x81, 0x1a, 0xf9, 0x1e, 0x1c, 0xf0,
-  0x22, 0x06, 0x0a, 0x0f, 0xc2, 0x0f, 0xe7, 0x3d, 0x23, 0xec, 0x16, 0xd8,
-  0xe6, 0xd4, 0xcd, 0xfd, 0xe4, 0xee, 0xfa, 0xe5, 0xae, 0x55, 0x47, 0xc1,
-  0x46, 0xaa, 0x03, 0x3e, 0x85, 0xac, 0xe4, 0x4f, 0x0f, 0xd3, 0xc6, 0x49,
-  0xd2, 0xa6, 0x6f, 0xed, 0xfa, 0x2f, 0x21, 0x36, 0x0a, 0x33, 0xac, 0xa5,
-  0xd6, 0xcd, 0x29, 0x0e, 0xa6, 0x44, 0xb9, 0xb6, 0x93, 0x5c, 0x59, 0x00,
-  0x09, 0x12, 0xca, 0xce, 0x94, 0x14, 0xca, 0x50, 0xfa, 0x39, 0xe3, 0x2d,
-  0xfa, 0x02, 0x6e, 0x9d, 0x0d, 0x19, 0x4a, 0x04, 0x28, 0xfa, 0xf0, 0x3a,
-  0x81, 0x81, 0x96, 0xf6, 0xf0, 0x27, 0xb2, 0xc6, 0xf2, 0xcb, 0xd3, 0xd4,
-  0x9a, 0xa4, 0xf8, 0xcd, 0x25, 0x1c, 0x33, 0xd4, 0xee, 0xd4, 0xb3, 0xea,
-  0x1a, 0xb5, 0xee, 0xe2, 0xad, 0xe7, 0x3d, 0x8a, 0xcb, 0x41, 0x20, 0x57,
-  0xc2, 0xb4, 0x9e, 0x1a, 0xfb, 0x29, 0x5a, 0x0a, 0x3b, 0xcc, 0x4a, 0xd1,
-  0x03, 0xfb, 0xd2, 0xf7, 0xcf, 0x5f, 0x2e, 0xb6, 0xb0, 0x3e, 0xef, 0x57,
-  0xf7, 0xa2, 0xa3, 0xc6, 0x8a, 0xcc, 0x2c, 0xd8, 0x59, 0x81, 0xaa, 0xdd,
-  0xd9, 0x78, 0x35, 0x47, 0xd5, 0xcc, 0x12, 0xc1, 0x25, 0xc3, 0x44, 0xdf,
-  0x85, 0x09, 0x5e, 0x0b, 0xde, 0xc1, 0xdf, 0x3c, 0xa9, 0x1b, 0x14, 0xd1,
-  0xb2, 0x9a, 0x19, 0x7b, 0x22, 0xab, 0x25, 0x7b, 0x63, 0xdf, 0xf7, 0x3a,
-  0xe8, 0x25, 0x7c, 0x96, 0xeb, 0xa5, 0xfd, 0xfd, 0x04, 0x3d, 0x26, 0x0c,
-  0x9c, 0xe2, 0x3e, 0xdb, 0x9f, 0x9f, 0xb1, 0x62, 0xc9, 0x33, 0x3f, 0xa2,
-  0x23, 0xf1, 0x64, 0x9d, 0xab, 0x6c, 0xd0, 0xec, 0x0d, 0xaf, 0x39, 0xad,
-  0x55, 0xc0, 0xe3, 0xb6, 0x81, 0x28, 0x3b, 0x59, 0x3c, 0x0d, 0x93, 0xdd,
-  0xdb, 0x13, 0xb8, 0x1a, 0xc3, 0x00, 0x3f, 0xb9, 0x0d, 0x23, 0xd5, 0xfa,
-  0x3e, 0x08, 0x2c, 0x30, 0xc0, 0xf8, 0x30, 0xb1, 0xa7, 0x34, 0x3a, 0xe6,
-  0x47, 0x65, 0x7f, 0x54, 0x06, 0xd6, 0xe5, 0x1d, 0x24, 0xdf, 0xd8, 0x3d,
-  0xbe, 0xaa, 0x4e, 0xf5, 0x2a, 0xcb, 0xc9, 0xcf, 0xd2, 0x5e, 0x0f, 0xd7,
-  0x27, 0x07, 0xf3, 0x09, 0xd9, 0x21, 0xbb, 0x27, 0x19, 0x12, 0x39, 0xc1,
-  0x2c, 0xed, 0x38, 0xb4, 0x18, 0xf3, 0x5f, 0xb1, 0xd3, 0xe7, 0x93, 0xbc,
-  0x25, 0x82, 0x17, 0xd9, 0xa6, 0x34, 0x3d, 0xf9, 0x69, 0xd9, 0x46, 0x93,
-  0xe1, 0xfd, 0x08, 0xf2, 0xd8, 0x2f, 0xaa, 0xd7, 0x19, 0x3a, 0x03, 0xea,
-  0xff, 0x23, 0xa3, 0x45, 0x81, 0xc4, 0x9e, 0x32, 0x97, 0x51, 0x33, 0x91,
-  0x09, 0xfe, 0xaf, 0x27, 0x14, 0xe1, 0xc3, 0xfa, 0xd0, 0x68, 0x64, 0xe8,
-  0xdf, 0xc0, 0x1f, 0x00, 0xb8, 0xbe, 0x06, 0xb8, 0xe1, 0x12, 0x09, 0x16,
-  0xb8, 0x4d, 0x98, 0x50, 0x10, 0xbc, 0xb8, 0x1b, 0x46, 0xd9, 0x2d, 0x4b,
-  0xf8, 0x4f, 0x18, 0x32, 0x04, 0x5a, 0x0e, 0x60, 0x08, 0x0d, 0x0e, 0xfe,
-  0x26, 0x25, 0x3f, 0xd3, 0x46, 0x23, 0x81, 0xfa, 0xa7, 0xbb, 0xd0, 0xe0,
-  0xd1, 0x6c, 0xce, 0x56, 0x1c, 0x49, 0x11, 0x2a, 0xf0, 0x55, 0x1a, 0x8d,
-  0x30, 0x5b, 0x4d, 0x56, 0x27, 0x22, 0xb4, 0xb6, 0xbd, 0x4d, 0x67, 0x58,
-  0xb5, 0xe5, 0xcb, 0xfb, 0xd2, 0x32, 0xdb, 0xd5, 0xc3, 0x0a, 0xf7, 0x42,
-  0xa6, 0x64, 0xff, 0x09, 0x57, 0x69, 0x58, 0xa2, 0x98, 0xab, 0xb1, 0x37,
-  0x3b, 0x51, 0xe3, 0xe0, 0x3b, 0x46, 0xe9, 0xca, 0xa5, 0xf4, 0x22, 0x4b,
-  0x23, 0xae, 0x1d, 0x81, 0xc0, 0x24, 0x27, 0xd2, 0x90, 0xdb, 0x03, 0x01,
-  0x14, 0x92, 0xf2, 0xc3, 0xf0, 0x50, 0x0a, 0x88, 0xec, 0xb7, 0x4a, 0xbc,
-  0x54, 0x45, 0x1c, 0xf8, 0x2d, 0xbc, 0x9b, 0xf0, 0x53, 0x6b, 0x40, 0x25,
-  0x0f, 0xc0, 0x4a, 0x3c, 0xb0, 0x01, 0xc1, 0xc2, 0x65, 0xd9, 0xae, 0xf2,
-  0x52, 0x32, 0xbf, 0x01, 0x5a, 0xdd, 0xeb, 0x5e, 0x4e, 0xfd, 0xb1, 0xc2,
-  0xc5, 0x32, 0xaa, 0x0b, 0xe8, 0xfb, 0x4c, 0x76, 0xa7, 0x8f, 0x3b, 0x3e,
-  0xc2, 0xf6, 0xc0, 0x98, 0x71, 0xef, 0x81, 0x63, 0x34, 0xb2, 0xf9, 0x15,
-  0x60, 0x4b, 0x1d, 0xf5, 0x4e, 0xb7, 0xd1, 0x3e, 0xa5, 0x86, 0xfe, 0x68,
-  0xf6, 0x81, 0x3c, 0x5e, 0x93, 0xf6, 0xc9, 0xa4, 0xef, 0xf4, 0x27, 0xd4,
-  0x9c, 0x52, 0xba, 0x0b, 0x10, 0x25, 0x43, 0x22, 0xc6, 0xf4, 0x9c, 0xc5,
-  0x82, 0x41, 0xd6, 0x0c, 0xdd, 0x5c, 0x54, 0x47, 0xcc, 0x2e, 0xbe, 0xc0,
-  0xed, 0x3f, 0xf9, 0xf4, 0xd6, 0xaa, 0xeb, 0xfc, 0x34, 0x2b, 0xd1, 0x01,
-  0x0b, 0xa7, 0xb3, 0x64, 0x53, 0xb0, 0x5d, 0x58, 0xa8, 0x6b, 0x2f, 0x9b,
-  0xf4, 0x43, 0xfc, 0x0f, 0x67, 0x35, 0x5c, 0x4b, 0x07, 0xa6, 0xc2, 0x37,
-  0xad, 0x34, 0x28, 0x1a, 0x49, 0xe2, 0x20, 0xdb, 0xf1, 0x33, 0xb1, 0xdd,
-  0xff, 0x0f, 0xca, 0x7f, 0x6f, 0xe1, 0x43, 0xd8, 0xc6, 0xc7, 0xf0, 0x1c,
-  0x7c, 0xe1, 0x50, 0xc0, 0x3e, 0x2a, 0x3c, 0xc8, 0x53, 0xb4, 0x01, 0xd6,
-  0x1c, 0x19, 0xad, 0x5a, 0xf3, 0xca, 0x96, 0x4e, 0x4b, 0xe4, 0xe3, 0xe0,
-  0xb9, 0x20, 0x47, 0xe4, 0xcd, 0x1e, 0xf6, 0x2b, 0xe4, 0x0d, 0x29, 0x07,
-  0xc7, 0xc3, 0xe8, 0x21, 0x0f, 0x35, 0xc4, 0x0a, 0xa3, 0xc5, 0x56, 0xd4,
-  0xde, 0xdb, 0xcd, 0xce, 0xdf, 0xec, 0x31, 0xc5, 0xcf, 0x33, 0xc0, 0x02,
-  0xe7, 0xfc, 0x7f, 0x2e, 0x20, 0xb0, 0x58, 0x5d, 0xe3, 0xa9, 0xde, 0x13,
-  0x3e, 0x5e, 0x1e, 0xf9, 0x08, 0xde, 0xb1, 0xeb, 0xba, 0x3a, 0x62, 0x17,
-  0xa3, 0xd0, 0xea, 0x4b, 0xca, 0x1c, 0xdd, 0xdf, 0x0e, 0x13, 0x08, 0xd1,
-  0xa6, 0x20, 0xf7, 0xed, 0x81, 0xfa, 0x20, 0x5c, 0xe6, 0xbc, 0xc7, 0x12,
-  0x4b, 0xd5, 0xa2, 0xbd, 0x18, 0x26, 0x0f, 0xd6, 0x31, 0xd3, 0xc6, 0x87,
-  0xf8, 0x07, 0xf6, 0xdc, 0x47, 0xb8, 0x3b, 0x05, 0x0f, 0xff, 0x50, 0xf2,
-  0xa0, 0x9e, 0x90, 0xee, 0xa1, 0xbf, 0xe1, 0x18, 0x13, 0x26, 0x58, 0xc0,
-  0xe7, 0x56, 0x08, 0xe6, 0x06, 0x81, 0x20, 0xc9, 0xa4, 0xce, 0x23, 0x3e,
-  0x34, 0x21, 0x86, 0x27, 0x66, 0xf0, 0x57, 0xf1, 0xb4, 0xd7, 0x9a, 0x24,
-  0x1d, 0x14, 0xc1, 0xfb, 0xd5, 0xda, 0x81, 0x9d, 0xcc, 0x82, 0x8e, 0x5a,
-  0x16, 0x18, 0x8a, 0x71, 0x0a, 0x2b, 0xb4, 0x5e, 0xc6, 0x57, 0xd0, 0x5d,
-  0x3a, 0x37, 0xab, 0xb6, 0xff, 0x5c, 0x20, 0xe9, 0xdd, 0x09, 0x14, 0x58,
-  0xda, 0x37, 0xda, 0x2e, 0xf5, 0xec, 0xc7, 0x84, 0x30, 0xd4, 0xa6, 0x4a,
-  0x0d, 0xb1, 0x44, 0x5b, 0x5e, 0x26, 0x81, 0xc5, 0x7a, 0x54, 0xe7, 0x24,
-  0x55, 0xcc, 0xec, 0xd8, 0xb5, 0xe7, 0xd3, 0xd0, 0x73, 0xda, 0x4a, 0xa7,
-  0xef, 0xe3, 0x89, 0x76, 0x9a, 0x18, 0xe3, 0x29, 0x0f, 0x9b, 0x19, 0x3e,
-  0xf7, 0xd3, 0x6d, 0x28, 0x4b, 0x43, 0x93, 0xcb, 0x67, 0xf7, 0xd7, 0xa8,
-  0x74, 0x88, 0x8e, 0x9a, 0x62, 0x7b, 0x3c, 0x62, 0x49, 0x0f, 0x4c, 0x65,
-  0xc1, 0x50, 0xba, 0xa0, 0x09, 0xc7, 0x19, 0x38, 0x32, 0x2b, 0x1e, 0xfc,
-  0x03, 0xbe, 0xc6, 0xeb, 0x34, 0xe0, 0xa5, 0xd4, 0xc3, 0xa7, 0xb8, 0x1a,
-  0x93, 0xa4, 0x04, 0xc8, 0x29, 0xbd, 0xf6, 0x62, 0x7f, 0x21, 0x2f, 0x30,
-  0xbe, 0x51, 0xc4, 0xb1, 0x42, 0x67, 0xf2, 0xfd, 0x59, 0xdb, 0x79, 0xc1,
-  0x73, 0x42, 0xca, 0x4d, 0xb7, 0x99, 0x32, 0x2e, 0xf9, 0x27, 0x64, 0x44,
-  0xce, 0x2c, 0xd8, 0x9d, 0x03, 0xf0, 0xf0, 0xd0, 0xdd, 0x29, 0x5b, 0xa5,
-  0xb7, 0xd0, 0xa4, 0x22, 0xcb, 0xb0, 0x0d, 0x23, 0x20, 0x36, 0x53, 0xe3,
-  0x26, 0xfd, 0xf4, 0x9f, 0x73, 0xee, 0x2e, 0xe6, 0x8e, 0xe7, 0xe7, 0xa9,
-  0xb8, 0xbb, 0x5d, 0xf0, 0x34, 0xdc, 0xcd, 0x5f, 0x7f, 0xee, 0xb9, 0x48,
-  0x9e, 0xfa, 0xe3, 0x1d, 0x39, 0x83, 0x39, 0x0a, 0x30, 0x3e, 0xdb, 0x53,
-  0xc2, 0x20, 0xc9, 0x32, 0x16, 0xc7, 0xb1, 0xe6, 0xa9, 0x21, 0x9a, 0x36,
-  0x9b, 0xe3, 0x4a, 0x43, 0x37, 0xfc, 0x5a, 0x0e, 0x20, 0xc9, 0xf7, 0x9b,
-  0xba, 0xc5, 0xac, 0xde, 0x9c, 0xab, 0xf8, 0xbf, 0x34, 0x44, 0xe3, 0xee,
-  0xec, 0x0c, 0xae, 0x2b, 0x2d, 0x40, 0xd0, 0xbf, 0x0f, 0x5a, 0xfb, 0x14,
-  0x33, 0x60, 0xe4, 0x4a, 0xa8, 0x41, 0xc4, 0xdc, 0xe6, 0xa6, 0x81, 0x3c,
-  0x0d, 0x1c, 0x2a, 0xa6, 0x86, 0xe4, 0x75, 0x0b, 0x0c, 0x84, 0x3a, 0x8c,
-  0xcf, 0x43, 0x2c, 0x2c, 0x10, 0x43, 0x05, 0xd3, 0x9d, 0xc4, 0xfa, 0xbe,
-  0xac, 0x51, 0xa5, 0xb8, 0xd5, 0xfc, 0x97, 0x3c, 0x38, 0x57, 0x07, 0xef,
-  0x2e, 0x34, 0x32, 0xcc, 0xc7, 0x9e, 0x1a, 0x14, 0xb3, 0x59, 0xc8, 0x81,
-  0x1d, 0xcf, 0xa9, 0xd4, 0xd0, 0x33, 0x12, 0x9d, 0xa8, 0xf9, 0x03, 0x47,
-  0x13, 0x42, 0xd7, 0xf7, 0x11, 0xe9, 0x20, 0xfc, 0x29, 0xca, 0x20, 0xe8,
-  0x6b, 0x2c, 0xe3, 0xca, 0x3e, 0xa1, 0x20, 0xff, 0x20, 0xed, 0x96, 0x51,
-  0xc2, 0xe8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xaf, 0xf7, 0xff, 0xff, 0x4e, 0xfa, 0xff, 0xff, 0x3f, 0xfa, 0xff, 0xff,
-  0xfa, 0xe8, 0xff, 0xff, 0xc8, 0x02, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff,
-  0x13, 0xf0, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0x1f, 0x27, 0x00, 0x00,
-  0xf4, 0xfa, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x48, 0xf4, 0xff, 0xff,
-  0xb9, 0x03, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x00, 0xec, 0x02, 0x00, 0x00,
-  0x83, 0x08, 0x00, 0x00, 0x54, 0xe9, 0xff, 0xff, 0xa7, 0x09, 0x00, 0x00,
-  0x9b, 0xf9, 0xff, 0xff, 0xb1, 0xf3, 0xff, 0xff, 0x13, 0x03, 0x00, 0x00,
-  0xc1, 0xf1, 0xff, 0xff, 0x92, 0x15, 0x00, 0x00, 0x63, 0xfb, 0xff, 0xff,
-  0x02, 0x03, 0x00, 0x00, 0x88, 0x0c, 0x00, 0x00, 0x69, 0x0b, 0x00, 0x00,
-  0x9c, 0x01, 0x00, 0x00, 0xba, 0xe4, 0xff, 0xff, 0x53, 0xfc, 0xff, 0xff,
-  0xfd, 0xf4, 0xff, 0xff, 0xc5, 0xf8, 0xff, 0xff, 0xad, 0xff, 0xff, 0xff,
-  0xa0, 0x13, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x00, 0x54, 0xf4, 0xff, 0xff,
-  0xd8, 0xf6, 0xff, 0xff, 0x7e, 0x02, 0x00, 0x00, 0xa5, 0xea, 0xff, 0xff,
-  0x61, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xbc, 0xfa, 0xff, 0xff,
-  0x49, 0xf1, 0xff, 0xff, 0x1f, 0x0c, 0x00, 0x00, 0x06, 0xf1, 0xff, 0xff,
-  0x22, 0x01, 0x00, 0x00, 0x08, 0x1a, 0x00, 0x00, 0x24, 0x0b, 0x00, 0x00,
-  0x2b, 0x05, 0x00, 0x00, 0xdd, 0xfd, 0xff, 0xff, 0xbb, 0x11, 0x00, 0x00,
-  0x1e, 0xeb, 0xff, 0xff, 0xaa, 0x05, 0x00, 0x00, 0xa6, 0xfb, 0xff, 0xff,
-  0x50, 0x10, 0x00, 0x00, 0xac, 0xf3, 0xff, 0xff, 0x02, 0x06, 0x00, 0x00,
-  0x61, 0x12, 0x00, 0x00, 0x92, 0x08, 0x00, 0x00, 0x97, 0xf6, 0xff, 0xff,
-  0xa7, 0x01, 0x00, 0x00, 0xce, 0x09, 0x00, 0x00, 0xea, 0x08, 0x00, 0x00,
-  0xcf, 0x0e, 0x00, 0x00, 0xce, 0xe9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0x7f, 0x08, 0x49, 0x81, 0x40, 0x27, 0x81, 0x5d,
-  0x7f, 0x7f, 0xa6, 0x3e, 0x17, 0x60, 0x51, 0x7f, 0x46, 0x84, 0x82, 0xe5,
-  0x7f, 0xdb, 0x47, 0xf6, 0xec, 0x9f, 0xf4, 0xf8, 0x39, 0x05, 0x93, 0x11,
-  0x96, 0x74, 0xab, 0xdd, 0x8a, 0x09, 0x81, 0x7f, 0x93, 0xa4, 0xa8, 0xd8,
-  0x2d, 0xd1, 0x87, 0x81, 0x22, 0x37, 0x45, 0x4c, 0x50, 0x81, 0x70, 0x81,
-  0x14, 0x7f, 0x54, 0x81, 0xf8, 0x7f, 0xde, 0x26, 0xec, 0xfc, 0x4b, 0xba,
-  0xf2, 0x6d, 0xd4, 0x67, 0x0b, 0x13, 0xcf, 0xc8, 0x7f, 0x51, 0x16, 0x56,
-  0xd8, 0x81, 0xb0, 0x81, 0xd7, 0xb7, 0x77, 0x81, 0x9d, 0xb3, 0xdf, 0x78,
-  0x37, 0x7f, 0x68, 0xe9, 0xa9, 0x49, 0x81, 0x88, 0x24, 0x90, 0xb6, 0x52,
-  0x81, 0xba, 0xa6, 0x01, 0x60, 0xcf, 0xbf, 0x0d, 0x7f, 0x72, 0x4d, 0xfb,
-  0xd7, 0x8f, 0x7f, 0xa3, 0xa3, 0x63, 0x44, 0xc6, 0x81, 0x64, 0x1d, 0x81,
-  0xa7, 0x4a, 0x5e, 0xc6, 0x48, 0x5c, 0xa3, 0x9a, 0x1f, 0x03, 0xb3, 0x7f,
-  0x58, 0xaa, 0xf3, 0x73, 0x50, 0xe2, 0x81, 0xb8, 0x09, 0xb4, 0x7a, 0xd6,
-  0x35, 0x95, 0x81, 0x81, 0xed, 0x62, 0xc6, 0xd0, 0x2d, 0x2b, 0xce, 0xc2,
-  0x42, 0xe3, 0xaa, 0x45, 0xb5, 0x1e, 0x8f, 0x05, 0xe7, 0x9b, 0xcd, 0xd7,
-  0x73, 0x4b, 0xec, 0x0e, 0xb7, 0xfb, 0x6d, 0x8e, 0xf4, 0x5e, 0x7f, 0x99,
-  0x8e, 0x7d, 0xc9, 0xa1, 0xeb, 0x2a, 0x35, 0x14, 0x63, 0xbb, 0x40, 0x09,
-  0x07, 0x1f, 0xe9, 0x56, 0x2c, 0x61, 0xea, 0x27, 0xfd, 0xd6, 0xc4, 0xec,
-  0xf6, 0xbd, 0x29, 0xb6, 0x7f, 0xd3, 0x45, 0xba, 0x8c, 0x2f, 0xd7, 0x81,
-  0x17, 0x73, 0xa7, 0x2d, 0x7f, 0xe3, 0x89, 0x28, 0xad, 0x82, 0x81, 0xaa,
-  0x7f, 0x61, 0x81, 0x0d, 0x75, 0x64, 0x7f, 0xeb, 0x85, 0x38, 0x69, 0x23,
-  0x9a, 0x66, 0x35, 0xce, 0x2e, 0x1f, 0x81, 0xeb, 0x31, 0x7f, 0x19, 0x2b,
-  0x3e, 0x0e, 0xc2, 0xb5, 0x39, 0xcd, 0x81, 0x29, 0x18, 0x42, 0x9c, 0x6e,
-  0x2e, 0xe7, 0xc8, 0xdd, 0x6c, 0xd1, 0x59, 0x06, 0x19, 0xd9, 0x6b, 0xa6,
-  0x96, 0x5a, 0x62, 0xb3, 0x54, 0x3d, 0xb6, 0xf8, 0x76, 0x45, 0xcd, 0x30,
-  0x8e, 0x3d, 0xfc, 0xd4, 0x4c, 0x7f, 0xe3, 0xaf, 0xf2, 0xd1, 0xc6, 0x51,
-  0x32, 0x14, 0xc1, 0x9b, 0xd8, 0x0a, 0x2f, 0xcd, 0xfe, 0xea, 0x0a, 0xcc,
-  0x66, 0x3e, 0x5a, 0x1d, 0x1f, 0xfb, 0x43, 0x5c, 0x45, 0x48, 0x13, 0xe9,
-  0xb9, 0xdc, 0xc2, 0x3f, 0xae, 0xaa, 0x07, 0xa1, 0x0b, 0x81, 0x03, 0xa4,
-  0x18, 0xef, 0x14, 0xbd, 0xe5, 0xde, 0x35, 0xca, 0x64, 0x34, 0x20, 0x7f,
-  0xd6, 0x08, 0xa0, 0x13, 0x12, 0xbc, 0xd8, 0x81, 0xea, 0xc8, 0xe4, 0x8c,
-  0xdb, 0xfd, 0x66, 0xd4, 0xfa, 0xf0, 0x5f, 0xfc, 0x81, 0x45, 0x2f, 0xc0,
-  0x38, 0xc4, 0x40, 0x05, 0xeb, 0x5a, 0x24, 0xc7, 0x38, 0x81, 0x22, 0x4a,
-  0x11, 0x2c, 0x0c, 0xe3, 0x0d, 0x42, 0xbd, 0x12, 0xec, 0x3e, 0xc1, 0xa3,
-  0xb7, 0xab, 0x7f, 0xd4, 0x30, 0x81, 0x57, 0x01, 0x81, 0xf4, 0x7f, 0xc5,
-  0x77, 0xf7, 0x46, 0x41, 0x18, 0x81, 0x0a, 0x35, 0xd6, 0x81, 0xdb, 0x96,
-  0xc5, 0xad, 0x01, 0xc1, 0xdf, 0x81, 0xbc, 0x34, 0x7b, 0xee, 0x5c, 0x81,
-  0xa3, 0x59, 0x71, 0x89, 0xe2, 0xa4, 0x44, 0xbe, 0x21, 0x1c, 0x7f, 0x04,
-  0xe2, 0xe9, 0x4e, 0x9b, 0x35, 0x37, 0xa0, 0x09, 0xdf, 0x7f, 0x81, 0xf0,
-  0xf6, 0x6b, 0xbb, 0xe4, 0xed, 0xa0, 0x36, 0xe4, 0x26, 0x09, 0x64, 0x6a,
-  0x07, 0x18, 0x43, 0xdb, 0x7f, 0x46, 0xa5, 0x1d, 0xe2, 0x91, 0xca, 0x27,
-  0x8e, 0x5b, 0xcb, 0x95, 0x55, 0x74, 0xed, 0x4c, 0xef, 0xac, 0x62, 0xb4,
-  0x81, 0x3b, 0xa5, 0xe5, 0xe9, 0x46, 0x71, 0xef, 0x8d, 0x3d, 0x4b, 0xe5,
-  0x35, 0xb1, 0x5a, 0x2c, 0x7f, 0xeb, 0xc6, 0x7f, 0x28, 0x41, 0xe0, 0x00,
-  0x34, 0x35, 0x3b, 0x35, 0x81, 0x0b, 0xac, 0xda, 0xe2, 0xf9, 0x36, 0xd6,
-  0x30, 0x19, 0xd4, 0x11, 0x65, 0x55, 0x1d, 0xad, 0x6d, 0x7f, 0x38, 0x33,
-  0x4e, 0x11, 0xc6, 0x34, 0x8f, 0xae, 0xbd, 0x8c, 0x7f, 0xc5, 0xde, 0xef,
-  0x25, 0xb0, 0x4b, 0x7f, 0xd7, 0x0a, 0x29, 0xb7, 0x03, 0x43, 0x61, 0xd9,
-  0x09, 0xd9, 0xab, 0x18, 0x1a, 0xec, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x03, 0xfa, 0xff, 0xff, 0x0f, 0xf5, 0xff, 0xff,
-  0xbf, 0xec, 0xff, 0xff, 0x6a, 0x01, 0x00, 0x00, 0xbb, 0xf3, 0xff, 0xff,
-  0xbc, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0xed, 0xfb, 0xff, 0xff,
-  0x66, 0xf7, 0xff, 0xff, 0xe0, 0xf5, 0xff, 0xff, 0x8f, 0x11, 0x00, 0x00,
-  0x46, 0xfc, 0xff, 0xff, 0x34, 0xf9, 0xff, 0xff, 0x3b, 0xf3, 0xff, 0xff,
-  0x16, 0x04, 0x00, 0x00, 0x79, 0xef, 0xff, 0xff, 0xde, 0x00, 0x00, 0x00,
-  0xf4, 0x06, 0x00, 0x00, 0x69, 0x15, 0x00, 0x00, 0x62, 0x14, 0x00, 0x00,
-  0xac, 0xfd, 0xff, 0xff, 0xac, 0x0d, 0x00, 0x00, 0xb0, 0xed, 0xff, 0xff,
-  0x35, 0x0e, 0x00, 0x00, 0x5f, 0xfa, 0xff, 0xff, 0xa3, 0x11, 0x00, 0x00,
-  0xaa, 0xfa, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00,
-  0x6f, 0xf3, 0xff, 0xff, 0x0f, 0xfa, 0xff, 0xff, 0x34, 0x12, 0x00, 0x00,
-  0xde, 0xf4, 0xff, 0xff, 0x8d, 0xee, 0xff, 0xff, 0x68, 0x08, 0x00, 0x00,
-  0xbc, 0xfd, 0xff, 0xff, 0xde, 0xf9, 0xff, 0xff, 0xca, 0x03, 0x00, 0x00,
-  0x62, 0x16, 0x00, 0x00, 0xfe, 0xf1, 0xff, 0xff, 0x53, 0x18, 0x00, 0x00,
-  0xbd, 0x09, 0x00, 0x00, 0x32, 0x1a, 0x00, 0x00, 0x3d, 0x12, 0x00, 0x00,
-  0x8c, 0xf5, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x5e, 0x0f, 0x00, 0x00,
-  0x5f, 0x08, 0x00, 0x00, 0x09, 0xf9, 0xff, 0xff, 0x59, 0x00, 0x00, 0x00,
-  0xd1, 0xf5, 0xff, 0xff, 0x7b, 0xfb, 0xff, 0xff, 0x97, 0x02, 0x00, 0x00,
-  0xb7, 0x01, 0x00, 0x00, 0x83, 0xf4, 0xff, 0xff, 0x70, 0x17, 0x00, 0x00,
-  0x44, 0x0f, 0x00, 0x00, 0x35, 0xf0, 0xff, 0xff, 0x69, 0xeb, 0xff, 0xff,
-  0x32, 0x14, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x57, 0xf9, 0xff, 0xff,
-  0x6f, 0xff, 0xff, 0xff, 0xbb, 0x08, 0x00, 0x00, 0x26, 0xed, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xcb, 0x4a, 0xdc, 0x37,
-  0xe8, 0x1d, 0x19, 0x41, 0x3e, 0x3d, 0xbb, 0x2c, 0xbb, 0x43, 0xd3, 0xbd,
-  0x4a, 0x3a, 0xfe, 0x23, 0xa2, 0x41, 0x2b, 0xd1, 0xbf, 0xf4, 0x26, 0x1c,
-  0x6a, 0x31, 0xe6, 0x2f, 0x04, 0x44, 0x29, 0x50, 0xbb, 0x24, 0xca, 0x12,
-  0x4d, 0x45, 0xb7, 0x51, 0x51, 0x25, 0xf3, 0xc0, 0x31, 0x7f, 0xf9, 0xd6,
-  0x27, 0xd8, 0x6d, 0x28, 0x11, 0xc9, 0xcd, 0xca, 0x67, 0x3e, 0x0f, 0xe3,
-  0x09, 0xc9, 0x26, 0xdc, 0xc5, 0x02, 0xc1, 0x0a, 0xc4, 0xf6, 0xdc, 0xe0,
-  0x04, 0x40, 0x1f, 0xec, 0xae, 0x45, 0x0c, 0xbd, 0xe2, 0xf5, 0xed, 0xc7,
-  0xd4, 0x33, 0xea, 0xfa, 0xf3, 0x20, 0xc1, 0xc1, 0x2b, 0x1a, 0x27, 0xc3,
-  0x0e, 0xc1, 0xaf, 0x43, 0x4d, 0xdf, 0x81, 0x69, 0x3a, 0x3d, 0x61, 0x04,
-  0xf5, 0xb6, 0xda, 0x1a, 0x3c, 0xe9, 0x01, 0xe7, 0xf7, 0xb3, 0x21, 0x03,
-  0xce, 0x34, 0xdf, 0x02, 0x1d, 0x15, 0x52, 0xd2, 0xee, 0x00, 0xc5, 0x48,
-  0x29, 0x1a, 0xf3, 0xfc, 0xdc, 0xbe, 0xc4, 0xe7, 0xb6, 0xfd, 0xbb, 0xff,
-  0xb7, 0x24, 0xef, 0xdc, 0x2e, 0x36, 0xdc, 0x45, 0x35, 0x3f, 0x23, 0x87,
-  0x23, 0xd6, 0x14, 0xea, 0x44, 0x26, 0xbd, 0x55, 0x17, 0xf8, 0xd1, 0x3b,
-  0x45, 0xe2, 0x4c, 0x04, 0xec, 0xf9, 0xe1, 0xf3, 0xff, 0xd6, 0xcc, 0x81,
-  0x3f, 0x2a, 0x40, 0xef, 0x2d, 0xdd, 0xec, 0xfc, 0x04, 0xf4, 0x62, 0x1c,
-  0x14, 0xe5, 0xc9, 0x57, 0x21, 0xe7, 0x3a, 0xb0, 0x25, 0x0a, 0xe9, 0x74,
-  0xd5, 0xc2, 0x0e, 0xd7, 0x18, 0x28, 0xcc, 0x0f, 0xec, 0x14, 0x07, 0x41,
-  0x18, 0xfa, 0xc0, 0xe5, 0xec, 0xd8, 0x16, 0xac, 0x23, 0xbe, 0xe0, 0x4f,
-  0x3f, 0x28, 0x81, 0xb3, 0x32, 0x23, 0xc3, 0xc7, 0x51, 0xe2, 0xbf, 0x28,
-  0x12, 0x2f, 0x19, 0xb6, 0x35, 0xb1, 0x38, 0xf4, 0xb8, 0xc8, 0x41, 0x49,
-  0x48, 0xcd, 0x42, 0xfa, 0xd1, 0xf8, 0x3c, 0x1d, 0x29, 0x1f, 0x1e, 0xe2,
-  0xea, 0xec, 0x6e, 0xff, 0x15, 0x18, 0x14, 0xf7, 0xbd, 0x47, 0xee, 0x0d,
-  0xc4, 0x13, 0xf9, 0x0a, 0x26, 0xf3, 0x3d, 0xe3, 0xac, 0xdb, 0xe3, 0xbc,
-  0x5f, 0xe9, 0x1b, 0x60, 0x5e, 0x96, 0x81, 0x68, 0xb7, 0xb7, 0x08, 0x71,
-  0x0c, 0x41, 0xfc, 0xe1, 0x2e, 0xfe, 0x1a, 0x4f, 0xfd, 0xa4, 0x29, 0x9f,
-  0xeb, 0x9e, 0xdc, 0x1b, 0xe3, 0xec, 0xbd, 0xcb, 0xec, 0x25, 0x09, 0xe7,
-  0xf1, 0x0d, 0xfd, 0xd6, 0x42, 0x14, 0xc0, 0x09, 0x37, 0xf4, 0x23, 0xdd,
-  0xea, 0x40, 0x7f, 0x0d, 0xb8, 0x02, 0xbd, 0xdc, 0xc3, 0xac, 0xae, 0x4f,
-  0xc7, 0x05, 0x2b, 0x1e, 0x2d, 0xf6, 0x23, 0x30, 0x16, 0x36, 0x2f, 0x4d,
-  0x24, 0xd6, 0xe6, 0x32, 0xc3, 0xd6, 0xed, 0xaf, 0xc6, 0xf6, 0x39, 0x43,
-  0xe8, 0x01, 0xad, 0xff, 0x34, 0x3c, 0xf6, 0xc4, 0xf0, 0xdc, 0x4b, 0x0c,
-  0xac, 0xd5, 0x0c, 0xec, 0x25, 0xfe, 0xba, 0x46, 0xc4, 0xd0, 0xd4, 0x27,
-  0xf6, 0x3c, 0xdb, 0x0e, 0x18, 0xf4, 0xf4, 0xb4, 0x0a, 0x5f, 0xb1, 0xd1,
-  0xe0, 0x35, 0xa0, 0x92, 0x53, 0xe9, 0x28, 0x16, 0x39, 0x26, 0xe0, 0x65,
-  0xba, 0xd5, 0x19, 0x07, 0xeb, 0x30, 0xc3, 0x60, 0xd6, 0x69, 0x1c, 0xd4,
-  0x24, 0x4d, 0x1d, 0x81, 0x36, 0xda, 0x7d, 0x2d, 0xf4, 0x57, 0xda, 0x25,
-  0x0b, 0x0c, 0x00, 0xc4, 0x3a, 0x45, 0xae, 0x73, 0xd6, 0x06, 0x12, 0xd0,
-  0x48, 0x63, 0x33, 0x3f, 0x15, 0xa2, 0x51, 0xfb, 0x2e, 0xb5, 0xe4, 0xa3,
-  0x49, 0x2a, 0x06, 0xa8, 0xfb, 0x5c, 0x26, 0x46, 0x3d, 0x19, 0x17, 0xdd,
-  0xed, 0xc9, 0xe9, 0x0e, 0x14, 0x01, 0x33, 0xd3, 0xb4, 0xb4, 0x38, 0xbd,
-  0x6c, 0x7f, 0xc3, 0x1f, 0x3d, 0xe3, 0x33, 0x32, 0xdd, 0xeb, 0xb7, 0x5a,
-  0xbd, 0xe2, 0xc5, 0xb9, 0xd1, 0xdb, 0x21, 0x31, 0x30, 0x3b, 0xee, 0xb2,
-  0x5b, 0x06, 0x7e, 0xfc, 0x0b, 0xcc, 0xe8, 0xfc, 0x03, 0x65, 0x20, 0x00,
-  0xe1, 0xe1, 0xac, 0x35, 0x4e, 0x3f, 0x0d, 0xc7, 0x40, 0x35, 0xf8, 0xe6,
-  0xe3, 0x21, 0xcf, 0x34, 0x1d, 0x11, 0x81, 0x26, 0x61, 0x3d, 0x99, 0xf3,
-  0xc6, 0xf7, 0x08, 0x37, 0xb8, 0xee, 0xab, 0xe7, 0x47, 0xf8, 0x1a, 0xe6,
-  0x62, 0x8c, 0xea, 0x1d, 0x01, 0xe8, 0x48, 0xc7, 0xd0, 0xfa, 0x0d, 0x1b,
-  0x10, 0x25, 0x30, 0x18, 0x28, 0x05, 0x60, 0x31, 0xfe, 0xf7, 0xc7, 0x23,
-  0xc9, 0x59, 0x73, 0xe1, 0x36, 0xdf, 0xf3, 0x23, 0xda, 0x0a, 0x38, 0x37,
-  0x13, 0xbc, 0xbe, 0x4d, 0xf8, 0xb7, 0x00, 0xf8, 0xfd, 0x1d, 0xcc, 0x31,
-  0xe1, 0x98, 0xcd, 0x7f, 0x24, 0xd9, 0x60, 0x24, 0x34, 0xe8, 0xdb, 0xdc,
-  0xc0, 0x17, 0xcf, 0xef, 0x1c, 0xe9, 0xc1, 0xe3, 0xd9, 0x00, 0xd2, 0xc7,
-  0xe5, 0x5f, 0x15, 0x02, 0xff, 0x9f, 0x2e, 0xe6, 0x2c, 0x4c, 0xbf, 0x99,
-  0xb6, 0x9e, 0xbf, 0xee, 0x2c, 0xe0, 0xc5, 0xae, 0x83, 0xde, 0xb3, 0xda,
-  0x08, 0x21, 0x4f, 0x16, 0xee, 0xb7, 0xa0, 0x1f, 0x2d, 0x40, 0x5b, 0x16,
-  0xd2, 0xa7, 0x7f, 0x34, 0x40, 0x36, 0xd7, 0x07, 0x99, 0xed, 0x38, 0x30,
-  0xec, 0x35, 0xe0, 0x51, 0x4d, 0x1d, 0x38, 0x0e, 0x02, 0x16, 0xa7, 0x30,
-  0x1e, 0xa8, 0x2b, 0x52, 0xc8, 0x24, 0x52, 0x4f, 0xec, 0x21, 0x1e, 0xd3,
-  0xaf, 0x2f, 0x5d, 0x1b, 0x5a, 0x10, 0xe6, 0xfe, 0xcd, 0x23, 0x95, 0x14,
-  0xd6, 0xdd, 0x26, 0x76, 0x42, 0x2c, 0xbd, 0x5e, 0x07, 0xeb, 0xba, 0xb8,
-  0xce, 0xe7, 0xea, 0xb1, 0x10, 0x46, 0xbf, 0x4b, 0x4f, 0x6f, 0xc0, 0x0d,
-  0xab, 0xed, 0x14, 0x24, 0x40, 0xf7, 0x40, 0xb8, 0xdc, 0xd1, 0x31, 0x81,
-  0x0e, 0xbf, 0x4d, 0xcb, 0x3d, 0x30, 0xd2, 0x30, 0xfa, 0xff, 0x05, 0xc4,
-  0x29, 0xf8, 0xce, 0x05, 0x51, 0xfd, 0x7f, 0x49, 0xe5, 0xc6, 0x19, 0xca,
-  0x4d, 0x1b, 0x3a, 0xf0, 0xf9, 0x89, 0xec, 0xee, 0x08, 0x2a, 0x37, 0x98,
-  0x04, 0xda, 0xcd, 0xb1, 0x68, 0xeb, 0xb5, 0x4e, 0x05, 0x3f, 0xcd, 0x58,
-  0x5c, 0xf8, 0xf6, 0x22, 0x46, 0xda, 0xeb, 0x66, 0x2f, 0x0d, 0x8b, 0x3a,
-  0x15, 0xcf, 0xb0, 0x53, 0x48, 0xab, 0x61, 0xb4, 0x89, 0xfe, 0xa5, 0x1a,
-  0x0a, 0xc7, 0xf5, 0xfb, 0xf6, 0xef, 0x29, 0xf2, 0x1a, 0xf8, 0x08, 0x54,
-  0xb9, 0x22, 0xa9, 0xac, 0xcf, 0xeb, 0x62, 0xeb, 0xd5, 0x61, 0x41, 0x7f,
-  0xee, 0xe8, 0xdb, 0xde, 0xb3, 0x9a, 0x0e, 0xf2, 0xcb, 0x0d, 0x55, 0xd9,
-  0x27, 0x0f, 0x45, 0xe7, 0x3c, 0x14, 0x6b, 0x27, 0xc1, 0xce, 0xbd, 0xcc,
-  0xeb, 0x49, 0xf9, 0x49, 0x24, 0xe8, 0xda, 0xde, 0x4a, 0x35, 0x24, 0x40,
-  0xbc, 0x38, 0xed, 0x9d, 0xff, 0x39, 0xeb, 0x1d, 0x3c, 0x05, 0x3c, 0x2f,
-  0x47, 0x3f, 0xf3, 0x15, 0xf1, 0xcc, 0xcc, 0xd0, 0x4b, 0x66, 0x38, 0xc8,
-  0x25, 0x95, 0xb7, 0xea, 0xad, 0x58, 0xf0, 0x09, 0xb6, 0xd6, 0xf7, 0xc1,
-  0x4b, 0xc8, 0xad, 0xa9, 0xad, 0x68, 0xe7, 0x1b, 0xe9, 0x47, 0x8e, 0x36,
-  0xce, 0x35, 0x7e, 0xc9, 0x3d, 0xb3, 0xb0, 0x2f, 0xda, 0x3c, 0x35, 0x87,
-  0x15, 0x10, 0x7f, 0x08, 0xc1, 0xfc, 0xf9, 0x1d, 0xc5, 0xd8, 0x29, 0xf7,
-  0xd3, 0x22, 0xd5, 0x0f, 0xa8, 0xeb, 0x4d, 0x0c, 0xd7, 0x3e, 0xd1, 0x5a,
-  0xc9, 0x33, 0x96, 0x37, 0x48, 0x99, 0xfc, 0xef, 0xc5, 0x20, 0xf5, 0x2f,
-  0x05, 0x1b, 0xd8, 0x89, 0x32, 0xf1, 0x2d, 0xce, 0xc9, 0x38, 0x1f, 0x75,
-  0xb2, 0xb2, 0x81, 0x4c, 0x3a, 0x28, 0xf4, 0xd6, 0x41, 0x10, 0xcb, 0x1a,
-  0x43, 0x46, 0xaf, 0xf6, 0x30, 0x3a, 0xec, 0x96, 0x12, 0xe2, 0x15, 0x50,
-  0x34, 0x9d, 0xc5, 0xe6, 0xd1, 0xec, 0x98, 0xc4, 0x59, 0x5b, 0xdc, 0xdb,
-  0x25, 0xca, 0x1e, 0xb0, 0xdb, 0x19, 0x41, 0xc6, 0x30, 0xe3, 0x55, 0x79,
-  0x98, 0x9f, 0xae, 0xea, 0x9b, 0xc3, 0xfc, 0x48, 0xde, 0x6e, 0x61, 0x19,
-  0x1f, 0xe0, 0xed, 0xaa, 0x7f, 0x6c, 0x31, 0x08, 0xb4, 0x24, 0xaf, 0xc5,
-  0x10, 0xfd, 0x12, 0x12, 0x26, 0x32, 0xf5, 0x06, 0x76, 0x31, 0x0c, 0x72,
-  0x60, 0x1d, 0x3f, 0xf3, 0x3b, 0xd0, 0xca, 0x09, 0x66, 0x12, 0xf9, 0x2c,
-  0xf9, 0xce, 0x23, 0x93, 0xbd, 0x61, 0xd2, 0x5f, 0x26, 0xb7, 0xf6, 0x15,
-  0xa9, 0xdc, 0xe0, 0xed, 0x1e, 0x51, 0x1a, 0x23, 0x05, 0x09, 0xc4, 0x45,
-  0x31, 0x4a, 0xfe, 0xde, 0xb3, 0x4f, 0x54, 0xfe, 0xc9, 0x2f, 0xb4, 0xef,
-  0x0d, 0x98, 0x42, 0x30, 0x63, 0x7f, 0x48, 0x1b, 0x1b, 0x24, 0x15, 0x4d,
-  0xcb, 0xd6, 0xea, 0x39, 0x3e, 0x48, 0xc5, 0xf5, 0xf0, 0xf5, 0xfc, 0x4b,
-  0xa9, 0x13, 0x45, 0x05, 0x53, 0xd7, 0x02, 0xe2, 0xb2, 0x3a, 0x5d, 0x0f,
-  0xb7, 0x0e, 0xdf, 0x2b, 0xc7, 0xe5, 0x15, 0x45, 0x11, 0xad, 0xc7, 0x2f,
-  0xc6, 0xe8, 0xf3, 0xfd, 0xee, 0x2e, 0xcb, 0x07, 0x0f, 0xca, 0xce, 0xaf,
-  0x7f, 0xda, 0x24, 0x2f, 0xec, 0x1d, 0xe5, 0xe6, 0xe1, 0x09, 0xff, 0x34,
-  0x1c, 0x18, 0xf7, 0x12, 0x21, 0x50, 0xb8, 0x4f, 0x39, 0x09, 0xda, 0xb0,
-  0xfb, 0x40, 0x0c, 0x18, 0xd8, 0x1c, 0x86, 0x08, 0xd3, 0xc0, 0xbb, 0x1e,
-  0xc6, 0x58, 0xbd, 0xc4, 0x2d, 0xbb, 0x54, 0xcc, 0x9f, 0x18, 0x39, 0x4a,
-  0x17, 0x20, 0x3b, 0xcb, 0x7f, 0x0d, 0x86, 0x55, 0xab, 0x64, 0xa2, 0xcb,
-  0xb1, 0x2f, 0x4d, 0xd7, 0xfe, 0x00, 0x38, 0xd0, 0xc6, 0x81, 0xf2, 0xf1,
-  0xf1, 0x27, 0xf4, 0x1c, 0xd5, 0x6e, 0x67, 0xb3, 0xb3, 0x07, 0xc9, 0x19,
-  0x51, 0xd7, 0xe7, 0xfd, 0xd5, 0xeb, 0x16, 0x22, 0xf0, 0x49, 0x35, 0xf2,
-  0xfc, 0x45, 0x5c, 0x27, 0xc2, 0xae, 0x4e, 0xf9, 0x34, 0x0c, 0x4a, 0xbb,
-  0x46, 0x39, 0x1e, 0x54, 0xe2, 0x8f, 0x09, 0x9c, 0x3b, 0xaa, 0xf8, 0xd8,
-  0xb1, 0xdd, 0xca, 0x1a, 0xb7, 0x36, 0xcb, 0x81, 0x64, 0xd1, 0xef, 0x15,
-  0x59, 0xa2, 0x01, 0xe9, 0x0d, 0x00, 0x15, 0xda, 0x25, 0xbc, 0xa4, 0x71,
-  0x12, 0x07, 0xaa, 0x60, 0xdd, 0x00, 0x49, 0xb9, 0x9c, 0x61, 0x2a, 0xc9,
-  0x7f, 0x92, 0xe6, 0x04, 0x11, 0xcd, 0xef, 0x92, 0xac, 0xce, 0xff, 0x4b,
-  0xbc, 0xc6, 0x20, 0xe0, 0xbe, 0x32, 0x0e, 0x39, 0xf1, 0xa1, 0xc5, 0xd7,
-  0xeb, 0x7f, 0x8e, 0x3b, 0x15, 0x1a, 0x01, 0xd1, 0xf3, 0x69, 0x1a, 0xfb,
-  0x10, 0xf6, 0xe7, 0x4f, 0xc9, 0xeb, 0xa3, 0xf6, 0x25, 0x70, 0x65, 0xe2,
-  0x30, 0x52, 0x18, 0x25, 0xee, 0xf3, 0xcf, 0x48, 0x4d, 0xc0, 0x07, 0x57,
-  0xd8, 0x42, 0x27, 0x53, 0x3c, 0x06, 0xb9, 0x23, 0x57, 0xfe, 0x57, 0x34,
-  0x08, 0x9b, 0xe0, 0xeb, 0xe5, 0xab, 0xe9, 0xc3, 0xc9, 0xce, 0xff, 0x12,
-  0x4d, 0x37, 0x33, 0x50, 0x1a, 0xae, 0x58, 0x24, 0x60, 0xe1, 0xe8, 0x1f,
-  0xa6, 0xa6, 0xd3, 0x67, 0xeb, 0xf7, 0xb3, 0x1b, 0x0f, 0x34, 0x59, 0xec,
-  0x1a, 0x0d, 0xdb, 0x01, 0x37, 0xd6, 0x04, 0xc7, 0x1c, 0xd6, 0xef, 0x81,
-  0xe1, 0xe9, 0xcf, 0x57, 0x30, 0xb7, 0x4e, 0xae, 0x1a, 0xd9, 0xeb, 0x41,
-  0x52, 0xe4, 0x1c, 0x2c, 0x25, 0xbe, 0x62, 0xc7, 0x4c, 0xff, 0x5a, 0x1e,
-  0x27, 0x81, 0x22, 0x08, 0xe3, 0xd3, 0x99, 0x37, 0xff, 0xe0, 0x4f, 0x4b,
-  0xd6, 0x95, 0xcd, 0xd0, 0xc3, 0x12, 0x8f, 0xe7, 0x18, 0x95, 0x89, 0xfa,
-  0xb7, 0x11, 0x7d, 0x0c, 0x0f, 0x07, 0xc1, 0xb8, 0x45, 0xcc, 0x0a, 0x10,
-  0x60, 0xdd, 0x4f, 0xb7, 0x2d, 0x22, 0xdb, 0x6c, 0xfe, 0xb9, 0xda, 0xf9,
-  0xe4, 0x1a, 0x1d, 0xee, 0xdb, 0x2b, 0x66, 0x03, 0xfd, 0x37, 0xd9, 0xa2,
-  0xce, 0x45, 0x7f, 0x98, 0x46, 0x4f, 0x2a, 0xf9, 0xbc, 0x88, 0xc2, 0xb0,
-  0x95, 0xa8, 0x26, 0x18, 0x0e, 0x27, 0xd2, 0xba, 0xaa, 0x04, 0x04, 0xfa,
-  0x75, 0x44, 0x40, 0x62, 0x22, 0xaa, 0x03, 0xf1, 0x11, 0x1d, 0xaf, 0xde,
-  0xc0, 0x1e, 0x11, 0x3a, 0x0f, 0x16, 0xb6, 0xe6, 0x27, 0xfd, 0xf0, 0xe2,
-  0xf7, 0x2a, 0x6b, 0xe5, 0xed, 0xf9, 0xbd, 0xee, 0xce, 0xfd, 0xfc, 0x25,
-  0x46, 0xf5, 0x3a, 0x09, 0x57, 0x3e, 0xae, 0x8c, 0x25, 0x81, 0xe2, 0x5a,
-  0xed, 0x11, 0x9f, 0xe5, 0xec, 0xf5, 0x5e, 0xac, 0xed, 0xd4, 0x12, 0xa9,
-  0xaf, 0x03, 0xf3, 0xf0, 0x4a, 0xdd, 0xb1, 0xe4, 0xe6, 0x9f, 0x01, 0x65,
-  0x3f, 0x51, 0xd3, 0xc4, 0xed, 0x40, 0x19, 0xd3, 0x0a, 0xa7, 0xe9, 0xc4,
-  0xf2, 0xb2, 0xba, 0x31, 0xef, 0xc2, 0x1b, 0xe1, 0xe5, 0x49, 0x6e, 0xeb,
-  0x19, 0xe1, 0x33, 0xd3, 0xde, 0xdd, 0xfa, 0xed, 0xe9, 0xe5, 0x4e, 0xaa,
-  0x7e, 0xde, 0x12, 0x7e, 0xab, 0xfe, 0xff, 0xec, 0xda, 0x9e, 0x10, 0x52,
-  0xb5, 0x3c, 0xe7, 0x17, 0xc8, 0x25, 0xf6, 0xc4, 0x41, 0xcb, 0x7f, 0xf6,
-  0xc4, 0xca, 0x9f, 0xbf, 0xf2, 0xed, 0xdb, 0x20, 0x26, 0x73, 0xc0, 0x55,
-  0x63, 0x21, 0xbf, 0x5b, 0x77, 0x3f, 0x1a, 0x1f, 0x44, 0x54, 0xb5, 0x45,
-  0xb8, 0x64, 0xf1, 0xc4, 0xd1, 0x2a, 0x7f, 0xfc, 0x49, 0xdd, 0xc7, 0x3a,
-  0x5f, 0x0d, 0x3b, 0x23, 0xd0, 0x1f, 0x0d, 0x7b, 0xfc, 0xa0, 0x0d, 0xc6,
-  0x1f, 0xc0, 0xbd, 0xc1, 0xb8, 0x47, 0xe4, 0x49, 0xa2, 0xae, 0x39, 0xbe,
-  0x54, 0x4e, 0x20, 0xe1, 0x00, 0xb5, 0x17, 0xc3, 0xff, 0x14, 0x32, 0xe7,
-  0xfd, 0x1e, 0xb6, 0x28, 0x49, 0x59, 0xbe, 0x55, 0x01, 0x28, 0x10, 0xad,
-  0xf9, 0x00, 0x0a, 0x12, 0x0f, 0xe6, 0x21, 0x42, 0x93, 0xe2, 0xfe, 0x49,
-  0xe8, 0x4c, 0x48, 0xcd, 0x51, 0xda, 0xb8, 0x93, 0x40, 0xe6, 0x3b, 0xfe,
-  0x22, 0x72, 0xfa, 0x3f, 0xff, 0x99, 0xbb, 0x22, 0x6a, 0xe7, 0xf9, 0x2b,
-  0xe3, 0x21, 0xa2, 0x7f, 0xd8, 0x6b, 0x90, 0x25, 0x18, 0xbb, 0x41, 0x5a,
-  0x4f, 0xfe, 0xb4, 0xdc, 0x55, 0xbb, 0xa5, 0x2d, 0x03, 0x0b, 0x5a, 0x24,
-  0xce, 0xb5, 0x43, 0x4a, 0x01, 0x5c, 0x52, 0xda, 0x45, 0x59, 0x64, 0x3c,
-  0xbd, 0x15, 0x2b, 0x0a, 0xd5, 0xab, 0xcf, 0x54, 0x4c, 0x44, 0xbf, 0xdd,
-  0x12, 0xfa, 0xdc, 0x00, 0xfc, 0x0b, 0x39, 0xfa, 0x17, 0x3f, 0x0c, 0x9b,
-  0x1a, 0x9a, 0x46, 0xa4, 0x30, 0xfd, 0x30, 0x7f, 0x4f, 0x5a, 0xa9, 0xec,
-  0xec, 0xc2, 0x66, 0x6c, 0x06, 0xe0, 0x07, 0xdb, 0xf7, 0xfd, 0xfa, 0xd4,
-  0x5c, 0xe0, 0x48, 0xb7, 0x1b, 0xb2, 0xe1, 0xac, 0xbe, 0x23, 0x46, 0xf8,
-  0x24, 0x43, 0x34, 0x4c, 0x64, 0x2a, 0xc7, 0x05, 0xe1, 0xb1, 0x68, 0x08,
-  0xd7, 0xfe, 0xc5, 0xc3, 0xf6, 0x86, 0xb0, 0x60, 0x2f, 0xcc, 0xd5, 0x13,
-  0xd1, 0x21, 0xc8, 0xab, 0xe7, 0xc9, 0xbc, 0xd2, 0xb1, 0xcc, 0x05, 0x21,
-  0xd5, 0x2b, 0xbd, 0x27, 0x59, 0x01, 0x7d, 0x0d, 0x28, 0xaa, 0xc1, 0x51,
-  0x5d, 0xf6, 0x26, 0x81, 0x37, 0xb2, 0x22, 0xd6, 0x2b, 0xe4, 0x5f, 0xbc,
-  0xe1, 0x70, 0x6b, 0xf1, 0x5d, 0x4e, 0x01, 0x3b, 0xbf, 0x01, 0xa7, 0xf3,
-  0x1b, 0xc1, 0xb9, 0xe3, 0x2b, 0xdc, 0x41, 0x02, 0xca, 0xce, 0xd5, 0x2d,
-  0x53, 0x7f, 0x71, 0xb2, 0xe1, 0xb4, 0x29, 0xa8, 0x1c, 0x22, 0xde, 0xeb,
-  0x5b, 0x6a, 0xf3, 0xe2, 0xd0, 0xa5, 0x3b, 0xd8, 0xf3, 0xd1, 0xc4, 0xa5,
-  0x09, 0x5e, 0x49, 0xc7, 0xbf, 0xd4, 0xed, 0xaf, 0x34, 0xd4, 0x23, 0x9d,
-  0xd5, 0xb6, 0x33, 0xdc, 0x29, 0xc8, 0x3e, 0xcd, 0x1b, 0xd5, 0x3c, 0xeb,
-  0xd3, 0x17, 0x3e, 0x23, 0x27, 0x4d, 0x14, 0x08, 0xf1, 0x52, 0x31, 0xb4,
-  0x04, 0xff, 0xf7, 0xb7, 0xcd, 0x7a, 0x0b, 0xfe, 0xe5, 0xcd, 0xe7, 0xb4,
-  0x49, 0xd7, 0x05, 0xb1, 0xee, 0x28, 0x94, 0x7f, 0x47, 0xbd, 0xc1, 0x32,
-  0xdf, 0x01, 0xf0, 0xe2, 0x12, 0xef, 0xb9, 0xd8, 0x10, 0x2f, 0xf0, 0xef,
-  0xff, 0xb2, 0x56, 0xa8, 0xc4, 0xeb, 0x31, 0xd4, 0xec, 0x03, 0x68, 0x26,
-  0xf0, 0xa9, 0x2c, 0xef, 0xea, 0xf1, 0x4b, 0xad, 0x33, 0x26, 0xbe, 0xd0,
-  0x2d, 0x0d, 0x81, 0x8d, 0xea, 0xf2, 0xa5, 0xbe, 0xd9, 0x39, 0xf7, 0xde,
-  0x2c, 0xf6, 0xec, 0x84, 0xff, 0xf3, 0x05, 0x1e, 0x0f, 0xb5, 0xf7, 0xf4,
-  0xe1, 0xdd, 0x17, 0x34, 0x24, 0x10, 0xe1, 0x66, 0x3f, 0x1f, 0x9d, 0xac,
-  0x44, 0x2b, 0x03, 0xbc, 0x51, 0x31, 0x3c, 0xc4, 0x25, 0x33, 0x28, 0xd8,
-  0xdd, 0x27, 0x07, 0xcf, 0xd5, 0xed, 0xf5, 0x2b, 0xb3, 0xbe, 0x6c, 0x52,
-  0xbb, 0x27, 0x59, 0x08, 0xfb, 0x34, 0x9d, 0x1f, 0x0d, 0xe9, 0x05, 0x44,
-  0x45, 0x24, 0x27, 0x3b, 0xc1, 0x47, 0x18, 0x02, 0x60, 0xf1, 0xbd, 0x0c,
-  0xf8, 0x03, 0xc7, 0x79, 0x25, 0xb8, 0xf1, 0x65, 0xba, 0xd6, 0xd9, 0xb9,
-  0xef, 0xf5, 0xb3, 0x47, 0x31, 0x50, 0xd0, 0xe3, 0xd3, 0x00, 0x7f, 0xd9,
-  0xc4, 0xad, 0xf4, 0x38, 0xf2, 0x33, 0x39, 0x52, 0xb3, 0x23, 0xe1, 0x4e,
-  0xca, 0xfe, 0x16, 0xc9, 0x42, 0x02, 0xff, 0xf3, 0x00, 0x29, 0x31, 0xf4,
-  0x2f, 0xd7, 0xa6, 0x61, 0xcb, 0x59, 0x4f, 0x00, 0xaa, 0xa5, 0xb9, 0xd3,
-  0x3f, 0xf1, 0xcc, 0xf2, 0xf0, 0xd2, 0x81, 0x05, 0xed, 0xc2, 0xd7, 0x77,
-  0x36, 0xeb, 0x20, 0x0f, 0x5d, 0xe7, 0xfa, 0xd0, 0x35, 0x32, 0xdc, 0xac,
-  0xfc, 0xcb, 0xe0, 0x1d, 0x03, 0xe0, 0xd3, 0x50, 0x20, 0x42, 0xc3, 0xe8,
-  0x7c, 0x03, 0x07, 0x0c, 0x32, 0x07, 0xca, 0xbc, 0x4e, 0xd0, 0x3e, 0xe5,
-  0xb5, 0xc0, 0x33, 0xf0, 0xc6, 0xeb, 0x12, 0xf3, 0xc7, 0xdb, 0xbd, 0xb9,
-  0xbc, 0x16, 0x00, 0xe5, 0x37, 0x45, 0xee, 0x0f, 0x14, 0xd3, 0xd6, 0xc4,
-  0x09, 0x33, 0xa2, 0x27, 0x30, 0x28, 0xcf, 0xb9, 0x57, 0x7f, 0x59, 0xba,
-  0xfe, 0x24, 0x13, 0x0c, 0xd3, 0x9e, 0x39, 0x02, 0xcb, 0x15, 0xbc, 0x43,
-  0x20, 0x02, 0x48, 0xc0, 0xf1, 0xf6, 0x22, 0x1d, 0xfa, 0x2c, 0xfc, 0x41,
-  0x30, 0xcd, 0xe2, 0x17, 0x3a, 0xff, 0x4d, 0xef, 0xfc, 0x1b, 0xef, 0x11,
-  0x14, 0x46, 0xd9, 0x38, 0x55, 0xb9, 0xe2, 0xb3, 0xd4, 0xbb, 0xf1, 0x19,
-  0xe3, 0xe9, 0xc8, 0x1b, 0xe5, 0xaf, 0x81, 0x4e, 0x05, 0x09, 0x19, 0xd1,
-  0x37, 0x08, 0xf5, 0xaf, 0xd0, 0xcf, 0xef, 0x02, 0xe3, 0x2a, 0x3e, 0x97,
-  0xe6, 0xd9, 0xd2, 0xd9, 0x06, 0xe8, 0xfb, 0x49, 0x16, 0xc8, 0xfc, 0x07,
-  0x90, 0xe7, 0x7f, 0x40, 0xbd, 0x1e, 0xdd, 0xe1, 0x0a, 0x79, 0x0a, 0xa1,
-  0xbd, 0xbd, 0xf3, 0x48, 0xee, 0x1f, 0xb1, 0x33, 0xfd, 0x16, 0x53, 0xce,
-  0xd2, 0xa9, 0xd3, 0xac, 0xeb, 0x17, 0x13, 0x09, 0x00, 0xa3, 0xe6, 0x5e,
-  0xd9, 0xce, 0x39, 0x29, 0xf8, 0x35, 0x04, 0x43, 0xe9, 0x2a, 0xf8, 0xf9,
-  0xe1, 0x19, 0x50, 0xb1, 0xb0, 0xdf, 0x40, 0xf2, 0x05, 0x91, 0xd6, 0x26,
-  0x1a, 0xf4, 0xc0, 0xe2, 0x25, 0x3e, 0x5e, 0xb1, 0x06, 0x29, 0xb7, 0xc7,
-  0xb0, 0xd7, 0x6e, 0xe3, 0xc5, 0xc4, 0x0a, 0x77, 0x8e, 0xbe, 0x01, 0x81,
-  0x03, 0xa6, 0x2b, 0x2a, 0xfa, 0xef, 0xed, 0x19, 0x38, 0xf3, 0xe3, 0xe5,
-  0x3e, 0x3c, 0x7d, 0xf8, 0x51, 0xca, 0x2a, 0x9b, 0xed, 0x48, 0xe3, 0xf5,
-  0x13, 0xf6, 0xdc, 0x5a, 0x6e, 0x57, 0xce, 0x3c, 0xf8, 0x02, 0x47, 0xe1,
-  0xc3, 0x23, 0x2f, 0xdc, 0x9f, 0xec, 0x4a, 0x0f, 0x2e, 0xe5, 0x6c, 0xf2,
-  0xda, 0x0a, 0xc2, 0x57, 0xeb, 0x71, 0x81, 0x2c, 0xf9, 0xc0, 0xb0, 0xcb,
-  0x3a, 0x3e, 0x3f, 0x97, 0x38, 0x48, 0x11, 0x85, 0xee, 0x37, 0xee, 0x55,
-  0xe8, 0xd0, 0xce, 0x3c, 0x15, 0x10, 0xcd, 0x70, 0xf8, 0xb3, 0x71, 0x78,
-  0x25, 0xd9, 0x51, 0x27, 0x01, 0xda, 0xf2, 0x93, 0x42, 0xaf, 0x14, 0xac,
-  0xf6, 0x24, 0xbf, 0x5b, 0x2d, 0xd1, 0x2b, 0x26, 0x0e, 0xeb, 0xea, 0x2f,
-  0x2d, 0x2f, 0x0a, 0xb7, 0x9a, 0xdc, 0xfd, 0xf4, 0x47, 0xe5, 0x4f, 0xff,
-  0x8b, 0x38, 0x3d, 0x0e, 0xfa, 0xf0, 0xbb, 0xaf, 0x39, 0xe0, 0xab, 0x01,
-  0x38, 0xf2, 0x36, 0xdd, 0xc1, 0x22, 0x4a, 0xf3, 0xd5, 0x08, 0x39, 0xfb,
-  0xcb, 0x14, 0xdb, 0x1d, 0x1a, 0xd9, 0x08, 0x91, 0x2f, 0xef, 0x1e, 0xfe,
-  0xaf, 0x0b, 0x12, 0x7f, 0xde, 0x0d, 0x08, 0x34, 0xe7, 0x03, 0xd5, 0xc2,
-  0xd9, 0x28, 0xf7, 0xfc, 0x0e, 0xc6, 0x0c, 0xed, 0xf5, 0x02, 0xea, 0x19,
-  0xcb, 0x2c, 0x06, 0x3d, 0x1a, 0xf1, 0x11, 0x47, 0xc9, 0x81, 0xfb, 0x23,
-  0xe1, 0xa8, 0x01, 0x1a, 0xbb, 0x05, 0xd8, 0xee, 0xf8, 0x0f, 0xd6, 0x16,
-  0x15, 0xf4, 0x50, 0x22, 0x40, 0xc7, 0xd4, 0xad, 0x00, 0x01, 0x46, 0x1f,
-  0xc4, 0x10, 0xf5, 0x22, 0x4e, 0x0b, 0xd8, 0x67, 0xc9, 0xf4, 0xb7, 0x00,
-  0xce, 0x34, 0x15, 0xfb, 0x35, 0x40, 0x14, 0xf8, 0x4c, 0x09, 0x5a, 0x91,
-  0xb6, 0x66, 0x57, 0xcc, 0x0f, 0x49, 0x34, 0xff, 0xb7, 0xae, 0x2f, 0x5e,
-  0xe8, 0xf5, 0xe2, 0x68, 0x26, 0x48, 0x6d, 0x34, 0xde, 0x7f, 0x07, 0xf1,
-  0x9e, 0xe0, 0xe6, 0x39, 0xe6, 0xe0, 0x42, 0xd7, 0xb5, 0xe6, 0xdd, 0x12,
-  0x10, 0xfd, 0x5c, 0x0a, 0xe2, 0x14, 0x12, 0x44, 0x48, 0xfb, 0xdc, 0x67,
-  0xb4, 0x6a, 0x2a, 0x91, 0xfc, 0xc3, 0xc0, 0x6d, 0xb9, 0x1a, 0xd3, 0xe5,
-  0xb4, 0x11, 0x73, 0x1e, 0xbf, 0xee, 0x9d, 0xc8, 0x48, 0x48, 0x1a, 0xa5,
-  0x3e, 0x81, 0x3d, 0x70, 0xda, 0xc9, 0xab, 0x24, 0x12, 0xf1, 0xa4, 0x7d,
-  0xb4, 0x1d, 0x1b, 0x4c, 0x15, 0xe3, 0xbf, 0xd8, 0xe2, 0xa8, 0x55, 0x30,
-  0xee, 0x1a, 0x71, 0xcc, 0xcd, 0x55, 0x29, 0xd6, 0xbc, 0x0f, 0x03, 0x57,
-  0x30, 0x72, 0x9c, 0x5b, 0xe5, 0xc8, 0x3e, 0x43, 0xbb, 0x58, 0xfe, 0xa4,
-  0xfe, 0xd2, 0x18, 0x4f, 0xd0, 0x17, 0xe3, 0xee, 0x17, 0xd7, 0xd0, 0x0d,
-  0xba, 0xca, 0xd9, 0x44, 0x0b, 0xc7, 0xd8, 0xd6, 0x1f, 0xec, 0xb5, 0xad,
-  0xd9, 0x11, 0xff, 0x28, 0xf7, 0xd0, 0x2e, 0x48, 0xfa, 0x33, 0x3b, 0xc4,
-  0xf4, 0xbe, 0xc9, 0x33, 0x41, 0xc7, 0xec, 0xb7, 0x28, 0x7f, 0x13, 0x0d,
-  0x35, 0x0a, 0x16, 0x44, 0x0a, 0x1c, 0x5c, 0x2b, 0x1c, 0x5c, 0xe3, 0xe9,
-  0xf6, 0xe5, 0xcd, 0x03, 0xec, 0xf3, 0xf5, 0xf7, 0x3c, 0x22, 0x26, 0x4e,
-  0xe0, 0xa3, 0x61, 0x03, 0xfd, 0x4d, 0x44, 0xa9, 0x52, 0xf6, 0x60, 0x76,
-  0x9b, 0x81, 0x0b, 0xfd, 0xde, 0xf7, 0x9b, 0x4e, 0x15, 0x1f, 0xf6, 0xc4,
-  0x42, 0x98, 0x0d, 0x9e, 0xea, 0xbc, 0xef, 0x64, 0x9f, 0xe1, 0x12, 0xe5,
-  0xfd, 0xd1, 0x0e, 0x4c, 0x3f, 0xe2, 0x21, 0x38, 0xcd, 0x5f, 0x2d, 0x2f,
-  0xc2, 0x4b, 0x1a, 0xc8, 0x5a, 0xe2, 0x3a, 0xb5, 0x7f, 0x20, 0xbf, 0x6d,
-  0xc5, 0x00, 0xb8, 0x2b, 0x37, 0xe3, 0xa4, 0x26, 0x0e, 0xbb, 0x12, 0xdb,
-  0x19, 0xff, 0x01, 0xb6, 0xc6, 0x7c, 0xd7, 0x59, 0x46, 0xcd, 0x6f, 0xe1,
-  0x44, 0xe8, 0x55, 0x38, 0xb0, 0x3d, 0xbb, 0x0f, 0x1d, 0xa9, 0x0f, 0xc8,
-  0xac, 0xde, 0x0d, 0x21, 0x72, 0x0d, 0x60, 0xd0, 0xe2, 0xb1, 0xb2, 0x36,
-  0xee, 0x4c, 0x0c, 0xdd, 0x1b, 0xbc, 0x07, 0x4a, 0xa7, 0xd2, 0x21, 0xf7,
-  0xaf, 0x5b, 0x27, 0xd6, 0xf7, 0x32, 0x7f, 0xbc, 0x3e, 0xe8, 0xcd, 0x26,
-  0x04, 0x57, 0xef, 0xde, 0xe0, 0xfb, 0x6b, 0x63, 0x29, 0xe7, 0x1d, 0x5f,
-  0x2d, 0xa6, 0xfb, 0x79, 0x8c, 0x26, 0xb2, 0x10, 0xea, 0x53, 0x15, 0xa1,
-  0xe6, 0xe5, 0x00, 0xdd, 0x5d, 0xf3, 0xf3, 0x03, 0x17, 0x13, 0x4b, 0xe4,
-  0x00, 0x97, 0x98, 0x7f, 0x3a, 0x32, 0x95, 0x07, 0x2a, 0x0b, 0xc5, 0xf7,
-  0xb6, 0xc1, 0xb4, 0xc2, 0xd3, 0x30, 0xef, 0xfd, 0x43, 0xd6, 0x00, 0x35,
-  0x15, 0xb7, 0xff, 0x19, 0xdb, 0xd2, 0x1f, 0x0c, 0xa5, 0x18, 0x23, 0xdf,
-  0x4c, 0xd4, 0x0e, 0xf1, 0x32, 0xcf, 0xaf, 0x46, 0xcb, 0x7f, 0x4d, 0x5c,
-  0xd7, 0xb0, 0xbc, 0xee, 0x02, 0x0d, 0x3d, 0x4d, 0xad, 0xe1, 0xdb, 0x05,
-  0x41, 0x48, 0x10, 0xab, 0x13, 0xf8, 0x22, 0x39, 0x1e, 0x54, 0x09, 0x5c,
-  0x3a, 0x69, 0x49, 0x2e, 0xf2, 0xb5, 0xfd, 0x49, 0x24, 0x1f, 0x32, 0xc3,
-  0xa6, 0xda, 0x5f, 0xc7, 0xed, 0xc2, 0xd4, 0xac, 0xc4, 0x6f, 0x71, 0x81,
-  0xec, 0x19, 0xda, 0x76, 0x2d, 0xf1, 0x07, 0x09, 0xdf, 0x8d, 0x11, 0x52,
-  0xd6, 0x18, 0xf0, 0xc5, 0x3e, 0x1a, 0xdf, 0x3d, 0x36, 0xb7, 0x14, 0x2d,
-  0x04, 0xea, 0xea, 0x40, 0x0e, 0x32, 0xbc, 0x36, 0x22, 0x43, 0xdf, 0x53,
-  0x4c, 0xbb, 0x41, 0xe4, 0xfc, 0xff, 0x35, 0x2c, 0xc9, 0xc5, 0x7f, 0x5f,
-  0xd0, 0x10, 0xa1, 0xfd, 0x9e, 0xf7, 0xf9, 0xab, 0xd6, 0x50, 0x49, 0x72,
-  0xe3, 0x57, 0x14, 0xbf, 0xcb, 0xc6, 0xbf, 0xd1, 0xc9, 0x7b, 0xa3, 0xc9,
-  0x47, 0x09, 0x5c, 0xbd, 0xc6, 0xd0, 0xe9, 0xa4, 0x2c, 0x55, 0x8a, 0x5e,
-  0xf6, 0xef, 0xfa, 0xf3, 0x0d, 0x0f, 0x62, 0xd9, 0x37, 0xc8, 0xb0, 0x39,
-  0x92, 0x1c, 0xff, 0x94, 0x28, 0xf3, 0xe6, 0xa9, 0x13, 0xcd, 0xae, 0x6a,
-  0x1e, 0x07, 0xfa, 0x28, 0x4d, 0xfd, 0xec, 0x6f, 0xd3, 0xbb, 0x05, 0xef,
-  0xce, 0xc9, 0x5b, 0xfc, 0xfc, 0xe6, 0xba, 0xec, 0xd0, 0xfc, 0xeb, 0xb1,
-  0xc7, 0x38, 0xfa, 0xd6, 0x2b, 0xe9, 0x37, 0xc7, 0xcc, 0x23, 0xad, 0xc5,
-  0x2c, 0xf7, 0x16, 0x3c, 0x3c, 0x42, 0x8d, 0x27, 0x1d, 0xbf, 0xe1, 0x0b,
-  0x2c, 0xda, 0x02, 0x32, 0xbd, 0xe3, 0xe0, 0x81, 0xd8, 0xb3, 0x6a, 0xce,
-  0xfd, 0x29, 0xbb, 0x4e, 0xaa, 0xd7, 0x2d, 0xea, 0x56, 0x2a, 0x2e, 0x7f,
-  0x23, 0xf8, 0xa9, 0xf0, 0x23, 0x15, 0xc5, 0x48, 0x31, 0xa4, 0x1b, 0x68,
-  0xa8, 0xe1, 0x34, 0xf1, 0xc4, 0x47, 0xcd, 0xb2, 0xce, 0x4a, 0x1f, 0xec,
-  0x3d, 0xe5, 0xef, 0xbc, 0xf0, 0xd7, 0xb1, 0xec, 0x09, 0x12, 0x0e, 0x33,
-  0x50, 0xdf, 0x45, 0x36, 0x66, 0x4e, 0xd8, 0x17, 0xab, 0x0e, 0xe0, 0x20,
-  0xb3, 0xd2, 0x1c, 0x4a, 0xc2, 0x3f, 0xbd, 0x31, 0xae, 0x07, 0x6c, 0x0d,
-  0x04, 0xca, 0xfe, 0x1d, 0x25, 0x33, 0x35, 0xdb, 0x05, 0xde, 0xf0, 0x28,
-  0xcc, 0x40, 0xd1, 0xa0, 0x33, 0xb6, 0x30, 0xf7, 0xc7, 0xe5, 0x4f, 0x03,
-  0xfa, 0xc7, 0xd1, 0x33, 0xf3, 0x21, 0xb0, 0x39, 0x2b, 0xd2, 0x15, 0x7f,
-  0x45, 0x1f, 0x91, 0xe7, 0xee, 0xc9, 0xe7, 0xcb, 0x45, 0xc8, 0xec, 0x3e,
-  0xd6, 0x26, 0x03, 0x04, 0x60, 0x92, 0xd8, 0xc7, 0xd7, 0x27, 0xd4, 0xf0,
-  0xbb, 0x8a, 0x2a, 0x46, 0x0c, 0x67, 0xae, 0xf9, 0x4f, 0xb7, 0x12, 0x89,
-  0xa5, 0x49, 0xad, 0x35, 0x43, 0xb3, 0x62, 0xfa, 0xd0, 0x09, 0x37, 0x31,
-  0xbf, 0x11, 0xcd, 0x66, 0x98, 0x25, 0x52, 0x06, 0x48, 0x7f, 0xd7, 0x2b,
-  0x2f, 0x9b, 0xec, 0xca, 0x36, 0xde, 0x2c, 0x33, 0x33, 0x03, 0xa6, 0x10,
-  0x54, 0xe5, 0xf8, 0x3a, 0x15, 0x29, 0xb9, 0x17, 0x2b, 0x13, 0xb8, 0x49,
-  0x41, 0x67, 0xc1, 0x06, 0x98, 0xb4, 0xa6, 0x45, 0x09, 0x53, 0xf4, 0xf0,
-  0xa6, 0x9e, 0x81, 0x2f, 0xd4, 0x4b, 0x25, 0xe2, 0xbc, 0xc1, 0x1e, 0xc7,
-  0xeb, 0xbc, 0x18, 0xae, 0xd7, 0x64, 0xcc, 0x21, 0x63, 0x60, 0xab, 0x59,
-  0x5d, 0x4d, 0xaa, 0xae, 0x12, 0xc1, 0x27, 0xe1, 0x34, 0x05, 0xa0, 0xc1,
-  0x64, 0x34, 0xe7, 0xb4, 0x46, 0x60, 0xe1, 0x3f, 0x1b, 0x2d, 0x3b, 0x37,
-  0xa3, 0xc0, 0x3d, 0x3a, 0x51, 0x47, 0xce, 0xe4, 0xdd, 0xdc, 0xf4, 0x69,
-  0xf3, 0xa3, 0x36, 0x33, 0x08, 0x11, 0xd9, 0x56, 0x00, 0x63, 0xd5, 0x56,
-  0xe4, 0x18, 0x25, 0xe0, 0xe5, 0xa8, 0xe8, 0x3a, 0x24, 0x5e, 0xd1, 0xba,
-  0x28, 0x46, 0x26, 0xfa, 0xd0, 0xff, 0x07, 0x5e, 0x24, 0xeb, 0x6a, 0xf3,
-  0xa3, 0xf8, 0x1e, 0x08, 0x8f, 0x17, 0x88, 0x93, 0x67, 0x67, 0x04, 0x3a,
-  0xde, 0xae, 0x81, 0xf4, 0x05, 0xe0, 0xe6, 0xec, 0x23, 0x61, 0x0b, 0x41,
-  0xfe, 0xe3, 0xcd, 0x33, 0x7f, 0x40, 0xfc, 0xef, 0x01, 0x40, 0xdc, 0x15,
-  0xb8, 0xd6, 0xfa, 0xdc, 0x93, 0xf5, 0x48, 0x16, 0x89, 0x27, 0xd0, 0xdb,
-  0x01, 0x3b, 0xe9, 0xa5, 0x45, 0xfd, 0xfe, 0x1b, 0x3d, 0x39, 0xe3, 0xa8,
-  0xcd, 0xf5, 0xd1, 0x1d, 0xd7, 0xe9, 0x30, 0x37, 0x9b, 0xb2, 0xd5, 0x50,
-  0x56, 0x57, 0x2d, 0xf6, 0x16, 0xcd, 0x0d, 0x03, 0xb2, 0xe0, 0x33, 0x4c,
-  0x3f, 0xdf, 0xf6, 0x31, 0x56, 0x36, 0xec, 0x8c, 0x3e, 0x61, 0xc8, 0x9c,
-  0x27, 0x08, 0xff, 0x1a, 0x89, 0xf5, 0xf5, 0x69, 0xe6, 0x00, 0x35, 0x00,
-  0xe3, 0xb4, 0x1f, 0x67, 0x37, 0x11, 0x3c, 0x3c, 0x2a, 0xc7, 0x1f, 0x34,
-  0x09, 0x7f, 0xb7, 0x96, 0xf4, 0xc3, 0x63, 0x0a, 0x0f, 0xad, 0x20, 0xbc,
-  0xc6, 0xe4, 0x27, 0x25, 0x37, 0x51, 0x75, 0x3d, 0xcd, 0x93, 0xb9, 0x64,
-  0x6a, 0xfb, 0xde, 0x7a, 0x1c, 0x14, 0x47, 0xcb, 0x3a, 0xee, 0x33, 0x04,
-  0x17, 0x53, 0x28, 0xec, 0xf4, 0x5e, 0x76, 0x0a, 0xd6, 0xa0, 0xe5, 0x9f,
-  0x95, 0xdb, 0x1c, 0xde, 0x46, 0xbd, 0x56, 0x5a, 0x81, 0x84, 0x18, 0x49,
-  0x92, 0x23, 0xd2, 0x4d, 0xe5, 0x26, 0x00, 0xce, 0x07, 0x9f, 0x01, 0xd2,
-  0x7b, 0x2e, 0x55, 0xf8, 0x8b, 0xd0, 0x8a, 0xaf, 0xa6, 0x28, 0x2a, 0x45,
-  0xac, 0x35, 0xe2, 0xf2, 0x38, 0xed, 0xb1, 0x60, 0x54, 0x08, 0x32, 0x42,
-  0x42, 0x0a, 0x24, 0xe8, 0x09, 0xbd, 0xfb, 0x22, 0xa7, 0xc2, 0x59, 0x1c,
-  0xd9, 0x09, 0x19, 0xe3, 0x20, 0x25, 0x3f, 0x81, 0xdb, 0xba, 0x1e, 0x20,
-  0xf1, 0x2a, 0x03, 0x37, 0xb1, 0xc8, 0x09, 0x02, 0x48, 0xb0, 0xd2, 0xa6,
-  0x40, 0x13, 0xca, 0x31, 0x4a, 0xf0, 0x10, 0x51, 0x29, 0xe7, 0xfa, 0xb8,
-  0x3d, 0x12, 0xc2, 0x28, 0xdd, 0xc8, 0xc4, 0x38, 0x20, 0xbf, 0x27, 0xa9,
-  0x12, 0xf4, 0xbd, 0x21, 0xfd, 0x2c, 0xe4, 0x94, 0xfd, 0xc0, 0x18, 0xf3,
-  0x24, 0xb7, 0x2a, 0xa1, 0x85, 0x56, 0x3d, 0x0e, 0x29, 0xb6, 0x64, 0x6f,
-  0x16, 0xee, 0x10, 0xbb, 0x29, 0x37, 0x35, 0x1a, 0x3f, 0xd2, 0xd3, 0x0f,
-  0xdb, 0x08, 0xca, 0x3a, 0x9d, 0x0e, 0x28, 0x2d, 0xdc, 0x02, 0x69, 0x3c,
-  0x8a, 0xa8, 0xc3, 0xd3, 0x07, 0x7f, 0xdf, 0x96, 0xa9, 0xac, 0x46, 0x47,
-  0xc0, 0x50, 0x1d, 0xf7, 0xeb, 0x43, 0xb7, 0x42, 0xc6, 0xd4, 0xd0, 0xf0,
-  0x02, 0x1c, 0xa8, 0xd0, 0x23, 0xb8, 0xf9, 0x56, 0xf8, 0xaa, 0x4e, 0xb2,
-  0x65, 0x10, 0x31, 0x1e, 0xb8, 0x4c, 0x5d, 0xed, 0xf9, 0x05, 0xa2, 0x39,
-  0xf1, 0xac, 0xa9, 0x03, 0xba, 0x0e, 0x0a, 0xe5, 0x32, 0x1b, 0xbc, 0x91,
-  0x7f, 0xb2, 0x7d, 0x55, 0x4d, 0x01, 0xa2, 0xa2, 0x95, 0xf9, 0xeb, 0xc6,
-  0x64, 0x44, 0x31, 0x3c, 0x07, 0x23, 0x48, 0x2e, 0x72, 0xe4, 0x56, 0x99,
-  0x32, 0xfd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x69, 0xee, 0xff, 0xff, 0xb1, 0x0a, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
-  0x9f, 0x03, 0x00, 0x00, 0xd4, 0xfb, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xff,
-  0x8c, 0xfe, 0xff, 0xff, 0xd3, 0xee, 0xff, 0xff, 0x36, 0xfe, 0xff, 0xff,
-  0x08, 0xfd, 0xff, 0xff, 0x64, 0xfe, 0xff, 0xff, 0xf9, 0xfc, 0xff, 0xff,
-  0x1f, 0xf8, 0xff, 0xff, 0x95, 0xf7, 0xff, 0xff, 0x0a, 0x06, 0x00, 0x00,
-  0xf1, 0x08, 0x00, 0x00, 0x59, 0xf7, 0xff, 0xff, 0x7b, 0xe9, 0xff, 0xff,
-  0x49, 0x02, 0x00, 0x00, 0x36, 0x05, 0x00, 0x00, 0x54, 0x0a, 0x00, 0x00,
-  0x3f, 0xf2, 0xff, 0xff, 0x5a, 0x01, 0x00, 0x00, 0xf2, 0x07, 0x00, 0x00,
-  0x7b, 0x03, 0x00, 0x00, 0x74, 0x17, 0x00, 0x00, 0x43, 0xfa, 0xff, 0xff,
-  0x94, 0xf2, 0xff, 0xff, 0x9b, 0xf9, 0xff, 0xff, 0xfe, 0xf1, 0xff, 0xff,
-  0xe7, 0x11, 0x00, 0x00, 0x65, 0x09, 0x00, 0x00, 0xc4, 0x0b, 0x00, 0x00,
-  0xdd, 0x10, 0x00, 0x00, 0x0c, 0xf7, 0xff, 0xff, 0xb5, 0x02, 0x00, 0x00,
-  0x6f, 0x03, 0x00, 0x00, 0xbc, 0x0d, 0x00, 0x00, 0xa9, 0x09, 0x00, 0x00,
-  0xf8, 0xf9, 0xff, 0xff, 0x4e, 0xf8, 0xff, 0xff, 0x96, 0xf4, 0xff, 0xff,
-  0x7f, 0x01, 0x00, 0x00, 0xfe, 0xe1, 0xff, 0xff, 0x75, 0xff, 0xff, 0xff,
-  0x80, 0xfb, 0xff, 0xff, 0x3b, 0xfd, 0xff, 0xff, 0xee, 0xf7, 0xff, 0xff,
-  0xdc, 0xf8, 0xff, 0xff, 0x12, 0xf2, 0xff, 0xff, 0xbc, 0xf7, 0xff, 0xff,
-  0x22, 0x12, 0x00, 0x00, 0x4e, 0x10, 0x00, 0x00, 0x59, 0xf0, 0xff, 0xff,
-  0x30, 0x06, 0x00, 0x00, 0xda, 0xed, 0xff, 0xff, 0x05, 0x07, 0x00, 0x00,
-  0xd3, 0xfb, 0xff, 0xff, 0xa9, 0xf5, 0xff, 0xff, 0xdb, 0xdf, 0xff, 0xff,
-  0x4c, 0xfd, 0xff, 0xff, 0xe6, 0x01, 0x00, 0x00, 0x61, 0xf5, 0xff, 0xff,
-  0xf3, 0x04, 0x00, 0x00, 0x3e, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0x00, 0x00, 0x00, 0x41, 0xd1, 0xf1, 0x27, 0x8a, 0x9e, 0x33, 0x41,
-  0xc7, 0xb9, 0x28, 0xe1, 0xb9, 0xac, 0x02, 0xd5, 0xc1, 0x52, 0xd9, 0x2f,
-  0xbc, 0x44, 0xf2, 0xab, 0x84, 0x97, 0x81, 0xd8, 0xeb, 0x11, 0xe5, 0xf0,
-  0x31, 0xf1, 0xe4, 0xac, 0x51, 0xd7, 0xe8, 0xa7, 0x36, 0x30, 0xc3, 0xd4,
-  0x9b, 0x37, 0xcd, 0x48, 0xc9, 0x1f, 0xbc, 0xe6, 0x2b, 0x1d, 0xbf, 0x30,
-  0x3a, 0x4a, 0x11, 0xf6, 0xa3, 0xcb, 0x37, 0x0d, 0x02, 0xe2, 0x95, 0x9a,
-  0xf3, 0xe8, 0x9c, 0xb5, 0xfd, 0x2a, 0x37, 0xf3, 0xda, 0x49, 0xa4, 0x91,
-  0x43, 0x0a, 0x54, 0x22, 0x58, 0x23, 0xb2, 0xeb, 0x53, 0xca, 0x57, 0x31,
-  0xb6, 0xb6, 0xeb, 0xa0, 0x25, 0xf2, 0x95, 0xb3, 0xb6, 0xd3, 0x09, 0x4b,
-  0xfd, 0x11, 0x48, 0xde, 0xd5, 0xba, 0x5d, 0xa5, 0x15, 0x22, 0xfc, 0xc2,
-  0xab, 0xc5, 0xf2, 0x2a, 0xcd, 0xc7, 0xdf, 0xf9, 0x44, 0x13, 0x24, 0x52,
-  0xc7, 0x60, 0xfd, 0x3a, 0x5a, 0xc5, 0x3d, 0xf6, 0x2d, 0x63, 0x35, 0x33,
-  0x3a, 0xc5, 0x6d, 0x38, 0xc4, 0x0e, 0x05, 0x0b, 0x16, 0xdc, 0x4e, 0x42,
-  0x28, 0x5d, 0xe6, 0xc6, 0x67, 0x4d, 0x6b, 0xf3, 0x6e, 0x5c, 0x69, 0x68,
-  0xe9, 0x5d, 0x35, 0xf6, 0x66, 0xb2, 0xe7, 0xb8, 0xc8, 0x03, 0x0d, 0xfd,
-  0xec, 0xfa, 0x16, 0x6e, 0x31, 0xfd, 0x43, 0xbb, 0x03, 0xd9, 0xc4, 0xbb,
-  0xb3, 0x72, 0xf2, 0x01, 0x0a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x11, 0xfe, 0xff, 0xff, 0x90, 0xfe, 0xff, 0xff,
-  0xbe, 0x01, 0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-  0x36, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x84, 0xa8, 0xff, 0xff, 0x88, 0xa8, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e,
-  0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00,
-  0xf8, 0x03, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xb8, 0x03, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
-  0xa0, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00,
-  0xc8, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
-  0xf0, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0xff, 0xff,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
-  0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0x1e, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x68, 0xa9, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf6, 0xfc, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x72, 0xfd, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xc2, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x68, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x4a, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf0, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x8e, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xe2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x5a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x2c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x28, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x80, 0x53, 0x00, 0x00,
-  0x14, 0x53, 0x00, 0x00, 0xa8, 0x52, 0x00, 0x00, 0x38, 0x52, 0x00, 0x00,
-  0xd4, 0x51, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x9c, 0x4a, 0x00, 0x00,
-  0x90, 0x46, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x88, 0x3e, 0x00, 0x00,
-  0x24, 0x3b, 0x00, 0x00, 0x18, 0x37, 0x00, 0x00, 0x10, 0x33, 0x00, 0x00,
-  0x20, 0x2f, 0x00, 0x00, 0xbc, 0x2b, 0x00, 0x00, 0xb0, 0x27, 0x00, 0x00,
-  0xa8, 0x23, 0x00, 0x00, 0xb8, 0x1f, 0x00, 0x00, 0x54, 0x1c, 0x00, 0x00,
-  0x50, 0x18, 0x00, 0x00, 0x48, 0x14, 0x00, 0x00, 0x68, 0x10, 0x00, 0x00,
-  0x04, 0x0d, 0x00, 0x00, 0x78, 0x0c, 0x00, 0x00, 0x64, 0x0b, 0x00, 0x00,
-  0x28, 0x0a, 0x00, 0x00, 0x0c, 0x09, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00,
-  0xb4, 0x06, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00,
-  0x20, 0x03, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
-  0x0c, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x2a, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x14, 0xad, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x3b, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0xa2, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x8c, 0xad, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf1, 0x48, 0x79, 0x3d, 0x26, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x2a, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-  0x14, 0xae, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0xe6, 0xa7, 0x36, 0x3d, 0x1a, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xa2, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x94, 0xae, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xe6, 0xa7, 0x36, 0x3d, 0x1f, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67,
-  0x65, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x2f,
-  0x41, 0x76, 0x67, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x32, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0xaf, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xe6, 0xa7, 0x36, 0x3d, 0x93, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x32, 0xb0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x24, 0xb0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x0c, 0x82, 0x3d, 0x3d, 0xca, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x37, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6a, 0xb1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x5c, 0xb1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x10, 0x3c, 0x3d, 0xa9, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x36, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x82, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x74, 0xb2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x94, 0xfa, 0x63, 0x3d,
-  0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x35, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x35, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xba, 0xb3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xac, 0xb3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x89, 0x79, 0x45, 0x3d,
-  0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x34, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x34, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xd2, 0xb4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc4, 0xb4, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x81, 0x18, 0x4d, 0x3d, 0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x0a, 0xb6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xfc, 0xb5, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xe2, 0x52, 0x09, 0x3d, 0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x22, 0xb7, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x14, 0xb7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x7f, 0x1a, 0x3d,
-  0xc4, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34,
-  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5a, 0xb8, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xe0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x4c, 0xb8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf6, 0x48, 0xfd, 0x3c,
-  0x9f, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72,
-  0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x6a, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5c, 0xb9, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x46, 0x5c, 0xc8, 0x3d, 0x18, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5a, 0xba, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00,
-  0xcc, 0xb9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6d, 0x58, 0x88, 0x39,
-  0xb4, 0x17, 0x02, 0x3a, 0x86, 0xc1, 0x64, 0x3a, 0x44, 0x69, 0x65, 0x39,
-  0x92, 0xc7, 0x53, 0x3a, 0xb2, 0xcd, 0x04, 0x3a, 0xda, 0xa5, 0xeb, 0x39,
-  0x3a, 0x38, 0x91, 0x39, 0x3f, 0x00, 0x8f, 0x39, 0x95, 0xc9, 0x21, 0x3a,
-  0x48, 0x5c, 0x54, 0x39, 0x3e, 0xf6, 0xc6, 0x39, 0xa3, 0xa5, 0x46, 0x3a,
-  0x7a, 0x56, 0x22, 0x3a, 0xb2, 0x3e, 0xcf, 0x39, 0xa4, 0x5a, 0x5a, 0x39,
-  0x3e, 0x27, 0x13, 0x3a, 0x23, 0x40, 0xd4, 0x39, 0x67, 0x23, 0x3a, 0x3a,
-  0xce, 0x56, 0x0d, 0x3a, 0x3b, 0x1b, 0x9c, 0x39, 0x0c, 0x17, 0x8a, 0x39,
-  0x1f, 0x93, 0x40, 0x3a, 0x9f, 0x1f, 0x49, 0x3a, 0xec, 0x94, 0x3e, 0x3a,
-  0xed, 0x22, 0xbf, 0x39, 0x0b, 0xdc, 0x67, 0x3a, 0x90, 0x70, 0xd5, 0x39,
-  0x77, 0xa9, 0x1a, 0x3a, 0xeb, 0x24, 0xbc, 0x39, 0x9c, 0x35, 0xb9, 0x39,
-  0x85, 0xbc, 0xcc, 0x39, 0xcb, 0x2f, 0x47, 0x3a, 0xce, 0xb2, 0x91, 0x39,
-  0x10, 0x88, 0x41, 0x3a, 0xac, 0xcb, 0x57, 0x3a, 0xd5, 0xde, 0x93, 0x39,
-  0xcf, 0x84, 0x88, 0x39, 0xf2, 0x81, 0x4e, 0x39, 0x52, 0xfc, 0x41, 0x39,
-  0x0a, 0x6e, 0x23, 0x3a, 0xbc, 0xea, 0x9b, 0x39, 0xdf, 0xc6, 0xb6, 0x39,
-  0x56, 0xc4, 0xaf, 0x39, 0xaf, 0xfe, 0x4b, 0x39, 0x29, 0x95, 0x92, 0x39,
-  0xa2, 0x64, 0xef, 0x39, 0x92, 0x75, 0x79, 0x39, 0xf8, 0x57, 0x99, 0x39,
-  0x74, 0x84, 0xfd, 0x39, 0x6e, 0x21, 0xe1, 0x39, 0x87, 0xf4, 0x62, 0x39,
-  0x41, 0x2d, 0xa2, 0x39, 0xda, 0xa0, 0x6b, 0x39, 0x90, 0x13, 0xf3, 0x39,
-  0xd2, 0xda, 0xce, 0x39, 0x56, 0xc4, 0xde, 0x39, 0x66, 0xe5, 0x62, 0x39,
-  0x51, 0x35, 0x17, 0x3a, 0x63, 0xa5, 0x20, 0x3a, 0x26, 0x63, 0x19, 0x3a,
-  0x5b, 0x31, 0x01, 0x3a, 0xcf, 0x79, 0x32, 0x39, 0x2d, 0xa7, 0x70, 0x39,
-  0x13, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0x03, 0x00, 0x00,
-  0x2c, 0xbd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x74, 0x6c, 0xd5, 0x37, 0xd1, 0xa2, 0x4b, 0x38,
-  0xa5, 0x09, 0xb3, 0x38, 0xee, 0x8c, 0xb3, 0x37, 0x40, 0xc0, 0xa5, 0x38,
-  0x23, 0xe1, 0x4f, 0x38, 0x82, 0x6e, 0x38, 0x38, 0x8a, 0x50, 0xe3, 0x37,
-  0x79, 0xd7, 0xdf, 0x37, 0x9a, 0x3f, 0x7d, 0x38, 0xa3, 0x34, 0xa6, 0x37,
-  0x17, 0xb8, 0x1b, 0x38, 0x01, 0x79, 0x9b, 0x38, 0x26, 0x1c, 0x7e, 0x38,
-  0xae, 0x33, 0x22, 0x38, 0x84, 0xe5, 0xaa, 0x37, 0x66, 0x57, 0x66, 0x38,
-  0x9c, 0x1e, 0x26, 0x38, 0xc0, 0xae, 0x91, 0x38, 0x86, 0x3d, 0x5d, 0x38,
-  0x15, 0x5b, 0xf4, 0x37, 0x8f, 0x27, 0xd8, 0x37, 0x5a, 0xb8, 0x96, 0x38,
-  0x33, 0x69, 0x9d, 0x38, 0x0a, 0x29, 0x95, 0x38, 0x2e, 0x98, 0x15, 0x38,
-  0x7b, 0x77, 0xb5, 0x38, 0xdf, 0x0c, 0x27, 0x38, 0x48, 0x18, 0x72, 0x38,
-  0xa8, 0x40, 0x13, 0x38, 0xa4, 0xf4, 0x10, 0x38, 0x14, 0x3d, 0x20, 0x38,
-  0x22, 0xe5, 0x9b, 0x38, 0x6a, 0x10, 0xe4, 0x37, 0x0e, 0x78, 0x97, 0x38,
-  0xe7, 0xe4, 0xa8, 0x38, 0xc6, 0x76, 0xe7, 0x37, 0xee, 0xb1, 0xd5, 0x37,
-  0xf4, 0x9f, 0xa1, 0x37, 0x0c, 0xd3, 0x97, 0x37, 0xc0, 0xd1, 0x7f, 0x38,
-  0x2c, 0x0f, 0xf4, 0x37, 0x40, 0x0d, 0x0f, 0x38, 0xbe, 0x90, 0x09, 0x38,
-  0x80, 0xa8, 0x9f, 0x37, 0xbb, 0x72, 0xe5, 0x37, 0xe8, 0x5c, 0x3b, 0x38,
-  0xc5, 0x3d, 0xc3, 0x37, 0xff, 0x07, 0xf0, 0x37, 0xdc, 0x6a, 0x46, 0x38,
-  0x44, 0x33, 0x30, 0x38, 0xd7, 0xa0, 0xb1, 0x37, 0x9f, 0xdb, 0xfd, 0x37,
-  0x99, 0x6a, 0xb8, 0x37, 0xe6, 0x3e, 0x3e, 0x38, 0x83, 0xe5, 0x21, 0x38,
-  0xaf, 0x59, 0x2e, 0x38, 0x00, 0x95, 0xb1, 0x37, 0x50, 0xb0, 0x6c, 0x38,
-  0x39, 0x76, 0x7b, 0x38, 0x7f, 0x19, 0x70, 0x38, 0x40, 0x3a, 0x4a, 0x38,
-  0x7e, 0xaf, 0x8b, 0x37, 0x59, 0x59, 0xbc, 0x37, 0x9e, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x2f,
-  0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62,
-  0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69,
-  0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x96, 0xc1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x2c, 0x03, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xd8, 0x03, 0x00, 0x00, 0x02, 0xd2, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x62, 0x35, 0xf0, 0x3b, 0x2a, 0xdb, 0x40, 0x3c,
-  0x98, 0xba, 0x0a, 0x3c, 0x44, 0x53, 0xac, 0x3b, 0x94, 0xb9, 0x90, 0x3b,
-  0xcf, 0x5b, 0x08, 0x3c, 0xbc, 0x7a, 0x01, 0x3c, 0x3f, 0xbe, 0x4b, 0x3b,
-  0xa3, 0x07, 0x5b, 0x3c, 0xb3, 0x28, 0xf2, 0x3b, 0x9d, 0x01, 0x64, 0x3b,
-  0xa0, 0x38, 0x01, 0x3c, 0x3f, 0x61, 0xee, 0x3b, 0x53, 0x3c, 0x19, 0x3c,
-  0x12, 0xd4, 0xfb, 0x3b, 0xd3, 0x53, 0xfe, 0x3b, 0x01, 0x70, 0xd7, 0x3b,
-  0x47, 0xd9, 0x53, 0x3c, 0x2a, 0x0f, 0x29, 0x3c, 0xde, 0xd7, 0x12, 0x3c,
-  0x19, 0xbb, 0x44, 0x3c, 0xf6, 0x61, 0x41, 0x3b, 0x5b, 0x86, 0xe5, 0x3b,
-  0xa2, 0x74, 0x3c, 0x3c, 0xb3, 0x51, 0x7b, 0x3b, 0xc4, 0x78, 0x70, 0x3c,
-  0x15, 0xa7, 0x2a, 0x3c, 0x97, 0x8a, 0x19, 0x3c, 0xc7, 0xc7, 0x0c, 0x3c,
-  0x73, 0xbe, 0x08, 0x3c, 0xfd, 0xba, 0x87, 0x3b, 0xad, 0xa6, 0xd1, 0x3b,
-  0x16, 0x3d, 0xbe, 0x3b, 0x1e, 0x8a, 0x8f, 0x3b, 0xe5, 0x06, 0xca, 0x3b,
-  0xc3, 0x50, 0xd6, 0x3b, 0xd8, 0x53, 0xd4, 0x3b, 0xb8, 0xa4, 0x93, 0x3b,
-  0x3a, 0x8d, 0x01, 0x3c, 0x0c, 0xec, 0x0b, 0x3c, 0xcc, 0xfb, 0x48, 0x3c,
-  0xa7, 0x79, 0x72, 0x3b, 0x9a, 0xdf, 0x17, 0x3c, 0x01, 0x37, 0x6a, 0x3b,
-  0x54, 0x63, 0x3b, 0x3c, 0x95, 0xbc, 0xb0, 0x3b, 0xfe, 0xc7, 0xb5, 0x3b,
-  0x85, 0x53, 0x97, 0x3b, 0xd4, 0x41, 0x4d, 0x3c, 0xc2, 0xeb, 0x23, 0x3c,
-  0xdf, 0x82, 0x5c, 0x3c, 0xea, 0xb7, 0x9d, 0x3b, 0xf8, 0xc6, 0x3c, 0x3c,
-  0x9c, 0xf0, 0x2d, 0x3c, 0x1f, 0x91, 0x86, 0x3b, 0x20, 0xc0, 0xe8, 0x3b,
-  0x3c, 0xc0, 0x35, 0x3c, 0x5c, 0x2a, 0xcd, 0x3b, 0x92, 0x05, 0x09, 0x3c,
-  0x23, 0xc3, 0xf5, 0x3b, 0x43, 0xe3, 0x10, 0x3c, 0x15, 0x7f, 0x0e, 0x3c,
-  0x77, 0x37, 0xb1, 0x3b, 0xcb, 0x3c, 0x6c, 0x3b, 0xb0, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9a, 0xc5, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe0, 0x03, 0x00, 0x00,
-  0x0c, 0xc5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x38, 0xa9, 0x6d, 0x39, 0x8f, 0xcf, 0xbe, 0x39,
-  0xf2, 0x41, 0x89, 0x39, 0x67, 0x7f, 0x2a, 0x39, 0xa7, 0x30, 0x0f, 0x39,
-  0x98, 0xe9, 0x86, 0x39, 0x33, 0x1b, 0x80, 0x39, 0x16, 0x95, 0xc9, 0x38,
-  0xf9, 0xb4, 0xd8, 0x39, 0x3d, 0x97, 0x6f, 0x39, 0x94, 0x96, 0xe1, 0x38,
-  0x94, 0xb3, 0x7f, 0x39, 0x0c, 0xda, 0x6b, 0x39, 0x4a, 0x9c, 0x97, 0x39,
-  0x5b, 0x28, 0x79, 0x39, 0x53, 0xa1, 0x7b, 0x39, 0x18, 0x27, 0x55, 0x39,
-  0x1c, 0x9a, 0xd1, 0x39, 0x2b, 0x44, 0xa7, 0x39, 0x30, 0x49, 0x91, 0x39,
-  0xf9, 0xa4, 0xc2, 0x39, 0xed, 0x54, 0xbf, 0x38, 0x32, 0x17, 0x63, 0x39,
-  0xfa, 0x74, 0xba, 0x39, 0x5e, 0xa7, 0xf8, 0x38, 0xe3, 0xeb, 0xed, 0x39,
-  0xc3, 0xd7, 0xa8, 0x39, 0xba, 0xe9, 0x97, 0x39, 0x8f, 0x49, 0x8b, 0x39,
-  0x31, 0x4b, 0x87, 0x39, 0x7b, 0x4a, 0x06, 0x39, 0x79, 0x6d, 0x4f, 0x39,
-  0x97, 0x38, 0x3c, 0x39, 0x68, 0x04, 0x0e, 0x39, 0x64, 0xe2, 0x47, 0x39,
-  0xe5, 0x0a, 0x54, 0x39, 0x60, 0x13, 0x52, 0x39, 0xde, 0x13, 0x12, 0x39,
-  0x7f, 0x2d, 0x80, 0x39, 0x29, 0x70, 0x8a, 0x39, 0x21, 0xda, 0xc6, 0x39,
-  0x55, 0xe7, 0xef, 0x38, 0x44, 0x43, 0x96, 0x39, 0x1d, 0xbb, 0xe7, 0x38,
-  0x92, 0x66, 0xb9, 0x39, 0xbe, 0xdc, 0x2e, 0x39, 0x75, 0xda, 0x33, 0x39,
-  0xab, 0xb8, 0x15, 0x39, 0x8e, 0x14, 0xcb, 0x39, 0xb7, 0x2e, 0xa2, 0x39,
-  0x2f, 0x2c, 0xda, 0x39, 0xb6, 0x0b, 0x1c, 0x39, 0x70, 0xc6, 0xba, 0x39,
-  0x5d, 0x18, 0xac, 0x39, 0xc6, 0x23, 0x05, 0x39, 0x35, 0x48, 0x66, 0x39,
-  0xc8, 0xd2, 0xb3, 0x39, 0x56, 0xfd, 0x4a, 0x39, 0x8f, 0x91, 0x87, 0x39,
-  0xe5, 0x27, 0x73, 0x39, 0xe4, 0x59, 0x8f, 0x39, 0x34, 0xfc, 0x8c, 0x39,
-  0x52, 0x56, 0x2f, 0x39, 0x69, 0xbb, 0xe9, 0x38, 0xc3, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x9a, 0xc9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x34, 0x03, 0x00, 0x00, 0x0c, 0xc9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x9e, 0x3b, 0x3b,
-  0xa8, 0x54, 0x62, 0x3b, 0x58, 0xac, 0x31, 0x3b, 0x54, 0x78, 0x7c, 0x3b,
-  0x97, 0x73, 0x86, 0x3b, 0x03, 0x67, 0x46, 0x3b, 0x27, 0x3e, 0x5c, 0x3b,
-  0x62, 0x32, 0x84, 0x3b, 0x42, 0x77, 0x5e, 0x3b, 0xcb, 0x5f, 0x39, 0x3b,
-  0xfc, 0x41, 0x51, 0x3b, 0x00, 0xb8, 0x3f, 0x3b, 0xe0, 0xbb, 0x56, 0x3b,
-  0xea, 0x29, 0x87, 0x3b, 0x0f, 0x8a, 0x42, 0x3b, 0x7c, 0xca, 0xad, 0x3b,
-  0xd1, 0x31, 0x14, 0x3b, 0x04, 0xe6, 0x60, 0x3b, 0x44, 0x82, 0x85, 0x3b,
-  0x41, 0xe9, 0x0a, 0x3b, 0x48, 0x42, 0x29, 0x3b, 0xf4, 0x35, 0x33, 0x3b,
-  0x63, 0x30, 0x50, 0x3b, 0xc6, 0x91, 0x53, 0x3b, 0x2e, 0x18, 0x2f, 0x3b,
-  0x8c, 0xa2, 0x57, 0x3b, 0x4e, 0x04, 0x7c, 0x3b, 0xaf, 0xc3, 0x4b, 0x3b,
-  0x4a, 0x91, 0x23, 0x3b, 0x07, 0x6c, 0x6d, 0x3b, 0x6c, 0x7b, 0xa6, 0x3b,
-  0xbb, 0x9f, 0x3d, 0x3b, 0x91, 0x23, 0x3b, 0x3b, 0x93, 0xe7, 0x6e, 0x3b,
-  0xee, 0xd3, 0x50, 0x3b, 0x89, 0x3e, 0x38, 0x3b, 0x2d, 0x1b, 0x77, 0x3b,
-  0x21, 0x39, 0x12, 0x3b, 0x5b, 0xc6, 0x1f, 0x3b, 0x9a, 0x18, 0x58, 0x3b,
-  0x68, 0xbb, 0x35, 0x3b, 0x8e, 0x65, 0x4a, 0x3b, 0xf9, 0x18, 0x6f, 0x3b,
-  0x91, 0x13, 0x5a, 0x3b, 0x00, 0x26, 0x64, 0x3b, 0x27, 0x8a, 0x4e, 0x3b,
-  0xa7, 0x55, 0x82, 0x3b, 0x0c, 0x27, 0xa3, 0x3b, 0x29, 0x22, 0x19, 0x3b,
-  0x50, 0x9c, 0x18, 0x3b, 0x94, 0x84, 0x2d, 0x3b, 0x72, 0x45, 0x84, 0x3b,
-  0x2e, 0x5b, 0x79, 0x3b, 0x6c, 0x12, 0xdb, 0x3a, 0x8f, 0x8d, 0x87, 0x3b,
-  0xe7, 0xfe, 0x73, 0x3b, 0xba, 0x39, 0x60, 0x3b, 0xb1, 0x4e, 0x3a, 0x3b,
-  0x2c, 0xbb, 0xfa, 0x3a, 0x30, 0x8b, 0x52, 0x3b, 0x6e, 0x8d, 0x77, 0x3b,
-  0xba, 0xef, 0x26, 0x3b, 0x06, 0x9d, 0x8a, 0x3b, 0x5c, 0x46, 0x6a, 0x3b,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xfa, 0xcc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xcc, 0x03, 0x00, 0x00, 0x6c, 0xcc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x56, 0x74, 0xe2, 0x38, 0x3f, 0x97, 0x08, 0x39, 0xb2, 0x73, 0xd6, 0x38,
-  0xad, 0x5d, 0x18, 0x39, 0x84, 0x48, 0x22, 0x39, 0xdb, 0x78, 0xef, 0x38,
-  0xb0, 0xea, 0x04, 0x39, 0xd3, 0x8f, 0x1f, 0x39, 0x24, 0x42, 0x06, 0x39,
-  0x3d, 0xbf, 0xdf, 0x38, 0x15, 0x93, 0xfc, 0x38, 0xa9, 0x67, 0xe7, 0x38,
-  0x95, 0x97, 0x01, 0x39, 0x95, 0x24, 0x23, 0x39, 0x30, 0xcf, 0xea, 0x38,
-  0x1b, 0xc4, 0x51, 0x39, 0x06, 0xdf, 0xb2, 0x38, 0xfa, 0xb9, 0x07, 0x39,
-  0x3d, 0x25, 0x21, 0x39, 0x82, 0xaa, 0xa7, 0x38, 0xbd, 0x4b, 0xcc, 0x38,
-  0xc8, 0x4e, 0xd8, 0x38, 0xd9, 0x48, 0xfb, 0x38, 0x5f, 0x5d, 0xff, 0x38,
-  0xe0, 0x56, 0xd3, 0x38, 0xcb, 0x22, 0x02, 0x39, 0xa8, 0x17, 0x18, 0x39,
-  0xac, 0xf1, 0xf5, 0x38, 0x25, 0x6d, 0xc5, 0x38, 0xcf, 0x48, 0x0f, 0x39,
-  0xbb, 0xf1, 0x48, 0x39, 0x62, 0xe0, 0xe4, 0x38, 0x88, 0xe0, 0xe1, 0x38,
-  0xde, 0x2d, 0x10, 0x39, 0x3f, 0x0e, 0xfc, 0x38, 0x1b, 0x62, 0xde, 0x38,
-  0xfa, 0x20, 0x15, 0x39, 0xdd, 0x7d, 0xb0, 0x38, 0x3a, 0xd9, 0xc0, 0x38,
-  0x0a, 0x6a, 0x02, 0x39, 0xd9, 0x59, 0xdb, 0x38, 0x11, 0x4b, 0xf4, 0x38,
-  0xad, 0x4b, 0x10, 0x39, 0xfe, 0x9b, 0x03, 0x39, 0x15, 0xb0, 0x09, 0x39,
-  0x36, 0x4b, 0xf9, 0x38, 0x69, 0x50, 0x1d, 0x39, 0xe9, 0xec, 0x44, 0x39,
-  0x16, 0xd5, 0xb8, 0x38, 0x88, 0x33, 0xb8, 0x38, 0xbb, 0x6f, 0xd1, 0x38,
-  0xd5, 0xa6, 0x1f, 0x39, 0x99, 0x7c, 0x16, 0x39, 0xcd, 0x35, 0x84, 0x38,
-  0xda, 0x9c, 0x23, 0x39, 0x6d, 0x40, 0x13, 0x39, 0x00, 0x52, 0x07, 0x39,
-  0x97, 0xdf, 0xe0, 0x38, 0x06, 0x51, 0x97, 0x38, 0x6e, 0x20, 0xfe, 0x38,
-  0xee, 0x65, 0x15, 0x39, 0x1c, 0x7e, 0xc9, 0x38, 0x7f, 0x4e, 0x27, 0x39,
-  0x96, 0x62, 0x0d, 0x39, 0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xe6, 0xd0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00,
-  0x52, 0xe1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xbc, 0xc4, 0x54, 0x3c,
-  0xe9, 0x8e, 0x32, 0x3c, 0x5a, 0xa3, 0x85, 0x3b, 0x5e, 0x61, 0x0c, 0x3c,
-  0xaa, 0x73, 0xdf, 0x3b, 0xc8, 0x5d, 0xee, 0x3b, 0x98, 0xd7, 0xe6, 0x3b,
-  0x0d, 0x56, 0xba, 0x3b, 0x60, 0x94, 0x8f, 0x3b, 0xd0, 0xb2, 0x97, 0x3b,
-  0xcf, 0x34, 0x4a, 0x3c, 0x15, 0x02, 0xf3, 0x3b, 0xe2, 0x46, 0x19, 0x3c,
-  0xc1, 0x52, 0xeb, 0x3b, 0x2a, 0x69, 0x2b, 0x3c, 0xfe, 0xdc, 0xba, 0x3b,
-  0xdd, 0xcc, 0xe3, 0x3b, 0x97, 0x80, 0xbb, 0x3b, 0x63, 0xbd, 0x7c, 0x3b,
-  0xba, 0x11, 0xa7, 0x3b, 0xfb, 0xd6, 0x0f, 0x3c, 0xff, 0x7a, 0xd0, 0x3b,
-  0x7f, 0xa7, 0xa8, 0x3b, 0x01, 0x7d, 0x4f, 0x3c, 0xf2, 0x18, 0xf1, 0x3b,
-  0x88, 0x94, 0x03, 0x3c, 0x88, 0x12, 0x15, 0x3c, 0x13, 0x22, 0xa0, 0x3b,
-  0x0a, 0x73, 0x04, 0x3c, 0x37, 0x1b, 0x81, 0x3b, 0xf4, 0x05, 0xef, 0x3b,
-  0x33, 0x75, 0xa7, 0x3b, 0xdc, 0xcb, 0x12, 0x3c, 0xfc, 0x23, 0x0c, 0x3c,
-  0x08, 0x13, 0x96, 0x3b, 0xd3, 0xc3, 0x05, 0x3c, 0x39, 0x6a, 0x25, 0x3c,
-  0x0c, 0x37, 0x1d, 0x3c, 0xe5, 0x9b, 0xff, 0x3b, 0x2d, 0xb3, 0xd6, 0x3b,
-  0x25, 0x2c, 0x23, 0x3c, 0x3d, 0x72, 0xb0, 0x3b, 0xb4, 0x79, 0xc8, 0x3b,
-  0x85, 0x68, 0x45, 0x3c, 0x35, 0x32, 0x41, 0x3b, 0xd3, 0x36, 0xc6, 0x3b,
-  0xcb, 0x1d, 0x1c, 0x3c, 0xdf, 0xf7, 0xf8, 0x3b, 0xd4, 0xbb, 0xe9, 0x3b,
-  0x5f, 0x2f, 0xa0, 0x3b, 0xd0, 0xac, 0xbc, 0x3b, 0xbd, 0xd1, 0x1b, 0x3c,
-  0xd7, 0xf6, 0x11, 0x3c, 0xa2, 0xe3, 0x08, 0x3c, 0xd2, 0x21, 0xa2, 0x3b,
-  0x16, 0x64, 0xec, 0x3b, 0x4f, 0x00, 0xeb, 0x3b, 0x08, 0x62, 0x32, 0x3c,
-  0x25, 0xfd, 0xd8, 0x3b, 0xa6, 0x16, 0x9e, 0x3b, 0x68, 0xc7, 0xd4, 0x3b,
-  0xff, 0x27, 0xba, 0x3b, 0x0c, 0x09, 0xd6, 0x3b, 0x3a, 0x62, 0xcb, 0x3b,
-  0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x31, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xea, 0xd4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00, 0x5c, 0xd4, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x57, 0x44, 0xe4, 0x39, 0x94, 0x90, 0xbf, 0x39, 0x5f, 0x5f, 0x0f, 0x39,
-  0x1d, 0x9b, 0x96, 0x39, 0x7d, 0xba, 0x6f, 0x39, 0xb9, 0xba, 0x7f, 0x39,
-  0x3a, 0xa8, 0x77, 0x39, 0xc2, 0xe8, 0x47, 0x39, 0xc7, 0x09, 0x1a, 0x39,
-  0x9d, 0xbf, 0x22, 0x39, 0x74, 0xef, 0xd8, 0x39, 0xca, 0x5a, 0x82, 0x39,
-  0x1e, 0x71, 0xa4, 0x39, 0xf3, 0x76, 0x7c, 0x39, 0x8d, 0xe5, 0xb7, 0x39,
-  0x87, 0x79, 0x48, 0x39, 0xc6, 0x64, 0x74, 0x39, 0x0b, 0x29, 0x49, 0x39,
-  0x2e, 0x93, 0x07, 0x39, 0x27, 0x3d, 0x33, 0x39, 0x3c, 0x51, 0x9a, 0x39,
-  0xa4, 0xaa, 0x5f, 0x39, 0x7b, 0xf0, 0x34, 0x39, 0x25, 0x9a, 0xde, 0x39,
-  0x68, 0x54, 0x81, 0x39, 0x2d, 0x2a, 0x8d, 0x39, 0x5d, 0xee, 0x9f, 0x39,
-  0x29, 0xcc, 0x2b, 0x39, 0xe4, 0x18, 0x8e, 0x39, 0xba, 0x82, 0x0a, 0x39,
-  0x92, 0x37, 0x80, 0x39, 0xdf, 0xa7, 0x33, 0x39, 0x3f, 0x7d, 0x9d, 0x39,
-  0x42, 0x59, 0x96, 0x39, 0x8c, 0x01, 0x21, 0x39, 0x35, 0x82, 0x8f, 0x39,
-  0xcd, 0x76, 0xb1, 0x39, 0xb8, 0xaa, 0xa8, 0x39, 0x2f, 0x1d, 0x89, 0x39,
-  0xcc, 0x56, 0x66, 0x39, 0xe8, 0x0e, 0xaf, 0x39, 0x86, 0x4c, 0x3d, 0x39,
-  0x13, 0x14, 0x57, 0x39, 0xb2, 0xc9, 0xd3, 0x39, 0xd6, 0x44, 0xcf, 0x38,
-  0x07, 0xa7, 0x54, 0x39, 0xfa, 0x7c, 0xa7, 0x39, 0x42, 0x8d, 0x85, 0x39,
-  0x62, 0xc2, 0x7a, 0x39, 0x6d, 0xda, 0x2b, 0x39, 0x22, 0x6b, 0x4a, 0x39,
-  0x62, 0x2b, 0xa7, 0x39, 0xb6, 0x98, 0x9c, 0x39, 0x47, 0xdc, 0x92, 0x39,
-  0x2f, 0xf1, 0x2d, 0x39, 0x31, 0x9c, 0x7d, 0x39, 0x80, 0x1e, 0x7c, 0x39,
-  0x6e, 0x60, 0xbf, 0x39, 0x73, 0xcb, 0x68, 0x39, 0x9b, 0x9a, 0x29, 0x39,
-  0x35, 0x47, 0x64, 0x39, 0x59, 0xb7, 0x47, 0x39, 0x47, 0xa0, 0x65, 0x39,
-  0xd4, 0x32, 0x5a, 0x39, 0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xf2, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0x64, 0xd8, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xd2, 0x62, 0x3e, 0x3b, 0xa8, 0x38, 0x23, 0x3b, 0xc5, 0x79, 0x69, 0x3b,
-  0x3b, 0x04, 0x18, 0x3b, 0xee, 0x83, 0x3c, 0x3b, 0x08, 0x1f, 0x1e, 0x3b,
-  0x13, 0xb8, 0x5a, 0x3b, 0x35, 0x51, 0x25, 0x3b, 0xb3, 0xe4, 0x4b, 0x3b,
-  0xac, 0xd7, 0x25, 0x3b, 0x9e, 0x43, 0x39, 0x3b, 0xdb, 0xa8, 0x38, 0x3b,
-  0xf3, 0xc3, 0x72, 0x3b, 0xce, 0x31, 0x08, 0x3b, 0x6d, 0x89, 0x4d, 0x3b,
-  0xce, 0x8d, 0x29, 0x3b, 0x18, 0x9a, 0x08, 0x3b, 0xe0, 0x79, 0x16, 0x3b,
-  0x90, 0x99, 0x81, 0x3b, 0xde, 0x1b, 0x16, 0x3b, 0x6e, 0xee, 0x23, 0x3b,
-  0x93, 0xa0, 0x36, 0x3b, 0x1b, 0x60, 0x69, 0x3b, 0xaf, 0xde, 0x56, 0x3b,
-  0xf5, 0x06, 0x4c, 0x3b, 0xb3, 0xa3, 0x3b, 0x3b, 0xca, 0x70, 0x6c, 0x3b,
-  0x62, 0x65, 0x3c, 0x3b, 0x77, 0x9e, 0x45, 0x3b, 0x48, 0x7b, 0x2d, 0x3b,
-  0x60, 0x38, 0x46, 0x3b, 0xda, 0x6a, 0x5f, 0x3b, 0x84, 0xdd, 0x65, 0x3b,
-  0x1d, 0x27, 0x12, 0x3b, 0xc9, 0x00, 0x76, 0x3b, 0x53, 0x1c, 0x64, 0x3b,
-  0x63, 0xab, 0x70, 0x3b, 0x46, 0x2b, 0x86, 0x3b, 0x3b, 0xca, 0x26, 0x3b,
-  0x55, 0x78, 0x1a, 0x3b, 0x2b, 0xa7, 0x1b, 0x3b, 0x23, 0xd0, 0x2b, 0x3b,
-  0xf0, 0xf0, 0x30, 0x3b, 0xed, 0x3b, 0x28, 0x3b, 0x34, 0x7d, 0x5b, 0x3b,
-  0xa6, 0x86, 0x53, 0x3b, 0x1b, 0xd5, 0x4a, 0x3b, 0x91, 0xde, 0x3d, 0x3b,
-  0xc1, 0x5f, 0x49, 0x3b, 0x95, 0x7e, 0x42, 0x3b, 0x83, 0x00, 0x60, 0x3b,
-  0xc9, 0xc9, 0x87, 0x3b, 0x20, 0xbb, 0x71, 0x3b, 0x7e, 0x53, 0x2e, 0x3b,
-  0xa9, 0x39, 0x24, 0x3b, 0xd1, 0x01, 0x19, 0x3b, 0xc4, 0x2b, 0x41, 0x3b,
-  0x50, 0x14, 0x78, 0x3b, 0xf5, 0x9f, 0x43, 0x3b, 0x49, 0xcc, 0x10, 0x3b,
-  0x2c, 0x26, 0xce, 0x3a, 0xd1, 0xc0, 0x6e, 0x3b, 0x4d, 0x80, 0x79, 0x3b,
-  0xdd, 0x9b, 0x55, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x52, 0xdc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xcc, 0x03, 0x00, 0x00, 0xc4, 0xdb, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x5b, 0x87, 0x18, 0x39, 0xfe, 0xc3, 0x02, 0x39,
-  0xdc, 0x0c, 0x3b, 0x39, 0xe0, 0x93, 0xf3, 0x38, 0xb1, 0x07, 0x17, 0x39,
-  0xf8, 0x5b, 0xfd, 0x38, 0x57, 0x3a, 0x2f, 0x39, 0xda, 0x71, 0x04, 0x39,
-  0xa8, 0x59, 0x23, 0x39, 0x95, 0xdd, 0x04, 0x39, 0xe1, 0x6c, 0x14, 0x39,
-  0xe4, 0xf0, 0x13, 0x39, 0x26, 0x7e, 0x42, 0x39, 0xd7, 0x39, 0xda, 0x38,
-  0xb9, 0xaa, 0x24, 0x39, 0xc9, 0xd6, 0x07, 0x39, 0xf1, 0xe0, 0xda, 0x38,
-  0xff, 0x1b, 0xf1, 0x38, 0xc0, 0xa8, 0x4f, 0x39, 0x5e, 0x85, 0xf0, 0x38,
-  0x9f, 0x55, 0x03, 0x39, 0x11, 0x50, 0x12, 0x39, 0x4c, 0xf8, 0x3a, 0x39,
-  0xe3, 0x24, 0x2c, 0x39, 0x1a, 0x75, 0x23, 0x39, 0x0c, 0x54, 0x16, 0x39,
-  0xf3, 0x6c, 0x3d, 0x39, 0x38, 0xef, 0x16, 0x39, 0xd0, 0x52, 0x1e, 0x39,
-  0x54, 0xfc, 0x0a, 0x39, 0x1e, 0xce, 0x1e, 0x39, 0xf3, 0xfd, 0x32, 0x39,
-  0x63, 0x28, 0x38, 0x39, 0x9f, 0x2e, 0xea, 0x38, 0x2d, 0x16, 0x45, 0x39,
-  0x84, 0xc0, 0x36, 0x39, 0x48, 0xd0, 0x40, 0x39, 0xfd, 0xfa, 0x56, 0x39,
-  0xe8, 0x9f, 0x05, 0x39, 0x4a, 0x82, 0xf7, 0x38, 0x87, 0x67, 0xf9, 0x38,
-  0x1e, 0xa6, 0x09, 0x39, 0xe0, 0xc1, 0x0d, 0x39, 0x17, 0xc8, 0x06, 0x39,
-  0x45, 0xd8, 0x2f, 0x39, 0x12, 0x77, 0x29, 0x39, 0x11, 0x80, 0x22, 0x39,
-  0x67, 0x1d, 0x18, 0x39, 0xf4, 0x54, 0x21, 0x39, 0xfb, 0xd1, 0x1b, 0x39,
-  0xda, 0x75, 0x33, 0x39, 0x2b, 0x93, 0x59, 0x39, 0xfc, 0xa9, 0x41, 0x39,
-  0x8c, 0xa9, 0x0b, 0x39, 0xe4, 0x91, 0x03, 0x39, 0x33, 0x2a, 0xf5, 0x38,
-  0x89, 0xc2, 0x1a, 0x39, 0x03, 0xc0, 0x46, 0x39, 0xd1, 0xb9, 0x1c, 0x39,
-  0xe5, 0x02, 0xe8, 0x38, 0x4d, 0x28, 0xa5, 0x38, 0x42, 0x47, 0x3f, 0x39,
-  0x9f, 0xe3, 0x47, 0x39, 0x42, 0x22, 0x2b, 0x39, 0xa8, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x34, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x34, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x3e, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xd8, 0x03, 0x00, 0x00, 0xaa, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xcc, 0x25, 0x1c, 0x3c, 0x15, 0xea, 0x06, 0x3c, 0x97, 0x9e, 0xaf, 0x3b,
-  0xdd, 0xd2, 0x8b, 0x3b, 0xf4, 0x3a, 0x0e, 0x3c, 0x56, 0xaa, 0xda, 0x3b,
-  0x1d, 0xdd, 0xf6, 0x3b, 0x96, 0x19, 0xa2, 0x3b, 0x2b, 0x43, 0xdd, 0x3b,
-  0x3a, 0xcb, 0xa8, 0x3b, 0x6c, 0xc0, 0x72, 0x3b, 0xb4, 0x10, 0x97, 0x3b,
-  0xb9, 0x7b, 0xdd, 0x3b, 0xc7, 0x3e, 0xab, 0x3b, 0x33, 0x6e, 0xe3, 0x3b,
-  0x0e, 0xff, 0xdc, 0x3b, 0xe6, 0x74, 0x9a, 0x3b, 0x94, 0x13, 0x1e, 0x3c,
-  0xad, 0x21, 0xcc, 0x3b, 0x2b, 0xa5, 0x97, 0x3b, 0xdc, 0xb5, 0x8a, 0x3b,
-  0x88, 0x2f, 0xa9, 0x3b, 0x0e, 0xe6, 0xc5, 0x3b, 0x74, 0xca, 0xf0, 0x3b,
-  0xcc, 0xa6, 0x86, 0x3b, 0x80, 0x43, 0xbc, 0x3b, 0xb7, 0xda, 0xc8, 0x3b,
-  0x22, 0x3c, 0x16, 0x3c, 0x49, 0xe9, 0xda, 0x3b, 0xfa, 0x9f, 0x0a, 0x3c,
-  0x4c, 0x27, 0xc2, 0x3b, 0x95, 0xd6, 0x14, 0x3c, 0xf6, 0x6e, 0x0f, 0x3c,
-  0x4d, 0x94, 0xb4, 0x3b, 0xc4, 0xeb, 0x04, 0x3c, 0x3c, 0xd7, 0xef, 0x3b,
-  0x4e, 0x42, 0xb1, 0x3b, 0x19, 0xa3, 0xa1, 0x3b, 0x84, 0x6e, 0xc8, 0x3b,
-  0x38, 0x77, 0xcd, 0x3b, 0x57, 0x82, 0xb8, 0x3b, 0xed, 0x34, 0x16, 0x3c,
-  0x5f, 0xf2, 0x12, 0x3c, 0x37, 0x8e, 0xbd, 0x3b, 0xc9, 0x6b, 0x03, 0x3c,
-  0x46, 0xd7, 0xb1, 0x3b, 0xc8, 0x7a, 0x12, 0x3c, 0x42, 0x30, 0xbd, 0x3b,
-  0xfe, 0x99, 0x29, 0x3c, 0xee, 0x9e, 0xb2, 0x3b, 0x34, 0x92, 0xbb, 0x3b,
-  0x97, 0x34, 0xfd, 0x3b, 0xf7, 0xd1, 0x9d, 0x3b, 0xf2, 0x14, 0xd2, 0x3b,
-  0x94, 0xf0, 0xdf, 0x3b, 0x62, 0xa0, 0x4d, 0x3b, 0xfe, 0x77, 0xab, 0x3b,
-  0xdb, 0xea, 0x96, 0x3b, 0xab, 0xc7, 0x8d, 0x3b, 0x4c, 0xf3, 0x7b, 0x3b,
-  0x9b, 0x0e, 0xb2, 0x3b, 0x2c, 0x35, 0x9e, 0x3b, 0xca, 0x07, 0xec, 0x3b,
-  0x54, 0x26, 0x04, 0x3c, 0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
-  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f,
-  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
-  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x42, 0xe4, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00,
-  0xb4, 0xe3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x6f, 0xe6, 0xf0, 0x39, 0x5e, 0x24, 0xd0, 0x39,
-  0x6a, 0x78, 0x87, 0x39, 0x4b, 0xb7, 0x57, 0x39, 0xc7, 0x6d, 0xdb, 0x39,
-  0xe4, 0xac, 0xa8, 0x39, 0x5a, 0x6d, 0xbe, 0x39, 0x4b, 0x15, 0x7a, 0x39,
-  0xbb, 0xad, 0xaa, 0x39, 0x86, 0x34, 0x82, 0x39, 0x52, 0x41, 0x3b, 0x39,
-  0x25, 0x0f, 0x69, 0x39, 0x5b, 0xd9, 0xaa, 0x39, 0x9b, 0x18, 0x84, 0x39,
-  0xc6, 0x6f, 0xaf, 0x39, 0x31, 0x79, 0xaa, 0x39, 0x92, 0x4a, 0x6e, 0x39,
-  0x39, 0xe0, 0xf3, 0x39, 0xd3, 0x76, 0x9d, 0x39, 0x31, 0xf4, 0x69, 0x39,
-  0x99, 0xff, 0x55, 0x39, 0xe6, 0x81, 0x82, 0x39, 0xfc, 0xa7, 0x98, 0x39,
-  0x1c, 0xbe, 0xb9, 0x39, 0x90, 0xbc, 0x4f, 0x39, 0x52, 0x39, 0x91, 0x39,
-  0xaa, 0xef, 0x9a, 0x39, 0x32, 0xc7, 0xe7, 0x39, 0x73, 0xdd, 0xa8, 0x39,
-  0xd6, 0xdd, 0xd5, 0x39, 0x6a, 0xc4, 0x95, 0x39, 0x93, 0x9f, 0xe5, 0x39,
-  0xf7, 0x48, 0xdd, 0x39, 0xda, 0x4b, 0x8b, 0x39, 0x11, 0x11, 0xcd, 0x39,
-  0x7e, 0x02, 0xb9, 0x39, 0x2d, 0xbc, 0x88, 0x39, 0x7e, 0x5e, 0x79, 0x39,
-  0x33, 0x9c, 0x9a, 0x39, 0x49, 0x7e, 0x9e, 0x39, 0xe5, 0x53, 0x8e, 0x39,
-  0x14, 0xbc, 0xe7, 0x39, 0x8d, 0xb4, 0xe2, 0x39, 0x6e, 0x38, 0x92, 0x39,
-  0xac, 0xc0, 0xca, 0x39, 0x17, 0x2f, 0x89, 0x39, 0x0d, 0xfc, 0xe1, 0x39,
-  0xf4, 0xef, 0x91, 0x39, 0x05, 0xd4, 0x02, 0x3a, 0x1a, 0xc9, 0x89, 0x39,
-  0x8e, 0xb0, 0x90, 0x39, 0xae, 0x51, 0xc3, 0x39, 0x00, 0x7b, 0x73, 0x39,
-  0xdb, 0x0d, 0xa2, 0x39, 0x72, 0xbe, 0xac, 0x39, 0x0a, 0x9e, 0x1e, 0x39,
-  0xbe, 0x44, 0x84, 0x39, 0xc1, 0xd4, 0x68, 0x39, 0xec, 0xbb, 0x5a, 0x39,
-  0xd6, 0x59, 0x42, 0x39, 0xc5, 0x59, 0x89, 0x39, 0x0d, 0x14, 0x74, 0x39,
-  0x0c, 0x12, 0xb6, 0x39, 0x77, 0xe0, 0xcb, 0x39, 0xc9, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x35, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4a, 0xe8, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00,
-  0xbc, 0xe7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x91, 0x41, 0x26, 0x3b, 0x97, 0xbb, 0x40, 0x3b,
-  0x70, 0xb6, 0x98, 0x3b, 0x08, 0x59, 0x08, 0x3b, 0xda, 0xa6, 0x3e, 0x3b,
-  0x5b, 0x51, 0x51, 0x3b, 0x2e, 0xc8, 0x09, 0x3b, 0xc4, 0x6e, 0x0d, 0x3b,
-  0x4b, 0x19, 0xf2, 0x3a, 0xbf, 0xe6, 0x5d, 0x3b, 0x37, 0x97, 0x5a, 0x3b,
-  0x19, 0xa9, 0x02, 0x3b, 0xa6, 0x0a, 0x5e, 0x3b, 0xb8, 0x55, 0x12, 0x3b,
-  0x83, 0x4d, 0x32, 0x3b, 0x14, 0xe4, 0x14, 0x3b, 0x5f, 0xba, 0x1f, 0x3b,
-  0x07, 0x2f, 0x84, 0x3b, 0x26, 0x50, 0x49, 0x3b, 0x3a, 0x75, 0x5b, 0x3b,
-  0x86, 0x25, 0x10, 0x3b, 0x39, 0x3a, 0x23, 0x3b, 0x81, 0x8d, 0x7b, 0x3b,
-  0x82, 0xc5, 0x16, 0x3b, 0x50, 0x3a, 0x12, 0x3b, 0xa6, 0x22, 0xbb, 0x3b,
-  0x45, 0x59, 0x3f, 0x3b, 0xec, 0xa1, 0x3a, 0x3b, 0xe6, 0x58, 0xd4, 0x3a,
-  0x28, 0xf9, 0x5f, 0x3b, 0xa0, 0x4d, 0x0a, 0x3b, 0xa2, 0xc0, 0x84, 0x3b,
-  0x65, 0x67, 0x03, 0x3b, 0xf1, 0xde, 0x4e, 0x3b, 0x0e, 0x4e, 0x41, 0x3b,
-  0x14, 0x7d, 0x0f, 0x3b, 0x0d, 0x9d, 0x21, 0x3b, 0x75, 0xa8, 0x30, 0x3b,
-  0xf8, 0x2a, 0x81, 0x3b, 0x8b, 0x96, 0x35, 0x3b, 0x2a, 0x90, 0x5b, 0x3b,
-  0xbf, 0x38, 0x19, 0x3b, 0xb2, 0xc1, 0xa3, 0x3b, 0xef, 0xa4, 0x54, 0x3b,
-  0xce, 0x5b, 0x0e, 0x3b, 0x24, 0x61, 0x6a, 0x3b, 0xf7, 0xf5, 0x5d, 0x3b,
-  0x54, 0x20, 0x13, 0x3b, 0xbb, 0x8b, 0x1b, 0x3b, 0xd5, 0x95, 0x72, 0x3b,
-  0xa6, 0xc9, 0x1c, 0x3b, 0x46, 0x18, 0x30, 0x3b, 0xdd, 0x6f, 0xb8, 0x3a,
-  0x8a, 0x77, 0x5c, 0x3b, 0xb1, 0x04, 0x25, 0x3b, 0xab, 0x63, 0x83, 0x3b,
-  0xa5, 0xd8, 0x84, 0x3b, 0x69, 0x1b, 0x40, 0x3b, 0x89, 0x0d, 0x0d, 0x3b,
-  0xaa, 0xd4, 0x0c, 0x3b, 0x8c, 0x49, 0x29, 0x3b, 0xf1, 0x0b, 0x4f, 0x3b,
-  0x16, 0xef, 0x17, 0x3b, 0xc4, 0x82, 0x1b, 0x3b, 0x15, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xaa, 0xeb, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0x03, 0x00, 0x00,
-  0x1c, 0xeb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x14, 0x39, 0xfe, 0xa2, 0x2b, 0x39,
-  0x40, 0xff, 0x87, 0x39, 0xd0, 0xd8, 0xf2, 0x38, 0x90, 0xc8, 0x29, 0x39,
-  0x06, 0x68, 0x3a, 0x39, 0xbc, 0x66, 0xf5, 0x38, 0x4f, 0xe7, 0xfb, 0x38,
-  0x66, 0x99, 0xd7, 0x38, 0xcf, 0x9c, 0x45, 0x39, 0x0c, 0xaa, 0x42, 0x39,
-  0xac, 0xb7, 0xe8, 0x38, 0xc8, 0xbc, 0x45, 0x39, 0x3e, 0x51, 0x02, 0x39,
-  0x42, 0xc9, 0x1e, 0x39, 0xfb, 0x97, 0x04, 0x39, 0x9b, 0x3e, 0x0e, 0x39,
-  0x2b, 0x6e, 0x6b, 0x39, 0x1e, 0x47, 0x33, 0x39, 0xc2, 0x6f, 0x43, 0x39,
-  0x5e, 0x5e, 0x00, 0x39, 0x66, 0x5c, 0x11, 0x39, 0xb3, 0x04, 0x60, 0x39,
-  0xb6, 0x44, 0x06, 0x39, 0xd6, 0x38, 0x02, 0x39, 0xe5, 0xa6, 0xa6, 0x39,
-  0x74, 0x67, 0x2a, 0x39, 0x42, 0x34, 0x26, 0x39, 0xae, 0x1a, 0xbd, 0x38,
-  0x29, 0x75, 0x47, 0x39, 0x69, 0x54, 0xf6, 0x38, 0x81, 0x71, 0x6c, 0x39,
-  0x9b, 0x0a, 0xea, 0x38, 0x2d, 0x3a, 0x38, 0x39, 0x6c, 0x25, 0x2c, 0x39,
-  0xb8, 0x90, 0xff, 0x38, 0x73, 0xec, 0x0f, 0x39, 0x4a, 0x52, 0x1d, 0x39,
-  0x11, 0x0f, 0x66, 0x39, 0x3b, 0xb6, 0x21, 0x39, 0xbf, 0x87, 0x43, 0x39,
-  0x4b, 0x73, 0x08, 0x39, 0x0b, 0xd5, 0x91, 0x39, 0x64, 0x5e, 0x3d, 0x39,
-  0x7f, 0x8d, 0xfd, 0x38, 0x8d, 0xb9, 0x50, 0x39, 0x5d, 0xaa, 0x45, 0x39,
-  0xad, 0x05, 0x03, 0x39, 0x27, 0x85, 0x0a, 0x39, 0x4e, 0x08, 0x58, 0x39,
-  0x46, 0xa0, 0x0b, 0x39, 0xe4, 0xd1, 0x1c, 0x39, 0xb9, 0x3f, 0xa4, 0x38,
-  0xcc, 0x55, 0x44, 0x39, 0xaf, 0xf4, 0x12, 0x39, 0xf8, 0x03, 0x6a, 0x39,
-  0x45, 0x9c, 0x6c, 0x39, 0x58, 0x14, 0x2b, 0x39, 0x22, 0x3a, 0xfb, 0x38,
-  0xd8, 0xd4, 0xfa, 0x38, 0xeb, 0xc1, 0x16, 0x39, 0x40, 0x62, 0x38, 0x39,
-  0xb8, 0x4d, 0x07, 0x39, 0x2b, 0x7d, 0x0a, 0x39, 0xa8, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x36, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x92, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
-  0x3c, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xec, 0x03, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xb0, 0x02, 0xd7, 0x3b,
-  0xa3, 0xf4, 0xd7, 0x3b, 0xc5, 0x53, 0x89, 0x3b, 0x87, 0x21, 0x8f, 0x3b,
-  0x4a, 0x6a, 0x99, 0x3b, 0x9b, 0xb2, 0xdc, 0x3b, 0xaf, 0x9e, 0xcf, 0x3b,
-  0x5c, 0x9c, 0x40, 0x3c, 0x67, 0x63, 0x01, 0x3c, 0x37, 0xdd, 0xaa, 0x3b,
-  0x33, 0x2e, 0xa9, 0x3b, 0xa9, 0x0d, 0xeb, 0x3b, 0x6a, 0xc1, 0xb8, 0x3b,
-  0x2d, 0x30, 0x6f, 0x3b, 0x26, 0x59, 0x9c, 0x3b, 0x57, 0xb9, 0x9d, 0x3b,
-  0x99, 0xe0, 0xc7, 0x3b, 0xf6, 0xdb, 0x12, 0x3c, 0xca, 0x20, 0xab, 0x3b,
-  0x87, 0x5c, 0x9a, 0x3b, 0x7c, 0x86, 0xd4, 0x3b, 0xde, 0x89, 0xc2, 0x3b,
-  0xc1, 0x86, 0xbb, 0x3b, 0xab, 0xe3, 0x0d, 0x3c, 0x4d, 0x84, 0x08, 0x3c,
-  0xbb, 0x79, 0x8f, 0x3b, 0x9e, 0x3e, 0xd4, 0x3b, 0x16, 0x3c, 0x8a, 0x3b,
-  0x9a, 0xf9, 0x93, 0x3b, 0x81, 0x4c, 0xa4, 0x3b, 0xcc, 0xf4, 0x8f, 0x3b,
-  0xd3, 0xba, 0x9f, 0x3b, 0x2c, 0xfc, 0xda, 0x3b, 0x31, 0x61, 0xba, 0x3b,
-  0xe9, 0x0d, 0x72, 0x3b, 0x8d, 0x65, 0x90, 0x3b, 0x90, 0x75, 0x96, 0x3b,
-  0x18, 0x68, 0x8a, 0x3b, 0x5d, 0xc2, 0x8a, 0x3b, 0xfb, 0x79, 0xb5, 0x3b,
-  0xbb, 0xfd, 0x94, 0x3b, 0xd6, 0x1a, 0x7c, 0x3b, 0x4d, 0x02, 0x7c, 0x3b,
-  0x13, 0xf5, 0xb7, 0x3b, 0x21, 0x00, 0x4b, 0x3b, 0x9f, 0x5f, 0xd0, 0x3b,
-  0xbe, 0x97, 0xc7, 0x3b, 0x0e, 0xeb, 0xfd, 0x3b, 0xe6, 0xb3, 0x13, 0x3c,
-  0x52, 0xba, 0xab, 0x3b, 0x3b, 0x24, 0x12, 0x3c, 0x88, 0xda, 0xfd, 0x3b,
-  0x0c, 0x06, 0x4f, 0x3c, 0xb7, 0x9b, 0xe0, 0x3b, 0x35, 0x0c, 0x3b, 0x3b,
-  0x53, 0x14, 0x8b, 0x3b, 0xa8, 0x88, 0xb8, 0x3b, 0xcb, 0xe2, 0xc9, 0x3b,
-  0x3d, 0x4f, 0x82, 0x3b, 0x68, 0x2e, 0xde, 0x3b, 0x51, 0x16, 0xc3, 0x3b,
-  0x79, 0x1e, 0xa3, 0x3b, 0x36, 0x4c, 0xda, 0x3b, 0x4e, 0x8c, 0x21, 0x3c,
-  0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xaa, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00, 0x1c, 0xf3, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x7a, 0xf3, 0x9d, 0x39, 0x38, 0xa5, 0x9e, 0x39, 0x49, 0xc4, 0x49, 0x39,
-  0x39, 0x4b, 0x52, 0x39, 0x62, 0x67, 0x61, 0x39, 0x06, 0x21, 0xa2, 0x39,
-  0x93, 0x85, 0x98, 0x39, 0xec, 0x7e, 0x0d, 0x3a, 0x40, 0x1a, 0xbe, 0x39,
-  0x5f, 0x0a, 0x7b, 0x39, 0x1b, 0x91, 0x78, 0x39, 0xcb, 0xac, 0xac, 0x39,
-  0xa4, 0xb9, 0x87, 0x39, 0x67, 0xb6, 0x2f, 0x39, 0x93, 0xb6, 0x65, 0x39,
-  0x08, 0xbc, 0x67, 0x39, 0x7e, 0xd5, 0x92, 0x39, 0x84, 0xc5, 0xd7, 0x39,
-  0xa8, 0x6d, 0x7b, 0x39, 0x4a, 0xcb, 0x62, 0x39, 0x1c, 0x20, 0x9c, 0x39,
-  0x77, 0xe9, 0x8e, 0x39, 0xbd, 0xc2, 0x89, 0x39, 0x36, 0x78, 0xd0, 0x39,
-  0x77, 0x93, 0xc8, 0x39, 0xd0, 0xcc, 0x52, 0x39, 0x51, 0xeb, 0x9b, 0x39,
-  0x9d, 0x19, 0x4b, 0x39, 0x31, 0x69, 0x59, 0x39, 0x01, 0x65, 0x71, 0x39,
-  0xa1, 0x81, 0x53, 0x39, 0x76, 0xae, 0x6a, 0x39, 0xf1, 0xde, 0xa0, 0x39,
-  0x15, 0xeb, 0x88, 0x39, 0x6b, 0xd1, 0x31, 0x39, 0x4a, 0x27, 0x54, 0x39,
-  0x92, 0x0f, 0x5d, 0x39, 0x46, 0x5a, 0x4b, 0x39, 0xe7, 0xde, 0x4b, 0x39,
-  0xfa, 0x50, 0x85, 0x39, 0x62, 0xe7, 0x5a, 0x39, 0x8b, 0x33, 0x39, 0x39,
-  0x84, 0x21, 0x39, 0x39, 0x88, 0x23, 0x87, 0x39, 0xd8, 0x20, 0x15, 0x39,
-  0x4f, 0x13, 0x99, 0x39, 0xf9, 0x9f, 0x92, 0x39, 0x91, 0x88, 0xba, 0x39,
-  0xc7, 0x02, 0xd9, 0x39, 0x3b, 0x4f, 0x7c, 0x39, 0x92, 0xb7, 0xd6, 0x39,
-  0x6d, 0x7c, 0xba, 0x39, 0x71, 0x15, 0x18, 0x3a, 0x76, 0x00, 0xa5, 0x39,
-  0xb6, 0x68, 0x09, 0x39, 0x52, 0x57, 0x4c, 0x39, 0xf2, 0x8f, 0x87, 0x39,
-  0x3b, 0x4f, 0x94, 0x39, 0xc0, 0x74, 0x3f, 0x39, 0x09, 0x38, 0xa3, 0x39,
-  0xa4, 0x50, 0x8f, 0x39, 0x3f, 0xa9, 0x6f, 0x39, 0xad, 0x5d, 0xa0, 0x39,
-  0x5d, 0x5a, 0xed, 0x39, 0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x37, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xb2, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0x24, 0xf7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x8f, 0xc8, 0x29, 0x3b, 0x62, 0x40, 0x62, 0x3b, 0x41, 0x1b, 0x6f, 0x3b,
-  0x26, 0xc0, 0x68, 0x3b, 0xae, 0xe0, 0x53, 0x3b, 0xb7, 0xc4, 0x90, 0x3b,
-  0x4d, 0x5f, 0x82, 0x3b, 0x7e, 0x15, 0x21, 0x3b, 0x14, 0xc2, 0x7e, 0x3b,
-  0x4b, 0x80, 0x9f, 0x3b, 0xe9, 0xbe, 0x05, 0x3b, 0x3d, 0x2b, 0x46, 0x3b,
-  0x03, 0xc7, 0x53, 0x3b, 0x1a, 0xd9, 0x95, 0x3b, 0x27, 0x30, 0x62, 0x3b,
-  0x0c, 0x05, 0x4a, 0x3b, 0xb6, 0x7a, 0x53, 0x3b, 0x2a, 0x13, 0x0e, 0x3b,
-  0x44, 0x7c, 0xa2, 0x3b, 0x22, 0xea, 0x10, 0x3b, 0x74, 0xf6, 0x9e, 0x3b,
-  0x5e, 0xf2, 0xb5, 0x3a, 0x62, 0x21, 0x6f, 0x3b, 0x4a, 0x02, 0x51, 0x3b,
-  0x67, 0x3e, 0xa1, 0x3b, 0x61, 0xf7, 0x3f, 0x3b, 0xf6, 0xe1, 0x96, 0x3b,
-  0xfd, 0xd9, 0x62, 0x3b, 0x09, 0x0b, 0x45, 0x3b, 0x4b, 0xe6, 0x39, 0x3b,
-  0xa9, 0x01, 0x5d, 0x3b, 0x9d, 0x52, 0x9d, 0x3b, 0x19, 0x6d, 0x47, 0x3b,
-  0xff, 0xe7, 0x5f, 0x3b, 0x65, 0x95, 0x64, 0x3b, 0x50, 0x56, 0x7a, 0x3b,
-  0x72, 0xd0, 0x47, 0x3b, 0x7e, 0xff, 0x93, 0x3b, 0x64, 0x42, 0x80, 0x3b,
-  0xc9, 0x4f, 0x9a, 0x3b, 0x06, 0x0d, 0x3b, 0x3b, 0x28, 0xd0, 0xfc, 0x3a,
-  0x35, 0xf1, 0xb8, 0x3b, 0x15, 0x13, 0x2a, 0x3b, 0xb3, 0xec, 0x72, 0x3b,
-  0x43, 0x8f, 0x8d, 0x3b, 0x3c, 0x6f, 0x94, 0x3b, 0xf2, 0x41, 0x76, 0x3b,
-  0xc4, 0xeb, 0x84, 0x3b, 0x9a, 0x6a, 0x27, 0x3b, 0xaa, 0xaf, 0x67, 0x3b,
-  0xd4, 0x54, 0x25, 0x3b, 0xc9, 0xa9, 0x77, 0x3b, 0xea, 0x35, 0x62, 0x3b,
-  0x08, 0xef, 0x5d, 0x3b, 0xc8, 0x06, 0x38, 0x3b, 0x6e, 0xa3, 0x35, 0x3b,
-  0x67, 0x7d, 0x51, 0x3b, 0xdb, 0xd6, 0x03, 0x3b, 0x2a, 0x98, 0x26, 0x3b,
-  0xd5, 0x3f, 0x8e, 0x3b, 0x9c, 0x6e, 0x70, 0x3b, 0x35, 0x94, 0xf7, 0x3a,
-  0x41, 0x07, 0x49, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x12, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xb0, 0x03, 0x00, 0x00, 0x84, 0xfa, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xa3, 0x5e, 0xfb, 0x38, 0x78, 0x7c, 0x27, 0x39, 0x96, 0x00, 0x31, 0x39,
-  0x19, 0x4c, 0x2c, 0x39, 0x82, 0xd8, 0x1c, 0x39, 0x8c, 0x55, 0x56, 0x39,
-  0x2d, 0x05, 0x41, 0x39, 0x65, 0x7d, 0xee, 0x38, 0xb3, 0x96, 0x3c, 0x39,
-  0x7c, 0x25, 0x6c, 0x39, 0xc6, 0x03, 0xc6, 0x38, 0x97, 0xb2, 0x12, 0x39,
-  0x82, 0xc5, 0x1c, 0x39, 0xcf, 0xda, 0x5d, 0x39, 0x74, 0x70, 0x27, 0x39,
-  0x5a, 0x8c, 0x15, 0x39, 0x07, 0x8d, 0x1c, 0x39, 0xa5, 0x58, 0xd2, 0x38,
-  0x92, 0x90, 0x70, 0x39, 0xf2, 0x8c, 0xd6, 0x38, 0x68, 0x59, 0x6b, 0x39,
-  0x5d, 0xb0, 0x86, 0x38, 0x20, 0x05, 0x31, 0x39, 0xde, 0xb8, 0x1a, 0x39,
-  0xf7, 0xb9, 0x6e, 0x39, 0x27, 0x1b, 0x0e, 0x39, 0xf1, 0x62, 0x5f, 0x39,
-  0x2d, 0xee, 0x27, 0x39, 0x3e, 0xdd, 0x11, 0x39, 0x75, 0x9d, 0x09, 0x39,
-  0x7f, 0x9a, 0x23, 0x39, 0xd2, 0xeb, 0x68, 0x39, 0xda, 0xa0, 0x13, 0x39,
-  0x06, 0xc0, 0x25, 0x39, 0x6a, 0x36, 0x29, 0x39, 0xe5, 0x50, 0x39, 0x39,
-  0x65, 0xea, 0x13, 0x39, 0x9d, 0x1d, 0x5b, 0x39, 0x57, 0xe4, 0x3d, 0x39,
-  0x96, 0x76, 0x64, 0x39, 0xa3, 0x77, 0x0a, 0x39, 0x1b, 0x26, 0xbb, 0x38,
-  0x07, 0xe8, 0x88, 0x39, 0xf8, 0xcc, 0xfb, 0x38, 0x28, 0xd4, 0x33, 0x39,
-  0x5c, 0x95, 0x51, 0x39, 0x0d, 0xc3, 0x5b, 0x39, 0xc9, 0x4b, 0x36, 0x39,
-  0x2b, 0xcb, 0x44, 0x39, 0x7f, 0xdd, 0xf7, 0x38, 0x63, 0x82, 0x2b, 0x39,
-  0x3b, 0xc7, 0xf4, 0x38, 0x29, 0x56, 0x37, 0x39, 0xb8, 0x74, 0x27, 0x39,
-  0x37, 0x4a, 0x24, 0x39, 0x7e, 0x3a, 0x08, 0x39, 0xee, 0x75, 0x06, 0x39,
-  0x01, 0x14, 0x1b, 0x39, 0x32, 0x31, 0xc3, 0x38, 0xf0, 0xa5, 0xf6, 0x38,
-  0xc7, 0x9a, 0x52, 0x39, 0xcd, 0xfb, 0x31, 0x39, 0x30, 0x46, 0xb7, 0x38,
-  0x7a, 0xd0, 0x14, 0x39, 0x92, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xe2, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3c, 0x00, 0x00, 0x00,
-  0x54, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x87, 0x5a, 0x3b, 0x12, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x00,
-  0xb4, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x4f, 0xeb, 0x1b, 0x39, 0x22, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,
-  0x98, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00,
-  0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xa8, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x46, 0x5c, 0xc8, 0x3d, 0x17, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x19, 0xd0, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xf0, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x0c, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16
-};
-unsigned int sed_baby_cry_ds_cnn_quantized_tflite_len = 47408;
-const char *sed_baby_cry_labels[] = {
-  "_silence_",
-  "_unknown_",
-  "baby_cry",
-};
-unsigned int sed_baby_cry_labels_num = 3;
-const unsigned char *sed_baby_cry_model_ptr = sed_baby_cry_ds_cnn_quantized_tflite;
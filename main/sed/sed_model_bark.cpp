@@ -1,3961 +0,0 @@
-const unsigned char sed_bark_ds_cnn_quantized_tflite[] = {
-  0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x30, 0x60, 0x00, 0x00, 0x40, 0x60, 0x00, 0x00, 0x68, 0xb8, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x64, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x9a, 0x9f, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xdc, 0xff, 0xff, 0xff, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
-  0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00,
-  0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x5f, 0x00, 0x00, 0x40, 0x5f, 0x00, 0x00, 0x20, 0x5f, 0x00, 0x00,
-  0x08, 0x5f, 0x00, 0x00, 0xec, 0x5e, 0x00, 0x00, 0x1c, 0x5e, 0x00, 0x00,
-  0x0c, 0x5d, 0x00, 0x00, 0xfc, 0x4c, 0x00, 0x00, 0xec, 0x4b, 0x00, 0x00,
-  0x9c, 0x49, 0x00, 0x00, 0x8c, 0x48, 0x00, 0x00, 0x7c, 0x38, 0x00, 0x00,
-  0x6c, 0x37, 0x00, 0x00, 0x1c, 0x35, 0x00, 0x00, 0x0c, 0x34, 0x00, 0x00,
-  0xfc, 0x23, 0x00, 0x00, 0xec, 0x22, 0x00, 0x00, 0x9c, 0x20, 0x00, 0x00,
-  0x8c, 0x1f, 0x00, 0x00, 0x7c, 0x0f, 0x00, 0x00, 0x6c, 0x0e, 0x00, 0x00,
-  0x1c, 0x0c, 0x00, 0x00, 0x0c, 0x0b, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-  0xf4, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
-  0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
-  0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xae, 0xa0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x32, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x12, 0xa1, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
-  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x4a, 0xff, 0xff, 0x64, 0x4a, 0xff, 0xff, 0x68, 0x4a, 0xff, 0xff,
-  0x6c, 0x4a, 0xff, 0xff, 0x70, 0x4a, 0xff, 0xff, 0x74, 0x4a, 0xff, 0xff,
-  0x78, 0x4a, 0xff, 0xff, 0x7c, 0x4a, 0xff, 0xff, 0x80, 0x4a, 0xff, 0xff,
-  0x84, 0x4a, 0xff, 0xff, 0x88, 0x4a, 0xff, 0xff, 0x8c, 0x4a, 0xff, 0xff,
-  0x90, 0x4a, 0xff, 0xff, 0x94, 0x4a, 0xff, 0xff, 0x66, 0xa1, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x40, 0xed, 0x11, 0xbc,
-  0x1c, 0x1a, 0xdb, 0x05, 0x26, 0x36, 0x32, 0x34, 0xf3, 0xdb, 0x08, 0xc1,
-  0x07, 0x1a, 0x03, 0xe9, 0x43, 0xf1, 0xe1, 0xfd, 0x03, 0x07, 0xb5, 0xb8,
-  0x5d, 0x0a, 0x4f, 0x33, 0x42, 0x6e, 0x5e, 0x1c, 0x7f, 0x52, 0x2d, 0x2b,
-  0x7f, 0x4c, 0x21, 0x0e, 0x3e, 0x1c, 0x26, 0xd4, 0x0c, 0x5e, 0x71, 0x7e,
-  0xf8, 0x00, 0x31, 0x34, 0xd1, 0x35, 0x36, 0xf6, 0xdf, 0x20, 0xf0, 0xbd,
-  0xf5, 0xf8, 0xf8, 0xa7, 0xe5, 0xe2, 0xf4, 0xfa, 0xf7, 0xac, 0xc8, 0x11,
-  0xae, 0xd1, 0xef, 0xba, 0x2d, 0xe3, 0x0a, 0xfd, 0x0c, 0xe0, 0xe6, 0xed,
-  0xed, 0xe9, 0xdd, 0x01, 0xf4, 0xc8, 0xfd, 0xe2, 0xce, 0xe1, 0x26, 0xea,
-  0x1c, 0xf4, 0x3b, 0x1d, 0x16, 0x03, 0x02, 0x55, 0x38, 0xe9, 0x3c, 0x4a,
-  0x11, 0x24, 0x44, 0x7f, 0x20, 0xef, 0x23, 0x77, 0xee, 0xd1, 0x0d, 0x17,
-  0xfe, 0x20, 0xfa, 0x08, 0x1d, 0x05, 0x0d, 0xf7, 0xf3, 0x08, 0xfc, 0xef,
-  0x6f, 0x7f, 0x42, 0x57, 0x21, 0xeb, 0x01, 0xe3, 0x0e, 0x0d, 0xe3, 0xde,
-  0xf7, 0x24, 0xf2, 0xf1, 0x07, 0x16, 0x0b, 0xe2, 0x00, 0x22, 0xed, 0xe1,
-  0xfe, 0xef, 0x10, 0xe4, 0x11, 0x11, 0xe1, 0xd3, 0x21, 0x0d, 0xe8, 0x18,
-  0x43, 0x37, 0x00, 0x1c, 0x58, 0x53, 0x63, 0x7f, 0x01, 0xce, 0xf4, 0x19,
-  0x04, 0xeb, 0xfa, 0x06, 0xef, 0x0e, 0x09, 0xf7, 0x15, 0xfd, 0x07, 0x06,
-  0xe0, 0x0b, 0x10, 0xf3, 0x37, 0x28, 0x54, 0x4b, 0x1e, 0xe3, 0xea, 0x4f,
-  0xfe, 0x25, 0xf7, 0x60, 0x57, 0x1b, 0xe8, 0x7f, 0x05, 0xd9, 0x0e, 0x65,
-  0x16, 0xcb, 0xb3, 0x2e, 0xe8, 0xf4, 0x9e, 0xdd, 0xdc, 0xc9, 0xbd, 0x34,
-  0xf7, 0x00, 0xca, 0x20, 0xbf, 0x01, 0xee, 0x19, 0x99, 0xdb, 0x0e, 0xcb,
-  0xfc, 0xe3, 0xdb, 0x0a, 0xfe, 0xba, 0x20, 0xf7, 0xbd, 0x0f, 0x32, 0xe2,
-  0x81, 0xd2, 0xe7, 0xb5, 0xbd, 0x8e, 0xa2, 0xbf, 0xc1, 0xe8, 0xf4, 0xfb,
-  0xee, 0xab, 0xd6, 0x21, 0xf2, 0x00, 0xed, 0xf7, 0x08, 0x25, 0x1f, 0x00,
-  0x44, 0x4d, 0x7f, 0x6d, 0x10, 0x0d, 0x15, 0x1a, 0x1c, 0x26, 0x03, 0x5a,
-  0x13, 0x10, 0xdd, 0xfc, 0x24, 0x09, 0xe9, 0x10, 0xf8, 0xfe, 0x1d, 0xd2,
-  0xb4, 0xcd, 0x26, 0x09, 0xb0, 0xd2, 0xd5, 0xe8, 0xc1, 0xd8, 0xdb, 0x05,
-  0x0d, 0xe3, 0xe0, 0xdd, 0xd4, 0x14, 0xbc, 0x04, 0xf1, 0xe6, 0x06, 0xa6,
-  0xc9, 0xcc, 0xa0, 0x81, 0xef, 0xeb, 0x12, 0xec, 0xb6, 0xac, 0xfa, 0xa7,
-  0xcf, 0x52, 0xed, 0xed, 0xe8, 0xea, 0x2d, 0xda, 0x2c, 0xdd, 0xe6, 0xf3,
-  0xba, 0xe6, 0x1f, 0xb4, 0xf6, 0x04, 0x4c, 0x1c, 0x39, 0xef, 0x0a, 0x20,
-  0x42, 0xeb, 0x06, 0x15, 0x7f, 0x29, 0x66, 0x0e, 0x4c, 0x0b, 0x32, 0x25,
-  0x3a, 0x01, 0x2c, 0x0e, 0x0a, 0x03, 0xff, 0xea, 0x00, 0xfa, 0xdb, 0xf7,
-  0x2a, 0xf8, 0x08, 0xfa, 0xfe, 0xf5, 0xfe, 0x1a, 0xc2, 0xdb, 0xe0, 0xf6,
-  0xdf, 0xe8, 0x3f, 0x7f, 0x09, 0xe5, 0x29, 0x1d, 0x69, 0x55, 0x7a, 0x5a,
-  0x4e, 0x32, 0xfa, 0x15, 0xd6, 0xe5, 0x17, 0x25, 0xea, 0xd1, 0x05, 0x08,
-  0xb1, 0xf4, 0x2c, 0xf0, 0xe4, 0xc6, 0x1a, 0x38, 0xdb, 0xe5, 0x1c, 0xe8,
-  0xdd, 0xf7, 0x32, 0x23, 0x13, 0xec, 0xef, 0x25, 0x1b, 0x13, 0xc5, 0xe4,
-  0xf8, 0xe9, 0xf4, 0xbe, 0xd2, 0xcc, 0xe4, 0x81, 0xa5, 0xb5, 0xe9, 0xb7,
-  0x21, 0xa7, 0xcf, 0xe7, 0xc2, 0x09, 0xf3, 0xbe, 0xf8, 0xe8, 0x31, 0x0b,
-  0x56, 0xf9, 0x14, 0x0a, 0x1b, 0x28, 0x12, 0xe7, 0xd1, 0xd3, 0xd6, 0xae,
-  0xcf, 0xec, 0xfd, 0xcd, 0x1a, 0x76, 0x7f, 0x7b, 0x17, 0x69, 0x4b, 0x13,
-  0x34, 0x00, 0x0a, 0xc1, 0xf7, 0xe4, 0x00, 0xea, 0xf5, 0x20, 0x17, 0x18,
-  0xf4, 0x20, 0xe2, 0x1a, 0xe1, 0x06, 0xef, 0xeb, 0xd5, 0xf4, 0xf9, 0x05,
-  0xf4, 0xf8, 0xee, 0xf4, 0x31, 0xf8, 0x10, 0xea, 0x04, 0xea, 0x1b, 0x03,
-  0xf8, 0xe9, 0x36, 0x27, 0xf6, 0xf5, 0x5a, 0x7f, 0xeb, 0xf6, 0x1b, 0xf3,
-  0xf0, 0xe3, 0x0e, 0xe5, 0xee, 0xfa, 0x08, 0x04, 0x12, 0xe9, 0x0b, 0xf8,
-  0x13, 0xe9, 0x04, 0xf6, 0x10, 0x8b, 0xe1, 0x08, 0x2c, 0x0d, 0x0e, 0x04,
-  0xc5, 0x9c, 0x0f, 0x97, 0xfc, 0xa8, 0x2d, 0x84, 0x9d, 0x0b, 0xb8, 0x88,
-  0x81, 0xb4, 0xc0, 0x8b, 0xa8, 0xc7, 0xb9, 0xfd, 0x40, 0x1d, 0x71, 0x33,
-  0x34, 0xdc, 0xc8, 0x2d, 0x9b, 0xaf, 0x33, 0xf5, 0x33, 0x69, 0x54, 0x3b,
-  0x7f, 0x38, 0x22, 0xf9, 0xfd, 0x4f, 0x18, 0xf6, 0x2b, 0x0b, 0x05, 0x17,
-  0xeb, 0xc4, 0x16, 0x3c, 0xbf, 0xb1, 0xf0, 0xa9, 0xe1, 0xda, 0xad, 0xaf,
-  0xd0, 0xe8, 0xa4, 0xdb, 0xdc, 0xda, 0xca, 0xfe, 0x39, 0xb2, 0xe3, 0xbc,
-  0x40, 0x17, 0x1d, 0x2f, 0xe9, 0x10, 0xcb, 0xf5, 0x43, 0x41, 0x1e, 0x03,
-  0xf7, 0xf7, 0xec, 0xbd, 0xb2, 0x95, 0x81, 0xa3, 0xc7, 0xcc, 0xd6, 0xc9,
-  0xe4, 0xc5, 0x13, 0xc0, 0x10, 0xf9, 0xb9, 0xe0, 0xdb, 0xde, 0x0e, 0xd7,
-  0x22, 0x1e, 0xdc, 0xff, 0xb1, 0x36, 0x10, 0xe2, 0x96, 0x35, 0xc2, 0x1d,
-  0xcd, 0x6f, 0x4d, 0x0f, 0xc0, 0x24, 0x4e, 0xe1, 0xb5, 0xe6, 0xe9, 0xf0,
-  0xe6, 0x31, 0xe2, 0x74, 0xf4, 0x5c, 0x23, 0x78, 0xe5, 0x7f, 0x1f, 0x5f,
-  0xe0, 0x76, 0xe7, 0x3d, 0x0f, 0x5f, 0xd2, 0xd4, 0xfd, 0x2b, 0xd4, 0x10,
-  0x23, 0xf5, 0xe2, 0x05, 0x16, 0xf5, 0xd9, 0x28, 0xe4, 0xe5, 0xbc, 0xd8,
-  0x32, 0x06, 0xe2, 0xf1, 0x7f, 0x66, 0x42, 0x51, 0x31, 0x0a, 0xbd, 0xdb,
-  0x3a, 0x0c, 0xfa, 0xe5, 0x5c, 0x27, 0xed, 0xee, 0x41, 0x1d, 0xe2, 0x0a,
-  0xe5, 0xa0, 0xe2, 0xa9, 0x81, 0xdd, 0xce, 0xdd, 0xb8, 0x0b, 0x1d, 0xfc,
-  0xdd, 0xee, 0xed, 0x92, 0xeb, 0xdd, 0x13, 0xaa, 0xc1, 0x24, 0x3c, 0x0e,
-  0xb5, 0xc4, 0xc1, 0x25, 0xf3, 0xc9, 0x19, 0xfd, 0xba, 0xd2, 0x41, 0xe4,
-  0xda, 0xbb, 0xff, 0xdb, 0x10, 0xf2, 0xff, 0x03, 0xe4, 0xfe, 0x2a, 0xdd,
-  0xee, 0xcd, 0x24, 0xe7, 0xd1, 0xe1, 0x26, 0xf4, 0x13, 0xeb, 0x2f, 0x0b,
-  0x2f, 0x24, 0x7f, 0x34, 0xdb, 0x0a, 0x24, 0xf5, 0xde, 0xf6, 0xfa, 0x07,
-  0xe3, 0x30, 0x09, 0x04, 0x02, 0xf6, 0x19, 0xf7, 0xbe, 0xc3, 0xda, 0xaf,
-  0x0c, 0xfe, 0xfc, 0xf8, 0x1e, 0x81, 0xbd, 0x90, 0x23, 0xa5, 0x0d, 0xd6,
-  0xab, 0xf8, 0xfe, 0xb9, 0xf6, 0xd6, 0xeb, 0xd6, 0x1a, 0x12, 0xb0, 0x9c,
-  0xd1, 0x8b, 0xf6, 0xf1, 0xb1, 0xe1, 0xb5, 0xbb, 0x5e, 0x3d, 0x38, 0x4d,
-  0x0b, 0x05, 0x00, 0xc8, 0xf1, 0xd8, 0x1f, 0x19, 0xe1, 0xe8, 0xfa, 0x05,
-  0x2b, 0x17, 0x0a, 0x28, 0x7f, 0x54, 0x50, 0x6a, 0xe7, 0x1a, 0x05, 0xe5,
-  0xdd, 0xf5, 0xe5, 0xf1, 0xfb, 0xec, 0xee, 0x0d, 0x32, 0xf3, 0x1a, 0xed,
-  0x02, 0x07, 0xdf, 0x08, 0x3b, 0x59, 0x27, 0x7f, 0x3e, 0x0b, 0x2d, 0xf5,
-  0xb8, 0xbc, 0x30, 0xfa, 0xde, 0xfc, 0x38, 0x1f, 0xc9, 0xf1, 0xd6, 0x2a,
-  0xdd, 0xe1, 0xe9, 0x07, 0x43, 0x04, 0xd5, 0xde, 0x47, 0x3a, 0xe4, 0xe6,
-  0x1a, 0xfe, 0x3d, 0xe6, 0x43, 0x47, 0x10, 0x06, 0xe2, 0x19, 0x7f, 0x66,
-  0xf2, 0x0c, 0x7d, 0x75, 0x52, 0x70, 0x5a, 0x74, 0x10, 0xf7, 0x0b, 0xfe,
-  0xe0, 0x04, 0xdc, 0xb9, 0xc6, 0x06, 0xbf, 0x1b, 0xf8, 0x14, 0xe7, 0x35,
-  0xc7, 0xdc, 0xf8, 0x0b, 0xff, 0xd9, 0xfc, 0x01, 0xf1, 0xfe, 0x17, 0x32,
-  0x45, 0x02, 0x33, 0x2b, 0x20, 0x4c, 0x54, 0x40, 0x37, 0x7a, 0x7f, 0x13,
-  0x06, 0x01, 0x4e, 0x2b, 0xd4, 0xe0, 0xe7, 0x0c, 0x17, 0x17, 0x16, 0xe7,
-  0xee, 0xeb, 0x01, 0xd3, 0xb0, 0xdd, 0x19, 0xfd, 0xdb, 0x18, 0x0e, 0xd7,
-  0xdd, 0x13, 0x0e, 0xd4, 0xc5, 0x11, 0xef, 0x2f, 0xc8, 0xea, 0x12, 0xf0,
-  0x26, 0x7f, 0x79, 0x4b, 0x0a, 0x44, 0xfa, 0xe4, 0xf2, 0xfd, 0x2f, 0x49,
-  0x08, 0xfc, 0x2a, 0x11, 0xd8, 0x3d, 0x0e, 0x2f, 0xab, 0xed, 0x33, 0xea,
-  0xe2, 0x2a, 0xfc, 0x23, 0xb2, 0x05, 0x23, 0xd6, 0x34, 0x9d, 0x29, 0xbf,
-  0x30, 0x1c, 0x26, 0xe8, 0x53, 0xfd, 0x26, 0xf2, 0x9e, 0x82, 0x9a, 0x8e,
-  0xaf, 0x8f, 0xfc, 0xd5, 0xe5, 0xd1, 0xc7, 0xd0, 0xea, 0xda, 0xfa, 0xb9,
-  0xa1, 0xbe, 0xe5, 0xcb, 0xac, 0x90, 0x85, 0x81, 0xff, 0x54, 0x01, 0x3a,
-  0xdc, 0xd2, 0xe4, 0x01, 0xdc, 0xed, 0x04, 0xbf, 0x44, 0x11, 0x09, 0x0e,
-  0x32, 0xe3, 0x10, 0xf7, 0xf4, 0xd2, 0xaf, 0xb7, 0x54, 0x1f, 0x46, 0x2a,
-  0x7f, 0x4d, 0x6f, 0x4e, 0x06, 0x08, 0x26, 0xf5, 0x03, 0x12, 0x0d, 0xd3,
-  0xe7, 0x1e, 0xde, 0x12, 0xd1, 0x07, 0xfd, 0x3b, 0x35, 0x43, 0xce, 0x05,
-  0xd0, 0x01, 0x26, 0x0a, 0x3a, 0xdb, 0x14, 0xde, 0x21, 0xe8, 0x18, 0xec,
-  0x55, 0x5c, 0x52, 0x10, 0x7c, 0x38, 0x49, 0xfe, 0x36, 0x0a, 0x7f, 0x31,
-  0x2e, 0x45, 0x1d, 0x3e, 0x57, 0xf6, 0xe9, 0xc4, 0x0d, 0xc7, 0xea, 0xad,
-  0xdf, 0xca, 0xdd, 0xc8, 0x1b, 0x0e, 0x2e, 0x4e, 0xe5, 0x06, 0x26, 0x35,
-  0x0f, 0x1f, 0x54, 0x7f, 0xcf, 0xfb, 0x05, 0x38, 0xee, 0xf5, 0xf4, 0x23,
-  0xf1, 0xde, 0x22, 0xf1, 0x00, 0xf5, 0x20, 0x15, 0xfa, 0x01, 0xf6, 0x0e,
-  0xe9, 0x4c, 0xf3, 0x20, 0x0c, 0xe9, 0xfa, 0x06, 0x33, 0x41, 0x73, 0x49,
-  0x71, 0x33, 0x67, 0x21, 0x6f, 0x01, 0x7f, 0x17, 0x04, 0x3c, 0x60, 0x16,
-  0x09, 0x38, 0x28, 0xef, 0xf1, 0xe7, 0x05, 0xe4, 0x01, 0xea, 0x1b, 0xc9,
-  0xbc, 0xd0, 0xee, 0xf6, 0xe5, 0xd8, 0x92, 0xa7, 0xac, 0xcc, 0x16, 0xcc,
-  0xd5, 0x56, 0xd2, 0xb5, 0xcf, 0x3e, 0xd9, 0xda, 0x1e, 0x1b, 0x14, 0xab,
-  0xfc, 0xbe, 0x81, 0x92, 0x0a, 0x17, 0x0c, 0xb5, 0x45, 0x55, 0x6c, 0x46,
-  0x0d, 0x40, 0x16, 0x20, 0xf1, 0xa0, 0x1b, 0xdd, 0x68, 0x7f, 0x5a, 0x60,
-  0x01, 0xf0, 0x14, 0xf4, 0xdb, 0xe6, 0xf2, 0x11, 0x0e, 0xfe, 0x16, 0x06,
-  0xf2, 0x08, 0x00, 0xff, 0x0a, 0x16, 0x09, 0xe0, 0xfb, 0xf7, 0x05, 0x08,
-  0x19, 0x28, 0xe8, 0xf2, 0x16, 0xf0, 0xfd, 0xfb, 0xfb, 0x0c, 0xfc, 0xef,
-  0xe3, 0xf1, 0x48, 0x5e, 0xbd, 0x12, 0x68, 0x30, 0xf0, 0x05, 0x7f, 0x1e,
-  0xfd, 0xfc, 0x3f, 0xfd, 0xf5, 0x0b, 0x11, 0x09, 0x31, 0x02, 0x29, 0x00,
-  0x0e, 0x08, 0x2c, 0xfe, 0x2d, 0xf8, 0x15, 0x00, 0x2c, 0xc8, 0xff, 0xba,
-  0x31, 0xfe, 0xc2, 0xd2, 0xc9, 0xd1, 0xff, 0xc6, 0xb7, 0x0e, 0xd0, 0xaf,
-  0xb8, 0xf3, 0xe1, 0xac, 0x81, 0xa7, 0xae, 0xb9, 0xac, 0xcc, 0xd1, 0xaa,
-  0x02, 0x10, 0x0c, 0xdf, 0x16, 0xea, 0xf2, 0x01, 0xe9, 0x1f, 0x02, 0x03,
-  0x15, 0xf3, 0xf7, 0xc2, 0x06, 0xe1, 0x27, 0x32, 0xe5, 0x32, 0x6e, 0x7f,
-  0xec, 0x18, 0x39, 0x1a, 0x1e, 0x4d, 0x76, 0xfb, 0xeb, 0x00, 0x31, 0x09,
-  0xfe, 0x00, 0x11, 0xb4, 0xd7, 0xe1, 0xe2, 0x00, 0xc0, 0x1b, 0xb7, 0xf6,
-  0x0b, 0xdd, 0xef, 0xe6, 0xf8, 0x04, 0xe2, 0x11, 0x35, 0x1a, 0x47, 0x22,
-  0xfd, 0xcb, 0xcf, 0x81, 0x0e, 0xc4, 0xd8, 0xea, 0x2e, 0xeb, 0xed, 0xb7,
-  0xfb, 0xc0, 0xbc, 0xe4, 0x31, 0xbd, 0xd4, 0xdd, 0xfc, 0x20, 0xeb, 0xe6,
-  0xef, 0xd8, 0x21, 0xcf, 0x28, 0x03, 0xde, 0xe4, 0x29, 0x42, 0xe9, 0x14,
-  0x1c, 0xd9, 0xe3, 0xf6, 0x12, 0xdb, 0x01, 0xf7, 0x1e, 0xc8, 0x1d, 0xdc,
-  0xcf, 0x1d, 0xfa, 0xe7, 0x07, 0x14, 0x00, 0xde, 0x02, 0xf1, 0xe0, 0xe2,
-  0x35, 0xcf, 0xfd, 0x08, 0x3d, 0x07, 0x7d, 0x5c, 0x23, 0x23, 0x7f, 0x12,
-  0xed, 0xff, 0x6e, 0x3a, 0xfe, 0xf1, 0x36, 0x3a, 0xbc, 0xaa, 0xc4, 0x26,
-  0xf5, 0xcd, 0xf1, 0x1a, 0xd3, 0x96, 0xf9, 0xc1, 0x0d, 0x81, 0xaf, 0x13,
-  0xd2, 0xaf, 0xb1, 0x12, 0x06, 0xec, 0xec, 0x31, 0x13, 0x21, 0x21, 0x49,
-  0xd4, 0xf2, 0x7d, 0x4e, 0xc1, 0xdf, 0x65, 0x3c, 0x0b, 0xe3, 0x35, 0x29,
-  0x38, 0xd6, 0xe8, 0xce, 0x24, 0xcb, 0xe7, 0xf3, 0xb9, 0x25, 0xe6, 0x81,
-  0xc7, 0x1e, 0x09, 0xa6, 0x15, 0x5d, 0x3d, 0xea, 0xda, 0x4d, 0xfd, 0xea,
-  0x8c, 0xda, 0xc2, 0xd3, 0xab, 0xbc, 0xf0, 0x81, 0xb9, 0xf4, 0x39, 0xde,
-  0xb3, 0xf6, 0x63, 0xd5, 0xfb, 0x57, 0x13, 0x60, 0xfc, 0x0d, 0x37, 0x79,
-  0x03, 0x4e, 0x39, 0x6f, 0x05, 0x74, 0x25, 0x7f, 0xc8, 0xfc, 0xb0, 0x24,
-  0x14, 0xe2, 0x16, 0xfb, 0xf8, 0xd3, 0x1d, 0x5f, 0x26, 0x17, 0xfd, 0x7e,
-  0x42, 0xd0, 0x1f, 0x49, 0x29, 0xde, 0xe3, 0x14, 0xff, 0x22, 0x1a, 0xc9,
-  0xb0, 0x88, 0x08, 0x81, 0x91, 0xca, 0xa0, 0xba, 0xc5, 0xdc, 0xc4, 0x31,
-  0x0e, 0xdc, 0x3b, 0xf7, 0xe5, 0xd5, 0xb4, 0x0d, 0xfc, 0xfe, 0x17, 0x19,
-  0x19, 0xf9, 0xfe, 0xd1, 0xbd, 0xd3, 0x06, 0xc1, 0xf1, 0x05, 0xfb, 0xfa,
-  0x6b, 0x6b, 0x15, 0xf7, 0x4f, 0x7f, 0xfc, 0xf9, 0xd7, 0xff, 0x66, 0x56,
-  0xe1, 0xf8, 0x44, 0x4e, 0x1d, 0x20, 0x48, 0x36, 0x22, 0x1e, 0xde, 0x18,
-  0x23, 0x18, 0xff, 0x0e, 0xfe, 0xff, 0xd7, 0x21, 0x39, 0x27, 0xf4, 0xf7,
-  0xcc, 0xf9, 0xda, 0xdb, 0xfc, 0xf1, 0x1d, 0xe9, 0xd0, 0x2b, 0x1e, 0xcc,
-  0xe4, 0x08, 0xee, 0x39, 0x04, 0x17, 0x03, 0x0e, 0x1a, 0xfd, 0x30, 0x46,
-  0xde, 0xae, 0x11, 0x38, 0x93, 0xac, 0xa3, 0xcd, 0x5c, 0x16, 0x62, 0x51,
-  0x7f, 0x68, 0x47, 0x40, 0x12, 0x52, 0xe1, 0xda, 0xe2, 0x00, 0x00, 0xe3,
-  0xa4, 0xa2, 0x81, 0x9a, 0xd1, 0xfb, 0xdc, 0x00, 0x00, 0xfc, 0x55, 0x06,
-  0xed, 0x2f, 0xf3, 0x3d, 0xe7, 0xfe, 0xfd, 0xe9, 0xf8, 0x0c, 0xf4, 0xe7,
-  0x05, 0x16, 0x35, 0x0a, 0x26, 0x15, 0x12, 0x06, 0xb9, 0xe9, 0xcc, 0x0b,
-  0x61, 0x32, 0x7f, 0x46, 0x14, 0xf6, 0x07, 0xea, 0x1a, 0xfb, 0x73, 0x2a,
-  0x09, 0xed, 0x0f, 0x3b, 0x2e, 0xf1, 0x3e, 0x36, 0xde, 0xd2, 0xf2, 0x0d,
-  0x0e, 0xf0, 0x20, 0xd0, 0xd9, 0xfa, 0x1a, 0xf6, 0xd7, 0x01, 0xca, 0x01,
-  0xc7, 0xf5, 0x15, 0xfe, 0xad, 0x8c, 0xc8, 0xc1, 0xad, 0x1b, 0xe7, 0xcb,
-  0x9c, 0x18, 0xe0, 0xdb, 0xb3, 0xac, 0xe2, 0x06, 0x81, 0x0e, 0x02, 0xa3,
-  0x8c, 0xd9, 0x2c, 0xf7, 0xdb, 0xbe, 0x01, 0x26, 0xcd, 0x08, 0xd0, 0xf6,
-  0x0b, 0x12, 0x1c, 0xd8, 0xf7, 0xb6, 0xb5, 0x38, 0x5f, 0xc4, 0xb9, 0x03,
-  0x3a, 0xfd, 0xff, 0x27, 0xf4, 0xa5, 0x03, 0x5a, 0xff, 0xbd, 0x2d, 0x68,
-  0xd9, 0x02, 0x3e, 0x7f, 0xba, 0xaa, 0x1f, 0x2b, 0xf8, 0xd6, 0x0c, 0xfe,
-  0x24, 0xfa, 0xfa, 0xcb, 0x0f, 0x0c, 0xf1, 0xe7, 0x20, 0xf9, 0x1b, 0x0c,
-  0x14, 0xb7, 0xda, 0x90, 0xb9, 0xed, 0xe6, 0xa8, 0x06, 0x3b, 0xda, 0x90,
-  0xb0, 0xdd, 0x00, 0x91, 0x28, 0xdc, 0xcd, 0xad, 0xdc, 0xd8, 0xaf, 0xc2,
-  0x17, 0x04, 0xfd, 0x8e, 0xad, 0xdf, 0xf3, 0x84, 0xd1, 0xca, 0x1d, 0xad,
-  0xde, 0x2e, 0x36, 0x81, 0xb4, 0x81, 0xe6, 0xe5, 0xb0, 0x95, 0xec, 0xd3,
-  0xdf, 0x13, 0x26, 0x15, 0x00, 0xfd, 0xc6, 0xa3, 0x0d, 0xfb, 0x92, 0xc7,
-  0x5b, 0x49, 0x25, 0x0e, 0x59, 0x8b, 0xfe, 0xa5, 0xbf, 0xf6, 0xd3, 0x0d,
-  0x20, 0xb9, 0xa9, 0x1c, 0x31, 0xb8, 0xc3, 0x92, 0x0a, 0x15, 0xfc, 0xc3,
-  0xd7, 0x10, 0x20, 0xf8, 0xe0, 0x08, 0xea, 0xe2, 0x21, 0xe5, 0xda, 0xe7,
-  0x2a, 0x0e, 0x51, 0x05, 0x53, 0x0c, 0x52, 0x57, 0x30, 0x4c, 0x62, 0x5f,
-  0x7f, 0x2b, 0x09, 0x2b, 0x07, 0xaa, 0xfb, 0xe0, 0x20, 0xf6, 0x06, 0xd5,
-  0x32, 0x65, 0x49, 0x6f, 0x0d, 0xdb, 0x4c, 0x0b, 0x37, 0x2f, 0x23, 0x0c,
-  0xd4, 0x08, 0x42, 0xed, 0x02, 0x68, 0x4f, 0x7f, 0x3e, 0xfd, 0x42, 0x69,
-  0xdf, 0xdd, 0x41, 0xf8, 0xd9, 0x00, 0x33, 0xf7, 0x22, 0x38, 0xd6, 0x2e,
-  0xd1, 0x05, 0x28, 0x35, 0x26, 0xe5, 0xe5, 0xf4, 0xf4, 0xfe, 0xf3, 0x13,
-  0xfe, 0xea, 0x11, 0xdb, 0x28, 0x42, 0x1b, 0x34, 0xf4, 0x2f, 0x31, 0x23,
-  0x1b, 0x4b, 0x68, 0x7f, 0x01, 0x4d, 0x2b, 0x3a, 0xe8, 0xf8, 0x24, 0x08,
-  0x0c, 0xc5, 0xfa, 0x0e, 0x0d, 0xc3, 0xed, 0xf6, 0x6d, 0x15, 0x23, 0x38,
-  0x41, 0xda, 0xd3, 0xd3, 0x57, 0xa8, 0x9d, 0x03, 0x3d, 0xd2, 0xe0, 0xe2,
-  0x3f, 0xb3, 0xac, 0xbb, 0x31, 0xf5, 0x8f, 0xcb, 0x51, 0x1a, 0xa9, 0xc0,
-  0x5b, 0xdf, 0xc3, 0x1f, 0x49, 0x11, 0xf4, 0xed, 0x7f, 0x57, 0x43, 0xf0,
-  0x4d, 0x3f, 0x1f, 0x14, 0x2b, 0x72, 0x4f, 0x73, 0x1a, 0x0b, 0xcf, 0x46,
-  0x03, 0x7a, 0xf2, 0x1d, 0xe9, 0x0e, 0xf9, 0x28, 0xfe, 0xb5, 0xfc, 0xfd,
-  0x4a, 0xf4, 0xdb, 0xbc, 0x67, 0xd1, 0x08, 0xc8, 0xf4, 0x40, 0x01, 0xd7,
-  0xcb, 0x17, 0x9a, 0x81, 0x09, 0xfb, 0xc8, 0xc6, 0x3b, 0xbd, 0xfd, 0xda,
-  0xb1, 0xa3, 0xd4, 0x81, 0xd8, 0xf1, 0xaa, 0xb5, 0x05, 0x2d, 0x19, 0x14,
-  0x27, 0x23, 0x0a, 0xf1, 0x0c, 0xfa, 0xb9, 0xff, 0x1b, 0x27, 0xd1, 0xd6,
-  0x1b, 0x22, 0x18, 0xe6, 0x2f, 0xd5, 0xf8, 0xcb, 0x48, 0x74, 0x68, 0x73,
-  0x05, 0x07, 0xf2, 0x4f, 0x3f, 0x3c, 0x50, 0x7f, 0xc3, 0x9c, 0xec, 0xc3,
-  0xaf, 0xc0, 0xcd, 0x0b, 0x0e, 0xeb, 0xec, 0x4c, 0x3c, 0xd4, 0x3f, 0xed,
-  0x18, 0x1a, 0x3a, 0xff, 0x03, 0xe6, 0xf2, 0x1d, 0xee, 0xe7, 0x28, 0xcc,
-  0x4e, 0x43, 0x6d, 0x39, 0x4a, 0xfe, 0x7f, 0x38, 0x02, 0xff, 0x2f, 0x29,
-  0x11, 0xfe, 0x2c, 0x35, 0xf5, 0x06, 0xd6, 0x02, 0xde, 0xfd, 0x08, 0xf2,
-  0x23, 0xf3, 0x24, 0x0d, 0xfd, 0xea, 0x18, 0x32, 0x1c, 0xda, 0x02, 0x09,
-  0x07, 0xd1, 0xf5, 0xc5, 0x03, 0x0c, 0x57, 0x41, 0xba, 0xf9, 0xeb, 0x42,
-  0x47, 0x7f, 0x6c, 0x2e, 0xf2, 0xf5, 0xf8, 0x02, 0xff, 0xcf, 0xed, 0xcc,
-  0xce, 0x0b, 0xf9, 0xdb, 0x1e, 0xee, 0x02, 0x13, 0xf0, 0xf3, 0x07, 0x1f,
-  0x04, 0xeb, 0x00, 0xdb, 0x0a, 0xf2, 0xdf, 0x01, 0xfa, 0x21, 0xed, 0xbe,
-  0x12, 0x15, 0x4c, 0xf6, 0x55, 0x3a, 0x55, 0x55, 0x81, 0xa0, 0x24, 0x85,
-  0xf2, 0xb4, 0x91, 0xe0, 0x93, 0xca, 0xc5, 0xc2, 0xde, 0x44, 0xc6, 0xd2,
-  0x3f, 0x03, 0x5f, 0x5d, 0x7f, 0x6a, 0x4f, 0x7d, 0xf9, 0x5a, 0xe7, 0xed,
-  0x02, 0xc0, 0xc9, 0x81, 0xe2, 0xd6, 0xca, 0xe5, 0xf8, 0xd8, 0xfd, 0xc9,
-  0x14, 0xf3, 0x07, 0x06, 0x25, 0xd4, 0x11, 0x21, 0x25, 0xe6, 0xec, 0xda,
-  0xf3, 0xf6, 0xd3, 0x08, 0x30, 0xde, 0x0b, 0xcf, 0x21, 0xee, 0x07, 0xf9,
-  0x21, 0x17, 0xf0, 0x04, 0x5b, 0x69, 0x7f, 0x53, 0x38, 0x56, 0x0e, 0xfd,
-  0x6e, 0x45, 0x24, 0x2b, 0x10, 0xf0, 0xf1, 0xec, 0xd2, 0xe9, 0x07, 0xe0,
-  0xfa, 0x11, 0x04, 0xf8, 0x0e, 0x00, 0xbd, 0xbe, 0x1a, 0xdf, 0xf6, 0xad,
-  0xb8, 0x0a, 0xf7, 0xdc, 0xd9, 0xd9, 0x08, 0xea, 0x0b, 0xf1, 0xc6, 0xc9,
-  0x4a, 0xa6, 0xd5, 0x1a, 0x4b, 0x9c, 0x05, 0xc8, 0xd5, 0xc2, 0xaf, 0xe4,
-  0x39, 0xb7, 0x0e, 0xa8, 0x19, 0xe6, 0xb7, 0xe3, 0x7f, 0xdc, 0x33, 0x08,
-  0x34, 0x25, 0xce, 0xef, 0x76, 0x17, 0xa8, 0x13, 0x65, 0xd5, 0x14, 0xcd,
-  0x72, 0xab, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xc9, 0x96, 0x00, 0x00, 0x8d, 0x40, 0x00, 0x00, 0xc1, 0x37, 0x00, 0x00,
-  0x1c, 0x40, 0x00, 0x00, 0x30, 0x52, 0x00, 0x00, 0xb9, 0xfe, 0xff, 0xff,
-  0x1f, 0x25, 0xff, 0xff, 0xbc, 0x17, 0x00, 0x00, 0x47, 0x58, 0xff, 0xff,
-  0x97, 0x3f, 0x00, 0x00, 0x8c, 0x3e, 0x00, 0x00, 0x16, 0x8c, 0xff, 0xff,
-  0xb3, 0xf1, 0xff, 0xff, 0x6a, 0x12, 0x00, 0x00, 0xc2, 0x46, 0xff, 0xff,
-  0x03, 0xe6, 0xff, 0xff, 0x6e, 0x68, 0xff, 0xff, 0x55, 0x74, 0x00, 0x00,
-  0xe4, 0x34, 0x00, 0x00, 0xe8, 0x1f, 0xff, 0xff, 0xfc, 0x1d, 0x00, 0x00,
-  0x6e, 0x2a, 0xff, 0xff, 0xb1, 0x37, 0x00, 0x00, 0x01, 0x56, 0x00, 0x00,
-  0xe0, 0x6a, 0x00, 0x00, 0x03, 0x56, 0x00, 0x00, 0xb6, 0x4e, 0x00, 0x00,
-  0x21, 0xf5, 0xfe, 0xff, 0x3a, 0x33, 0x00, 0x00, 0xfa, 0xb6, 0x00, 0x00,
-  0x7e, 0x1b, 0x00, 0x00, 0x8c, 0xad, 0x00, 0x00, 0x61, 0xad, 0xff, 0xff,
-  0xd0, 0x3f, 0x00, 0x00, 0xee, 0x4e, 0x00, 0x00, 0xbe, 0x34, 0xff, 0xff,
-  0xc3, 0x45, 0x00, 0x00, 0x4e, 0x6a, 0xff, 0xff, 0x94, 0x6e, 0x00, 0x00,
-  0xff, 0xbb, 0xff, 0xff, 0x7e, 0x8a, 0xff, 0xff, 0x99, 0xaa, 0x00, 0x00,
-  0x83, 0x35, 0xff, 0xff, 0xd0, 0xb4, 0x00, 0x00, 0x4d, 0x40, 0x00, 0x00,
-  0xa6, 0xa2, 0xff, 0xff, 0x89, 0x3b, 0x00, 0x00, 0x85, 0x21, 0xff, 0xff,
-  0x44, 0x13, 0x00, 0x00, 0x89, 0xe8, 0xfe, 0xff, 0xfb, 0x4a, 0xff, 0xff,
-  0xce, 0x6c, 0x00, 0x00, 0x9f, 0xc3, 0x00, 0x00, 0x1a, 0x71, 0x00, 0x00,
-  0xb4, 0xf0, 0xff, 0xff, 0x6e, 0x56, 0x00, 0x00, 0x8e, 0x87, 0xff, 0xff,
-  0x0f, 0x55, 0x00, 0x00, 0x50, 0x71, 0x00, 0x00, 0xf4, 0x1a, 0x00, 0x00,
-  0x44, 0x2f, 0x00, 0x00, 0xa7, 0xac, 0xff, 0xff, 0x51, 0x01, 0x00, 0x00,
-  0xc7, 0xb3, 0xff, 0xff, 0x7e, 0xac, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0x92, 0x4d, 0xf5, 0x7f, 0x3d, 0x29, 0x94, 0x40,
-  0x0c, 0x4a, 0xb8, 0xad, 0x50, 0xf3, 0x38, 0x81, 0x37, 0xc8, 0x46, 0x37,
-  0x4e, 0x21, 0x0a, 0xa8, 0x32, 0x81, 0x85, 0x07, 0x01, 0xbc, 0x04, 0x71,
-  0xf4, 0xb3, 0x39, 0x55, 0xbf, 0x81, 0x66, 0xad, 0x81, 0x4a, 0xda, 0x93,
-  0xa1, 0x98, 0x54, 0x14, 0x4c, 0xad, 0xfb, 0xd4, 0xe6, 0xa5, 0x16, 0x62,
-  0xa7, 0x3f, 0x17, 0x1c, 0xd9, 0x81, 0x7f, 0xe6, 0xfd, 0x37, 0xc1, 0x5f,
-  0x55, 0xe5, 0xc4, 0x11, 0x0f, 0xde, 0x7f, 0x5d, 0xf7, 0xbb, 0x34, 0xd9,
-  0x25, 0x71, 0x15, 0xef, 0xbc, 0x63, 0xf4, 0x81, 0xba, 0x9e, 0x02, 0x54,
-  0xb7, 0x81, 0x7a, 0xcd, 0xd1, 0xd8, 0xeb, 0x7f, 0x81, 0xbe, 0xba, 0x7f,
-  0x3d, 0xb5, 0x53, 0x7f, 0x12, 0x84, 0x7f, 0x06, 0xe3, 0x75, 0x7f, 0x90,
-  0xa7, 0x81, 0x12, 0xd1, 0xe1, 0x1b, 0x5f, 0xb1, 0x37, 0x19, 0x51, 0xc9,
-  0x92, 0x3e, 0xf8, 0x97, 0x7f, 0x81, 0x7f, 0x58, 0x17, 0xe1, 0xa6, 0x7f,
-  0x81, 0x7f, 0x7f, 0xd4, 0xe6, 0xca, 0x7f, 0x7f, 0xcd, 0x7f, 0x00, 0xed,
-  0xb6, 0x1c, 0xe7, 0x1a, 0xe2, 0x32, 0x20, 0x55, 0x02, 0xb7, 0xf6, 0x18,
-  0x5c, 0x60, 0x7e, 0x4f, 0x38, 0x77, 0x7f, 0x36, 0xc5, 0x70, 0xe3, 0x13,
-  0xf5, 0x54, 0x36, 0xd0, 0xab, 0xab, 0x5a, 0xab, 0xe3, 0x7f, 0x7f, 0x81,
-  0x81, 0xca, 0xb5, 0x92, 0x89, 0xce, 0x2b, 0xfa, 0x45, 0xb9, 0x4a, 0x4a,
-  0x4a, 0x7f, 0x21, 0x09, 0xf1, 0x10, 0xda, 0xca, 0xf1, 0x24, 0xca, 0x39,
-  0x7f, 0xef, 0x9d, 0xf6, 0xaf, 0x10, 0x0b, 0x2e, 0x04, 0xb2, 0x0a, 0x50,
-  0x4f, 0xd6, 0x4d, 0xfa, 0xf5, 0x93, 0x0b, 0x35, 0xdc, 0xcf, 0x9a, 0xff,
-  0x4d, 0x2c, 0x3d, 0x7f, 0xf8, 0x2c, 0xfe, 0xf2, 0x17, 0x27, 0xef, 0xf9,
-  0xb9, 0xa4, 0xe9, 0xec, 0xc8, 0x01, 0xf0, 0xb0, 0xba, 0x7f, 0xb0, 0xc8,
-  0xff, 0x43, 0x08, 0xdd, 0xd2, 0xd6, 0x29, 0x0b, 0x94, 0xe4, 0x18, 0xe1,
-  0x81, 0x7f, 0xf1, 0xfd, 0x2e, 0x3c, 0x86, 0xcc, 0x04, 0x56, 0x3a, 0x29,
-  0xc4, 0x11, 0x7a, 0x91, 0x40, 0xae, 0x9b, 0x1a, 0x05, 0x20, 0x82, 0xe5,
-  0x60, 0xf2, 0x6f, 0x30, 0x21, 0x16, 0x08, 0x06, 0x81, 0xf5, 0x31, 0xc5,
-  0xbd, 0xff, 0x7f, 0x13, 0x9a, 0x4a, 0xeb, 0xcb, 0xdb, 0x98, 0xb6, 0x75,
-  0x81, 0x2c, 0x55, 0x15, 0x00, 0xb9, 0x71, 0xcb, 0x7f, 0xfe, 0xc9, 0x52,
-  0x7f, 0x52, 0xa3, 0x6f, 0x29, 0xbb, 0xc0, 0xfc, 0x42, 0xbf, 0xbf, 0x37,
-  0x7f, 0x6a, 0x2c, 0x16, 0xea, 0xef, 0xe0, 0x4a, 0x7f, 0x32, 0xee, 0x29,
-  0x64, 0x1e, 0x0c, 0xaf, 0x6a, 0x7f, 0xd6, 0xdb, 0x1e, 0xee, 0xa5, 0x0c,
-  0x64, 0x5c, 0x3e, 0xf8, 0x99, 0x42, 0xa7, 0xa8, 0x81, 0x4d, 0x21, 0x72,
-  0xb1, 0xdc, 0xda, 0xf2, 0x52, 0xd0, 0x4b, 0xe8, 0x90, 0xc1, 0xd9, 0x18,
-  0x9e, 0x49, 0x38, 0xcb, 0xab, 0xbb, 0x27, 0x3b, 0x39, 0xee, 0xc2, 0x2f,
-  0x35, 0x18, 0x4f, 0x28, 0x94, 0x1b, 0x81, 0x81, 0x14, 0x31, 0x08, 0xcc,
-  0xb8, 0x7b, 0xfb, 0x0d, 0xb3, 0x2a, 0x41, 0x7d, 0xc8, 0xa7, 0x20, 0x82,
-  0xb0, 0xbe, 0xd0, 0x66, 0x26, 0xc5, 0xe0, 0x81, 0x1b, 0xe2, 0xab, 0xb4,
-  0xda, 0xbc, 0xd3, 0x55, 0x4d, 0xde, 0x08, 0xa3, 0xf2, 0x2b, 0xce, 0x53,
-  0xbf, 0x48, 0x50, 0x81, 0x5a, 0x2c, 0x4e, 0xc2, 0x4b, 0xb2, 0xd4, 0x30,
-  0x1f, 0x17, 0xf7, 0x02, 0xb9, 0x0d, 0x18, 0xe8, 0x0c, 0xb5, 0x06, 0xcd,
-  0x7f, 0xda, 0x81, 0x7f, 0xf9, 0x6f, 0x81, 0xaf, 0x22, 0x07, 0xe3, 0x43,
-  0x2a, 0x25, 0x8e, 0xec, 0xf9, 0xd1, 0x1a, 0x2b, 0xf3, 0x4e, 0xba, 0xf6,
-  0x81, 0xf8, 0x3e, 0x7f, 0x4f, 0xc5, 0x12, 0x43, 0x48, 0x21, 0xc6, 0x7f,
-  0x5a, 0x4b, 0x7f, 0x86, 0xc6, 0xba, 0x1d, 0xba, 0xfc, 0x85, 0x35, 0x20,
-  0xe7, 0x02, 0x30, 0xe5, 0x74, 0xcf, 0x39, 0xd7, 0xae, 0xcf, 0x7f, 0x3c,
-  0x32, 0xaa, 0xea, 0xdc, 0x52, 0xbe, 0x94, 0x27, 0xe2, 0x7f, 0x24, 0x26,
-  0xd1, 0xf4, 0x81, 0xb5, 0x13, 0x3a, 0x61, 0x55, 0x81, 0x81, 0x11, 0x92,
-  0x08, 0x7f, 0xfb, 0x33, 0x3d, 0x02, 0xa9, 0x11, 0xe5, 0x8d, 0x26, 0x16,
-  0x47, 0x48, 0x1a, 0xe8, 0xca, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x04, 0x15, 0x00, 0x00, 0x66, 0xec, 0xff, 0xff,
-  0x1e, 0xfc, 0xff, 0xff, 0xe3, 0xfe, 0xff, 0xff, 0x09, 0xfb, 0xff, 0xff,
-  0xfe, 0x08, 0x00, 0x00, 0xc1, 0xf2, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x6f, 0xf4, 0xff, 0xff, 0xb2, 0xfd, 0xff, 0xff, 0x31, 0xf9, 0xff, 0xff,
-  0xbb, 0xf6, 0xff, 0xff, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00,
-  0xd6, 0xf7, 0xff, 0xff, 0x62, 0x04, 0x00, 0x00, 0xe2, 0xf5, 0xff, 0xff,
-  0x8e, 0xfc, 0xff, 0xff, 0xb4, 0xfd, 0xff, 0xff, 0xad, 0xf2, 0xff, 0xff,
-  0xd0, 0xfa, 0xff, 0xff, 0x50, 0xf3, 0xff, 0xff, 0x80, 0x02, 0x00, 0x00,
-  0x1d, 0x0a, 0x00, 0x00, 0xa5, 0x05, 0x00, 0x00, 0x55, 0x06, 0x00, 0x00,
-  0xc4, 0x09, 0x00, 0x00, 0x7b, 0xff, 0xff, 0xff, 0xde, 0xfd, 0xff, 0xff,
-  0x26, 0x0d, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xfc, 0xec, 0xff, 0xff,
-  0x25, 0xfc, 0xff, 0xff, 0x2b, 0xfc, 0xff, 0xff, 0x9b, 0x05, 0x00, 0x00,
-  0x13, 0xf0, 0xff, 0xff, 0x35, 0x03, 0x00, 0x00, 0xbf, 0x02, 0x00, 0x00,
-  0x1b, 0x04, 0x00, 0x00, 0xeb, 0xf8, 0xff, 0xff, 0xa6, 0xf7, 0xff, 0xff,
-  0x2a, 0xf6, 0xff, 0xff, 0x49, 0xf6, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff,
-  0x34, 0x06, 0x00, 0x00, 0x09, 0x0f, 0x00, 0x00, 0xd9, 0xf6, 0xff, 0xff,
-  0x3e, 0xf3, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xf4, 0xe8, 0xff, 0xff,
-  0x00, 0xf6, 0xff, 0xff, 0x31, 0x13, 0x00, 0x00, 0x2e, 0x13, 0x00, 0x00,
-  0x99, 0x0e, 0x00, 0x00, 0x83, 0xfc, 0xff, 0xff, 0x95, 0x04, 0x00, 0x00,
-  0x8f, 0x15, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff, 0xaf, 0xf1, 0xff, 0xff,
-  0x0e, 0xfd, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x7c, 0x0c, 0x00, 0x00,
-  0x95, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00, 0xd6, 0xaf, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xd9, 0x6c, 0xaf, 0xba,
-  0x98, 0x4e, 0xf0, 0x10, 0x75, 0x68, 0xfd, 0xbf, 0x81, 0xc6, 0x4a, 0xed,
-  0xe2, 0x91, 0xf5, 0x62, 0xcc, 0xec, 0x3b, 0xaa, 0xc7, 0xdd, 0x60, 0xaa,
-  0x74, 0xc1, 0x4a, 0x9e, 0x2f, 0xf0, 0x4e, 0xda, 0x66, 0xe5, 0x62, 0xc0,
-  0x5a, 0x25, 0x47, 0x9d, 0xb7, 0x5e, 0xbf, 0x6d, 0xe9, 0xff, 0x5c, 0x4c,
-  0x51, 0xe8, 0x8c, 0x04, 0xaa, 0xe2, 0x2b, 0xd6, 0xeb, 0xe4, 0x5a, 0x38,
-  0xc8, 0x4d, 0xaa, 0xf3, 0xe5, 0xec, 0xfd, 0x38, 0x35, 0xed, 0xe1, 0x9f,
-  0xfe, 0x2b, 0x02, 0xed, 0x2c, 0xa5, 0xb8, 0xbc, 0x4a, 0xc4, 0x5d, 0x00,
-  0x00, 0xf1, 0xfd, 0x34, 0x81, 0xd3, 0xa5, 0x39, 0xb2, 0x15, 0x09, 0xec,
-  0xe5, 0x30, 0x37, 0xfb, 0x31, 0xe6, 0xd7, 0xab, 0xe7, 0xf4, 0xbf, 0xb9,
-  0xe6, 0x05, 0xa4, 0x5a, 0x38, 0xa7, 0x37, 0x9e, 0x21, 0x90, 0x26, 0x46,
-  0xc4, 0x10, 0x2a, 0xc8, 0x3c, 0x3f, 0x0d, 0x05, 0x0a, 0x20, 0xbd, 0x24,
-  0xcf, 0xb6, 0x26, 0xe6, 0x7f, 0x5c, 0x41, 0xc4, 0x1e, 0xe5, 0x3e, 0x1c,
-  0x07, 0xbf, 0xf2, 0x4b, 0xfa, 0x0e, 0xc9, 0x16, 0xdf, 0x07, 0x50, 0xd8,
-  0xce, 0x3c, 0xcf, 0x47, 0xfe, 0xc5, 0xb2, 0x49, 0xf2, 0x2b, 0xc5, 0x18,
-  0x4c, 0xd1, 0x37, 0x34, 0xd5, 0xcc, 0x30, 0xf1, 0x45, 0x11, 0x0f, 0xdc,
-  0x3d, 0x03, 0xef, 0x5c, 0x03, 0x30, 0xe4, 0xd7, 0x39, 0x89, 0x24, 0x9a,
-  0x81, 0xb8, 0x18, 0xf2, 0x26, 0xe5, 0x3c, 0xcf, 0xf0, 0xe9, 0xa1, 0x11,
-  0xfb, 0x11, 0xb7, 0xea, 0x62, 0xeb, 0xeb, 0xde, 0xe4, 0xcb, 0x29, 0xd2,
-  0x30, 0x32, 0xba, 0x2e, 0xb6, 0x31, 0xcc, 0xc6, 0xc4, 0x28, 0xab, 0x0a,
-  0x9e, 0x0e, 0xfc, 0x0c, 0x35, 0xef, 0x0b, 0x30, 0xac, 0x1c, 0xfe, 0xfe,
-  0xe0, 0x1d, 0xba, 0x4a, 0x5f, 0x24, 0x3a, 0xd8, 0x29, 0xb7, 0xca, 0xc0,
-  0xb1, 0x91, 0xb4, 0x07, 0x8a, 0xcc, 0x62, 0xca, 0x15, 0x95, 0xeb, 0x04,
-  0x31, 0xa4, 0xb0, 0x0d, 0xa4, 0x94, 0xd8, 0xd4, 0x0c, 0x42, 0xc3, 0x7a,
-  0xd3, 0x7d, 0xd1, 0x7f, 0x2b, 0x56, 0xd5, 0xe3, 0x2b, 0x4a, 0x3e, 0xac,
-  0x2f, 0x04, 0x1f, 0xba, 0xb9, 0xf6, 0xa5, 0xe9, 0x7c, 0x3f, 0xe8, 0x08,
-  0xd6, 0xb4, 0x2d, 0x36, 0xa4, 0x60, 0x07, 0x90, 0xdd, 0xfe, 0xcb, 0x40,
-  0xd0, 0xc4, 0x1b, 0x36, 0xa3, 0xc1, 0x39, 0x42, 0x5a, 0xc9, 0xa3, 0xae,
-  0xf4, 0xc4, 0x05, 0x21, 0xc5, 0x37, 0xa3, 0x14, 0x59, 0x7f, 0x58, 0x63,
-  0x4a, 0xd2, 0xca, 0xea, 0x37, 0xf9, 0xfc, 0x08, 0xfd, 0x61, 0x31, 0x6d,
-  0x36, 0x62, 0x20, 0x12, 0x0d, 0xab, 0x6b, 0xf8, 0xb1, 0x73, 0x6d, 0x29,
-  0x6f, 0xbc, 0xac, 0x3b, 0x6a, 0xf8, 0x24, 0xbd, 0x0a, 0xee, 0xc2, 0xe4,
-  0xed, 0x5a, 0x59, 0x27, 0x56, 0x99, 0xd2, 0x68, 0x30, 0xe9, 0x06, 0x6a,
-  0x23, 0x1d, 0x14, 0xcb, 0xbc, 0x7f, 0x1e, 0x1c, 0x73, 0x28, 0xf6, 0xea,
-  0xe4, 0x2f, 0xbd, 0x10, 0xfa, 0x3c, 0xec, 0x06, 0x03, 0xf2, 0xab, 0xb3,
-  0xd9, 0x6d, 0x0e, 0x6a, 0x37, 0x4e, 0x75, 0x24, 0xcd, 0xca, 0xf0, 0x11,
-  0x1a, 0x17, 0xc0, 0xf1, 0x3a, 0xe1, 0x55, 0x61, 0xd2, 0x41, 0xfe, 0xad,
-  0x38, 0x21, 0x02, 0x26, 0x3d, 0x09, 0x15, 0x62, 0xef, 0x09, 0x88, 0x06,
-  0xc9, 0xb8, 0x17, 0x08, 0xbf, 0x4b, 0xed, 0xa4, 0x6a, 0x83, 0x5b, 0x22,
-  0x81, 0x10, 0x75, 0xc3, 0xc4, 0x22, 0xf3, 0x9a, 0x60, 0xc7, 0x6a, 0xcc,
-  0x35, 0xbc, 0xfb, 0x67, 0xb7, 0xce, 0xaa, 0x37, 0x9c, 0xf0, 0x12, 0x17,
-  0xd9, 0xe4, 0x65, 0xdc, 0x60, 0x35, 0xf5, 0x06, 0x3d, 0xbe, 0x55, 0xc8,
-  0x42, 0x5d, 0x43, 0xf5, 0xe7, 0x42, 0x84, 0xcc, 0x02, 0x0a, 0x5d, 0x35,
-  0x1e, 0x0a, 0xb6, 0x9a, 0xe7, 0x39, 0xcb, 0x34, 0xcc, 0x7f, 0x74, 0xc4,
-  0xd7, 0x39, 0xd3, 0x25, 0x42, 0x49, 0x30, 0x55, 0xdb, 0x21, 0xb4, 0xef,
-  0x6c, 0x6e, 0xe2, 0x65, 0x09, 0x33, 0xaa, 0xd9, 0xd7, 0xb0, 0x16, 0x43,
-  0xcf, 0x72, 0xd0, 0xa6, 0x69, 0x6d, 0xb5, 0xc7, 0x1d, 0xa2, 0xb0, 0x57,
-  0x96, 0x33, 0x6d, 0xc9, 0x00, 0x2d, 0x9b, 0xbb, 0x47, 0x54, 0x4f, 0x2c,
-  0xfc, 0x52, 0xc2, 0xea, 0x53, 0x08, 0x10, 0x8b, 0x56, 0x50, 0x3d, 0xd7,
-  0xc0, 0x46, 0xe2, 0xed, 0x45, 0xb7, 0x4d, 0x38, 0x7f, 0x27, 0x38, 0xf5,
-  0xdd, 0xb7, 0x30, 0x2b, 0xb9, 0x36, 0x27, 0x1c, 0x01, 0x2e, 0x41, 0xee,
-  0xd3, 0x54, 0xf1, 0x18, 0x00, 0x3b, 0x11, 0x19, 0xbb, 0x16, 0x37, 0xa4,
-  0x18, 0x0a, 0x20, 0xd5, 0x1e, 0x01, 0x33, 0xd0, 0xee, 0x1c, 0x55, 0xed,
-  0xe2, 0x36, 0x9e, 0xe8, 0x23, 0x34, 0xb9, 0xb0, 0xff, 0xd7, 0xae, 0xa2,
-  0x7f, 0xa4, 0x41, 0xce, 0x12, 0x46, 0xbb, 0xac, 0x4b, 0xe0, 0xcc, 0x28,
-  0x4e, 0xb7, 0x6f, 0xe8, 0xbf, 0x5c, 0x56, 0x42, 0xf7, 0xed, 0x0f, 0x1a,
-  0x11, 0xfa, 0xfe, 0x5c, 0xfc, 0x5e, 0x5e, 0x53, 0xbe, 0xf8, 0x70, 0x49,
-  0x20, 0xcf, 0x38, 0xf7, 0x48, 0x3c, 0x64, 0x07, 0xc6, 0xb4, 0xeb, 0x18,
-  0xe6, 0x19, 0xfd, 0x4c, 0x1e, 0x6e, 0x10, 0x4a, 0x1c, 0xf0, 0x36, 0x69,
-  0x37, 0x42, 0x75, 0x3f, 0xcd, 0xcd, 0x0b, 0xfc, 0x00, 0x23, 0x5a, 0x66,
-  0xbd, 0x85, 0x28, 0x1f, 0x0c, 0x77, 0x24, 0x1c, 0x1c, 0xd4, 0x3f, 0x2d,
-  0xfa, 0x94, 0xfc, 0x46, 0xe8, 0xaf, 0x97, 0x31, 0xf3, 0x7e, 0x5d, 0xff,
-  0xdb, 0x11, 0x1f, 0x57, 0x00, 0xd2, 0xfb, 0x61, 0xc1, 0x7f, 0x6b, 0x21,
-  0xd5, 0xd9, 0xde, 0x3d, 0x51, 0x24, 0x3b, 0x21, 0x04, 0x2b, 0x11, 0x4e,
-  0xa6, 0xf1, 0x4f, 0x3b, 0xb4, 0xb3, 0xd7, 0x25, 0x6d, 0xdd, 0xd2, 0xad,
-  0x57, 0x32, 0x4f, 0xe1, 0x1c, 0xde, 0x6b, 0x33, 0xe8, 0x3a, 0xe5, 0x1d,
-  0x5a, 0xff, 0x59, 0x2e, 0x7f, 0x19, 0x59, 0x3d, 0x0a, 0x9d, 0x42, 0xf1,
-  0x09, 0xc0, 0x1c, 0x2f, 0x1f, 0xda, 0x0b, 0xed, 0x1a, 0x51, 0x37, 0x11,
-  0xce, 0xf1, 0x3e, 0xf1, 0x5f, 0xae, 0x3a, 0xc0, 0xc0, 0x9c, 0xa0, 0x3c,
-  0xd2, 0x9c, 0x7f, 0x25, 0x34, 0xa6, 0x2a, 0xb3, 0x31, 0x4b, 0xef, 0xd2,
-  0x1e, 0x99, 0x24, 0x2f, 0xb3, 0x49, 0xef, 0xfc, 0xaa, 0x7f, 0x0c, 0xd8,
-  0xfc, 0xd3, 0xd3, 0xf9, 0xc8, 0x20, 0xf5, 0xda, 0xce, 0x47, 0xfb, 0xeb,
-  0x4e, 0xdf, 0x2a, 0xdb, 0xf9, 0x3e, 0xef, 0xea, 0xb8, 0xc4, 0xdd, 0xb8,
-  0x3b, 0x16, 0xf7, 0x0c, 0x33, 0xd0, 0x37, 0xc9, 0xd1, 0x1b, 0x30, 0xe2,
-  0xd1, 0x3a, 0x44, 0xf0, 0xe0, 0xb1, 0x37, 0x4e, 0xc4, 0x05, 0x3b, 0x23,
-  0xdf, 0xd5, 0x3d, 0x31, 0xfc, 0xcb, 0xc3, 0xe2, 0xb9, 0x95, 0x2e, 0x83,
-  0xc7, 0xa0, 0x41, 0x0c, 0x08, 0x12, 0x38, 0xff, 0x04, 0xed, 0xbc, 0xa9,
-  0x0f, 0x95, 0xdf, 0x1c, 0x68, 0x02, 0x58, 0x3f, 0xd8, 0x10, 0xf6, 0x27,
-  0xd0, 0x4a, 0x3e, 0x90, 0x4d, 0x21, 0xe9, 0x1c, 0xbf, 0xc8, 0x24, 0xe2,
-  0xaf, 0x13, 0xf7, 0xf6, 0xc7, 0x51, 0x24, 0x8d, 0x81, 0x8d, 0x5a, 0xe9,
-  0xde, 0xc5, 0x62, 0xfc, 0x49, 0xc6, 0x17, 0x28, 0xcc, 0xa5, 0x17, 0x36,
-  0x18, 0xe9, 0xd7, 0xa2, 0xb5, 0xe2, 0x00, 0xea, 0xf6, 0xa3, 0x9b, 0xa0,
-  0xe4, 0xa2, 0xeb, 0xe6, 0x5a, 0x7f, 0x29, 0x0c, 0x9e, 0xf3, 0x23, 0x14,
-  0x5f, 0x52, 0x00, 0xf4, 0xd3, 0xbd, 0xdb, 0xd4, 0xb2, 0x24, 0x30, 0x33,
-  0xa1, 0x24, 0x0d, 0xff, 0x7a, 0xa9, 0x95, 0x30, 0x5d, 0xb6, 0xd5, 0xd0,
-  0x49, 0x52, 0x09, 0xc2, 0x14, 0xd6, 0xa2, 0xcb, 0xda, 0x39, 0xfc, 0x39,
-  0x40, 0x96, 0xd6, 0xa7, 0xc6, 0xe2, 0xe8, 0xbb, 0x53, 0x83, 0xf2, 0x24,
-  0x85, 0x76, 0xb5, 0x35, 0xf9, 0x4f, 0xdd, 0xd5, 0x38, 0x66, 0x64, 0xfc,
-  0x23, 0x7f, 0xba, 0x1f, 0x89, 0xce, 0x16, 0xfb, 0x51, 0x5f, 0xb8, 0xd2,
-  0x1d, 0x92, 0xf8, 0x8e, 0xaf, 0x70, 0x0f, 0x01, 0x59, 0xfd, 0xf4, 0xb0,
-  0xb1, 0x2c, 0xf3, 0xc0, 0xce, 0x05, 0xfa, 0xef, 0x6c, 0xa9, 0x54, 0xb6,
-  0xe1, 0xe7, 0xf5, 0x70, 0xc8, 0xe4, 0xb9, 0x2e, 0xdb, 0xc5, 0x32, 0x81,
-  0x00, 0x32, 0xdb, 0x17, 0xbb, 0xda, 0xf8, 0x00, 0xe1, 0xa8, 0x42, 0xd1,
-  0xcc, 0xf1, 0xf5, 0xc2, 0xc1, 0x2d, 0xdd, 0x1d, 0xff, 0xff, 0xf4, 0x23,
-  0x2f, 0xe6, 0xe8, 0xfe, 0xc6, 0xe2, 0x35, 0x08, 0x31, 0xc5, 0x38, 0xdd,
-  0xce, 0xc2, 0xf5, 0xc6, 0xc2, 0xf0, 0xf2, 0x20, 0x0e, 0xf8, 0x13, 0xc2,
-  0xd5, 0xca, 0xe6, 0x30, 0xca, 0xf5, 0xa8, 0x18, 0x18, 0xbd, 0x63, 0x48,
-  0xd5, 0xc9, 0x34, 0xec, 0x70, 0xc1, 0xfd, 0xc8, 0xfa, 0xe2, 0x51, 0x4e,
-  0x08, 0x2b, 0x24, 0x16, 0x3e, 0x51, 0x25, 0xf6, 0x33, 0xcd, 0xd0, 0x15,
-  0x1f, 0xf2, 0x4b, 0xc5, 0x42, 0xe2, 0xa8, 0x23, 0xd7, 0x36, 0xf4, 0xd0,
-  0x04, 0x23, 0x01, 0x81, 0xc4, 0x50, 0xc3, 0xed, 0x68, 0x0c, 0x46, 0xe8,
-  0x08, 0x2c, 0x40, 0xb0, 0x27, 0x2a, 0x01, 0xf5, 0x4f, 0xa8, 0x2b, 0x39,
-  0x21, 0x09, 0xb9, 0x26, 0x15, 0xbb, 0xd7, 0x0f, 0x08, 0x7f, 0x2d, 0xfc,
-  0x14, 0x03, 0xee, 0xcc, 0xdc, 0x2f, 0x13, 0x2d, 0x35, 0xfc, 0x1f, 0xff,
-  0xb5, 0xe6, 0xee, 0x01, 0xc9, 0x40, 0x2c, 0x1a, 0xe2, 0x00, 0xfe, 0x01,
-  0xc9, 0x16, 0xca, 0xda, 0x0f, 0xd6, 0x19, 0xcd, 0xdd, 0xde, 0x2e, 0x04,
-  0x4d, 0x10, 0xe6, 0xe9, 0xea, 0x3d, 0x34, 0xa7, 0x20, 0xf9, 0xe5, 0xe8,
-  0x0d, 0x50, 0x9e, 0xda, 0x35, 0x43, 0x0d, 0xfd, 0xd7, 0x2e, 0x3f, 0xaf,
-  0xfd, 0x06, 0x11, 0x0f, 0x66, 0x22, 0x29, 0xbd, 0x5d, 0x27, 0xe7, 0x26,
-  0x17, 0x3c, 0x05, 0x15, 0x7f, 0xf1, 0x5b, 0x33, 0x6b, 0x4a, 0x16, 0x03,
-  0x5a, 0xd2, 0xae, 0x32, 0xab, 0xf8, 0x97, 0xba, 0xca, 0xeb, 0x58, 0x91,
-  0x3f, 0xb2, 0x39, 0x14, 0xcb, 0x97, 0xc5, 0x07, 0xab, 0x37, 0xf4, 0x61,
-  0xa5, 0x3c, 0xee, 0xfc, 0x19, 0xaa, 0xc5, 0xe9, 0xb5, 0xed, 0x8b, 0x5d,
-  0xb6, 0xeb, 0xd2, 0xa5, 0x39, 0xd5, 0xbb, 0x15, 0x2a, 0x03, 0xaf, 0xd8,
-  0xd3, 0xc8, 0xe5, 0xf8, 0xd9, 0xda, 0x31, 0xb6, 0xdd, 0xb8, 0x3a, 0xd1,
-  0x87, 0x0e, 0xe8, 0x1e, 0xa4, 0x00, 0xe5, 0xb0, 0x1e, 0x14, 0xcd, 0xf0,
-  0xd2, 0xe4, 0xe2, 0xb5, 0x9d, 0xe9, 0x42, 0xb5, 0xf4, 0xd0, 0x02, 0xfa,
-  0xb1, 0x3c, 0xd5, 0xff, 0x1e, 0xe7, 0xca, 0x81, 0xbe, 0xcf, 0xb7, 0xe0,
-  0xe8, 0x20, 0x23, 0xae, 0x94, 0x59, 0x81, 0x3f, 0xfa, 0xc4, 0x63, 0xe0,
-  0xa5, 0x3c, 0x42, 0xcd, 0x17, 0x1d, 0x31, 0xf8, 0xfd, 0x33, 0xe7, 0xad,
-  0x30, 0x53, 0x2a, 0x29, 0x24, 0xcf, 0x0d, 0x55, 0xf8, 0x16, 0x8a, 0x95,
-  0x8a, 0x51, 0xb3, 0x2f, 0x4f, 0xbc, 0x9e, 0xc4, 0x6e, 0x50, 0x40, 0x5f,
-  0xcd, 0x27, 0xc6, 0x66, 0xe1, 0xcb, 0xac, 0x46, 0x2f, 0x4f, 0x4d, 0x2a,
-  0x35, 0x71, 0x4b, 0x6e, 0xab, 0xe5, 0x7f, 0xc6, 0x46, 0xd7, 0x53, 0x14,
-  0x0a, 0x9f, 0x59, 0x2e, 0x31, 0x47, 0x0a, 0x9e, 0x43, 0x05, 0x29, 0xf3,
-  0x4d, 0x49, 0x12, 0xdf, 0xd9, 0x2d, 0xb5, 0x3f, 0x18, 0xa2, 0xc9, 0x57,
-  0x51, 0x4e, 0xf6, 0x26, 0xcc, 0xef, 0xdd, 0x6a, 0x13, 0x5e, 0x43, 0xec,
-  0x62, 0xa7, 0xcc, 0x02, 0x38, 0x64, 0x29, 0x0c, 0x5c, 0x0a, 0x67, 0x0c,
-  0xeb, 0x3e, 0xc8, 0xd2, 0x1a, 0xe4, 0x12, 0x52, 0xe7, 0x2b, 0x76, 0x14,
-  0x03, 0xf2, 0xcd, 0xd0, 0x32, 0x57, 0xc3, 0x24, 0xe9, 0x17, 0xf9, 0xcd,
-  0x21, 0xb5, 0xe2, 0x1c, 0xb7, 0xbc, 0xc9, 0x3d, 0xb3, 0xda, 0x01, 0x57,
-  0x14, 0x1a, 0x7a, 0x12, 0xbb, 0x60, 0xa1, 0x4e, 0xb3, 0x2a, 0xa6, 0x25,
-  0x20, 0xe1, 0xdc, 0xa1, 0x74, 0x13, 0x33, 0xa6, 0x76, 0xbe, 0xb7, 0xac,
-  0xd7, 0x50, 0x21, 0xdf, 0x00, 0xba, 0xc9, 0x7f, 0x70, 0xfc, 0xe8, 0xbd,
-  0xa2, 0x9e, 0xef, 0xe8, 0x34, 0x1f, 0xb5, 0x88, 0xc4, 0xac, 0x04, 0x20,
-  0xd6, 0xce, 0xeb, 0xd1, 0x03, 0xb7, 0x12, 0xb1, 0xba, 0xbe, 0x50, 0x3d,
-  0x4b, 0xcb, 0x4b, 0xd0, 0x36, 0x67, 0x43, 0xdb, 0x67, 0x42, 0x90, 0x60,
-  0x81, 0xe7, 0xc8, 0x6f, 0x28, 0x88, 0x12, 0xdc, 0x75, 0x19, 0xe4, 0x23,
-  0x16, 0x3a, 0xa4, 0x54, 0xb3, 0x9f, 0x3c, 0x45, 0x85, 0xa5, 0xa0, 0xc4,
-  0x0b, 0x4f, 0x28, 0xa9, 0xde, 0x0a, 0x3f, 0x05, 0x5a, 0x20, 0xb9, 0x18,
-  0xea, 0x27, 0x22, 0xee, 0x03, 0xfe, 0x46, 0x49, 0x0a, 0x37, 0x47, 0x25,
-  0xdd, 0x11, 0xbf, 0x39, 0xa5, 0x05, 0xc2, 0x3a, 0x81, 0xfc, 0xf8, 0x12,
-  0x14, 0x5f, 0x67, 0x2b, 0xea, 0xf2, 0xf8, 0x02, 0xe6, 0x38, 0x38, 0xe5,
-  0x22, 0xd2, 0x30, 0xe0, 0x2f, 0xf3, 0xd5, 0x39, 0xf6, 0x53, 0xbd, 0x2f,
-  0x29, 0x29, 0x4b, 0xd4, 0xeb, 0x51, 0x06, 0xd2, 0x4d, 0x30, 0xfc, 0x5c,
-  0xd2, 0xf5, 0x9a, 0xd9, 0xb6, 0x1a, 0xc1, 0x32, 0xd5, 0xf0, 0xfb, 0xd6,
-  0xe0, 0x0f, 0x7f, 0x09, 0x35, 0xbe, 0x97, 0xe8, 0x7c, 0xec, 0x77, 0xd8,
-  0xfd, 0xb1, 0x59, 0x50, 0xd0, 0x24, 0xd4, 0x5e, 0xd6, 0xfa, 0xd9, 0xe8,
-  0x06, 0x87, 0x29, 0x13, 0xbb, 0x21, 0xde, 0x0f, 0xa0, 0xd8, 0xb9, 0x03,
-  0x16, 0xd8, 0x27, 0xe6, 0xed, 0xff, 0xdc, 0x4b, 0x0e, 0xb8, 0xbe, 0x2f,
-  0x21, 0xd8, 0x39, 0x41, 0x18, 0x1a, 0xbe, 0xb7, 0xf9, 0x2f, 0xe8, 0x2b,
-  0x3f, 0xc3, 0xe1, 0xd8, 0xcf, 0x2d, 0x12, 0xb2, 0x81, 0x30, 0x0a, 0xe5,
-  0xa5, 0x06, 0xda, 0x3f, 0x67, 0x22, 0xfc, 0x3e, 0x29, 0x55, 0xfb, 0x23,
-  0xbf, 0xfe, 0xb0, 0x33, 0x07, 0xc5, 0x45, 0x19, 0x10, 0x3a, 0x31, 0x35,
-  0xb8, 0x46, 0x20, 0xf9, 0xc0, 0xef, 0xb3, 0xc4, 0x04, 0x25, 0x0e, 0xef,
-  0xbf, 0x1e, 0xda, 0xc7, 0x02, 0x0e, 0x52, 0x9b, 0xf5, 0xe0, 0x36, 0xa3,
-  0xa6, 0x05, 0xc4, 0xf3, 0x20, 0x6b, 0x81, 0xe5, 0xb3, 0x65, 0x06, 0xf8,
-  0xd6, 0x2e, 0xf8, 0x55, 0x4e, 0xbd, 0xff, 0xcb, 0x21, 0xe0, 0x12, 0x2e,
-  0x19, 0x03, 0xf3, 0xe3, 0x26, 0xe4, 0xc4, 0xd8, 0xa1, 0xc7, 0xbf, 0x3c,
-  0x78, 0x09, 0xc6, 0x09, 0x5d, 0xbd, 0xc5, 0x06, 0x22, 0x53, 0x37, 0xd4,
-  0xfd, 0x6e, 0x01, 0x3d, 0xd5, 0x6a, 0xc1, 0x4a, 0xde, 0x36, 0xf3, 0xde,
-  0x04, 0xcc, 0x4b, 0x1d, 0x18, 0x8f, 0xe5, 0x15, 0x29, 0x7f, 0xc7, 0x2d,
-  0x01, 0xf3, 0x08, 0x16, 0x01, 0x3c, 0x05, 0x03, 0x15, 0x35, 0x46, 0xf5,
-  0x40, 0xfe, 0x3f, 0x35, 0xdd, 0xd4, 0xc0, 0xdc, 0x4e, 0x0d, 0x1b, 0x23,
-  0xab, 0x46, 0x2c, 0x28, 0x1e, 0xe1, 0x19, 0x05, 0xff, 0xc2, 0x14, 0x32,
-  0xb3, 0x06, 0x27, 0x27, 0x5b, 0x6e, 0xdd, 0xf7, 0xe4, 0x48, 0xd3, 0x14,
-  0xe6, 0x5e, 0x1f, 0x1e, 0x7f, 0x9a, 0x0d, 0x49, 0xb1, 0xf9, 0xeb, 0xee,
-  0x0e, 0x23, 0xd0, 0xf0, 0x48, 0xe6, 0xc0, 0x48, 0x57, 0x1b, 0x9b, 0xed,
-  0xc2, 0x74, 0x53, 0xe7, 0x2b, 0xfa, 0xdd, 0x40, 0x01, 0xf1, 0xbe, 0x10,
-  0x3b, 0xca, 0xae, 0xc4, 0xa2, 0xdf, 0xf5, 0x15, 0xcc, 0x31, 0x1d, 0x47,
-  0x64, 0x18, 0xfa, 0x1c, 0xd0, 0xe3, 0x47, 0xdb, 0xbe, 0xbb, 0xb5, 0x26,
-  0xd0, 0x6c, 0x3a, 0x13, 0xad, 0xf0, 0xc1, 0x88, 0x09, 0x3a, 0x8d, 0x06,
-  0x41, 0x50, 0xb6, 0x9e, 0x22, 0x81, 0x13, 0xd6, 0xc8, 0x8c, 0x02, 0xe2,
-  0x1d, 0xb2, 0xac, 0x1c, 0x44, 0x72, 0x35, 0x3a, 0xfb, 0xa9, 0x28, 0xca,
-  0x34, 0x7a, 0x10, 0x23, 0x27, 0x1d, 0xa1, 0x4f, 0x96, 0x6a, 0x16, 0xa7,
-  0x52, 0x15, 0x1e, 0xf9, 0xc8, 0x1b, 0xe0, 0xe0, 0xb2, 0x2e, 0xfc, 0x37,
-  0xd5, 0xa3, 0xbf, 0xb7, 0x94, 0x6b, 0xc2, 0x32, 0x18, 0x24, 0x14, 0x7f,
-  0x19, 0xd9, 0xff, 0xf2, 0x40, 0x0f, 0xef, 0x22, 0x14, 0xdc, 0x35, 0xcd,
-  0x1c, 0xd1, 0xfa, 0x12, 0xdf, 0x4c, 0xce, 0xd6, 0xe9, 0xce, 0xe5, 0x29,
-  0xb3, 0xd2, 0x39, 0x27, 0xf9, 0x40, 0xfe, 0xd3, 0xd3, 0x18, 0xbc, 0x30,
-  0xbb, 0xe0, 0x27, 0x11, 0xb2, 0xe7, 0x13, 0xd1, 0xf8, 0xe6, 0x1d, 0x14,
-  0xbe, 0x3b, 0x12, 0xc4, 0xf6, 0x15, 0xdf, 0x3d, 0xe1, 0x2e, 0xe5, 0xe3,
-  0x09, 0xfd, 0xb2, 0xbe, 0x57, 0x4a, 0x13, 0xd5, 0x1b, 0x7f, 0x4e, 0xd3,
-  0xf5, 0x52, 0xbc, 0xee, 0xfe, 0x9d, 0xa3, 0x06, 0x2e, 0xb7, 0xc9, 0x4d,
-  0xf8, 0xb2, 0x85, 0xe8, 0x39, 0xdf, 0xf2, 0xdb, 0xae, 0x1b, 0xda, 0xca,
-  0x14, 0xcd, 0xe9, 0x3e, 0xda, 0x5c, 0x2b, 0xc1, 0x1f, 0x07, 0x45, 0x59,
-  0x77, 0x5b, 0xba, 0xf7, 0x96, 0x0a, 0x94, 0x15, 0x7b, 0x0a, 0xfc, 0xf5,
-  0xa5, 0x19, 0xfa, 0x82, 0x26, 0x00, 0x61, 0xe9, 0xb2, 0x15, 0xd7, 0xb3,
-  0x04, 0x43, 0x16, 0x39, 0x9a, 0x0b, 0x27, 0xca, 0xc9, 0xcc, 0x17, 0x4c,
-  0xaf, 0x06, 0xba, 0x41, 0xd6, 0x48, 0x6f, 0x32, 0x10, 0x22, 0x11, 0xf2,
-  0xb8, 0xef, 0x55, 0xc0, 0x0d, 0x0b, 0x22, 0x4b, 0xe1, 0xc0, 0xf3, 0xfb,
-  0x9e, 0xc3, 0xa4, 0x66, 0x0c, 0x7a, 0x70, 0x47, 0xbf, 0x7f, 0xd7, 0x4c,
-  0xf7, 0x61, 0x23, 0x4b, 0x72, 0x41, 0xe7, 0x02, 0x18, 0x03, 0x7f, 0x6a,
-  0x5b, 0x55, 0xc8, 0x3f, 0x40, 0x7b, 0x49, 0x17, 0xe7, 0x95, 0xba, 0xe2,
-  0x41, 0x20, 0x29, 0x2d, 0xca, 0x5a, 0x35, 0xb7, 0x24, 0x49, 0x12, 0xf8,
-  0xe1, 0x4c, 0x67, 0xee, 0x0a, 0xdc, 0xcd, 0x03, 0xdf, 0x18, 0xc0, 0xfb,
-  0x9d, 0xfd, 0x17, 0xeb, 0x6c, 0xf3, 0x14, 0xb9, 0x3f, 0x41, 0xa3, 0x1f,
-  0x49, 0xdf, 0x3c, 0x10, 0xcb, 0xd7, 0x4f, 0xd3, 0xb2, 0x05, 0x6d, 0xaf,
-  0xca, 0x40, 0x33, 0x6b, 0xf4, 0xde, 0xb4, 0xde, 0xbd, 0x05, 0x14, 0xfb,
-  0x33, 0xcd, 0xe5, 0xee, 0x16, 0xf7, 0x07, 0x4f, 0x81, 0x30, 0x09, 0xc4,
-  0x57, 0x03, 0x55, 0x06, 0x5d, 0xd8, 0x3b, 0x87, 0x29, 0xd9, 0xf3, 0x3b,
-  0x27, 0xbb, 0xba, 0xb9, 0xb1, 0xdf, 0x06, 0xf7, 0xeb, 0xf4, 0x4c, 0xa5,
-  0x10, 0x06, 0xfa, 0xe2, 0xff, 0x45, 0xd2, 0x5c, 0xdc, 0xc9, 0x35, 0x10,
-  0x0d, 0xe8, 0x35, 0xc1, 0xc6, 0x21, 0x4b, 0xf7, 0xbc, 0xaa, 0x20, 0xb2,
-  0x1f, 0xad, 0x6b, 0x02, 0x0f, 0xdc, 0x1f, 0xe7, 0x09, 0x4c, 0xe6, 0xc9,
-  0xbb, 0xf7, 0xd4, 0x01, 0xfa, 0x4e, 0xd2, 0x3f, 0x30, 0x09, 0xef, 0x10,
-  0x06, 0x16, 0x46, 0x17, 0x23, 0xf6, 0x10, 0x05, 0xb8, 0xd0, 0x54, 0xc1,
-  0xdd, 0x3d, 0xe0, 0x1c, 0x7e, 0xa9, 0xa2, 0xe2, 0xc8, 0xce, 0xfc, 0x0c,
-  0xd0, 0xf6, 0x54, 0x7f, 0x21, 0x55, 0x32, 0x0f, 0xfa, 0xfb, 0x49, 0xe8,
-  0xbf, 0x34, 0xf7, 0xef, 0x0f, 0x43, 0x09, 0xe8, 0x33, 0xb2, 0x29, 0x1d,
-  0x2c, 0x41, 0x06, 0x09, 0x0e, 0x0f, 0xff, 0xad, 0x67, 0x5c, 0xed, 0xe2,
-  0xfd, 0xe8, 0x7f, 0x19, 0x42, 0xfe, 0xfd, 0x40, 0x5d, 0xf8, 0xe8, 0x64,
-  0xea, 0xfd, 0x10, 0x56, 0xd7, 0x3e, 0xd6, 0x11, 0x1f, 0xf4, 0xb4, 0x43,
-  0xe0, 0x53, 0xc5, 0x70, 0x46, 0x21, 0xf5, 0x41, 0x34, 0x35, 0xdf, 0x27,
-  0x19, 0xce, 0x1b, 0x4d, 0xf7, 0x31, 0x3f, 0xfc, 0xba, 0x26, 0x33, 0xd0,
-  0x12, 0x7f, 0x2b, 0x66, 0x39, 0x2a, 0x06, 0xcf, 0xa1, 0x98, 0x3a, 0x75,
-  0xe5, 0xcc, 0xdf, 0x08, 0x35, 0xb8, 0x08, 0x3b, 0xe0, 0xe4, 0xc2, 0xb0,
-  0x49, 0x49, 0x12, 0xcc, 0xe3, 0xa3, 0x00, 0x5d, 0xa6, 0xcd, 0xd6, 0xf9,
-  0xfc, 0xbf, 0x28, 0x2c, 0x10, 0x2c, 0x18, 0x0c, 0xb7, 0xf0, 0x9e, 0x34,
-  0xe6, 0x11, 0xc2, 0x39, 0x3c, 0xbf, 0x1f, 0xc9, 0x2d, 0x13, 0xe1, 0xff,
-  0xc7, 0xc4, 0x0b, 0x3a, 0x38, 0x3b, 0xb8, 0x0b, 0xe6, 0xf0, 0x0b, 0x17,
-  0x2f, 0xcf, 0xc9, 0xb1, 0x2a, 0xe6, 0x13, 0x0d, 0xdf, 0x09, 0x05, 0xd1,
-  0xf2, 0xf9, 0xa7, 0xce, 0xd8, 0x07, 0x27, 0xd2, 0x4b, 0xe7, 0xc1, 0xce,
-  0xef, 0x36, 0xdc, 0xc2, 0xe0, 0x12, 0x24, 0xaa, 0xf4, 0x1e, 0xda, 0xdb,
-  0xfa, 0x81, 0xe8, 0x56, 0x08, 0xe8, 0xa8, 0xc0, 0x30, 0x94, 0x33, 0xae,
-  0xe3, 0x23, 0x5c, 0x1e, 0x25, 0x94, 0xba, 0xd8, 0xa6, 0xc1, 0xd7, 0x9f,
-  0xed, 0x2f, 0xb2, 0x9a, 0x95, 0xcc, 0xc8, 0x2a, 0xf2, 0x56, 0xeb, 0x0a,
-  0xb4, 0xcf, 0xe0, 0xaf, 0x8b, 0xdf, 0x04, 0xae, 0xe6, 0xad, 0xf3, 0xb4,
-  0xd8, 0x06, 0x29, 0x44, 0xac, 0xba, 0xbf, 0x01, 0xa7, 0xe9, 0x16, 0xbd,
-  0x81, 0xa3, 0x54, 0x5f, 0xe0, 0x63, 0xab, 0xa3, 0x30, 0xc2, 0x07, 0xcb,
-  0xa6, 0x26, 0x8a, 0x35, 0xd0, 0x15, 0x4b, 0x1e, 0xa3, 0xc8, 0x6c, 0x39,
-  0x1c, 0xdb, 0x0f, 0x03, 0xe5, 0x01, 0xea, 0x06, 0x09, 0x52, 0x47, 0xa5,
-  0xd1, 0xd9, 0xdd, 0x0b, 0x29, 0xcd, 0x4f, 0xfa, 0x7d, 0xfc, 0x30, 0x2a,
-  0x1e, 0xb6, 0x24, 0xf9, 0xa5, 0xc4, 0x56, 0x7f, 0x4c, 0x04, 0x5c, 0x20,
-  0x1f, 0xd6, 0xbe, 0xcf, 0x41, 0xcd, 0x3a, 0x02, 0x05, 0x13, 0x15, 0x39,
-  0x94, 0xeb, 0xfe, 0x49, 0x02, 0x81, 0x64, 0xfc, 0x8f, 0xbf, 0xe1, 0x3d,
-  0xd2, 0xf6, 0xc7, 0xf3, 0xef, 0xdc, 0xcc, 0x32, 0xdf, 0xd7, 0xbe, 0x02,
-  0xf7, 0x27, 0xd0, 0xde, 0x45, 0xf3, 0xca, 0xf6, 0xe4, 0x25, 0x0c, 0xfb,
-  0xe4, 0x05, 0xd6, 0xd4, 0xbd, 0xe1, 0x2e, 0xc1, 0xd4, 0x47, 0x07, 0xd4,
-  0xc0, 0xc0, 0xcf, 0xc5, 0x20, 0x07, 0x2a, 0xc4, 0xd3, 0xc9, 0x16, 0x01,
-  0x09, 0x12, 0xc8, 0x9e, 0xe0, 0xc3, 0xf9, 0x40, 0xf5, 0xf3, 0xd9, 0xd3,
-  0x55, 0xff, 0xa8, 0x81, 0xfb, 0x71, 0xbd, 0xd3, 0x31, 0x33, 0xb0, 0x2d,
-  0x1c, 0xc8, 0x1f, 0xe0, 0xc4, 0x3a, 0x02, 0xb6, 0xd0, 0x43, 0xf5, 0x20,
-  0x71, 0xd0, 0xe1, 0x46, 0x1e, 0xc2, 0x5a, 0x17, 0x97, 0x12, 0x40, 0x52,
-  0xe0, 0xc9, 0xef, 0x0b, 0x49, 0xbe, 0x34, 0x2a, 0x0c, 0xb8, 0x4d, 0xee,
-  0x1c, 0xb9, 0xaa, 0xc1, 0xb1, 0x03, 0xb8, 0x6a, 0x5a, 0xe4, 0xee, 0x06,
-  0x39, 0x23, 0x1a, 0xfb, 0x65, 0x30, 0xda, 0xf8, 0xa2, 0x07, 0xf9, 0x55,
-  0x41, 0x7e, 0x90, 0xa8, 0x7f, 0x6c, 0x52, 0x4f, 0xd6, 0x8c, 0x94, 0xc5,
-  0xcd, 0xa0, 0xd9, 0x12, 0x9e, 0xb4, 0x22, 0xf0, 0x6f, 0x23, 0x0a, 0xbd,
-  0x17, 0x4a, 0xc5, 0xd3, 0xe6, 0x8d, 0x86, 0x0c, 0xe3, 0xd9, 0xaf, 0x0f,
-  0xf2, 0xba, 0x8c, 0x6a, 0x0c, 0x00, 0x63, 0x34, 0x52, 0xc8, 0xa3, 0xa9,
-  0x10, 0xae, 0xf9, 0x63, 0xa3, 0x04, 0x62, 0x23, 0x0a, 0x14, 0x03, 0x9f,
-  0x0d, 0x61, 0xfe, 0x0c, 0x8a, 0x81, 0x27, 0x0d, 0xbf, 0xe1, 0xdb, 0x01,
-  0x66, 0x5a, 0x03, 0x2a, 0xce, 0xfc, 0x59, 0xc0, 0x3b, 0x9d, 0xc3, 0xf7,
-  0xd1, 0xe5, 0xe9, 0x3e, 0xf3, 0x59, 0x96, 0xa7, 0x42, 0x15, 0xe1, 0x39,
-  0xe4, 0xe0, 0x8a, 0x58, 0xe0, 0xc1, 0xe8, 0xb4, 0x15, 0x5b, 0x58, 0x06,
-  0xf5, 0x30, 0x67, 0xfc, 0xa8, 0x1c, 0x15, 0x5d, 0xde, 0xe2, 0xec, 0xfc,
-  0x7f, 0x1b, 0x5a, 0x47, 0xbd, 0x21, 0x13, 0xc5, 0x18, 0xc0, 0x32, 0x1f,
-  0x5f, 0xed, 0x0d, 0xbb, 0xf6, 0xe9, 0xb4, 0x32, 0xa2, 0x41, 0xd2, 0x69,
-  0xd4, 0xd1, 0x6f, 0xfd, 0xd3, 0x43, 0xa6, 0x0c, 0x0e, 0x39, 0xdb, 0x07,
-  0x8b, 0xa2, 0xf8, 0xfc, 0xcb, 0x0d, 0xe6, 0xcc, 0x53, 0xd5, 0xcc, 0x13,
-  0x1e, 0xe4, 0xbf, 0xa8, 0x2c, 0x19, 0xe2, 0x5f, 0xd4, 0xde, 0xb3, 0xca,
-  0xeb, 0x81, 0xee, 0x1e, 0xbe, 0xea, 0xfa, 0x9e, 0xd8, 0x12, 0x15, 0x40,
-  0xfd, 0xeb, 0x18, 0xd1, 0xf9, 0xed, 0x15, 0xe6, 0x4d, 0xcf, 0x6e, 0xf4,
-  0x5f, 0x73, 0x61, 0xdc, 0xc3, 0xd1, 0x95, 0xa5, 0x5e, 0xe5, 0x0c, 0xf6,
-  0x30, 0xf8, 0x03, 0xb7, 0x3e, 0x60, 0xa4, 0xd5, 0xb6, 0x54, 0xdc, 0x26,
-  0xef, 0x1e, 0xfb, 0x37, 0xb8, 0xcd, 0x15, 0xc8, 0x3d, 0xe7, 0xf9, 0x2e,
-  0x9e, 0xbb, 0x16, 0xba, 0xfd, 0x05, 0xfc, 0x4f, 0x1c, 0xde, 0xe6, 0x04,
-  0x0b, 0xd5, 0xe1, 0x15, 0x00, 0xc6, 0x18, 0xfb, 0x2b, 0xd9, 0x2a, 0x0a,
-  0x4e, 0x5f, 0xed, 0x01, 0x2c, 0x17, 0x1e, 0x15, 0xed, 0x4a, 0x3d, 0x60,
-  0x21, 0x7f, 0xd5, 0xe8, 0x3b, 0xd7, 0xc2, 0xe8, 0xeb, 0x43, 0x3e, 0x44,
-  0x07, 0x02, 0x33, 0xf2, 0x1c, 0x37, 0x1a, 0x36, 0xd8, 0x78, 0x15, 0xf3,
-  0xdb, 0x23, 0xf8, 0x40, 0x13, 0x12, 0x16, 0xf9, 0x37, 0xb7, 0x59, 0xa6,
-  0xcc, 0x64, 0x1a, 0x91, 0xfd, 0x9e, 0x38, 0xac, 0xec, 0xdc, 0xf9, 0xc9,
-  0x49, 0x42, 0x9e, 0x38, 0xb0, 0x06, 0x2d, 0x14, 0xe8, 0xc7, 0xbe, 0xcf,
-  0x04, 0xda, 0x38, 0x8f, 0xfd, 0x11, 0x0a, 0x56, 0x28, 0x06, 0xce, 0x0e,
-  0x26, 0xc0, 0xd8, 0xda, 0x42, 0x0b, 0x94, 0x18, 0xf6, 0x1b, 0x34, 0x2c,
-  0x0a, 0xc9, 0x43, 0x06, 0x9f, 0xed, 0xdd, 0xc6, 0xb8, 0xba, 0x81, 0xf3,
-  0x2c, 0xda, 0x2f, 0x10, 0x94, 0xb7, 0xb2, 0x20, 0x4a, 0x9c, 0x0f, 0x15,
-  0xed, 0x04, 0xcb, 0x56, 0x96, 0x3c, 0xa6, 0xa9, 0x3b, 0xc3, 0xe5, 0xf7,
-  0xd7, 0x52, 0x10, 0x31, 0xf3, 0xfe, 0xc9, 0xaf, 0x3a, 0x5c, 0x3d, 0x5c,
-  0xd5, 0xd2, 0xa8, 0xac, 0x32, 0xd2, 0xc4, 0x21, 0xb9, 0xf0, 0x5f, 0x43,
-  0x81, 0x95, 0x4d, 0x11, 0x2d, 0x11, 0xdb, 0xa3, 0x3d, 0xc2, 0x4f, 0xa9,
-  0x47, 0xcf, 0x8b, 0x36, 0x92, 0x6d, 0x29, 0x54, 0xa1, 0xcd, 0x14, 0xe5,
-  0xd7, 0x5e, 0x7f, 0xdf, 0x5d, 0x6a, 0xc2, 0xa3, 0xa2, 0x3b, 0x72, 0x21,
-  0x3b, 0xd9, 0x94, 0x4f, 0xf6, 0x16, 0xe1, 0xd9, 0xcd, 0xc8, 0x3e, 0x77,
-  0xe5, 0x2c, 0xc8, 0x6e, 0xbd, 0x5b, 0x6e, 0xe4, 0x49, 0x2f, 0xc2, 0xb5,
-  0xd7, 0x41, 0x3d, 0x16, 0xd2, 0xa4, 0x25, 0xac, 0xe0, 0x60, 0xce, 0xde,
-  0xca, 0xc6, 0x86, 0xf0, 0x5f, 0xf9, 0xdb, 0xcd, 0x05, 0x95, 0xe5, 0xf4,
-  0xb2, 0xe9, 0x85, 0x97, 0x40, 0xa2, 0x30, 0x1a, 0x03, 0xaf, 0xf8, 0x10,
-  0xec, 0xe6, 0x16, 0x06, 0xde, 0x3e, 0x49, 0xb7, 0xa2, 0xf6, 0x46, 0x06,
-  0xb2, 0x93, 0x97, 0xcc, 0x92, 0xb8, 0xba, 0xa8, 0xbf, 0x3c, 0x4f, 0xb0,
-  0x37, 0xea, 0xc6, 0x6a, 0xcd, 0x43, 0xa2, 0x9d, 0x0e, 0xc4, 0x02, 0xe4,
-  0x96, 0x0e, 0x81, 0xad, 0xca, 0x9a, 0x2a, 0xa6, 0xb4, 0xb4, 0xa1, 0x92,
-  0xfa, 0xa9, 0x9e, 0x7d, 0x38, 0xa1, 0x3c, 0x11, 0xbd, 0x45, 0x6a, 0xd3,
-  0xbc, 0x0d, 0x24, 0x0f, 0x33, 0xa2, 0x2a, 0x8d, 0x11, 0x3b, 0xcb, 0x04,
-  0xa0, 0xa9, 0x2a, 0xe9, 0x08, 0x0c, 0x4d, 0x5c, 0x97, 0xbc, 0xad, 0x12,
-  0xef, 0x2c, 0xfb, 0x1a, 0x99, 0xbd, 0x4e, 0xa7, 0xf2, 0xe0, 0x45, 0x81,
-  0xf9, 0xcb, 0xaf, 0xde, 0x15, 0x9a, 0xa4, 0x48, 0xd3, 0xd5, 0xf9, 0xf1,
-  0xe4, 0xeb, 0xa8, 0x1b, 0xd8, 0xdf, 0x01, 0xfb, 0x2b, 0xdb, 0xd3, 0x4f,
-  0x1c, 0x9f, 0xa6, 0xd4, 0x51, 0x11, 0xea, 0xb5, 0xc1, 0xcf, 0xba, 0x3d,
-  0xa0, 0x2d, 0x2f, 0x32, 0xfe, 0xef, 0xe9, 0x50, 0x04, 0xf6, 0x5b, 0xcf,
-  0x47, 0xe8, 0xf4, 0x3f, 0x44, 0x2c, 0x00, 0xeb, 0xf0, 0x51, 0x54, 0xf4,
-  0x7f, 0xe4, 0xb5, 0xc8, 0x09, 0xd8, 0xe5, 0xb9, 0xbc, 0x6f, 0x1f, 0xf9,
-  0xf3, 0x10, 0xc0, 0xd7, 0x32, 0x97, 0x04, 0x10, 0x0e, 0x4e, 0xdb, 0x51,
-  0x09, 0x2c, 0x3e, 0xdd, 0xc4, 0xe3, 0x0a, 0x31, 0xbb, 0x25, 0x19, 0xb4,
-  0x50, 0x35, 0xf5, 0x10, 0x1a, 0xce, 0x9b, 0x3f, 0xc0, 0x62, 0x56, 0xc8,
-  0xc7, 0x04, 0x16, 0x5d, 0xc1, 0xb6, 0xb0, 0xc2, 0x7f, 0xf2, 0xeb, 0xeb,
-  0x1b, 0xf6, 0x37, 0x05, 0xdc, 0x3b, 0x56, 0xc2, 0x03, 0x0e, 0x9a, 0x5a,
-  0x00, 0x4a, 0xac, 0xea, 0xd8, 0xbc, 0x6e, 0x38, 0x14, 0x2c, 0x17, 0x9d,
-  0xf5, 0x2c, 0x9d, 0x02, 0x23, 0x24, 0xeb, 0xe7, 0x15, 0x4a, 0xc2, 0xde,
-  0xc9, 0x9c, 0xbd, 0xd1, 0xd8, 0xcc, 0xce, 0x33, 0x32, 0x9b, 0x8a, 0xbe,
-  0x88, 0xd0, 0xb5, 0xce, 0xd0, 0x2d, 0xe0, 0x2b, 0x8d, 0x9e, 0x5a, 0xc6,
-  0x01, 0x4a, 0x16, 0xde, 0x18, 0x02, 0xfc, 0x09, 0xf1, 0x10, 0x1a, 0x81,
-  0xcf, 0x2d, 0xdf, 0x4a, 0xe1, 0xbb, 0x0a, 0xbe, 0xf5, 0xe3, 0xcf, 0x1d,
-  0xbc, 0x5d, 0x42, 0x08, 0x2a, 0xf4, 0x1d, 0xb0, 0x1f, 0xfc, 0x2e, 0x26,
-  0x3f, 0xaf, 0x0a, 0xf6, 0x2c, 0xf5, 0xf7, 0xb0, 0x13, 0xae, 0xb9, 0xfb,
-  0x55, 0x9c, 0xe6, 0x31, 0x3a, 0xcb, 0xdc, 0xb2, 0xab, 0x1a, 0xe8, 0x0f,
-  0x01, 0xab, 0xd1, 0x11, 0x0b, 0xad, 0x58, 0x2c, 0xd0, 0x0d, 0x44, 0xfe,
-  0xb5, 0x30, 0x01, 0xec, 0xdc, 0x19, 0xd1, 0xc8, 0xcc, 0xeb, 0xeb, 0x39,
-  0x7f, 0xbe, 0x6a, 0x0c, 0x5f, 0xec, 0x11, 0xbe, 0xc0, 0x57, 0x25, 0xce,
-  0x26, 0xb0, 0xff, 0x10, 0xde, 0xfb, 0x31, 0xdc, 0xad, 0xd7, 0x4f, 0xf6,
-  0xbe, 0xb7, 0x7f, 0xc9, 0xfb, 0x27, 0x27, 0x3a, 0xae, 0x1e, 0xd9, 0x09,
-  0x1a, 0xe4, 0x46, 0xe7, 0x46, 0x26, 0xf6, 0xc8, 0xf7, 0x3e, 0xe6, 0x41,
-  0xfd, 0x00, 0x28, 0xd8, 0xd7, 0xe2, 0x53, 0x32, 0xe6, 0xf1, 0xb9, 0xe1,
-  0x14, 0xe8, 0xf9, 0x22, 0x01, 0x37, 0x51, 0xac, 0xe9, 0xd4, 0x16, 0x00,
-  0x25, 0x03, 0xc2, 0x6f, 0xbb, 0x5a, 0xcb, 0x1f, 0x05, 0x7f, 0x20, 0xd2,
-  0x15, 0x55, 0xa2, 0xb6, 0x0c, 0x46, 0x50, 0x30, 0x23, 0x14, 0xdc, 0x39,
-  0xae, 0x93, 0xa3, 0x10, 0xf8, 0x4d, 0xd6, 0x32, 0x9f, 0x04, 0x2d, 0xdf,
-  0x0e, 0x0a, 0xc4, 0x69, 0x4f, 0x32, 0x27, 0xf3, 0x36, 0xf3, 0x06, 0xa1,
-  0xc6, 0xd0, 0xcf, 0x00, 0xc9, 0xa5, 0xfd, 0x9e, 0x18, 0x0c, 0xc0, 0x7e,
-  0x75, 0x38, 0x5a, 0xce, 0x0a, 0x43, 0xbc, 0x41, 0x30, 0x23, 0xf4, 0xf2,
-  0xfd, 0x36, 0x02, 0xb2, 0x4d, 0x1c, 0x4d, 0xc9, 0xe9, 0x2a, 0x41, 0x15,
-  0xec, 0xf6, 0x14, 0x02, 0xea, 0x40, 0xfb, 0xda, 0x14, 0x48, 0x3e, 0x45,
-  0x3a, 0x2d, 0x1b, 0x20, 0x19, 0xc5, 0x34, 0x2c, 0x0c, 0x28, 0xfe, 0xcc,
-  0xf2, 0x00, 0xd9, 0xd8, 0x81, 0xf9, 0xc8, 0x5f, 0x10, 0xca, 0xff, 0xd2,
-  0x2c, 0xc1, 0xd8, 0xec, 0x06, 0x4d, 0xf7, 0xf5, 0x26, 0x59, 0xbe, 0x02,
-  0x39, 0x57, 0xba, 0x3d, 0xdc, 0xb1, 0x94, 0x1c, 0x58, 0xf5, 0xa3, 0xb2,
-  0x92, 0xbb, 0x29, 0xcc, 0xf7, 0x29, 0xd4, 0x9b, 0xb0, 0x24, 0x8b, 0xf5,
-  0x3a, 0xca, 0x61, 0xd4, 0xc3, 0xc0, 0xb2, 0x0f, 0xb9, 0x31, 0x3c, 0x9b,
-  0xbf, 0xe5, 0x47, 0xe8, 0x46, 0x1f, 0x6e, 0x6b, 0xfd, 0x25, 0xd6, 0x01,
-  0xc9, 0xc8, 0xe9, 0x58, 0x07, 0x71, 0x56, 0x2a, 0x81, 0x49, 0x45, 0x2f,
-  0xe2, 0xbf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xe7, 0xf3, 0xff, 0xff, 0x7b, 0x18, 0x00, 0x00, 0x84, 0xed, 0xff, 0xff,
-  0x0b, 0x13, 0x00, 0x00, 0x27, 0x14, 0x00, 0x00, 0xcc, 0xe0, 0xff, 0xff,
-  0x58, 0xe0, 0xff, 0xff, 0x41, 0xfc, 0xff, 0xff, 0x61, 0xf0, 0xff, 0xff,
-  0x83, 0xec, 0xff, 0xff, 0xe9, 0xc9, 0xff, 0xff, 0x72, 0xe7, 0xff, 0xff,
-  0x07, 0xec, 0xff, 0xff, 0x5e, 0x04, 0x00, 0x00, 0xc5, 0x19, 0x00, 0x00,
-  0x2e, 0x18, 0x00, 0x00, 0x2d, 0x09, 0x00, 0x00, 0x4d, 0x21, 0x00, 0x00,
-  0x01, 0xee, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xa0, 0xf1, 0xff, 0xff,
-  0xdb, 0x3b, 0x00, 0x00, 0x51, 0xed, 0xff, 0xff, 0x94, 0xdd, 0xff, 0xff,
-  0xa4, 0x03, 0x00, 0x00, 0xef, 0x16, 0x00, 0x00, 0x76, 0xe5, 0xff, 0xff,
-  0xae, 0x08, 0x00, 0x00, 0xac, 0xfe, 0xff, 0xff, 0xa2, 0x03, 0x00, 0x00,
-  0x1c, 0xea, 0xff, 0xff, 0x9e, 0xfa, 0xff, 0xff, 0xe2, 0x0f, 0x00, 0x00,
-  0x29, 0x04, 0x00, 0x00, 0xd8, 0x08, 0x00, 0x00, 0x83, 0xe2, 0xff, 0xff,
-  0x91, 0xe6, 0xff, 0xff, 0x62, 0x04, 0x00, 0x00, 0x9a, 0xff, 0xff, 0xff,
-  0xfc, 0xdd, 0xff, 0xff, 0x3f, 0x06, 0x00, 0x00, 0x54, 0x1a, 0x00, 0x00,
-  0x19, 0x3c, 0x00, 0x00, 0x1a, 0xf7, 0xff, 0xff, 0xf1, 0x28, 0x00, 0x00,
-  0xb4, 0x0a, 0x00, 0x00, 0xb7, 0x14, 0x00, 0x00, 0x30, 0xfd, 0xff, 0xff,
-  0x0d, 0x13, 0x00, 0x00, 0x81, 0x0b, 0x00, 0x00, 0x44, 0xd8, 0xff, 0xff,
-  0xc2, 0x1a, 0x00, 0x00, 0x24, 0x0e, 0x00, 0x00, 0x33, 0xf9, 0xff, 0xff,
-  0xa9, 0x43, 0x00, 0x00, 0x43, 0x21, 0x00, 0x00, 0x0a, 0x09, 0x00, 0x00,
-  0x2a, 0xf3, 0xff, 0xff, 0xe2, 0x28, 0x00, 0x00, 0xeb, 0x06, 0x00, 0x00,
-  0xbb, 0x00, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x68, 0xef, 0xff, 0xff,
-  0x8d, 0x05, 0x00, 0x00, 0xee, 0xc0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0x7f, 0x3c, 0xdc, 0xb2, 0xec, 0xc2, 0xbf, 0x2f,
-  0xb9, 0x33, 0x10, 0xc9, 0x97, 0xd6, 0xca, 0xa5, 0x16, 0x81, 0x81, 0xd7,
-  0x7f, 0x7f, 0xf8, 0x05, 0xd8, 0xff, 0x6f, 0xed, 0x53, 0x81, 0x0d, 0x1e,
-  0x1f, 0xdf, 0xc2, 0x71, 0x1e, 0xf3, 0xe8, 0x3e, 0xa1, 0xc1, 0x0a, 0x22,
-  0xea, 0x7f, 0x81, 0xe7, 0x61, 0x03, 0xd6, 0xcb, 0xe3, 0x58, 0x20, 0x4b,
-  0x5f, 0x3f, 0xba, 0x69, 0x19, 0x40, 0xd7, 0x24, 0x68, 0x27, 0xed, 0x2a,
-  0x3a, 0x41, 0xf5, 0x15, 0xf0, 0x2c, 0xeb, 0xe3, 0xc1, 0x6b, 0x32, 0x34,
-  0xe2, 0xc7, 0xee, 0xcb, 0xed, 0x4f, 0x81, 0x7f, 0xfc, 0xf9, 0xb3, 0x19,
-  0xdc, 0x58, 0xa5, 0xfa, 0x7f, 0x0a, 0xf2, 0xe1, 0x43, 0x34, 0xd1, 0x81,
-  0xe1, 0xc7, 0xde, 0x7b, 0x18, 0xb3, 0x91, 0x9d, 0x0e, 0xdf, 0xcd, 0x7f,
-  0xb1, 0x2b, 0x7f, 0x7a, 0x4d, 0xda, 0xf0, 0xc1, 0x48, 0x93, 0xf0, 0x09,
-  0x00, 0x96, 0x7f, 0x25, 0x7f, 0x7f, 0xd1, 0x04, 0x81, 0x69, 0x1e, 0x67,
-  0xaa, 0x2f, 0x10, 0xc4, 0x6d, 0xc3, 0x01, 0xfc, 0x03, 0xf3, 0x83, 0x1b,
-  0x7f, 0x7f, 0x07, 0xed, 0x9a, 0xfb, 0x73, 0xbc, 0xfd, 0x6e, 0x0c, 0x6f,
-  0xc3, 0xef, 0x9a, 0x40, 0x7f, 0x7f, 0x81, 0x98, 0xdd, 0x40, 0x16, 0x05,
-  0x8d, 0xaa, 0x7f, 0x73, 0xe3, 0xa5, 0x31, 0xc5, 0xbc, 0x7f, 0x81, 0xdc,
-  0x86, 0x9e, 0x32, 0xf8, 0xe8, 0x7b, 0x08, 0x4f, 0x39, 0xc1, 0xe8, 0xce,
-  0x24, 0x73, 0x0c, 0xc1, 0x00, 0xea, 0x81, 0x64, 0xea, 0xd0, 0x41, 0x6b,
-  0x06, 0x6c, 0x2f, 0x0b, 0xdc, 0xf4, 0x68, 0xd2, 0x9e, 0xa6, 0xf5, 0xa1,
-  0x09, 0xb1, 0xba, 0x96, 0x7f, 0x59, 0xd7, 0x1f, 0xd0, 0xc3, 0xb6, 0x81,
-  0xcf, 0x4e, 0xc1, 0x7e, 0x1f, 0xf5, 0xf2, 0x70, 0xd9, 0xbf, 0x27, 0x66,
-  0x7f, 0x9d, 0x5f, 0x4d, 0xb9, 0x43, 0x0a, 0x7f, 0x46, 0xc7, 0x27, 0xfa,
-  0xf6, 0xd1, 0x25, 0x81, 0x2f, 0xc7, 0x7f, 0x1d, 0xb6, 0x35, 0x47, 0x4a,
-  0xa8, 0x34, 0xfc, 0xf6, 0xe1, 0x66, 0x19, 0x42, 0x09, 0xaf, 0x73, 0xe9,
-  0x41, 0x6a, 0xfe, 0x81, 0x36, 0x02, 0x05, 0xfb, 0x6c, 0xea, 0xc5, 0xf1,
-  0xd2, 0x1c, 0xa4, 0xf3, 0x0b, 0xf6, 0xfd, 0x81, 0xa2, 0xc5, 0x9e, 0x51,
-  0x70, 0xff, 0x5e, 0xb1, 0x64, 0xa7, 0x48, 0x00, 0x36, 0x81, 0x17, 0x2b,
-  0x05, 0xa0, 0x3d, 0x35, 0xc0, 0xa6, 0x1d, 0xf3, 0x40, 0x1d, 0x59, 0x0d,
-  0x81, 0x07, 0xbe, 0x13, 0xf6, 0x69, 0xc9, 0x10, 0x0c, 0xd3, 0x59, 0x21,
-  0x23, 0xa3, 0x81, 0xd5, 0x81, 0xc3, 0x7f, 0xf9, 0x12, 0xa1, 0x4e, 0x65,
-  0xeb, 0x7f, 0xa2, 0xd8, 0xe2, 0x22, 0xb3, 0xdc, 0x81, 0xd4, 0x69, 0xbc,
-  0x3d, 0x9f, 0x70, 0xaa, 0x54, 0x7b, 0x11, 0xc5, 0x1e, 0xc2, 0xbe, 0x09,
-  0xc6, 0x3f, 0xdd, 0x10, 0xf3, 0x6c, 0x1f, 0x81, 0xdd, 0x02, 0x7f, 0xcc,
-  0xf0, 0x17, 0x03, 0xa8, 0x3f, 0x81, 0xf9, 0x81, 0x11, 0x24, 0xb3, 0x7f,
-  0x01, 0x47, 0x1b, 0x28, 0x19, 0x62, 0x01, 0x7f, 0x33, 0x0f, 0xed, 0x35,
-  0xb8, 0x7f, 0x81, 0x81, 0x74, 0xda, 0x9f, 0xb4, 0x02, 0xff, 0xdf, 0xbc,
-  0xd1, 0xda, 0xf4, 0x1e, 0x81, 0x7f, 0xf9, 0x17, 0x81, 0xeb, 0x30, 0xae,
-  0xa6, 0x9d, 0x04, 0x81, 0x84, 0x4d, 0x7f, 0xcf, 0x0d, 0xd4, 0xd5, 0xa9,
-  0x01, 0x2e, 0x35, 0x16, 0xca, 0x12, 0x2b, 0x02, 0x4e, 0x9a, 0x2c, 0x3e,
-  0xaa, 0xe0, 0x3d, 0x31, 0xc1, 0x20, 0xaa, 0x41, 0xf2, 0x39, 0x54, 0xd3,
-  0x69, 0xfe, 0xd6, 0xbb, 0x0b, 0xbd, 0x3d, 0x91, 0xca, 0xdc, 0x04, 0x61,
-  0xef, 0x3b, 0x19, 0x63, 0x0d, 0xab, 0xe6, 0xf4, 0x26, 0x5a, 0x0d, 0xc9,
-  0x13, 0x01, 0xf2, 0x7f, 0xe7, 0x1f, 0x15, 0x2f, 0x4d, 0xd2, 0xed, 0x1f,
-  0xf5, 0x81, 0xfd, 0x92, 0xda, 0xc1, 0x9e, 0x79, 0x8c, 0x81, 0xc2, 0x7f,
-  0xcc, 0x69, 0x09, 0xfa, 0x7f, 0xfa, 0xf8, 0x29, 0x04, 0xf3, 0xf6, 0xde,
-  0xc1, 0xc0, 0xc6, 0x2b, 0x35, 0x31, 0x21, 0xb8, 0xfb, 0xa0, 0x37, 0x9a,
-  0xb4, 0x5d, 0x81, 0xd3, 0xed, 0xc3, 0xeb, 0xf0, 0xa6, 0xcc, 0x46, 0x4f,
-  0x50, 0x97, 0xf1, 0x0f, 0xcb, 0x7f, 0xfb, 0x8b, 0xbc, 0x34, 0xd6, 0x05,
-  0x81, 0xfa, 0x8f, 0xee, 0x3a, 0xc3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0xf8, 0xf5, 0xff, 0xff, 0xcb, 0x03, 0x00, 0x00,
-  0xde, 0xfa, 0xff, 0xff, 0x02, 0x05, 0x00, 0x00, 0x59, 0xfd, 0xff, 0xff,
-  0x4d, 0x02, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xff,
-  0x2a, 0x08, 0x00, 0x00, 0x15, 0xf8, 0xff, 0xff, 0xa7, 0xf6, 0xff, 0xff,
-  0x9e, 0xff, 0xff, 0xff, 0x2f, 0x0b, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0xff,
-  0x03, 0x02, 0x00, 0x00, 0x35, 0xfe, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xff,
-  0xd8, 0x03, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0x93, 0xf9, 0xff, 0xff,
-  0x34, 0xfe, 0xff, 0xff, 0xc7, 0xed, 0xff, 0xff, 0x04, 0x05, 0x00, 0x00,
-  0xdd, 0xf2, 0xff, 0xff, 0xf4, 0xfd, 0xff, 0xff, 0xdb, 0xfe, 0xff, 0xff,
-  0x61, 0xfc, 0xff, 0xff, 0x89, 0x00, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x86, 0x0e, 0x00, 0x00,
-  0xe3, 0xf9, 0xff, 0xff, 0xd3, 0x04, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00,
-  0x18, 0x06, 0x00, 0x00, 0x1c, 0xf8, 0xff, 0xff, 0xce, 0xf7, 0xff, 0xff,
-  0x8c, 0x15, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00, 0xc3, 0x05, 0x00, 0x00,
-  0x9e, 0xff, 0xff, 0xff, 0xe4, 0x0f, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
-  0x89, 0x0c, 0x00, 0x00, 0xca, 0x01, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00,
-  0xcc, 0x03, 0x00, 0x00, 0x69, 0xff, 0xff, 0xff, 0x6a, 0x04, 0x00, 0x00,
-  0x16, 0xff, 0xff, 0xff, 0xd6, 0xf4, 0xff, 0xff, 0x79, 0x03, 0x00, 0x00,
-  0xa4, 0xf8, 0xff, 0xff, 0xd9, 0xf0, 0xff, 0xff, 0xd5, 0xfe, 0xff, 0xff,
-  0xfb, 0xf8, 0xff, 0xff, 0x80, 0x03, 0x00, 0x00, 0x47, 0x06, 0x00, 0x00,
-  0x31, 0xff, 0xff, 0xff, 0x9f, 0x08, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00,
-  0xe4, 0x01, 0x00, 0x00, 0x02, 0xfa, 0xff, 0xff, 0x46, 0xc4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xbd, 0xb7, 0xed, 0xd9,
-  0x10, 0xb6, 0xd2, 0x20, 0xf5, 0x2f, 0xfc, 0xb8, 0xbf, 0xf2, 0xd5, 0x45,
-  0x81, 0x50, 0xe8, 0xb6, 0x41, 0x34, 0xd4, 0x49, 0x0a, 0x4e, 0x41, 0xae,
-  0xc5, 0x0d, 0x05, 0xc7, 0x57, 0x1f, 0xe3, 0xc0, 0xa9, 0xef, 0xb9, 0x4f,
-  0x31, 0x15, 0xcb, 0x2b, 0x0b, 0xd7, 0x5f, 0xb3, 0xb6, 0xe6, 0xc4, 0xcb,
-  0x56, 0xd3, 0xf9, 0x8d, 0x1a, 0x35, 0x67, 0xbf, 0x41, 0xf2, 0xce, 0xc1,
-  0xf3, 0x57, 0xab, 0xda, 0x14, 0xdc, 0xd0, 0xe9, 0xdd, 0xbf, 0xd1, 0x01,
-  0xc0, 0x6e, 0x32, 0x38, 0xb5, 0xd1, 0x30, 0x2b, 0xe5, 0x59, 0x38, 0x7f,
-  0xa0, 0xc8, 0x21, 0xf0, 0xca, 0xd4, 0x15, 0xf8, 0xe8, 0xef, 0x19, 0xc3,
-  0xb8, 0x4f, 0xa3, 0xf6, 0xb4, 0xe8, 0xce, 0x30, 0x0d, 0xc3, 0x63, 0x04,
-  0x89, 0x1c, 0xd1, 0x57, 0x22, 0x38, 0xcb, 0x3b, 0xf7, 0x8f, 0xea, 0xd2,
-  0xa5, 0x3d, 0x8e, 0x93, 0xd5, 0x3d, 0x2f, 0x14, 0x3d, 0x31, 0x62, 0x3c,
-  0xcc, 0x54, 0x03, 0x2a, 0x48, 0x1b, 0xfc, 0x35, 0xe5, 0x4a, 0xef, 0xbd,
-  0x4f, 0xba, 0x4e, 0x28, 0xb4, 0x39, 0xbe, 0xdd, 0x36, 0x75, 0x7f, 0x57,
-  0x32, 0x9e, 0x3c, 0x1b, 0x4d, 0x52, 0x1f, 0xf0, 0x42, 0x65, 0x99, 0x54,
-  0x1b, 0x4c, 0x45, 0xbc, 0xfb, 0xcd, 0xbb, 0xe4, 0x28, 0xd5, 0x01, 0xb0,
-  0x7c, 0xad, 0x05, 0x13, 0xb6, 0x2d, 0x4a, 0xa0, 0x3b, 0x78, 0x29, 0x52,
-  0xd0, 0x01, 0xfc, 0x63, 0x9e, 0x56, 0x60, 0xe9, 0xfb, 0x1a, 0x0d, 0x95,
-  0xd6, 0xbb, 0x16, 0xad, 0x0c, 0xd0, 0xa1, 0xeb, 0xb7, 0xdc, 0x6a, 0xc4,
-  0x6c, 0xc5, 0xd9, 0xe6, 0xbf, 0xf7, 0x81, 0xaa, 0xd6, 0x5d, 0x30, 0xb1,
-  0xfc, 0x35, 0xdf, 0x56, 0x1a, 0xe4, 0xd0, 0xf0, 0x18, 0xb7, 0xd9, 0xe7,
-  0x4f, 0xc2, 0x93, 0xc0, 0x40, 0xa0, 0x24, 0x5f, 0x1e, 0x17, 0x09, 0x8f,
-  0x35, 0x4b, 0xd2, 0xdb, 0xd4, 0xbe, 0x32, 0x02, 0xd9, 0x95, 0x0f, 0x09,
-  0xda, 0x0a, 0x18, 0x93, 0xff, 0xfb, 0x4c, 0x58, 0x23, 0xd1, 0xfc, 0x27,
-  0xeb, 0x36, 0x43, 0xab, 0xb1, 0xe3, 0xe1, 0x98, 0xc5, 0xdc, 0xfc, 0x18,
-  0xac, 0xf0, 0x2e, 0x91, 0xf3, 0x30, 0x7f, 0x01, 0x5e, 0x38, 0x08, 0xdc,
-  0xca, 0x57, 0xc5, 0xec, 0xb0, 0xdd, 0x29, 0x74, 0xd9, 0xc8, 0x14, 0x30,
-  0xf9, 0x01, 0x1a, 0xc8, 0xa1, 0xe9, 0xd8, 0x1a, 0x11, 0x07, 0xf9, 0xe5,
-  0x3a, 0xee, 0xcb, 0xc3, 0xd4, 0xfe, 0xf2, 0xf5, 0x3b, 0x2b, 0xc2, 0x34,
-  0xf4, 0xf6, 0x07, 0xf7, 0x0b, 0xec, 0x1c, 0xce, 0xd6, 0xd9, 0x10, 0xcb,
-  0x35, 0x11, 0xd5, 0xfe, 0xee, 0x34, 0xf4, 0xd6, 0x17, 0xd4, 0x45, 0x0c,
-  0x33, 0xdb, 0x17, 0xca, 0xd1, 0x53, 0x81, 0xa1, 0xe3, 0xe1, 0x0d, 0x1b,
-  0x20, 0xe9, 0x18, 0x2d, 0xee, 0x1c, 0xc6, 0x09, 0x00, 0x36, 0x6a, 0x18,
-  0xd6, 0x0b, 0x41, 0x25, 0x36, 0x29, 0xc5, 0x39, 0x70, 0xd4, 0x0a, 0x40,
-  0x18, 0x75, 0xf6, 0x18, 0x09, 0xb7, 0x55, 0xb2, 0x50, 0x87, 0x84, 0x3d,
-  0xe2, 0xb8, 0x76, 0x0d, 0x67, 0xfa, 0xb2, 0x70, 0x6b, 0xd3, 0x24, 0x82,
-  0x14, 0xe3, 0xf0, 0x52, 0xfa, 0x7f, 0x0f, 0x48, 0xc6, 0x35, 0x88, 0xc5,
-  0xa5, 0xbc, 0x0f, 0x5c, 0x06, 0x10, 0xfc, 0x82, 0x74, 0xe2, 0x98, 0xb1,
-  0x05, 0xf2, 0xea, 0xf7, 0x22, 0xf4, 0x50, 0x1d, 0x2d, 0x45, 0x2f, 0x04,
-  0x99, 0x47, 0x20, 0xc9, 0x2a, 0xe7, 0x26, 0xbb, 0x57, 0xcd, 0xa1, 0x5c,
-  0x2d, 0x6a, 0x0c, 0x3e, 0x19, 0xe4, 0x42, 0xd0, 0xc9, 0x34, 0xf0, 0x18,
-  0x6a, 0xc6, 0x36, 0x13, 0x6a, 0x7f, 0x30, 0xe9, 0xbc, 0x51, 0x3f, 0xad,
-  0xd7, 0xf2, 0x1c, 0x2f, 0x53, 0x38, 0x95, 0xc5, 0xa0, 0x36, 0xb1, 0xd8,
-  0x1c, 0xae, 0xb6, 0xe1, 0x36, 0xa6, 0x84, 0x8d, 0x3f, 0x21, 0x11, 0xed,
-  0x18, 0x16, 0x30, 0x04, 0x5c, 0x5d, 0x5e, 0xc4, 0xde, 0x74, 0x50, 0x25,
-  0xa9, 0xc9, 0xff, 0xe5, 0x21, 0xa1, 0xdd, 0xbc, 0x44, 0x22, 0xfb, 0x30,
-  0x5d, 0xa3, 0xc5, 0xf7, 0x39, 0x01, 0x32, 0xea, 0xc7, 0xe9, 0x55, 0x63,
-  0x2f, 0x87, 0x5b, 0xb3, 0x0f, 0x14, 0x81, 0x03, 0xe6, 0x29, 0xed, 0xc9,
-  0xbf, 0xe5, 0x38, 0xaf, 0xa0, 0xae, 0x99, 0x2f, 0x15, 0xfe, 0x2c, 0x7f,
-  0xe3, 0xb9, 0x43, 0x2c, 0x06, 0xba, 0xe7, 0x25, 0x38, 0x0e, 0x8f, 0x10,
-  0x16, 0x1f, 0x41, 0xfd, 0xfb, 0xf4, 0xf1, 0x5f, 0x2b, 0xba, 0xb4, 0xbe,
-  0x35, 0xbc, 0x01, 0xc9, 0x45, 0xfd, 0x81, 0x26, 0xad, 0xfa, 0x47, 0xaa,
-  0x17, 0x02, 0xd8, 0x3d, 0x5e, 0x34, 0x1a, 0x39, 0x6c, 0x9f, 0x4b, 0xf0,
-  0x53, 0x72, 0xf8, 0x34, 0x4e, 0xbe, 0x24, 0x18, 0x43, 0x19, 0x09, 0x55,
-  0x36, 0x32, 0xd4, 0xfb, 0x19, 0x0a, 0x5d, 0x55, 0xcd, 0xe0, 0x4b, 0x5a,
-  0xcd, 0x49, 0x5f, 0x15, 0xb0, 0xf6, 0xa0, 0xd1, 0x0e, 0xcc, 0x2a, 0xaf,
-  0x9a, 0x9a, 0xa5, 0xc5, 0xca, 0xea, 0x6c, 0xcd, 0xda, 0xfa, 0x26, 0x55,
-  0x6a, 0x62, 0xeb, 0xbb, 0xe9, 0xb9, 0xe8, 0x0f, 0xff, 0xb6, 0x1a, 0x55,
-  0xb2, 0x0b, 0x40, 0x21, 0x5b, 0x05, 0x56, 0xdb, 0x7f, 0xa5, 0xbe, 0xa1,
-  0xbc, 0xc6, 0x1d, 0x33, 0x27, 0xf9, 0xf9, 0x2a, 0xe8, 0x01, 0x0c, 0x2f,
-  0xeb, 0x47, 0xfd, 0x1e, 0x0f, 0x3d, 0x21, 0x4c, 0x34, 0x08, 0xcf, 0x4c,
-  0xd0, 0xe7, 0x53, 0x12, 0xde, 0x01, 0xd2, 0xa9, 0x58, 0x2f, 0xe1, 0xf0,
-  0x31, 0xde, 0xfd, 0x11, 0x11, 0xc7, 0xbf, 0xb8, 0x4b, 0x88, 0x05, 0xfb,
-  0x37, 0xe7, 0xd2, 0x4a, 0x32, 0x4c, 0x25, 0x16, 0x05, 0x0b, 0xc3, 0x37,
-  0xd8, 0xac, 0x1b, 0xdb, 0x48, 0xab, 0x7f, 0x0c, 0x1f, 0x1c, 0xa0, 0x16,
-  0xd9, 0x1c, 0xe5, 0xbf, 0xe3, 0xc7, 0x4c, 0x2a, 0x71, 0x54, 0x9f, 0x13,
-  0x03, 0x58, 0x40, 0x4a, 0x79, 0x0a, 0x2e, 0x57, 0x17, 0xd0, 0x20, 0x12,
-  0x36, 0x5f, 0xb5, 0x29, 0x93, 0x04, 0x3d, 0x42, 0x81, 0x86, 0x9f, 0x40,
-  0xa2, 0xcb, 0xc4, 0x0e, 0x39, 0xdb, 0xde, 0xee, 0x8b, 0xe0, 0x1c, 0x86,
-  0xc8, 0xb2, 0xb1, 0xce, 0x22, 0xbd, 0xa3, 0xa3, 0xeb, 0xfb, 0x20, 0xdd,
-  0xad, 0x99, 0xd4, 0x46, 0xfa, 0xf7, 0xca, 0xdb, 0xc4, 0x34, 0x4f, 0x15,
-  0x47, 0xde, 0x0e, 0x3b, 0x1d, 0x7f, 0xb7, 0x2f, 0x2a, 0x49, 0xe0, 0x0d,
-  0x4b, 0xe6, 0xb5, 0xa7, 0x46, 0x0a, 0xb1, 0xf3, 0xa0, 0x62, 0x4d, 0x55,
-  0xa9, 0x0a, 0x01, 0x1b, 0x21, 0x1f, 0x10, 0x35, 0x0a, 0xe9, 0xfb, 0xea,
-  0x40, 0x40, 0xd2, 0x00, 0xf3, 0xd6, 0xac, 0x0a, 0xb8, 0x21, 0xaf, 0xe7,
-  0xcd, 0xad, 0xe5, 0x7b, 0xfe, 0x53, 0xe8, 0x1a, 0x53, 0x5e, 0x59, 0x3d,
-  0x11, 0xe7, 0xe2, 0x20, 0xea, 0x13, 0x21, 0x43, 0x5f, 0x29, 0x46, 0xac,
-  0x86, 0xd6, 0xd9, 0xf7, 0xf6, 0x2a, 0x15, 0xf2, 0x04, 0xa2, 0x7f, 0x1b,
-  0x28, 0xf3, 0xda, 0xf9, 0xfc, 0x53, 0x10, 0x31, 0x4f, 0xf0, 0xb4, 0xef,
-  0xfb, 0xb6, 0x0b, 0x4b, 0xf4, 0x56, 0x19, 0xd5, 0x34, 0x38, 0xce, 0x19,
-  0x23, 0x4c, 0xfe, 0x52, 0x05, 0x1d, 0x85, 0x49, 0xc8, 0xe5, 0x2e, 0x4c,
-  0x1a, 0xc6, 0x3b, 0xe2, 0xfb, 0xe0, 0x02, 0xbf, 0xce, 0x07, 0xea, 0xf3,
-  0xdb, 0x1d, 0x0d, 0x22, 0xd2, 0xf5, 0x1e, 0xf4, 0xd3, 0x24, 0x0e, 0x1e,
-  0x31, 0xd9, 0xd2, 0x62, 0x1b, 0x10, 0xae, 0x43, 0xc4, 0xee, 0xda, 0x24,
-  0x41, 0x40, 0xdd, 0x09, 0x40, 0xf4, 0xf3, 0xdc, 0x7f, 0xa5, 0xd7, 0x26,
-  0xd9, 0xec, 0xf1, 0xea, 0xe0, 0xd9, 0xc8, 0xc9, 0xff, 0xd6, 0x64, 0xcf,
-  0x44, 0x5d, 0x4e, 0x5e, 0x4d, 0x1a, 0xc8, 0xff, 0xe3, 0xf1, 0xc0, 0xc6,
-  0xa0, 0x16, 0xa1, 0x35, 0xf4, 0xf9, 0x27, 0xff, 0x31, 0x37, 0x3a, 0x16,
-  0xec, 0x4d, 0x29, 0x49, 0xfc, 0x9f, 0xcf, 0x07, 0x02, 0xea, 0x77, 0xf3,
-  0xd9, 0xb3, 0x2c, 0xbc, 0xf4, 0x00, 0x5f, 0xf4, 0x31, 0xd1, 0xc7, 0x3e,
-  0x0d, 0x16, 0x7f, 0xfe, 0xf2, 0xc9, 0x16, 0xea, 0x2e, 0xab, 0x07, 0x30,
-  0xc3, 0x07, 0xb6, 0xff, 0xd7, 0x24, 0x4e, 0xb5, 0x00, 0x12, 0x49, 0xad,
-  0xcd, 0x3e, 0x17, 0xc8, 0x37, 0x72, 0xb0, 0x1f, 0xa5, 0x14, 0x03, 0x36,
-  0x46, 0x34, 0x0c, 0xbd, 0xeb, 0xd1, 0x92, 0x03, 0xc3, 0x8f, 0x10, 0xe9,
-  0xe0, 0x4f, 0xa2, 0x00, 0xc1, 0xdd, 0x9a, 0xbb, 0x38, 0x36, 0x1e, 0x1c,
-  0xb9, 0xdb, 0xbe, 0x2d, 0x59, 0x25, 0x6f, 0xfe, 0x1f, 0xa3, 0xbc, 0xa9,
-  0x22, 0xe0, 0x15, 0x30, 0xf6, 0x48, 0x7f, 0x24, 0x4d, 0x4d, 0xff, 0xe4,
-  0x1c, 0x54, 0x10, 0xc7, 0x2a, 0xbc, 0x28, 0x5a, 0x01, 0x7f, 0xdc, 0x0c,
-  0x20, 0x2f, 0xb0, 0x39, 0xed, 0x9c, 0x2a, 0xd0, 0xad, 0x05, 0x30, 0xe7,
-  0x6b, 0xc0, 0x11, 0x0d, 0xc6, 0x3b, 0xf8, 0xf7, 0x1b, 0xd3, 0xb3, 0x1e,
-  0xfe, 0x10, 0xd2, 0xea, 0x14, 0x20, 0x2e, 0xe6, 0x36, 0x2f, 0x18, 0xbb,
-  0x0e, 0x2d, 0x27, 0x38, 0x46, 0x0a, 0xe0, 0x3c, 0xd3, 0x2b, 0x65, 0x31,
-  0xd9, 0x65, 0xe4, 0x10, 0xf2, 0xc9, 0xad, 0xc9, 0xdd, 0x1a, 0xbe, 0x26,
-  0xae, 0xdb, 0x18, 0x3b, 0xd8, 0x54, 0xfa, 0x45, 0xbb, 0x0c, 0x4b, 0x3f,
-  0xe6, 0xcf, 0xf3, 0x7f, 0xcc, 0x01, 0xf0, 0x1f, 0xfb, 0x49, 0x3a, 0xdd,
-  0x2d, 0x67, 0xfb, 0xaf, 0xec, 0x1e, 0xd4, 0x4e, 0x27, 0x0e, 0xae, 0xdb,
-  0x07, 0x55, 0xbf, 0xc6, 0x2f, 0xde, 0x35, 0xb7, 0xc6, 0x54, 0xc2, 0x54,
-  0xf1, 0x26, 0x43, 0x00, 0x09, 0x88, 0xf6, 0xd5, 0x21, 0xfc, 0x35, 0xed,
-  0xed, 0x00, 0xce, 0x36, 0xe7, 0x9c, 0x00, 0x19, 0x05, 0x04, 0x25, 0xb2,
-  0x0c, 0x5c, 0x18, 0xec, 0xc9, 0xdd, 0xc7, 0xae, 0xe4, 0x32, 0x47, 0x29,
-  0xf5, 0xb2, 0xc3, 0xfc, 0x34, 0xec, 0xc2, 0x13, 0xeb, 0xd8, 0xe1, 0x06,
-  0x15, 0xe2, 0x0d, 0x1e, 0x19, 0xe3, 0x01, 0x28, 0xa4, 0xc7, 0x5a, 0x04,
-  0x4a, 0xe1, 0x9e, 0xfb, 0x95, 0x81, 0x1e, 0x46, 0x47, 0xbd, 0xfd, 0x54,
-  0xa8, 0x2d, 0xc1, 0x29, 0x88, 0xa5, 0x61, 0x26, 0xca, 0xd4, 0xaf, 0xe3,
-  0xe8, 0x0d, 0xaa, 0xd6, 0xbc, 0x1e, 0x64, 0xc0, 0xef, 0x49, 0x6a, 0x01,
-  0x58, 0x19, 0x11, 0xf4, 0xf0, 0x0d, 0xb2, 0x37, 0x2e, 0xb9, 0xa7, 0xad,
-  0xdf, 0xc3, 0x27, 0x25, 0xc9, 0x31, 0x28, 0xed, 0x81, 0x57, 0xc4, 0xa2,
-  0x48, 0xdc, 0xaa, 0x67, 0x0b, 0xd3, 0x09, 0x4d, 0x50, 0xef, 0x3c, 0xd8,
-  0xfb, 0xe7, 0xe4, 0x27, 0xfc, 0x76, 0xe3, 0xf4, 0xc8, 0xf7, 0xfa, 0xfa,
-  0x24, 0x0b, 0xd3, 0x07, 0xd6, 0xfb, 0xa7, 0xe9, 0xd5, 0xea, 0xa2, 0xdf,
-  0xde, 0x66, 0xf4, 0xf5, 0xcd, 0x29, 0xdf, 0x1c, 0x54, 0x49, 0x31, 0xed,
-  0x51, 0x10, 0xfd, 0x7f, 0x5e, 0x51, 0x71, 0xe5, 0x2c, 0x14, 0xe4, 0x39,
-  0x10, 0xea, 0xb9, 0x32, 0x6b, 0xaf, 0x01, 0x39, 0x2f, 0xb9, 0x74, 0xd3,
-  0x15, 0x30, 0x3d, 0x98, 0x7f, 0x30, 0x63, 0x21, 0xb4, 0xea, 0x24, 0xa6,
-  0xc8, 0xdf, 0x71, 0xe7, 0x4a, 0xe0, 0x4f, 0xa9, 0x41, 0x65, 0x2f, 0x27,
-  0x83, 0x2b, 0x6b, 0x42, 0xfb, 0x76, 0xc3, 0xa9, 0x2d, 0xf1, 0xb1, 0x08,
-  0xdc, 0x0f, 0x07, 0x24, 0xbf, 0x0d, 0x4a, 0xe1, 0xbe, 0x7b, 0xf1, 0xed,
-  0xe1, 0x44, 0x91, 0x43, 0x63, 0x22, 0x17, 0x2f, 0xa6, 0x16, 0xe8, 0x35,
-  0xbd, 0xad, 0x26, 0xca, 0xb2, 0x1f, 0xb1, 0x97, 0xb8, 0x45, 0x36, 0xe3,
-  0xbe, 0x21, 0xe7, 0xa6, 0xa5, 0xce, 0x4f, 0xd7, 0x7f, 0x55, 0x1e, 0x2d,
-  0x01, 0xd6, 0x30, 0xc9, 0xa8, 0xcf, 0xdc, 0x33, 0x5a, 0x50, 0xe9, 0x08,
-  0xe1, 0xfb, 0x6b, 0x0c, 0x0c, 0x56, 0x18, 0x12, 0x72, 0x18, 0x2c, 0xf2,
-  0x88, 0x14, 0xfc, 0x05, 0xc1, 0x19, 0xdf, 0xfa, 0xcd, 0x35, 0xdc, 0x42,
-  0xd1, 0x8a, 0xbc, 0x1d, 0x3e, 0xe3, 0x00, 0x26, 0xa0, 0x19, 0x1a, 0x08,
-  0x14, 0xba, 0xb8, 0xf4, 0x4d, 0xba, 0x69, 0xcb, 0x2e, 0x1f, 0xc5, 0x81,
-  0xb4, 0xdf, 0x57, 0x14, 0x55, 0x1a, 0xae, 0x3c, 0xee, 0x99, 0x3b, 0x29,
-  0x51, 0xf8, 0x38, 0xd7, 0x05, 0xf2, 0xcf, 0xf6, 0xfa, 0xf7, 0xa6, 0xdf,
-  0x1c, 0x58, 0xe6, 0x10, 0x31, 0xb2, 0xf3, 0x11, 0x51, 0x41, 0xd0, 0xde,
-  0x27, 0x46, 0xbc, 0xf2, 0xab, 0xd8, 0x8b, 0x25, 0x21, 0x0a, 0x05, 0xf6,
-  0x54, 0xed, 0x2e, 0x1f, 0xc7, 0xff, 0x4d, 0xbb, 0x0d, 0x26, 0x24, 0xd8,
-  0xa5, 0xce, 0xdb, 0x5d, 0xe8, 0x03, 0x41, 0x9f, 0xf7, 0xaf, 0x41, 0xec,
-  0x40, 0xdb, 0x2f, 0xec, 0x7f, 0xee, 0xf1, 0x35, 0xba, 0x31, 0xe8, 0xa7,
-  0xc3, 0xcc, 0x4d, 0x1d, 0x0c, 0xe4, 0xd1, 0x59, 0x14, 0x47, 0xbc, 0xe8,
-  0xf0, 0xcb, 0xff, 0x38, 0x6b, 0x2c, 0x61, 0xc9, 0x18, 0x24, 0x58, 0x23,
-  0xec, 0x1a, 0xda, 0x16, 0x13, 0xf3, 0x1e, 0x9c, 0x3e, 0x32, 0x3d, 0xd4,
-  0x59, 0xf7, 0xde, 0x3c, 0xbf, 0x36, 0xd3, 0x22, 0x44, 0x49, 0x81, 0x0e,
-  0xbb, 0x24, 0xbc, 0xed, 0xbe, 0x61, 0xa4, 0xd1, 0xc1, 0xef, 0xaa, 0xa7,
-  0xc2, 0x9c, 0xd8, 0xed, 0xc0, 0x3c, 0x39, 0x16, 0xdd, 0xed, 0x21, 0xd3,
-  0xf7, 0xc0, 0x93, 0xc1, 0x19, 0x9b, 0xbe, 0xe5, 0xfa, 0x5b, 0x5f, 0x06,
-  0xcf, 0xd5, 0x12, 0xe0, 0xa4, 0x46, 0x67, 0x9e, 0x14, 0x02, 0x41, 0xa2,
-  0x36, 0x48, 0xe6, 0x7f, 0xdc, 0x12, 0x13, 0xc1, 0x6b, 0xe0, 0xe1, 0x41,
-  0x25, 0xb6, 0x1f, 0xef, 0x19, 0x34, 0x04, 0x29, 0x0c, 0xb6, 0x0f, 0x3d,
-  0xd3, 0x17, 0xb0, 0x72, 0x56, 0xd1, 0xc4, 0xcb, 0xc6, 0xae, 0x12, 0x47,
-  0x59, 0xed, 0x08, 0x64, 0x38, 0xf1, 0xd2, 0x53, 0x5e, 0xe9, 0x22, 0x1e,
-  0xf5, 0xd5, 0x68, 0x16, 0xfd, 0xb1, 0x43, 0x13, 0xf0, 0xd2, 0xfa, 0x72,
-  0xf7, 0x36, 0x46, 0x39, 0xea, 0x06, 0x28, 0xf1, 0xbf, 0x40, 0xe2, 0x1b,
-  0xef, 0x0a, 0x00, 0xd0, 0xea, 0x27, 0xd9, 0xd9, 0x6b, 0x37, 0x7f, 0x00,
-  0xe2, 0xe4, 0xdf, 0x1d, 0x0f, 0x2c, 0xf8, 0xca, 0x06, 0xf3, 0x13, 0xff,
-  0xe5, 0xce, 0xf2, 0xfc, 0x36, 0x50, 0xd1, 0x17, 0x18, 0xc0, 0x2f, 0x16,
-  0x29, 0x50, 0x3d, 0xa9, 0x07, 0x67, 0xe4, 0xb2, 0xd8, 0x3d, 0xc5, 0x2d,
-  0xb8, 0x5a, 0xa4, 0xf6, 0x1e, 0xff, 0x51, 0x37, 0xab, 0xd5, 0x0d, 0x14,
-  0x7f, 0xed, 0xdb, 0xe1, 0xac, 0x44, 0x39, 0xd4, 0x5c, 0xfb, 0xda, 0x2c,
-  0xce, 0xd7, 0x64, 0x6d, 0xf5, 0xb4, 0x0f, 0x5c, 0xda, 0xac, 0x8c, 0xfc,
-  0x63, 0x5d, 0xec, 0xd6, 0xea, 0x23, 0x9e, 0xe9, 0xad, 0x18, 0x50, 0x01,
-  0x9f, 0xb8, 0x0d, 0x6c, 0x0a, 0xbb, 0x9d, 0x3b, 0x72, 0x9a, 0x68, 0x88,
-  0xe5, 0x4c, 0x3e, 0x21, 0xd2, 0x25, 0x1a, 0x4a, 0xdd, 0x63, 0x71, 0xff,
-  0x53, 0xc7, 0x5d, 0xc8, 0x42, 0x4a, 0x13, 0x5d, 0x51, 0x64, 0xfa, 0xb4,
-  0x90, 0x1a, 0x18, 0xb3, 0x30, 0xfe, 0x04, 0x16, 0x4e, 0x2a, 0xd4, 0xbf,
-  0x0d, 0x35, 0xac, 0xe8, 0xe0, 0xfb, 0x6c, 0xe4, 0x57, 0x44, 0x13, 0x81,
-  0xdb, 0x04, 0xda, 0xe2, 0x57, 0x12, 0x5a, 0x3b, 0xe6, 0xed, 0x6e, 0x2b,
-  0xc0, 0xd8, 0x6c, 0xb3, 0xa2, 0x09, 0xf9, 0x4c, 0x9f, 0xe8, 0xda, 0x04,
-  0xe8, 0xfa, 0xdb, 0x1f, 0x19, 0x25, 0xba, 0xe9, 0x3e, 0x96, 0xbe, 0x28,
-  0x5b, 0xf3, 0xf0, 0xbf, 0xe6, 0x3e, 0xe6, 0x00, 0x15, 0x0d, 0x9a, 0x13,
-  0xed, 0x04, 0x51, 0x2f, 0x07, 0x53, 0x01, 0x18, 0x7f, 0x5c, 0xcf, 0xfb,
-  0x3c, 0xc9, 0xd5, 0xfb, 0xf7, 0x5b, 0xbf, 0xef, 0x56, 0xd8, 0x9c, 0x3d,
-  0xb5, 0x7a, 0xf1, 0xe2, 0x50, 0x3f, 0xad, 0xd8, 0xe8, 0xc1, 0x39, 0x93,
-  0x60, 0xc1, 0x53, 0x0b, 0xc9, 0xc8, 0xb0, 0x29, 0x5f, 0x41, 0xe7, 0xc7,
-  0x22, 0xb5, 0xd0, 0xdb, 0x78, 0x25, 0x18, 0xe1, 0x02, 0xb9, 0xdf, 0x41,
-  0xcf, 0xa0, 0xd6, 0xe5, 0xbc, 0x45, 0x37, 0xc0, 0xf5, 0xef, 0xe4, 0xfa,
-  0x5d, 0xed, 0x25, 0xfe, 0x2c, 0xd7, 0x16, 0x34, 0x10, 0x3e, 0x54, 0xb9,
-  0x3d, 0xda, 0x9c, 0xfd, 0xcd, 0x33, 0x45, 0xd6, 0xc4, 0x31, 0x23, 0x3f,
-  0x08, 0xce, 0x7f, 0x15, 0x0f, 0xc6, 0x0b, 0xce, 0xda, 0xf9, 0xbd, 0xcf,
-  0xc0, 0x20, 0xf6, 0xad, 0x23, 0x57, 0xef, 0xd4, 0x45, 0x53, 0xf3, 0x21,
-  0xf1, 0xf3, 0xf7, 0x1c, 0x01, 0x16, 0x43, 0xa6, 0xb2, 0xcc, 0x30, 0x0f,
-  0xd6, 0xe9, 0x02, 0xd0, 0x3b, 0x02, 0x73, 0xfc, 0x3d, 0xca, 0x5f, 0x28,
-  0xca, 0x5a, 0x21, 0x09, 0xfc, 0x26, 0xba, 0x17, 0x97, 0xf1, 0x25, 0xc0,
-  0x3b, 0xf0, 0x2d, 0xd9, 0x32, 0x29, 0x2f, 0x21, 0xd5, 0x3a, 0x7f, 0xc9,
-  0x90, 0x50, 0x1a, 0x37, 0xca, 0x43, 0x1a, 0xdf, 0x30, 0xd6, 0x5d, 0x32,
-  0x63, 0xc8, 0x02, 0xde, 0xf9, 0x1a, 0x43, 0x59, 0x9c, 0x26, 0x17, 0xe2,
-  0x38, 0x66, 0xf1, 0x11, 0x02, 0xf9, 0xf3, 0x13, 0xa3, 0xbb, 0xec, 0xdc,
-  0xab, 0xff, 0x0c, 0xc6, 0xeb, 0x3e, 0xcd, 0x96, 0x32, 0xd4, 0xb5, 0xc0,
-  0x3b, 0x24, 0xeb, 0xc7, 0xe8, 0x36, 0xc5, 0xe3, 0x01, 0x0b, 0x4d, 0x3c,
-  0x9a, 0x9f, 0xc9, 0xcb, 0xb1, 0x3b, 0x81, 0x1c, 0x19, 0x1f, 0xca, 0xd3,
-  0x60, 0x44, 0xb4, 0xd4, 0x0d, 0x42, 0xc1, 0x0f, 0x00, 0x11, 0x03, 0x01,
-  0x30, 0x02, 0x1b, 0xca, 0x1f, 0xd2, 0x19, 0x32, 0x2f, 0x6c, 0x1d, 0xd6,
-  0xd3, 0x18, 0x1d, 0xb2, 0x13, 0xc3, 0x22, 0x23, 0x04, 0xc8, 0x32, 0xdb,
-  0xb3, 0x27, 0xda, 0xda, 0xa7, 0xfe, 0x07, 0x33, 0x1b, 0x3f, 0x63, 0xe7,
-  0x30, 0x23, 0x55, 0xad, 0x4a, 0x35, 0x42, 0xf0, 0x7f, 0xf8, 0xcd, 0xdf,
-  0x52, 0xb1, 0xc1, 0x20, 0xb7, 0x10, 0x22, 0x97, 0xbd, 0x91, 0xcd, 0x2f,
-  0xda, 0xbb, 0x06, 0x30, 0xd7, 0xe6, 0xa8, 0x4b, 0xef, 0xbf, 0xfc, 0x14,
-  0x02, 0x34, 0x36, 0x0e, 0xbe, 0xad, 0x2a, 0xe5, 0x23, 0xf1, 0xe9, 0xc1,
-  0xfb, 0x3f, 0xb4, 0x04, 0xd5, 0x0c, 0x0b, 0x31, 0x0e, 0x14, 0x12, 0x25,
-  0x6e, 0x96, 0xb8, 0x3e, 0x01, 0xdb, 0x19, 0xb6, 0xfe, 0xd3, 0xed, 0xc3,
-  0xb7, 0x19, 0x7f, 0xf3, 0x0d, 0xc4, 0x6b, 0xc0, 0x23, 0x3d, 0xad, 0x07,
-  0xc1, 0x46, 0x41, 0x23, 0x23, 0xb9, 0x34, 0xf7, 0x5c, 0xd7, 0xef, 0x4e,
-  0x3f, 0x00, 0x5b, 0x78, 0xe0, 0xcb, 0xed, 0x9f, 0x6d, 0x6a, 0xa2, 0xf3,
-  0xd2, 0xfd, 0x1a, 0xac, 0xb1, 0x7f, 0xcc, 0xf5, 0x3a, 0x33, 0x4b, 0xf3,
-  0x0a, 0xcf, 0x4a, 0x41, 0xc1, 0x1b, 0xd5, 0x49, 0x3f, 0xd1, 0x3d, 0xe8,
-  0x41, 0x31, 0xb8, 0x2f, 0x69, 0xfc, 0xdf, 0x33, 0xc1, 0x22, 0xce, 0xe6,
-  0x20, 0x86, 0xda, 0x08, 0x6a, 0x2e, 0xcd, 0x2b, 0xd0, 0xd4, 0xf5, 0x1c,
-  0x34, 0x28, 0x3b, 0x81, 0xe4, 0x5f, 0xba, 0x0e, 0x1c, 0x15, 0xfa, 0xef,
-  0xfa, 0x24, 0x02, 0x58, 0xdc, 0x15, 0x1a, 0xae, 0x2f, 0xf4, 0xd2, 0xe2,
-  0x43, 0xc9, 0xdb, 0xd1, 0xc5, 0xb9, 0xcc, 0x2d, 0xfa, 0xeb, 0x37, 0x26,
-  0x5c, 0xec, 0x40, 0xfb, 0xd9, 0xfa, 0xcf, 0x42, 0x3e, 0xb9, 0x05, 0x8f,
-  0x1b, 0xca, 0x30, 0x44, 0x1c, 0xa4, 0xcf, 0xb4, 0x3b, 0x07, 0x62, 0xf4,
-  0x04, 0x9e, 0x3c, 0xb6, 0xaf, 0x20, 0x36, 0x30, 0xfc, 0x01, 0x32, 0x04,
-  0x33, 0x06, 0x1f, 0x42, 0x7f, 0xcd, 0xd1, 0x8e, 0xf4, 0x16, 0x21, 0x04,
-  0x4f, 0xf2, 0x29, 0x15, 0x01, 0x41, 0x4e, 0xac, 0x33, 0x6e, 0x20, 0x2b,
-  0xf8, 0xcf, 0x58, 0xf0, 0x1e, 0x1f, 0xa7, 0xd6, 0xc0, 0x1c, 0x00, 0x57,
-  0xd3, 0xd4, 0x6d, 0xe5, 0x10, 0x5a, 0xf2, 0x33, 0x44, 0xb4, 0x81, 0xf8,
-  0xa2, 0xff, 0xb6, 0x40, 0xcc, 0x32, 0x04, 0xc0, 0x09, 0x54, 0x29, 0xad,
-  0x18, 0xed, 0x50, 0x41, 0x6b, 0xaf, 0xc1, 0xd8, 0xfd, 0xd4, 0xe9, 0x16,
-  0xf8, 0x56, 0x6c, 0xd0, 0x3f, 0x1e, 0xe8, 0x50, 0xf2, 0x5e, 0x59, 0xa7,
-  0x94, 0x37, 0x23, 0xcd, 0xc2, 0x09, 0x0f, 0x4e, 0x3d, 0x1b, 0xff, 0xca,
-  0xb7, 0xb2, 0xad, 0x5d, 0xfc, 0xcf, 0x2a, 0x09, 0x9f, 0x7f, 0x4b, 0x5f,
-  0x26, 0x2b, 0x41, 0xd0, 0xac, 0x43, 0x5c, 0x12, 0xf7, 0x43, 0xe2, 0x1b,
-  0xcf, 0xf0, 0x0f, 0xb1, 0xbb, 0xd3, 0xe1, 0x5c, 0xf3, 0xca, 0x9e, 0x41,
-  0xbc, 0xe7, 0x64, 0x1f, 0x38, 0xe3, 0xc0, 0xc5, 0xd8, 0x69, 0xce, 0xe3,
-  0xaa, 0x07, 0x8c, 0x35, 0x30, 0xd2, 0xdb, 0x12, 0x76, 0xf2, 0x33, 0x3d,
-  0xa9, 0x03, 0xc9, 0x28, 0x25, 0x0c, 0x1a, 0x30, 0xf0, 0x41, 0x58, 0x63,
-  0xf6, 0xd5, 0xc7, 0x71, 0xf7, 0x38, 0xbe, 0x4b, 0xd9, 0x18, 0x4e, 0xc7,
-  0x0f, 0xb5, 0xea, 0x3e, 0x96, 0xf1, 0x9b, 0xed, 0xba, 0x0a, 0x78, 0xd2,
-  0xdd, 0xbf, 0x1b, 0xe9, 0x03, 0xc2, 0x71, 0x87, 0x2f, 0xd3, 0x07, 0x0e,
-  0x0d, 0xad, 0x41, 0xbf, 0x0c, 0xb4, 0x63, 0xc9, 0x7f, 0xf2, 0x56, 0x07,
-  0x42, 0xf1, 0xbb, 0x69, 0xc0, 0x1f, 0xc4, 0xb6, 0x5a, 0xce, 0x45, 0xc6,
-  0x5d, 0xba, 0xa8, 0xdc, 0xb8, 0x3a, 0xb0, 0x43, 0x7f, 0x32, 0x4b, 0x06,
-  0x2f, 0x23, 0x22, 0xb2, 0xb8, 0x46, 0xd8, 0xfc, 0xab, 0xfd, 0xa2, 0xff,
-  0x0f, 0xfa, 0x4f, 0xee, 0x8d, 0x14, 0xb0, 0xb0, 0x60, 0x11, 0x89, 0x35,
-  0x73, 0x41, 0x2b, 0xfe, 0x06, 0x8d, 0xa1, 0x9b, 0xed, 0xe0, 0x78, 0xba,
-  0x42, 0x1b, 0x5d, 0x9f, 0xed, 0xdd, 0xd3, 0x62, 0x10, 0x4f, 0xde, 0xb7,
-  0x36, 0xde, 0x24, 0xc2, 0x64, 0xfa, 0xf2, 0x42, 0x17, 0xa9, 0xe3, 0x18,
-  0x69, 0xf4, 0xc8, 0xfd, 0x25, 0x16, 0xd0, 0x9d, 0x4a, 0x60, 0xdc, 0xbe,
-  0xcf, 0x01, 0x9f, 0x15, 0x63, 0x55, 0x1d, 0xa6, 0x41, 0x21, 0xcc, 0x51,
-  0xf0, 0x58, 0x85, 0x20, 0xf5, 0x3f, 0x21, 0xb1, 0xe9, 0x3c, 0xc0, 0x7f,
-  0x2a, 0x01, 0xb1, 0xb0, 0x1f, 0xa8, 0xb1, 0x5c, 0x78, 0xc2, 0x57, 0x34,
-  0x03, 0x06, 0xde, 0xec, 0xdf, 0x1a, 0xce, 0x17, 0x94, 0x1e, 0x1a, 0xce,
-  0x2d, 0x44, 0xb0, 0xd7, 0x2a, 0x29, 0x2c, 0x3e, 0x52, 0xf3, 0x24, 0x31,
-  0x0f, 0xcc, 0x13, 0x58, 0x22, 0xc8, 0xb4, 0xf5, 0xbb, 0xd3, 0x58, 0xcd,
-  0x12, 0xf4, 0x15, 0xc2, 0xc2, 0x2d, 0x1d, 0xf8, 0x07, 0x26, 0x81, 0xe3,
-  0x63, 0x4f, 0xbe, 0xd0, 0x73, 0x53, 0x34, 0xbd, 0x5e, 0x1a, 0xb2, 0xf9,
-  0xd8, 0x3b, 0x29, 0x5c, 0xd5, 0x4e, 0xf2, 0xe7, 0x37, 0x32, 0xf9, 0x09,
-  0x99, 0x2c, 0xaa, 0x38, 0xda, 0x38, 0x01, 0x09, 0x4d, 0x34, 0xb7, 0x79,
-  0xbe, 0x2c, 0x30, 0xaa, 0x39, 0xe7, 0xe5, 0xc9, 0xff, 0x10, 0xb5, 0x03,
-  0x1d, 0x37, 0xe8, 0xad, 0x03, 0x2a, 0x4f, 0x93, 0x26, 0xf3, 0x01, 0xaa,
-  0xb1, 0x2b, 0xca, 0x09, 0x30, 0xe6, 0xcc, 0x7c, 0x58, 0x08, 0xd5, 0x31,
-  0xde, 0xff, 0xb7, 0xb2, 0x6d, 0xc1, 0x81, 0xdb, 0xb4, 0x00, 0xca, 0x60,
-  0x38, 0x33, 0x11, 0xcc, 0xeb, 0x60, 0x09, 0x57, 0x1f, 0x21, 0x3d, 0xde,
-  0x02, 0xa5, 0xc7, 0xd3, 0x55, 0xe6, 0x28, 0xc8, 0x22, 0x17, 0x08, 0xba,
-  0xe0, 0xba, 0x27, 0xd4, 0xb9, 0x0a, 0xbf, 0xd9, 0x2f, 0x36, 0xbf, 0x2e,
-  0xdf, 0xd1, 0x25, 0x24, 0xfa, 0xb1, 0xe2, 0x53, 0xd4, 0x03, 0x3b, 0x0c,
-  0x3b, 0xab, 0x37, 0xdd, 0x08, 0xea, 0x31, 0xf6, 0xc0, 0x22, 0xbc, 0x59,
-  0xe3, 0x48, 0x0b, 0x83, 0x0e, 0xd0, 0xdb, 0xd6, 0x34, 0x0c, 0x81, 0xc5,
-  0x3c, 0xbe, 0x81, 0xd0, 0x55, 0x3e, 0x21, 0xd8, 0x44, 0xcb, 0xbf, 0xdf,
-  0x0c, 0xff, 0xd3, 0xaa, 0xad, 0x29, 0x49, 0xbf, 0x54, 0x44, 0x54, 0x5c,
-  0x03, 0x0b, 0x31, 0xf3, 0x02, 0xf1, 0xc0, 0x44, 0x5e, 0xf4, 0x63, 0xda,
-  0x00, 0x9d, 0xd3, 0x35, 0x22, 0x23, 0xab, 0xb9, 0xec, 0x0b, 0x11, 0x0e,
-  0x22, 0x95, 0xc8, 0x4e, 0x34, 0xf5, 0xe7, 0xf6, 0x28, 0xed, 0x6c, 0xea,
-  0xb5, 0xc7, 0xf8, 0x2a, 0xcd, 0x16, 0xbe, 0xe4, 0xf3, 0x53, 0x5e, 0x00,
-  0x3d, 0x42, 0xe0, 0xe6, 0x16, 0xc6, 0x04, 0x62, 0xc2, 0x32, 0x09, 0xf3,
-  0xee, 0xd3, 0x14, 0x04, 0x4b, 0x58, 0xe0, 0xe9, 0x1d, 0x7f, 0x0a, 0x82,
-  0xf0, 0xba, 0x37, 0xa2, 0xae, 0xe9, 0xf1, 0x9d, 0xfe, 0x04, 0x44, 0xb6,
-  0x22, 0x16, 0xd6, 0xc8, 0x35, 0xcf, 0x69, 0x11, 0xcf, 0x28, 0xed, 0xd8,
-  0x0f, 0x17, 0x6a, 0xea, 0xca, 0x4d, 0xcf, 0xd6, 0x30, 0xb2, 0x81, 0x43,
-  0xbc, 0xc2, 0xfc, 0x41, 0x2f, 0xc5, 0x64, 0x1a, 0x24, 0x6b, 0x48, 0x97,
-  0xf5, 0xd2, 0x26, 0xaf, 0xa5, 0xa2, 0x17, 0x1e, 0xb1, 0x53, 0x92, 0xcb,
-  0xcc, 0xe7, 0x15, 0xdb, 0x38, 0xad, 0x21, 0x47, 0xbd, 0x32, 0x5b, 0xd1,
-  0x4a, 0x4b, 0xcd, 0x2a, 0x1f, 0xf0, 0x29, 0x33, 0xeb, 0xc7, 0x54, 0x04,
-  0x36, 0xf3, 0xdd, 0xed, 0x1a, 0x58, 0x30, 0x27, 0x1c, 0xa0, 0xa0, 0xe0,
-  0x61, 0xe5, 0xf3, 0x3a, 0x19, 0x0a, 0xf8, 0x0e, 0xd8, 0xb3, 0x25, 0xe5,
-  0xfe, 0x81, 0x0f, 0x56, 0x00, 0xe2, 0x1e, 0x6f, 0xda, 0x10, 0xea, 0xe6,
-  0x17, 0xf1, 0x2e, 0x0a, 0x28, 0xd3, 0x1d, 0x30, 0xe7, 0xdb, 0xc6, 0xd2,
-  0x06, 0x23, 0x3e, 0x2f, 0x5a, 0xc3, 0x06, 0xfd, 0xe5, 0xf2, 0x02, 0x0c,
-  0x13, 0x06, 0x30, 0x55, 0xc8, 0x42, 0x20, 0x0c, 0x13, 0xbd, 0x0a, 0x2a,
-  0x4b, 0x14, 0xc8, 0x30, 0x27, 0xd8, 0x34, 0x11, 0x37, 0x0e, 0x24, 0xea,
-  0x7a, 0x3f, 0x06, 0x58, 0x10, 0xf0, 0xdd, 0x4a, 0x39, 0x42, 0x45, 0x81,
-  0x09, 0xdc, 0xe2, 0xc6, 0x00, 0xbc, 0xe1, 0xc8, 0x2a, 0x21, 0x0f, 0x10,
-  0x31, 0xe4, 0x61, 0xee, 0xe5, 0xbf, 0x00, 0x25, 0x0a, 0x14, 0x90, 0x57,
-  0x19, 0xe4, 0x27, 0x47, 0x4c, 0x0c, 0x6f, 0xbc, 0x34, 0x1f, 0x16, 0x9a,
-  0x1a, 0xd5, 0x55, 0xd3, 0x20, 0x1b, 0x2b, 0x3a, 0xda, 0x16, 0xe6, 0xf3,
-  0xe5, 0x54, 0x63, 0x01, 0xc9, 0x27, 0xf4, 0x5a, 0xc1, 0x4a, 0x1e, 0xe0,
-  0x36, 0x36, 0x81, 0xfa, 0x39, 0x21, 0xbf, 0xf3, 0xe1, 0x28, 0x58, 0xfb,
-  0x5f, 0x32, 0xd5, 0x48, 0xd1, 0x2f, 0xf7, 0x38, 0x4d, 0xb2, 0xb4, 0xe4,
-  0xb0, 0x07, 0xd0, 0x17, 0xd7, 0x9c, 0xd8, 0x0a, 0xee, 0xbf, 0x73, 0x1c,
-  0x3a, 0xaf, 0xd5, 0xfd, 0x6d, 0x23, 0xe1, 0x38, 0x13, 0xfc, 0x2d, 0x88,
-  0x59, 0x25, 0x10, 0x1a, 0xf2, 0xe8, 0xed, 0xd7, 0x93, 0x8f, 0x4c, 0x5b,
-  0xfa, 0x6d, 0x2e, 0xdf, 0xf0, 0xbd, 0xf4, 0x03, 0xdf, 0xbf, 0xbc, 0xe1,
-  0xaf, 0x5a, 0xbd, 0xb2, 0x13, 0x77, 0xfc, 0x25, 0x1a, 0xc7, 0xe4, 0x30,
-  0xb7, 0xf6, 0xeb, 0xda, 0xbf, 0xee, 0xc7, 0x6c, 0x0b, 0x81, 0x4f, 0xae,
-  0x22, 0xd3, 0x9b, 0x18, 0x61, 0xf7, 0xb5, 0xd6, 0xa1, 0x61, 0x1e, 0xf4,
-  0x56, 0x1f, 0x84, 0x31, 0xb1, 0xe2, 0x44, 0x29, 0xe0, 0x1d, 0x26, 0x35,
-  0x41, 0x4a, 0xbc, 0x7f, 0x33, 0xc4, 0xaf, 0xed, 0x5b, 0xef, 0xe5, 0xfc,
-  0xf4, 0xc8, 0xfe, 0xbb, 0x54, 0x10, 0x9b, 0xe2, 0xcb, 0x52, 0x1e, 0xdd,
-  0xc9, 0x29, 0xa0, 0x08, 0xf1, 0xe7, 0xe9, 0x62, 0xbd, 0xed, 0x54, 0x29,
-  0x27, 0xfa, 0xcf, 0xac, 0xf3, 0xe6, 0x6f, 0xd8, 0x37, 0x07, 0xcc, 0xd3,
-  0x1f, 0xe6, 0x74, 0xee, 0xc2, 0x11, 0x9b, 0xf6, 0x53, 0x06, 0x11, 0xcf,
-  0x1c, 0xbb, 0xb4, 0x3c, 0x1f, 0xcc, 0x03, 0x61, 0xe4, 0xf1, 0x09, 0xe9,
-  0xd5, 0xa7, 0xbd, 0x04, 0x27, 0x1f, 0x05, 0x25, 0x1c, 0x5f, 0x39, 0x4c,
-  0xd0, 0xd2, 0xa1, 0x02, 0x2a, 0x3f, 0xef, 0x6b, 0x21, 0x65, 0xb3, 0xc6,
-  0xa2, 0x24, 0xfa, 0xd8, 0xc0, 0x7f, 0x93, 0xe1, 0x46, 0x54, 0x05, 0x0c,
-  0x42, 0xbd, 0xeb, 0x06, 0xf5, 0xf6, 0x23, 0x2c, 0xa4, 0x33, 0x08, 0xfe,
-  0xcf, 0xfd, 0xb1, 0xd7, 0x35, 0x54, 0x40, 0xfd, 0x44, 0x3d, 0xc2, 0x01,
-  0xfc, 0xb3, 0x45, 0xcf, 0x47, 0x7e, 0xbd, 0xae, 0xef, 0x9c, 0x38, 0xad,
-  0x49, 0xe6, 0xd2, 0xed, 0xff, 0x33, 0x36, 0x81, 0x7d, 0x0b, 0xc6, 0x36,
-  0x98, 0xbc, 0x3d, 0x39, 0x2e, 0xbd, 0xd2, 0xdc, 0x4e, 0xce, 0xba, 0xd2,
-  0xc4, 0x39, 0xbc, 0xd1, 0x48, 0x17, 0x42, 0x14, 0x85, 0xb6, 0x1c, 0x1e,
-  0x40, 0xad, 0x0f, 0x5f, 0xda, 0x3f, 0xcf, 0xb9, 0x28, 0x2a, 0x50, 0xea,
-  0x26, 0xbd, 0x16, 0x9f, 0xb1, 0x08, 0xfe, 0x15, 0x08, 0x0c, 0xb7, 0x23,
-  0xa3, 0xda, 0x3a, 0x41, 0xd5, 0x69, 0xe6, 0x43, 0x22, 0x57, 0x04, 0xfb,
-  0xeb, 0x00, 0xda, 0x45, 0x6d, 0x10, 0x1e, 0xe6, 0x67, 0x30, 0x4f, 0x40,
-  0x7f, 0xe8, 0x1c, 0xb2, 0x2c, 0x56, 0x07, 0xee, 0xeb, 0x26, 0x95, 0xc6,
-  0xf3, 0xb8, 0xf5, 0x24, 0x29, 0xc3, 0xec, 0x17, 0xcc, 0xf8, 0xdb, 0x04,
-  0x67, 0x43, 0x84, 0x13, 0x84, 0x53, 0x0a, 0x77, 0x28, 0xec, 0x67, 0xf9,
-  0xfa, 0xca, 0xd4, 0xef, 0xa7, 0xde, 0x28, 0xfb, 0xba, 0x60, 0x13, 0xfc,
-  0x63, 0x65, 0x8c, 0x13, 0x08, 0x81, 0x19, 0x05, 0xe3, 0x52, 0x0e, 0x16,
-  0xb0, 0xc3, 0x35, 0xf6, 0xe4, 0xd4, 0x11, 0x3b, 0x0d, 0xd3, 0xf4, 0x37,
-  0x43, 0xcd, 0x40, 0x30, 0xef, 0x72, 0xe9, 0x0c, 0x3f, 0x5c, 0xd5, 0xf7,
-  0xe7, 0x02, 0xc4, 0xe9, 0x29, 0x35, 0xae, 0x11, 0xb3, 0x47, 0xd0, 0xdf,
-  0x07, 0x1f, 0x62, 0xe7, 0xd5, 0x43, 0xf7, 0x10, 0xcd, 0xf0, 0x08, 0x4f,
-  0x0a, 0xd0, 0x32, 0xd8, 0xe5, 0x30, 0x1b, 0xea, 0xca, 0x0f, 0x50, 0xdf,
-  0x1c, 0x0f, 0xc3, 0x56, 0x29, 0x0e, 0xb6, 0x0f, 0x3c, 0x4e, 0xea, 0x46,
-  0xb5, 0x09, 0xae, 0x73, 0xf6, 0x45, 0xf7, 0xe7, 0xb3, 0x32, 0x39, 0x7f,
-  0x9c, 0x19, 0x1b, 0xaf, 0x5e, 0x19, 0x73, 0x23, 0x36, 0xd9, 0x43, 0x5f,
-  0x81, 0xb4, 0xe6, 0xc0, 0xed, 0x55, 0x6f, 0xf6, 0x6c, 0x41, 0x1b, 0xd3,
-  0xfd, 0xcd, 0xa1, 0xd5, 0xa8, 0x4f, 0x97, 0x23, 0x16, 0x9d, 0xc1, 0xdc,
-  0x45, 0x1c, 0x67, 0x34, 0xf3, 0xce, 0x16, 0xec, 0x8a, 0x33, 0xb2, 0xf9,
-  0x53, 0x00, 0x58, 0x46, 0xdc, 0xc9, 0xf0, 0xbd, 0xe7, 0xbe, 0xc6, 0xaf,
-  0xdf, 0x2c, 0x37, 0x12, 0x07, 0xe7, 0x6e, 0x4e, 0xb2, 0x19, 0x0e, 0x47,
-  0x0d, 0xce, 0x31, 0xce, 0x14, 0x38, 0x59, 0x81, 0xbb, 0x14, 0x05, 0x46,
-  0xfe, 0xed, 0xc9, 0x6a, 0x33, 0x32, 0x1d, 0xf6, 0x58, 0xb1, 0x32, 0xdd,
-  0x0c, 0xff, 0xaf, 0x42, 0xfd, 0x1c, 0x89, 0x21, 0x29, 0xe5, 0x59, 0x67,
-  0x35, 0x54, 0xaa, 0x05, 0x4c, 0x1c, 0x84, 0x1c, 0x35, 0x20, 0xec, 0x23,
-  0xf2, 0x1f, 0x5e, 0xbd, 0x30, 0xdf, 0x94, 0x02, 0xbd, 0x61, 0xfa, 0x31,
-  0x52, 0xd4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xc2, 0x07, 0x00, 0x00, 0xd3, 0x08, 0x00, 0x00, 0x22, 0xf3, 0xff, 0xff,
-  0x32, 0x08, 0x00, 0x00, 0xcd, 0x02, 0x00, 0x00, 0x3c, 0x07, 0x00, 0x00,
-  0x76, 0xf9, 0xff, 0xff, 0x43, 0xfc, 0xff, 0xff, 0x08, 0x03, 0x00, 0x00,
-  0xa9, 0xf3, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0xf2, 0xf8, 0xff, 0xff,
-  0x50, 0x0a, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x57, 0xf4, 0xff, 0xff,
-  0xca, 0x01, 0x00, 0x00, 0x62, 0xf9, 0xff, 0xff, 0x59, 0x00, 0x00, 0x00,
-  0x0a, 0xf7, 0xff, 0xff, 0x76, 0xfb, 0xff, 0xff, 0xe8, 0x0b, 0x00, 0x00,
-  0x9f, 0x05, 0x00, 0x00, 0x78, 0xf5, 0xff, 0xff, 0x63, 0xfb, 0xff, 0xff,
-  0x21, 0xfe, 0xff, 0xff, 0xe5, 0x02, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00,
-  0xe8, 0x0a, 0x00, 0x00, 0x5c, 0xf2, 0xff, 0xff, 0xb1, 0xfb, 0xff, 0xff,
-  0x4c, 0xfe, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff,
-  0xe5, 0xfc, 0xff, 0xff, 0x16, 0xf9, 0xff, 0xff, 0xd0, 0x05, 0x00, 0x00,
-  0x3b, 0xf9, 0xff, 0xff, 0x73, 0x09, 0x00, 0x00, 0x2d, 0xf3, 0xff, 0xff,
-  0x32, 0x04, 0x00, 0x00, 0xbc, 0xf5, 0xff, 0xff, 0x98, 0xfc, 0xff, 0xff,
-  0x90, 0xf9, 0xff, 0xff, 0x49, 0x00, 0x00, 0x00, 0x36, 0xfa, 0xff, 0xff,
-  0x4e, 0xfc, 0xff, 0xff, 0xef, 0xf6, 0xff, 0xff, 0x8e, 0x01, 0x00, 0x00,
-  0x76, 0x04, 0x00, 0x00, 0xbf, 0xf9, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00,
-  0xcf, 0x01, 0x00, 0x00, 0x7e, 0xf6, 0xff, 0xff, 0x90, 0xf4, 0xff, 0xff,
-  0x3c, 0x01, 0x00, 0x00, 0xab, 0x09, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00,
-  0xa0, 0xfe, 0xff, 0xff, 0x1e, 0x02, 0x00, 0x00, 0x58, 0xf9, 0xff, 0xff,
-  0xa8, 0xfb, 0xff, 0xff, 0x3c, 0xfb, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00,
-  0xa0, 0xf4, 0xff, 0xff, 0x5e, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0xfc, 0xf3, 0x6a, 0xd2, 0x81, 0x28, 0x54, 0x27,
-  0xf2, 0xa7, 0x7f, 0x5a, 0xc4, 0x3d, 0x0d, 0x7f, 0x57, 0x60, 0x81, 0xad,
-  0xd4, 0x5b, 0x52, 0x81, 0x81, 0xa1, 0x60, 0xe7, 0x45, 0x7f, 0x81, 0xc7,
-  0x05, 0xf4, 0x65, 0x81, 0x7f, 0x8b, 0xcd, 0x81, 0x9e, 0x7f, 0xc8, 0x97,
-  0xf4, 0x7f, 0x10, 0x7f, 0xe0, 0xe3, 0x95, 0xe4, 0xbb, 0x0b, 0x3c, 0x62,
-  0xbd, 0x08, 0x7f, 0xc0, 0x11, 0x02, 0xc8, 0x40, 0x30, 0xed, 0xf0, 0x3e,
-  0x07, 0xd4, 0x3e, 0x81, 0x81, 0xb9, 0x17, 0xdf, 0xdb, 0x6a, 0x19, 0x1b,
-  0xc6, 0x09, 0x0f, 0x73, 0xbb, 0xc5, 0xe7, 0xb0, 0x22, 0x1d, 0x00, 0x87,
-  0xf0, 0x1c, 0xce, 0x4e, 0x7a, 0xe7, 0x5c, 0x54, 0xf2, 0x30, 0x2a, 0xe3,
-  0x81, 0x41, 0x13, 0xe4, 0xda, 0x55, 0x49, 0xfc, 0x36, 0xfd, 0x9d, 0x9b,
-  0x81, 0xc9, 0x98, 0xe9, 0x35, 0xd8, 0x27, 0x6c, 0x4f, 0xfc, 0x00, 0x06,
-  0xfd, 0x7b, 0x7f, 0x23, 0xf1, 0xc0, 0xd9, 0x4c, 0xe9, 0x33, 0x4a, 0x19,
-  0x81, 0x7f, 0x7f, 0xda, 0x81, 0x7f, 0xc9, 0xbc, 0xa1, 0xc5, 0xec, 0xbb,
-  0xaa, 0x72, 0x81, 0x81, 0x20, 0x21, 0x86, 0x14, 0x7f, 0x20, 0x7f, 0xc5,
-  0x3f, 0x81, 0xd0, 0xb4, 0xf8, 0x13, 0x7f, 0xbb, 0xc1, 0xbf, 0x19, 0x26,
-  0xe5, 0x8b, 0x97, 0x35, 0xdd, 0x6a, 0x7f, 0xd2, 0x7f, 0x3d, 0x5b, 0xb4,
-  0x3e, 0xe8, 0x81, 0x4b, 0x7f, 0xe2, 0xf2, 0xc3, 0xd9, 0x5f, 0xa8, 0x35,
-  0x0a, 0x13, 0xe7, 0x4c, 0xca, 0xef, 0xf7, 0x0a, 0xfd, 0x7b, 0x9a, 0x23,
-  0x0a, 0xfe, 0xca, 0x0b, 0x01, 0x82, 0x59, 0xed, 0xd0, 0x4e, 0xf0, 0xb8,
-  0x55, 0x81, 0x37, 0xa8, 0x3d, 0x6e, 0x81, 0xa7, 0xab, 0x59, 0xf5, 0x34,
-  0x95, 0x49, 0xf5, 0x4f, 0x49, 0x2a, 0x81, 0xdb, 0xca, 0x78, 0x56, 0xf2,
-  0xe5, 0x64, 0x0d, 0xbb, 0x10, 0x81, 0x9e, 0xfa, 0x03, 0x40, 0x0a, 0x81,
-  0xfa, 0x0f, 0xf8, 0xa6, 0xc9, 0x3a, 0x1c, 0xa6, 0xc9, 0x27, 0xec, 0xd0,
-  0xed, 0x04, 0x06, 0xc8, 0xd3, 0x81, 0xac, 0xf6, 0xe3, 0x81, 0xfc, 0xfe,
-  0x81, 0xe6, 0x4d, 0x81, 0x04, 0xb9, 0x9a, 0x2f, 0x2b, 0x27, 0x52, 0xa2,
-  0xda, 0xee, 0xc2, 0x21, 0xb2, 0x50, 0x4b, 0x07, 0x6c, 0xc3, 0xd0, 0x81,
-  0xae, 0x64, 0x15, 0x81, 0x61, 0x03, 0x17, 0x3e, 0x7f, 0xaa, 0xaf, 0x46,
-  0x6a, 0x7f, 0x32, 0xf3, 0xd1, 0xbd, 0x81, 0xe6, 0x52, 0x34, 0xd5, 0x81,
-  0x47, 0x2a, 0x41, 0x34, 0xc5, 0xfc, 0xe3, 0x2c, 0xfb, 0xb4, 0x8f, 0xfa,
-  0xaf, 0x4e, 0x9f, 0x9b, 0xec, 0x0c, 0x19, 0x3e, 0x09, 0xba, 0x69, 0xe8,
-  0x19, 0x19, 0xd8, 0x11, 0xd1, 0x28, 0x75, 0x81, 0xb8, 0xba, 0xca, 0xf0,
-  0xf9, 0xeb, 0xd2, 0xf3, 0xe0, 0x73, 0x40, 0xf6, 0x66, 0x6b, 0xf9, 0x15,
-  0xfd, 0xdb, 0xd8, 0xfa, 0x2c, 0xc5, 0x4b, 0x0b, 0xb2, 0x1b, 0x11, 0x1b,
-  0x20, 0x81, 0xe6, 0xd0, 0x49, 0x21, 0xc0, 0xd3, 0x9b, 0x67, 0xa3, 0xba,
-  0xed, 0x0e, 0xf4, 0xea, 0xed, 0xf5, 0x0a, 0x25, 0x1d, 0x67, 0xb9, 0xe2,
-  0xd7, 0xa8, 0xfe, 0x21, 0x71, 0x6c, 0xf6, 0xc1, 0xc7, 0xc9, 0x07, 0xe0,
-  0x7d, 0x3e, 0x25, 0x3c, 0x7b, 0x7f, 0xe4, 0xdc, 0xd9, 0x5a, 0x1d, 0x56,
-  0x43, 0x7f, 0xeb, 0x12, 0xa2, 0xbe, 0x20, 0x7f, 0xee, 0xa4, 0xeb, 0xa3,
-  0xdf, 0x18, 0x6c, 0x18, 0xb7, 0x09, 0x26, 0x12, 0x32, 0x65, 0x07, 0xe7,
-  0x38, 0xec, 0x08, 0x0c, 0x5b, 0xa7, 0xe7, 0xf1, 0x4a, 0xf3, 0x18, 0x15,
-  0xc9, 0xb0, 0xb9, 0xb0, 0x2f, 0xd4, 0xb8, 0xd9, 0x0d, 0x38, 0xdb, 0x21,
-  0xe0, 0x14, 0x28, 0x58, 0xd3, 0x04, 0xe0, 0x06, 0x81, 0x5d, 0xeb, 0x91,
-  0xf1, 0x19, 0xec, 0xf0, 0x2d, 0x29, 0xc5, 0x7f, 0x3e, 0xc4, 0x14, 0x30,
-  0xe3, 0x70, 0xf0, 0x00, 0x9f, 0x81, 0x3b, 0x3b, 0xbc, 0x6f, 0x12, 0xf8,
-  0x11, 0x1d, 0x1d, 0x32, 0xf5, 0xb3, 0xfa, 0x81, 0x7f, 0xae, 0x81, 0x1c,
-  0xc3, 0x26, 0xa7, 0xb4, 0x63, 0x02, 0xe6, 0xac, 0xe7, 0xbc, 0x34, 0x0c,
-  0xf2, 0x19, 0x97, 0x0c, 0xe6, 0xec, 0x3e, 0x01, 0x7f, 0xdd, 0x81, 0xcf,
-  0xf7, 0x60, 0x48, 0xfc, 0x22, 0x7f, 0x2d, 0x48, 0x2f, 0x43, 0x06, 0xb9,
-  0xa4, 0x21, 0x3f, 0x47, 0xaa, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0xbf, 0xf9, 0xff, 0xff, 0x3d, 0xfb, 0xff, 0xff,
-  0x2f, 0xfa, 0xff, 0xff, 0xa7, 0x04, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00,
-  0x20, 0x03, 0x00, 0x00, 0xc8, 0xfd, 0xff, 0xff, 0x25, 0xfe, 0xff, 0xff,
-  0xbe, 0x05, 0x00, 0x00, 0x88, 0xfe, 0xff, 0xff, 0xd3, 0xfa, 0xff, 0xff,
-  0x0a, 0x03, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0xf9, 0xf3, 0xff, 0xff,
-  0x31, 0xfb, 0xff, 0xff, 0x89, 0xfd, 0xff, 0xff, 0x74, 0x06, 0x00, 0x00,
-  0xa6, 0xfb, 0xff, 0xff, 0xb4, 0x0c, 0x00, 0x00, 0x7d, 0x02, 0x00, 0x00,
-  0xd8, 0x01, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x8f, 0x0a, 0x00, 0x00,
-  0x9d, 0x06, 0x00, 0x00, 0x79, 0x06, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00,
-  0x10, 0xff, 0xff, 0xff, 0x99, 0x0b, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff,
-  0x4c, 0xf8, 0xff, 0xff, 0x90, 0x09, 0x00, 0x00, 0x1b, 0x06, 0x00, 0x00,
-  0x86, 0xf8, 0xff, 0xff, 0xbb, 0x0b, 0x00, 0x00, 0x95, 0xf8, 0xff, 0xff,
-  0x72, 0x04, 0x00, 0x00, 0x48, 0xf8, 0xff, 0xff, 0x5c, 0xfb, 0xff, 0xff,
-  0x87, 0x06, 0x00, 0x00, 0x84, 0x0c, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00,
-  0xa5, 0xf9, 0xff, 0xff, 0x0c, 0xfb, 0xff, 0xff, 0x3f, 0x05, 0x00, 0x00,
-  0xbe, 0x03, 0x00, 0x00, 0x95, 0xfc, 0xff, 0xff, 0xdc, 0xfe, 0xff, 0xff,
-  0x10, 0xfc, 0xff, 0xff, 0x5c, 0xfa, 0xff, 0xff, 0x0a, 0xfb, 0xff, 0xff,
-  0xfc, 0x0b, 0x00, 0x00, 0x5c, 0x0a, 0x00, 0x00, 0x21, 0x0e, 0x00, 0x00,
-  0x61, 0xef, 0xff, 0xff, 0xb3, 0xf9, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff,
-  0x39, 0xf5, 0xff, 0xff, 0x77, 0xf4, 0xff, 0xff, 0xa7, 0xfb, 0xff, 0xff,
-  0xa3, 0xfe, 0xff, 0xff, 0x8b, 0xfb, 0xff, 0xff, 0xc1, 0x09, 0x00, 0x00,
-  0xa7, 0x06, 0x00, 0x00, 0x38, 0xf7, 0xff, 0xff, 0xb6, 0xd8, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xc2, 0xfc, 0x07, 0x54,
-  0xcd, 0x99, 0xb8, 0x2c, 0xe2, 0xe7, 0xfe, 0x02, 0xa5, 0xab, 0x1b, 0x92,
-  0x1f, 0xa0, 0x49, 0x21, 0xce, 0xcb, 0x88, 0xb7, 0xbc, 0xeb, 0xda, 0xb1,
-  0x39, 0xb6, 0x0c, 0xf1, 0x2f, 0xc1, 0x81, 0xd2, 0xd4, 0xd1, 0xf8, 0x91,
-  0x40, 0x4b, 0x77, 0xef, 0x13, 0x08, 0x58, 0xb6, 0x00, 0x8a, 0x33, 0x03,
-  0x4d, 0xa9, 0xc9, 0xe5, 0x05, 0xbc, 0xbe, 0x8e, 0xc8, 0x98, 0xd5, 0x81,
-  0x11, 0xd4, 0x03, 0xea, 0xcd, 0x73, 0x9c, 0xbf, 0x2c, 0xce, 0xc1, 0x15,
-  0xeb, 0x34, 0x81, 0x0a, 0xb4, 0xdf, 0x7d, 0x0a, 0x54, 0xad, 0xbc, 0xd4,
-  0x36, 0x1a, 0x06, 0x3b, 0xc7, 0x2d, 0xbf, 0xd5, 0x3a, 0x6f, 0x50, 0x1a,
-  0xc3, 0xb2, 0x03, 0x8e, 0x5f, 0xf5, 0xc1, 0x34, 0x5b, 0x05, 0x08, 0xd5,
-  0xcd, 0x75, 0x06, 0x38, 0xca, 0x4f, 0x03, 0x17, 0x04, 0xe0, 0xe5, 0x14,
-  0xca, 0xb1, 0x26, 0xda, 0xe4, 0x03, 0x26, 0x24, 0x54, 0x20, 0x12, 0x7f,
-  0x36, 0x04, 0x37, 0x48, 0x1c, 0x1d, 0x24, 0xc1, 0x54, 0x02, 0x2f, 0x1b,
-  0xf9, 0xc3, 0x50, 0xdb, 0xe1, 0xaf, 0xce, 0x1f, 0x15, 0x14, 0xa5, 0xe5,
-  0x46, 0x12, 0x4f, 0xcc, 0x0e, 0x6b, 0x09, 0x43, 0x23, 0xd4, 0xbc, 0x6d,
-  0xd2, 0xf0, 0x20, 0xa8, 0x55, 0x58, 0x2c, 0x34, 0xf2, 0xe3, 0xad, 0xc9,
-  0x04, 0x51, 0x3f, 0xfa, 0x31, 0x0c, 0x35, 0x9d, 0xa2, 0x64, 0x0c, 0x08,
-  0x67, 0x81, 0x01, 0xf1, 0x2a, 0x8c, 0xff, 0xf8, 0x58, 0xea, 0xee, 0x0e,
-  0xf8, 0xa2, 0x2e, 0xa0, 0x96, 0x4d, 0xed, 0x4c, 0xee, 0xd4, 0xd1, 0x28,
-  0xb7, 0xfc, 0x15, 0x34, 0x91, 0xf7, 0xc5, 0x46, 0x24, 0x1f, 0xd9, 0x12,
-  0xbd, 0xf4, 0xaa, 0xb5, 0x24, 0xbf, 0x47, 0xac, 0x39, 0xdf, 0xa3, 0xfe,
-  0x73, 0x9e, 0xd8, 0x1a, 0xec, 0x9b, 0x15, 0x17, 0xdc, 0x60, 0x45, 0xf6,
-  0x1f, 0x16, 0xc1, 0xd2, 0x93, 0x15, 0x4f, 0x19, 0x43, 0x27, 0xfe, 0x1f,
-  0x8b, 0x0c, 0x2a, 0xb7, 0xbf, 0xc1, 0x1c, 0xc4, 0xf9, 0xf6, 0x16, 0xc8,
-  0xd7, 0xef, 0x32, 0xbe, 0xe1, 0x17, 0x05, 0x1a, 0x29, 0x4f, 0xab, 0xc3,
-  0xc8, 0xc1, 0xd4, 0xb7, 0x2b, 0xf2, 0xb6, 0xa4, 0xf1, 0x50, 0x0f, 0x81,
-  0xc8, 0xd9, 0xc4, 0x12, 0xa5, 0xab, 0xe4, 0x02, 0xf9, 0xb7, 0x02, 0xba,
-  0xe0, 0xeb, 0x33, 0xac, 0x23, 0xc9, 0x3d, 0x4a, 0xfe, 0x3f, 0xe0, 0x1c,
-  0x4f, 0x06, 0x06, 0x49, 0x0f, 0x49, 0x05, 0x0f, 0x15, 0x7d, 0xe6, 0x1e,
-  0x1f, 0x3d, 0x54, 0x09, 0x33, 0x14, 0xf9, 0x29, 0x53, 0x09, 0xf0, 0xe4,
-  0xb9, 0x32, 0xf8, 0x2a, 0xbc, 0x4a, 0x0a, 0xf3, 0xdd, 0x26, 0x65, 0xe2,
-  0xd1, 0x04, 0xe3, 0x4d, 0xd1, 0xfc, 0xd1, 0x08, 0xd8, 0x32, 0xbd, 0xf7,
-  0x7f, 0x04, 0xdd, 0xd9, 0x40, 0x09, 0x2f, 0xc6, 0xf2, 0xde, 0xfd, 0xca,
-  0x2d, 0x9a, 0x26, 0xc8, 0x1c, 0xf5, 0x71, 0x40, 0xe2, 0x81, 0xee, 0xd3,
-  0x06, 0xdb, 0x3d, 0x3b, 0x11, 0xb0, 0x11, 0xc1, 0x45, 0x37, 0x19, 0xf9,
-  0xd4, 0x91, 0x2c, 0x18, 0x46, 0x45, 0x0a, 0xb8, 0x2f, 0xc8, 0x0d, 0xa8,
-  0xa2, 0x39, 0x47, 0xf7, 0x9a, 0xe2, 0xc7, 0xec, 0x31, 0x8b, 0xaf, 0xb6,
-  0xc8, 0x09, 0xe7, 0xfe, 0xaf, 0xc8, 0xd3, 0xf5, 0x38, 0xfd, 0xc0, 0xf6,
-  0x7f, 0xef, 0x57, 0x02, 0x35, 0xc6, 0xca, 0x43, 0xd4, 0xa1, 0x09, 0x5a,
-  0x15, 0xe1, 0xf9, 0xc3, 0xb1, 0xdf, 0x2a, 0xd1, 0x19, 0x12, 0x4d, 0x25,
-  0x24, 0xb7, 0xee, 0xcf, 0xf8, 0x09, 0xe7, 0x26, 0xe6, 0xa1, 0xf2, 0xc9,
-  0x64, 0xcd, 0xd0, 0xcb, 0x5d, 0xec, 0xfe, 0xa6, 0x0a, 0xce, 0x59, 0xef,
-  0x42, 0xc0, 0xa9, 0xfc, 0x05, 0xe5, 0xbf, 0x3d, 0xe7, 0xa8, 0x48, 0xf2,
-  0x44, 0xd1, 0xcb, 0x32, 0x51, 0x09, 0x7f, 0x32, 0xf3, 0x46, 0x53, 0x48,
-  0x31, 0x2f, 0x2e, 0xce, 0xe6, 0x14, 0xdc, 0x02, 0x31, 0xc9, 0x27, 0x3f,
-  0xdb, 0x2b, 0x09, 0x40, 0x44, 0x2a, 0x08, 0x18, 0x06, 0x03, 0x3e, 0xfb,
-  0x01, 0xa4, 0x35, 0x26, 0x66, 0x52, 0x05, 0xec, 0x3d, 0x07, 0xff, 0x2b,
-  0x5c, 0xda, 0x39, 0x14, 0x4c, 0xf9, 0xd0, 0xf3, 0x39, 0x45, 0xe1, 0xcb,
-  0x22, 0x2c, 0xd6, 0xd2, 0x3e, 0xdc, 0xfd, 0xed, 0x01, 0xf3, 0xab, 0x0c,
-  0xea, 0xf1, 0xcd, 0xb8, 0xf3, 0xb6, 0xe6, 0xe7, 0xe2, 0x60, 0x6e, 0xed,
-  0xd9, 0xc1, 0x23, 0xe5, 0xee, 0x48, 0x20, 0x12, 0xd3, 0x49, 0x7f, 0x3b,
-  0x12, 0x87, 0x30, 0xcc, 0x40, 0x34, 0x3b, 0x23, 0x59, 0xdf, 0x23, 0xf3,
-  0x1c, 0x11, 0x0d, 0xf7, 0xda, 0x46, 0x78, 0xfe, 0xc1, 0x99, 0xf9, 0x3f,
-  0x90, 0x34, 0x9a, 0xed, 0xbb, 0x4a, 0x47, 0xff, 0x1c, 0x1a, 0x3b, 0x2c,
-  0xf1, 0xcf, 0xb1, 0xc3, 0xdb, 0x86, 0xe7, 0x64, 0xc9, 0x52, 0x03, 0x5a,
-  0xd1, 0xe3, 0xae, 0x70, 0x71, 0xe0, 0xb9, 0x34, 0x45, 0x5f, 0xfd, 0xd3,
-  0xad, 0xa8, 0xbf, 0x54, 0x34, 0x2a, 0x85, 0xb1, 0x36, 0x48, 0xae, 0x4c,
-  0x06, 0x0c, 0x37, 0xa4, 0x2b, 0x28, 0xac, 0xaa, 0xfd, 0xc3, 0x24, 0x61,
-  0xfb, 0x22, 0x2d, 0x22, 0xf7, 0xe4, 0xad, 0xbb, 0x8f, 0xa9, 0x06, 0xd8,
-  0xe5, 0x81, 0xff, 0x2d, 0x26, 0xab, 0x25, 0xfb, 0xc4, 0xbf, 0xd9, 0xfb,
-  0xe6, 0x0c, 0xe1, 0x22, 0xfe, 0xd1, 0xe2, 0x4e, 0x0a, 0xfe, 0xc8, 0x11,
-  0x0a, 0x31, 0x0a, 0xe4, 0xfe, 0xfa, 0xdd, 0xbf, 0xfd, 0x37, 0xd1, 0x3d,
-  0x10, 0xc0, 0xb6, 0xf9, 0x1e, 0x29, 0xd9, 0x45, 0xb9, 0xf0, 0x7f, 0x2e,
-  0x1e, 0xfb, 0x10, 0x2b, 0xea, 0x22, 0x1b, 0x2f, 0xd2, 0x54, 0xc7, 0x1e,
-  0x27, 0x02, 0x17, 0xc7, 0xe7, 0x22, 0xff, 0x07, 0x3e, 0xf4, 0xe2, 0xb4,
-  0xe7, 0x0a, 0xdc, 0x21, 0x3f, 0xe2, 0x1e, 0x09, 0xbf, 0x1a, 0x7f, 0xff,
-  0xe0, 0x7d, 0xd8, 0xe5, 0x28, 0xe5, 0x59, 0x53, 0xfd, 0xe6, 0x08, 0xa3,
-  0x3c, 0x07, 0xff, 0xab, 0xa6, 0x44, 0x72, 0xf8, 0x54, 0xd1, 0x3c, 0x60,
-  0xa0, 0x56, 0xd7, 0x51, 0x35, 0x37, 0xf0, 0x30, 0xd7, 0x0a, 0xd2, 0x23,
-  0xf5, 0x30, 0x53, 0xcf, 0x03, 0x48, 0x56, 0x37, 0xae, 0xcc, 0x1c, 0x6b,
-  0x5b, 0x15, 0x9d, 0xde, 0x07, 0x44, 0xfb, 0x81, 0xa9, 0xa2, 0x5f, 0x27,
-  0xed, 0x50, 0x4a, 0xf7, 0x56, 0xeb, 0xe1, 0xe5, 0x3f, 0xad, 0x1f, 0x76,
-  0x01, 0xf9, 0xc4, 0xca, 0xbe, 0x43, 0x18, 0xf6, 0xcc, 0x4b, 0x1a, 0xec,
-  0x7d, 0xab, 0xeb, 0xc0, 0x41, 0x28, 0xf2, 0xa0, 0x29, 0xbb, 0x7a, 0xd1,
-  0x37, 0x07, 0x1d, 0xb7, 0x13, 0x56, 0xaf, 0x1f, 0x5f, 0x61, 0xbe, 0x4b,
-  0x08, 0xf1, 0x62, 0xef, 0xe0, 0xe0, 0xcd, 0xe7, 0x18, 0x86, 0xb5, 0x55,
-  0xd8, 0x7f, 0xae, 0xe6, 0x49, 0xb4, 0xeb, 0x09, 0xf6, 0xd9, 0x33, 0xe0,
-  0x2d, 0x08, 0x3a, 0xe6, 0x1e, 0x51, 0xf8, 0x4e, 0xdc, 0xd5, 0x3c, 0xc5,
-  0xd4, 0x5c, 0xb3, 0xaf, 0xbd, 0xd2, 0x27, 0xb9, 0x16, 0x66, 0x75, 0x8f,
-  0xd4, 0x28, 0xb1, 0xa3, 0x16, 0x2d, 0xfe, 0x53, 0x53, 0x76, 0xe5, 0x16,
-  0xef, 0xd6, 0x95, 0xd2, 0xbc, 0x3e, 0xf9, 0xd3, 0x7a, 0xad, 0xef, 0xce,
-  0x20, 0x07, 0x3e, 0x33, 0xa1, 0xcb, 0xf3, 0x0b, 0x4c, 0xc7, 0xfe, 0xc5,
-  0xdd, 0xee, 0x40, 0x37, 0x48, 0xa1, 0x09, 0x2f, 0x51, 0x55, 0xf8, 0xbc,
-  0x1b, 0x15, 0x47, 0x03, 0x62, 0xd5, 0x13, 0xf9, 0xfc, 0xcb, 0xbb, 0xbf,
-  0x55, 0xc6, 0x21, 0xd3, 0xd0, 0x35, 0x51, 0x1f, 0x21, 0xeb, 0xc7, 0x33,
-  0x3c, 0x0d, 0xc2, 0x49, 0xcb, 0x02, 0x7f, 0xff, 0x24, 0xbf, 0xb6, 0xe0,
-  0xed, 0x10, 0x26, 0xe2, 0xdf, 0xb2, 0x0a, 0x20, 0x4b, 0x55, 0xfc, 0x47,
-  0xc1, 0x57, 0x67, 0x10, 0xcc, 0x34, 0x44, 0xe7, 0x1d, 0xcb, 0x10, 0xd7,
-  0x42, 0x81, 0x30, 0x3a, 0xc8, 0x12, 0x2a, 0xc1, 0xd7, 0xd2, 0xe9, 0x35,
-  0x62, 0x3d, 0xde, 0xf6, 0xb2, 0x32, 0xda, 0xf0, 0x0e, 0xf7, 0x24, 0x00,
-  0xc7, 0x13, 0x1c, 0xda, 0xe9, 0x35, 0x98, 0xff, 0x2a, 0x11, 0xed, 0xea,
-  0xd3, 0xf4, 0xd2, 0x50, 0x49, 0x0b, 0xee, 0xb8, 0xb5, 0xa7, 0x30, 0x03,
-  0x4b, 0x26, 0xeb, 0x1e, 0x2f, 0x1f, 0x37, 0xfa, 0x0a, 0x1a, 0x4d, 0xf6,
-  0xd7, 0xf3, 0xed, 0xfc, 0x89, 0x09, 0xb2, 0xef, 0xfe, 0x34, 0xbd, 0x3c,
-  0x2f, 0x20, 0x5b, 0xe5, 0x7f, 0xd7, 0xe2, 0xbd, 0x0b, 0x39, 0xf9, 0x0c,
-  0x01, 0xbd, 0x3c, 0xe8, 0x21, 0xf3, 0xde, 0xd3, 0xfd, 0xf1, 0xf7, 0xf2,
-  0x55, 0xe2, 0xed, 0xdf, 0xeb, 0x2b, 0x3f, 0x2a, 0x08, 0x36, 0x70, 0xb4,
-  0xd6, 0x26, 0xdf, 0x11, 0x2e, 0xf6, 0x5b, 0xed, 0x05, 0xb8, 0x5f, 0xd1,
-  0x1b, 0xf3, 0x3e, 0x03, 0xe0, 0xf0, 0x8f, 0x2e, 0xc5, 0x2d, 0xc7, 0xac,
-  0x59, 0x19, 0xdd, 0xcb, 0xee, 0x8e, 0xca, 0xde, 0xf7, 0xad, 0xde, 0xe0,
-  0x48, 0x5b, 0xf5, 0xd7, 0x1c, 0xdb, 0x7f, 0xf3, 0xcd, 0x89, 0x0a, 0xc3,
-  0x35, 0x16, 0x0d, 0x5e, 0x8e, 0x41, 0xc8, 0x07, 0xfa, 0x1d, 0x16, 0x0b,
-  0x0a, 0xc2, 0xb6, 0xe3, 0x52, 0x05, 0xf9, 0xcb, 0x2e, 0x48, 0x1c, 0x06,
-  0xae, 0x1b, 0x22, 0x62, 0xdd, 0x50, 0x52, 0x42, 0x30, 0xf8, 0x16, 0xc7,
-  0x25, 0x1e, 0x21, 0xd6, 0x3a, 0x28, 0xca, 0x2f, 0xd5, 0x50, 0x61, 0x48,
-  0x52, 0xda, 0xde, 0xac, 0xc9, 0x5d, 0xeb, 0x05, 0xdf, 0xba, 0xc7, 0x81,
-  0x14, 0xf4, 0xf5, 0xea, 0xde, 0x58, 0xc0, 0xec, 0xe3, 0x0a, 0x23, 0xbe,
-  0x02, 0xd1, 0xdf, 0xcb, 0x10, 0xce, 0x31, 0x9e, 0x1e, 0x28, 0x18, 0x45,
-  0x50, 0x37, 0xa6, 0x9d, 0x37, 0xd6, 0x0f, 0x23, 0x7f, 0x61, 0x93, 0xc8,
-  0x32, 0x3f, 0xa2, 0x52, 0xb4, 0x58, 0x02, 0x14, 0xa4, 0x26, 0x1f, 0xfd,
-  0xa9, 0x0a, 0x7d, 0xde, 0x28, 0x44, 0x2a, 0x3a, 0x47, 0x04, 0xc0, 0x37,
-  0x3f, 0x19, 0xfe, 0x74, 0x11, 0x5b, 0xce, 0x1f, 0x47, 0x78, 0x06, 0xdd,
-  0xe8, 0xc6, 0x23, 0xff, 0x14, 0x39, 0x2f, 0x45, 0x01, 0x92, 0x59, 0xd3,
-  0x2a, 0x52, 0xf8, 0xc2, 0xf6, 0xd9, 0x2a, 0xe7, 0xec, 0x5f, 0xce, 0x10,
-  0x2d, 0x81, 0x22, 0x57, 0x4f, 0x13, 0xe1, 0x32, 0xfb, 0x47, 0x4f, 0x48,
-  0x0a, 0xf5, 0x10, 0xc1, 0x03, 0xe9, 0x9a, 0x0d, 0xb8, 0x10, 0xed, 0x19,
-  0x85, 0xfb, 0x3f, 0xe1, 0xa6, 0x5f, 0xc8, 0xc6, 0xc2, 0xde, 0x0a, 0x26,
-  0xf8, 0xae, 0x2b, 0xe1, 0x1b, 0x00, 0x07, 0xf0, 0xed, 0x2c, 0x19, 0x07,
-  0x3e, 0x2c, 0xd0, 0x1e, 0x0e, 0xdd, 0xf1, 0xb5, 0x1b, 0xfd, 0x3a, 0xaa,
-  0x14, 0x81, 0x6e, 0xa8, 0xcd, 0xc1, 0x78, 0xf9, 0x62, 0x39, 0xe7, 0x51,
-  0x5f, 0x4b, 0xe5, 0xa0, 0x3e, 0xcf, 0x15, 0xcb, 0x15, 0xda, 0xdb, 0x59,
-  0x2f, 0xeb, 0x55, 0x23, 0xd0, 0x30, 0x08, 0x17, 0x03, 0x43, 0x14, 0x9d,
-  0xb0, 0x0e, 0xe5, 0xcb, 0xd2, 0x03, 0xfe, 0x1a, 0x94, 0x10, 0x3d, 0x43,
-  0x68, 0x41, 0x23, 0xf9, 0x8d, 0xba, 0x78, 0x15, 0xe0, 0x5c, 0xe3, 0xf4,
-  0xda, 0x26, 0x2b, 0x79, 0xa3, 0x3e, 0x65, 0xa9, 0x41, 0xb5, 0x27, 0xc3,
-  0x81, 0x01, 0xdb, 0x44, 0x45, 0x0a, 0x54, 0x70, 0x70, 0x28, 0xc3, 0x21,
-  0x7a, 0xc7, 0xed, 0xd7, 0x2b, 0x44, 0x62, 0x1b, 0xfd, 0xad, 0xfa, 0x62,
-  0x3d, 0xf7, 0xe7, 0xfc, 0x8f, 0x3e, 0x5b, 0xf8, 0xf2, 0xc3, 0xab, 0x15,
-  0x1e, 0xab, 0xc6, 0xa3, 0x56, 0x60, 0xbf, 0x68, 0x25, 0xf8, 0xe9, 0x96,
-  0x11, 0x8f, 0x13, 0xd9, 0x01, 0x81, 0x10, 0x65, 0xe9, 0xb0, 0x5c, 0x07,
-  0xc1, 0x35, 0x2c, 0xbc, 0xa0, 0x37, 0x55, 0x04, 0xa1, 0xc0, 0xb6, 0xbb,
-  0xc4, 0xdb, 0x36, 0x2f, 0x51, 0xef, 0xda, 0x11, 0x3e, 0xa7, 0x48, 0x53,
-  0x19, 0xca, 0xa0, 0x08, 0xce, 0xca, 0xc9, 0x2a, 0xfb, 0x20, 0xa4, 0xdb,
-  0x76, 0xab, 0x9e, 0x9e, 0x89, 0xe5, 0xc6, 0x89, 0x97, 0x11, 0xfe, 0xdb,
-  0xcd, 0x9a, 0x1d, 0x46, 0xaf, 0x57, 0x69, 0xf1, 0xe9, 0xf1, 0x4c, 0xd4,
-  0xfa, 0x4a, 0x86, 0x3d, 0x1b, 0x38, 0x32, 0xdf, 0x64, 0x84, 0xfb, 0xd9,
-  0xe7, 0x48, 0x40, 0x81, 0x06, 0xe8, 0xcc, 0x7e, 0xce, 0x48, 0x2f, 0x2a,
-  0xb4, 0x72, 0x28, 0x2f, 0xb7, 0x35, 0x0a, 0xc8, 0x16, 0xbf, 0x35, 0x0d,
-  0xa6, 0x4d, 0xaa, 0xf9, 0xe8, 0x3a, 0xc1, 0xeb, 0x20, 0x27, 0xeb, 0xde,
-  0x3f, 0xb6, 0x07, 0x46, 0x78, 0x4a, 0xe7, 0x9b, 0x29, 0xa2, 0x71, 0xf3,
-  0xe9, 0x26, 0x50, 0x16, 0xd3, 0xdf, 0x77, 0xf6, 0x26, 0xc8, 0xc2, 0xa4,
-  0x31, 0xc9, 0x50, 0xd8, 0xea, 0x30, 0xad, 0x7f, 0x3f, 0x2b, 0x20, 0x76,
-  0x65, 0xe0, 0xab, 0x18, 0xc4, 0x0b, 0xfd, 0x05, 0xba, 0x02, 0x64, 0xdc,
-  0x11, 0x33, 0xc0, 0x54, 0x1f, 0xa3, 0x8b, 0x09, 0x29, 0xf6, 0xc1, 0xb9,
-  0x4e, 0xe2, 0xec, 0xce, 0x6d, 0x28, 0x4d, 0x20, 0x61, 0xa9, 0x41, 0xbd,
-  0x17, 0x4b, 0xcd, 0xb5, 0x11, 0x0e, 0x71, 0xb1, 0xa6, 0x4b, 0xf2, 0xd2,
-  0xc3, 0xc5, 0x1c, 0xcc, 0x06, 0x9f, 0x5a, 0x3b, 0xdf, 0xb4, 0xdd, 0x5e,
-  0x76, 0xf8, 0xee, 0xbd, 0x62, 0x7a, 0xc5, 0xe9, 0x66, 0xf3, 0x3e, 0x04,
-  0xed, 0x27, 0x36, 0xdc, 0xfc, 0x2b, 0x4f, 0xce, 0xc4, 0xe3, 0x28, 0x36,
-  0x8d, 0x81, 0xdd, 0xf4, 0x0b, 0x4f, 0xcb, 0xe4, 0x0c, 0xf6, 0xa6, 0xb2,
-  0x11, 0xc8, 0x06, 0x4a, 0x15, 0xd4, 0xc9, 0xfe, 0x2c, 0x27, 0xb6, 0x00,
-  0x6f, 0xe8, 0x2d, 0x6f, 0x7f, 0x76, 0xe1, 0x24, 0x5f, 0x3d, 0xb9, 0x00,
-  0x96, 0x1f, 0xbd, 0xb9, 0x1f, 0xcb, 0xee, 0x1a, 0xca, 0x49, 0x57, 0xfb,
-  0xe4, 0xe2, 0xc2, 0x3d, 0xac, 0x58, 0x5e, 0x32, 0x46, 0xd6, 0x1b, 0x7b,
-  0xba, 0xd1, 0xf7, 0xfb, 0xd0, 0xff, 0xcc, 0x26, 0x02, 0x26, 0x20, 0x46,
-  0xd1, 0x02, 0xde, 0xe0, 0x0e, 0xb1, 0x47, 0x46, 0x73, 0x1b, 0x77, 0xac,
-  0x84, 0xe5, 0xf9, 0x85, 0xe7, 0xc0, 0xd9, 0xb8, 0x19, 0xb8, 0x31, 0x9c,
-  0x37, 0xdc, 0x20, 0x28, 0xc3, 0x45, 0x39, 0xba, 0x57, 0xe1, 0x1f, 0x52,
-  0x6e, 0xfd, 0x0b, 0x2b, 0xe4, 0x46, 0xc8, 0x57, 0xf0, 0x01, 0xd0, 0x38,
-  0x8c, 0xe9, 0xdb, 0x55, 0xd1, 0xb8, 0x10, 0xbf, 0x21, 0x70, 0x66, 0x96,
-  0xe9, 0x0e, 0xfe, 0x4e, 0x01, 0x6c, 0x22, 0x7f, 0xc8, 0x0f, 0xb3, 0x5e,
-  0x13, 0x15, 0xc8, 0xc9, 0x33, 0x6f, 0x16, 0x90, 0xe6, 0x6d, 0xe4, 0x3a,
-  0x06, 0x36, 0x00, 0x5c, 0x40, 0xb9, 0x36, 0xdf, 0x2b, 0xda, 0x50, 0x22,
-  0x3f, 0x47, 0x18, 0x32, 0x1a, 0x26, 0xde, 0xfe, 0x58, 0x1b, 0xd1, 0x27,
-  0x95, 0xfc, 0x04, 0x11, 0xf1, 0xcf, 0x11, 0x23, 0xf6, 0x46, 0x46, 0xb8,
-  0xf6, 0xe1, 0x0e, 0x08, 0x7f, 0xd8, 0x2f, 0x34, 0x49, 0x12, 0x0f, 0x4d,
-  0x33, 0xd1, 0xf7, 0x32, 0xf2, 0x15, 0x02, 0x4b, 0xe4, 0x4b, 0x0b, 0x37,
-  0xf8, 0x45, 0x47, 0x51, 0x0c, 0x73, 0x11, 0xff, 0x31, 0xd8, 0xfa, 0xc2,
-  0xda, 0x01, 0x11, 0x35, 0x1f, 0xf7, 0xa5, 0x16, 0xe8, 0xff, 0x1f, 0x17,
-  0xf1, 0x53, 0xfe, 0x00, 0x06, 0x06, 0x2e, 0x21, 0x1f, 0x1c, 0x3e, 0x7f,
-  0xcd, 0xae, 0xc2, 0xfb, 0x42, 0x3d, 0xbf, 0xeb, 0x3c, 0x03, 0xcc, 0x2a,
-  0xbf, 0x35, 0xd1, 0xd9, 0x7f, 0x3d, 0x22, 0xc5, 0x32, 0xdf, 0x0e, 0xfc,
-  0x5c, 0x9b, 0xf1, 0x38, 0xda, 0x49, 0x31, 0x07, 0xc2, 0xc0, 0x2c, 0x0a,
-  0x27, 0x4b, 0xc7, 0x23, 0x13, 0x22, 0x65, 0xde, 0xcb, 0xd9, 0x14, 0xa2,
-  0xc7, 0xc9, 0xb6, 0x04, 0x27, 0x0c, 0xd3, 0xcd, 0x13, 0x0e, 0xfb, 0x46,
-  0x33, 0x2c, 0x27, 0x14, 0xef, 0x43, 0x8c, 0x06, 0xcd, 0x38, 0xb4, 0x22,
-  0xbe, 0x11, 0xec, 0xcf, 0xd5, 0xe3, 0x4c, 0x26, 0xcd, 0x81, 0x1b, 0xc3,
-  0x22, 0x35, 0xd9, 0xd0, 0xfd, 0x5a, 0xb7, 0xe8, 0x3d, 0x29, 0x50, 0x2c,
-  0x56, 0x56, 0x97, 0xe0, 0x6a, 0xd1, 0x04, 0xc3, 0xad, 0x24, 0x17, 0xb2,
-  0x4b, 0xf7, 0xd8, 0xf0, 0xe9, 0xdf, 0x13, 0xc7, 0xae, 0x45, 0xb8, 0x49,
-  0xe9, 0x1b, 0x0e, 0x18, 0x47, 0x0e, 0x17, 0x5e, 0xbe, 0xe9, 0xa8, 0xfa,
-  0x2b, 0x3e, 0x41, 0xe4, 0x0a, 0x13, 0xdd, 0xfa, 0xd6, 0x3c, 0xec, 0xd9,
-  0x7d, 0xd4, 0xc9, 0xfb, 0xf1, 0x9e, 0xb4, 0x14, 0xb8, 0xf7, 0xcd, 0xcf,
-  0x25, 0xcc, 0xcf, 0xdd, 0x05, 0xd1, 0x2b, 0xbe, 0x40, 0x16, 0xa9, 0xde,
-  0xd0, 0x18, 0x14, 0xd9, 0xc8, 0x1f, 0xf0, 0x00, 0xbb, 0xde, 0xe6, 0xcd,
-  0xe7, 0x4c, 0xff, 0x0a, 0x34, 0x2c, 0xc1, 0xec, 0x3e, 0x38, 0x0b, 0xfc,
-  0xb7, 0x7f, 0xb9, 0x3b, 0xc3, 0x71, 0xdb, 0xdd, 0xfa, 0x90, 0x06, 0x0b,
-  0xaf, 0x25, 0x43, 0xea, 0xcb, 0xd1, 0xd2, 0xbf, 0x69, 0x9d, 0xf8, 0xd1,
-  0x57, 0x64, 0xcb, 0x3f, 0xb3, 0x07, 0x3a, 0x5e, 0x17, 0x5f, 0x19, 0x49,
-  0xfa, 0x19, 0x31, 0xfc, 0x3a, 0x23, 0x1a, 0xe7, 0x1f, 0x19, 0x0f, 0xfb,
-  0xd6, 0xbb, 0xa4, 0x2d, 0xa2, 0x53, 0x1b, 0xd9, 0xae, 0x44, 0xad, 0x40,
-  0x9a, 0xbb, 0x32, 0xc9, 0xfe, 0x16, 0xcb, 0xee, 0x61, 0x6a, 0x81, 0x1e,
-  0x29, 0xaf, 0xfe, 0x02, 0x14, 0xd5, 0x2d, 0x62, 0x37, 0x01, 0xf2, 0x34,
-  0x57, 0xdf, 0x15, 0x29, 0xd9, 0x2c, 0x3f, 0xb7, 0x05, 0x24, 0x2c, 0x19,
-  0x47, 0xbe, 0x34, 0xdd, 0xc1, 0xe2, 0xb6, 0x4b, 0xe0, 0x12, 0xca, 0xa5,
-  0xc8, 0xa1, 0x35, 0x02, 0xb9, 0xa3, 0xf6, 0xd9, 0x32, 0xbe, 0xb7, 0xf2,
-  0xd3, 0x10, 0x33, 0x04, 0x0a, 0x31, 0x23, 0xd3, 0x7f, 0x73, 0x07, 0x9b,
-  0x40, 0x1f, 0xe4, 0x22, 0xc6, 0xbd, 0xd8, 0xd3, 0x9e, 0x18, 0x41, 0xcd,
-  0xde, 0x0d, 0xd7, 0x11, 0x21, 0x43, 0xb2, 0x25, 0xfd, 0xc2, 0x40, 0x23,
-  0x2a, 0xf8, 0x53, 0xfe, 0x38, 0x7f, 0x42, 0x1a, 0x27, 0xe8, 0x09, 0xa2,
-  0x23, 0xe1, 0xe1, 0x2c, 0x60, 0x60, 0xae, 0x17, 0x28, 0x0f, 0xfa, 0x2f,
-  0xec, 0xc1, 0xc7, 0x20, 0x16, 0xfe, 0xef, 0xa5, 0x89, 0xed, 0xed, 0x57,
-  0xb4, 0x1b, 0x48, 0xe7, 0x01, 0x44, 0xfa, 0xd7, 0x62, 0x13, 0x55, 0xac,
-  0x02, 0x1b, 0x1e, 0x60, 0x9d, 0xa5, 0xe0, 0x36, 0x38, 0x3f, 0xe9, 0xbb,
-  0x26, 0x3f, 0xe3, 0x09, 0xe8, 0x72, 0xac, 0xf1, 0x07, 0x54, 0x1b, 0x6f,
-  0x42, 0x6e, 0xb5, 0x12, 0x3b, 0xc2, 0xb1, 0xff, 0x2a, 0x9b, 0xed, 0x35,
-  0x7b, 0x0c, 0x21, 0x11, 0x10, 0x52, 0xf5, 0x21, 0xb5, 0x29, 0xd3, 0xe1,
-  0x00, 0x06, 0x9b, 0xc6, 0x00, 0x7f, 0xb3, 0x53, 0xfe, 0x29, 0xc5, 0xbd,
-  0x1a, 0x42, 0xf0, 0xc7, 0xdc, 0x31, 0x36, 0xe9, 0x28, 0xf0, 0x23, 0xc7,
-  0x11, 0xf3, 0xce, 0xfd, 0x14, 0xdf, 0xca, 0xd9, 0xe3, 0x5c, 0x27, 0x3c,
-  0xf6, 0x16, 0x81, 0xcb, 0xf8, 0xe2, 0x4a, 0x29, 0xdb, 0x17, 0x05, 0xb1,
-  0x4d, 0x27, 0xf7, 0xe9, 0xf2, 0x3a, 0x1a, 0xc4, 0xc3, 0xff, 0xf9, 0x27,
-  0xc6, 0x1a, 0x36, 0xef, 0xf8, 0xeb, 0xc6, 0x3c, 0xf0, 0xe0, 0xdc, 0x3e,
-  0x1d, 0xf3, 0x06, 0xbd, 0x60, 0x08, 0xef, 0xda, 0x3d, 0xb9, 0x0a, 0xea,
-  0x38, 0x9a, 0xad, 0xee, 0x34, 0x5b, 0xfe, 0xc4, 0xbd, 0xdd, 0xda, 0xc2,
-  0x0f, 0xf6, 0x0e, 0xf3, 0x16, 0x9d, 0x56, 0x22, 0x3e, 0xf2, 0x1c, 0xfc,
-  0x52, 0x02, 0x7f, 0xdb, 0xf7, 0xec, 0x14, 0xd7, 0x06, 0x00, 0xec, 0xd0,
-  0xac, 0x1a, 0x56, 0x10, 0xe6, 0xf1, 0x9a, 0x24, 0xc8, 0x6c, 0x3a, 0xf8,
-  0xf4, 0x2a, 0xb3, 0x11, 0x1a, 0xe8, 0xfe, 0xd5, 0x44, 0xb2, 0x28, 0x13,
-  0xf6, 0xc2, 0xd5, 0x18, 0xb2, 0xba, 0xb0, 0x62, 0x56, 0xcc, 0x14, 0x24,
-  0x68, 0x50, 0xea, 0xdc, 0xc7, 0x7f, 0x0f, 0xea, 0x66, 0x7b, 0x14, 0xf0,
-  0x45, 0x17, 0xed, 0x2e, 0x61, 0xee, 0x24, 0x4c, 0x68, 0x76, 0x11, 0x50,
-  0xeb, 0x38, 0x3e, 0x10, 0x49, 0x76, 0x62, 0x2b, 0x9e, 0xd3, 0x0f, 0xc8,
-  0xd0, 0x08, 0xf5, 0x67, 0x04, 0x07, 0xf3, 0xe7, 0x4e, 0xec, 0x02, 0xcf,
-  0x60, 0xa9, 0xc4, 0xe4, 0xa0, 0x92, 0xfd, 0x29, 0x35, 0xaa, 0x22, 0xcc,
-  0x01, 0xed, 0x3c, 0x44, 0xab, 0xe0, 0x9c, 0x32, 0xb6, 0x66, 0x03, 0x02,
-  0xdb, 0x6c, 0x05, 0x28, 0x32, 0xf8, 0x49, 0xe4, 0xe2, 0xc9, 0x15, 0xd6,
-  0x33, 0x3c, 0xda, 0xc2, 0x11, 0x01, 0x7f, 0xe4, 0x31, 0xee, 0x55, 0x59,
-  0x4a, 0x12, 0x5b, 0x23, 0xe7, 0xd7, 0xbe, 0x1f, 0xa7, 0x4b, 0x3f, 0x36,
-  0x50, 0xe9, 0xbf, 0x2a, 0x50, 0xbf, 0xea, 0xf9, 0x4a, 0x44, 0x92, 0x20,
-  0x3b, 0x2b, 0x22, 0x5c, 0x27, 0x11, 0xc4, 0x19, 0xb3, 0x1c, 0xfb, 0xc6,
-  0xa8, 0x52, 0x11, 0x16, 0x95, 0x4f, 0xf3, 0x37, 0xf1, 0xe8, 0x02, 0xf4,
-  0xb4, 0xd3, 0xd4, 0xed, 0xc4, 0x4d, 0xe9, 0x7f, 0x6d, 0xb5, 0x43, 0x38,
-  0x50, 0x1a, 0xa9, 0xfa, 0x1d, 0x13, 0xda, 0xc4, 0x4d, 0xf6, 0xe0, 0xb6,
-  0x5d, 0x58, 0xe7, 0xbb, 0x38, 0x87, 0x06, 0x39, 0x0e, 0x10, 0xca, 0xb0,
-  0x2c, 0xa9, 0x2e, 0x92, 0x12, 0x01, 0x44, 0xda, 0x1a, 0x40, 0xf6, 0xcc,
-  0x08, 0x20, 0x07, 0x45, 0x0a, 0x73, 0x01, 0x10, 0x66, 0x7f, 0x98, 0x1e,
-  0x35, 0x33, 0x37, 0x01, 0xb8, 0x2f, 0x1a, 0xd5, 0x53, 0xfb, 0xda, 0xd4,
-  0x2f, 0x52, 0x18, 0x35, 0xca, 0xec, 0x0f, 0x4a, 0xc9, 0x10, 0x0d, 0xcd,
-  0x4c, 0x01, 0xdf, 0x44, 0xc4, 0xb5, 0xe1, 0x3e, 0x0f, 0x53, 0x1a, 0xb3,
-  0x3f, 0x4f, 0xe2, 0xe3, 0xd4, 0xcb, 0x20, 0xd0, 0x12, 0xe7, 0x66, 0x74,
-  0x0c, 0x45, 0x8a, 0x42, 0xde, 0x28, 0xe3, 0x02, 0xcc, 0xf5, 0x14, 0x5a,
-  0xac, 0x93, 0x54, 0x1b, 0xc7, 0x1b, 0x63, 0x8c, 0x09, 0xa8, 0xd8, 0xbd,
-  0xdf, 0x4c, 0xdc, 0xb2, 0xf0, 0x60, 0xd7, 0x7c, 0x2f, 0x45, 0xb9, 0x73,
-  0x6e, 0x1f, 0xf9, 0x98, 0x63, 0xe5, 0x36, 0x1d, 0xaf, 0x49, 0xec, 0x33,
-  0x3d, 0x09, 0xf5, 0x7f, 0x9b, 0x3d, 0x3d, 0xf1, 0x39, 0x06, 0xe8, 0xc1,
-  0xe6, 0xc9, 0xee, 0xeb, 0xfb, 0xc6, 0xbb, 0xbb, 0x47, 0xbc, 0x02, 0xd1,
-  0x05, 0x03, 0xee, 0xab, 0xc0, 0x38, 0xd8, 0xf0, 0x33, 0xd2, 0xf8, 0x1a,
-  0xce, 0x34, 0xf7, 0x9e, 0x9d, 0x15, 0x96, 0x46, 0x45, 0x09, 0x20, 0x57,
-  0xfb, 0x44, 0x3c, 0x3b, 0x14, 0x53, 0xff, 0x5f, 0x0c, 0xe7, 0xe0, 0x81,
-  0x05, 0xff, 0x96, 0x14, 0x6e, 0xe0, 0xf6, 0x1b, 0x38, 0x15, 0xd3, 0x30,
-  0x05, 0x3b, 0xa5, 0xde, 0xeb, 0x16, 0xdd, 0x04, 0xc2, 0x7f, 0x2a, 0x28,
-  0x23, 0x07, 0x3b, 0xd2, 0xac, 0xce, 0x17, 0xd3, 0x00, 0xe9, 0x27, 0xd3,
-  0x39, 0x04, 0x26, 0x3e, 0x01, 0x60, 0x0f, 0x55, 0x3e, 0x02, 0x0f, 0x23,
-  0x2f, 0xec, 0x21, 0x11, 0x28, 0xf3, 0x4a, 0xf7, 0x29, 0xf9, 0xe4, 0x01,
-  0xd0, 0x31, 0x22, 0x1e, 0xf4, 0x63, 0xc0, 0xf3, 0x96, 0xe2, 0xd2, 0xc2,
-  0x4a, 0x04, 0x52, 0x39, 0xc5, 0x46, 0x32, 0xf4, 0xaa, 0xe4, 0x20, 0xb4,
-  0xe8, 0x5c, 0x78, 0xac, 0x17, 0xa5, 0x21, 0x44, 0x0a, 0xf8, 0xce, 0x11,
-  0xdb, 0x38, 0x09, 0xd6, 0x72, 0x1e, 0xb0, 0xeb, 0x1b, 0x2f, 0x49, 0x60,
-  0x0c, 0xcc, 0x0b, 0x08, 0xb6, 0x1a, 0xbf, 0xb5, 0x19, 0x53, 0x4d, 0xbb,
-  0x94, 0x4c, 0x3a, 0x07, 0xdb, 0x7f, 0xea, 0x28, 0x32, 0xd1, 0xef, 0x4c,
-  0xf0, 0x47, 0x3f, 0xd6, 0x8e, 0x14, 0xe8, 0x3f, 0x6c, 0x2e, 0xe7, 0x61,
-  0x24, 0xed, 0x4f, 0x0e, 0xd9, 0xfb, 0x33, 0x51, 0x25, 0x6c, 0xa8, 0x9a,
-  0x27, 0xde, 0x1d, 0xd4, 0x22, 0xb4, 0x10, 0xde, 0x7f, 0xe1, 0xb4, 0xc1,
-  0xf8, 0x3b, 0xbc, 0x2c, 0xf7, 0x86, 0x3a, 0x59, 0x5e, 0x39, 0x15, 0xcd,
-  0x21, 0x25, 0xc5, 0xde, 0x08, 0x00, 0x13, 0xc1, 0xcc, 0x10, 0xa2, 0x1f,
-  0x0d, 0x52, 0xe8, 0x40, 0x2a, 0xdd, 0x6b, 0x03, 0xcf, 0x6d, 0x28, 0xde,
-  0x57, 0x62, 0x08, 0x6d, 0xe2, 0x10, 0x2b, 0x1d, 0x1b, 0xb2, 0x09, 0xbd,
-  0xfa, 0xaa, 0x23, 0xf4, 0xd4, 0xdb, 0xdd, 0x14, 0xdc, 0xd2, 0x46, 0x15,
-  0xee, 0xf0, 0xd4, 0x1f, 0xf8, 0xcb, 0x05, 0xdb, 0x03, 0x81, 0x1b, 0xfb,
-  0xce, 0xe7, 0x22, 0x27, 0xdf, 0xc5, 0x12, 0x14, 0x46, 0xf1, 0x0f, 0x08,
-  0xf3, 0x14, 0x02, 0xc5, 0x1a, 0xe3, 0xc6, 0x47, 0xe6, 0x1d, 0x24, 0xcd,
-  0xa6, 0x87, 0x24, 0xda, 0x15, 0xe5, 0xfa, 0xad, 0xee, 0x1a, 0xff, 0x49,
-  0x23, 0x6a, 0xf3, 0x7e, 0xa4, 0xad, 0xb6, 0x3a, 0x9b, 0x5e, 0x1e, 0x24,
-  0x95, 0xa6, 0xb7, 0x21, 0xe9, 0xe5, 0xb4, 0x22, 0x31, 0xdb, 0x54, 0x0c,
-  0x73, 0x06, 0xd1, 0x45, 0x15, 0xae, 0x19, 0x05, 0x2f, 0x45, 0x4b, 0x14,
-  0xf3, 0x29, 0xe4, 0xf6, 0x23, 0x56, 0xc3, 0x99, 0x01, 0x71, 0x5f, 0xc8,
-  0xcb, 0x16, 0xe6, 0xea, 0x81, 0x48, 0xd7, 0xfb, 0x19, 0x27, 0x26, 0xfb,
-  0xd2, 0xe2, 0x29, 0xee, 0x28, 0x04, 0x14, 0x30, 0xe9, 0xe5, 0xda, 0x00,
-  0x00, 0xcd, 0xf1, 0xc7, 0xc9, 0xb4, 0x19, 0x23, 0x78, 0x2e, 0xca, 0x1c,
-  0x12, 0x7f, 0xf5, 0xd8, 0xf5, 0xfb, 0x4f, 0x28, 0xe2, 0xcb, 0xd7, 0xcc,
-  0xea, 0x0f, 0xc2, 0xb3, 0x31, 0x49, 0x40, 0x2e, 0xdc, 0xb7, 0x10, 0xbd,
-  0x0f, 0xc9, 0x4f, 0xd0, 0x12, 0x41, 0x04, 0xb4, 0x17, 0x02, 0xba, 0xed,
-  0x7f, 0x15, 0xf1, 0x51, 0x42, 0xb2, 0xf5, 0x28, 0xef, 0xed, 0x05, 0x21,
-  0x01, 0xc8, 0x26, 0xfe, 0xde, 0x02, 0xfc, 0xf9, 0xfd, 0x82, 0xad, 0x28,
-  0xe9, 0xbe, 0x16, 0x70, 0x3a, 0xd7, 0x16, 0x66, 0x1a, 0x4b, 0xe6, 0xcd,
-  0xe0, 0x7d, 0x0f, 0xbe, 0x2e, 0xe9, 0xe3, 0x18, 0x18, 0x2d, 0xc3, 0xc3,
-  0xe7, 0xd3, 0x00, 0x55, 0x17, 0xa9, 0xaf, 0x7f, 0xf1, 0xe9, 0xf0, 0xda,
-  0x11, 0x49, 0x40, 0x26, 0xb7, 0x18, 0xce, 0x28, 0x9d, 0x57, 0x50, 0xf4,
-  0xf9, 0x02, 0xfe, 0xb8, 0xf3, 0xe9, 0xe7, 0xb3, 0xf1, 0x03, 0x5e, 0xf1,
-  0xd6, 0xe1, 0x37, 0xee, 0xc1, 0xe8, 0xd7, 0x32, 0x64, 0x4f, 0x12, 0xb5,
-  0xed, 0xdf, 0x10, 0xab, 0x01, 0xc6, 0xba, 0x06, 0xc6, 0x37, 0x09, 0xc2,
-  0x9d, 0x0a, 0xd7, 0x03, 0xbd, 0xd0, 0x4e, 0x29, 0x7f, 0x15, 0x99, 0x88,
-  0xc3, 0xfc, 0xe6, 0x38, 0x18, 0xf5, 0xd2, 0xd4, 0xf7, 0xcf, 0x35, 0xf0,
-  0x02, 0xc4, 0x4e, 0xee, 0x57, 0xe7, 0xc9, 0x48, 0x23, 0x21, 0xf6, 0x37,
-  0x1a, 0x35, 0x81, 0xfb, 0x44, 0x1b, 0xcf, 0xfb, 0x53, 0x04, 0x43, 0x12,
-  0x1c, 0xbe, 0xdd, 0x0a, 0x41, 0xa3, 0xe6, 0x06, 0x01, 0xd6, 0xb3, 0x19,
-  0xca, 0x2f, 0xec, 0x27, 0xab, 0x29, 0xf3, 0xf1, 0x87, 0x11, 0xf4, 0x39,
-  0xdc, 0xc2, 0x23, 0xe2, 0x75, 0xf2, 0xd2, 0xc4, 0x24, 0xff, 0x04, 0xc8,
-  0x2d, 0xbe, 0x38, 0xca, 0x9b, 0x94, 0x5d, 0xf9, 0x5b, 0x3e, 0x7f, 0xfb,
-  0xec, 0x16, 0x93, 0x53, 0xf9, 0x5f, 0xfb, 0x09, 0xb5, 0xa4, 0xb6, 0x32,
-  0xe5, 0x3c, 0x35, 0xa9, 0xdf, 0x45, 0xc2, 0x64, 0xfb, 0xca, 0x65, 0xf0,
-  0x12, 0xbd, 0x0e, 0x4a, 0xce, 0x2a, 0x1e, 0x4e, 0x27, 0xfe, 0x55, 0xa7,
-  0x0a, 0xd6, 0xf2, 0xcf, 0x1c, 0x0c, 0xb9, 0xf3, 0x14, 0x43, 0x7c, 0x88,
-  0x82, 0x78, 0xdc, 0xcd, 0xd2, 0x1a, 0xbd, 0x74, 0x78, 0x9c, 0xb9, 0x31,
-  0x7f, 0x0c, 0xf5, 0x46, 0x24, 0x09, 0x40, 0x38, 0xea, 0x84, 0x1a, 0x00,
-  0xc3, 0x92, 0x4f, 0x31, 0x7e, 0xe4, 0x2e, 0x4b, 0xdc, 0x2f, 0x41, 0xb7,
-  0x12, 0x8f, 0x4b, 0x2c, 0x53, 0xd5, 0x1d, 0x35, 0x32, 0x16, 0x2a, 0xef,
-  0x3f, 0x18, 0xdb, 0xd1, 0xfc, 0x06, 0xd3, 0xfc, 0xf1, 0x6c, 0xf8, 0x21,
-  0x37, 0xf8, 0xe5, 0x62, 0xdb, 0x29, 0x45, 0xe3, 0x36, 0xf6, 0x1d, 0xf8,
-  0x5d, 0xfd, 0x04, 0x22, 0x1d, 0xc5, 0x23, 0x19, 0xfc, 0xec, 0xe2, 0x66,
-  0x3e, 0x22, 0x78, 0xf3, 0xbe, 0xae, 0x49, 0x43, 0x25, 0x11, 0xd5, 0x3f,
-  0xcc, 0xd2, 0x1a, 0x15, 0xfd, 0x22, 0xba, 0xde, 0x1c, 0xda, 0xf8, 0xdf,
-  0x63, 0xca, 0x1c, 0x0e, 0xed, 0x76, 0x19, 0x49, 0xc8, 0xc0, 0xef, 0xf0,
-  0xaf, 0x0d, 0x13, 0xd2, 0xd0, 0x24, 0xea, 0xcd, 0xb3, 0x0d, 0x99, 0x2c,
-  0xe3, 0x0a, 0x3e, 0x7f, 0x1b, 0xe9, 0xeb, 0x26, 0xdf, 0x61, 0x40, 0xbe,
-  0x4e, 0xe3, 0xf0, 0xf9, 0xbf, 0x4c, 0xcb, 0xbc, 0xd4, 0x81, 0x26, 0x51,
-  0x11, 0x06, 0x52, 0x4f, 0x26, 0x77, 0x6f, 0xca, 0x44, 0xaf, 0xe3, 0xfe,
-  0x3f, 0xd6, 0x97, 0x28, 0x86, 0x0d, 0x4d, 0x56, 0xa1, 0xf9, 0xd0, 0xeb,
-  0xbc, 0x5a, 0x23, 0xf6, 0x9e, 0x0b, 0x25, 0x1e, 0x8a, 0x95, 0x19, 0xe5,
-  0x6a, 0xd5, 0x1d, 0x2c, 0xc3, 0x03, 0x3d, 0xb5, 0x25, 0xe0, 0xf3, 0x3e,
-  0x42, 0xef, 0xdd, 0xd7, 0xb7, 0xda, 0x3a, 0x15, 0x28, 0x97, 0xca, 0xcf,
-  0xf2, 0x1a, 0xfd, 0xd0, 0x1a, 0x1a, 0xe9, 0x01, 0x1c, 0xde, 0x27, 0xf6,
-  0xbd, 0xa5, 0x77, 0xae, 0xe7, 0x76, 0x57, 0xfe, 0x1d, 0x9b, 0xf2, 0xa5,
-  0x4c, 0xf8, 0x8f, 0x0f, 0xcb, 0x0e, 0x48, 0x05, 0xdc, 0xbe, 0xc9, 0xc7,
-  0xfc, 0xaa, 0xb1, 0x2f, 0xb3, 0x81, 0x6d, 0x64, 0x46, 0x17, 0xe5, 0x23,
-  0x4f, 0xa2, 0xce, 0xf2, 0x3e, 0x49, 0xe9, 0x03, 0x1b, 0xde, 0xea, 0xf3,
-  0x30, 0xd3, 0x2f, 0xec, 0x28, 0x34, 0xad, 0xaf, 0x51, 0xe7, 0x23, 0xe9,
-  0xa5, 0x05, 0x27, 0x0a, 0x26, 0x3b, 0x15, 0x32, 0xf6, 0xe1, 0xd4, 0x28,
-  0x23, 0xc5, 0xce, 0xf9, 0x4e, 0xc0, 0xf9, 0x21, 0xe8, 0xc3, 0x4e, 0x7f,
-  0x4f, 0xe4, 0x00, 0xe3, 0x18, 0xf9, 0x3c, 0x53, 0xd0, 0x32, 0xcd, 0xa1,
-  0x10, 0x20, 0x40, 0x5b, 0xe4, 0x23, 0x39, 0xce, 0x3a, 0x1e, 0x02, 0xfc,
-  0x41, 0xc0, 0xb0, 0xca, 0xd2, 0xcf, 0xcf, 0xc2, 0x04, 0x81, 0x55, 0x1a,
-  0x2f, 0xe5, 0x11, 0x08, 0x36, 0x5a, 0x5b, 0x49, 0x44, 0x3d, 0xdd, 0xab,
-  0xd4, 0xcd, 0xd0, 0xb9, 0xf9, 0xe8, 0xc3, 0x0a, 0x17, 0xcf, 0xbe, 0xd8,
-  0xf7, 0x20, 0xdb, 0xa7, 0x26, 0xbc, 0x41, 0x04, 0xda, 0xf2, 0xe0, 0x3e,
-  0x4f, 0xb3, 0x32, 0xdb, 0x03, 0x1d, 0xf1, 0xb6, 0xcc, 0x10, 0x99, 0xf5,
-  0x27, 0xd1, 0xd7, 0x29, 0x0c, 0xe8, 0x99, 0xf6, 0xe9, 0x0b, 0x6c, 0xc8,
-  0xe7, 0xb5, 0xc1, 0xc8, 0xcc, 0x49, 0x6d, 0xab, 0x4b, 0xc4, 0xf4, 0x72,
-  0x3d, 0x13, 0x22, 0xe2, 0xff, 0x5a, 0x56, 0xa5, 0x11, 0xed, 0xf6, 0xd8,
-  0x39, 0x3a, 0x7f, 0xaf, 0xf4, 0xfb, 0xd6, 0xaa, 0x3e, 0xfd, 0xe1, 0x6d,
-  0xf4, 0xff, 0x32, 0x5e, 0x61, 0xbb, 0xf8, 0xb0, 0x62, 0xfb, 0x9a, 0x99,
-  0xc2, 0xe8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xa5, 0x20, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0xb4, 0xec, 0xff, 0xff,
-  0xfd, 0x07, 0x00, 0x00, 0x48, 0x1b, 0x00, 0x00, 0xdc, 0xeb, 0xff, 0xff,
-  0xbd, 0x0f, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00, 0xf1, 0xe4, 0xff, 0xff,
-  0x7d, 0xf5, 0xff, 0xff, 0xc8, 0x0a, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
-  0x6c, 0xee, 0xff, 0xff, 0x4e, 0xf4, 0xff, 0xff, 0xad, 0x00, 0x00, 0x00,
-  0x28, 0xf8, 0xff, 0xff, 0xd8, 0xfc, 0xff, 0xff, 0xd7, 0xfa, 0xff, 0xff,
-  0xd8, 0x02, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xff, 0x4c, 0xe9, 0xff, 0xff,
-  0x36, 0xfc, 0xff, 0xff, 0x25, 0xf9, 0xff, 0xff, 0x22, 0xf5, 0xff, 0xff,
-  0x8e, 0x0d, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x57, 0xf6, 0xff, 0xff,
-  0xbd, 0x02, 0x00, 0x00, 0x3f, 0xf5, 0xff, 0xff, 0xdc, 0xf4, 0xff, 0xff,
-  0xdf, 0xf0, 0xff, 0xff, 0x37, 0xf1, 0xff, 0xff, 0x2a, 0xfb, 0xff, 0xff,
-  0xd1, 0xff, 0xff, 0xff, 0xe1, 0x05, 0x00, 0x00, 0xc5, 0xf5, 0xff, 0xff,
-  0x0c, 0x05, 0x00, 0x00, 0x42, 0xf1, 0xff, 0xff, 0x78, 0xfa, 0xff, 0xff,
-  0x7e, 0x02, 0x00, 0x00, 0xa7, 0xf4, 0xff, 0xff, 0x44, 0xea, 0xff, 0xff,
-  0x9f, 0xf1, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xcc, 0xf1, 0xff, 0xff,
-  0xd3, 0xf2, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0xff, 0x07, 0xf3, 0xff, 0xff,
-  0x2e, 0xf5, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0x4e, 0x12, 0x00, 0x00,
-  0x6b, 0xfc, 0xff, 0xff, 0xf0, 0xfc, 0xff, 0xff, 0x90, 0xfe, 0xff, 0xff,
-  0xcd, 0x0b, 0x00, 0x00, 0x47, 0xfd, 0xff, 0xff, 0xba, 0xf7, 0xff, 0xff,
-  0xfb, 0xea, 0xff, 0xff, 0x05, 0xf9, 0xff, 0xff, 0xe1, 0xf2, 0xff, 0xff,
-  0x5f, 0x03, 0x00, 0x00, 0x10, 0xf5, 0xff, 0xff, 0x58, 0x08, 0x00, 0x00,
-  0x38, 0x02, 0x00, 0x00, 0xce, 0xe9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0xc2, 0x7f, 0x96, 0x29, 0x81, 0x98, 0x1f, 0x1b,
-  0x81, 0xba, 0x54, 0x9f, 0xa4, 0xd1, 0x4a, 0x7f, 0xc3, 0x0a, 0x96, 0x3d,
-  0x81, 0x7f, 0x2e, 0xbe, 0x13, 0x53, 0xc5, 0xe0, 0x81, 0xd2, 0xc7, 0x81,
-  0x64, 0x81, 0x5d, 0x6a, 0x81, 0x30, 0xca, 0x86, 0x7f, 0xac, 0x08, 0x41,
-  0xa5, 0x1e, 0x76, 0x7c, 0x81, 0x1a, 0x17, 0x7f, 0x24, 0xa5, 0xd7, 0x51,
-  0x24, 0x1f, 0xba, 0x72, 0x5a, 0x39, 0x81, 0x24, 0xe1, 0x3c, 0xa3, 0xfa,
-  0x9c, 0xd5, 0x81, 0xd9, 0x17, 0x40, 0x4f, 0x19, 0x81, 0xfb, 0xec, 0x2d,
-  0x98, 0xfb, 0x0f, 0x77, 0xac, 0x22, 0x34, 0xbe, 0xe1, 0x53, 0x81, 0x09,
-  0xef, 0xcf, 0xbc, 0xcb, 0xfb, 0xe8, 0x26, 0x1c, 0xd5, 0xa1, 0x57, 0x85,
-  0x40, 0xb5, 0xd1, 0x29, 0x93, 0xeb, 0x7f, 0x12, 0x98, 0xf2, 0x1e, 0x66,
-  0x67, 0x81, 0xd2, 0x69, 0xf3, 0x7e, 0x20, 0x63, 0x3e, 0x17, 0x8c, 0xc1,
-  0x81, 0x32, 0x81, 0x05, 0xbf, 0xc2, 0xe8, 0x1d, 0x9f, 0x30, 0x7f, 0xa8,
-  0xc0, 0x1c, 0x5b, 0x3d, 0xc5, 0xff, 0x26, 0x51, 0xcc, 0x63, 0x2a, 0x81,
-  0x12, 0x32, 0xc4, 0x24, 0xc4, 0x81, 0xcb, 0xcf, 0x22, 0xb3, 0x77, 0x2b,
-  0x86, 0x96, 0x7f, 0xd7, 0x79, 0x9a, 0xf8, 0x07, 0xcc, 0xeb, 0x4c, 0x6f,
-  0x13, 0x22, 0x37, 0x39, 0x55, 0x10, 0x81, 0x3a, 0x11, 0x33, 0xf8, 0x63,
-  0x64, 0xe0, 0x8d, 0x81, 0xcc, 0x7a, 0xf0, 0x81, 0xe4, 0xf7, 0x29, 0x36,
-  0xe3, 0xa9, 0x21, 0x81, 0xc4, 0xc8, 0xf5, 0xe8, 0xd2, 0xe0, 0x71, 0xf4,
-  0xc6, 0x44, 0x7f, 0xa8, 0xcd, 0xc6, 0x13, 0x7f, 0xc7, 0xed, 0xdd, 0xcd,
-  0x0e, 0xe2, 0x55, 0x4f, 0x1c, 0xbc, 0x7e, 0xa2, 0x48, 0xe7, 0x81, 0x28,
-  0xec, 0x17, 0x78, 0x0c, 0xe9, 0x06, 0x48, 0x2c, 0xb4, 0xed, 0xdf, 0x6d,
-  0xfc, 0x7f, 0xf3, 0x48, 0x27, 0xe0, 0xe2, 0xf4, 0xd3, 0x57, 0x1f, 0x65,
-  0xd2, 0xe9, 0x54, 0x3b, 0xaa, 0x81, 0x1e, 0xd0, 0xf1, 0xba, 0x50, 0x2a,
-  0x81, 0x0d, 0xf6, 0xe2, 0x07, 0x24, 0x67, 0x00, 0x7f, 0xe5, 0x18, 0x51,
-  0x1a, 0x09, 0xaf, 0x18, 0x5c, 0xf2, 0x7f, 0x36, 0xe9, 0x37, 0x4e, 0xc2,
-  0x0b, 0xe2, 0xd8, 0xe0, 0x05, 0x81, 0x4f, 0x58, 0x34, 0x00, 0xdf, 0x45,
-  0x81, 0xad, 0xed, 0x2d, 0x37, 0x22, 0xbc, 0x34, 0x06, 0xf6, 0xa8, 0xc4,
-  0xd5, 0x2e, 0x1d, 0xcd, 0x0b, 0xec, 0xfa, 0x39, 0xe5, 0x34, 0x4f, 0x00,
-  0xa8, 0x81, 0x56, 0x14, 0xb9, 0xf2, 0x34, 0xf9, 0xe0, 0x4b, 0x19, 0xf9,
-  0xf4, 0x26, 0x05, 0x32, 0xc8, 0x20, 0x81, 0xd9, 0x2b, 0xf8, 0x78, 0x18,
-  0x1c, 0x81, 0x0e, 0xb3, 0x3c, 0x81, 0xed, 0xb6, 0x81, 0x83, 0x10, 0x07,
-  0x01, 0xed, 0x1b, 0x52, 0x8d, 0x07, 0xe4, 0x7f, 0xe5, 0x7e, 0x0c, 0x47,
-  0xeb, 0xcc, 0xcd, 0xca, 0xa8, 0xfe, 0x21, 0xed, 0xf9, 0x81, 0xbb, 0x81,
-  0xfd, 0x74, 0x23, 0x8b, 0xdf, 0xef, 0x38, 0x37, 0xf5, 0xb0, 0x92, 0x81,
-  0xf5, 0x32, 0x6f, 0x0c, 0x17, 0xae, 0xee, 0x0d, 0xa6, 0xf1, 0xfd, 0x95,
-  0xee, 0x82, 0xd3, 0x7f, 0xdb, 0x92, 0x4b, 0x91, 0x53, 0xa2, 0xb4, 0x17,
-  0x87, 0xe4, 0x22, 0x08, 0xdd, 0xc8, 0xd7, 0xf9, 0xbc, 0x9a, 0xe3, 0x21,
-  0x81, 0x34, 0x81, 0x7f, 0xac, 0x81, 0xbd, 0x2f, 0xeb, 0x10, 0xeb, 0x18,
-  0x0d, 0xe9, 0xd9, 0xe7, 0x38, 0xa3, 0x12, 0xd8, 0x12, 0x2d, 0x7f, 0x26,
-  0x06, 0xa0, 0xed, 0xaa, 0x21, 0x1d, 0x5c, 0xb5, 0x98, 0x81, 0xbb, 0x18,
-  0xf6, 0x03, 0xf3, 0xca, 0x81, 0x2f, 0x0b, 0x67, 0xa8, 0x11, 0x1d, 0x81,
-  0x36, 0xb5, 0x85, 0x81, 0xc1, 0xe7, 0x66, 0xfd, 0x13, 0xd4, 0x7f, 0x91,
-  0x54, 0xdc, 0x00, 0x55, 0x91, 0x67, 0xa9, 0x6b, 0xec, 0xc2, 0xdb, 0x92,
-  0x91, 0x45, 0x0d, 0xd3, 0x01, 0xb8, 0xd4, 0xa3, 0x21, 0x5a, 0x4f, 0xd1,
-  0x84, 0x1a, 0x54, 0x1a, 0x22, 0x81, 0x81, 0xcc, 0x09, 0x29, 0x18, 0x04,
-  0xee, 0x84, 0x00, 0x63, 0xc9, 0x11, 0xc6, 0xcf, 0x37, 0x8d, 0xf0, 0x2f,
-  0xc2, 0x92, 0x36, 0xb7, 0x4c, 0xcb, 0x95, 0x91, 0xfc, 0x96, 0x6a, 0x7f,
-  0x0a, 0x81, 0xc9, 0xf0, 0xd2, 0x10, 0xeb, 0x47, 0x0f, 0x5a, 0xdd, 0x78,
-  0x81, 0xf6, 0x05, 0xae, 0x1a, 0xec, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x8b, 0x13, 0x00, 0x00, 0x0e, 0xf2, 0xff, 0xff,
-  0x67, 0x01, 0x00, 0x00, 0xf2, 0xfe, 0xff, 0xff, 0xd0, 0x0b, 0x00, 0x00,
-  0x01, 0x0c, 0x00, 0x00, 0x2a, 0x01, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff,
-  0x2d, 0x02, 0x00, 0x00, 0x81, 0xfe, 0xff, 0xff, 0x05, 0xf6, 0xff, 0xff,
-  0x4e, 0x0b, 0x00, 0x00, 0x4a, 0x0d, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00,
-  0xf1, 0xf3, 0xff, 0xff, 0x61, 0xf9, 0xff, 0xff, 0x80, 0x09, 0x00, 0x00,
-  0xe0, 0x03, 0x00, 0x00, 0xbd, 0xff, 0xff, 0xff, 0x35, 0x00, 0x00, 0x00,
-  0x45, 0x0a, 0x00, 0x00, 0x98, 0xf9, 0xff, 0xff, 0xcf, 0xee, 0xff, 0xff,
-  0xf3, 0x05, 0x00, 0x00, 0xfe, 0xfe, 0xff, 0xff, 0xbe, 0x03, 0x00, 0x00,
-  0x17, 0x04, 0x00, 0x00, 0x65, 0xf7, 0xff, 0xff, 0xb5, 0x0c, 0x00, 0x00,
-  0x5d, 0x01, 0x00, 0x00, 0xb8, 0x12, 0x00, 0x00, 0x1b, 0x12, 0x00, 0x00,
-  0xb5, 0xfc, 0xff, 0xff, 0x97, 0x11, 0x00, 0x00, 0xf2, 0xf8, 0xff, 0xff,
-  0x5b, 0xf9, 0xff, 0xff, 0x92, 0x0a, 0x00, 0x00, 0xa0, 0x0b, 0x00, 0x00,
-  0xa6, 0xf1, 0xff, 0xff, 0x9e, 0x1f, 0x00, 0x00, 0xb0, 0xfe, 0xff, 0xff,
-  0x21, 0x14, 0x00, 0x00, 0x93, 0x0b, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00,
-  0x4d, 0x14, 0x00, 0x00, 0x0f, 0x09, 0x00, 0x00, 0x1b, 0xf4, 0xff, 0xff,
-  0xa8, 0xf3, 0xff, 0xff, 0xb2, 0x02, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00,
-  0xc7, 0xf9, 0xff, 0xff, 0x46, 0xf9, 0xff, 0xff, 0xc0, 0x01, 0x00, 0x00,
-  0xd0, 0x0b, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x0e, 0xf7, 0xff, 0xff,
-  0xa9, 0x00, 0x00, 0x00, 0xf4, 0xee, 0xff, 0xff, 0x1e, 0x05, 0x00, 0x00,
-  0x66, 0xfe, 0xff, 0xff, 0x85, 0xfe, 0xff, 0xff, 0x60, 0x03, 0x00, 0x00,
-  0xf8, 0x19, 0x00, 0x00, 0x6e, 0x0a, 0x00, 0x00, 0x26, 0xed, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xf1, 0xd1, 0xd8, 0xcb,
-  0xe5, 0x1f, 0x1e, 0xf8, 0x14, 0xe2, 0x94, 0xeb, 0x17, 0x06, 0xd2, 0x2e,
-  0x14, 0xc8, 0x09, 0xf5, 0xed, 0xe5, 0x35, 0x3e, 0xb3, 0xf6, 0xe9, 0x17,
-  0x00, 0xe8, 0x5d, 0x57, 0xd5, 0x09, 0xa5, 0x02, 0x2c, 0x7f, 0xf8, 0x6a,
-  0x0c, 0x28, 0x00, 0xb5, 0x2d, 0xff, 0xc3, 0xdb, 0x01, 0x34, 0x2f, 0xa5,
-  0xbb, 0x65, 0xec, 0xa8, 0x10, 0x31, 0x39, 0xe6, 0xff, 0xb2, 0xd4, 0x0b,
-  0x2a, 0xdc, 0x08, 0x33, 0x15, 0xcc, 0xc3, 0xb1, 0xe7, 0x2b, 0xbb, 0x02,
-  0xf3, 0x3d, 0xda, 0xc9, 0x23, 0x1e, 0x10, 0x08, 0x3b, 0x37, 0xba, 0xfe,
-  0xde, 0xe4, 0x33, 0x0e, 0x1c, 0xc6, 0x93, 0x03, 0x27, 0xeb, 0xde, 0xd1,
-  0x04, 0xb7, 0x01, 0x94, 0x65, 0x1f, 0x28, 0x06, 0x97, 0x06, 0xdf, 0x43,
-  0x33, 0x12, 0xda, 0x23, 0xe8, 0xd2, 0xee, 0x3b, 0xe7, 0x03, 0xbd, 0x7f,
-  0xe2, 0xca, 0xb7, 0xd5, 0xe5, 0x05, 0x1b, 0xf3, 0x20, 0x15, 0xd4, 0xdb,
-  0xfc, 0xe8, 0x5a, 0xaa, 0xd8, 0x42, 0x21, 0x22, 0xdd, 0x10, 0x61, 0x63,
-  0x14, 0xff, 0xef, 0xe4, 0x00, 0x04, 0xe6, 0xf2, 0xbd, 0x04, 0xf5, 0x81,
-  0x04, 0xf2, 0xeb, 0x4c, 0xde, 0x10, 0x3e, 0xb3, 0x0b, 0xfd, 0x10, 0x3e,
-  0xa6, 0xde, 0x39, 0xd2, 0x4c, 0x03, 0x02, 0xf5, 0xdd, 0x41, 0x46, 0x7e,
-  0x06, 0x9e, 0x36, 0xba, 0xb7, 0x00, 0x5d, 0x2a, 0xf5, 0x5f, 0x18, 0xb0,
-  0xde, 0xd9, 0xc9, 0x4f, 0xe7, 0x11, 0xfe, 0x1b, 0xe6, 0xad, 0x06, 0x59,
-  0x38, 0xdf, 0x81, 0x29, 0xc8, 0xd8, 0x3d, 0xd5, 0xc9, 0xf7, 0x15, 0xb9,
-  0xd9, 0x40, 0x49, 0x2f, 0x3a, 0x41, 0x20, 0x10, 0x76, 0x11, 0xd8, 0xd9,
-  0x1b, 0xfd, 0xb9, 0x1e, 0x45, 0xf5, 0x07, 0xce, 0x1b, 0xd9, 0xec, 0xf6,
-  0xc6, 0xbc, 0x01, 0xdb, 0x10, 0x2b, 0x0f, 0xf3, 0x31, 0x42, 0xfa, 0xf0,
-  0x15, 0xcb, 0x31, 0x3f, 0xef, 0xce, 0xb1, 0x17, 0x35, 0xec, 0x6a, 0x01,
-  0x03, 0x9e, 0x37, 0xbe, 0xbd, 0x21, 0xdc, 0x50, 0xd9, 0xe6, 0x39, 0x49,
-  0xbc, 0xd2, 0xe3, 0xcb, 0xbe, 0x18, 0xfb, 0x34, 0x10, 0xb4, 0xfa, 0x56,
-  0x35, 0xad, 0x38, 0xf1, 0xf1, 0x43, 0x22, 0x46, 0xe8, 0x22, 0x41, 0xda,
-  0xfa, 0xcc, 0x53, 0x09, 0x40, 0x77, 0x13, 0x17, 0x27, 0x26, 0xc9, 0xeb,
-  0x06, 0x4b, 0x7f, 0xfc, 0xe8, 0xe6, 0x1f, 0xf6, 0x4f, 0xe7, 0xb8, 0xf0,
-  0x0d, 0x0e, 0xf6, 0xe0, 0xdc, 0xf9, 0xe5, 0x05, 0x22, 0x20, 0xd8, 0x16,
-  0x39, 0x4d, 0xd6, 0x22, 0x40, 0x09, 0x25, 0xf8, 0xb8, 0xcc, 0xeb, 0xb2,
-  0x42, 0xb8, 0xe0, 0xed, 0x01, 0xc5, 0xff, 0xa5, 0x00, 0x07, 0x16, 0xf8,
-  0x97, 0x06, 0xfd, 0xf3, 0xf8, 0x36, 0x07, 0x33, 0xb4, 0xdf, 0x3a, 0x7f,
-  0xd9, 0x06, 0x42, 0x55, 0xc5, 0xeb, 0xcf, 0xea, 0x1a, 0xb5, 0x56, 0xf3,
-  0x2e, 0xe2, 0x10, 0x0f, 0x05, 0xfd, 0x7f, 0x96, 0xf4, 0x6c, 0x35, 0xd9,
-  0x40, 0xf4, 0x14, 0x5f, 0xdb, 0xd8, 0x08, 0x0d, 0x03, 0x3a, 0xd5, 0x08,
-  0xd3, 0x09, 0x69, 0x1b, 0xff, 0x9e, 0x39, 0x63, 0x2c, 0x4c, 0x57, 0xeb,
-  0x0f, 0xb5, 0x4e, 0x2c, 0xbf, 0x08, 0x72, 0xed, 0x25, 0x2c, 0xff, 0xdd,
-  0x0b, 0x3b, 0xba, 0x19, 0xe1, 0xd5, 0x2b, 0xbe, 0xf4, 0x30, 0xf7, 0x0a,
-  0x32, 0xb6, 0x1a, 0xe6, 0x18, 0x8e, 0xa2, 0x08, 0x10, 0xd4, 0x4c, 0x31,
-  0xbc, 0xca, 0x20, 0xcb, 0xc2, 0xbe, 0xe3, 0x45, 0x2a, 0x0d, 0xd3, 0x4d,
-  0x14, 0x4e, 0x6b, 0xcf, 0xfb, 0x42, 0xaa, 0xf0, 0x43, 0xeb, 0x03, 0x4e,
-  0xd7, 0xa8, 0xf8, 0xea, 0xed, 0x41, 0x3e, 0xc2, 0xa5, 0xd7, 0x5f, 0x12,
-  0x10, 0x3e, 0x1b, 0xd5, 0x49, 0xf7, 0x58, 0x7f, 0xfc, 0x41, 0xea, 0xc1,
-  0xe9, 0xfa, 0x0d, 0x71, 0xf0, 0x19, 0xed, 0x17, 0xc4, 0x1b, 0x2c, 0xca,
-  0x1c, 0x1a, 0xe3, 0xe3, 0xd7, 0x41, 0xf3, 0xcf, 0x15, 0x33, 0xd4, 0x11,
-  0xd3, 0xfa, 0x1e, 0x4e, 0x40, 0x0d, 0xb3, 0x11, 0xc5, 0xdd, 0xdd, 0xed,
-  0x36, 0xf3, 0x3b, 0xe0, 0x4c, 0xa7, 0xf9, 0x0e, 0x7f, 0x22, 0xf1, 0xd7,
-  0xcf, 0xfd, 0xf2, 0x24, 0x13, 0xd0, 0x17, 0xd4, 0xe3, 0xee, 0x09, 0xec,
-  0x28, 0x09, 0x04, 0x5d, 0x0a, 0x16, 0xd3, 0x15, 0x16, 0xf8, 0x96, 0x3a,
-  0x0f, 0x1c, 0xf3, 0x10, 0xdf, 0xdf, 0x70, 0xbe, 0xfe, 0xdd, 0x58, 0x2a,
-  0x64, 0x5f, 0xfc, 0x1d, 0xd4, 0xc9, 0xc8, 0xd2, 0x25, 0x79, 0x30, 0xcd,
-  0xf4, 0x37, 0x0e, 0x00, 0xdb, 0xa7, 0xe3, 0x7d, 0x13, 0xd8, 0xf8, 0xfd,
-  0xf1, 0xeb, 0xf4, 0x09, 0xd0, 0xc6, 0x7f, 0xda, 0xca, 0x32, 0xbb, 0xe0,
-  0x11, 0x7c, 0x1f, 0x35, 0xc6, 0x59, 0xd5, 0xea, 0xbd, 0x1d, 0x67, 0x64,
-  0x5f, 0x1e, 0xc2, 0x3e, 0x99, 0x33, 0xdb, 0x28, 0xe5, 0x29, 0xb8, 0xf8,
-  0xe1, 0xaf, 0xdc, 0xfc, 0xf3, 0xf4, 0xfb, 0xf6, 0xa4, 0x62, 0xcc, 0xf6,
-  0xf9, 0xc4, 0x53, 0x5e, 0x5f, 0x20, 0x8b, 0xe3, 0xec, 0x0f, 0x0c, 0xdc,
-  0x2b, 0x2e, 0xbb, 0x98, 0x48, 0xda, 0x9c, 0x94, 0xb2, 0x38, 0xef, 0x14,
-  0xdf, 0xe1, 0x05, 0xa7, 0x03, 0xc6, 0x3f, 0x06, 0x54, 0x12, 0xfa, 0x7f,
-  0xd0, 0xe5, 0xcf, 0xd6, 0x30, 0xcb, 0xdb, 0xbe, 0x22, 0x0c, 0x2e, 0x20,
-  0xa2, 0x00, 0x7f, 0xe3, 0x2a, 0x23, 0x5d, 0xf5, 0x15, 0xe1, 0x0c, 0x2e,
-  0xf9, 0xea, 0xd2, 0x65, 0xa5, 0xb3, 0xec, 0xed, 0x15, 0x19, 0xfb, 0xde,
-  0xa8, 0x9b, 0x2d, 0x42, 0xc6, 0xc9, 0xf6, 0x44, 0xf7, 0xea, 0xbe, 0x02,
-  0x9c, 0x10, 0x7f, 0xd5, 0xc2, 0x45, 0xd6, 0x37, 0x23, 0x2f, 0xdc, 0x12,
-  0x00, 0x4b, 0x15, 0xd3, 0xf0, 0x1a, 0xf2, 0x4d, 0x69, 0xf6, 0x87, 0x18,
-  0x9d, 0x92, 0xc2, 0xcf, 0xd0, 0x10, 0xa8, 0xd8, 0xac, 0x4f, 0xd6, 0xb6,
-  0xac, 0xc9, 0xdd, 0xee, 0x35, 0x7f, 0xa1, 0xff, 0xeb, 0xbe, 0xa6, 0x2b,
-  0xbe, 0xad, 0x83, 0xdf, 0x1a, 0xb7, 0xd4, 0xb5, 0x35, 0xfc, 0x2f, 0xde,
-  0x76, 0xbd, 0x34, 0x9e, 0x4c, 0x52, 0xdb, 0x57, 0x40, 0x49, 0xe6, 0x51,
-  0xab, 0xf4, 0x02, 0x0c, 0xe2, 0x19, 0xc9, 0x74, 0xf3, 0xbb, 0xaa, 0xdd,
-  0xbd, 0xd4, 0xa8, 0x14, 0x37, 0x91, 0xf3, 0xf7, 0x23, 0xea, 0x57, 0xde,
-  0x1b, 0x26, 0x2e, 0x0f, 0x14, 0x34, 0x14, 0x25, 0x21, 0xf0, 0xde, 0x37,
-  0xdf, 0x51, 0x4d, 0xc5, 0x06, 0x38, 0x13, 0xae, 0x0b, 0xa4, 0xff, 0x43,
-  0xec, 0xb5, 0xf8, 0x84, 0xf7, 0xf4, 0xfc, 0x03, 0x16, 0x01, 0x55, 0xe4,
-  0xeb, 0x13, 0xfd, 0x14, 0x19, 0x1f, 0xf3, 0x7f, 0xeb, 0x23, 0x12, 0xd4,
-  0xce, 0xd1, 0x60, 0x3a, 0xc4, 0xdc, 0xba, 0xde, 0x1d, 0xb1, 0xa4, 0x04,
-  0xc9, 0xcf, 0x35, 0xe4, 0x14, 0x1b, 0xfb, 0x25, 0x06, 0xeb, 0xcc, 0xff,
-  0x30, 0xef, 0xe1, 0xc9, 0x0f, 0x53, 0x36, 0x32, 0xfb, 0x16, 0xe5, 0xf5,
-  0xfa, 0x93, 0x08, 0x02, 0xf7, 0xab, 0x48, 0xad, 0xf4, 0xe2, 0xc2, 0x49,
-  0xef, 0x1d, 0x29, 0xca, 0x28, 0x20, 0xce, 0xed, 0xc0, 0xe9, 0x1c, 0x7f,
-  0xcc, 0xf1, 0x16, 0x14, 0xd7, 0xf6, 0x3a, 0xfb, 0xec, 0x7f, 0x17, 0x3b,
-  0x13, 0xc9, 0x10, 0x5e, 0x13, 0x2e, 0xf2, 0x5d, 0x16, 0x13, 0xf8, 0x70,
-  0xdb, 0x06, 0xfc, 0x24, 0xa2, 0xfd, 0xcd, 0x48, 0xe9, 0xc6, 0x1b, 0x06,
-  0xcf, 0xd1, 0x11, 0xcd, 0x2e, 0x3e, 0x71, 0xe0, 0x52, 0xc7, 0x06, 0xaf,
-  0x5a, 0x6f, 0xb6, 0xc0, 0xed, 0x4a, 0xed, 0x0c, 0xf9, 0xe8, 0x08, 0xbe,
-  0xe6, 0xda, 0x5a, 0xbe, 0x97, 0xb9, 0x9c, 0x40, 0x60, 0x2a, 0xae, 0x2a,
-  0xfc, 0xf8, 0xb0, 0xe6, 0x24, 0xe0, 0x09, 0xfd, 0x26, 0xd1, 0x7f, 0xc8,
-  0xd2, 0x38, 0x59, 0x09, 0xf3, 0x0e, 0x26, 0x22, 0xde, 0x25, 0xe2, 0x56,
-  0x27, 0x2d, 0xfa, 0xde, 0x01, 0xc9, 0xef, 0xa0, 0xe2, 0x20, 0x29, 0x30,
-  0x06, 0x14, 0x2d, 0x1c, 0xe9, 0xe6, 0xe2, 0x12, 0xda, 0x4f, 0x66, 0xea,
-  0xe8, 0xed, 0xd2, 0xfe, 0x11, 0x75, 0xdd, 0x04, 0x2d, 0xe7, 0x54, 0xc3,
-  0xfe, 0x08, 0x11, 0xfe, 0x31, 0x07, 0x1b, 0x08, 0xf7, 0x00, 0xf4, 0x3b,
-  0x26, 0x2a, 0xd8, 0x21, 0xdd, 0x18, 0xee, 0xd1, 0xdd, 0xca, 0xe5, 0xfc,
-  0xdd, 0x4a, 0xae, 0x11, 0x0e, 0xf2, 0xd4, 0x35, 0x15, 0xf7, 0xf1, 0xe0,
-  0xfd, 0x05, 0xf7, 0xdb, 0xf8, 0xd3, 0xf2, 0xc2, 0x22, 0x03, 0x0b, 0xce,
-  0xde, 0x02, 0xee, 0x19, 0x24, 0xfd, 0x09, 0xf0, 0xe1, 0x19, 0x06, 0x1b,
-  0xe6, 0x1e, 0x46, 0x7f, 0xfb, 0xf7, 0xf2, 0xfa, 0xb0, 0xc1, 0x07, 0xc6,
-  0x2f, 0x0e, 0xd6, 0xeb, 0xf2, 0xd9, 0x47, 0x49, 0xdb, 0xe4, 0x4c, 0x22,
-  0x3a, 0xb7, 0x29, 0x40, 0x81, 0xbe, 0x28, 0x4d, 0x0a, 0x08, 0xd4, 0xea,
-  0xa5, 0x36, 0x3c, 0xc5, 0x29, 0xfb, 0xda, 0x60, 0x3d, 0x33, 0x09, 0xcb,
-  0xfc, 0xed, 0x40, 0x4e, 0xa6, 0xf9, 0x44, 0xb7, 0x1d, 0xc9, 0x06, 0xc1,
-  0x30, 0xed, 0x52, 0x30, 0xfe, 0x34, 0xe5, 0xf6, 0x97, 0x29, 0x5e, 0xe6,
-  0x5c, 0x57, 0xcd, 0xbe, 0xb0, 0xe9, 0xd2, 0x32, 0xe5, 0x19, 0xc8, 0x08,
-  0xa2, 0xe3, 0xd7, 0x2c, 0x00, 0x28, 0xd9, 0x06, 0x27, 0x1e, 0xf6, 0x00,
-  0xef, 0xe8, 0xf0, 0x29, 0xbe, 0xc4, 0xa0, 0xdc, 0x34, 0xb7, 0x13, 0xd1,
-  0x0c, 0xa4, 0x26, 0xea, 0x60, 0x18, 0x03, 0xd5, 0x2d, 0x34, 0xde, 0x5e,
-  0xc8, 0xf1, 0xe9, 0x99, 0xdf, 0xe2, 0xe1, 0xe8, 0x33, 0x9c, 0xdb, 0x7f,
-  0xdd, 0x0e, 0xa4, 0x00, 0x1b, 0x03, 0xcc, 0x2c, 0x46, 0xfd, 0x37, 0xd4,
-  0xbc, 0x0a, 0xf0, 0x1a, 0xb5, 0xfc, 0xf5, 0x5a, 0xf0, 0x0e, 0xce, 0x2c,
-  0xdd, 0xc1, 0x42, 0xfa, 0x3b, 0x19, 0x10, 0x81, 0xd1, 0xe0, 0xd2, 0xf7,
-  0x3d, 0x0c, 0x6d, 0x00, 0x0b, 0x09, 0xaf, 0x2c, 0x4c, 0x4e, 0xbd, 0xa1,
-  0x5b, 0x31, 0xec, 0x13, 0xee, 0x4e, 0x05, 0x1a, 0xbd, 0xda, 0xe6, 0xf3,
-  0xd8, 0x5d, 0xf0, 0xf0, 0x2d, 0xd4, 0xe1, 0x0f, 0xd5, 0x0e, 0x09, 0xd5,
-  0x28, 0xed, 0xd9, 0x33, 0xea, 0x13, 0x6f, 0xf8, 0xcb, 0x1b, 0x31, 0xd8,
-  0xe7, 0xd1, 0x43, 0x5e, 0x20, 0x1a, 0xce, 0xb5, 0x38, 0xf6, 0xe8, 0x43,
-  0x2a, 0xc5, 0x41, 0xbf, 0xdd, 0x99, 0x24, 0x7a, 0xfc, 0x32, 0x54, 0x2d,
-  0x0d, 0x56, 0x3e, 0xde, 0xbf, 0xbc, 0x7f, 0xd7, 0xda, 0xd7, 0x19, 0xaf,
-  0x00, 0xc8, 0xa5, 0x14, 0xe2, 0xd8, 0xe1, 0xac, 0x0c, 0x1b, 0x6b, 0x29,
-  0x28, 0xf8, 0xdb, 0xc8, 0x04, 0xf5, 0x32, 0x15, 0x23, 0xfa, 0x53, 0xa8,
-  0xa4, 0xf7, 0x1c, 0xc1, 0x61, 0x28, 0xc9, 0x54, 0x0c, 0xed, 0x41, 0x2f,
-  0x15, 0xed, 0xd1, 0x40, 0x2c, 0xc5, 0x1a, 0x2e, 0xcd, 0xbe, 0x10, 0x7f,
-  0xc4, 0x38, 0x1e, 0x0a, 0xfc, 0xf7, 0xb4, 0x10, 0xdb, 0x13, 0x6a, 0xfb,
-  0xd9, 0x1c, 0x3b, 0xca, 0x04, 0xf3, 0x59, 0x07, 0xd7, 0xc8, 0xd3, 0xd6,
-  0x0f, 0x03, 0x69, 0x65, 0x98, 0x0e, 0xaa, 0xf0, 0xf5, 0xd8, 0xe0, 0xf9,
-  0xae, 0x01, 0x76, 0x1c, 0x29, 0xc3, 0x6c, 0x3a, 0x44, 0xd9, 0x00, 0x10,
-  0x40, 0xdf, 0x2d, 0xd9, 0xc1, 0xdf, 0x13, 0xf3, 0xbd, 0xa5, 0x14, 0xe6,
-  0xe6, 0x64, 0xd0, 0x74, 0xab, 0xd9, 0xe3, 0xce, 0x09, 0xfd, 0x41, 0x2b,
-  0x33, 0x55, 0xf3, 0xfe, 0xa8, 0x17, 0x4d, 0x81, 0xf9, 0x34, 0x29, 0xcf,
-  0x2d, 0x33, 0x23, 0xfc, 0xcb, 0xd7, 0x37, 0xbc, 0xf6, 0xc8, 0x21, 0xf0,
-  0x3a, 0x1d, 0xff, 0xf1, 0xea, 0xf5, 0x11, 0xd3, 0xdd, 0xed, 0x02, 0xe9,
-  0xd9, 0xed, 0xd9, 0x1d, 0x0b, 0x16, 0xd3, 0x20, 0xc2, 0x2b, 0xfb, 0x17,
-  0x05, 0x40, 0xf3, 0x11, 0xf4, 0xc1, 0x17, 0x06, 0xe6, 0xe5, 0xf4, 0xc2,
-  0xf9, 0xed, 0x10, 0x1a, 0xd3, 0x26, 0x1e, 0xdb, 0x24, 0xfa, 0xde, 0x30,
-  0xdd, 0x21, 0x0a, 0x7f, 0xdb, 0xf5, 0x06, 0x1f, 0x0d, 0x37, 0x5a, 0x17,
-  0xec, 0xde, 0x12, 0x2a, 0x02, 0xac, 0x09, 0xec, 0xe8, 0x04, 0xda, 0x0c,
-  0xd7, 0xd5, 0xdb, 0xdc, 0xd5, 0xf2, 0xfc, 0xf7, 0x25, 0x63, 0xe3, 0x2c,
-  0xd8, 0x3a, 0x15, 0xe1, 0xc8, 0xd7, 0xad, 0x0d, 0x0f, 0x0e, 0x0d, 0xd3,
-  0x11, 0xff, 0xf9, 0xda, 0x0c, 0xa0, 0xea, 0xee, 0xfe, 0x1c, 0xe0, 0x3c,
-  0x28, 0x19, 0xf0, 0x2a, 0xf0, 0x26, 0xfc, 0x5b, 0x08, 0xca, 0x15, 0x7f,
-  0x00, 0xf8, 0x0e, 0xe1, 0xa7, 0xcb, 0xb2, 0xfc, 0xd9, 0xc4, 0xfa, 0x9d,
-  0x38, 0x47, 0xf3, 0xd1, 0x65, 0x1b, 0xea, 0xcc, 0xe6, 0x0c, 0x8d, 0x02,
-  0x59, 0x30, 0xb3, 0x5a, 0xd6, 0x12, 0xe2, 0x3a, 0x5f, 0x73, 0xcc, 0xe1,
-  0x84, 0x6a, 0x90, 0xf6, 0xd5, 0x75, 0xd3, 0x60, 0xca, 0xcf, 0x1f, 0x00,
-  0x25, 0x51, 0xe5, 0xe9, 0xe5, 0x9d, 0x5b, 0x84, 0xce, 0x5c, 0x54, 0xd1,
-  0xcf, 0x81, 0x41, 0xd0, 0xa7, 0x52, 0xd4, 0x4a, 0x2a, 0x01, 0x03, 0x08,
-  0x09, 0x14, 0xee, 0xdc, 0xd0, 0x20, 0xea, 0x29, 0xcb, 0x21, 0xf0, 0xde,
-  0x1f, 0x05, 0xf0, 0xf2, 0x0b, 0x0c, 0x05, 0x13, 0xe6, 0x00, 0x2b, 0xee,
-  0x04, 0xfe, 0xd4, 0xd2, 0xd7, 0x02, 0xf3, 0xd4, 0x0c, 0x02, 0x15, 0xdf,
-  0x3a, 0xed, 0xdc, 0x45, 0xe0, 0x34, 0xee, 0x29, 0x2e, 0x09, 0xe5, 0x4b,
-  0xd2, 0x0e, 0xd3, 0x13, 0xf2, 0xc7, 0x19, 0x7f, 0xf5, 0xe0, 0xd4, 0xd8,
-  0xf8, 0x7f, 0x0e, 0x5c, 0x20, 0x0d, 0x01, 0x10, 0xad, 0x2d, 0xfc, 0x0c,
-  0xfd, 0x04, 0xe6, 0x45, 0xb4, 0xf7, 0xee, 0x22, 0xd7, 0xeb, 0xc0, 0x5e,
-  0x0d, 0xa3, 0x99, 0xd8, 0x09, 0x38, 0x1b, 0x1c, 0x49, 0x5d, 0x36, 0xdd,
-  0x49, 0x1c, 0xe0, 0x53, 0x6e, 0xb9, 0xa0, 0xbc, 0xac, 0x3e, 0xf7, 0x53,
-  0xb1, 0xe5, 0xb6, 0xa5, 0xca, 0x06, 0x17, 0xd3, 0xb5, 0x60, 0x07, 0x69,
-  0x4f, 0x2f, 0xc3, 0x11, 0x17, 0xf9, 0x6f, 0xec, 0x32, 0xac, 0xe0, 0x41,
-  0x17, 0xfb, 0x76, 0xfa, 0x8f, 0x52, 0x49, 0xfe, 0x64, 0x25, 0xcb, 0x4c,
-  0xf0, 0xd4, 0xe5, 0x3e, 0xb7, 0xcb, 0xff, 0x2a, 0x11, 0xec, 0x5e, 0xac,
-  0xeb, 0xa3, 0x01, 0x7f, 0xdb, 0x0a, 0xdb, 0xa0, 0xfa, 0xc7, 0xc3, 0x2c,
-  0xd1, 0x41, 0x40, 0xc7, 0x21, 0xfc, 0x0a, 0x35, 0xe8, 0x62, 0xb9, 0x4c,
-  0xb4, 0x0d, 0xda, 0xc8, 0xdd, 0xcf, 0x37, 0x30, 0x22, 0x7f, 0x01, 0xbf,
-  0xf5, 0x50, 0xd5, 0x5d, 0x1d, 0x0d, 0x05, 0x07, 0x2b, 0xc2, 0xef, 0x35,
-  0x28, 0x14, 0xd0, 0x2c, 0xde, 0xb3, 0x34, 0xb0, 0xfe, 0xbe, 0xf9, 0xdb,
-  0xf4, 0xb1, 0xda, 0x74, 0xf8, 0x59, 0x48, 0xf8, 0x6c, 0xc7, 0x06, 0xcc,
-  0x22, 0xcc, 0x47, 0x34, 0x5a, 0xc1, 0x0d, 0xf8, 0x0b, 0xc5, 0xcc, 0xd2,
-  0x1b, 0xb5, 0xd2, 0xf0, 0xf2, 0xf8, 0xf0, 0xfd, 0x5f, 0x07, 0xbe, 0xf2,
-  0x00, 0x69, 0x54, 0x14, 0xe7, 0x20, 0x08, 0x53, 0x38, 0x1f, 0xda, 0x14,
-  0xd5, 0xd4, 0xf1, 0x46, 0x3d, 0xf2, 0xd3, 0x24, 0xce, 0x06, 0xb5, 0xd3,
-  0xeb, 0xe0, 0x22, 0xb3, 0xfc, 0xf0, 0xd6, 0x33, 0x0f, 0xed, 0x52, 0xee,
-  0x39, 0xa3, 0xb3, 0x26, 0x7f, 0xbd, 0xe9, 0x96, 0xd2, 0x0c, 0xe9, 0x5c,
-  0xc8, 0xe6, 0x33, 0x26, 0xc0, 0xc6, 0x3a, 0xe3, 0xf0, 0x06, 0x18, 0x21,
-  0xfa, 0x0d, 0xeb, 0xfa, 0x58, 0x7f, 0xa5, 0x9e, 0x2b, 0x3a, 0xa6, 0x48,
-  0x88, 0x5a, 0xf0, 0xdd, 0xce, 0x1b, 0xfd, 0x75, 0x0e, 0xb4, 0xc3, 0x3a,
-  0x24, 0xb3, 0x00, 0xa0, 0x22, 0xa6, 0x5b, 0xba, 0x6b, 0xdc, 0x2f, 0x3f,
-  0xef, 0xdc, 0x55, 0xee, 0x77, 0x15, 0xd7, 0x5a, 0x6d, 0xcd, 0xa1, 0x21,
-  0xb1, 0xe0, 0xed, 0x69, 0x2c, 0xc2, 0x0d, 0xe3, 0x9b, 0x92, 0x50, 0xe1,
-  0xe0, 0x19, 0x16, 0xf7, 0x11, 0xfe, 0x90, 0xdc, 0xb1, 0x11, 0xe9, 0x3e,
-  0x3b, 0xff, 0x3c, 0xd6, 0xd0, 0xd6, 0xe5, 0xff, 0x24, 0x4e, 0x53, 0x3f,
-  0x34, 0xe6, 0xe8, 0x05, 0xb2, 0x19, 0x18, 0x1a, 0xc1, 0xc1, 0x43, 0xad,
-  0x21, 0xf5, 0x29, 0x1b, 0x52, 0x7f, 0x43, 0xd8, 0x3d, 0x48, 0xb5, 0x17,
-  0x1d, 0x3d, 0xf2, 0xae, 0x47, 0xe5, 0x22, 0xcb, 0xf7, 0x52, 0x5f, 0xf3,
-  0x16, 0x2a, 0x2f, 0xc5, 0x09, 0x31, 0x23, 0xbf, 0x4c, 0x0d, 0xc6, 0xc6,
-  0x15, 0xbc, 0xec, 0xf2, 0x45, 0x0f, 0x09, 0xc9, 0x31, 0xfe, 0x31, 0x2c,
-  0x0e, 0x26, 0x02, 0xdc, 0x40, 0x4c, 0xf0, 0x2b, 0xec, 0xe7, 0xf2, 0x35,
-  0xc7, 0x2c, 0xde, 0x1c, 0xcf, 0x30, 0x15, 0xcb, 0x0d, 0xea, 0x14, 0x2a,
-  0xc4, 0x00, 0xec, 0xdf, 0x07, 0x1c, 0xae, 0xc1, 0xb5, 0xf2, 0x32, 0x0f,
-  0x14, 0x0f, 0xea, 0x42, 0xd2, 0x00, 0x0c, 0x7f, 0x2f, 0xd2, 0x53, 0xe0,
-  0xf6, 0x27, 0x40, 0xfa, 0xfa, 0xe6, 0x48, 0xe5, 0x5a, 0xb9, 0xf3, 0x24,
-  0xc4, 0xf6, 0x42, 0xdf, 0x22, 0x1a, 0x1b, 0xf5, 0x41, 0x01, 0xe7, 0x42,
-  0xd9, 0x03, 0xe7, 0x4e, 0x15, 0x37, 0xf5, 0xe8, 0xa2, 0x4b, 0x25, 0xc8,
-  0x04, 0x0d, 0x02, 0x26, 0xb7, 0xe7, 0x24, 0xb6, 0xe8, 0xbe, 0x1d, 0x1b,
-  0x0b, 0xfd, 0x41, 0xed, 0xc2, 0x05, 0xdf, 0x0a, 0xe2, 0xf5, 0x06, 0x7f,
-  0x02, 0xd1, 0xd3, 0xdb, 0xde, 0xfd, 0x17, 0x29, 0xd5, 0xad, 0x52, 0xcc,
-  0x7f, 0x8a, 0xa1, 0xcd, 0xfc, 0xd0, 0x5f, 0x93, 0xc9, 0x3a, 0x40, 0xd0,
-  0x5c, 0xa8, 0x6a, 0x77, 0x96, 0xee, 0x0d, 0x38, 0x7b, 0x22, 0xd1, 0xf8,
-  0xca, 0xe5, 0x57, 0x11, 0x15, 0x87, 0x19, 0x70, 0xca, 0x4f, 0x45, 0xce,
-  0x0c, 0xf9, 0x5c, 0xea, 0x8b, 0xd3, 0x5b, 0xc6, 0x40, 0x01, 0x03, 0x2f,
-  0xeb, 0xc8, 0xcd, 0x65, 0xcd, 0xcf, 0xfb, 0xa4, 0xee, 0x36, 0x1a, 0x0c,
-  0x59, 0xca, 0xe2, 0xd8, 0x67, 0x13, 0x2c, 0x52, 0xc7, 0x01, 0x60, 0x52,
-  0x21, 0x06, 0x70, 0xd7, 0x11, 0xcc, 0xc5, 0x43, 0xaf, 0xe6, 0x30, 0x4e,
-  0x30, 0x6c, 0xb9, 0xf9, 0xf8, 0x2e, 0x0f, 0x20, 0xed, 0x84, 0xf2, 0x7f,
-  0x15, 0xd4, 0x32, 0x52, 0x1a, 0xbc, 0x2e, 0xe2, 0xfc, 0xe0, 0x44, 0xdc,
-  0x88, 0x1a, 0x4b, 0xb5, 0xe8, 0x55, 0xd6, 0x12, 0x09, 0xf9, 0xf2, 0xc1,
-  0xd6, 0x0b, 0x3a, 0x60, 0x60, 0xf0, 0x12, 0xd4, 0xb5, 0xda, 0xb8, 0xe4,
-  0x09, 0x37, 0xcd, 0xcd, 0xba, 0xf8, 0xe9, 0xbe, 0x28, 0x46, 0xfb, 0x03,
-  0xed, 0x0d, 0xb0, 0x05, 0x29, 0x04, 0xbe, 0x16, 0xb3, 0xb5, 0x81, 0x5d,
-  0x27, 0x0a, 0x09, 0xcf, 0x20, 0x3e, 0x2c, 0x12, 0x75, 0xd1, 0xb1, 0xfa,
-  0xc6, 0x39, 0xe6, 0x26, 0xf8, 0xaa, 0x0a, 0x05, 0xba, 0xcc, 0x29, 0xf7,
-  0x15, 0x31, 0xb6, 0x69, 0x01, 0xd2, 0xb3, 0xd9, 0x53, 0xf1, 0x2f, 0xbc,
-  0xc2, 0x9d, 0x07, 0xbf, 0x91, 0xe6, 0xcc, 0xd2, 0xd2, 0x12, 0xf0, 0xfb,
-  0x0c, 0xfe, 0xd0, 0xfb, 0xf3, 0x5d, 0x06, 0x18, 0x05, 0x03, 0x26, 0x35,
-  0x02, 0xfc, 0xf4, 0xcb, 0x2b, 0xea, 0xde, 0xe0, 0x2a, 0x2f, 0xbe, 0xea,
-  0x3e, 0x03, 0xac, 0xc8, 0xd0, 0x38, 0xf4, 0x2b, 0xdd, 0x2b, 0xf6, 0xf7,
-  0xc0, 0xf2, 0x14, 0x0e, 0x11, 0xee, 0x08, 0x7f, 0xc9, 0xd7, 0xa7, 0xcb,
-  0x88, 0x7d, 0xc1, 0xa9, 0x09, 0xf5, 0x1c, 0x17, 0x36, 0xf9, 0xf8, 0x32,
-  0x3c, 0x0c, 0x0e, 0xfc, 0x51, 0x40, 0x9d, 0x3a, 0xe5, 0xd0, 0x31, 0xb1,
-  0x0c, 0xc7, 0xba, 0x13, 0xfe, 0xcb, 0x7f, 0x45, 0xe7, 0x77, 0x68, 0xf2,
-  0xd2, 0xc7, 0xbe, 0x53, 0x15, 0x07, 0xbb, 0xff, 0x7d, 0x1e, 0x13, 0xc9,
-  0x4a, 0x05, 0x0d, 0x2d, 0xfe, 0xcc, 0xe2, 0xe0, 0xc1, 0x02, 0x02, 0xf1,
-  0x7a, 0xd0, 0x10, 0x24, 0xc9, 0xe7, 0xd3, 0x46, 0x60, 0xa1, 0x97, 0xc1,
-  0xa6, 0xc6, 0x66, 0xf2, 0x29, 0x2e, 0x2e, 0xda, 0xe4, 0x1b, 0x51, 0x43,
-  0x29, 0x14, 0xf5, 0x22, 0x33, 0x28, 0x35, 0xdc, 0xc6, 0xf7, 0x51, 0x8b,
-  0xd8, 0xcc, 0x0f, 0x3b, 0xb3, 0x9d, 0x4b, 0x81, 0xcf, 0xce, 0xae, 0x3b,
-  0x0f, 0xd5, 0x4a, 0xb8, 0xdb, 0xd2, 0xf1, 0x13, 0xb1, 0x4c, 0x2d, 0x55,
-  0xf4, 0x4d, 0xc7, 0xed, 0x2a, 0x5b, 0x52, 0x13, 0xc8, 0x56, 0xcf, 0x2f,
-  0x1e, 0xff, 0xde, 0xf0, 0x04, 0x54, 0xe4, 0xf6, 0x14, 0xc6, 0xf7, 0x09,
-  0xd4, 0xe0, 0xbe, 0x12, 0x12, 0xd7, 0x2e, 0xf7, 0xfc, 0xe4, 0x23, 0xec,
-  0xe0, 0x18, 0xc6, 0xdb, 0x0f, 0x19, 0x70, 0xd7, 0x4e, 0x07, 0xf1, 0xca,
-  0x7d, 0x23, 0x2c, 0x0e, 0x18, 0xc9, 0xe7, 0x7f, 0x26, 0x2c, 0x11, 0xbe,
-  0xe6, 0xc1, 0xfd, 0xd3, 0xeb, 0xd8, 0xda, 0x29, 0x38, 0x14, 0xe0, 0xfd,
-  0x08, 0xbb, 0x2a, 0xe6, 0x60, 0xd6, 0x23, 0xed, 0xc0, 0xd4, 0x4c, 0x37,
-  0x0b, 0x45, 0x5e, 0x00, 0xc2, 0x25, 0x3c, 0x05, 0xa2, 0xf3, 0x10, 0xe6,
-  0x3e, 0x13, 0xc1, 0xb1, 0xd0, 0x1b, 0x06, 0x1f, 0xcf, 0x25, 0x27, 0x7f,
-  0xcb, 0xea, 0x03, 0xac, 0xd6, 0xfe, 0xe1, 0x24, 0xb0, 0xfd, 0x47, 0xc5,
-  0xb7, 0x15, 0xd4, 0x24, 0xe4, 0x37, 0x41, 0x07, 0x31, 0x08, 0x12, 0xec,
-  0x0a, 0xfd, 0x3d, 0x4f, 0x12, 0x17, 0x59, 0x95, 0x9b, 0xa0, 0xf8, 0x39,
-  0xac, 0x32, 0xd4, 0xe0, 0x24, 0xf6, 0xdd, 0x2c, 0xaa, 0xd0, 0xd0, 0x09,
-  0xa5, 0x0c, 0x15, 0xda, 0xce, 0xd8, 0x56, 0x1d, 0x11, 0x02, 0xe0, 0x3b,
-  0x36, 0xc6, 0x5e, 0xdd, 0x50, 0x9c, 0xbc, 0xa8, 0x70, 0xf4, 0x2a, 0xcf,
-  0x96, 0x38, 0xeb, 0x2c, 0x37, 0x20, 0x34, 0x94, 0xff, 0xd9, 0xd7, 0xe6,
-  0xe8, 0x06, 0xfb, 0x7f, 0x3d, 0x10, 0xb6, 0xd6, 0xf5, 0xeb, 0x11, 0xdf,
-  0xfe, 0xbf, 0x29, 0x27, 0x01, 0x14, 0x79, 0xd8, 0xc4, 0x28, 0xfe, 0x0c,
-  0xbb, 0xfa, 0x02, 0x2b, 0x97, 0x24, 0xe0, 0xcf, 0x02, 0x2f, 0x15, 0xe5,
-  0x2f, 0xdd, 0x42, 0xbc, 0xfe, 0x12, 0x02, 0x7f, 0xfd, 0x01, 0x41, 0x18,
-  0xef, 0x37, 0xa8, 0x01, 0x2c, 0x08, 0x46, 0xff, 0xcd, 0xee, 0x1c, 0xd7,
-  0xc7, 0x59, 0x4e, 0x0e, 0xc3, 0xec, 0xbf, 0xcf, 0xdc, 0x3c, 0x2a, 0x1d,
-  0xfe, 0xcf, 0x1a, 0x0d, 0x45, 0x29, 0x04, 0x46, 0xad, 0xe6, 0x49, 0x87,
-  0xe4, 0x3a, 0x3f, 0xf9, 0x3f, 0xaa, 0xe0, 0x2f, 0xa3, 0x1c, 0x0d, 0xc8,
-  0x3d, 0x5b, 0xcd, 0xc9, 0xa6, 0x33, 0x1b, 0xba, 0xcf, 0xbb, 0x1f, 0x7a,
-  0x1e, 0x4b, 0xe6, 0x56, 0xce, 0x81, 0xf2, 0x47, 0x42, 0xa1, 0x76, 0xd5,
-  0xb0, 0x1a, 0x12, 0xd8, 0xda, 0x5e, 0xbb, 0x68, 0x6d, 0xfb, 0x3d, 0xd2,
-  0xe7, 0x39, 0x76, 0x48, 0xf3, 0xcf, 0x3c, 0x19, 0x06, 0xd0, 0xe1, 0x23,
-  0xbc, 0xeb, 0x6c, 0xc1, 0x3b, 0x4c, 0x3f, 0xba, 0xcd, 0xfb, 0x25, 0x26,
-  0xa2, 0x21, 0x36, 0xe8, 0x5a, 0x42, 0x0e, 0xfd, 0x97, 0xd6, 0x25, 0xc8,
-  0xfe, 0xe9, 0x11, 0x50, 0x02, 0x45, 0x0e, 0xc0, 0xff, 0x11, 0xfb, 0xfd,
-  0xef, 0xea, 0x68, 0xd6, 0xfd, 0xbf, 0x24, 0xa9, 0xe9, 0x42, 0xd0, 0x15,
-  0xd8, 0x18, 0x48, 0xc1, 0x1d, 0x3e, 0x7f, 0x04, 0x32, 0xdf, 0x3b, 0xe9,
-  0xd0, 0x0f, 0x04, 0xcb, 0x07, 0x1c, 0xc4, 0x3e, 0xb6, 0x11, 0xe7, 0xe1,
-  0xb6, 0xf5, 0x0a, 0xf2, 0xc3, 0x41, 0x03, 0xdf, 0x08, 0x1a, 0xf1, 0x07,
-  0xdb, 0x14, 0x1b, 0xd1, 0x1b, 0x14, 0xf0, 0xd3, 0x03, 0xf7, 0x0f, 0xbb,
-  0x54, 0xe5, 0xdf, 0xfb, 0x04, 0x22, 0xe4, 0x0f, 0xe7, 0x39, 0xfe, 0x0e,
-  0xca, 0xca, 0xea, 0x24, 0x1c, 0xb1, 0xdd, 0x7f, 0xec, 0xc9, 0xef, 0xc5,
-  0xcd, 0xdb, 0x5e, 0xec, 0x3a, 0xdd, 0x0a, 0x1b, 0xc5, 0xee, 0x48, 0x0e,
-  0xf4, 0xc4, 0x49, 0xc0, 0x48, 0xe1, 0xc6, 0x49, 0xfc, 0xb8, 0x4d, 0xd5,
-  0xb9, 0x60, 0x48, 0x17, 0xf6, 0xf1, 0xd0, 0xc1, 0xe7, 0xf9, 0xfd, 0x7f,
-  0x37, 0x09, 0xdd, 0x21, 0x1c, 0xb7, 0xa7, 0x50, 0x98, 0xcd, 0x59, 0xcc,
-  0x5a, 0x9a, 0x0a, 0xd1, 0x1f, 0x2c, 0xef, 0x40, 0xe8, 0xd7, 0xca, 0xc8,
-  0x01, 0x01, 0x57, 0x7c, 0xf5, 0x06, 0x01, 0x2b, 0xe5, 0xd0, 0xf8, 0x1f,
-  0xf9, 0x29, 0xd2, 0xeb, 0xde, 0xfa, 0xea, 0xeb, 0xff, 0xe1, 0xf7, 0xee,
-  0xf4, 0x15, 0xd7, 0x27, 0x0a, 0x25, 0x1e, 0xfa, 0xfb, 0x2b, 0xc0, 0xc9,
-  0x0c, 0xdd, 0xe2, 0xe4, 0xfc, 0x04, 0x0e, 0x13, 0x40, 0xe9, 0x0d, 0xf0,
-  0x02, 0x14, 0xe2, 0x33, 0x13, 0xd4, 0xde, 0xf8, 0xfe, 0xdb, 0x2b, 0x07,
-  0x20, 0xd0, 0x19, 0x7f, 0xe4, 0xdb, 0xef, 0xf9, 0x1d, 0xd3, 0x20, 0xb7,
-  0x43, 0xca, 0xbf, 0xf8, 0xb5, 0xf7, 0x64, 0x3b, 0x32, 0x4a, 0x14, 0xdb,
-  0x12, 0x59, 0x29, 0x26, 0xc5, 0xf5, 0xe1, 0x5a, 0x04, 0xe4, 0x2f, 0xc4,
-  0xe1, 0x12, 0x2d, 0xaf, 0xe7, 0xc2, 0xfd, 0x23, 0xeb, 0xe5, 0x3a, 0x98,
-  0xfb, 0x01, 0xfc, 0xbb, 0xa6, 0x3d, 0x54, 0x07, 0x3e, 0x50, 0x34, 0x33,
-  0xc8, 0xdc, 0x20, 0x7f, 0x2e, 0x3d, 0xf4, 0xcc, 0xd9, 0xde, 0x0b, 0x19,
-  0xd0, 0x44, 0xe6, 0x31, 0x9e, 0x53, 0x82, 0xbc, 0xa0, 0xc3, 0xe0, 0xf3,
-  0xf2, 0xd9, 0xd1, 0x73, 0x69, 0x19, 0xb3, 0x47, 0x45, 0xcf, 0x58, 0x3e,
-  0x42, 0xb7, 0x61, 0x1a, 0xd9, 0x33, 0x7f, 0x3d, 0x42, 0x24, 0x60, 0x44,
-  0x37, 0x6d, 0x11, 0x71, 0x0a, 0xed, 0xfe, 0xf0, 0x4f, 0xd5, 0x35, 0x1c,
-  0x8d, 0x5a, 0x21, 0xb4, 0xbd, 0x2a, 0x5e, 0xc0, 0xf7, 0xbe, 0xf0, 0xe5,
-  0x21, 0x49, 0xde, 0xdd, 0x99, 0x4e, 0x08, 0x04, 0xd6, 0x7f, 0x15, 0x1e,
-  0x86, 0xf1, 0xfd, 0x16, 0x01, 0x45, 0xd8, 0x44, 0x01, 0xef, 0xd4, 0x04,
-  0x0a, 0xe7, 0x3e, 0xc5, 0xcd, 0xeb, 0x4d, 0xe2, 0xe9, 0xf9, 0x16, 0x13,
-  0xfc, 0x1e, 0x5d, 0x05, 0x34, 0x3f, 0xe3, 0x36, 0xeb, 0x0d, 0x23, 0x2c,
-  0x5b, 0x1b, 0xfe, 0xe7, 0xe2, 0x04, 0x20, 0xb7, 0xdc, 0x22, 0xcf, 0xeb,
-  0xc7, 0x16, 0x1a, 0x08, 0x58, 0xe3, 0xed, 0xce, 0x0f, 0xe3, 0x1f, 0xf8,
-  0xd7, 0xd3, 0xee, 0xfc, 0xbd, 0x24, 0xc2, 0xe5, 0x2a, 0xa3, 0xdf, 0xe4,
-  0xbf, 0x20, 0xc2, 0x02, 0xf0, 0x7f, 0xc0, 0xff, 0xe9, 0x0a, 0x08, 0x00,
-  0x34, 0x20, 0xe3, 0x26, 0x3a, 0xc7, 0xe7, 0xd6, 0x06, 0xe4, 0xf9, 0x94,
-  0x36, 0xa8, 0xcc, 0xf3, 0xca, 0x03, 0xde, 0x20, 0xf9, 0xa6, 0xf0, 0x29,
-  0xc5, 0xdb, 0xd1, 0x48, 0x27, 0xf7, 0x47, 0x5f, 0xf8, 0xff, 0x01, 0xcb,
-  0xad, 0x0a, 0xdb, 0xbb, 0x63, 0xba, 0xe8, 0x4b, 0x3d, 0xf7, 0x58, 0xab,
-  0xfb, 0x1b, 0x2a, 0xeb, 0x27, 0x59, 0x59, 0x3b, 0x12, 0xcc, 0x07, 0x00,
-  0xfa, 0x17, 0x14, 0x3e, 0x83, 0xc1, 0xb0, 0x11, 0xc6, 0x8e, 0x1a, 0x4d,
-  0xba, 0xb5, 0xfa, 0x03, 0xde, 0x95, 0x4b, 0xba, 0xc4, 0x13, 0x5a, 0xbb,
-  0xd7, 0x01, 0x45, 0xb8, 0x55, 0x56, 0x03, 0x7f, 0x03, 0xd0, 0x27, 0xf9,
-  0xf6, 0xf4, 0x75, 0x5f, 0x10, 0x0c, 0xe2, 0xdf, 0x25, 0x1b, 0x16, 0xf1,
-  0xd6, 0xfd, 0xe6, 0x09, 0xf0, 0xf3, 0xe8, 0x52, 0x1f, 0xfe, 0xe7, 0xef,
-  0x32, 0x17, 0xfd, 0xe6, 0x0f, 0xa3, 0xdf, 0xff, 0xde, 0xbc, 0xd0, 0xe1,
-  0x08, 0x1b, 0x68, 0xe5, 0x47, 0xd9, 0xb6, 0xb8, 0x7f, 0xf7, 0xef, 0xd8,
-  0xea, 0x21, 0x07, 0x3f, 0xbb, 0xe8, 0x31, 0x08, 0xc1, 0xe5, 0xe0, 0xe2,
-  0xbf, 0x4e, 0x34, 0x03, 0x52, 0x10, 0xac, 0xec, 0xba, 0x18, 0xa9, 0x46,
-  0x4c, 0xdf, 0x97, 0xf0, 0x37, 0xf9, 0x71, 0x13, 0xda, 0x38, 0x23, 0xc2,
-  0xe1, 0xea, 0x0d, 0x1c, 0xc0, 0xde, 0xee, 0x25, 0x61, 0x65, 0x39, 0x0a,
-  0x96, 0x02, 0x8c, 0xd1, 0x9f, 0xa7, 0x12, 0x75, 0xa1, 0x0b, 0x0d, 0xbd,
-  0xef, 0x04, 0xb7, 0x57, 0xe3, 0xf4, 0x50, 0xcb, 0x40, 0xba, 0xf7, 0x04,
-  0xc6, 0x35, 0xfc, 0x7f, 0x4f, 0x20, 0x17, 0xcd, 0x2a, 0xff, 0x34, 0x31,
-  0xd8, 0xcb, 0xae, 0xe7, 0x08, 0x07, 0x1e, 0xfa, 0x43, 0xfb, 0x66, 0x01,
-  0x05, 0x30, 0x43, 0xfa, 0xe2, 0x08, 0xf2, 0x35, 0xb3, 0xfe, 0xf4, 0x3e,
-  0x1e, 0xec, 0xd2, 0xf8, 0xa0, 0xf8, 0xb3, 0x96, 0xda, 0x81, 0x27, 0x55,
-  0xea, 0x0c, 0x04, 0x12, 0x07, 0x95, 0xac, 0x4c, 0x38, 0xcd, 0x66, 0xee,
-  0x06, 0xdf, 0x2c, 0x55, 0x1e, 0xf8, 0x7a, 0x61, 0xdf, 0xbb, 0x61, 0xa7,
-  0xda, 0x15, 0x43, 0x6f, 0x12, 0x04, 0xd1, 0xeb, 0x02, 0x00, 0xf2, 0x29,
-  0xd6, 0x1d, 0xdb, 0x21, 0xe3, 0x30, 0xef, 0xf1, 0xc2, 0xdf, 0xe1, 0xfc,
-  0xdc, 0x2f, 0xd8, 0x02, 0x17, 0xed, 0x0a, 0x3f, 0xec, 0x21, 0x12, 0xe5,
-  0x08, 0xdc, 0xf8, 0xde, 0xf3, 0x0f, 0x0d, 0xf5, 0x14, 0xb2, 0x05, 0xd8,
-  0xdc, 0xf9, 0xec, 0x28, 0x2d, 0x20, 0xfe, 0xdc, 0x00, 0xe9, 0x14, 0x08,
-  0xe3, 0xda, 0xda, 0x7f, 0xe8, 0xf0, 0xcb, 0x0b, 0xf8, 0x14, 0x44, 0xdd,
-  0x47, 0xc9, 0xeb, 0x07, 0xb3, 0xd8, 0x44, 0x03, 0x2b, 0xa3, 0x6f, 0xcf,
-  0x45, 0x04, 0x4c, 0x30, 0x81, 0xeb, 0x30, 0xc0, 0x19, 0x30, 0xe4, 0xbf,
-  0x9e, 0xdf, 0xcd, 0xe7, 0xdf, 0xd4, 0x24, 0x4e, 0xc4, 0xc1, 0xe0, 0x10,
-  0xf6, 0xcd, 0x41, 0xe1, 0xb5, 0x25, 0x30, 0xd0, 0x00, 0x48, 0xb2, 0x06,
-  0x2c, 0x47, 0xc7, 0x1e, 0xd4, 0xfe, 0x11, 0xc6, 0x08, 0x27, 0x3e, 0xd6,
-  0xd2, 0xbc, 0x11, 0x0f, 0x38, 0x56, 0x19, 0xe7, 0xb7, 0xf4, 0x31, 0xaf,
-  0xdf, 0x43, 0x59, 0xbd, 0xa2, 0x19, 0x60, 0x54, 0x90, 0xb6, 0x05, 0x2c,
-  0xa6, 0xd3, 0x00, 0xf1, 0x82, 0x47, 0xbe, 0x91, 0xc7, 0x81, 0x20, 0x79,
-  0xde, 0xd4, 0xfc, 0xda, 0x08, 0xb2, 0x23, 0xed, 0xa2, 0x37, 0x3b, 0xbc,
-  0xf9, 0xc9, 0x0c, 0x01, 0x42, 0x09, 0x27, 0x76, 0x43, 0x2f, 0x58, 0xb8,
-  0xf6, 0xe3, 0x40, 0x70, 0x15, 0xca, 0xd4, 0x54, 0x51, 0xb0, 0x53, 0x39,
-  0x07, 0xf8, 0x7f, 0xbe, 0xfd, 0x28, 0x46, 0xdc, 0x00, 0xf7, 0x3e, 0x20,
-  0xb5, 0xc7, 0xbe, 0xee, 0xf1, 0x3c, 0xb4, 0xf5, 0xb8, 0xc5, 0x5a, 0xf8,
-  0xdb, 0xb9, 0x2e, 0x42, 0xc6, 0x38, 0x3b, 0xde, 0xeb, 0x5f, 0xd0, 0x11,
-  0x3b, 0xb0, 0x78, 0xf7, 0x35, 0xb1, 0xfb, 0xe6, 0x57, 0xfe, 0x5b, 0x37,
-  0x2d, 0xea, 0xe9, 0xec, 0x13, 0xd9, 0xf7, 0x69, 0x2c, 0xe1, 0x04, 0x11,
-  0xdc, 0xc5, 0x1e, 0x01, 0xd7, 0x13, 0xd8, 0x3f, 0x08, 0xf0, 0xf1, 0xe9,
-  0xfb, 0xdc, 0x0c, 0xe8, 0xf0, 0x42, 0xc3, 0x0e, 0x28, 0x26, 0xed, 0xd1,
-  0x17, 0xfc, 0xaa, 0xce, 0x1e, 0x06, 0x0b, 0xcc, 0x08, 0xc5, 0x1c, 0xba,
-  0x27, 0xc7, 0xc5, 0x08, 0xbf, 0x1f, 0xe7, 0x12, 0x36, 0xb0, 0x15, 0x2e,
-  0x0f, 0x09, 0x38, 0x14, 0x02, 0xd7, 0x2f, 0x7f, 0x0f, 0xe3, 0xbf, 0xff,
-  0x32, 0xfd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xb4, 0xff, 0xff, 0xff, 0x40, 0x07, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00,
-  0x78, 0xfd, 0xff, 0xff, 0xa8, 0xfb, 0xff, 0xff, 0xb2, 0x06, 0x00, 0x00,
-  0x07, 0xfc, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff, 0x31, 0x03, 0x00, 0x00,
-  0x3d, 0xfc, 0xff, 0xff, 0xef, 0x07, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x19, 0x0b, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0x83, 0x04, 0x00, 0x00,
-  0xc3, 0x00, 0x00, 0x00, 0xe9, 0xfd, 0xff, 0xff, 0xc5, 0x02, 0x00, 0x00,
-  0x5c, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0xd7, 0xfd, 0xff, 0xff,
-  0x99, 0xfd, 0xff, 0xff, 0xcd, 0xfb, 0xff, 0xff, 0x8c, 0xfe, 0xff, 0xff,
-  0xe7, 0xff, 0xff, 0xff, 0x25, 0x04, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0xd7, 0x01, 0x00, 0x00, 0xfd, 0xfe, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff,
-  0x4a, 0xfd, 0xff, 0xff, 0xba, 0x01, 0x00, 0x00, 0x48, 0xfe, 0xff, 0xff,
-  0x35, 0xfb, 0xff, 0xff, 0xb8, 0xfe, 0xff, 0xff, 0x98, 0x01, 0x00, 0x00,
-  0x13, 0x04, 0x00, 0x00, 0x9a, 0xf9, 0xff, 0xff, 0x1f, 0x07, 0x00, 0x00,
-  0x2b, 0x06, 0x00, 0x00, 0x98, 0xfa, 0xff, 0xff, 0x04, 0x03, 0x00, 0x00,
-  0xab, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00,
-  0xbc, 0xfd, 0xff, 0xff, 0x64, 0xfc, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff,
-  0x85, 0x05, 0x00, 0x00, 0xa9, 0xfe, 0xff, 0xff, 0x05, 0x05, 0x00, 0x00,
-  0x9a, 0x00, 0x00, 0x00, 0xde, 0xf9, 0xff, 0xff, 0x93, 0xfc, 0xff, 0xff,
-  0x06, 0x08, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00,
-  0x4a, 0x04, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00,
-  0x01, 0x03, 0x00, 0x00, 0xb9, 0x07, 0x00, 0x00, 0x1a, 0xfe, 0xff, 0xff,
-  0x90, 0x06, 0x00, 0x00, 0x3e, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0x00, 0x00, 0x00, 0x12, 0xb2, 0x89, 0x1e, 0xe8, 0xa1, 0xc4, 0x9c,
-  0x11, 0xb1, 0xfd, 0xdd, 0xdf, 0xc8, 0x92, 0x3e, 0xe2, 0xc3, 0xc2, 0x0c,
-  0x4e, 0x02, 0x11, 0x0d, 0xb1, 0x82, 0x1f, 0xc0, 0x46, 0xb1, 0x48, 0x24,
-  0x52, 0x23, 0xa9, 0xb7, 0xb5, 0xe7, 0x15, 0xeb, 0x48, 0xca, 0x27, 0xd7,
-  0x30, 0xe9, 0xa5, 0xc0, 0xc7, 0xcc, 0xdc, 0xab, 0x18, 0x1c, 0x88, 0xc1,
-  0x4b, 0xad, 0x94, 0xe1, 0xf2, 0xc0, 0xc1, 0x93, 0xe1, 0x5a, 0xbe, 0xb7,
-  0xb6, 0x3d, 0xa9, 0xc9, 0x1d, 0xb1, 0x53, 0x97, 0x7e, 0xf0, 0x1e, 0xfb,
-  0x96, 0x7e, 0xa9, 0x28, 0xf9, 0xb2, 0xe5, 0xc5, 0x18, 0x5d, 0xf3, 0x75,
-  0x10, 0x9d, 0xed, 0x07, 0xff, 0xbd, 0x05, 0xf1, 0xbb, 0xba, 0x62, 0x52,
-  0xbb, 0xfb, 0x05, 0xb0, 0x32, 0xc1, 0x9e, 0xb8, 0x68, 0xa4, 0x4b, 0xf7,
-  0xb2, 0xc9, 0x53, 0xe5, 0x17, 0xc9, 0xcc, 0x7f, 0x9e, 0xca, 0x94, 0x7a,
-  0x15, 0xdd, 0x15, 0xc5, 0x6c, 0x38, 0xfa, 0x57, 0xba, 0x29, 0xb7, 0x3b,
-  0xbb, 0x4c, 0x69, 0xa7, 0x41, 0xe5, 0x30, 0xd7, 0xdd, 0x6a, 0x68, 0x15,
-  0x43, 0x0a, 0xf2, 0xcb, 0xb1, 0x63, 0xed, 0xc8, 0xd0, 0xfc, 0x52, 0x4d,
-  0x2b, 0x3c, 0xaf, 0xc4, 0x0e, 0x5d, 0xcc, 0x43, 0xad, 0x35, 0x65, 0x4d,
-  0xd5, 0x5c, 0xe1, 0x64, 0xee, 0xf3, 0xe6, 0x4c, 0xca, 0x49, 0x45, 0xf3,
-  0x45, 0x3d, 0x54, 0xc6, 0x0a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0x75, 0xff, 0xff, 0xff,
-  0x72, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-  0x36, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x84, 0xa8, 0xff, 0xff, 0x88, 0xa8, 0xff, 0xff,
-  0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e,
-  0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00,
-  0xf8, 0x03, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0xb8, 0x03, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
-  0xa0, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00,
-  0xc8, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
-  0xf0, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0xff, 0xff,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
-  0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0x1e, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x68, 0xa9, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf6, 0xfc, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x72, 0xfd, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xc2, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x68, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x4a, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf0, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x8e, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xe2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x5a, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x2c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x28, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x80, 0x53, 0x00, 0x00,
-  0x14, 0x53, 0x00, 0x00, 0xa8, 0x52, 0x00, 0x00, 0x38, 0x52, 0x00, 0x00,
-  0xd4, 0x51, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x9c, 0x4a, 0x00, 0x00,
-  0x90, 0x46, 0x00, 0x00, 0x74, 0x42, 0x00, 0x00, 0x88, 0x3e, 0x00, 0x00,
-  0x24, 0x3b, 0x00, 0x00, 0x18, 0x37, 0x00, 0x00, 0x10, 0x33, 0x00, 0x00,
-  0x20, 0x2f, 0x00, 0x00, 0xbc, 0x2b, 0x00, 0x00, 0xb0, 0x27, 0x00, 0x00,
-  0xa8, 0x23, 0x00, 0x00, 0xb8, 0x1f, 0x00, 0x00, 0x54, 0x1c, 0x00, 0x00,
-  0x50, 0x18, 0x00, 0x00, 0x48, 0x14, 0x00, 0x00, 0x68, 0x10, 0x00, 0x00,
-  0x04, 0x0d, 0x00, 0x00, 0x78, 0x0c, 0x00, 0x00, 0x64, 0x0b, 0x00, 0x00,
-  0x28, 0x0a, 0x00, 0x00, 0x0c, 0x09, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00,
-  0xb4, 0x06, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00,
-  0x20, 0x03, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
-  0x0c, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x2a, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x14, 0xad, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x3b, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0xa2, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x8c, 0xad, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x43, 0x8a, 0xa3, 0x3e, 0x26, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x2a, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
-  0x14, 0xae, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x21, 0x3e, 0x1a, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xa2, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x94, 0xae, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x21, 0x3e, 0x1f, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67,
-  0x65, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x2f,
-  0x41, 0x76, 0x67, 0x50, 0x6f, 0x6f, 0x6c, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x32, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0xaf, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0xe9, 0x21, 0x3e, 0x93, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x32, 0xb0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x24, 0xb0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x91, 0x9a, 0xff, 0x3d, 0xca, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x37, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x6a, 0xb1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x5c, 0xb1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x6f, 0xe5, 0x38, 0x3d, 0xa9, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x36, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x82, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x74, 0xb2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x38, 0x88, 0x3d,
-  0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x35, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x35, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xba, 0xb3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xac, 0xb3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x95, 0x5e, 0x54, 0x3d,
-  0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x34, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x34, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xd2, 0xb4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc4, 0xb4, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x9a, 0x43, 0x9d, 0x3d, 0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x0a, 0xb6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xfc, 0xb5, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xfa, 0x03, 0x1e, 0x3d, 0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x22, 0xb7, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x14, 0xb7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0xb3, 0x21, 0x3d,
-  0xc4, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34,
-  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5a, 0xb8, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xe0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x4c, 0xb8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfe, 0x8e, 0xd8, 0x3c,
-  0x9f, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72,
-  0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x6a, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5c, 0xb9, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x6e, 0x7e, 0xc6, 0x3d, 0x18, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5a, 0xba, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00,
-  0xcc, 0xb9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3a, 0x33, 0x63, 0x39,
-  0x29, 0x40, 0xa0, 0x39, 0x62, 0xf2, 0xbb, 0x39, 0x84, 0x95, 0x10, 0x3a,
-  0x38, 0xc0, 0xc1, 0x39, 0xc3, 0x19, 0xef, 0x39, 0x2f, 0x0c, 0x22, 0x39,
-  0xf8, 0x31, 0xce, 0x39, 0x07, 0x40, 0x48, 0x39, 0x0f, 0x22, 0xad, 0x39,
-  0x85, 0x4d, 0xbf, 0x39, 0x22, 0xdd, 0x84, 0x39, 0x36, 0x8d, 0x6f, 0x3a,
-  0x90, 0xc9, 0xa1, 0x3a, 0x92, 0x9e, 0x27, 0x39, 0xe9, 0xf8, 0x9f, 0x39,
-  0x27, 0x50, 0x61, 0x39, 0xe8, 0xb3, 0x8b, 0x39, 0x09, 0xe6, 0xd7, 0x39,
-  0xb7, 0x47, 0x21, 0x39, 0x70, 0xfd, 0x63, 0x3a, 0x09, 0xf2, 0x2a, 0x39,
-  0x08, 0x02, 0x12, 0x3a, 0x03, 0x2c, 0xc6, 0x39, 0x6b, 0x44, 0x88, 0x39,
-  0xb5, 0xf4, 0x9f, 0x39, 0xa7, 0xad, 0xdc, 0x39, 0x0d, 0xe6, 0x0b, 0x39,
-  0x5d, 0x63, 0xe7, 0x39, 0x96, 0x89, 0x2c, 0x39, 0x4c, 0x57, 0x2e, 0x3a,
-  0xe0, 0x42, 0x30, 0x39, 0x7e, 0xcd, 0xae, 0x39, 0x6f, 0x8d, 0xef, 0x39,
-  0x64, 0xc9, 0xb4, 0x39, 0x32, 0xfd, 0x1f, 0x39, 0xd6, 0x90, 0xc0, 0x39,
-  0x10, 0x49, 0x52, 0x39, 0xff, 0xa0, 0x90, 0x39, 0xc9, 0x41, 0xaa, 0x39,
-  0xe6, 0xe7, 0x56, 0x39, 0xc6, 0xa8, 0x28, 0x39, 0x95, 0xcb, 0x33, 0x39,
-  0xab, 0x16, 0x5b, 0x39, 0x95, 0x3f, 0xe4, 0x39, 0xc9, 0xc8, 0xaf, 0x39,
-  0xcd, 0xbe, 0xd7, 0x39, 0xa8, 0x91, 0x0e, 0x39, 0xf1, 0x72, 0x5e, 0x3a,
-  0x08, 0xbc, 0xef, 0x38, 0x8e, 0x13, 0x4f, 0x39, 0x91, 0x88, 0x92, 0x39,
-  0x59, 0x0d, 0x1c, 0x39, 0x1d, 0x4b, 0x92, 0x39, 0xcc, 0xd5, 0xfb, 0x39,
-  0x8e, 0x47, 0x9f, 0x39, 0xf5, 0xa0, 0x85, 0x39, 0x61, 0xc1, 0xaf, 0x39,
-  0x19, 0xf0, 0x85, 0x39, 0xd8, 0xf8, 0x24, 0x3a, 0xd3, 0xbb, 0xec, 0x39,
-  0x8a, 0x09, 0xb4, 0x39, 0x3f, 0x2e, 0xd7, 0x39, 0x82, 0xc0, 0xb2, 0x39,
-  0x13, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0x03, 0x00, 0x00,
-  0x2c, 0xbd, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xd4, 0x29, 0xb0, 0x37, 0x88, 0x81, 0xf8, 0x37,
-  0x4a, 0xba, 0x11, 0x38, 0x18, 0x36, 0x60, 0x38, 0x5b, 0x3a, 0x16, 0x38,
-  0x02, 0x64, 0x39, 0x38, 0xe8, 0x4a, 0x7b, 0x37, 0x7b, 0xe0, 0x1f, 0x38,
-  0x6b, 0x44, 0x9b, 0x37, 0xd9, 0x3d, 0x06, 0x38, 0x6f, 0x54, 0x14, 0x38,
-  0x4c, 0x09, 0xce, 0x37, 0x86, 0xbd, 0xb9, 0x38, 0x98, 0xe3, 0xfa, 0x38,
-  0x6d, 0xf7, 0x81, 0x37, 0x0b, 0x13, 0xf8, 0x37, 0x44, 0xb3, 0xae, 0x37,
-  0x48, 0xa4, 0xd8, 0x37, 0x8b, 0x66, 0x27, 0x38, 0x3c, 0x1a, 0x7a, 0x37,
-  0x9d, 0xc6, 0xb0, 0x38, 0xa0, 0x8b, 0x84, 0x37, 0x5c, 0x6b, 0x62, 0x38,
-  0xe9, 0xa7, 0x19, 0x38, 0x6e, 0x50, 0xd3, 0x37, 0x86, 0x0c, 0xf8, 0x37,
-  0x4b, 0x1b, 0x2b, 0x38, 0x0b, 0xf2, 0x58, 0x37, 0x20, 0x69, 0x33, 0x38,
-  0xa0, 0xc7, 0x85, 0x37, 0x9f, 0x2d, 0x87, 0x38, 0xc6, 0xaa, 0x88, 0x37,
-  0x44, 0x89, 0x07, 0x38, 0xb2, 0xbd, 0x39, 0x38, 0x0c, 0x2d, 0x0c, 0x38,
-  0xb0, 0x19, 0x78, 0x37, 0x20, 0x4f, 0x15, 0x38, 0x5d, 0x0c, 0xa3, 0x37,
-  0xe5, 0x47, 0xe0, 0x37, 0xf7, 0x02, 0x04, 0x38, 0x7e, 0xa1, 0xa6, 0x37,
-  0xd5, 0xc5, 0x82, 0x37, 0x41, 0x68, 0x8b, 0x37, 0xbc, 0xdf, 0xa9, 0x37,
-  0xe7, 0xf9, 0x30, 0x38, 0x1c, 0x4c, 0x08, 0x38, 0x1f, 0x48, 0x27, 0x38,
-  0x22, 0x16, 0x5d, 0x37, 0xc3, 0x7a, 0xac, 0x38, 0xd4, 0xe1, 0x39, 0x37,
-  0x64, 0x8f, 0xa0, 0x37, 0xfd, 0x3b, 0xe3, 0x37, 0xc9, 0xfe, 0x71, 0x37,
-  0xb1, 0xdc, 0xe2, 0x37, 0xbb, 0x43, 0x43, 0x38, 0x03, 0x00, 0xf7, 0x37,
-  0xf8, 0x38, 0xcf, 0x37, 0x5e, 0x46, 0x08, 0x38, 0xb2, 0xb3, 0xcf, 0x37,
-  0xe1, 0xd3, 0x7f, 0x38, 0x2f, 0x8e, 0x37, 0x38, 0x4b, 0x98, 0x0b, 0x38,
-  0x0a, 0xd8, 0x26, 0x38, 0x2c, 0x99, 0x0a, 0x38, 0x9e, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x2f,
-  0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62,
-  0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69,
-  0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x96, 0xc1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x2c, 0x03, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xd8, 0x03, 0x00, 0x00, 0x02, 0xd2, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xaa, 0x8b, 0xa0, 0x3b, 0x9b, 0x95, 0x99, 0x3b,
-  0x2a, 0x43, 0x4a, 0x3c, 0xc9, 0x42, 0x6f, 0x3c, 0x62, 0x78, 0x0e, 0x3c,
-  0x7c, 0x1f, 0xc3, 0x3b, 0xfe, 0x57, 0xd9, 0x3b, 0xee, 0xab, 0xf1, 0x3b,
-  0xaf, 0x0f, 0x01, 0x3c, 0xa2, 0xa3, 0x9c, 0x3c, 0xc1, 0x93, 0x1a, 0x3c,
-  0xf9, 0xb4, 0x07, 0x3c, 0xb6, 0x02, 0x86, 0x3c, 0x25, 0xfb, 0x5f, 0x3c,
-  0xa8, 0x21, 0x25, 0x3c, 0x80, 0x34, 0xfe, 0x3b, 0xf7, 0xdd, 0x19, 0x3c,
-  0x3e, 0xf9, 0x88, 0x3c, 0xd5, 0x3d, 0x69, 0x3c, 0xd5, 0xb9, 0xe9, 0x3b,
-  0xab, 0x8b, 0x23, 0x3c, 0xf7, 0x7d, 0xe9, 0x3b, 0xb5, 0xb1, 0x2c, 0x3c,
-  0x04, 0xa9, 0x0f, 0x3c, 0xbe, 0xae, 0x5d, 0x3c, 0x9e, 0xf6, 0x40, 0x3c,
-  0xbf, 0x25, 0x2d, 0x3c, 0x08, 0x67, 0x79, 0x3c, 0x15, 0x59, 0x17, 0x3c,
-  0x65, 0xc8, 0xf6, 0x3b, 0xe3, 0xe4, 0x16, 0x3c, 0x9d, 0x92, 0xd1, 0x3b,
-  0x6a, 0x35, 0x37, 0x3c, 0x08, 0xa7, 0x0a, 0x3c, 0x3e, 0x37, 0x58, 0x3c,
-  0x28, 0x4b, 0xc0, 0x3b, 0x7a, 0x23, 0x5a, 0x3c, 0xfa, 0xd0, 0x4d, 0x3c,
-  0x48, 0xa7, 0x48, 0x3c, 0x5d, 0xca, 0x2e, 0x3c, 0xbd, 0xc7, 0x02, 0x3c,
-  0x64, 0x85, 0x36, 0x3c, 0x8c, 0x2e, 0x0e, 0x3c, 0xdf, 0x15, 0x84, 0x3c,
-  0x3d, 0x25, 0x13, 0x3c, 0x46, 0x7f, 0xa7, 0x3b, 0xdb, 0xd8, 0x17, 0x3c,
-  0x6b, 0x62, 0xd9, 0x3b, 0x35, 0x7e, 0x41, 0x3c, 0xfb, 0xeb, 0x80, 0x3b,
-  0x5f, 0x8e, 0x0a, 0x3c, 0x56, 0xfb, 0xbe, 0x3b, 0x6e, 0xa7, 0xbe, 0x3b,
-  0x32, 0x6c, 0xf0, 0x3b, 0x63, 0x4e, 0xdb, 0x3b, 0x86, 0x35, 0x66, 0x3c,
-  0x2f, 0x59, 0x72, 0x3b, 0x67, 0xa8, 0x0e, 0x3c, 0xcf, 0x02, 0xf5, 0x3b,
-  0x37, 0x4e, 0x0f, 0x3c, 0x4a, 0xa4, 0xda, 0x3b, 0xaa, 0x4d, 0xe1, 0x3b,
-  0x90, 0xb2, 0x42, 0x3c, 0x74, 0x9e, 0xeb, 0x3b, 0xb0, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9a, 0xc5, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe0, 0x03, 0x00, 0x00,
-  0x0c, 0xc5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x84, 0xcf, 0x07, 0x39, 0x04, 0xec, 0x01, 0x39,
-  0xa5, 0x19, 0xab, 0x39, 0xfe, 0x65, 0xca, 0x39, 0x4e, 0x0a, 0x71, 0x39,
-  0x8e, 0x0f, 0x25, 0x39, 0xa5, 0xdb, 0x37, 0x39, 0x0e, 0x70, 0x4c, 0x39,
-  0xa5, 0x5a, 0x5a, 0x39, 0x8f, 0x81, 0x04, 0x3a, 0x02, 0xc3, 0x82, 0x39,
-  0xfe, 0x98, 0x65, 0x39, 0x48, 0xba, 0xe2, 0x39, 0x03, 0x79, 0xbd, 0x39,
-  0xa2, 0xb0, 0x8b, 0x39, 0x49, 0x0a, 0x57, 0x39, 0x3a, 0x29, 0x82, 0x39,
-  0x9d, 0xbd, 0xe7, 0x39, 0x73, 0x4e, 0xc5, 0x39, 0x59, 0xb7, 0x45, 0x39,
-  0x32, 0x59, 0x8a, 0x39, 0xb4, 0x84, 0x45, 0x39, 0x67, 0x16, 0x92, 0x39,
-  0xb3, 0x0d, 0x73, 0x39, 0x43, 0x87, 0xbb, 0x39, 0xde, 0x3b, 0xa3, 0x39,
-  0x90, 0x78, 0x92, 0x39, 0x3d, 0xfa, 0xd2, 0x39, 0xb3, 0x07, 0x80, 0x39,
-  0xed, 0xc2, 0x50, 0x39, 0xd0, 0x4a, 0x7f, 0x39, 0xc4, 0x48, 0x31, 0x39,
-  0x67, 0xfb, 0x9a, 0x39, 0xc2, 0x94, 0x6a, 0x39, 0x61, 0xe7, 0xb6, 0x39,
-  0xd2, 0xaa, 0x22, 0x39, 0xc7, 0x87, 0xb8, 0x39, 0x49, 0x1b, 0xae, 0x39,
-  0x39, 0xbd, 0xa9, 0x39, 0x60, 0xdc, 0x93, 0x39, 0x28, 0x43, 0x5d, 0x39,
-  0x7f, 0x66, 0x9a, 0x39, 0x62, 0x8d, 0x70, 0x39, 0x77, 0x78, 0xdf, 0x39,
-  0x38, 0xf3, 0x78, 0x39, 0xf2, 0xb0, 0x0d, 0x39, 0xca, 0x73, 0x80, 0x39,
-  0x77, 0xe4, 0x37, 0x39, 0x91, 0xae, 0xa3, 0x39, 0x3d, 0x1e, 0xda, 0x38,
-  0x09, 0x6b, 0x6a, 0x39, 0xbd, 0x8e, 0x21, 0x39, 0xc3, 0x47, 0x21, 0x39,
-  0x95, 0x61, 0x4b, 0x39, 0xa3, 0x84, 0x39, 0x39, 0xbf, 0xbd, 0xc2, 0x39,
-  0x9e, 0x02, 0xcd, 0x38, 0x8c, 0x5b, 0x71, 0x39, 0x39, 0x43, 0x4f, 0x39,
-  0x14, 0x74, 0x72, 0x39, 0xbf, 0xf4, 0x38, 0x39, 0x60, 0x97, 0x3e, 0x39,
-  0x6a, 0xb3, 0xa4, 0x39, 0x4e, 0x51, 0x47, 0x39, 0xc3, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x9a, 0xc9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x34, 0x03, 0x00, 0x00, 0x0c, 0xc9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf0, 0x8b, 0x1a, 0x3b,
-  0x7c, 0xc4, 0x46, 0x3b, 0xa7, 0x3e, 0x7d, 0x3b, 0xd4, 0x08, 0x6b, 0x3b,
-  0x61, 0x61, 0x26, 0x3b, 0xaf, 0x3c, 0x0c, 0x3b, 0xca, 0xc6, 0x50, 0x3b,
-  0x7b, 0x7f, 0x48, 0x3b, 0x6b, 0x79, 0x5e, 0x3b, 0xfc, 0x69, 0x3f, 0x3b,
-  0x86, 0x57, 0x18, 0x3b, 0x78, 0x3c, 0x51, 0x3b, 0xc2, 0xec, 0x8c, 0x3b,
-  0xa4, 0x13, 0x90, 0x3b, 0xcd, 0x7f, 0x66, 0x3b, 0x98, 0x2e, 0x29, 0x3b,
-  0x17, 0xec, 0x4f, 0x3b, 0x87, 0x72, 0x7c, 0x3b, 0x09, 0xfc, 0x2c, 0x3b,
-  0x61, 0x3e, 0x8e, 0x3b, 0x64, 0xb4, 0x34, 0x3b, 0x48, 0x67, 0x12, 0x3b,
-  0x88, 0x81, 0x3d, 0x3b, 0x94, 0x3d, 0xec, 0x3a, 0xdb, 0xcc, 0x3d, 0x3b,
-  0x6e, 0x16, 0x25, 0x3b, 0x19, 0xc4, 0x7b, 0x3b, 0x9c, 0xf8, 0x68, 0x3b,
-  0x7e, 0x22, 0x80, 0x3b, 0x25, 0x2e, 0x1b, 0x3b, 0xd2, 0xd0, 0x94, 0x3b,
-  0x3b, 0x23, 0x8a, 0x3b, 0x78, 0x16, 0x41, 0x3b, 0x15, 0x66, 0xab, 0x3b,
-  0xfd, 0x31, 0x3e, 0x3b, 0x84, 0x46, 0x1a, 0x3b, 0xa0, 0x61, 0x72, 0x3b,
-  0xbe, 0xad, 0x86, 0x3b, 0x37, 0xf5, 0x86, 0x3b, 0x08, 0x15, 0x94, 0x3b,
-  0x4f, 0x08, 0x58, 0x3b, 0x2a, 0x1c, 0x81, 0x3b, 0x1b, 0x8c, 0x0d, 0x3b,
-  0x79, 0x7f, 0x4c, 0x3b, 0x2e, 0xe9, 0x57, 0x3b, 0x30, 0xab, 0x6f, 0x3b,
-  0x36, 0x29, 0x2f, 0x3b, 0x6e, 0xe3, 0x5e, 0x3b, 0x93, 0xea, 0x42, 0x3b,
-  0x06, 0xcf, 0x49, 0x3b, 0xb0, 0x5f, 0x83, 0x3b, 0x39, 0xf3, 0xf3, 0x3a,
-  0xc4, 0xb6, 0x7e, 0x3b, 0xdf, 0x5d, 0x07, 0x3b, 0xfb, 0xc7, 0x0b, 0x3b,
-  0x71, 0x62, 0x1b, 0x3b, 0xba, 0xa9, 0x4c, 0x3b, 0x27, 0xef, 0x37, 0x3b,
-  0x02, 0x2f, 0x13, 0x3b, 0x80, 0x2c, 0x99, 0x3b, 0x7c, 0x88, 0x76, 0x3b,
-  0x8f, 0x2d, 0x21, 0x3b, 0x21, 0xbc, 0x9c, 0x3b, 0xb4, 0x0a, 0x1a, 0x3b,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xfa, 0xcc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xcc, 0x03, 0x00, 0x00, 0x6c, 0xcc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x5b, 0x3c, 0xc3, 0x38, 0x62, 0x19, 0xfb, 0x38, 0xa7, 0xf5, 0x1f, 0x39,
-  0x0f, 0x75, 0x14, 0x39, 0x64, 0x2f, 0xd2, 0x38, 0xa3, 0x28, 0xb1, 0x38,
-  0x26, 0xdf, 0x03, 0x39, 0x03, 0x49, 0xfd, 0x38, 0x13, 0x86, 0x0c, 0x39,
-  0x42, 0xcf, 0xf1, 0x38, 0x58, 0x73, 0xc0, 0x38, 0x7a, 0x29, 0x04, 0x39,
-  0x12, 0x07, 0x32, 0x39, 0x64, 0x02, 0x36, 0x39, 0xb5, 0x97, 0x11, 0x39,
-  0x6f, 0xb9, 0xd5, 0x38, 0x02, 0x55, 0x03, 0x39, 0xb8, 0x74, 0x1f, 0x39,
-  0x2a, 0x87, 0xda, 0x38, 0x94, 0xb1, 0x33, 0x39, 0xdb, 0x47, 0xe4, 0x38,
-  0xda, 0xf2, 0xb8, 0x38, 0x34, 0x66, 0xef, 0x38, 0x14, 0x38, 0x95, 0x38,
-  0x5c, 0xc5, 0xef, 0x38, 0x4f, 0x8d, 0xd0, 0x38, 0x8b, 0x06, 0x1f, 0x39,
-  0x6a, 0x27, 0x13, 0x39, 0xc1, 0xde, 0x21, 0x39, 0x45, 0x09, 0xc4, 0x38,
-  0xfa, 0xfe, 0x3b, 0x39, 0xaf, 0x81, 0x2e, 0x39, 0x8e, 0xec, 0xf3, 0x38,
-  0x55, 0x86, 0x58, 0x39, 0x1e, 0x45, 0xf0, 0x38, 0xa8, 0xe4, 0xc2, 0x38,
-  0x0b, 0x19, 0x19, 0x39, 0x10, 0x23, 0x2a, 0x39, 0x5b, 0x7d, 0x2a, 0x39,
-  0xbf, 0x11, 0x3b, 0x39, 0x6e, 0x74, 0x08, 0x39, 0x29, 0x1a, 0x23, 0x39,
-  0x5f, 0xd0, 0xb2, 0x38, 0x4d, 0x2b, 0x01, 0x39, 0xc5, 0x60, 0x08, 0x39,
-  0x69, 0x62, 0x17, 0x39, 0x09, 0x47, 0xdd, 0x38, 0x09, 0xc9, 0x0c, 0x39,
-  0xe7, 0x3b, 0xf6, 0x38, 0xe6, 0xf0, 0xfe, 0x38, 0x42, 0xf6, 0x25, 0x39,
-  0xb6, 0x16, 0x9a, 0x38, 0x39, 0xe3, 0x20, 0x39, 0x90, 0x01, 0xab, 0x38,
-  0x36, 0x95, 0xb0, 0x38, 0x56, 0x4b, 0xc4, 0x38, 0xfd, 0x45, 0x01, 0x39,
-  0x4a, 0x5c, 0xe8, 0x38, 0x29, 0xef, 0xb9, 0x38, 0x64, 0x80, 0x41, 0x39,
-  0x64, 0xb8, 0x1b, 0x39, 0xee, 0x9c, 0xcb, 0x38, 0x09, 0x00, 0x46, 0x39,
-  0x19, 0x99, 0xc2, 0x38, 0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xe6, 0xd0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00,
-  0x52, 0xe1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x42, 0x46, 0xa9, 0x3b,
-  0xbb, 0x41, 0x0f, 0x3c, 0x4d, 0x60, 0x07, 0x3c, 0xc8, 0x82, 0x26, 0x3c,
-  0x03, 0xeb, 0x45, 0x3c, 0xb1, 0xf4, 0x0e, 0x3c, 0xd8, 0x8d, 0x1a, 0x3c,
-  0x1c, 0x1d, 0x0b, 0x3c, 0xe8, 0x44, 0xcd, 0x3b, 0x85, 0x0d, 0xd4, 0x3b,
-  0x1b, 0x7c, 0xc9, 0x3b, 0x8e, 0xae, 0x27, 0x3c, 0xb5, 0x1c, 0x78, 0x3b,
-  0xe8, 0x66, 0x07, 0x3c, 0xad, 0x79, 0x10, 0x3c, 0x23, 0xc3, 0x12, 0x3c,
-  0xd4, 0xf8, 0x1f, 0x3c, 0x02, 0x7f, 0x3f, 0x3c, 0x8b, 0x18, 0x19, 0x3c,
-  0x07, 0x24, 0xd9, 0x3b, 0xa4, 0xa2, 0x59, 0x3c, 0x8f, 0x19, 0xba, 0x3b,
-  0x33, 0xfb, 0xc0, 0x3b, 0xa6, 0x36, 0x91, 0x3b, 0xb3, 0x45, 0x49, 0x3c,
-  0x21, 0x10, 0x0a, 0x3c, 0xca, 0x6d, 0xfb, 0x3b, 0x55, 0xfa, 0x58, 0x3c,
-  0xb8, 0x5d, 0xb0, 0x3b, 0xb5, 0x6c, 0x18, 0x3c, 0xb2, 0xf0, 0x07, 0x3c,
-  0x4b, 0x88, 0x95, 0x3b, 0xc9, 0xd7, 0x44, 0x3c, 0x12, 0x63, 0x03, 0x3c,
-  0x06, 0x20, 0x33, 0x3c, 0x1e, 0x8d, 0x9e, 0x3b, 0x48, 0x43, 0xb1, 0x3b,
-  0x75, 0x12, 0xf4, 0x3b, 0x92, 0x77, 0x65, 0x3b, 0x8f, 0xd2, 0x82, 0x3c,
-  0x2a, 0x57, 0x33, 0x3c, 0xe4, 0xa0, 0xa0, 0x3c, 0x82, 0x9f, 0xfb, 0x3b,
-  0x60, 0x5a, 0x02, 0x3c, 0x6a, 0x7d, 0x0b, 0x3c, 0x78, 0x55, 0xd4, 0x3b,
-  0xfb, 0x81, 0x16, 0x3c, 0xee, 0x98, 0xdd, 0x3b, 0x50, 0x81, 0x87, 0x3c,
-  0xcd, 0xa1, 0x17, 0x3c, 0x59, 0x8a, 0x7b, 0x3c, 0xd9, 0x79, 0xdd, 0x3b,
-  0xb0, 0xd1, 0x01, 0x3c, 0xf6, 0xd1, 0xe5, 0x3b, 0xd6, 0xed, 0xce, 0x3b,
-  0x89, 0x44, 0x11, 0x3c, 0x56, 0xd8, 0xbc, 0x3b, 0xc9, 0x48, 0xf1, 0x3b,
-  0x5e, 0x88, 0x4c, 0x3c, 0x70, 0x3c, 0x68, 0x3c, 0xd4, 0xb3, 0xc4, 0x3b,
-  0x75, 0x23, 0x03, 0x3c, 0xe4, 0xd8, 0x65, 0x3c, 0xce, 0x3a, 0x13, 0x3c,
-  0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x31, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xea, 0xd4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00, 0x5c, 0xd4, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xfc, 0xf7, 0x50, 0x39, 0x96, 0xd9, 0xb0, 0x39, 0x14, 0x1f, 0xa7, 0x39,
-  0x9b, 0x8e, 0xcd, 0x39, 0x3e, 0x54, 0xf4, 0x39, 0x7b, 0x7a, 0xb0, 0x39,
-  0xe4, 0xcb, 0xbe, 0x39, 0x41, 0xbc, 0xab, 0x39, 0x6f, 0x67, 0x7d, 0x39,
-  0xa3, 0xe3, 0x82, 0x39, 0x74, 0xbb, 0x78, 0x39, 0xad, 0x00, 0xcf, 0x39,
-  0x92, 0x25, 0x19, 0x39, 0x3b, 0x27, 0xa7, 0x39, 0xaf, 0x5a, 0xb2, 0x39,
-  0x6e, 0x2d, 0xb5, 0x39, 0x1e, 0x7c, 0xc5, 0x39, 0xb9, 0x66, 0xec, 0x39,
-  0x0d, 0xff, 0xbc, 0x39, 0x9c, 0x07, 0x86, 0x39, 0xc3, 0x55, 0x06, 0x3a,
-  0x55, 0xbd, 0x65, 0x39, 0x12, 0x3c, 0x6e, 0x39, 0xf8, 0x43, 0x33, 0x39,
-  0x4a, 0x78, 0xf8, 0x39, 0x33, 0x70, 0xaa, 0x39, 0xaa, 0x31, 0x9b, 0x39,
-  0xdf, 0xed, 0x05, 0x3a, 0x2a, 0xb9, 0x59, 0x39, 0xec, 0x2a, 0xbc, 0x39,
-  0x55, 0xd1, 0xa7, 0x39, 0xe2, 0x98, 0x38, 0x39, 0x7a, 0x00, 0xf3, 0x39,
-  0x5f, 0x32, 0xa2, 0x39, 0x18, 0x21, 0xdd, 0x39, 0x1e, 0xbb, 0x43, 0x39,
-  0x8f, 0xd4, 0x5a, 0x39, 0x2f, 0xa7, 0x96, 0x39, 0x5d, 0xa3, 0x0d, 0x39,
-  0xf9, 0x7f, 0x21, 0x3a, 0x2a, 0x65, 0xdd, 0x39, 0x97, 0x4b, 0x46, 0x3a,
-  0x5b, 0x50, 0x9b, 0x39, 0x9b, 0xeb, 0xa0, 0x39, 0x24, 0x33, 0xac, 0x39,
-  0x0c, 0x10, 0x83, 0x39, 0x1f, 0xcd, 0xb9, 0x39, 0xd4, 0xc7, 0x88, 0x39,
-  0xd4, 0x47, 0x27, 0x3a, 0x6f, 0x30, 0xbb, 0x39, 0x4b, 0x43, 0x1b, 0x3a,
-  0xa5, 0xb4, 0x88, 0x39, 0xde, 0x42, 0xa0, 0x39, 0x28, 0xdb, 0x8d, 0x39,
-  0x02, 0x74, 0x7f, 0x39, 0x1c, 0x55, 0xb3, 0x39, 0xe8, 0x20, 0x69, 0x39,
-  0xac, 0xee, 0x94, 0x39, 0xaf, 0x7e, 0xfc, 0x39, 0xe9, 0x58, 0x0f, 0x3a,
-  0x16, 0xd4, 0x72, 0x39, 0xd7, 0xe3, 0xa1, 0x39, 0x6f, 0xdf, 0x0d, 0x3a,
-  0x29, 0xc1, 0xb5, 0x39, 0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xf2, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0x64, 0xd8, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x42, 0x2b, 0x4b, 0x3b, 0x8d, 0xfc, 0x5b, 0x3b, 0x23, 0x63, 0x16, 0x3b,
-  0xb8, 0x61, 0x19, 0x3b, 0xbb, 0x9c, 0x59, 0x3b, 0x72, 0x17, 0x7f, 0x3b,
-  0xa4, 0x87, 0x1d, 0x3b, 0x12, 0xdd, 0x32, 0x3b, 0x97, 0x0c, 0x2c, 0x3b,
-  0x41, 0xdb, 0x78, 0x3b, 0x83, 0x63, 0x3a, 0x3b, 0x6d, 0xea, 0x6f, 0x3b,
-  0xd4, 0xb8, 0x51, 0x3b, 0x80, 0xfc, 0x87, 0x3b, 0x43, 0xe8, 0x4d, 0x3b,
-  0x56, 0x0e, 0x74, 0x3b, 0x52, 0xb2, 0x88, 0x3b, 0x46, 0xbf, 0x5e, 0x3b,
-  0x6f, 0xc9, 0x82, 0x3b, 0x57, 0x47, 0x46, 0x3b, 0x1a, 0x0b, 0x66, 0x3b,
-  0xa5, 0xbe, 0x6b, 0x3b, 0x93, 0x54, 0x7e, 0x3b, 0x91, 0xd1, 0x34, 0x3b,
-  0x13, 0x43, 0x3b, 0x3b, 0xdc, 0x54, 0x3b, 0x3b, 0xfe, 0x4d, 0x31, 0x3b,
-  0x91, 0xed, 0x22, 0x3b, 0xe4, 0x10, 0x6d, 0x3b, 0x8b, 0x26, 0x61, 0x3b,
-  0xd8, 0x26, 0x67, 0x3b, 0x1e, 0xc8, 0x44, 0x3b, 0xa3, 0x6f, 0x29, 0x3b,
-  0x25, 0x2e, 0x3f, 0x3b, 0x93, 0x48, 0x81, 0x3b, 0x71, 0x96, 0x6b, 0x3b,
-  0x04, 0x2f, 0x64, 0x3b, 0x86, 0x67, 0x90, 0x3b, 0xe5, 0x65, 0x2e, 0x3b,
-  0x5c, 0x2d, 0x5c, 0x3b, 0x61, 0xc7, 0x48, 0x3b, 0x31, 0xa5, 0x8a, 0x3b,
-  0xed, 0x5f, 0x57, 0x3b, 0x02, 0x96, 0x37, 0x3b, 0x58, 0xdd, 0x12, 0x3b,
-  0x2b, 0x16, 0x34, 0x3b, 0xfb, 0xb1, 0x30, 0x3b, 0xed, 0x7f, 0x67, 0x3b,
-  0x35, 0x14, 0x41, 0x3b, 0x9d, 0x53, 0x2f, 0x3b, 0x88, 0x06, 0x83, 0x3b,
-  0xac, 0xd8, 0x25, 0x3b, 0x03, 0x64, 0x96, 0x3b, 0x0d, 0x8a, 0x61, 0x3b,
-  0x7d, 0x3c, 0x68, 0x3b, 0x24, 0x21, 0x1e, 0x3b, 0x43, 0x98, 0x47, 0x3b,
-  0xe8, 0xba, 0x65, 0x3b, 0x9d, 0xce, 0x42, 0x3b, 0xac, 0xa5, 0x53, 0x3b,
-  0xe2, 0x08, 0x6c, 0x3b, 0xc6, 0x66, 0x95, 0x3b, 0xc2, 0x78, 0x64, 0x3b,
-  0x70, 0x57, 0x48, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x52, 0xdc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xcc, 0x03, 0x00, 0x00, 0xc4, 0xdb, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x5c, 0x9e, 0x79, 0x39, 0xfa, 0x23, 0x87, 0x39,
-  0x06, 0xc5, 0x38, 0x39, 0xdd, 0x72, 0x3c, 0x39, 0x96, 0xae, 0x85, 0x39,
-  0xbe, 0xb4, 0x9c, 0x39, 0x92, 0x8b, 0x41, 0x39, 0x9f, 0xc1, 0x5b, 0x39,
-  0x4f, 0x62, 0x53, 0x39, 0x2e, 0xe0, 0x98, 0x39, 0x7f, 0x00, 0x65, 0x39,
-  0x20, 0x62, 0x93, 0x39, 0xbc, 0xd5, 0x80, 0x39, 0x87, 0x13, 0xa7, 0x39,
-  0xa1, 0xfb, 0x7c, 0x39, 0x3d, 0xed, 0x95, 0x39, 0xea, 0xf2, 0xa7, 0x39,
-  0x20, 0xd6, 0x88, 0x39, 0x25, 0xb0, 0xa0, 0x39, 0x39, 0x9c, 0x73, 0x39,
-  0x8e, 0x51, 0x8d, 0x39, 0x2c, 0xd2, 0x90, 0x39, 0x07, 0x3d, 0x9c, 0x39,
-  0x8b, 0x28, 0x5e, 0x39, 0x2c, 0x13, 0x66, 0x39, 0x06, 0x29, 0x66, 0x39,
-  0x4e, 0xd7, 0x59, 0x39, 0x70, 0x2d, 0x48, 0x39, 0xf6, 0xa1, 0x91, 0x39,
-  0x18, 0x50, 0x8a, 0x39, 0xdd, 0xff, 0x8d, 0x39, 0x62, 0xc5, 0x71, 0x39,
-  0x6a, 0x2c, 0x50, 0x39, 0x92, 0xe3, 0x6a, 0x39, 0x4c, 0xd7, 0x9e, 0x39,
-  0x79, 0xb9, 0x90, 0x39, 0x17, 0x2d, 0x8c, 0x39, 0x3e, 0x6b, 0xb1, 0x39,
-  0x16, 0x45, 0x56, 0x39, 0xf6, 0x41, 0x87, 0x39, 0x97, 0xae, 0x76, 0x39,
-  0xd7, 0x57, 0xaa, 0x39, 0xb4, 0x4e, 0x84, 0x39, 0xf4, 0x8e, 0x61, 0x39,
-  0x0e, 0x71, 0x34, 0x39, 0x4d, 0x42, 0x5d, 0x39, 0xa0, 0x17, 0x59, 0x39,
-  0x96, 0x36, 0x8e, 0x39, 0xc2, 0x38, 0x6d, 0x39, 0x27, 0x69, 0x57, 0x39,
-  0x36, 0xfb, 0xa0, 0x39, 0x5a, 0xc3, 0x4b, 0x39, 0x19, 0xc6, 0xb8, 0x39,
-  0x39, 0x8d, 0x8a, 0x39, 0x6c, 0xaa, 0x8e, 0x39, 0x2a, 0x48, 0x42, 0x39,
-  0x2c, 0x3a, 0x75, 0x39, 0x4a, 0x20, 0x8d, 0x39, 0x4f, 0x58, 0x6f, 0x39,
-  0x7e, 0x04, 0x82, 0x39, 0xc7, 0xff, 0x90, 0x39, 0xf6, 0x8e, 0xb7, 0x39,
-  0x64, 0x5a, 0x8c, 0x39, 0x0e, 0x25, 0x76, 0x39, 0xa8, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x34, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x34, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x3e, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xd8, 0x03, 0x00, 0x00, 0xaa, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xa1, 0x2f, 0x07, 0x3c, 0x57, 0x42, 0xca, 0x3b, 0x3c, 0x10, 0xb2, 0x3b,
-  0xd2, 0x59, 0xe4, 0x3b, 0x4e, 0x0b, 0xa7, 0x3b, 0x5a, 0x77, 0x3a, 0x3c,
-  0x82, 0x7d, 0xa4, 0x3b, 0x43, 0xf1, 0x0b, 0x3c, 0xc3, 0x84, 0x0d, 0x3c,
-  0xea, 0x49, 0xf3, 0x3b, 0x3f, 0x03, 0xca, 0x3b, 0xa6, 0x2d, 0x19, 0x3c,
-  0xa4, 0x49, 0x1d, 0x3c, 0x1e, 0x69, 0x91, 0x3b, 0xa6, 0x77, 0xe1, 0x3b,
-  0x0e, 0x26, 0x43, 0x3c, 0x4d, 0x24, 0xd0, 0x3b, 0x24, 0x0c, 0x04, 0x3c,
-  0x22, 0xaa, 0x98, 0x3b, 0x93, 0x6e, 0x14, 0x3c, 0x3a, 0x65, 0x27, 0x3c,
-  0xe9, 0xa5, 0x91, 0x3b, 0x74, 0x15, 0xa8, 0x3b, 0x29, 0x67, 0xd6, 0x3b,
-  0x12, 0x41, 0xc8, 0x3b, 0xf0, 0x6e, 0xf3, 0x3b, 0xbf, 0x6c, 0xd3, 0x3b,
-  0x64, 0x87, 0xd9, 0x3b, 0xbf, 0xcc, 0xe1, 0x3b, 0x8b, 0x2c, 0xa0, 0x3b,
-  0x39, 0x2a, 0xaa, 0x3b, 0x92, 0x67, 0xb1, 0x3b, 0xb1, 0xa3, 0xa1, 0x3b,
-  0xff, 0xaa, 0xa1, 0x3b, 0x48, 0x92, 0x9a, 0x3b, 0x72, 0x76, 0x42, 0x3c,
-  0x83, 0x5b, 0xc3, 0x3b, 0xc1, 0xbe, 0xbb, 0x3b, 0xcb, 0xb9, 0xbf, 0x3b,
-  0x48, 0xd2, 0xb5, 0x3b, 0x34, 0x88, 0x6d, 0x3b, 0xf8, 0x7e, 0xd1, 0x3b,
-  0xc8, 0x10, 0xe2, 0x3b, 0xd8, 0x86, 0xe6, 0x3b, 0xa3, 0x19, 0xba, 0x3b,
-  0xdd, 0xbd, 0x65, 0x3c, 0x42, 0x46, 0xf1, 0x3b, 0x3a, 0x39, 0xfe, 0x3b,
-  0x71, 0x8a, 0x12, 0x3c, 0x31, 0xe5, 0xc3, 0x3b, 0x22, 0x69, 0x89, 0x3b,
-  0xf1, 0xb6, 0x96, 0x3b, 0xeb, 0x8e, 0x8d, 0x3b, 0x34, 0x36, 0x44, 0x3b,
-  0x22, 0x1b, 0xbd, 0x3b, 0x5b, 0xe9, 0x02, 0x3c, 0xa3, 0x10, 0x64, 0x3b,
-  0x13, 0x0e, 0x58, 0x3b, 0x94, 0xaa, 0x0e, 0x3c, 0x76, 0x6e, 0x1e, 0x3c,
-  0x7c, 0x19, 0xc7, 0x3b, 0xbe, 0xb0, 0xb4, 0x3b, 0xa9, 0x91, 0xc2, 0x3b,
-  0x96, 0x67, 0xc1, 0x3b, 0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
-  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f,
-  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
-  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x42, 0xe4, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00,
-  0xb4, 0xe3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xc7, 0x4a, 0xe0, 0x39, 0xaa, 0xc9, 0xa7, 0x39,
-  0x3b, 0xb7, 0x93, 0x39, 0xc0, 0x6e, 0xbd, 0x39, 0x14, 0x93, 0x8a, 0x39,
-  0xbb, 0xaf, 0x1a, 0x3a, 0xb5, 0x74, 0x88, 0x39, 0xff, 0x2e, 0xe8, 0x39,
-  0x75, 0xcc, 0xea, 0x39, 0x19, 0xd3, 0xc9, 0x39, 0x53, 0x95, 0xa7, 0x39,
-  0xcb, 0x24, 0xfe, 0x39, 0x18, 0x7b, 0x02, 0x3a, 0x8c, 0x41, 0x71, 0x39,
-  0x63, 0x0a, 0xbb, 0x39, 0x9d, 0xe3, 0x21, 0x3a, 0xf6, 0xaa, 0xac, 0x39,
-  0xae, 0x15, 0xdb, 0x39, 0x97, 0x4a, 0x7d, 0x39, 0xd1, 0x44, 0xf6, 0x39,
-  0xad, 0xdd, 0x0a, 0x3a, 0x69, 0xa6, 0x71, 0x39, 0xde, 0x6f, 0x8b, 0x39,
-  0xa5, 0xdc, 0xb1, 0x39, 0xdf, 0x1f, 0xa6, 0x39, 0xcf, 0xf1, 0xc9, 0x39,
-  0x2b, 0x64, 0xaf, 0x39, 0x7d, 0x74, 0xb4, 0x39, 0xfb, 0x50, 0xbb, 0x39,
-  0x11, 0xe0, 0x84, 0x39, 0xd6, 0x29, 0x8d, 0x39, 0x50, 0x2b, 0x93, 0x39,
-  0x47, 0x17, 0x86, 0x39, 0x56, 0x1d, 0x86, 0x39, 0x3f, 0x3a, 0x80, 0x39,
-  0xef, 0x51, 0x21, 0x3a, 0xf6, 0x0f, 0xa2, 0x39, 0x55, 0xbf, 0x9b, 0x39,
-  0xb2, 0x0c, 0x9f, 0x39, 0x51, 0xd5, 0x96, 0x39, 0x8d, 0x0c, 0x45, 0x39,
-  0x8c, 0xca, 0xad, 0x39, 0x6b, 0x89, 0xbb, 0x39, 0xd7, 0x3c, 0xbf, 0x39,
-  0xfd, 0x61, 0x9a, 0x39, 0x1c, 0x96, 0x3e, 0x3a, 0x53, 0x27, 0xc8, 0x39,
-  0x51, 0xe5, 0xd2, 0x39, 0x93, 0x21, 0xf3, 0x39, 0x2d, 0x82, 0xa2, 0x39,
-  0xa9, 0xfb, 0x63, 0x39, 0x5d, 0x0e, 0x7a, 0x39, 0x4f, 0xdd, 0x6a, 0x39,
-  0x61, 0xc5, 0x22, 0x39, 0x56, 0xe0, 0x9c, 0x39, 0x3a, 0x33, 0xd9, 0x39,
-  0x0a, 0x32, 0x3d, 0x39, 0x7b, 0x3b, 0x33, 0x39, 0xf0, 0xb3, 0xec, 0x39,
-  0x02, 0x6e, 0x03, 0x3a, 0xaa, 0x2a, 0xa5, 0x39, 0x1f, 0xe5, 0x95, 0x39,
-  0x83, 0x68, 0xa1, 0x39, 0x3d, 0x71, 0xa0, 0x39, 0xc9, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x35, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4a, 0xe8, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00,
-  0xbc, 0xe7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xeb, 0xed, 0x00, 0x3b, 0x86, 0x59, 0x5f, 0x3b,
-  0x6b, 0x77, 0x35, 0x3b, 0xfa, 0x8d, 0xe8, 0x3a, 0xa9, 0x1b, 0x42, 0x3b,
-  0x9d, 0x5b, 0x23, 0x3b, 0x51, 0xba, 0x12, 0x3b, 0x6c, 0x05, 0x30, 0x3b,
-  0xb9, 0x8e, 0x17, 0x3b, 0x17, 0xe8, 0x1d, 0x3b, 0x0f, 0xdc, 0x26, 0x3b,
-  0xdf, 0x40, 0x86, 0x3b, 0x0e, 0x60, 0xfe, 0x3a, 0xfc, 0xca, 0x27, 0x3b,
-  0x6c, 0xd8, 0x12, 0x3b, 0x59, 0xe0, 0x40, 0x3b, 0x3b, 0x33, 0x4a, 0x3b,
-  0x56, 0xae, 0x38, 0x3b, 0xec, 0x52, 0x2f, 0x3b, 0x37, 0xeb, 0x35, 0x3b,
-  0xf2, 0x11, 0x32, 0x3b, 0xe3, 0xc2, 0x20, 0x3b, 0x3b, 0xff, 0x36, 0x3b,
-  0xb0, 0xa3, 0x2c, 0x3b, 0xce, 0xb9, 0xcc, 0x3a, 0x5c, 0x4f, 0x37, 0x3b,
-  0x87, 0x7a, 0x1d, 0x3b, 0x3e, 0x49, 0x0c, 0x3b, 0x69, 0xfc, 0x1d, 0x3b,
-  0x11, 0x3d, 0x34, 0x3b, 0x43, 0xe5, 0x43, 0x3b, 0x0d, 0xcd, 0x2a, 0x3b,
-  0x69, 0x3b, 0x57, 0x3b, 0xe6, 0x21, 0x44, 0x3b, 0xdc, 0xf2, 0x19, 0x3b,
-  0x70, 0x3f, 0x1b, 0x3b, 0x64, 0x94, 0x36, 0x3b, 0x00, 0xca, 0x34, 0x3b,
-  0x92, 0x13, 0x28, 0x3b, 0x7a, 0x65, 0x87, 0x3b, 0xaa, 0x7e, 0xe6, 0x3a,
-  0xf2, 0x1f, 0x1c, 0x3b, 0xad, 0x13, 0x2f, 0x3b, 0x9f, 0xa6, 0x26, 0x3b,
-  0xbc, 0x75, 0x33, 0x3b, 0x3c, 0xe8, 0x34, 0x3b, 0x03, 0x98, 0x6e, 0x3b,
-  0x34, 0xf0, 0x90, 0x3b, 0x97, 0xd9, 0x1c, 0x3b, 0xce, 0x05, 0xfd, 0x3a,
-  0xec, 0xb2, 0x08, 0x3b, 0x89, 0x41, 0x20, 0x3b, 0x14, 0x2e, 0x40, 0x3b,
-  0x36, 0xfe, 0x4e, 0x3b, 0xa2, 0x5c, 0x33, 0x3b, 0xcc, 0x61, 0x7c, 0x3b,
-  0xb4, 0x8f, 0x1d, 0x3b, 0x1e, 0x17, 0x13, 0x3b, 0x73, 0x1e, 0x39, 0x3b,
-  0xd7, 0xa1, 0xf7, 0x3a, 0xd3, 0x55, 0x0c, 0x3b, 0xdc, 0x54, 0x44, 0x3b,
-  0x81, 0xfb, 0x43, 0x3b, 0x4a, 0x93, 0x18, 0x3b, 0x15, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xaa, 0xeb, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0x03, 0x00, 0x00,
-  0x1c, 0xeb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xc1, 0x35, 0x09, 0x39, 0xcd, 0xb1, 0x6d, 0x39,
-  0x0f, 0x1f, 0x41, 0x39, 0x9a, 0x7d, 0xf7, 0x38, 0x27, 0x93, 0x4e, 0x39,
-  0x84, 0xd9, 0x2d, 0x39, 0xca, 0x26, 0x1c, 0x39, 0x88, 0x53, 0x3b, 0x39,
-  0x9b, 0x4a, 0x21, 0x39, 0x5d, 0x0c, 0x28, 0x39, 0x89, 0x93, 0x31, 0x39,
-  0x3e, 0xe0, 0x8e, 0x39, 0x3a, 0x5b, 0x07, 0x39, 0xcf, 0x91, 0x32, 0x39,
-  0xd4, 0x46, 0x1c, 0x39, 0x97, 0x43, 0x4d, 0x39, 0xc5, 0x2f, 0x57, 0x39,
-  0xd5, 0x8a, 0x44, 0x39, 0x92, 0x95, 0x3a, 0x39, 0x4b, 0x9a, 0x41, 0x39,
-  0xbf, 0x81, 0x3d, 0x39, 0x19, 0x16, 0x2b, 0x39, 0x09, 0xc0, 0x42, 0x39,
-  0x32, 0xba, 0x37, 0x39, 0xdf, 0xdf, 0xd9, 0x38, 0x50, 0x15, 0x43, 0x39,
-  0xc4, 0x97, 0x27, 0x39, 0xce, 0x4b, 0x15, 0x39, 0xfd, 0x21, 0x28, 0x39,
-  0x85, 0xd0, 0x3f, 0x39, 0x25, 0x7a, 0x50, 0x39, 0x55, 0xc5, 0x35, 0x39,
-  0x38, 0x0e, 0x65, 0x39, 0xad, 0xba, 0x50, 0x39, 0x0f, 0xd6, 0x23, 0x39,
-  0xff, 0x37, 0x25, 0x39, 0x56, 0x4e, 0x42, 0x39, 0x81, 0x66, 0x40, 0x39,
-  0x0e, 0xdf, 0x32, 0x39, 0xa4, 0x17, 0x90, 0x39, 0x6c, 0x4c, 0xf5, 0x38,
-  0xec, 0x26, 0x26, 0x39, 0x43, 0x52, 0x3a, 0x39, 0xab, 0x5a, 0x31, 0x39,
-  0x62, 0xfc, 0x3e, 0x39, 0xae, 0x86, 0x40, 0x39, 0xee, 0xea, 0x7d, 0x39,
-  0x41, 0x3f, 0x9a, 0x39, 0x7e, 0xec, 0x26, 0x39, 0xfb, 0xa2, 0x06, 0x39,
-  0x81, 0x7a, 0x11, 0x39, 0x70, 0x8c, 0x2a, 0x39, 0xdf, 0x85, 0x4c, 0x39,
-  0x8e, 0x49, 0x5c, 0x39, 0xac, 0xe1, 0x3e, 0x39, 0xb6, 0x4b, 0x86, 0x39,
-  0x4d, 0xae, 0x27, 0x39, 0x8d, 0x89, 0x1c, 0x39, 0x25, 0x02, 0x45, 0x39,
-  0xaf, 0xc4, 0x03, 0x39, 0x31, 0x59, 0x15, 0x39, 0xe9, 0xf0, 0x50, 0x39,
-  0xd1, 0x91, 0x50, 0x39, 0xe8, 0x5f, 0x22, 0x39, 0xa8, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x36, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x92, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
-  0x3c, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xec, 0x03, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1b, 0x56, 0xa1, 0x3b,
-  0xf1, 0xe1, 0xd0, 0x3b, 0xa8, 0xd6, 0xa1, 0x3b, 0xb7, 0x12, 0x65, 0x3b,
-  0xa7, 0x0e, 0x13, 0x3c, 0x2a, 0xdb, 0x6c, 0x3b, 0x22, 0xf8, 0x08, 0x3c,
-  0x65, 0xbe, 0xb6, 0x3b, 0x7e, 0xa9, 0xa4, 0x3b, 0x56, 0xe1, 0xff, 0x3b,
-  0xbc, 0x12, 0xaa, 0x3b, 0x52, 0xdd, 0x55, 0x3b, 0x30, 0x03, 0x44, 0x3b,
-  0x66, 0x04, 0xbf, 0x3b, 0x0e, 0xac, 0xb0, 0x3b, 0xee, 0xd6, 0xf6, 0x3b,
-  0x30, 0xc2, 0x5d, 0x3b, 0x0a, 0xc6, 0x8a, 0x3b, 0x2e, 0x1e, 0x90, 0x3b,
-  0x65, 0xc8, 0xd2, 0x3b, 0x19, 0x19, 0x9b, 0x3b, 0x87, 0xd1, 0x20, 0x3c,
-  0x09, 0x62, 0x76, 0x3b, 0xf3, 0x64, 0x8d, 0x3b, 0x80, 0x86, 0xec, 0x3b,
-  0x54, 0x3e, 0x8a, 0x3b, 0xcd, 0xe6, 0xbe, 0x3b, 0x66, 0x60, 0x61, 0x3b,
-  0xeb, 0x66, 0x7d, 0x3b, 0x1f, 0xa7, 0xf4, 0x3b, 0x0e, 0x3d, 0x5a, 0x3b,
-  0xaf, 0x1e, 0x6b, 0x3b, 0x5f, 0x6d, 0x01, 0x3c, 0x86, 0x12, 0x7b, 0x3b,
-  0xa0, 0x05, 0xfc, 0x3b, 0x03, 0x88, 0xf4, 0x3b, 0xa6, 0xb1, 0xef, 0x3b,
-  0xeb, 0xc9, 0x4b, 0x3b, 0x2f, 0x26, 0x97, 0x3b, 0x33, 0x58, 0xff, 0x3a,
-  0x05, 0x9c, 0xdf, 0x3c, 0x60, 0xd1, 0x25, 0x3b, 0x5f, 0x0d, 0x2c, 0x3b,
-  0xd0, 0xc4, 0xa2, 0x3b, 0xbd, 0x67, 0x42, 0x3b, 0x8a, 0x37, 0x80, 0x3b,
-  0x12, 0x44, 0x89, 0x3b, 0xa4, 0x1b, 0x87, 0x3b, 0x70, 0x8d, 0xc2, 0x3b,
-  0x1b, 0x94, 0xb2, 0x3b, 0xe9, 0xf5, 0x38, 0x3c, 0x74, 0x9e, 0x5c, 0x3b,
-  0xbc, 0xe8, 0x93, 0x3b, 0x54, 0xc0, 0x80, 0x3b, 0xcf, 0x93, 0xb2, 0x3b,
-  0xe1, 0x7a, 0x0f, 0x3c, 0xbd, 0xd7, 0xc1, 0x3b, 0xf4, 0x66, 0x3c, 0x3b,
-  0xf7, 0x87, 0x8b, 0x3b, 0xe6, 0x8f, 0xc4, 0x3c, 0x29, 0x23, 0x21, 0x3c,
-  0x17, 0x69, 0xcb, 0x3b, 0x04, 0xef, 0xb3, 0x3b, 0xd0, 0x14, 0x84, 0x3b,
-  0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x33, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xaa, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00, 0x1c, 0xf3, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xf7, 0x0c, 0x69, 0x39, 0x9a, 0xdd, 0x96, 0x39, 0xa8, 0xc6, 0x69, 0x39,
-  0xc1, 0x72, 0x25, 0x39, 0xa8, 0x6c, 0xd4, 0x39, 0xcd, 0x11, 0x2b, 0x39,
-  0x34, 0xda, 0xc5, 0x39, 0xa0, 0xfc, 0x83, 0x39, 0xcb, 0xda, 0x6d, 0x39,
-  0x49, 0xcf, 0xb8, 0x39, 0xc7, 0xab, 0x75, 0x39, 0xbf, 0x76, 0x1a, 0x39,
-  0xf6, 0x91, 0x0d, 0x39, 0x5b, 0xf6, 0x89, 0x39, 0x01, 0x34, 0x7f, 0x39,
-  0xb4, 0x47, 0xb2, 0x39, 0x51, 0x2a, 0x20, 0x39, 0x6d, 0x75, 0x48, 0x39,
-  0xb5, 0x2d, 0x50, 0x39, 0xf1, 0x3c, 0x98, 0x39, 0x15, 0x0a, 0x60, 0x39,
-  0x74, 0x4d, 0xe8, 0x39, 0x47, 0xf3, 0x31, 0x39, 0x8f, 0x3e, 0x4c, 0x39,
-  0xa7, 0xd4, 0xaa, 0x39, 0x64, 0xb1, 0x47, 0x39, 0xfb, 0xe0, 0x89, 0x39,
-  0x46, 0xc7, 0x22, 0x39, 0x14, 0x05, 0x37, 0x39, 0x62, 0xb3, 0xb0, 0x39,
-  0x79, 0x9f, 0x1d, 0x39, 0xc6, 0xd0, 0x29, 0x39, 0x36, 0xf5, 0xba, 0x39,
-  0x55, 0x56, 0x35, 0x39, 0xe9, 0x05, 0xb6, 0x39, 0xea, 0x9c, 0xb0, 0x39,
-  0x81, 0x1e, 0xad, 0x39, 0xc5, 0x2f, 0x13, 0x39, 0xd1, 0x55, 0x5a, 0x39,
-  0x3d, 0x6c, 0xb8, 0x38, 0x8b, 0x80, 0xa1, 0x3a, 0x32, 0x86, 0xef, 0x38,
-  0x9e, 0x87, 0xf8, 0x38, 0xac, 0x1e, 0x6b, 0x39, 0xcb, 0x68, 0x0c, 0x39,
-  0xa9, 0x35, 0x39, 0x39, 0xe5, 0x47, 0x46, 0x39, 0xe8, 0x29, 0x43, 0x39,
-  0x05, 0x84, 0x8c, 0x39, 0x7f, 0xfa, 0x80, 0x39, 0x84, 0x96, 0x05, 0x3a,
-  0x9d, 0x57, 0x1f, 0x39, 0xad, 0xa7, 0x55, 0x39, 0x40, 0xfb, 0x39, 0x39,
-  0x48, 0xfa, 0x80, 0x39, 0xd2, 0x41, 0xcf, 0x39, 0xca, 0x00, 0x8c, 0x39,
-  0xd9, 0x12, 0x08, 0x39, 0x8d, 0x8d, 0x49, 0x39, 0x97, 0xf7, 0x8d, 0x3a,
-  0x60, 0xc3, 0xe8, 0x39, 0xd6, 0xe9, 0x92, 0x39, 0x0e, 0xf5, 0x81, 0x39,
-  0xab, 0xca, 0x3e, 0x39, 0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x37, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xb2, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0x24, 0xf7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xf1, 0x1a, 0x4c, 0x3b, 0xd9, 0x9a, 0xbf, 0x3b, 0xa4, 0x9a, 0x99, 0x3b,
-  0xbd, 0x32, 0xb9, 0x3b, 0xdf, 0x16, 0x90, 0x3b, 0x62, 0xb5, 0xda, 0x3b,
-  0x94, 0x9c, 0x81, 0x3b, 0x39, 0xdb, 0x7d, 0x3b, 0x6c, 0xc6, 0xbc, 0x3b,
-  0x5f, 0x5e, 0x80, 0x3b, 0xc1, 0x20, 0xa1, 0x3b, 0x1c, 0x2a, 0x95, 0x3b,
-  0x42, 0x21, 0x8d, 0x3b, 0x6d, 0x89, 0xa9, 0x3b, 0xaf, 0x27, 0xa0, 0x3b,
-  0x22, 0x8d, 0x8e, 0x3b, 0xa6, 0x7d, 0x9e, 0x3b, 0x22, 0x2e, 0x01, 0x3c,
-  0xe0, 0x34, 0x92, 0x3b, 0x65, 0x02, 0x96, 0x3b, 0x9f, 0x7d, 0x96, 0x3b,
-  0xfb, 0x4c, 0x80, 0x3b, 0x58, 0xf3, 0xa5, 0x3b, 0x44, 0x48, 0xcb, 0x3b,
-  0x89, 0xb2, 0xbb, 0x3b, 0xef, 0x1b, 0xe0, 0x3b, 0x81, 0x93, 0xd5, 0x3a,
-  0x7f, 0xb3, 0xf9, 0x3b, 0x95, 0x4e, 0x82, 0x3b, 0xf9, 0x28, 0x62, 0x3b,
-  0x10, 0x1f, 0xaa, 0x3b, 0xf5, 0x96, 0x9e, 0x3b, 0x4a, 0x08, 0x7a, 0x3b,
-  0xa5, 0xba, 0x8d, 0x3b, 0x11, 0x68, 0xaf, 0x3b, 0x74, 0xff, 0x95, 0x3b,
-  0xf2, 0x2f, 0x75, 0x3b, 0x31, 0x43, 0x81, 0x3b, 0x06, 0xb2, 0xbe, 0x3b,
-  0xe6, 0xcf, 0xaf, 0x3b, 0xdc, 0x58, 0x94, 0x3b, 0xb1, 0x3f, 0x7b, 0x3b,
-  0x01, 0x32, 0x8d, 0x3b, 0x83, 0xc8, 0x83, 0x3b, 0x12, 0x79, 0x89, 0x3b,
-  0x7b, 0xb7, 0xb5, 0x3b, 0x7f, 0x85, 0x4a, 0x3b, 0xcd, 0x35, 0x88, 0x3b,
-  0x0f, 0x8e, 0xcf, 0x3b, 0x83, 0x2b, 0x6b, 0x3b, 0x98, 0x39, 0xf0, 0x3b,
-  0xb8, 0x9c, 0x83, 0x3b, 0xf2, 0xce, 0x7b, 0x3b, 0xdf, 0xfa, 0x9e, 0x3b,
-  0x03, 0x50, 0xf5, 0x3b, 0x05, 0x63, 0x76, 0x3b, 0xc4, 0x77, 0x9d, 0x3b,
-  0x6b, 0xce, 0x5a, 0x3b, 0xce, 0x42, 0x59, 0x3b, 0x0b, 0x7e, 0x06, 0x3c,
-  0xe2, 0x0b, 0x80, 0x3b, 0x23, 0xfd, 0x49, 0x3b, 0x3b, 0xf4, 0x85, 0x3b,
-  0x43, 0x38, 0xe7, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x12, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xb0, 0x03, 0x00, 0x00, 0x84, 0xfa, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x12, 0xca, 0xcb, 0x39, 0xee, 0x4e, 0x3f, 0x3a, 0xc7, 0x5d, 0x19, 0x3a,
-  0x5c, 0xe9, 0x38, 0x3a, 0xc8, 0xdd, 0x0f, 0x3a, 0xba, 0x5e, 0x5a, 0x3a,
-  0x39, 0x69, 0x01, 0x3a, 0xa3, 0x76, 0xfd, 0x39, 0xa0, 0x7b, 0x3c, 0x3a,
-  0x82, 0x2b, 0x00, 0x3a, 0xe9, 0xe0, 0x20, 0x3a, 0x02, 0xef, 0x14, 0x3a,
-  0x57, 0xe9, 0x0c, 0x3a, 0x40, 0x46, 0x29, 0x3a, 0x3a, 0xe8, 0x1f, 0x3a,
-  0xa7, 0x54, 0x0e, 0x3a, 0xda, 0x3e, 0x1e, 0x3a, 0xf3, 0xfa, 0x80, 0x3a,
-  0xf2, 0xfa, 0x11, 0x3a, 0xf5, 0xc6, 0x15, 0x3a, 0xfe, 0x41, 0x16, 0x3a,
-  0x25, 0x1a, 0x00, 0x3a, 0x97, 0xb1, 0x25, 0x3a, 0xb8, 0xf7, 0x4a, 0x3a,
-  0x2a, 0x68, 0x3b, 0x3a, 0x23, 0xc3, 0x5f, 0x3a, 0xe1, 0x3e, 0x55, 0x39,
-  0x8f, 0x50, 0x79, 0x3a, 0xf3, 0x1a, 0x02, 0x3a, 0x5d, 0xcf, 0xe1, 0x39,
-  0xa8, 0xdb, 0x29, 0x3a, 0x1f, 0x58, 0x1e, 0x3a, 0x38, 0xa5, 0xf9, 0x39,
-  0x7d, 0x82, 0x0d, 0x3a, 0x91, 0x22, 0x2f, 0x3a, 0x05, 0xc4, 0x15, 0x3a,
-  0xcc, 0xce, 0xf4, 0x39, 0xf9, 0x0f, 0x01, 0x3a, 0x77, 0x66, 0x3e, 0x3a,
-  0x3d, 0x8a, 0x2f, 0x3a, 0x15, 0x1e, 0x14, 0x3a, 0x24, 0xdc, 0xfa, 0x39,
-  0x0f, 0xfa, 0x0c, 0x3a, 0x4c, 0x94, 0x03, 0x3a, 0x9a, 0x42, 0x09, 0x3a,
-  0x7b, 0x6f, 0x35, 0x3a, 0x41, 0x35, 0xca, 0x39, 0xd5, 0xff, 0x07, 0x3a,
-  0xd2, 0x3b, 0x4f, 0x3a, 0x55, 0xce, 0xea, 0x39, 0x69, 0xda, 0x6f, 0x3a,
-  0x92, 0x68, 0x03, 0x3a, 0x2c, 0x6b, 0xfb, 0x39, 0xe1, 0xbb, 0x1e, 0x3a,
-  0xd0, 0xee, 0x74, 0x3a, 0x65, 0x01, 0xf6, 0x39, 0x5f, 0x39, 0x1d, 0x3a,
-  0xb9, 0x77, 0xda, 0x39, 0xb8, 0xec, 0xd8, 0x39, 0xc1, 0x48, 0x86, 0x3a,
-  0x4c, 0xb2, 0xff, 0x39, 0x1b, 0xad, 0xc9, 0x39, 0x28, 0xbf, 0x05, 0x3a,
-  0xa6, 0xdc, 0x66, 0x3a, 0x92, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xe2, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3c, 0x00, 0x00, 0x00,
-  0x54, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xab, 0x83, 0x9c, 0x3b, 0x12, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x00,
-  0xb4, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x85, 0xfa, 0x45, 0x3a, 0x22, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,
-  0x98, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00,
-  0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61,
-  0x70, 0x65, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xa8, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x6e, 0x7e, 0xc6, 0x3d, 0x17, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa8, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x19, 0xd0, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xf0, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x0c, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16
-};
-unsigned int sed_bark_ds_cnn_quantized_tflite_len = 47408;
-const char *sed_bark_labels[] = {
-  "_silence_",
-  "_unknown_",
-  "bark",
-};
-unsigned int sed_bark_labels_num = 3;
-const unsigned char *sed_bark_model_ptr = sed_bark_ds_cnn_quantized_tflite;
@@ -1,4068 +0,0 @@
-const unsigned char sed_coughing_ds_cnn_quantized_tflite[] = {
-  0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x30, 0x65, 0x00, 0x00, 0x40, 0x65, 0x00, 0x00, 0x68, 0xbd, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x64, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x9a, 0x9a, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xdc, 0xff, 0xff, 0xff, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
-  0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00,
-  0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x64, 0x00, 0x00, 0x40, 0x64, 0x00, 0x00, 0x20, 0x64, 0x00, 0x00,
-  0x08, 0x64, 0x00, 0x00, 0xec, 0x63, 0x00, 0x00, 0x1c, 0x63, 0x00, 0x00,
-  0x0c, 0x62, 0x00, 0x00, 0xfc, 0x51, 0x00, 0x00, 0xec, 0x50, 0x00, 0x00,
-  0x9c, 0x4e, 0x00, 0x00, 0x8c, 0x4d, 0x00, 0x00, 0x7c, 0x3d, 0x00, 0x00,
-  0x6c, 0x3c, 0x00, 0x00, 0x1c, 0x3a, 0x00, 0x00, 0x0c, 0x39, 0x00, 0x00,
-  0xfc, 0x28, 0x00, 0x00, 0xec, 0x27, 0x00, 0x00, 0x9c, 0x25, 0x00, 0x00,
-  0x8c, 0x24, 0x00, 0x00, 0x7c, 0x14, 0x00, 0x00, 0x6c, 0x13, 0x00, 0x00,
-  0x1c, 0x11, 0x00, 0x00, 0x0c, 0x10, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-  0xf4, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
-  0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
-  0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xae, 0x9b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x32, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x12, 0x9c, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
-  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x45, 0xff, 0xff, 0x64, 0x45, 0xff, 0xff, 0x68, 0x45, 0xff, 0xff,
-  0x6c, 0x45, 0xff, 0xff, 0x70, 0x45, 0xff, 0xff, 0x74, 0x45, 0xff, 0xff,
-  0x78, 0x45, 0xff, 0xff, 0x7c, 0x45, 0xff, 0xff, 0x80, 0x45, 0xff, 0xff,
-  0x84, 0x45, 0xff, 0xff, 0x88, 0x45, 0xff, 0xff, 0x8c, 0x45, 0xff, 0xff,
-  0x90, 0x45, 0xff, 0xff, 0x94, 0x45, 0xff, 0xff, 0x66, 0x9c, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xee, 0x94, 0xff, 0xcb,
-  0xcc, 0xe1, 0xa0, 0xae, 0xd2, 0x81, 0xbc, 0xd5, 0x93, 0x88, 0x87, 0xc7,
-  0x06, 0xb4, 0xa9, 0xdc, 0x0e, 0xce, 0xea, 0x1f, 0xb9, 0xb3, 0xdc, 0x1c,
-  0x1d, 0xf4, 0xfa, 0xae, 0x09, 0x19, 0x45, 0xe5, 0xb5, 0xf4, 0xc8, 0xe2,
-  0x33, 0xfe, 0x28, 0xb6, 0xdb, 0xe8, 0x39, 0x14, 0x16, 0x06, 0x2d, 0xd3,
-  0xf9, 0x33, 0x23, 0xf7, 0x24, 0x0f, 0x5d, 0x01, 0xeb, 0x03, 0x31, 0xf8,
-  0x1a, 0x26, 0xf3, 0x05, 0x25, 0x21, 0x0e, 0x1a, 0x27, 0x4f, 0x7f, 0x6b,
-  0x73, 0x59, 0xbf, 0xe2, 0x1e, 0x0e, 0xec, 0xcc, 0xe5, 0xf9, 0x39, 0x11,
-  0x27, 0x18, 0xe5, 0x05, 0x03, 0xfa, 0xeb, 0xff, 0xd2, 0xd9, 0x01, 0x24,
-  0xd9, 0xf0, 0xde, 0xcb, 0xf7, 0x00, 0x08, 0xea, 0xef, 0xe5, 0xf2, 0xd9,
-  0x08, 0xf3, 0xfe, 0x04, 0xfb, 0xe2, 0xd8, 0xdd, 0x2f, 0x25, 0xfb, 0x06,
-  0x0e, 0x07, 0x1e, 0xf4, 0x2f, 0x1b, 0x2a, 0x19, 0xf1, 0xc7, 0xed, 0xdb,
-  0xef, 0xf1, 0xcf, 0xeb, 0xd2, 0x12, 0xda, 0xf2, 0xd6, 0xc5, 0x14, 0xe6,
-  0xdb, 0x1a, 0xa8, 0x81, 0xb8, 0xbe, 0x01, 0xe5, 0xdb, 0x91, 0xe2, 0xbe,
-  0xd8, 0x24, 0xb4, 0xda, 0xd5, 0x00, 0x16, 0x0b, 0xcd, 0xcf, 0x13, 0xe2,
-  0x26, 0x3c, 0xfe, 0xf3, 0xf0, 0xce, 0xe7, 0xfe, 0x18, 0xf4, 0xe9, 0x29,
-  0xe1, 0xf6, 0x0b, 0xfa, 0xe5, 0x2e, 0xe6, 0xe9, 0x27, 0x0d, 0xfc, 0x2f,
-  0x18, 0xf9, 0x1f, 0xf3, 0xfc, 0x3d, 0xfe, 0x1b, 0x2f, 0xff, 0x13, 0x7f,
-  0x55, 0x59, 0xdf, 0x06, 0xd2, 0x21, 0x1d, 0x2e, 0xe6, 0x13, 0xd5, 0x02,
-  0x19, 0x1e, 0xd6, 0x07, 0xeb, 0x1d, 0x1e, 0x09, 0xc6, 0x03, 0xe1, 0x2c,
-  0x13, 0x01, 0xc7, 0xfa, 0x01, 0x0d, 0x17, 0x04, 0xf4, 0x13, 0x0e, 0xf3,
-  0x0a, 0x1b, 0xf2, 0xee, 0xf5, 0xe6, 0x07, 0x11, 0x04, 0x08, 0x30, 0x2b,
-  0x44, 0x7f, 0xf4, 0x0e, 0x22, 0x0b, 0x28, 0x4a, 0x02, 0x02, 0x1b, 0x27,
-  0x0e, 0x54, 0xec, 0xfb, 0x03, 0xf9, 0x01, 0x0d, 0xec, 0x02, 0x01, 0xfa,
-  0x1e, 0x0e, 0xfc, 0xed, 0xf1, 0x04, 0x0f, 0x0d, 0xee, 0x0c, 0xf0, 0xf8,
-  0x0d, 0x0f, 0xf6, 0x07, 0xfe, 0xe2, 0x0a, 0x20, 0x95, 0x81, 0x93, 0xc1,
-  0xe9, 0xb4, 0x97, 0x90, 0xbf, 0xea, 0xcd, 0xfe, 0xd0, 0x9f, 0xd7, 0xf6,
-  0x20, 0xf3, 0xc5, 0xc3, 0xcd, 0xad, 0xee, 0x01, 0xc8, 0xe9, 0xdb, 0x06,
-  0xea, 0x34, 0x09, 0xe2, 0xe8, 0xf2, 0x20, 0x3a, 0xdc, 0xda, 0x1b, 0xd6,
-  0x2c, 0x36, 0x1d, 0x00, 0xc8, 0xd1, 0x3f, 0x29, 0x0e, 0xf1, 0xf2, 0xed,
-  0x0b, 0xda, 0xfd, 0xe8, 0xdb, 0x07, 0xe0, 0x02, 0xa4, 0xdc, 0xb7, 0x8c,
-  0xc6, 0xd0, 0x9a, 0x9b, 0x8e, 0xb3, 0xee, 0xb5, 0x81, 0xd4, 0xa2, 0xef,
-  0xef, 0xc7, 0xb5, 0xd4, 0xba, 0xb9, 0xc7, 0xf6, 0xe2, 0x11, 0xe8, 0x16,
-  0x1a, 0x03, 0xb4, 0xe2, 0xf8, 0xc7, 0xf2, 0xeb, 0x20, 0xf9, 0x10, 0x26,
-  0x06, 0x4b, 0xfa, 0xf4, 0xf2, 0x1e, 0xf0, 0xe4, 0xfe, 0xd7, 0x35, 0xe7,
-  0x26, 0xf3, 0x0b, 0xf2, 0xfa, 0xe5, 0x37, 0xfe, 0x01, 0x15, 0x32, 0xea,
-  0xf5, 0xe5, 0xe4, 0xf6, 0x03, 0x0b, 0xf4, 0xd6, 0xf4, 0xda, 0xcb, 0xe2,
-  0xfc, 0xb0, 0x2a, 0x2c, 0xed, 0x34, 0x33, 0x1c, 0x49, 0x67, 0x3a, 0x38,
-  0x5d, 0x7f, 0xe8, 0x08, 0xfb, 0x0b, 0xf4, 0x0a, 0xd9, 0xfe, 0x08, 0xe8,
-  0xc1, 0xff, 0xf1, 0x03, 0x2e, 0xf3, 0xdb, 0x0b, 0x0e, 0x12, 0x2d, 0xf1,
-  0xfa, 0xe2, 0xe8, 0x0b, 0x0f, 0x04, 0x0c, 0xd2, 0x85, 0x81, 0xc3, 0xad,
-  0xae, 0x9c, 0x12, 0xdb, 0xf7, 0x09, 0xd8, 0xe9, 0xf1, 0x14, 0x0c, 0x2f,
-  0xf1, 0xe7, 0xf0, 0x04, 0x06, 0x23, 0xf1, 0x25, 0x0b, 0xec, 0x11, 0x13,
-  0x01, 0xfc, 0xef, 0xda, 0xff, 0x06, 0xd9, 0xfb, 0x02, 0xd5, 0xe7, 0xd1,
-  0xed, 0xf1, 0xe4, 0x05, 0xef, 0xec, 0x00, 0xd9, 0xc5, 0xf2, 0x0c, 0xe7,
-  0xd3, 0xd2, 0xf3, 0x00, 0xfb, 0xff, 0x16, 0x05, 0x14, 0x26, 0x0b, 0xf0,
-  0x2c, 0xe2, 0x68, 0x7e, 0x39, 0x1e, 0x39, 0x46, 0x7f, 0x77, 0x11, 0x28,
-  0x09, 0x1f, 0x1d, 0x34, 0x02, 0xce, 0xd2, 0xeb, 0x24, 0x29, 0x28, 0x1b,
-  0x0f, 0x28, 0x05, 0xe6, 0x02, 0xc9, 0xff, 0x1f, 0x12, 0xf5, 0xeb, 0xd7,
-  0x1b, 0x0f, 0xde, 0xde, 0xdc, 0xf3, 0xe1, 0xf6, 0x0f, 0x1a, 0xd1, 0xd2,
-  0xfd, 0xf4, 0xd1, 0x13, 0xff, 0xca, 0xcf, 0xe4, 0xe5, 0x4d, 0x7f, 0xdf,
-  0x4f, 0xee, 0xc4, 0x46, 0x60, 0xd5, 0xfc, 0xc8, 0xf9, 0x2c, 0x42, 0x18,
-  0x1f, 0x0f, 0xf1, 0x06, 0x0e, 0xd6, 0x03, 0xec, 0xd8, 0xda, 0xf2, 0xdd,
-  0x05, 0xd6, 0xe6, 0xe9, 0xe9, 0xe5, 0x29, 0xed, 0x0d, 0x02, 0x36, 0x10,
-  0x4a, 0x03, 0xf3, 0xf1, 0x17, 0xe7, 0x18, 0xed, 0x0c, 0xde, 0x0f, 0xf7,
-  0x01, 0x0a, 0x10, 0xde, 0x0c, 0x03, 0xe0, 0x11, 0x85, 0xd6, 0xe0, 0x0e,
-  0x44, 0xfa, 0xb0, 0xfb, 0x01, 0xc7, 0x1f, 0x70, 0xca, 0x81, 0xb0, 0xc3,
-  0xef, 0x51, 0xe4, 0x00, 0xe7, 0xd8, 0x48, 0x12, 0x8d, 0x8a, 0xb7, 0xb1,
-  0x1b, 0x51, 0xb8, 0xe5, 0x95, 0x96, 0xe8, 0xfd, 0x90, 0x9f, 0xf6, 0x92,
-  0x2b, 0xec, 0xb4, 0x0b, 0x05, 0x0f, 0x0a, 0x2d, 0xfe, 0xd1, 0xe4, 0xd8,
-  0x47, 0x2e, 0xd4, 0xe6, 0xd7, 0xd3, 0xec, 0x14, 0xd6, 0xdb, 0x27, 0x30,
-  0xc1, 0xdd, 0xb3, 0xef, 0x59, 0xf3, 0xe2, 0x0f, 0xa3, 0x0e, 0x7f, 0x11,
-  0xce, 0x31, 0xe2, 0x4f, 0x45, 0xf0, 0xf9, 0x2e, 0x02, 0x59, 0x41, 0xd0,
-  0xfa, 0x3f, 0x0b, 0x28, 0x12, 0xd6, 0xe9, 0x45, 0xf9, 0xfd, 0xf1, 0xee,
-  0xfc, 0x43, 0x06, 0x14, 0x06, 0x03, 0xdd, 0x28, 0xdb, 0x1c, 0x07, 0xd1,
-  0x0a, 0xfe, 0xd5, 0x0d, 0x13, 0xe4, 0xef, 0xd7, 0xea, 0xe5, 0xdf, 0x00,
-  0x14, 0x06, 0xee, 0xf7, 0x04, 0x1a, 0x3c, 0x07, 0x22, 0xf4, 0x01, 0x35,
-  0x73, 0x14, 0x08, 0x00, 0x00, 0x20, 0x7f, 0x0c, 0xf3, 0xf9, 0x1f, 0x18,
-  0x54, 0x04, 0xe7, 0x17, 0x1b, 0x25, 0x1a, 0xf8, 0x0a, 0xfb, 0x14, 0x12,
-  0x0e, 0x02, 0x09, 0x18, 0x09, 0xfc, 0x05, 0xf4, 0xe6, 0x1d, 0xea, 0xf2,
-  0xf6, 0xf2, 0x10, 0x00, 0xfa, 0xf6, 0xef, 0xed, 0x06, 0x59, 0x33, 0x7f,
-  0x4d, 0x37, 0xde, 0x39, 0x46, 0x40, 0x11, 0x08, 0xda, 0x14, 0x2e, 0x62,
-  0x67, 0x3d, 0xb8, 0xc2, 0xf4, 0x06, 0x06, 0x00, 0xb7, 0xd5, 0xcb, 0xec,
-  0xf3, 0x23, 0xe7, 0xea, 0x09, 0xe5, 0x11, 0x29, 0xf3, 0x10, 0x0c, 0xfe,
-  0x04, 0x03, 0x12, 0x06, 0xf7, 0x11, 0xf1, 0xe8, 0x11, 0x0f, 0xec, 0xf7,
-  0x07, 0xf8, 0xf9, 0xfd, 0x1b, 0xfd, 0x0f, 0xf7, 0x0f, 0x17, 0xe4, 0x0e,
-  0x07, 0xe2, 0x08, 0xff, 0x14, 0xe5, 0xe7, 0xcf, 0x04, 0xf3, 0xef, 0x21,
-  0x13, 0xda, 0xc0, 0xf8, 0xf0, 0x1e, 0xf2, 0xef, 0xfb, 0xe5, 0xee, 0x4f,
-  0x45, 0x0e, 0x07, 0xe3, 0xef, 0x27, 0x7f, 0x62, 0x38, 0xd6, 0xbe, 0xf7,
-  0x41, 0x47, 0x2a, 0xf7, 0xf8, 0x09, 0x05, 0x0c, 0x16, 0xf8, 0xf3, 0x03,
-  0xe9, 0x17, 0xfe, 0x12, 0x1b, 0xf2, 0xda, 0xe4, 0x51, 0x33, 0x03, 0x42,
-  0x37, 0x0c, 0xfd, 0x59, 0x3d, 0xfd, 0x52, 0x48, 0x5f, 0x38, 0xfb, 0xd0,
-  0x19, 0xf6, 0x33, 0x23, 0x1c, 0x02, 0xb6, 0xcf, 0xdb, 0x16, 0xb4, 0xcf,
-  0x94, 0xb7, 0xa3, 0xe0, 0x8d, 0xd8, 0x81, 0x9f, 0xed, 0x09, 0xe0, 0xb7,
-  0xd0, 0xa7, 0xc9, 0xc6, 0xd0, 0xea, 0xa9, 0xeb, 0xea, 0xae, 0xef, 0xdf,
-  0xd5, 0xb3, 0x06, 0x0f, 0xbc, 0xb3, 0xac, 0xc0, 0x36, 0x3c, 0x26, 0x22,
-  0x38, 0x7f, 0x35, 0x14, 0xfd, 0x1e, 0x30, 0x43, 0x37, 0xf9, 0x04, 0x5f,
-  0x4f, 0x50, 0xf6, 0xed, 0xdb, 0xf4, 0xfc, 0x1c, 0x53, 0x70, 0x64, 0x5c,
-  0x4d, 0x73, 0x0e, 0xf1, 0xf3, 0xec, 0x09, 0x1b, 0x14, 0xe1, 0x19, 0x0e,
-  0x2e, 0xfa, 0xfb, 0xe7, 0xd9, 0xdf, 0xff, 0x20, 0xcf, 0xfc, 0xd7, 0xdf,
-  0x0c, 0xe4, 0xc5, 0x01, 0xbe, 0xd9, 0xf0, 0xe1, 0xe4, 0x1a, 0xf4, 0xb5,
-  0xd6, 0xa1, 0x28, 0xf9, 0xec, 0xe2, 0xd1, 0x28, 0x0e, 0x25, 0x4e, 0x40,
-  0x3d, 0x56, 0xcf, 0x0f, 0x3c, 0x32, 0x2e, 0x2f, 0xee, 0xb4, 0xbb, 0xcf,
-  0x0a, 0x3d, 0xb9, 0xb6, 0xd5, 0xa9, 0xaf, 0xa8, 0xb9, 0x99, 0xb8, 0x81,
-  0xdf, 0xa0, 0x95, 0x8d, 0x05, 0xe0, 0xbc, 0xb1, 0xf0, 0xba, 0xf5, 0xc2,
-  0xe4, 0x15, 0x1a, 0xce, 0xc5, 0x12, 0xea, 0xea, 0xa1, 0xbf, 0xa5, 0xa1,
-  0xd1, 0x81, 0xc4, 0xd3, 0xd0, 0xed, 0xe0, 0xc4, 0x0b, 0xf7, 0xfb, 0xcd,
-  0x96, 0x92, 0xd6, 0x14, 0xf9, 0xd7, 0xa0, 0x90, 0x02, 0x00, 0xbf, 0xac,
-  0xbf, 0x9c, 0xd4, 0x0a, 0x0c, 0xc5, 0xf8, 0xa1, 0x22, 0x27, 0x22, 0xf3,
-  0xb4, 0xe9, 0x41, 0xf5, 0xd5, 0xfd, 0xc3, 0x0e, 0x0e, 0xea, 0x08, 0x30,
-  0xf3, 0x0a, 0x19, 0xe8, 0x34, 0xe6, 0x21, 0x1d, 0x1d, 0x1d, 0x2f, 0x12,
-  0x47, 0x2b, 0x7d, 0x61, 0x5f, 0x6f, 0x40, 0x72, 0x59, 0x25, 0x3c, 0x56,
-  0x49, 0x67, 0xc5, 0xed, 0x24, 0x09, 0x1c, 0x27, 0x9c, 0x81, 0x9c, 0x91,
-  0x92, 0x82, 0xcc, 0xa0, 0xcb, 0xf5, 0xf9, 0xc8, 0xcb, 0xdd, 0xbe, 0xeb,
-  0xf6, 0xe2, 0x04, 0xee, 0xdd, 0xf1, 0x21, 0x14, 0x9d, 0x9e, 0xd0, 0xf5,
-  0xda, 0xbc, 0xc9, 0xbe, 0x1d, 0xa8, 0xe5, 0xc9, 0xc2, 0x04, 0xf2, 0xec,
-  0xad, 0xba, 0x0d, 0xe2, 0x43, 0xc5, 0xe5, 0xed, 0xc1, 0xfc, 0xc0, 0xeb,
-  0xe6, 0x00, 0xa7, 0xa5, 0xe0, 0x9d, 0xf0, 0xda, 0x9a, 0xbb, 0xc4, 0xfd,
-  0x96, 0xa2, 0x90, 0x81, 0xb5, 0x89, 0xa3, 0xe9, 0x96, 0xfa, 0x03, 0xe0,
-  0xa3, 0x02, 0xe0, 0xe2, 0x45, 0x3e, 0x0b, 0xd3, 0xfe, 0xff, 0x24, 0x04,
-  0xfb, 0x1c, 0x21, 0x18, 0x3a, 0x2d, 0x1b, 0x2f, 0x1d, 0x22, 0x1b, 0x40,
-  0x26, 0xed, 0x16, 0x0c, 0x34, 0x2a, 0x0b, 0x2b, 0xf2, 0xd6, 0xea, 0x0b,
-  0x1c, 0xca, 0x13, 0x16, 0x09, 0x35, 0x16, 0xff, 0xeb, 0x06, 0xf6, 0x0a,
-  0xf9, 0xe0, 0x7f, 0x70, 0x2e, 0x6e, 0x44, 0x29, 0x1e, 0x28, 0x1a, 0x0f,
-  0x2a, 0x31, 0x15, 0x1a, 0xe0, 0xf1, 0xe6, 0xee, 0xe8, 0xfb, 0xeb, 0xf3,
-  0xf0, 0xdd, 0xdc, 0xcc, 0xdb, 0xf7, 0xef, 0xdb, 0x12, 0x26, 0x0f, 0xfb,
-  0xb3, 0xf9, 0x09, 0x0f, 0x0e, 0x11, 0xb8, 0x1e, 0x2d, 0xd9, 0xed, 0x2e,
-  0x03, 0xfa, 0x0f, 0xe5, 0x03, 0x30, 0x1e, 0xfd, 0xe4, 0x9a, 0xfd, 0x7f,
-  0x47, 0x06, 0x0a, 0xe5, 0xf9, 0x1b, 0x1b, 0xfe, 0x1f, 0xe5, 0x04, 0xd9,
-  0xf1, 0xf3, 0x0e, 0xfb, 0x0a, 0xfa, 0xe4, 0x09, 0xff, 0xf6, 0xfb, 0x0c,
-  0xee, 0x1d, 0x11, 0xf2, 0x05, 0x04, 0xfd, 0x27, 0x9c, 0xc7, 0x8e, 0xd6,
-  0xce, 0xc2, 0xca, 0xc0, 0xb3, 0xcc, 0xc9, 0x1a, 0x08, 0x04, 0xfe, 0x2d,
-  0x32, 0x47, 0xc3, 0xbe, 0x81, 0x95, 0x05, 0xee, 0xcf, 0xde, 0xcc, 0x14,
-  0xb5, 0x05, 0x28, 0x3e, 0xbf, 0x00, 0xe3, 0x0d, 0x47, 0x50, 0x38, 0x69,
-  0x0b, 0x1d, 0x67, 0x5c, 0x3b, 0x74, 0x46, 0x6a, 0x00, 0x13, 0x20, 0x6b,
-  0x69, 0x6b, 0xd0, 0xef, 0xf6, 0x4f, 0x22, 0x67, 0x22, 0x0f, 0x09, 0xfd,
-  0xd1, 0xef, 0x28, 0x05, 0x03, 0xf5, 0xf6, 0x23, 0x7f, 0x4b, 0x3f, 0x20,
-  0xe4, 0x43, 0x22, 0xf4, 0x05, 0xde, 0xcc, 0x12, 0x21, 0xfb, 0x03, 0x0a,
-  0xef, 0x15, 0x11, 0x06, 0x03, 0xf2, 0xfa, 0x00, 0xeb, 0x00, 0x04, 0x10,
-  0xe8, 0x0e, 0xe7, 0xf1, 0x0b, 0x06, 0x00, 0xf7, 0xfe, 0xed, 0xf2, 0xf7,
-  0xfd, 0x06, 0xea, 0xdf, 0xfb, 0x02, 0x01, 0x09, 0x8b, 0x81, 0xca, 0xc7,
-  0x81, 0xa7, 0xba, 0xc7, 0xbb, 0x9d, 0xa8, 0xa9, 0xe9, 0x0d, 0x23, 0xf1,
-  0xf3, 0x36, 0xf4, 0xe6, 0xdb, 0xd5, 0x12, 0xf5, 0xe2, 0x1e, 0x22, 0x19,
-  0x14, 0x18, 0x3f, 0xcf, 0x1f, 0x07, 0x38, 0x19, 0x0c, 0xf5, 0xc9, 0xc5,
-  0x0a, 0xee, 0xcd, 0x21, 0xd1, 0xcd, 0x03, 0x26, 0xf2, 0x27, 0x00, 0x0d,
-  0x2d, 0x33, 0xd6, 0x03, 0x16, 0xf2, 0xcb, 0x0a, 0xe3, 0x18, 0x3f, 0x70,
-  0xa2, 0x76, 0xfa, 0x21, 0x2f, 0x75, 0xcc, 0x7f, 0x47, 0x6f, 0xd1, 0x5e,
-  0xf3, 0x39, 0x15, 0x3f, 0xcb, 0x44, 0xb8, 0x14, 0xfe, 0x5f, 0x0c, 0x3b,
-  0xde, 0x11, 0xe4, 0x4f, 0xef, 0x50, 0xc9, 0xfa, 0xfb, 0xe3, 0xd1, 0x1b,
-  0xae, 0xfc, 0xf8, 0xfb, 0xee, 0xf3, 0xe6, 0x1a, 0x25, 0x04, 0xd6, 0xec,
-  0xd4, 0x18, 0x31, 0xe9, 0x13, 0xf8, 0xcc, 0x36, 0x2c, 0xda, 0x0c, 0x0c,
-  0xf9, 0xe2, 0x29, 0xe0, 0x02, 0x22, 0x47, 0xee, 0x3c, 0xec, 0x1e, 0x14,
-  0x42, 0xce, 0xeb, 0xc8, 0x17, 0x2f, 0x09, 0xf1, 0x14, 0xc3, 0xf1, 0x02,
-  0x46, 0xd3, 0xd0, 0xba, 0xbb, 0xe7, 0x10, 0xf6, 0x9a, 0xa9, 0xfa, 0xe3,
-  0xfd, 0xee, 0x86, 0xa6, 0xbc, 0xe7, 0x1b, 0xcd, 0x90, 0x81, 0xa5, 0xf3,
-  0x26, 0xcc, 0xad, 0xd5, 0x05, 0xf5, 0x1a, 0xc1, 0x7f, 0x4e, 0x69, 0x19,
-  0x7a, 0x7b, 0x20, 0x31, 0xef, 0x1c, 0x30, 0x3f, 0xe2, 0x38, 0xdb, 0xda,
-  0x16, 0xf1, 0x10, 0x48, 0x46, 0x1d, 0x49, 0x11, 0x10, 0xff, 0x02, 0x23,
-  0x21, 0x0e, 0xd8, 0xce, 0xf0, 0xc3, 0x1a, 0xda, 0xd2, 0xda, 0xc9, 0x06,
-  0x1e, 0xe9, 0xb6, 0xcf, 0xf2, 0x05, 0x0e, 0x10, 0xbf, 0xcf, 0xd0, 0xfd,
-  0xe2, 0xf3, 0xaf, 0xe6, 0xc4, 0xd1, 0xc6, 0xe3, 0x04, 0xf1, 0xd6, 0xb1,
-  0xe3, 0xd8, 0x14, 0x1f, 0xdb, 0xd3, 0xbb, 0xcc, 0x09, 0x52, 0x68, 0x7f,
-  0x71, 0x7a, 0xce, 0x1b, 0x31, 0x5c, 0x4b, 0x5f, 0xf3, 0xf0, 0x2d, 0x26,
-  0x0c, 0x68, 0xc4, 0x06, 0x0a, 0x19, 0xef, 0x32, 0xe6, 0xfc, 0xc8, 0xed,
-  0xe8, 0xff, 0x0e, 0xea, 0xf6, 0xfb, 0x12, 0xf4, 0x11, 0x0d, 0xf4, 0x0a,
-  0x07, 0xf5, 0x28, 0x06, 0x00, 0xfe, 0xf8, 0xf8, 0xa8, 0xc5, 0xef, 0x24,
-  0x0a, 0x17, 0xef, 0xa9, 0xb6, 0xb4, 0xd3, 0x19, 0xc9, 0xb4, 0xc3, 0xb0,
-  0x02, 0x19, 0x0a, 0xd3, 0xd6, 0xc0, 0xcb, 0xde, 0xd6, 0xa7, 0x81, 0xc9,
-  0x99, 0x9a, 0x04, 0x3a, 0xd0, 0xe0, 0xe6, 0xe2, 0xcd, 0xdb, 0xd6, 0x02,
-  0xf4, 0x10, 0xd7, 0xd8, 0xcf, 0x12, 0x15, 0x11, 0xde, 0xe3, 0xe7, 0xfc,
-  0xbd, 0xd4, 0x19, 0xe5, 0x1c, 0xe7, 0x05, 0x19, 0x14, 0x26, 0x4a, 0x3d,
-  0x00, 0x00, 0xa8, 0x1e, 0xff, 0xf0, 0xf9, 0xfe, 0x81, 0x02, 0xfc, 0xae,
-  0x04, 0x1b, 0x8e, 0x32, 0x18, 0xc4, 0xfc, 0x0f, 0xcc, 0x5f, 0x03, 0xe4,
-  0x0f, 0xfa, 0xb1, 0x42, 0x3f, 0xf8, 0x19, 0x27, 0xd6, 0x25, 0x3e, 0x3f,
-  0x37, 0x28, 0xdc, 0x2c, 0x26, 0x01, 0x6e, 0x23, 0xb0, 0xf4, 0x22, 0xcd,
-  0x33, 0x36, 0xd5, 0x03, 0x32, 0x30, 0x33, 0x1a, 0xcf, 0xd4, 0x11, 0xf9,
-  0x1f, 0x5c, 0xdb, 0xee, 0xa5, 0xc5, 0xe3, 0x23, 0x21, 0x21, 0x03, 0x06,
-  0x2d, 0x4c, 0x64, 0x17, 0x29, 0x33, 0x33, 0x31, 0x7d, 0x27, 0x2e, 0x4c,
-  0x4b, 0x50, 0x62, 0x67, 0x3e, 0xe6, 0x03, 0x67, 0x38, 0xf7, 0xf0, 0xdd,
-  0x27, 0x7f, 0xeb, 0xdf, 0xfe, 0x0c, 0x1e, 0x43, 0x21, 0xdf, 0x04, 0x17,
-  0x10, 0x26, 0x27, 0xd8, 0x27, 0x06, 0xcf, 0xf3, 0x27, 0xa6, 0x91, 0xd2,
-  0xf0, 0xd5, 0xfe, 0x2f, 0x0a, 0xf9, 0x20, 0x29, 0xf9, 0xef, 0x08, 0x4d,
-  0x28, 0xfd, 0xa3, 0xc0, 0xaf, 0xf7, 0xb3, 0xc4, 0xb1, 0x89, 0x81, 0x86,
-  0xaf, 0x8f, 0xeb, 0xbb, 0xe5, 0xe9, 0xee, 0xdc, 0x0a, 0xcb, 0xe1, 0x1c,
-  0xd8, 0xf1, 0xe5, 0x04, 0xf6, 0xd5, 0x20, 0x2a, 0x0d, 0xdb, 0xe0, 0xe7,
-  0xd0, 0x18, 0xf7, 0x1e, 0xf2, 0x47, 0xec, 0x22, 0x11, 0x7f, 0x40, 0x2c,
-  0x28, 0xdd, 0xe1, 0x32, 0x1d, 0x14, 0xe6, 0xd4, 0x12, 0x4c, 0x32, 0x13,
-  0xd7, 0xcc, 0xf1, 0x04, 0x0f, 0x09, 0xfd, 0xe4, 0xea, 0xcb, 0xe8, 0x06,
-  0x10, 0x0b, 0x01, 0xe1, 0xf1, 0x01, 0x14, 0x15, 0x0e, 0x06, 0xfe, 0xde,
-  0x00, 0x16, 0xfb, 0x0d, 0x03, 0xf3, 0xf2, 0x04, 0x02, 0xfb, 0x00, 0xf5,
-  0x0a, 0x03, 0x00, 0xfb, 0x0b, 0x0a, 0x07, 0x0b, 0xe5, 0xf3, 0x06, 0x56,
-  0x35, 0x3e, 0xac, 0xc5, 0x1a, 0x6c, 0x35, 0x0a, 0xb4, 0xbe, 0x27, 0x7f,
-  0xec, 0x37, 0xcd, 0xc7, 0x37, 0x3d, 0x03, 0xe9, 0x18, 0xaf, 0x08, 0x3b,
-  0xf1, 0xe8, 0xff, 0xe5, 0x14, 0x4c, 0xe1, 0x08, 0xf7, 0xfb, 0x22, 0x26,
-  0xce, 0xe8, 0x20, 0xef, 0x28, 0x41, 0xcf, 0xf4, 0x06, 0xff, 0x20, 0x23,
-  0xd0, 0x0a, 0xf6, 0xf4, 0xfe, 0xfe, 0xf1, 0xf2, 0xf2, 0x08, 0x16, 0xdc,
-  0xdb, 0xd0, 0xe6, 0x14, 0xf0, 0x1f, 0xf1, 0xef, 0x28, 0x37, 0x1a, 0xfb,
-  0x1f, 0x16, 0xe4, 0xed, 0xd2, 0xa9, 0xd6, 0xdf, 0xc7, 0xbe, 0xc6, 0x8c,
-  0x81, 0x9e, 0x11, 0xef, 0x2d, 0xdb, 0x04, 0xea, 0x07, 0xf7, 0x15, 0x03,
-  0xfa, 0xfc, 0xef, 0xf4, 0xe3, 0xef, 0xd0, 0xce, 0x1c, 0xfd, 0xfa, 0xf9,
-  0xfd, 0xc8, 0xdd, 0xdd, 0x04, 0xd5, 0xfd, 0xbd, 0xdd, 0x9d, 0x83, 0xb0,
-  0xd7, 0x07, 0x31, 0xb3, 0xa6, 0xd1, 0xed, 0xfd, 0x1d, 0x93, 0xab, 0xad,
-  0x1b, 0x05, 0xf9, 0xdd, 0xf4, 0xcd, 0x01, 0xde, 0x09, 0x20, 0xcd, 0xe6,
-  0xea, 0x4f, 0x1a, 0x00, 0x17, 0xc5, 0xee, 0x5f, 0x41, 0x7f, 0x43, 0xfe,
-  0x3d, 0x51, 0x12, 0x11, 0x3e, 0x24, 0x4b, 0x1d, 0xa8, 0xd5, 0x36, 0xd8,
-  0x1d, 0x16, 0xc9, 0x52, 0x2a, 0xbb, 0xfb, 0x11, 0x8f, 0xbd, 0xed, 0xf9,
-  0xd3, 0xef, 0x81, 0xea, 0xf7, 0xd9, 0xb9, 0xe5, 0xa4, 0xe2, 0xff, 0xfa,
-  0xb8, 0xd3, 0xc2, 0xb6, 0xdd, 0xb9, 0xec, 0xfe, 0xa8, 0xdc, 0xdf, 0xba,
-  0xc9, 0x0b, 0xe5, 0xd9, 0xf9, 0x0e, 0xcd, 0x0f, 0xee, 0x06, 0xe5, 0xdc,
-  0x0d, 0x29, 0x23, 0xf8, 0xed, 0x10, 0xf0, 0x1a, 0xf5, 0xf7, 0xec, 0x15,
-  0x28, 0xfc, 0xf5, 0x20, 0x01, 0xfd, 0x2b, 0x3f, 0xd5, 0x06, 0xfe, 0x27,
-  0x0c, 0x0c, 0x0c, 0x00, 0x0b, 0x10, 0xf0, 0xfd, 0xfb, 0xf0, 0xf8, 0xf5,
-  0xc8, 0x08, 0xd2, 0xd9, 0x07, 0x12, 0xf4, 0xd4, 0xfa, 0xd8, 0x1b, 0x44,
-  0xf8, 0xde, 0xfc, 0x01, 0x2f, 0x53, 0xfb, 0xcf, 0xd9, 0xf5, 0x4e, 0x7f,
-  0x03, 0xe8, 0xf3, 0xfa, 0x26, 0x48, 0xe6, 0xc3, 0xf4, 0x0d, 0x40, 0x6b,
-  0xf5, 0xec, 0x07, 0x08, 0x3c, 0x78, 0x25, 0xf0, 0x1a, 0xed, 0x06, 0xd9,
-  0xed, 0xa7, 0x18, 0xe7, 0xe2, 0xae, 0xbb, 0xad, 0xda, 0x06, 0xfe, 0x2a,
-  0xe4, 0xcb, 0x90, 0xca, 0xd2, 0xaa, 0x81, 0x90, 0xe9, 0x9f, 0xab, 0xbd,
-  0xec, 0xc7, 0xd2, 0x03, 0xe0, 0xbc, 0xd0, 0xf8, 0xc2, 0xbc, 0xed, 0xf4,
-  0xe2, 0x08, 0xad, 0x05, 0x00, 0xee, 0xeb, 0x27, 0x01, 0xb9, 0x11, 0xf6,
-  0xd3, 0x0a, 0xe8, 0x18, 0xeb, 0x15, 0x0d, 0x08, 0xa4, 0x9f, 0xc4, 0x9d,
-  0x85, 0x81, 0x1b, 0xf1, 0xfd, 0xec, 0x00, 0xfe, 0xfd, 0xdf, 0xf2, 0xdf,
-  0xf9, 0xdd, 0x18, 0xe2, 0xf6, 0xf2, 0x03, 0xd1, 0xe9, 0x0c, 0x05, 0x1d,
-  0x11, 0xd4, 0xe7, 0x0d, 0xeb, 0x0d, 0xdc, 0xd4, 0x1c, 0x04, 0xfd, 0x0f,
-  0x0c, 0xe4, 0x1f, 0x15, 0x24, 0x18, 0xfa, 0x08, 0xff, 0x23, 0x23, 0x07,
-  0x12, 0x14, 0xf0, 0xff, 0xea, 0x10, 0x13, 0xfd, 0x35, 0xff, 0x0d, 0x00,
-  0xfd, 0x04, 0xfd, 0x10, 0xd9, 0xff, 0x02, 0xf1, 0xec, 0x19, 0x20, 0x16,
-  0x39, 0x09, 0xeb, 0xec, 0xe6, 0xed, 0x00, 0xf9, 0xbf, 0xc9, 0xea, 0xd2,
-  0xfd, 0xd4, 0xd3, 0xf0, 0xc4, 0xee, 0xf8, 0xb9, 0xef, 0xf8, 0xf4, 0x33,
-  0x09, 0x04, 0x40, 0x26, 0x52, 0x7f, 0x3b, 0x47, 0x1e, 0x0d, 0x35, 0x26,
-  0x14, 0x25, 0xf1, 0xd3, 0x0c, 0x21, 0x16, 0x1f, 0xc0, 0xc3, 0xae, 0xca,
-  0xda, 0xb4, 0xda, 0xd8, 0xa6, 0x17, 0x25, 0x0c, 0xe0, 0x38, 0x1d, 0x23,
-  0x45, 0x1a, 0xfa, 0x00, 0x30, 0x1f, 0x2a, 0x2b, 0x5d, 0x37, 0x7f, 0x64,
-  0x2d, 0x5b, 0x06, 0x09, 0xe1, 0xd6, 0xeb, 0xfd, 0xe5, 0xb4, 0xba, 0xcd,
-  0x07, 0x2a, 0xea, 0xc1, 0xdf, 0xb8, 0xf9, 0xf0, 0x06, 0xea, 0x0b, 0xfa,
-  0xf7, 0x0a, 0x36, 0x1f, 0x07, 0x07, 0x27, 0x0e, 0x4a, 0x65, 0x3b, 0x7f,
-  0x4f, 0x58, 0x0a, 0xea, 0xcd, 0xd3, 0xcd, 0xd5, 0x29, 0x0a, 0x12, 0xea,
-  0xcf, 0x01, 0x07, 0xe3, 0xf1, 0xc4, 0xe3, 0xc1, 0x26, 0x10, 0xfd, 0x15,
-  0xe4, 0xf4, 0xf2, 0x06, 0x30, 0xfd, 0x12, 0x0b, 0xfb, 0xf0, 0x01, 0xdf,
-  0xcf, 0x09, 0xe4, 0xec, 0xf8, 0xe6, 0xcb, 0xee, 0xd1, 0xda, 0xf6, 0xde,
-  0xe6, 0xf2, 0x12, 0xfc, 0xdd, 0x0c, 0x20, 0x13, 0xe8, 0xdf, 0xdd, 0xff,
-  0xfb, 0x1c, 0x1c, 0x07, 0x22, 0x30, 0x4f, 0x7f, 0xeb, 0xdc, 0xec, 0xfc,
-  0x0e, 0x25, 0xec, 0xe0, 0xfd, 0x01, 0x02, 0x21, 0xf1, 0xfd, 0xf9, 0x04,
-  0xf9, 0x15, 0xf6, 0x0f, 0x06, 0x0d, 0x07, 0x0b, 0x03, 0xf5, 0x07, 0xf7,
-  0xfd, 0x0f, 0xf8, 0xf6, 0x09, 0x0b, 0x12, 0xfa, 0xfb, 0xf7, 0x00, 0x0f,
-  0xfd, 0x09, 0xf8, 0x15, 0xfc, 0x03, 0x14, 0xf7, 0xf0, 0xe0, 0x03, 0x09,
-  0xfb, 0xff, 0x1b, 0x02, 0xf1, 0x1b, 0xec, 0x25, 0xde, 0x1c, 0xfc, 0x0e,
-  0xe8, 0xf2, 0xf5, 0x0f, 0xea, 0xeb, 0xcd, 0xf4, 0xfa, 0xde, 0xce, 0xe0,
-  0xd9, 0xca, 0x11, 0xff, 0x24, 0x3c, 0x3d, 0x0f, 0x5d, 0x66, 0x4f, 0x58,
-  0x64, 0x59, 0x65, 0x7f, 0x67, 0x4f, 0x47, 0x52, 0x08, 0x18, 0x16, 0x1f,
-  0x13, 0x21, 0x24, 0xf5, 0x11, 0xea, 0x0b, 0xfa, 0x1f, 0xfd, 0xe4, 0x38,
-  0x0c, 0x1c, 0x0b, 0xc8, 0x9c, 0x0f, 0xb3, 0xa5, 0x2d, 0x33, 0xdc, 0xa7,
-  0xb4, 0xec, 0x1b, 0xff, 0x88, 0xc5, 0xad, 0xa4, 0xe9, 0xbe, 0xe9, 0x01,
-  0x8a, 0xd0, 0x1f, 0xe1, 0x14, 0x08, 0xbe, 0xe0, 0x44, 0x37, 0xe6, 0xef,
-  0x29, 0xfe, 0x35, 0x3e, 0xe7, 0x1d, 0x5a, 0x60, 0x50, 0x6d, 0x37, 0x73,
-  0x74, 0x7c, 0x5d, 0x69, 0x0f, 0x60, 0x7f, 0x40, 0x1f, 0x1b, 0x05, 0xe9,
-  0xce, 0xf7, 0xed, 0xe0, 0xbd, 0xf2, 0xd6, 0xe7, 0xe8, 0xae, 0xf0, 0xb4,
-  0xbc, 0xea, 0x29, 0xff, 0xf9, 0xf6, 0xb9, 0x1f, 0x3d, 0x28, 0xf8, 0xe1,
-  0xf6, 0x0c, 0x2e, 0x22, 0x1a, 0x2e, 0x0f, 0x2d, 0x75, 0x57, 0x25, 0x18,
-  0x0c, 0x6f, 0x7f, 0x38, 0x21, 0x0b, 0x40, 0x7f, 0x47, 0x30, 0x21, 0x18,
-  0x3a, 0x72, 0x0a, 0xd4, 0xf2, 0x15, 0xef, 0x07, 0x08, 0xfa, 0xf9, 0x09,
-  0xef, 0xec, 0x30, 0xe8, 0xc3, 0xd3, 0xd1, 0xf2, 0xf4, 0xd1, 0xb0, 0xb4,
-  0x9e, 0x81, 0x21, 0x03, 0xd6, 0xfd, 0x08, 0xf7, 0x74, 0x66, 0x26, 0x4e,
-  0x0c, 0x41, 0x69, 0x44, 0xf7, 0xfe, 0xe5, 0xfb, 0x62, 0x62, 0xf6, 0xc1,
-  0xff, 0xec, 0x72, 0x4e, 0x1e, 0x21, 0xf5, 0x16, 0x18, 0x12, 0x03, 0x22,
-  0x31, 0x24, 0x06, 0x18, 0x08, 0xd0, 0xf7, 0xf6, 0xf7, 0xef, 0x28, 0x70,
-  0x28, 0xc8, 0xfd, 0x26, 0x69, 0x78, 0x16, 0xc8, 0x03, 0x05, 0x7f, 0x76,
-  0x02, 0xf5, 0xda, 0xd5, 0x0f, 0xe1, 0xe5, 0xe2, 0x1e, 0x16, 0x3e, 0x16,
-  0xf5, 0x06, 0x15, 0xfc, 0x1f, 0x1b, 0xf5, 0x11, 0x19, 0xf3, 0xe3, 0xf2,
-  0xf3, 0xef, 0x08, 0x00, 0xec, 0xf0, 0xe9, 0x0a, 0x04, 0xec, 0xf1, 0xe4,
-  0xe3, 0x11, 0x04, 0xf5, 0xf5, 0xfc, 0x02, 0xe6, 0x8e, 0xa6, 0x81, 0xd2,
-  0x0e, 0xb8, 0xed, 0xc1, 0xee, 0xa6, 0xfe, 0xe9, 0xac, 0xbd, 0x03, 0xa3,
-  0xd0, 0xe5, 0x0f, 0xf3, 0xd1, 0x09, 0x19, 0x38, 0xf5, 0xe3, 0x93, 0xcb,
-  0xd0, 0xe9, 0x90, 0xd3, 0x96, 0xb8, 0xbe, 0x22, 0xb1, 0xd6, 0xae, 0xce,
-  0xba, 0x0f, 0x08, 0x09, 0xc0, 0xe3, 0x0f, 0x1a, 0xcf, 0xc2, 0xfe, 0xcf,
-  0x05, 0x1c, 0xa0, 0xfc, 0xf5, 0xbe, 0xb9, 0xd6, 0x5b, 0x7f, 0x34, 0x47,
-  0x1e, 0x25, 0x20, 0x2b, 0x1f, 0x14, 0xee, 0xf3, 0x13, 0x14, 0x0b, 0x1d,
-  0x00, 0xfa, 0xe9, 0x11, 0x00, 0x01, 0xea, 0xfe, 0xf3, 0x02, 0x07, 0x12,
-  0x01, 0xfa, 0xfc, 0xf4, 0x0b, 0x0a, 0xf9, 0x05, 0x03, 0x00, 0xfb, 0xf5,
-  0x0c, 0xfe, 0xe8, 0x06, 0x03, 0x01, 0x02, 0x0d, 0xf5, 0xf4, 0xfd, 0xff,
-  0x05, 0x0a, 0x06, 0xfd, 0xff, 0x0e, 0xf6, 0x04, 0xcf, 0x06, 0xdb, 0xeb,
-  0xcc, 0x16, 0xc3, 0x4a, 0xeb, 0xe6, 0xc1, 0x2c, 0xf1, 0x33, 0x98, 0xec,
-  0xc8, 0x19, 0xe4, 0x4c, 0xba, 0xb4, 0xfa, 0x1a, 0xd3, 0x24, 0xa1, 0x9f,
-  0xb1, 0xb4, 0xdb, 0x9e, 0x9c, 0xbd, 0xec, 0xcb, 0xe9, 0xdb, 0xfd, 0xd3,
-  0xd6, 0x81, 0xfa, 0x15, 0xa4, 0x14, 0xe2, 0xcf, 0x09, 0xb1, 0xcf, 0xec,
-  0xd4, 0xcf, 0xf7, 0xc6, 0xb8, 0x27, 0x30, 0xbf, 0x0a, 0x04, 0xfb, 0xf0,
-  0x07, 0x1b, 0x01, 0x26, 0x0a, 0x22, 0x31, 0x32, 0x4f, 0x73, 0x48, 0x42,
-  0x3c, 0x7f, 0x0a, 0x48, 0x1e, 0x11, 0x33, 0x3e, 0x52, 0x73, 0x3f, 0x3f,
-  0x3d, 0x4b, 0xea, 0x0e, 0xd7, 0xf5, 0xff, 0xfb, 0xfc, 0xfa, 0x0e, 0xe9,
-  0xfa, 0x10, 0x05, 0x08, 0xe1, 0x02, 0xfd, 0xf1, 0xfe, 0xf4, 0xfd, 0x1c,
-  0x0b, 0xfb, 0xf5, 0x00, 0x02, 0x05, 0x0a, 0xff, 0x15, 0xf5, 0xdd, 0x01,
-  0x45, 0x06, 0xf2, 0xfd, 0xf6, 0x17, 0x08, 0xf5, 0x24, 0xf5, 0xf8, 0xce,
-  0x0d, 0x1d, 0xe5, 0xe0, 0xf2, 0xc8, 0xed, 0xf3, 0xfa, 0xa8, 0xfb, 0xd4,
-  0x01, 0xc8, 0xee, 0x03, 0x1a, 0x05, 0x28, 0x00, 0x59, 0x69, 0x6c, 0x4c,
-  0x30, 0x19, 0x31, 0x3b, 0x4a, 0x7f, 0x55, 0x2c, 0x11, 0x22, 0x52, 0x60,
-  0x0f, 0x02, 0xe5, 0xf2, 0xfa, 0x33, 0xe4, 0x01, 0xa8, 0xae, 0xaa, 0x86,
-  0x94, 0x81, 0x17, 0xcd, 0x37, 0x05, 0xd3, 0xe2, 0xca, 0xce, 0x04, 0xfc,
-  0xd2, 0xe4, 0xa7, 0x9d, 0xd7, 0x09, 0xf5, 0xf5, 0xcb, 0xc8, 0xb5, 0xd0,
-  0xf4, 0xbe, 0xf3, 0xd7, 0xd3, 0xfa, 0xe4, 0x10, 0x02, 0x08, 0x27, 0xec,
-  0xe3, 0xcc, 0x06, 0xce, 0x0e, 0xf2, 0xf6, 0x1f, 0x00, 0xf9, 0xe5, 0x20,
-  0x12, 0xf1, 0xf6, 0x48, 0x13, 0x00, 0x2c, 0x1f, 0xf1, 0x04, 0xf5, 0x0b,
-  0xf7, 0xf5, 0x05, 0x06, 0x0b, 0x01, 0x19, 0xef, 0xd9, 0x07, 0xe8, 0x0c,
-  0xfe, 0xf1, 0x0b, 0xf8, 0xfc, 0x03, 0x1b, 0xee, 0xf9, 0x11, 0x12, 0x31,
-  0x3a, 0xed, 0x32, 0x35, 0x4d, 0x7f, 0x6a, 0x08, 0x00, 0x12, 0x1a, 0x0f,
-  0x13, 0x09, 0x03, 0xf0, 0xfc, 0x11, 0x05, 0xf2, 0x13, 0xec, 0xfe, 0x08,
-  0xe4, 0xf6, 0x06, 0x10, 0x14, 0x02, 0xf2, 0xeb, 0x04, 0x39, 0x48, 0x6c,
-  0x72, 0x7f, 0xec, 0x00, 0x2e, 0x58, 0x4f, 0x4b, 0x1a, 0x1f, 0xf2, 0xeb,
-  0xf6, 0xec, 0x09, 0x03, 0x2b, 0x30, 0x03, 0x0e, 0xe6, 0xd1, 0xf5, 0x01,
-  0xd7, 0xde, 0xfd, 0x25, 0xe5, 0xe0, 0xd0, 0xee, 0xef, 0xfd, 0xd7, 0xdc,
-  0xe9, 0xe0, 0x00, 0x0a, 0x0c, 0xf0, 0x03, 0xe4, 0xee, 0x15, 0x0a, 0xef,
-  0x00, 0x1a, 0xd5, 0xeb, 0x06, 0x04, 0x0f, 0x11, 0x9a, 0xba, 0xbd, 0x95,
-  0xb0, 0xe2, 0x13, 0xf6, 0x27, 0x09, 0xe6, 0xea, 0x11, 0x05, 0x24, 0x03,
-  0xc0, 0xef, 0x2a, 0x4e, 0x25, 0x1a, 0xd8, 0xfb, 0x4e, 0x31, 0x7f, 0x68,
-  0x00, 0x20, 0x26, 0xe8, 0x48, 0x72, 0x19, 0xd5, 0x31, 0x50, 0x50, 0x59,
-  0x4f, 0xf3, 0xf6, 0x34, 0x37, 0x31, 0xfe, 0xf2, 0xe2, 0x05, 0x34, 0x53,
-  0x10, 0xc5, 0xa3, 0x13, 0x0b, 0x3a, 0xf9, 0xdc, 0xf8, 0x0a, 0x1c, 0x08,
-  0x16, 0xfa, 0xeb, 0x0f, 0x15, 0x06, 0x1d, 0x09, 0x32, 0x44, 0x5f, 0x5e,
-  0x7f, 0x58, 0xe6, 0xf7, 0xfa, 0xee, 0xfd, 0x01, 0xfe, 0x16, 0x1d, 0x1c,
-  0x1a, 0x1f, 0xf4, 0xfb, 0xf4, 0x0d, 0x0b, 0xee, 0x06, 0x18, 0xf9, 0x01,
-  0x0d, 0xf3, 0xe7, 0xff, 0xff, 0xeb, 0xf9, 0xeb, 0xff, 0x12, 0x09, 0x02,
-  0x0b, 0x05, 0x08, 0x0a, 0x07, 0xf9, 0x01, 0x06, 0xcc, 0xb9, 0xbf, 0xa0,
-  0xc7, 0xa7, 0xb4, 0xe0, 0x9e, 0xb4, 0xb7, 0xb6, 0x32, 0x18, 0xe0, 0xb6,
-  0xc4, 0xf1, 0xcd, 0x01, 0xab, 0x98, 0xc6, 0x9b, 0xdc, 0xf1, 0xc7, 0xd8,
-  0xd8, 0x81, 0xfc, 0xf7, 0xe4, 0xdd, 0xbb, 0xad, 0x10, 0x11, 0xf3, 0xcd,
-  0x1a, 0xf1, 0x0a, 0x19, 0xe1, 0xe1, 0x02, 0xe4, 0x3a, 0x39, 0x2c, 0xec,
-  0x27, 0x15, 0x32, 0x13, 0xdb, 0x31, 0x24, 0x09, 0xe5, 0xfb, 0xe1, 0xe6,
-  0x1a, 0x64, 0x33, 0x3e, 0x1e, 0x2f, 0x54, 0x7f, 0xda, 0xf5, 0xe9, 0xef,
-  0x14, 0x4d, 0xdc, 0xfd, 0xeb, 0xec, 0x2b, 0x1b, 0xfb, 0xb3, 0xe2, 0x1a,
-  0x05, 0x11, 0x02, 0xa3, 0xe1, 0x0a, 0xe6, 0xe3, 0xe8, 0xcf, 0x2d, 0x14,
-  0x1c, 0x23, 0x06, 0xd0, 0x25, 0x08, 0x19, 0xfc, 0x10, 0x13, 0xf8, 0x14,
-  0xff, 0x19, 0x00, 0x1e, 0x40, 0x3d, 0x3e, 0x4e, 0x72, 0xab, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf3, 0x59, 0xff, 0xff,
-  0xd1, 0x17, 0x00, 0x00, 0xd8, 0x63, 0xff, 0xff, 0x88, 0x4a, 0x00, 0x00,
-  0x97, 0x49, 0x00, 0x00, 0xd8, 0x20, 0xff, 0xff, 0xac, 0x39, 0xff, 0xff,
-  0x2b, 0x28, 0x00, 0x00, 0xed, 0x62, 0xff, 0xff, 0x7b, 0x44, 0x00, 0x00,
-  0x92, 0x12, 0x00, 0x00, 0x80, 0x2d, 0xff, 0xff, 0x72, 0x29, 0x00, 0x00,
-  0xf2, 0x42, 0x00, 0x00, 0x6a, 0x45, 0x00, 0x00, 0x48, 0x28, 0x00, 0x00,
-  0xe7, 0x3b, 0xff, 0xff, 0xa1, 0x7b, 0x00, 0x00, 0x15, 0x22, 0xff, 0xff,
-  0x81, 0x12, 0xff, 0xff, 0xd7, 0xb1, 0xff, 0xff, 0xf2, 0x07, 0xff, 0xff,
-  0x38, 0x5e, 0x00, 0x00, 0x5a, 0x15, 0x00, 0x00, 0x9b, 0x62, 0x00, 0x00,
-  0xfa, 0x16, 0x00, 0x00, 0x19, 0x50, 0xff, 0xff, 0x5c, 0x78, 0x00, 0x00,
-  0xc9, 0x50, 0xff, 0xff, 0xcb, 0x1a, 0x00, 0x00, 0xa7, 0x3f, 0x00, 0x00,
-  0x32, 0xe9, 0xfe, 0xff, 0x65, 0x2f, 0x00, 0x00, 0xdb, 0xb4, 0x00, 0x00,
-  0xaf, 0x49, 0xff, 0xff, 0x3f, 0x19, 0x00, 0x00, 0x5e, 0x24, 0x00, 0x00,
-  0xdf, 0x58, 0xff, 0xff, 0x1b, 0x0e, 0x00, 0x00, 0x06, 0x43, 0xff, 0xff,
-  0x2a, 0x34, 0x00, 0x00, 0xcc, 0xfa, 0xfe, 0xff, 0x01, 0xaa, 0xff, 0xff,
-  0xd2, 0x20, 0x00, 0x00, 0x6d, 0x17, 0x00, 0x00, 0x88, 0xfe, 0xff, 0xff,
-  0x4b, 0x1a, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x72, 0x1f, 0x00, 0x00,
-  0xb2, 0x83, 0x00, 0x00, 0x47, 0x51, 0x00, 0x00, 0x7e, 0x2d, 0x00, 0x00,
-  0xca, 0xb6, 0xfe, 0xff, 0x77, 0x29, 0x00, 0x00, 0xb8, 0xec, 0xfe, 0xff,
-  0xff, 0xd1, 0x00, 0x00, 0x93, 0x6a, 0x00, 0x00, 0x24, 0x1e, 0xff, 0xff,
-  0xcb, 0x3d, 0x00, 0x00, 0x99, 0x2d, 0x00, 0x00, 0xc5, 0x72, 0x00, 0x00,
-  0xe6, 0x5c, 0x00, 0x00, 0x29, 0x17, 0xff, 0xff, 0x5b, 0x51, 0x00, 0x00,
-  0x7e, 0xac, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0x7f, 0x7f, 0x00, 0x17, 0xe8, 0x7f, 0x5f, 0xd2, 0xc5, 0xec, 0xd9, 0x7f,
-  0xc1, 0xfb, 0xa7, 0xd6, 0xd8, 0xaf, 0xe3, 0x16, 0xd9, 0x07, 0x81, 0xdf,
-  0xc1, 0x7f, 0x81, 0xa2, 0xea, 0xde, 0xbb, 0x4a, 0x1e, 0x5f, 0x88, 0x49,
-  0x6a, 0x6e, 0xcb, 0xd7, 0xcf, 0x6c, 0x27, 0x54, 0x7f, 0x0b, 0x81, 0xda,
-  0x30, 0x0a, 0x7b, 0x7f, 0xfd, 0x33, 0xf3, 0x94, 0xd8, 0x81, 0xd1, 0xd4,
-  0x1d, 0x68, 0x26, 0x81, 0x1a, 0x2d, 0x48, 0xc9, 0xd0, 0x6a, 0x3b, 0xd7,
-  0x4a, 0x3e, 0x71, 0x12, 0x7f, 0x22, 0xcc, 0xaa, 0x9a, 0xf7, 0x3c, 0xfe,
-  0x20, 0xe2, 0xbc, 0x7f, 0xa9, 0x13, 0xcd, 0xee, 0x57, 0xa1, 0x24, 0x7f,
-  0x9b, 0x42, 0xd5, 0x27, 0x90, 0x06, 0x7f, 0x96, 0x7f, 0x7f, 0x53, 0xf8,
-  0x30, 0x04, 0x53, 0xa0, 0x28, 0x16, 0x95, 0x2d, 0xc2, 0xbb, 0xb9, 0x87,
-  0x66, 0xca, 0xf4, 0xbc, 0xce, 0x55, 0xab, 0xcf, 0xda, 0xd4, 0xf5, 0x91,
-  0x7f, 0x25, 0x7f, 0x18, 0xc3, 0xec, 0xa4, 0xd8, 0xbd, 0x16, 0x45, 0x7f,
-  0x9e, 0x81, 0x5d, 0x7f, 0xb4, 0x61, 0x1a, 0xa9, 0x17, 0xd0, 0x8f, 0x7f,
-  0x1e, 0x08, 0x7f, 0x56, 0x4c, 0xa1, 0x81, 0x81, 0x08, 0xc1, 0xa9, 0x81,
-  0x93, 0xdc, 0x47, 0x8e, 0x8d, 0xf4, 0x1d, 0xc5, 0x08, 0x8b, 0x81, 0x89,
-  0x2d, 0xcc, 0x81, 0xf9, 0x57, 0xc1, 0x11, 0x94, 0x16, 0x7f, 0x81, 0xfa,
-  0x43, 0x23, 0x8f, 0x7f, 0x33, 0x69, 0x3c, 0xe3, 0xc2, 0x81, 0x4c, 0xd6,
-  0xcb, 0xb8, 0x4c, 0x5c, 0xd1, 0xc7, 0x91, 0xfd, 0xfa, 0x7f, 0x87, 0xa3,
-  0xf4, 0x57, 0x75, 0xf2, 0x85, 0x57, 0x9f, 0xc5, 0xd2, 0x4a, 0x3d, 0x9b,
-  0x5a, 0x35, 0xf6, 0xc0, 0x05, 0x6b, 0x81, 0x42, 0x0e, 0x07, 0x3e, 0xa7,
-  0xe7, 0x7f, 0x73, 0x3e, 0x03, 0x7f, 0xbb, 0x2b, 0xa4, 0xb3, 0x33, 0x5f,
-  0xa3, 0x2e, 0xe7, 0x94, 0x4e, 0xe5, 0xc7, 0x10, 0x0f, 0x53, 0x1c, 0xc0,
-  0x61, 0xdc, 0x6e, 0x0d, 0x34, 0x7f, 0xe2, 0xf7, 0xbb, 0xdf, 0x81, 0x20,
-  0xd5, 0xa7, 0x03, 0x72, 0x14, 0xc6, 0xc5, 0x20, 0x03, 0x10, 0x4c, 0x58,
-  0x81, 0x2d, 0x1a, 0xef, 0x9f, 0x22, 0xfc, 0x0a, 0x75, 0xbb, 0xc5, 0x38,
-  0xea, 0x1f, 0x19, 0x81, 0x5a, 0x7e, 0x3a, 0xd7, 0x44, 0x2d, 0x9f, 0x56,
-  0x0d, 0xbe, 0x0f, 0xc6, 0x81, 0xf3, 0xc0, 0x46, 0xe8, 0xf5, 0x3a, 0xa8,
-  0x42, 0x9e, 0x5e, 0x14, 0x78, 0xb6, 0x81, 0x5b, 0x12, 0xfd, 0x81, 0xaa,
-  0x81, 0xeb, 0xd7, 0x47, 0x34, 0x75, 0xca, 0xcd, 0x85, 0xd7, 0x9c, 0xe1,
-  0xcd, 0x3e, 0x60, 0x1e, 0x52, 0xee, 0xed, 0x7b, 0x81, 0x7f, 0x35, 0x05,
-  0x10, 0xe9, 0x62, 0x60, 0x09, 0x7f, 0x73, 0xb5, 0x7f, 0x72, 0x0e, 0xc7,
-  0xc0, 0x11, 0xd9, 0x7f, 0x6a, 0x3a, 0x7f, 0xb3, 0x1b, 0x2c, 0x9e, 0xe3,
-  0x3a, 0xdd, 0x81, 0x4f, 0xd1, 0xf7, 0x2f, 0x36, 0x5e, 0xc9, 0xd0, 0x28,
-  0xf5, 0x2b, 0x61, 0xe3, 0x32, 0x0f, 0xc0, 0xb8, 0xc1, 0xd3, 0xb9, 0xf8,
-  0x7f, 0x0c, 0x59, 0x9b, 0x81, 0x81, 0x13, 0x92, 0xc1, 0xc9, 0x9f, 0x94,
-  0x3c, 0xcf, 0x06, 0xd8, 0x3a, 0x51, 0x6a, 0xd3, 0x1e, 0xa6, 0x19, 0x46,
-  0xca, 0x18, 0xda, 0xef, 0xc4, 0x0f, 0x02, 0x77, 0x9a, 0xde, 0x29, 0xae,
-  0x05, 0xac, 0x54, 0xd2, 0x3d, 0xda, 0xdd, 0x00, 0xcd, 0xa8, 0x20, 0x7f,
-  0x7f, 0x02, 0x54, 0x6c, 0x0c, 0x48, 0x61, 0x03, 0xbb, 0xae, 0x07, 0x44,
-  0x81, 0xf0, 0x2e, 0xf7, 0x3f, 0xab, 0x8e, 0x05, 0x3e, 0xbc, 0x94, 0x44,
-  0x11, 0x30, 0xcf, 0x2e, 0xb1, 0xc9, 0x10, 0x6a, 0xed, 0x25, 0x49, 0x81,
-  0xaf, 0xd2, 0xbb, 0x34, 0x8e, 0x1d, 0x9e, 0x4c, 0x81, 0x3e, 0xda, 0xe0,
-  0x90, 0x33, 0xd9, 0xe1, 0x2e, 0xde, 0xf0, 0xeb, 0xb0, 0xc9, 0xef, 0xcb,
-  0x2c, 0x4c, 0xe4, 0xde, 0x75, 0x41, 0xb4, 0x0f, 0xe9, 0xb4, 0xbc, 0xb8,
-  0x5f, 0xc4, 0xdd, 0xd3, 0x1b, 0x0f, 0xa9, 0xf3, 0x30, 0x27, 0x37, 0x64,
-  0xb6, 0xb0, 0xb6, 0xa0, 0x69, 0x81, 0x60, 0x47, 0x39, 0x29, 0xbb, 0xbc,
-  0x83, 0xcb, 0x70, 0xa7, 0xda, 0xa8, 0x8a, 0x03, 0x89, 0xfb, 0x8f, 0xbc,
-  0xca, 0xd9, 0xea, 0x5a, 0x81, 0xef, 0x36, 0x7f, 0x65, 0x90, 0xf2, 0x38,
-  0xca, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xac, 0xee, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0x0f, 0x0c, 0x00, 0x00,
-  0x37, 0x05, 0x00, 0x00, 0x6e, 0xf9, 0xff, 0xff, 0x8f, 0xeb, 0xff, 0xff,
-  0x47, 0xdf, 0xff, 0xff, 0x78, 0xff, 0xff, 0xff, 0x22, 0xe4, 0xff, 0xff,
-  0x1c, 0x0b, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0x24, 0xec, 0xff, 0xff,
-  0xb6, 0xfe, 0xff, 0xff, 0xf3, 0xf7, 0xff, 0xff, 0x78, 0x01, 0x00, 0x00,
-  0xe6, 0x02, 0x00, 0x00, 0xd3, 0x12, 0x00, 0x00, 0xd8, 0x18, 0x00, 0x00,
-  0xbd, 0x0b, 0x00, 0x00, 0xc6, 0xf3, 0xff, 0xff, 0x41, 0x08, 0x00, 0x00,
-  0xa5, 0xf4, 0xff, 0xff, 0xcb, 0x16, 0x00, 0x00, 0xd2, 0x01, 0x00, 0x00,
-  0xf1, 0xfe, 0xff, 0xff, 0x93, 0xfd, 0xff, 0xff, 0xc3, 0x09, 0x00, 0x00,
-  0x25, 0xff, 0xff, 0xff, 0x3b, 0x08, 0x00, 0x00, 0xaf, 0x0a, 0x00, 0x00,
-  0x56, 0xfe, 0xff, 0xff, 0xdb, 0xf2, 0xff, 0xff, 0x0e, 0x01, 0x00, 0x00,
-  0x06, 0xfe, 0xff, 0xff, 0x30, 0x0f, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,
-  0xae, 0x04, 0x00, 0x00, 0x4c, 0xf3, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff,
-  0x88, 0x0f, 0x00, 0x00, 0x71, 0xfe, 0xff, 0xff, 0x19, 0xef, 0xff, 0xff,
-  0x72, 0xea, 0xff, 0xff, 0xd0, 0x01, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00,
-  0x4c, 0x03, 0x00, 0x00, 0x7a, 0xfd, 0xff, 0xff, 0x0c, 0x14, 0x00, 0x00,
-  0xa1, 0xfe, 0xff, 0xff, 0xb1, 0xeb, 0xff, 0xff, 0x8f, 0x06, 0x00, 0x00,
-  0x90, 0xff, 0xff, 0xff, 0x15, 0x0d, 0x00, 0x00, 0xd5, 0xf8, 0xff, 0xff,
-  0x94, 0x17, 0x00, 0x00, 0x49, 0xf1, 0xff, 0xff, 0x0e, 0x07, 0x00, 0x00,
-  0xc7, 0x0c, 0x00, 0x00, 0x1b, 0xf5, 0xff, 0xff, 0x10, 0x0d, 0x00, 0x00,
-  0x54, 0x04, 0x00, 0x00, 0xab, 0xf6, 0xff, 0xff, 0x8b, 0x11, 0x00, 0x00,
-  0xce, 0x0b, 0x00, 0x00, 0xd6, 0xaf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x5b, 0x13, 0x3a, 0x87, 0xd3, 0xd6, 0x21, 0xfd,
-  0xb2, 0xa5, 0xd3, 0xe2, 0xd2, 0x7a, 0x8f, 0xca, 0xf0, 0x25, 0xd6, 0x1d,
-  0x5a, 0x4e, 0xe8, 0x0d, 0x0e, 0x3d, 0x08, 0xcb, 0x32, 0xb1, 0x72, 0xc9,
-  0xc4, 0xac, 0x44, 0x25, 0x81, 0xf9, 0xc5, 0xc4, 0xf8, 0xad, 0x49, 0xe0,
-  0x6a, 0x3b, 0x33, 0xed, 0x04, 0xf3, 0x0c, 0x4a, 0x61, 0xaf, 0x61, 0xca,
-  0x04, 0x26, 0x4d, 0x11, 0x6f, 0x04, 0x1f, 0x89, 0xf2, 0xea, 0x0e, 0x24,
-  0x27, 0xf2, 0xf3, 0x0c, 0x02, 0xe5, 0x0a, 0xd8, 0xbd, 0x23, 0x0d, 0xaa,
-  0x1f, 0xee, 0x0e, 0x53, 0x11, 0xe7, 0x00, 0x01, 0x08, 0x7f, 0xea, 0x5c,
-  0xf2, 0x37, 0xef, 0xab, 0xc4, 0x72, 0xf3, 0x00, 0xd7, 0xc2, 0xe0, 0xde,
-  0xd0, 0x2a, 0xf3, 0xec, 0x48, 0xc1, 0xd2, 0x18, 0xce, 0xe9, 0xc8, 0x11,
-  0xbc, 0x49, 0xe5, 0xb2, 0x9f, 0x1b, 0x21, 0x0d, 0x26, 0x16, 0x64, 0x06,
-  0x35, 0xc1, 0x39, 0xe0, 0x07, 0xc1, 0x19, 0xb0, 0x1a, 0xc1, 0xb3, 0x2d,
-  0xe1, 0xc6, 0x0c, 0xab, 0x81, 0xe8, 0xdb, 0xf0, 0xc4, 0x0d, 0x20, 0x23,
-  0xec, 0xa7, 0xc7, 0xae, 0xe1, 0xeb, 0xa5, 0x19, 0x02, 0xef, 0x2c, 0x88,
-  0x38, 0xbb, 0x3e, 0x0c, 0x2a, 0x03, 0xd1, 0xcc, 0x10, 0x88, 0xa5, 0x4e,
-  0xb8, 0x3d, 0x22, 0xff, 0x30, 0x03, 0x9d, 0x53, 0xf0, 0x05, 0x4c, 0xf0,
-  0xc1, 0xa2, 0x5e, 0x39, 0x04, 0x11, 0x72, 0xd2, 0xc7, 0x41, 0xcc, 0x1e,
-  0x67, 0xcb, 0xfc, 0x9d, 0xe7, 0xab, 0x17, 0xd4, 0x7b, 0x37, 0x3d, 0xd4,
-  0xd9, 0xb0, 0x02, 0xad, 0x82, 0x7f, 0xb8, 0xff, 0x00, 0x34, 0xdd, 0x21,
-  0x91, 0x58, 0xb7, 0xa2, 0xb7, 0xf2, 0xc2, 0x52, 0xd2, 0xec, 0x03, 0xe5,
-  0xf6, 0x40, 0x30, 0xdd, 0x1b, 0x63, 0x55, 0x63, 0x05, 0xb9, 0xea, 0x90,
-  0x38, 0x4c, 0xf5, 0x12, 0x4c, 0x3f, 0x00, 0x3b, 0xa0, 0x79, 0xe0, 0xc1,
-  0x95, 0xbb, 0xc3, 0xbf, 0xc2, 0x45, 0x21, 0xc4, 0x00, 0xec, 0x78, 0x06,
-  0x61, 0xe6, 0x31, 0x70, 0x03, 0x7a, 0x11, 0xed, 0x6d, 0xe9, 0x12, 0xa9,
-  0x27, 0xd9, 0x28, 0x25, 0x0f, 0xe3, 0xd2, 0xf2, 0x83, 0xd3, 0xeb, 0xac,
-  0x81, 0xc1, 0xed, 0x30, 0x26, 0x16, 0xc8, 0x16, 0xb2, 0x54, 0xeb, 0xbf,
-  0x1a, 0x9c, 0x3f, 0xf2, 0x02, 0xf4, 0x44, 0x9c, 0x5c, 0xde, 0x7a, 0xc6,
-  0x08, 0xa5, 0x3c, 0xe9, 0xee, 0xe2, 0x2e, 0x5c, 0xec, 0xc4, 0xb1, 0x00,
-  0xe6, 0xee, 0x1d, 0x3a, 0x40, 0xc2, 0xfa, 0xd0, 0x0a, 0x34, 0xf5, 0xc6,
-  0x39, 0xbf, 0x51, 0x30, 0xf5, 0xc6, 0xd8, 0x0b, 0x4b, 0xde, 0xc8, 0x29,
-  0x9b, 0xdd, 0x1d, 0xdf, 0x33, 0x0b, 0x29, 0xf5, 0xd8, 0xf4, 0x29, 0xca,
-  0x3b, 0x08, 0x3a, 0x2a, 0xdd, 0xa1, 0xeb, 0x05, 0x0e, 0xe5, 0x60, 0x47,
-  0xdb, 0x81, 0x0f, 0xe2, 0x43, 0xd9, 0xc5, 0x43, 0x1d, 0x1a, 0xc3, 0x2a,
-  0xf0, 0x2b, 0x36, 0x45, 0x7f, 0x98, 0xf1, 0xb9, 0x25, 0xe0, 0x2c, 0x02,
-  0x12, 0x2a, 0x19, 0xa3, 0x4d, 0x93, 0xf7, 0x02, 0x04, 0x4c, 0x27, 0x2e,
-  0xb5, 0xbe, 0x32, 0xd4, 0x17, 0xf0, 0xaa, 0x51, 0xcd, 0x31, 0x2a, 0x3a,
-  0x10, 0x0c, 0xff, 0x47, 0xce, 0xcc, 0x27, 0xac, 0x2f, 0xe3, 0xb6, 0x3d,
-  0x2b, 0xc8, 0xd7, 0xf4, 0xca, 0x41, 0x43, 0xc4, 0x13, 0x15, 0x50, 0xda,
-  0x46, 0xe4, 0xc2, 0x4d, 0xe6, 0x19, 0xbc, 0xf8, 0xaf, 0xcb, 0xdb, 0x64,
-  0x2e, 0xda, 0x0c, 0xe4, 0x3f, 0x2d, 0x2f, 0x42, 0xdc, 0x64, 0xa5, 0x81,
-  0x69, 0x38, 0x2c, 0x15, 0x08, 0xf0, 0xe9, 0x1a, 0xb0, 0x45, 0x23, 0xf2,
-  0x33, 0x19, 0xe2, 0x66, 0x47, 0xf8, 0x2e, 0x39, 0x58, 0xd3, 0x02, 0x18,
-  0x33, 0x70, 0x17, 0xa5, 0x64, 0xb4, 0x36, 0x1d, 0xd8, 0x2a, 0x25, 0x30,
-  0x6a, 0x1c, 0xb8, 0x20, 0x4e, 0x5a, 0x4f, 0xd0, 0x04, 0x0a, 0x7d, 0x21,
-  0x30, 0xfb, 0x0f, 0x07, 0x4b, 0xf3, 0xdb, 0xd2, 0xc3, 0xc3, 0xf9, 0x0c,
-  0xe9, 0xd6, 0x10, 0x36, 0xa0, 0x9d, 0xa3, 0xd6, 0x9e, 0xd4, 0xad, 0x66,
-  0x13, 0x34, 0x4d, 0x01, 0xff, 0x07, 0xca, 0x01, 0x31, 0xe9, 0xc9, 0xe3,
-  0xe9, 0x81, 0x14, 0xe5, 0xed, 0x49, 0x3e, 0xd2, 0x1b, 0x40, 0x0b, 0xa8,
-  0x01, 0xa6, 0x2e, 0x2a, 0x17, 0xeb, 0xd4, 0xc1, 0xe6, 0xc4, 0xff, 0xc2,
-  0x2d, 0x81, 0xfb, 0x20, 0x29, 0xb7, 0xef, 0xa5, 0xd0, 0x21, 0xfb, 0x07,
-  0xfa, 0xbc, 0xec, 0xf2, 0x2d, 0x9b, 0xdf, 0x13, 0xff, 0xf4, 0xda, 0xb9,
-  0xf9, 0xd2, 0x39, 0x5a, 0xa6, 0x09, 0x5d, 0x3c, 0x1a, 0x11, 0x0e, 0xda,
-  0x0b, 0x1e, 0x53, 0xcf, 0x19, 0x18, 0xe3, 0xdc, 0x1c, 0xde, 0x34, 0x1d,
-  0x0b, 0x1e, 0xb6, 0xe3, 0xc4, 0xce, 0xee, 0xfd, 0xc7, 0x20, 0x59, 0xfd,
-  0x7f, 0xb5, 0xc7, 0x81, 0x2b, 0x8e, 0xd0, 0xeb, 0xcb, 0x06, 0x79, 0xd6,
-  0xb8, 0x16, 0xac, 0xf3, 0xaa, 0x5e, 0x1b, 0x5f, 0x55, 0x46, 0xdd, 0xc3,
-  0xa3, 0x2c, 0x77, 0x03, 0xdd, 0xc0, 0xec, 0x7a, 0xee, 0x10, 0xd9, 0x42,
-  0xd6, 0x5e, 0x00, 0x14, 0xd7, 0x94, 0x28, 0x5d, 0x40, 0x37, 0xe4, 0xb3,
-  0x3a, 0x06, 0x27, 0x70, 0xd2, 0x0c, 0xd6, 0xfc, 0xc6, 0xc0, 0x1f, 0xbd,
-  0xda, 0x44, 0x54, 0x60, 0xad, 0x2d, 0x10, 0xeb, 0xc1, 0xd9, 0xd1, 0x53,
-  0xfb, 0x0c, 0xcc, 0x94, 0xa9, 0x12, 0x22, 0xad, 0xfb, 0xf7, 0x14, 0x28,
-  0x77, 0xc3, 0x0e, 0x4c, 0xdf, 0xc8, 0x58, 0x2e, 0xe8, 0x35, 0x2a, 0xd8,
-  0x42, 0xdc, 0xac, 0x27, 0xb8, 0x5f, 0xdc, 0x39, 0x1d, 0x6b, 0x11, 0xdc,
-  0xb9, 0xf7, 0xda, 0x8b, 0xe2, 0xca, 0xf5, 0x81, 0xb2, 0x2a, 0xf2, 0xd2,
-  0x0d, 0x36, 0xf8, 0xda, 0x3e, 0xf6, 0xc2, 0x4c, 0xbf, 0x0b, 0xe8, 0xfe,
-  0x14, 0x44, 0xa6, 0xaf, 0x35, 0x0d, 0x02, 0xe9, 0x18, 0xbb, 0x37, 0x31,
-  0x21, 0xd4, 0xd8, 0xe8, 0xf0, 0x97, 0xfb, 0x50, 0x2d, 0xea, 0xd8, 0x3e,
-  0x40, 0x35, 0xeb, 0x3c, 0x81, 0x0b, 0x2c, 0xc9, 0xdf, 0xe5, 0x46, 0xaf,
-  0x14, 0xd0, 0xe6, 0xcd, 0x45, 0xb2, 0xbd, 0xaa, 0x54, 0xd0, 0x52, 0xcd,
-  0x3e, 0xcd, 0x16, 0x2d, 0x2d, 0x14, 0x2b, 0xe6, 0xd5, 0x61, 0x0d, 0xa9,
-  0xf3, 0x4d, 0x26, 0x12, 0xee, 0xa3, 0xfb, 0xf4, 0x8a, 0x19, 0xe8, 0x8a,
-  0xe8, 0x18, 0x16, 0xb1, 0xc9, 0xf1, 0xb1, 0xa5, 0xc2, 0x7f, 0x14, 0xb1,
-  0xc8, 0xe2, 0xcc, 0x04, 0x17, 0x51, 0x16, 0xbe, 0x18, 0x31, 0xd5, 0x55,
-  0x2b, 0xde, 0xba, 0xf9, 0x6e, 0x38, 0xca, 0x54, 0xc5, 0x1c, 0x2d, 0x44,
-  0x31, 0x1f, 0x30, 0xc2, 0xd7, 0xdd, 0xa9, 0x27, 0xf0, 0xdd, 0xb7, 0xf8,
-  0x20, 0xbe, 0x14, 0x75, 0x81, 0x37, 0xf9, 0xc5, 0x4d, 0xe8, 0x6b, 0x26,
-  0x62, 0x39, 0x1c, 0x44, 0x07, 0x49, 0x5b, 0x4f, 0xde, 0x26, 0xe3, 0x72,
-  0x5d, 0x9f, 0xc2, 0x56, 0x26, 0x54, 0xac, 0xe2, 0x66, 0xd1, 0x3d, 0xce,
-  0xa9, 0x0b, 0x38, 0x34, 0xac, 0xbe, 0xdc, 0x21, 0xfe, 0xc8, 0xe7, 0xf0,
-  0xd1, 0xe9, 0xb4, 0x3f, 0xd7, 0x5a, 0x9f, 0x3c, 0xb6, 0xb2, 0x1b, 0xa4,
-  0x4e, 0x5f, 0xee, 0x01, 0x0e, 0x3c, 0x39, 0xaf, 0xd7, 0xff, 0xfb, 0xcd,
-  0x1f, 0xeb, 0x2c, 0xc4, 0x1d, 0xd5, 0x30, 0xd2, 0xec, 0x15, 0x2a, 0x30,
-  0x17, 0x2b, 0xd1, 0xed, 0xa4, 0xce, 0xd0, 0x23, 0x3c, 0xd6, 0x28, 0xab,
-  0xf7, 0x17, 0xed, 0x38, 0xf8, 0x10, 0x57, 0x15, 0xc4, 0xc9, 0xe7, 0xe2,
-  0x2e, 0xaa, 0x20, 0x0c, 0xcb, 0xcb, 0x81, 0xc8, 0x02, 0x08, 0xf2, 0xe9,
-  0x1f, 0xf1, 0xc7, 0x9f, 0xc0, 0x4b, 0x0e, 0xb8, 0x31, 0x01, 0x5f, 0x41,
-  0x76, 0xe1, 0x07, 0x57, 0x33, 0x4b, 0xc2, 0x1b, 0x22, 0x12, 0xd8, 0x04,
-  0xfb, 0x53, 0xc6, 0x31, 0x44, 0xc8, 0x51, 0xf5, 0xa8, 0xa2, 0xe0, 0x4c,
-  0xa8, 0x4c, 0x5e, 0x4a, 0x20, 0xfc, 0xc2, 0x27, 0x35, 0xf5, 0xb3, 0xaa,
-  0x3e, 0x32, 0xfb, 0x7f, 0x9e, 0xff, 0xea, 0x35, 0x0f, 0x5a, 0x9d, 0xf5,
-  0xcc, 0xe7, 0xdc, 0x29, 0xe3, 0xf1, 0x5f, 0xf7, 0xb4, 0x33, 0xc5, 0x20,
-  0xc6, 0xc1, 0x0f, 0x38, 0x34, 0xdb, 0x49, 0xb0, 0xc4, 0x17, 0x1c, 0x03,
-  0x2b, 0xa7, 0x2d, 0x71, 0x0c, 0xe7, 0xca, 0xd6, 0x16, 0x2c, 0xca, 0x81,
-  0xe5, 0xfa, 0x0e, 0xdd, 0xad, 0xed, 0x38, 0xe5, 0xf3, 0x37, 0x4a, 0xd5,
-  0x2a, 0x1c, 0x4f, 0x1f, 0xd5, 0x25, 0xfe, 0xeb, 0x15, 0xac, 0x13, 0x1d,
-  0xea, 0x12, 0x01, 0xfc, 0x36, 0x0e, 0xc1, 0xdb, 0xed, 0x42, 0x1e, 0x3a,
-  0xb9, 0x04, 0xbd, 0x41, 0xb3, 0x57, 0x90, 0xcf, 0x58, 0x38, 0x33, 0x15,
-  0xd2, 0xf2, 0xfe, 0xb3, 0x4b, 0xaa, 0xcd, 0xc4, 0xc8, 0x9e, 0x49, 0xbc,
-  0xe6, 0xda, 0xb1, 0x30, 0x46, 0x7f, 0xda, 0x09, 0x17, 0xbf, 0x87, 0xb1,
-  0x97, 0x42, 0xfd, 0x0d, 0xf4, 0x42, 0x7a, 0xc0, 0xf1, 0xf5, 0xf8, 0xab,
-  0x68, 0x13, 0xad, 0xcc, 0x0c, 0x89, 0xfc, 0x76, 0xff, 0xa8, 0x13, 0x93,
-  0x7d, 0x1c, 0x48, 0x97, 0x0f, 0x22, 0x66, 0xff, 0x1b, 0x1e, 0xd7, 0x48,
-  0x3c, 0x56, 0x1e, 0x51, 0xe8, 0x2d, 0x77, 0x07, 0xdd, 0xed, 0xe4, 0xd3,
-  0xcc, 0xd0, 0x5d, 0xf9, 0xba, 0xb0, 0x13, 0xe9, 0x66, 0x6c, 0x31, 0x15,
-  0x4d, 0x4f, 0xb7, 0x25, 0x13, 0x2e, 0xdb, 0x23, 0xdf, 0xad, 0x92, 0xfb,
-  0x54, 0x63, 0xba, 0x55, 0x08, 0x3e, 0x98, 0x7f, 0xd3, 0x3a, 0xe1, 0xf9,
-  0x5f, 0x7d, 0x28, 0x5f, 0x20, 0x47, 0x03, 0x75, 0x01, 0x03, 0x0d, 0xdd,
-  0xd9, 0xb0, 0xcb, 0xf0, 0xfe, 0x41, 0x3f, 0xb3, 0xde, 0xc3, 0x93, 0x5e,
-  0xc5, 0xdb, 0xb4, 0xf8, 0x5e, 0x35, 0x00, 0x1e, 0xa5, 0x47, 0xd8, 0x21,
-  0xcb, 0xb6, 0xb2, 0x10, 0x57, 0xc2, 0x11, 0x57, 0x2d, 0x1b, 0xcb, 0x90,
-  0x63, 0x15, 0x08, 0x90, 0x10, 0x5e, 0x1a, 0x2a, 0x30, 0x19, 0xb1, 0x35,
-  0x45, 0x40, 0x00, 0x1f, 0xb3, 0xfa, 0x9b, 0x90, 0x57, 0x21, 0xd4, 0x09,
-  0xc3, 0x81, 0xc1, 0x11, 0xdd, 0x99, 0xe2, 0x9c, 0xe1, 0xd6, 0x41, 0xc1,
-  0x54, 0xf3, 0xc1, 0x40, 0x84, 0xe1, 0xcd, 0xd5, 0xc0, 0xdf, 0xec, 0x09,
-  0x0d, 0x3a, 0x0f, 0x50, 0xe8, 0xee, 0x24, 0xf1, 0xd3, 0x18, 0x81, 0xf2,
-  0x2e, 0x16, 0xd2, 0xe9, 0x0c, 0xd4, 0xdb, 0x1d, 0xf0, 0xff, 0xb3, 0x29,
-  0xcc, 0xb5, 0x8d, 0x55, 0x10, 0x42, 0xd9, 0xa7, 0xe1, 0xc6, 0x59, 0x44,
-  0xdc, 0x13, 0xeb, 0xf7, 0x3a, 0x49, 0x15, 0xd1, 0x21, 0xf7, 0x07, 0xb4,
-  0x37, 0xf3, 0xdd, 0x04, 0x00, 0x45, 0xf8, 0xdb, 0x84, 0x19, 0x2c, 0x2c,
-  0x28, 0x3e, 0x1e, 0x27, 0xac, 0xe0, 0xba, 0xf9, 0x32, 0x1d, 0xbf, 0x31,
-  0xe5, 0x63, 0x35, 0xe5, 0x00, 0x59, 0xe2, 0x90, 0xac, 0x5e, 0xad, 0x3b,
-  0xaa, 0x63, 0xee, 0xfa, 0xde, 0x55, 0x25, 0x68, 0xd1, 0xa5, 0xb6, 0xc5,
-  0xf3, 0x64, 0xdc, 0xd8, 0x27, 0x1f, 0x81, 0x7d, 0x2c, 0xf7, 0x8e, 0xa2,
-  0xed, 0xce, 0xf5, 0x28, 0xe5, 0x3c, 0xca, 0xd5, 0xde, 0xfd, 0x32, 0xd2,
-  0x06, 0x1a, 0x1b, 0x28, 0x31, 0x39, 0xea, 0x28, 0xbc, 0x1e, 0x2c, 0xf8,
-  0xc3, 0xe3, 0xfa, 0x7f, 0x0e, 0x2c, 0xf6, 0x1e, 0xf3, 0x2d, 0x13, 0xdc,
-  0x22, 0xf6, 0xfe, 0x1c, 0xd3, 0x21, 0x00, 0x1e, 0x42, 0xfc, 0x37, 0xce,
-  0x12, 0xe4, 0x03, 0x29, 0x42, 0xfd, 0xc5, 0xdf, 0xe4, 0x2c, 0xef, 0xf3,
-  0x27, 0xc1, 0x1e, 0x1b, 0x3b, 0xda, 0x1f, 0x5b, 0x24, 0xbf, 0xdc, 0x14,
-  0xfd, 0xd9, 0xf2, 0xde, 0x81, 0x56, 0x5f, 0x2f, 0x3a, 0x1d, 0xac, 0xdc,
-  0xcc, 0x40, 0x01, 0xdb, 0xd2, 0xa4, 0x1a, 0xde, 0x09, 0x15, 0x3a, 0xe0,
-  0x88, 0xd5, 0x21, 0x50, 0xbd, 0xf2, 0xef, 0x14, 0x00, 0x4c, 0xff, 0x39,
-  0xa9, 0xff, 0x31, 0x1e, 0xeb, 0x02, 0x32, 0x27, 0xab, 0xc3, 0x53, 0x6a,
-  0xf2, 0xf4, 0x40, 0xee, 0xb9, 0xb8, 0xb6, 0x01, 0xef, 0x28, 0x21, 0xdf,
-  0xd3, 0x19, 0xdd, 0x3e, 0x4a, 0x4d, 0xa8, 0xe3, 0x38, 0x03, 0xc0, 0xad,
-  0xed, 0x17, 0x00, 0xd9, 0x2c, 0x5b, 0x3c, 0x2b, 0x43, 0x4d, 0x10, 0x55,
-  0x91, 0x16, 0xc7, 0x3f, 0x22, 0xe3, 0xd1, 0xe9, 0xd8, 0xee, 0x00, 0x58,
-  0x32, 0x13, 0x61, 0x59, 0x74, 0xa2, 0x12, 0xf6, 0x27, 0x2a, 0x66, 0xb0,
-  0xc4, 0x16, 0xf2, 0x4a, 0xbe, 0x03, 0x15, 0xdf, 0xd7, 0x4c, 0x7f, 0x42,
-  0xce, 0x15, 0x33, 0x0f, 0xc9, 0x09, 0x12, 0xe7, 0xef, 0xd5, 0x22, 0xf8,
-  0x3d, 0xd1, 0x3d, 0xf4, 0x0f, 0x94, 0x39, 0xae, 0x54, 0x11, 0x4e, 0xa1,
-  0x29, 0xcf, 0xd1, 0x56, 0xcf, 0x04, 0x5d, 0xec, 0x01, 0x41, 0x48, 0xf9,
-  0xfc, 0xf2, 0x3b, 0x02, 0xb6, 0x25, 0x31, 0x32, 0x62, 0xc0, 0x13, 0x8e,
-  0x11, 0x2f, 0x2a, 0x7f, 0x41, 0xb9, 0xae, 0x9b, 0xad, 0xd7, 0xcf, 0x27,
-  0xea, 0x2f, 0xcb, 0x0d, 0xb1, 0x92, 0xe5, 0x81, 0x55, 0x22, 0xbb, 0x39,
-  0x3a, 0xa3, 0x6d, 0x44, 0x93, 0xd8, 0xad, 0x16, 0x21, 0xf5, 0x0d, 0xc1,
-  0xd6, 0xa7, 0x9f, 0xd7, 0x2a, 0x90, 0x1d, 0x60, 0xf8, 0xe4, 0x0b, 0x2d,
-  0xcd, 0xa5, 0xfb, 0xbe, 0x45, 0x06, 0x27, 0x4a, 0x2c, 0xca, 0xc0, 0x1d,
-  0x00, 0xee, 0x3b, 0x37, 0xc6, 0xc6, 0x10, 0x09, 0xd9, 0xb1, 0xc9, 0xd2,
-  0x37, 0x36, 0xc1, 0x35, 0x96, 0xe3, 0x56, 0x2e, 0x9f, 0xc3, 0x4e, 0x37,
-  0xa0, 0xc4, 0xe0, 0x26, 0x98, 0x2a, 0xba, 0x90, 0x70, 0x92, 0xcf, 0xbb,
-  0xfe, 0x1e, 0x57, 0x2f, 0xaa, 0x45, 0x09, 0xf7, 0xc7, 0xba, 0xc8, 0xcf,
-  0x25, 0xd0, 0x06, 0x10, 0xad, 0xc2, 0x6a, 0x64, 0xc0, 0xb1, 0xda, 0x0b,
-  0xab, 0x06, 0x90, 0xb0, 0x18, 0xc9, 0x21, 0xf9, 0x90, 0xb8, 0xfb, 0x81,
-  0xed, 0x39, 0xde, 0x2d, 0xcd, 0xb4, 0xfb, 0x02, 0xc1, 0xb2, 0xc2, 0xf9,
-  0x68, 0x01, 0x43, 0x56, 0x19, 0x0d, 0xe9, 0x04, 0xab, 0x40, 0x13, 0xbf,
-  0x15, 0xbc, 0xc1, 0xf3, 0xcc, 0x59, 0x1f, 0x4c, 0x1e, 0x03, 0xc0, 0xda,
-  0x47, 0xf3, 0xdc, 0x4f, 0x04, 0x4a, 0x1e, 0x32, 0x41, 0x7f, 0xf8, 0x40,
-  0xd5, 0xd0, 0x06, 0x00, 0xc5, 0x20, 0x10, 0x29, 0x34, 0x1d, 0xab, 0xe3,
-  0x5a, 0x57, 0x3c, 0xfb, 0x11, 0xd9, 0xf7, 0x14, 0xed, 0xdb, 0xaf, 0xf7,
-  0x0e, 0x58, 0x4a, 0xce, 0x2c, 0x41, 0xa2, 0xf6, 0x59, 0x43, 0x0e, 0x6b,
-  0x3f, 0x29, 0x0d, 0x90, 0x1d, 0x2b, 0xb0, 0x44, 0x58, 0x03, 0x0a, 0xda,
-  0x31, 0x49, 0xd6, 0x7d, 0xa3, 0x4c, 0xd6, 0x22, 0x4d, 0x06, 0x09, 0xd2,
-  0x7f, 0xeb, 0xe8, 0x7b, 0x4c, 0x1c, 0x5c, 0x4b, 0xc5, 0xd3, 0x08, 0xf4,
-  0xe1, 0x99, 0xcc, 0x45, 0x23, 0x1e, 0xf6, 0x49, 0x38, 0xce, 0xbf, 0x4b,
-  0x36, 0xc6, 0xcc, 0x4b, 0xa7, 0xf8, 0xc3, 0xe6, 0x26, 0x38, 0x23, 0x27,
-  0x81, 0x0b, 0x4f, 0xf7, 0xf5, 0x02, 0x4e, 0xe9, 0xe9, 0x2c, 0x61, 0x0d,
-  0xcc, 0xc4, 0x26, 0xc3, 0x30, 0xe3, 0x2b, 0xbf, 0x04, 0x16, 0xe8, 0xdb,
-  0x08, 0x32, 0x07, 0x15, 0xbd, 0x21, 0x48, 0x04, 0x55, 0xb7, 0x37, 0x0c,
-  0xcf, 0xe3, 0x15, 0x0f, 0x18, 0x00, 0xc6, 0xf9, 0x1c, 0xb3, 0x2c, 0x62,
-  0xe6, 0x39, 0x4e, 0xb4, 0xbf, 0x0b, 0xe1, 0xe9, 0xed, 0x17, 0x11, 0x53,
-  0x9d, 0x46, 0xed, 0xce, 0xeb, 0xd0, 0x22, 0x60, 0x1d, 0xb2, 0x4d, 0xf9,
-  0x4b, 0x2e, 0x39, 0x08, 0x43, 0xf2, 0xa4, 0xf4, 0xee, 0xdf, 0xd3, 0xba,
-  0xb3, 0xd7, 0x2e, 0x7f, 0xaa, 0xc3, 0xca, 0xfd, 0xfd, 0x84, 0x55, 0xd6,
-  0xdd, 0x3d, 0x16, 0xe7, 0xff, 0xdd, 0x4d, 0x3c, 0xf0, 0xf6, 0x77, 0xca,
-  0xf1, 0x59, 0xda, 0xb4, 0x6c, 0xc3, 0x53, 0xa7, 0xc3, 0x42, 0xf5, 0xfb,
-  0xf0, 0xab, 0xe8, 0xc0, 0xdf, 0x61, 0xe4, 0x47, 0x5f, 0x0d, 0xc0, 0x55,
-  0x38, 0xd9, 0x8c, 0xc3, 0x44, 0xc0, 0xed, 0xeb, 0x17, 0xc3, 0x25, 0x61,
-  0x35, 0xa2, 0x06, 0xe4, 0xd3, 0x57, 0x4d, 0x3d, 0x2f, 0x24, 0x7a, 0x48,
-  0x34, 0xb7, 0xc3, 0xe4, 0x33, 0x9f, 0x6a, 0x35, 0xe8, 0xd3, 0xf3, 0x4f,
-  0xdc, 0x6b, 0x5c, 0x42, 0xf5, 0x4a, 0x1b, 0x81, 0xbe, 0x4f, 0xbf, 0x71,
-  0xfb, 0xfc, 0x05, 0x22, 0xb3, 0x57, 0x5e, 0xee, 0x40, 0xf0, 0x2f, 0xeb,
-  0x4d, 0xd0, 0x39, 0x64, 0xb1, 0x47, 0xa8, 0x07, 0xa4, 0xc3, 0x3f, 0xa3,
-  0x32, 0xb3, 0x35, 0x06, 0xf3, 0x01, 0xfc, 0xa8, 0xfb, 0x2f, 0xbe, 0x4f,
-  0x0b, 0x30, 0xd8, 0x5d, 0x68, 0x55, 0xcd, 0xda, 0x7f, 0x3e, 0x16, 0xbc,
-  0xec, 0xf0, 0x44, 0x57, 0x20, 0xf7, 0xd3, 0xa1, 0x5a, 0x69, 0xba, 0xe4,
-  0x66, 0xec, 0x1b, 0xb3, 0xbb, 0xa8, 0xde, 0x26, 0x3a, 0x1e, 0x1c, 0xab,
-  0xfd, 0x60, 0x60, 0x98, 0x37, 0x20, 0x44, 0xa7, 0x01, 0x2c, 0x33, 0xac,
-  0x2e, 0x1d, 0x38, 0x3e, 0xed, 0xf7, 0xd3, 0xeb, 0x28, 0xc7, 0xfb, 0xf8,
-  0x24, 0xea, 0xf2, 0xfb, 0x21, 0xe2, 0xf7, 0xa2, 0x3e, 0x2b, 0x7f, 0xb7,
-  0x0c, 0xe5, 0x37, 0xdd, 0x1e, 0x24, 0x07, 0xb7, 0x44, 0xe3, 0x16, 0x34,
-  0xd0, 0xcd, 0xd6, 0x53, 0x47, 0x16, 0xf4, 0x09, 0x27, 0x1a, 0xc1, 0xf7,
-  0x68, 0x1b, 0xe6, 0x1a, 0xc9, 0xcf, 0xba, 0xa1, 0x47, 0xe2, 0xf5, 0x1a,
-  0xa5, 0xbc, 0x12, 0x2a, 0xb0, 0x63, 0x0d, 0xd1, 0xfd, 0x9d, 0xb9, 0xb0,
-  0xd7, 0xb9, 0x25, 0xca, 0xbb, 0xa3, 0x17, 0x42, 0x18, 0xe3, 0x02, 0x9d,
-  0xbb, 0x2f, 0x24, 0x1f, 0x5f, 0x0d, 0x44, 0x54, 0xe3, 0xc8, 0x05, 0x24,
-  0xa0, 0x0d, 0x59, 0x3b, 0x4d, 0x06, 0x71, 0xed, 0x71, 0xf6, 0xdc, 0xc9,
-  0x58, 0xb6, 0x57, 0xde, 0x81, 0x78, 0xdf, 0x49, 0x0a, 0x65, 0x0a, 0x12,
-  0xdb, 0xdf, 0x0d, 0x79, 0xfe, 0x15, 0xe9, 0xdc, 0x13, 0x3a, 0xf6, 0xee,
-  0x07, 0xb9, 0xd0, 0xcc, 0x57, 0x42, 0xcf, 0x50, 0xc2, 0xaf, 0x3b, 0x08,
-  0xc9, 0xea, 0x7d, 0xba, 0xe1, 0x29, 0x35, 0x5a, 0xc5, 0x12, 0x10, 0xb6,
-  0xa7, 0xf3, 0x99, 0xc5, 0xeb, 0xd6, 0x21, 0x1d, 0x35, 0x67, 0x81, 0xe4,
-  0x1e, 0xc1, 0xaf, 0xb2, 0x5d, 0x05, 0x5e, 0x63, 0x20, 0xe6, 0x25, 0x32,
-  0xd2, 0x25, 0x00, 0x8b, 0xcc, 0xb6, 0xf7, 0xcc, 0x5d, 0x29, 0x4e, 0xaa,
-  0xd5, 0xd7, 0xb9, 0x46, 0xda, 0x81, 0xaf, 0x05, 0x19, 0xd6, 0x8f, 0x70,
-  0x3f, 0xdd, 0xeb, 0x03, 0x2f, 0x95, 0x09, 0x19, 0x0e, 0x43, 0x5d, 0xbe,
-  0xa7, 0x11, 0x1e, 0x1f, 0x09, 0x00, 0xbf, 0x9d, 0x2f, 0x4d, 0xf1, 0x07,
-  0x08, 0xb7, 0xc0, 0xf3, 0xde, 0x4a, 0x4c, 0x46, 0xcf, 0x43, 0xe8, 0xcb,
-  0x0b, 0xb2, 0xf1, 0x41, 0x31, 0x00, 0x07, 0x00, 0x87, 0xe0, 0xa7, 0xae,
-  0x45, 0xda, 0x09, 0x1d, 0xe1, 0x3e, 0xe1, 0x51, 0xe8, 0x3a, 0x0b, 0xda,
-  0xbd, 0x26, 0xba, 0x0a, 0x6c, 0x9e, 0x4e, 0x08, 0xf7, 0x08, 0xe0, 0x43,
-  0x26, 0xac, 0xb5, 0x38, 0x39, 0x95, 0x13, 0x1c, 0x04, 0x57, 0xdf, 0xcf,
-  0xb5, 0xe4, 0x0c, 0x5b, 0x20, 0x82, 0xcb, 0xd2, 0xe5, 0x06, 0xfb, 0xa1,
-  0x15, 0xef, 0xa2, 0xd6, 0x7f, 0xa4, 0x5d, 0xe3, 0x4c, 0x1a, 0xf4, 0xe1,
-  0xc8, 0x42, 0xda, 0x0c, 0x45, 0xff, 0xef, 0xf1, 0xec, 0x81, 0x20, 0x3d,
-  0xae, 0x3f, 0xac, 0xee, 0xfa, 0x4d, 0xa5, 0xd0, 0x29, 0xee, 0x28, 0x43,
-  0xf7, 0xed, 0x05, 0xed, 0x41, 0xdb, 0x08, 0xfc, 0x66, 0x22, 0x4a, 0x19,
-  0x99, 0x67, 0x10, 0x25, 0xf7, 0xc6, 0x5f, 0x4b, 0x34, 0xef, 0xf6, 0x8f,
-  0xb5, 0xe0, 0xfe, 0xa6, 0x16, 0x0f, 0xe5, 0x2b, 0x40, 0xb4, 0x47, 0x96,
-  0xdb, 0x1a, 0xee, 0xea, 0x7f, 0x2b, 0xfc, 0xeb, 0x1b, 0x03, 0xf7, 0xd3,
-  0x0c, 0xc5, 0xc1, 0x41, 0xf6, 0x0e, 0xcb, 0x27, 0xdc, 0xea, 0xf6, 0xf1,
-  0xd1, 0x1b, 0xdd, 0xbc, 0x17, 0x46, 0xec, 0x1c, 0x69, 0x4d, 0xfc, 0xe4,
-  0xaa, 0xd5, 0xd7, 0xe6, 0x7e, 0x25, 0x03, 0xe6, 0x1f, 0x05, 0xe8, 0x4a,
-  0xff, 0xdb, 0x3d, 0x1f, 0x46, 0x0f, 0xe9, 0xa8, 0x0c, 0xb1, 0xc3, 0xbe,
-  0xcf, 0xe6, 0xe5, 0x05, 0x6e, 0x5a, 0x35, 0x51, 0x81, 0x53, 0x6f, 0x17,
-  0x4b, 0xf5, 0x77, 0xca, 0x60, 0xce, 0x19, 0x89, 0xa9, 0x58, 0xbf, 0x22,
-  0x0a, 0x38, 0x58, 0x1c, 0x3b, 0xd7, 0x01, 0x0f, 0xa1, 0x23, 0x2c, 0x22,
-  0x72, 0x00, 0xea, 0x87, 0xe0, 0x45, 0x5a, 0xba, 0xcb, 0x16, 0xfa, 0xe3,
-  0x71, 0xd5, 0xe7, 0x2b, 0xdc, 0x64, 0x4e, 0x00, 0x01, 0x5c, 0xfa, 0x3c,
-  0xbc, 0xcd, 0x3e, 0xa8, 0x34, 0xd1, 0x60, 0x8f, 0xdb, 0xd2, 0xf9, 0xa5,
-  0x2e, 0xb7, 0xcb, 0x26, 0xc4, 0xdf, 0xf8, 0xc4, 0xe1, 0x29, 0x23, 0x31,
-  0xf9, 0x9a, 0xdf, 0xf6, 0x18, 0xc7, 0xf9, 0xde, 0xe8, 0x52, 0xde, 0x52,
-  0xeb, 0xc6, 0x51, 0xa8, 0x03, 0x12, 0xee, 0xb9, 0x81, 0x20, 0xd7, 0xd5,
-  0xfd, 0x3b, 0xe6, 0xb9, 0xdf, 0x07, 0xfa, 0x44, 0x2f, 0x16, 0xec, 0xc2,
-  0x32, 0xd9, 0x3f, 0xfb, 0xf1, 0xcc, 0xe9, 0xe0, 0xc9, 0xe9, 0x51, 0x5a,
-  0x16, 0x42, 0x04, 0xb5, 0x45, 0x8f, 0x20, 0xc3, 0x26, 0xda, 0x0c, 0x2a,
-  0xed, 0x9e, 0x2e, 0x6b, 0x42, 0xb9, 0xdf, 0x45, 0xa2, 0x30, 0xc1, 0x64,
-  0xd8, 0xcf, 0xb6, 0xad, 0x18, 0xeb, 0x3c, 0xb8, 0x2b, 0xaa, 0x4a, 0x71,
-  0xfc, 0xc9, 0x11, 0xb6, 0xd7, 0x05, 0xbc, 0x1e, 0xbc, 0xfd, 0xe4, 0xf9,
-  0x23, 0xa1, 0xd7, 0x7f, 0xb9, 0x34, 0x06, 0xd5, 0x25, 0xc1, 0x90, 0xfa,
-  0x21, 0x27, 0x4a, 0xc6, 0x4a, 0x19, 0xa3, 0x2a, 0xac, 0x98, 0xd1, 0x50,
-  0xd3, 0x59, 0xf6, 0x41, 0x7f, 0xf8, 0x13, 0x3f, 0x62, 0xdd, 0x39, 0x26,
-  0x4f, 0x13, 0xa8, 0xe8, 0xd7, 0xe5, 0x90, 0x99, 0xd7, 0xf7, 0xea, 0xf9,
-  0xf6, 0xd9, 0x61, 0x42, 0x32, 0xa4, 0x1b, 0x4b, 0xe7, 0x42, 0xe8, 0xde,
-  0x49, 0xd1, 0x9e, 0xf6, 0x26, 0x44, 0x82, 0xae, 0xad, 0xc5, 0xe2, 0x33,
-  0xaf, 0x4d, 0x6a, 0x4d, 0x33, 0xbb, 0xce, 0xd4, 0xe9, 0xc6, 0x1e, 0x39,
-  0x06, 0x2f, 0x47, 0x06, 0xe8, 0xf1, 0x33, 0x47, 0x1b, 0x1a, 0xce, 0x13,
-  0x3f, 0x32, 0xc7, 0x0e, 0x02, 0x51, 0xbb, 0x47, 0xe0, 0xf0, 0x20, 0x51,
-  0x0f, 0xff, 0x26, 0x43, 0x6c, 0x35, 0xe1, 0x7f, 0x6e, 0x52, 0x61, 0x2d,
-  0xe6, 0xdc, 0xb2, 0xf9, 0xe0, 0x28, 0xeb, 0xf5, 0x9c, 0xde, 0x25, 0x16,
-  0x26, 0xd8, 0xc2, 0xb8, 0x4b, 0xe7, 0x3b, 0x30, 0x05, 0x30, 0x28, 0x10,
-  0x46, 0x2b, 0xdb, 0x33, 0x38, 0xea, 0x46, 0xe8, 0xc0, 0xd4, 0x5e, 0xc0,
-  0x5c, 0x25, 0x25, 0x1d, 0x48, 0xf2, 0x5f, 0xf6, 0x19, 0x20, 0x40, 0x36,
-  0xed, 0xcc, 0x0c, 0x4b, 0x15, 0x57, 0x54, 0x3a, 0x0d, 0x11, 0xbb, 0x23,
-  0x0f, 0x0f, 0xd1, 0x17, 0x96, 0x01, 0xd6, 0x11, 0xc8, 0x15, 0xde, 0x2f,
-  0x4d, 0x02, 0x30, 0xe4, 0xe5, 0x1d, 0xad, 0x59, 0xd1, 0x2a, 0xea, 0x7f,
-  0x14, 0x55, 0xbc, 0xa1, 0xa1, 0x69, 0xfd, 0xd6, 0xfb, 0xc2, 0xf2, 0xa0,
-  0x0f, 0x59, 0x57, 0x23, 0xaf, 0x03, 0xc2, 0x4a, 0xdb, 0xdd, 0x28, 0xf9,
-  0xc9, 0xe7, 0x60, 0xca, 0x47, 0xbd, 0xe7, 0x3f, 0xcf, 0x3c, 0xee, 0x53,
-  0xfc, 0x97, 0xe8, 0x29, 0x08, 0xbd, 0x05, 0x38, 0x86, 0xbf, 0x4a, 0x05,
-  0x25, 0x52, 0x7f, 0x0b, 0xb9, 0x4a, 0xa5, 0x37, 0x4c, 0x06, 0xdb, 0x1c,
-  0xa7, 0x01, 0xbb, 0x4b, 0x36, 0x5c, 0x49, 0xa4, 0x6f, 0xbe, 0x21, 0xe5,
-  0x7f, 0x5e, 0xfd, 0xff, 0xfc, 0x27, 0x19, 0x53, 0x2c, 0xce, 0xe9, 0x13,
-  0x38, 0x57, 0xa1, 0xf2, 0x17, 0x2d, 0x61, 0xe2, 0xc1, 0x53, 0xd3, 0xc7,
-  0x98, 0xae, 0xdb, 0x3a, 0x4e, 0xc4, 0xe7, 0xab, 0x89, 0xe0, 0xec, 0x54,
-  0xc5, 0x59, 0x09, 0xee, 0xcd, 0xb6, 0x38, 0x69, 0x1d, 0x30, 0x0d, 0x48,
-  0x3a, 0x03, 0xb8, 0x2f, 0x02, 0x15, 0xd0, 0xff, 0x0c, 0xe7, 0xd0, 0x00,
-  0x1f, 0x54, 0xcc, 0x30, 0x41, 0xb5, 0xd3, 0xa7, 0x46, 0xc6, 0xc6, 0xb0,
-  0xcc, 0x1a, 0x1f, 0xc8, 0x17, 0xc5, 0x3d, 0x4f, 0x12, 0x08, 0xf8, 0x16,
-  0xa5, 0x15, 0xc3, 0x48, 0xd5, 0xf0, 0x00, 0x2b, 0x44, 0x45, 0xe8, 0x18,
-  0x2b, 0xe1, 0xe3, 0xe6, 0xf9, 0x35, 0xf5, 0xd6, 0x05, 0x8e, 0x65, 0xe1,
-  0xd6, 0xce, 0x81, 0x3b, 0x45, 0x56, 0xbe, 0xe9, 0x40, 0xa9, 0xf4, 0xe0,
-  0x56, 0x26, 0x16, 0x2f, 0x3d, 0xc4, 0x12, 0x69, 0x3b, 0x52, 0x0e, 0xd0,
-  0x26, 0x42, 0xec, 0xee, 0xf6, 0x0a, 0x19, 0xcf, 0x16, 0xf3, 0x12, 0xc5,
-  0xd5, 0x31, 0x6c, 0x39, 0x1a, 0x3c, 0x26, 0x7f, 0x14, 0xcb, 0x1c, 0xa7,
-  0xb8, 0xc9, 0xe4, 0x7b, 0x95, 0x19, 0x49, 0xa5, 0xcb, 0xdd, 0xfc, 0x2d,
-  0xdb, 0xbb, 0xf6, 0xf7, 0x26, 0x4a, 0x35, 0x24, 0x37, 0xeb, 0x19, 0xc4,
-  0x6a, 0x39, 0x2d, 0x99, 0xd0, 0xf1, 0x0d, 0xf0, 0xc5, 0xe1, 0x14, 0x49,
-  0xf3, 0x13, 0x0f, 0x0d, 0xc9, 0x0e, 0x24, 0xe6, 0xe6, 0x1d, 0x7f, 0xed,
-  0xd2, 0x0d, 0xcf, 0x1e, 0xd0, 0xc8, 0xbf, 0x11, 0x29, 0xfa, 0x39, 0xe9,
-  0x40, 0xc4, 0xd1, 0xdc, 0x0b, 0x4e, 0xf0, 0xe1, 0xea, 0xeb, 0xde, 0xf3,
-  0x4a, 0xd8, 0xef, 0x62, 0x1e, 0xe8, 0x10, 0xf1, 0xfd, 0x15, 0xd2, 0xd7,
-  0x49, 0x39, 0xbc, 0x42, 0x55, 0xc5, 0x38, 0x2d, 0x4b, 0x0b, 0xb9, 0xc3,
-  0x54, 0xf6, 0xfa, 0x30, 0xf0, 0xed, 0xb8, 0x06, 0xe6, 0x28, 0xbd, 0x30,
-  0xc6, 0xce, 0xbd, 0x08, 0xa9, 0x38, 0xfe, 0xc6, 0xcf, 0x3b, 0xae, 0x04,
-  0x26, 0x7f, 0x36, 0xbe, 0x35, 0x1a, 0xf1, 0x3f, 0xce, 0xf7, 0xe1, 0x16,
-  0xa4, 0xaf, 0x4f, 0x2d, 0xe7, 0xae, 0x47, 0xd3, 0x1a, 0x41, 0x00, 0x68,
-  0x04, 0xed, 0x3e, 0x01, 0x34, 0x07, 0xe3, 0xdb, 0x59, 0x37, 0xef, 0x4a,
-  0x58, 0xe4, 0x1a, 0xcc, 0x06, 0x72, 0x0f, 0x23, 0x45, 0x62, 0x56, 0x08,
-  0x73, 0x5a, 0xef, 0xca, 0x38, 0x5d, 0x74, 0x8d, 0x3e, 0x48, 0xd3, 0x40,
-  0xea, 0xc3, 0xa3, 0x56, 0xea, 0xa2, 0x50, 0x55, 0x41, 0xae, 0x19, 0x3f,
-  0x86, 0x61, 0x42, 0xf5, 0x7f, 0xb8, 0xe0, 0x58, 0x45, 0xb8, 0xd1, 0x0f,
-  0x77, 0xe1, 0x8f, 0xd6, 0xc7, 0xd3, 0xf5, 0x22, 0x5e, 0x1c, 0x39, 0x4c,
-  0x7b, 0xee, 0x5c, 0x4a, 0xe0, 0x1b, 0xe3, 0xc8, 0x37, 0xef, 0x12, 0xd1,
-  0x15, 0x8e, 0xe2, 0x0f, 0x26, 0x1d, 0x06, 0x40, 0x68, 0x09, 0xaa, 0xec,
-  0x21, 0xb1, 0xe9, 0xbf, 0xe3, 0xd6, 0xc8, 0xe1, 0xe2, 0xd1, 0xe2, 0x90,
-  0xac, 0xa0, 0x11, 0xea, 0xf3, 0x38, 0xe7, 0x5b, 0x02, 0x33, 0xe0, 0x2c,
-  0xb6, 0xd9, 0xdc, 0xf4, 0xe2, 0x06, 0xc9, 0x30, 0x1c, 0x81, 0xd0, 0x21,
-  0x15, 0x10, 0xc2, 0xb4, 0x13, 0xca, 0xf5, 0xfe, 0xcf, 0x51, 0x1c, 0xdc,
-  0xd6, 0xd3, 0xea, 0x7f, 0xd3, 0xf3, 0x06, 0x61, 0x32, 0xf7, 0x30, 0x30,
-  0xe3, 0xe3, 0x19, 0x0b, 0xae, 0x04, 0xac, 0x25, 0x00, 0x3b, 0xad, 0x7b,
-  0x39, 0xd9, 0x26, 0xfb, 0xeb, 0x30, 0xe2, 0x4c, 0xd0, 0x56, 0x51, 0x6d,
-  0xf9, 0x16, 0xff, 0xe8, 0x68, 0xf9, 0x11, 0x58, 0xc2, 0xc6, 0x4d, 0xb8,
-  0xe4, 0x56, 0x08, 0x53, 0xfe, 0x18, 0x13, 0xf6, 0xe3, 0xdb, 0x24, 0xcb,
-  0xe7, 0x1f, 0x4a, 0x4c, 0x1e, 0x38, 0xbd, 0x99, 0x2a, 0x3c, 0x38, 0x2d,
-  0xd1, 0x36, 0x4d, 0x11, 0x92, 0xce, 0xdc, 0xe8, 0xe9, 0xa7, 0x15, 0x48,
-  0x33, 0x44, 0xad, 0xf6, 0xac, 0x08, 0x2d, 0x13, 0xe5, 0xb7, 0x32, 0xe7,
-  0x6d, 0xff, 0xbe, 0x1c, 0x0b, 0x2f, 0xd8, 0x03, 0x12, 0x1c, 0xb3, 0x42,
-  0x4a, 0xd9, 0x7f, 0x02, 0x55, 0xf0, 0x08, 0x1b, 0xcf, 0xe4, 0x31, 0xc6,
-  0xfa, 0xf6, 0x41, 0x2e, 0x42, 0x1f, 0x3d, 0xfa, 0x34, 0x11, 0xb2, 0x7f,
-  0x28, 0xc3, 0xa4, 0x36, 0x52, 0x57, 0x18, 0xb0, 0xe2, 0x05, 0xeb, 0xbb,
-  0xaa, 0xf1, 0x0e, 0xe1, 0xb6, 0x31, 0x5e, 0xa2, 0xd1, 0xcf, 0xf0, 0xfa,
-  0x11, 0xf8, 0x79, 0x34, 0x92, 0x0b, 0xbc, 0xe2, 0x2c, 0x3f, 0x53, 0x0c,
-  0x6d, 0x48, 0x0f, 0x27, 0xf6, 0x1f, 0x5d, 0x56, 0x1c, 0xd4, 0x1d, 0xee,
-  0x34, 0x70, 0xca, 0xba, 0x8f, 0x46, 0x6b, 0xee, 0x50, 0x71, 0x54, 0x95,
-  0xb2, 0xeb, 0xd7, 0x69, 0x31, 0xfd, 0x39, 0xdb, 0x46, 0x50, 0xef, 0x5b,
-  0x20, 0x0a, 0x12, 0xdc, 0xde, 0x57, 0x54, 0xd5, 0xc9, 0x21, 0x4a, 0x3d,
-  0x48, 0x4b, 0xb8, 0xe2, 0x01, 0x3d, 0x1a, 0x31, 0x44, 0x18, 0xbb, 0x61,
-  0x3a, 0x3e, 0xae, 0x07, 0xbf, 0x43, 0x4e, 0xba, 0x51, 0xe6, 0x46, 0xc8,
-  0x00, 0x0f, 0x7f, 0xac, 0x25, 0x97, 0xfe, 0x1c, 0xd4, 0x2f, 0xad, 0x3b,
-  0x00, 0x56, 0x31, 0xfe, 0x4f, 0x14, 0xba, 0x4c, 0xf9, 0x40, 0x25, 0x46,
-  0xae, 0x01, 0x53, 0x43, 0x08, 0x36, 0xdb, 0x1c, 0xad, 0xfd, 0xf8, 0xce,
-  0xe6, 0x35, 0xb6, 0xd0, 0xf0, 0xf5, 0x25, 0xed, 0x1e, 0x47, 0xf6, 0xee,
-  0xb9, 0x9d, 0xe1, 0xdb, 0x33, 0x97, 0x34, 0x24, 0x70, 0xee, 0xe3, 0x7f,
-  0xdc, 0xff, 0xfc, 0xc1, 0x30, 0x0d, 0xff, 0xff, 0xf9, 0x04, 0xbd, 0xcb,
-  0xb8, 0x34, 0xfb, 0x30, 0xb6, 0xec, 0x0b, 0xfb, 0x13, 0x10, 0xd4, 0xda,
-  0x32, 0xf7, 0xef, 0x01, 0xfd, 0x05, 0xf8, 0xbf, 0x21, 0xd1, 0x07, 0xe1,
-  0x04, 0xff, 0x22, 0xdf, 0xeb, 0x29, 0x2d, 0x08, 0x0b, 0x38, 0x30, 0x33,
-  0xeb, 0x00, 0x4e, 0x1a, 0x09, 0x02, 0x1d, 0x7f, 0xc0, 0x0e, 0x14, 0x06,
-  0xdc, 0xe3, 0x06, 0xe0, 0xcd, 0xd2, 0xf3, 0x36, 0xab, 0xc8, 0x0f, 0xfb,
-  0x0d, 0xb3, 0xed, 0xf8, 0xda, 0x17, 0x03, 0x0c, 0xe4, 0xce, 0x1c, 0x2d,
-  0x2b, 0x9d, 0xee, 0x99, 0xdc, 0xfc, 0xdc, 0x15, 0x45, 0xb5, 0xb4, 0xbd,
-  0xf2, 0xba, 0xcb, 0x9f, 0xcc, 0xcc, 0x4a, 0x4d, 0xfc, 0x1a, 0x46, 0x05,
-  0x1d, 0xc0, 0xe6, 0xa3, 0x62, 0x11, 0x5c, 0x65, 0x33, 0x81, 0x0f, 0xc1,
-  0x46, 0x2c, 0x02, 0xf4, 0xa7, 0x24, 0xc7, 0x63, 0x0b, 0x3d, 0xcf, 0xbe,
-  0x27, 0xda, 0xe2, 0x9d, 0xcf, 0x38, 0xc5, 0x3e, 0xb0, 0xe8, 0x58, 0x4e,
-  0xfb, 0xfe, 0xde, 0xcc, 0xf8, 0xc5, 0xfb, 0x21, 0x41, 0x36, 0x4b, 0xdb,
-  0xf8, 0x07, 0x4d, 0x0c, 0xf6, 0x0d, 0xee, 0xf8, 0x10, 0x1d, 0xeb, 0x05,
-  0xb0, 0x39, 0xc2, 0xed, 0x07, 0x6e, 0xdd, 0x06, 0xf2, 0xc0, 0x0e, 0x27,
-  0xd4, 0x05, 0x40, 0x2d, 0x9f, 0xb2, 0xfd, 0x10, 0x01, 0xe1, 0xb7, 0x0f,
-  0xe2, 0x13, 0xf9, 0xc5, 0x51, 0xad, 0x30, 0x57, 0x3c, 0x7f, 0xee, 0x12,
-  0xa7, 0xd2, 0xce, 0xd9, 0x3f, 0xf1, 0x48, 0xe4, 0xe2, 0xbf, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x22, 0xfe, 0xff, 0xff,
-  0xd7, 0xff, 0xff, 0xff, 0x4a, 0x14, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff,
-  0x32, 0x0c, 0x00, 0x00, 0xa5, 0x0c, 0x00, 0x00, 0xad, 0xf4, 0xff, 0xff,
-  0xbf, 0xe5, 0xff, 0xff, 0xd7, 0x05, 0x00, 0x00, 0x61, 0x16, 0x00, 0x00,
-  0x9a, 0xfb, 0xff, 0xff, 0xeb, 0x06, 0x00, 0x00, 0x4d, 0x05, 0x00, 0x00,
-  0x76, 0x09, 0x00, 0x00, 0xd0, 0xef, 0xff, 0xff, 0xc7, 0x15, 0x00, 0x00,
-  0x34, 0xe9, 0xff, 0xff, 0x8c, 0x01, 0x00, 0x00, 0x58, 0x12, 0x00, 0x00,
-  0x22, 0xd6, 0xff, 0xff, 0xf8, 0x0b, 0x00, 0x00, 0x3f, 0x13, 0x00, 0x00,
-  0x08, 0xff, 0xff, 0xff, 0xae, 0xf4, 0xff, 0xff, 0xb6, 0xfd, 0xff, 0xff,
-  0x0d, 0xe6, 0xff, 0xff, 0x6a, 0x04, 0x00, 0x00, 0x8e, 0x18, 0x00, 0x00,
-  0x1a, 0x2b, 0x00, 0x00, 0xc5, 0xe8, 0xff, 0xff, 0x9d, 0xe8, 0xff, 0xff,
-  0x5b, 0xfb, 0xff, 0xff, 0x7c, 0x10, 0x00, 0x00, 0xa7, 0xe5, 0xff, 0xff,
-  0x43, 0xf6, 0xff, 0xff, 0x48, 0xf3, 0xff, 0xff, 0x4a, 0x0b, 0x00, 0x00,
-  0x78, 0xff, 0xff, 0xff, 0x0e, 0x16, 0x00, 0x00, 0xe4, 0x10, 0x00, 0x00,
-  0x06, 0x06, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xf7, 0xde, 0xff, 0xff,
-  0x18, 0x18, 0x00, 0x00, 0x94, 0x10, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
-  0x3e, 0xe1, 0xff, 0xff, 0x92, 0xe1, 0xff, 0xff, 0x2f, 0xfa, 0xff, 0xff,
-  0xe4, 0xec, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0x7b, 0xf3, 0xff, 0xff,
-  0xd7, 0xfb, 0xff, 0xff, 0xd1, 0xf6, 0xff, 0xff, 0x50, 0xd7, 0xff, 0xff,
-  0x71, 0x1a, 0x00, 0x00, 0x16, 0xeb, 0xff, 0xff, 0x17, 0xf7, 0xff, 0xff,
-  0x85, 0xe7, 0xff, 0xff, 0xaa, 0xdb, 0xff, 0xff, 0xc0, 0x02, 0x00, 0x00,
-  0x86, 0x01, 0x00, 0x00, 0xf8, 0x0d, 0x00, 0x00, 0x17, 0xf8, 0xff, 0xff,
-  0xee, 0xc0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0x20, 0x7a, 0x0b, 0x3c, 0xca, 0x07, 0xf3, 0x2a, 0x38, 0x83, 0x17, 0x96,
-  0x7f, 0x34, 0xe5, 0x81, 0xed, 0xa0, 0x7f, 0x7f, 0x31, 0x21, 0xea, 0xb4,
-  0x6a, 0x4a, 0x39, 0x7f, 0xa6, 0x40, 0x2c, 0x7f, 0xd8, 0x1f, 0x7f, 0x81,
-  0xea, 0xa9, 0x2b, 0x3f, 0x23, 0x05, 0xd5, 0x7f, 0x27, 0x58, 0x2d, 0xb5,
-  0x4f, 0x18, 0x7b, 0x79, 0xd8, 0x81, 0xd6, 0x7f, 0x81, 0x02, 0x7f, 0xf9,
-  0x99, 0x7f, 0xf5, 0x3d, 0x07, 0x7f, 0x3a, 0xf1, 0x81, 0xe9, 0x7f, 0xcb,
-  0xcb, 0x81, 0x15, 0x34, 0xcb, 0x48, 0xc3, 0xe9, 0x7f, 0x7f, 0x33, 0xa2,
-  0x41, 0xf7, 0xf5, 0xb7, 0x5a, 0xa2, 0x81, 0x18, 0x1d, 0xed, 0xd8, 0xe4,
-  0x1c, 0xaf, 0xa4, 0x1d, 0xf0, 0xd1, 0xfc, 0xd6, 0xc7, 0x03, 0x7f, 0x4c,
-  0x7f, 0x81, 0xe9, 0x4b, 0xf2, 0x4c, 0x2b, 0xc5, 0xf2, 0xe3, 0x1e, 0x03,
-  0x9d, 0x1d, 0xe8, 0xf6, 0xcf, 0x1b, 0x81, 0x14, 0x13, 0xe8, 0x1e, 0x81,
-  0x8c, 0xa7, 0x2d, 0x9e, 0x4c, 0x04, 0x2e, 0xaa, 0xee, 0x7f, 0xfe, 0xfb,
-  0x8f, 0xcd, 0x0e, 0x17, 0xd5, 0x86, 0x7f, 0x7f, 0xa8, 0xa3, 0xbf, 0x50,
-  0x18, 0xdd, 0x04, 0xe2, 0x4b, 0xf5, 0xd2, 0x2f, 0x15, 0xde, 0xe9, 0xee,
-  0x49, 0x4e, 0x98, 0x82, 0x32, 0x01, 0x8f, 0x7f, 0x2b, 0xde, 0x01, 0xa1,
-  0x43, 0x89, 0x01, 0xf2, 0x9b, 0x81, 0xf5, 0x84, 0x7f, 0xc8, 0xd8, 0x90,
-  0x23, 0x4f, 0xe9, 0x4c, 0x1e, 0xfa, 0xd3, 0x7f, 0xf7, 0x4e, 0xe4, 0x2c,
-  0x16, 0x45, 0xa7, 0x12, 0xa5, 0xa1, 0x23, 0x4a, 0x7f, 0x76, 0xfd, 0xef,
-  0x7f, 0xed, 0xf7, 0x31, 0xb4, 0x81, 0x7f, 0x5b, 0x61, 0x7f, 0x10, 0xa7,
-  0x4f, 0xd5, 0x9d, 0x81, 0x7f, 0xa3, 0x56, 0x3f, 0xae, 0x25, 0xe1, 0xb4,
-  0xa8, 0xd3, 0xe0, 0x5e, 0x94, 0x37, 0x0e, 0x34, 0x97, 0x1a, 0x6a, 0xdc,
-  0xb8, 0x27, 0x3c, 0x1b, 0xf8, 0x63, 0x3a, 0x0d, 0x92, 0x57, 0xf2, 0xfb,
-  0xe0, 0x7a, 0xeb, 0x20, 0xf6, 0xf1, 0x81, 0x2e, 0xff, 0x33, 0x1e, 0x00,
-  0x2a, 0x3e, 0xfb, 0x07, 0x75, 0x81, 0x14, 0xd3, 0x3d, 0x82, 0xeb, 0xc8,
-  0x7f, 0x7b, 0xda, 0x05, 0xee, 0x3e, 0xb4, 0x92, 0x5c, 0x8e, 0xc9, 0x76,
-  0xbf, 0xe0, 0xa6, 0x6d, 0x37, 0x21, 0x40, 0x02, 0x8e, 0x3d, 0x56, 0x18,
-  0xc7, 0xb8, 0x02, 0x2b, 0x25, 0x04, 0xa8, 0x32, 0xf5, 0x07, 0xbf, 0x3a,
-  0xff, 0x7f, 0x6b, 0xe2, 0xd4, 0xc3, 0x3b, 0x8e, 0x05, 0x34, 0xa8, 0x26,
-  0xb9, 0x26, 0xeb, 0x15, 0x54, 0xd2, 0x27, 0x5c, 0xdd, 0xde, 0x62, 0x10,
-  0x0a, 0x83, 0xdc, 0xe1, 0xe8, 0x46, 0x33, 0x3f, 0x7f, 0x02, 0x0b, 0xfe,
-  0xc8, 0x56, 0xd3, 0x99, 0x15, 0x4c, 0x81, 0x38, 0x7f, 0x81, 0x89, 0x1b,
-  0x73, 0x02, 0x1f, 0xf6, 0x9d, 0xac, 0xb6, 0xfe, 0xd3, 0x1c, 0xdc, 0xca,
-  0xf5, 0x2c, 0x81, 0x8f, 0x03, 0xcf, 0x21, 0xa5, 0x2e, 0x06, 0xb7, 0x29,
-  0x16, 0xc7, 0x07, 0xea, 0xcd, 0x4f, 0xf2, 0x09, 0xd5, 0x7f, 0xf7, 0xf1,
-  0x1f, 0xef, 0x2f, 0x7e, 0x31, 0xcc, 0x33, 0x0b, 0xc0, 0x4a, 0x63, 0xab,
-  0x77, 0x4c, 0xb9, 0xdd, 0x33, 0x1a, 0xfa, 0x1d, 0xd8, 0x54, 0xd7, 0xa4,
-  0xea, 0x07, 0xd5, 0x8d, 0xf3, 0x13, 0xb8, 0xfd, 0x34, 0x19, 0x42, 0xb3,
-  0x02, 0xbd, 0xd5, 0x7f, 0xdf, 0xac, 0xca, 0x2c, 0xe9, 0x73, 0x11, 0xf0,
-  0x81, 0x01, 0x9f, 0x7f, 0x35, 0xe5, 0xdd, 0x17, 0xf8, 0xac, 0x10, 0x16,
-  0x38, 0xff, 0xc4, 0x11, 0xde, 0xf4, 0xa3, 0x31, 0x7f, 0x15, 0xe7, 0x0a,
-  0x27, 0xea, 0xbc, 0x6a, 0xfb, 0x25, 0xd1, 0x11, 0x18, 0x08, 0xc1, 0xed,
-  0x9f, 0x46, 0xee, 0x01, 0x10, 0x35, 0x31, 0x7f, 0xe2, 0x7b, 0xc9, 0x4b,
-  0xc0, 0x2a, 0xc1, 0x2a, 0xb9, 0xc0, 0x1f, 0x3e, 0x81, 0x09, 0xb6, 0xb0,
-  0xe9, 0x64, 0x07, 0x14, 0xc9, 0x36, 0x7f, 0x90, 0xef, 0xda, 0xfc, 0x10,
-  0xab, 0xd7, 0x1a, 0xf2, 0x00, 0x23, 0x34, 0xc4, 0x87, 0xff, 0x3e, 0x31,
-  0x7d, 0xa8, 0xc8, 0xc5, 0x62, 0x1b, 0x2f, 0xe5, 0x1e, 0x81, 0x81, 0x03,
-  0xd5, 0x7f, 0xd2, 0x11, 0x20, 0xd9, 0xa2, 0x69, 0x58, 0x91, 0x81, 0x09,
-  0x81, 0xc9, 0x7f, 0xfd, 0xc2, 0xb0, 0x33, 0x81, 0xa4, 0xc8, 0xcc, 0xca,
-  0x3a, 0xc3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x29, 0x02, 0x00, 0x00, 0x3b, 0xf5, 0xff, 0xff, 0x44, 0x06, 0x00, 0x00,
-  0xf1, 0x01, 0x00, 0x00, 0x50, 0x0d, 0x00, 0x00, 0xb6, 0xf7, 0xff, 0xff,
-  0xe3, 0xf8, 0xff, 0xff, 0xd1, 0x01, 0x00, 0x00, 0x5d, 0x06, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0x3a, 0x03, 0x00, 0x00,
-  0x49, 0xfc, 0xff, 0xff, 0x7b, 0xf9, 0xff, 0xff, 0x4c, 0x0e, 0x00, 0x00,
-  0xa5, 0x01, 0x00, 0x00, 0xf9, 0x0a, 0x00, 0x00, 0x4a, 0x02, 0x00, 0x00,
-  0x05, 0xf8, 0xff, 0xff, 0x57, 0xfa, 0xff, 0xff, 0xa0, 0xf3, 0xff, 0xff,
-  0x63, 0xf9, 0xff, 0xff, 0x9e, 0xfc, 0xff, 0xff, 0x59, 0xff, 0xff, 0xff,
-  0x53, 0xfb, 0xff, 0xff, 0xa6, 0x0c, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00,
-  0x32, 0xef, 0xff, 0xff, 0x11, 0xf7, 0xff, 0xff, 0xdf, 0x0d, 0x00, 0x00,
-  0x80, 0xfd, 0xff, 0xff, 0x59, 0x01, 0x00, 0x00, 0x42, 0xf5, 0xff, 0xff,
-  0x20, 0xf3, 0xff, 0xff, 0xf1, 0xfc, 0xff, 0xff, 0x1a, 0x02, 0x00, 0x00,
-  0xff, 0xf4, 0xff, 0xff, 0xdf, 0x02, 0x00, 0x00, 0xcf, 0x0d, 0x00, 0x00,
-  0x88, 0x07, 0x00, 0x00, 0x2c, 0xf7, 0xff, 0xff, 0x44, 0xfb, 0xff, 0xff,
-  0x4c, 0x04, 0x00, 0x00, 0xf6, 0xf7, 0xff, 0xff, 0x02, 0x02, 0x00, 0x00,
-  0xe2, 0xfb, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0xf8, 0xf9, 0xff, 0xff,
-  0x22, 0xf8, 0xff, 0xff, 0xf4, 0x03, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1c, 0xfc, 0xff, 0xff, 0x49, 0x09, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff,
-  0xfb, 0xfb, 0xff, 0xff, 0xa5, 0xf8, 0xff, 0xff, 0x66, 0x16, 0x00, 0x00,
-  0xea, 0x08, 0x00, 0x00, 0x16, 0xfc, 0xff, 0xff, 0x4e, 0x09, 0x00, 0x00,
-  0x7b, 0x05, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0x5d, 0x0a, 0x00, 0x00,
-  0xc9, 0xfc, 0xff, 0xff, 0x46, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0xaf, 0x27, 0xf4, 0xf1, 0x5b, 0x55, 0x3b, 0xf3,
-  0xbd, 0x62, 0xe6, 0xa3, 0xcf, 0x53, 0x56, 0x9a, 0x2f, 0x89, 0x65, 0x28,
-  0x36, 0xec, 0xf4, 0xa6, 0x0e, 0x03, 0xce, 0x7b, 0x47, 0x02, 0x3c, 0x27,
-  0xe2, 0x2e, 0xf9, 0x48, 0x10, 0xc0, 0xaa, 0xc6, 0xdc, 0xff, 0x46, 0x5c,
-  0x7f, 0xaa, 0xa3, 0x00, 0xad, 0xb7, 0x45, 0x06, 0x16, 0xd1, 0xa8, 0x04,
-  0x7e, 0x37, 0x8e, 0xc1, 0x1d, 0x6f, 0xfc, 0x30, 0xae, 0xb0, 0x0a, 0x26,
-  0xb9, 0xf5, 0x18, 0xf7, 0x41, 0x29, 0x33, 0xb6, 0x60, 0x6d, 0x4a, 0xcf,
-  0xc7, 0x10, 0x32, 0x3d, 0x0a, 0x55, 0x32, 0x43, 0x2a, 0xd9, 0xde, 0x50,
-  0xe8, 0xd5, 0x1a, 0x27, 0xec, 0xe3, 0x32, 0x03, 0xbf, 0x09, 0x95, 0x4f,
-  0xe8, 0x09, 0x40, 0xe9, 0xd3, 0xb2, 0x85, 0xc7, 0x62, 0xca, 0x35, 0xd1,
-  0x18, 0x6d, 0x15, 0x0a, 0x2b, 0x81, 0xc2, 0xdc, 0x3b, 0x1e, 0x4a, 0x44,
-  0x17, 0x01, 0xec, 0xbf, 0xea, 0x38, 0x42, 0x1c, 0x4a, 0xf4, 0xdb, 0xbf,
-  0x9a, 0xc1, 0x3c, 0x41, 0x19, 0x6b, 0xd2, 0x75, 0xe3, 0x13, 0x5a, 0x50,
-  0x20, 0x2a, 0x3e, 0xba, 0xcb, 0x0a, 0x34, 0xe4, 0xf1, 0x3b, 0x55, 0x22,
-  0x70, 0x0a, 0xd4, 0x97, 0xee, 0x3a, 0xc0, 0x51, 0x0f, 0x5d, 0xd1, 0xda,
-  0x01, 0x0f, 0xfd, 0x3e, 0x38, 0x81, 0xe9, 0x0b, 0x9d, 0x2e, 0x0d, 0x0a,
-  0x03, 0x22, 0x84, 0x5e, 0xb0, 0x59, 0xcf, 0x48, 0x5a, 0x41, 0x1b, 0x05,
-  0xa2, 0xf3, 0xe8, 0x7f, 0xa6, 0x51, 0x9b, 0xfe, 0xb2, 0x30, 0xaf, 0x44,
-  0x3c, 0xa2, 0xef, 0xdd, 0xe9, 0x6b, 0xdf, 0x09, 0x2e, 0x20, 0x66, 0xec,
-  0x2e, 0x46, 0x01, 0x3b, 0xde, 0x16, 0x34, 0x10, 0xc9, 0xcf, 0x29, 0xa7,
-  0xc7, 0xf2, 0x34, 0x40, 0x1d, 0x0e, 0xf5, 0xfe, 0x38, 0xee, 0x05, 0x44,
-  0xf1, 0xfd, 0xaa, 0xfd, 0x34, 0x4f, 0x3e, 0x23, 0x19, 0xc6, 0xbd, 0x34,
-  0x29, 0xb8, 0x0a, 0x68, 0xa5, 0xba, 0x92, 0xe9, 0xc2, 0x2b, 0xb1, 0x14,
-  0x26, 0x30, 0xee, 0xe3, 0xba, 0xbc, 0xd1, 0xbe, 0xd0, 0xcf, 0xcb, 0xd2,
-  0xd4, 0x5a, 0x30, 0x79, 0xc6, 0xc2, 0x3d, 0xb6, 0xc0, 0xf1, 0x1f, 0x05,
-  0xd2, 0x4f, 0xb5, 0xcc, 0xc3, 0xe5, 0x08, 0x16, 0x8b, 0xc5, 0x41, 0x0b,
-  0x01, 0xf4, 0x1a, 0x36, 0x09, 0x07, 0xa8, 0xce, 0x00, 0x81, 0x41, 0xc0,
-  0x5c, 0xfc, 0x28, 0x00, 0x57, 0xc3, 0x56, 0x30, 0x48, 0xfe, 0x17, 0xbb,
-  0x11, 0xe2, 0x6f, 0xed, 0x24, 0x25, 0x32, 0xca, 0xf2, 0x14, 0xce, 0xb5,
-  0xcd, 0xb0, 0x04, 0xdc, 0xf1, 0x04, 0xeb, 0x02, 0x03, 0x37, 0x27, 0x04,
-  0x59, 0xef, 0x15, 0xda, 0xb4, 0xff, 0xea, 0x7f, 0xdc, 0xcb, 0xa5, 0xd6,
-  0xc5, 0x5c, 0xd2, 0xd0, 0x0c, 0x3a, 0x51, 0x1f, 0x0c, 0xc8, 0xcf, 0xfc,
-  0x35, 0xbc, 0xf2, 0xc7, 0xd1, 0xd1, 0x3b, 0xfb, 0xce, 0xd6, 0x25, 0x41,
-  0x22, 0x2f, 0x1e, 0x2f, 0xb3, 0x14, 0xe2, 0x47, 0xd5, 0xaf, 0xf6, 0xe9,
-  0x20, 0xad, 0xb3, 0xb8, 0xf2, 0x03, 0xcd, 0x2a, 0xd1, 0x20, 0x81, 0xf5,
-  0xd1, 0x24, 0x01, 0xe6, 0xe7, 0x59, 0xa4, 0xe4, 0xe3, 0xe6, 0xc2, 0x18,
-  0xa3, 0x0b, 0xf1, 0x57, 0xf8, 0x1f, 0x33, 0xdb, 0x19, 0xbf, 0x22, 0x05,
-  0x35, 0xad, 0xc3, 0xe7, 0x1b, 0xe1, 0x2c, 0x5f, 0xd0, 0xd2, 0x7a, 0x3d,
-  0xe7, 0x48, 0x4e, 0xf4, 0x2f, 0xed, 0x5b, 0x05, 0x5d, 0x39, 0x66, 0x62,
-  0xba, 0xb1, 0x01, 0x4b, 0xf3, 0x86, 0xa0, 0xa0, 0x43, 0x8f, 0x2d, 0xe8,
-  0xbc, 0x71, 0x0e, 0xc2, 0x21, 0xbf, 0xcd, 0xfd, 0x34, 0xd3, 0x10, 0xa8,
-  0x00, 0xa0, 0x04, 0x8f, 0x0e, 0x7f, 0x36, 0x9f, 0x0a, 0xbb, 0xa5, 0x64,
-  0xe6, 0x9a, 0x01, 0xf1, 0xf2, 0x73, 0x5f, 0xa6, 0xee, 0x31, 0x7d, 0xf3,
-  0x1a, 0xe8, 0x0c, 0xc7, 0xee, 0x1e, 0x10, 0x81, 0x03, 0x13, 0xb8, 0xdd,
-  0x13, 0xc9, 0x04, 0xd2, 0xad, 0xd0, 0xac, 0x2b, 0xc3, 0xb7, 0xa8, 0xea,
-  0xbf, 0x03, 0x85, 0xdd, 0xde, 0x39, 0x23, 0x06, 0x16, 0xfa, 0xcf, 0x11,
-  0xef, 0x4c, 0x0b, 0xc0, 0x56, 0x2d, 0x0e, 0x3e, 0xd5, 0x3b, 0xf9, 0x02,
-  0xa7, 0x28, 0x03, 0xa4, 0x0a, 0x21, 0xee, 0xc8, 0x12, 0xf3, 0xc1, 0x34,
-  0xc2, 0xc3, 0x13, 0x8f, 0x29, 0x53, 0x6c, 0xb1, 0x46, 0x08, 0x09, 0x73,
-  0xee, 0x5d, 0x0d, 0x34, 0xaf, 0x43, 0xee, 0x01, 0xb6, 0xb0, 0x3a, 0x25,
-  0x06, 0xc2, 0xac, 0x47, 0xef, 0xce, 0xd8, 0x3e, 0x6a, 0x0f, 0xf1, 0x1a,
-  0x17, 0xd4, 0x08, 0xe9, 0x40, 0xd6, 0xd8, 0x7f, 0x3d, 0x3f, 0x47, 0x03,
-  0xe4, 0xbf, 0xf9, 0x45, 0x2a, 0x2f, 0x42, 0xb8, 0xf3, 0xc9, 0x91, 0xe2,
-  0xe7, 0x09, 0xce, 0xb0, 0x13, 0xd4, 0x46, 0xd1, 0xfc, 0x23, 0x75, 0x95,
-  0x23, 0x19, 0xd1, 0x19, 0xb4, 0xc5, 0x50, 0x1a, 0xf3, 0xd9, 0x0b, 0x66,
-  0x1d, 0x30, 0x81, 0x0c, 0x08, 0x12, 0x12, 0x26, 0xda, 0xf4, 0x46, 0xb4,
-  0xc7, 0xff, 0xf5, 0x08, 0xf8, 0xc2, 0x3f, 0x65, 0xdf, 0x36, 0xd7, 0x4f,
-  0x05, 0x9f, 0x48, 0xc3, 0xf3, 0x57, 0xb0, 0xe8, 0x28, 0x4f, 0xb1, 0xb6,
-  0x35, 0x09, 0x23, 0xe4, 0x1c, 0xcb, 0xed, 0x27, 0x27, 0x1f, 0xfb, 0xd4,
-  0x1a, 0x01, 0xd2, 0xd0, 0x5a, 0x14, 0x97, 0xb5, 0xd2, 0x42, 0xa1, 0xe6,
-  0x57, 0x8d, 0x20, 0x81, 0x63, 0xe8, 0xac, 0x47, 0xa5, 0x01, 0x4b, 0xf6,
-  0xed, 0x53, 0x9a, 0x6d, 0x0b, 0x3f, 0x97, 0xc1, 0xdd, 0x25, 0xb9, 0xc7,
-  0x3d, 0x1d, 0x67, 0x16, 0xaa, 0x2b, 0xb5, 0x46, 0xcf, 0x71, 0x66, 0x18,
-  0xdf, 0xe9, 0x94, 0x21, 0x34, 0x05, 0x9d, 0x9c, 0xe5, 0x0a, 0x49, 0x38,
-  0x0d, 0x8c, 0xbe, 0xab, 0x3d, 0xe0, 0x54, 0xfe, 0xd8, 0xa7, 0xfe, 0xe7,
-  0xe4, 0x59, 0x06, 0x2f, 0xbc, 0x25, 0x66, 0xc7, 0x08, 0xb5, 0x2b, 0xb1,
-  0xc8, 0x02, 0x11, 0xd6, 0x21, 0xf8, 0xd5, 0x05, 0xf2, 0x22, 0x0e, 0x12,
-  0xff, 0x98, 0xd4, 0xd7, 0xb0, 0xdc, 0xcb, 0xc6, 0x51, 0xe5, 0xea, 0x33,
-  0xee, 0x1e, 0xd8, 0xb7, 0x36, 0x39, 0x5c, 0xaa, 0x8d, 0xf1, 0x67, 0x2a,
-  0xd3, 0x30, 0x2e, 0x0b, 0x46, 0x8e, 0xbc, 0x7f, 0xcc, 0xb8, 0x3f, 0xf8,
-  0xce, 0x5a, 0x26, 0xe2, 0xdd, 0x4e, 0xed, 0xfa, 0x9c, 0xe8, 0xe2, 0xf1,
-  0xe4, 0x23, 0xbc, 0xb3, 0xba, 0x58, 0x45, 0xee, 0x08, 0x21, 0x19, 0x5f,
-  0xa3, 0x5a, 0x49, 0x53, 0xe3, 0x31, 0xb3, 0xfe, 0x00, 0xe9, 0xb4, 0xbd,
-  0x32, 0x56, 0xf9, 0x99, 0x06, 0x5e, 0xd6, 0x39, 0x7f, 0x44, 0xe8, 0xe9,
-  0x34, 0x29, 0x2f, 0x40, 0x57, 0xe7, 0xff, 0xc7, 0xc5, 0x00, 0x9c, 0xbf,
-  0x1b, 0x32, 0xef, 0xe7, 0x10, 0x23, 0xbb, 0x1c, 0xdb, 0x2f, 0xc3, 0x45,
-  0xfa, 0x48, 0xc2, 0x16, 0x2d, 0x07, 0xbf, 0xf8, 0xb5, 0xf2, 0xd5, 0x27,
-  0x35, 0xa6, 0x81, 0xd7, 0xf7, 0x26, 0xca, 0xf5, 0xd4, 0x28, 0x01, 0x3f,
-  0xe0, 0x21, 0xba, 0x3a, 0x17, 0x48, 0xcc, 0xfc, 0xf5, 0xd5, 0x06, 0xef,
-  0xd9, 0x52, 0x42, 0xef, 0xaa, 0xf4, 0xd1, 0x0b, 0xcf, 0xe5, 0x40, 0x27,
-  0x95, 0x19, 0x09, 0x03, 0x90, 0x03, 0x08, 0x07, 0x29, 0xc7, 0xff, 0x67,
-  0x3b, 0xe9, 0xf3, 0x73, 0x72, 0x2a, 0x1d, 0xd3, 0x60, 0xcf, 0x00, 0xbe,
-  0xce, 0x19, 0x2f, 0x2f, 0x02, 0xc3, 0x62, 0xc2, 0x42, 0x94, 0x7c, 0xe9,
-  0x2c, 0xe1, 0x60, 0x2a, 0x8f, 0x43, 0x20, 0x7b, 0xfb, 0xec, 0x0f, 0xf6,
-  0x27, 0x59, 0x53, 0xaa, 0x7f, 0x41, 0x31, 0x3a, 0x59, 0x00, 0xff, 0xae,
-  0xe1, 0x61, 0x22, 0x92, 0x37, 0x15, 0x1f, 0x35, 0x22, 0x39, 0x1b, 0xe5,
-  0xc0, 0x39, 0x4e, 0x3b, 0xf6, 0x00, 0x02, 0x36, 0xc2, 0x44, 0xdf, 0xbd,
-  0xe1, 0x23, 0x7f, 0xf6, 0xb7, 0xda, 0xb0, 0x01, 0xc1, 0xfd, 0x01, 0x03,
-  0xf9, 0x08, 0xee, 0x59, 0xe2, 0xb7, 0xcb, 0x0f, 0xd8, 0x0c, 0xc2, 0x1f,
-  0x11, 0xcb, 0xf9, 0xc8, 0xd9, 0x4b, 0x5a, 0xfb, 0xc5, 0xc5, 0x47, 0xa5,
-  0x46, 0xda, 0x2c, 0x49, 0x5e, 0xc9, 0x23, 0xfa, 0xc2, 0x9d, 0xe4, 0x09,
-  0xb4, 0xd1, 0xef, 0x2a, 0x20, 0xf8, 0x19, 0xd1, 0xf9, 0xbb, 0xa6, 0xea,
-  0xda, 0x36, 0xe7, 0xe3, 0xf0, 0x7f, 0x3b, 0xf8, 0xfa, 0xc0, 0x0a, 0xc7,
-  0xfb, 0x1d, 0x3f, 0xc5, 0x05, 0xe5, 0x55, 0x13, 0x32, 0xed, 0x2c, 0x25,
-  0x1d, 0x49, 0x01, 0x01, 0xbc, 0xc1, 0x18, 0xd7, 0xf6, 0x2f, 0x45, 0x21,
-  0x38, 0xfe, 0xe2, 0x26, 0xe3, 0xf8, 0xac, 0xde, 0x34, 0x45, 0xd1, 0xce,
-  0x13, 0x7b, 0xf1, 0x39, 0xfb, 0xf0, 0xd4, 0xe4, 0xdf, 0xd8, 0xe0, 0xfc,
-  0xdd, 0x1e, 0xca, 0x22, 0x30, 0x05, 0x10, 0xf5, 0xfb, 0xd0, 0x2f, 0x00,
-  0x0d, 0xe4, 0xbf, 0x01, 0x33, 0xc6, 0x0a, 0xdd, 0xe8, 0xdf, 0xd0, 0x81,
-  0xe2, 0x33, 0xe4, 0x2b, 0xe5, 0xdd, 0x1c, 0xc8, 0xde, 0xfa, 0x07, 0x28,
-  0xfc, 0x05, 0x3e, 0xc1, 0xec, 0x06, 0x2c, 0xc1, 0xf8, 0x0e, 0x29, 0x27,
-  0x12, 0xfa, 0x1e, 0xf9, 0x33, 0xf6, 0x1b, 0xc2, 0x3a, 0x05, 0x59, 0xe5,
-  0xec, 0xeb, 0xca, 0xbe, 0xd7, 0xe6, 0xbf, 0xd7, 0xc5, 0x42, 0x21, 0xfa,
-  0xe2, 0x1a, 0x58, 0x34, 0x05, 0x7e, 0xbe, 0x2b, 0x68, 0xec, 0x31, 0x0a,
-  0xea, 0x9c, 0xec, 0xe8, 0x09, 0xd3, 0x6a, 0xdf, 0x48, 0xb6, 0x18, 0xa2,
-  0x60, 0x62, 0x95, 0x52, 0xfa, 0x32, 0x16, 0xf2, 0x55, 0xc1, 0xe3, 0x4b,
-  0xc3, 0x3b, 0x22, 0xd9, 0xb7, 0x16, 0x12, 0x1a, 0x23, 0xe2, 0x53, 0x7f,
-  0x06, 0xe9, 0xc5, 0xb7, 0xcc, 0xe2, 0x48, 0xe1, 0x1e, 0xe6, 0xf2, 0xb4,
-  0x20, 0xdd, 0xf0, 0xfd, 0xa8, 0x32, 0xe7, 0x53, 0xc2, 0xc0, 0x4f, 0x44,
-  0x52, 0xa0, 0xe3, 0xbc, 0xd5, 0xdc, 0xac, 0x0e, 0xbf, 0x32, 0x0a, 0xf9,
-  0x24, 0x21, 0x22, 0x13, 0xc8, 0xfc, 0x49, 0xcc, 0x55, 0xb5, 0xcd, 0xdc,
-  0x14, 0xd9, 0xf0, 0x22, 0xca, 0x2c, 0x7f, 0x27, 0xff, 0x1d, 0x3a, 0x1c,
-  0x98, 0xb2, 0x04, 0x3c, 0xaa, 0x20, 0x7f, 0xa6, 0x29, 0xec, 0x24, 0xe5,
-  0x18, 0xc6, 0x0c, 0xc9, 0xe1, 0x0c, 0x53, 0x69, 0xcf, 0xc3, 0x1e, 0x01,
-  0x13, 0x37, 0x03, 0xda, 0x49, 0xff, 0xdd, 0xc8, 0xd2, 0xfe, 0xe6, 0x4f,
-  0xc1, 0x15, 0xd8, 0x36, 0x1d, 0x3a, 0xc7, 0xc9, 0xc4, 0x1c, 0xe0, 0xd4,
-  0x38, 0x39, 0x11, 0x2c, 0xde, 0xd1, 0xf3, 0xe9, 0xba, 0xcb, 0xc9, 0x46,
-  0x3e, 0xe5, 0x3c, 0x5d, 0x1a, 0x63, 0x31, 0xf5, 0xfe, 0x12, 0x33, 0xf0,
-  0x39, 0xab, 0x32, 0x7f, 0xc8, 0x29, 0x53, 0xb6, 0x08, 0x0e, 0x3b, 0x0c,
-  0x17, 0xda, 0xdc, 0x41, 0xd5, 0xb0, 0x32, 0xef, 0xdd, 0xc8, 0x00, 0xcd,
-  0xed, 0x30, 0x27, 0x15, 0x47, 0x2d, 0x39, 0x27, 0xe2, 0x45, 0xbd, 0x6f,
-  0x19, 0xc0, 0x5f, 0x5a, 0x06, 0xf9, 0x43, 0x3b, 0xf7, 0xe6, 0x3b, 0x4a,
-  0x27, 0xe6, 0x05, 0xcc, 0xfe, 0x12, 0xe8, 0xdc, 0xd8, 0x51, 0x30, 0x52,
-  0x4f, 0xbe, 0x2d, 0xec, 0x2d, 0x4e, 0x1c, 0xf0, 0x65, 0x30, 0x47, 0xc4,
-  0xc0, 0x35, 0x56, 0xeb, 0x0c, 0xd0, 0x1e, 0x5c, 0x40, 0x00, 0xd4, 0xec,
-  0x3d, 0x07, 0xc9, 0x41, 0x15, 0x16, 0x00, 0xaf, 0xe5, 0x2c, 0x8e, 0x31,
-  0x18, 0xb6, 0xd9, 0xc4, 0x08, 0xbb, 0xe5, 0x5c, 0x15, 0xa2, 0xcf, 0x0e,
-  0x6d, 0xde, 0x1c, 0xe1, 0x7f, 0x4d, 0xda, 0x9f, 0x54, 0x08, 0x15, 0x1d,
-  0xc2, 0x03, 0xe7, 0x45, 0x18, 0xd7, 0xef, 0x1b, 0x2e, 0xce, 0xe5, 0x07,
-  0x04, 0xe2, 0x04, 0xce, 0xd6, 0xa3, 0x15, 0x41, 0x37, 0x38, 0xb2, 0xc2,
-  0xf8, 0x34, 0x3a, 0xf7, 0x81, 0x33, 0x86, 0x18, 0x39, 0x0a, 0x11, 0x2e,
-  0xec, 0x46, 0x15, 0xf0, 0x35, 0xd2, 0xfe, 0xb7, 0xd0, 0x45, 0x23, 0x08,
-  0xc3, 0xed, 0xf8, 0x0d, 0xee, 0xbc, 0x49, 0xf5, 0x57, 0x01, 0x26, 0xc9,
-  0x33, 0x41, 0xb6, 0xb4, 0x4d, 0x16, 0xac, 0xc1, 0x23, 0xed, 0x06, 0x14,
-  0xa7, 0x43, 0x6c, 0x04, 0xb8, 0x06, 0x16, 0xa7, 0x58, 0x33, 0xeb, 0xdc,
-  0xea, 0xc9, 0xd4, 0xf2, 0x4c, 0x40, 0x56, 0xd5, 0x48, 0x46, 0xea, 0xbe,
-  0x1c, 0x17, 0xbc, 0x81, 0xe0, 0x29, 0x4a, 0xbd, 0x55, 0xaa, 0x0d, 0x5c,
-  0x4e, 0x15, 0x2e, 0xf1, 0x3e, 0x50, 0x57, 0x1a, 0x18, 0x52, 0x9e, 0x3e,
-  0x91, 0xc7, 0x00, 0xb7, 0x38, 0xfd, 0xb3, 0x14, 0x16, 0x7d, 0x2d, 0x27,
-  0xcd, 0x21, 0xb4, 0xcc, 0x81, 0xcc, 0x46, 0x40, 0x59, 0xbd, 0x26, 0xdc,
-  0x1a, 0x20, 0xb6, 0x9e, 0xec, 0x2d, 0x29, 0xf1, 0x3f, 0x5c, 0xda, 0x6a,
-  0xe9, 0x4b, 0x05, 0x5d, 0xf4, 0xec, 0xb1, 0x0c, 0x06, 0x0d, 0x2a, 0xac,
-  0xea, 0xdf, 0xdd, 0xff, 0xfa, 0x61, 0x22, 0x6d, 0x3e, 0x2a, 0xfe, 0x1b,
-  0xb3, 0x17, 0x99, 0xf7, 0x69, 0x8c, 0x04, 0x05, 0x1e, 0x19, 0x14, 0xcd,
-  0xb4, 0x25, 0xd6, 0xd6, 0xf9, 0xa9, 0x40, 0xa6, 0xe7, 0x08, 0x5a, 0x1c,
-  0xda, 0x4e, 0x76, 0xe6, 0xbd, 0xec, 0x56, 0x5c, 0xe4, 0x7f, 0xe2, 0x02,
-  0xaa, 0x9e, 0xf2, 0x08, 0xc6, 0xe6, 0x0a, 0xb5, 0x28, 0xe0, 0x10, 0x3c,
-  0xd6, 0xb7, 0x98, 0x3e, 0x02, 0xbf, 0xda, 0xde, 0xd8, 0xca, 0xd4, 0x04,
-  0xc3, 0xdf, 0x9c, 0xbf, 0x26, 0xe8, 0x63, 0x3c, 0x21, 0x11, 0x00, 0xe8,
-  0xf0, 0xc4, 0xb1, 0xe3, 0x44, 0x2a, 0xaa, 0x24, 0x03, 0x08, 0xdd, 0xf9,
-  0x17, 0xf2, 0x69, 0x3d, 0x44, 0xf0, 0x35, 0xba, 0xf5, 0x54, 0xe9, 0x36,
-  0xf5, 0xeb, 0x3a, 0xd9, 0xfc, 0xcb, 0x44, 0x4d, 0x5d, 0xd4, 0xbc, 0x8c,
-  0x33, 0xb8, 0xc8, 0x38, 0x1f, 0x0d, 0xa8, 0xe8, 0x1a, 0xd3, 0x2d, 0x06,
-  0xcc, 0x15, 0xc2, 0x39, 0x0f, 0x1e, 0x48, 0x81, 0xb3, 0xdf, 0x22, 0x04,
-  0x30, 0x16, 0xb3, 0x00, 0x51, 0x9b, 0x06, 0xd8, 0xb0, 0xad, 0xa1, 0x0c,
-  0xfd, 0x11, 0x2a, 0x15, 0xc9, 0xfa, 0x1d, 0x3d, 0x0d, 0x27, 0x08, 0x3a,
-  0x05, 0x0c, 0x4d, 0xd9, 0xad, 0xf2, 0x3a, 0x81, 0xec, 0x29, 0x32, 0xee,
-  0x6b, 0x13, 0xee, 0x33, 0x06, 0x12, 0xd4, 0xee, 0x08, 0x25, 0x17, 0x5a,
-  0x37, 0x3a, 0x15, 0x25, 0x41, 0xf1, 0xdc, 0xea, 0x0f, 0xec, 0x5e, 0x2e,
-  0x1d, 0xe3, 0xcb, 0x00, 0x46, 0xdf, 0xe4, 0x58, 0xfa, 0x25, 0xbc, 0xf5,
-  0xf3, 0x11, 0xcd, 0xf5, 0xd5, 0xb5, 0x08, 0x40, 0xdb, 0xed, 0x3d, 0xaf,
-  0x16, 0x2b, 0x29, 0xe7, 0x24, 0x29, 0x13, 0xb4, 0xef, 0xbd, 0xd2, 0xcb,
-  0x3b, 0x07, 0xf7, 0x22, 0xcd, 0xfe, 0xd9, 0x26, 0x2f, 0x2d, 0xc7, 0xd2,
-  0xc1, 0xcf, 0x08, 0xfa, 0x20, 0x11, 0xb8, 0x4d, 0x19, 0x43, 0xf7, 0x04,
-  0x81, 0x48, 0xdb, 0x12, 0x2f, 0xe9, 0x12, 0xaa, 0x2e, 0x17, 0x26, 0x01,
-  0x1d, 0x0c, 0xd0, 0x27, 0xe8, 0xd6, 0xe7, 0xb8, 0x3a, 0xf2, 0x22, 0x40,
-  0x2c, 0x07, 0x26, 0x36, 0xe6, 0x46, 0xe9, 0x4a, 0x23, 0xfd, 0xb9, 0x01,
-  0x57, 0x26, 0x1f, 0x02, 0xe0, 0xcd, 0xd4, 0x38, 0xb7, 0x2d, 0xe1, 0x42,
-  0xd0, 0x1b, 0x0a, 0x81, 0x2a, 0x20, 0x17, 0xc9, 0xc6, 0xe7, 0xdd, 0xdb,
-  0xc9, 0x26, 0xd2, 0x20, 0xc2, 0xde, 0xea, 0xd2, 0x37, 0x30, 0x2a, 0xd0,
-  0x4b, 0x36, 0x22, 0x12, 0x5a, 0x44, 0x10, 0x3d, 0x12, 0xfd, 0x30, 0xdd,
-  0x05, 0x34, 0xeb, 0xdb, 0xb8, 0xec, 0xd9, 0x35, 0x2d, 0xb6, 0x31, 0x04,
-  0xe6, 0xd9, 0xfa, 0x05, 0xa1, 0xbd, 0xd0, 0x12, 0xd2, 0x1e, 0x1b, 0xf5,
-  0xd9, 0x18, 0x1b, 0x30, 0xae, 0xa4, 0x23, 0xd5, 0xf4, 0x3c, 0x26, 0x81,
-  0x23, 0x25, 0xfc, 0xf8, 0xc6, 0x17, 0x30, 0x19, 0xa2, 0x0d, 0x39, 0xcb,
-  0x27, 0x3a, 0x13, 0x37, 0xe3, 0xf6, 0xe6, 0xc9, 0x15, 0xbd, 0xea, 0x1e,
-  0xbc, 0xf9, 0xc2, 0xb1, 0xd4, 0x27, 0xd6, 0x17, 0x31, 0xaf, 0x1f, 0xa3,
-  0xb0, 0xeb, 0xec, 0x1c, 0x31, 0x12, 0x31, 0x5a, 0xe5, 0xee, 0x03, 0xab,
-  0x10, 0x2a, 0xdc, 0x30, 0x6e, 0x4b, 0x10, 0x15, 0x2c, 0xf8, 0x05, 0xe0,
-  0x2e, 0x19, 0x27, 0xf0, 0x26, 0xf3, 0xc6, 0x0d, 0x39, 0x24, 0xff, 0x57,
-  0x22, 0x0d, 0xfe, 0xb0, 0xc8, 0xb2, 0xc1, 0x04, 0x08, 0x81, 0x09, 0x06,
-  0x17, 0x07, 0xca, 0x3b, 0x3c, 0x43, 0xf3, 0x33, 0xcb, 0x20, 0x22, 0x99,
-  0xcc, 0x33, 0xaa, 0x94, 0x50, 0x05, 0xe3, 0xd8, 0xa8, 0x1b, 0x56, 0x3b,
-  0xc5, 0xb2, 0x5c, 0x18, 0x43, 0xea, 0x19, 0x5a, 0x75, 0x32, 0x2b, 0x0e,
-  0xec, 0x4f, 0xf5, 0x42, 0xc2, 0x12, 0xa5, 0xa8, 0x13, 0xa5, 0xcd, 0x0f,
-  0xfa, 0x9b, 0x5e, 0xf6, 0xc1, 0x16, 0x47, 0x71, 0xd3, 0x82, 0x6c, 0x81,
-  0x14, 0xd1, 0xaf, 0xd2, 0xc4, 0x12, 0x4c, 0xe9, 0xc1, 0xbc, 0xdb, 0x98,
-  0xee, 0x05, 0x39, 0x02, 0x4f, 0xdb, 0xd7, 0x22, 0x46, 0x2f, 0x7f, 0x15,
-  0xc8, 0xe8, 0x42, 0x48, 0xb5, 0x39, 0xe6, 0xf7, 0xe4, 0x2d, 0xe0, 0xbf,
-  0x1e, 0xbe, 0x33, 0xde, 0xd4, 0xba, 0xe0, 0x1b, 0xaa, 0xac, 0x0e, 0x4c,
-  0x31, 0x42, 0x95, 0xf7, 0x1d, 0x2d, 0x0a, 0x0c, 0xdd, 0xd5, 0xcc, 0xbb,
-  0x0c, 0xf1, 0xc5, 0xdd, 0x31, 0xf5, 0x58, 0x25, 0x8b, 0x14, 0xf1, 0x2d,
-  0xc7, 0x3d, 0xbe, 0x2a, 0xe7, 0x0d, 0xfe, 0x1a, 0xbf, 0xae, 0x3c, 0xbb,
-  0x1e, 0xae, 0x00, 0x29, 0xcb, 0x4b, 0x40, 0x76, 0xe4, 0x14, 0x42, 0x3e,
-  0x53, 0xf1, 0xbf, 0x30, 0x43, 0x06, 0x55, 0x1a, 0x17, 0xb9, 0xb5, 0xce,
-  0xa3, 0x15, 0x5d, 0xa9, 0x45, 0x4a, 0xf7, 0x55, 0x03, 0x11, 0xaa, 0x1b,
-  0xef, 0x2a, 0x5f, 0x7f, 0xcc, 0x09, 0x44, 0x4d, 0xc7, 0xf7, 0xc8, 0xcf,
-  0xe7, 0x66, 0xb2, 0xf9, 0xbc, 0x34, 0x11, 0x11, 0xf0, 0xe4, 0x22, 0xdc,
-  0xfc, 0xdf, 0xd2, 0x00, 0xcf, 0xcf, 0x29, 0x16, 0x3e, 0xf2, 0xe5, 0xd5,
-  0x05, 0x57, 0xf8, 0x43, 0x16, 0xf7, 0xee, 0xda, 0xe4, 0x21, 0xf6, 0xd2,
-  0x36, 0xe9, 0x47, 0x52, 0xcf, 0x0c, 0x18, 0x7f, 0xd5, 0xca, 0x16, 0xc9,
-  0xe6, 0x21, 0xed, 0xdd, 0x43, 0xe7, 0xf7, 0xd3, 0x18, 0x12, 0xdf, 0x29,
-  0xfb, 0xd1, 0xfd, 0xff, 0xfe, 0x02, 0xee, 0x15, 0xda, 0xfc, 0x49, 0x1e,
-  0xf9, 0x88, 0x25, 0xbc, 0xbf, 0xed, 0xac, 0xf7, 0x28, 0xce, 0x30, 0xa6,
-  0x2e, 0x10, 0x0d, 0x30, 0xd1, 0x27, 0x4d, 0xfb, 0xd1, 0x9c, 0x16, 0x40,
-  0x0d, 0xfa, 0xcb, 0x54, 0xeb, 0xd9, 0xf0, 0xca, 0x1e, 0x0f, 0x31, 0x81,
-  0xe6, 0xaa, 0xf7, 0x33, 0x3b, 0x50, 0x2e, 0x1e, 0x3f, 0x84, 0xf2, 0xb5,
-  0x65, 0xd1, 0xc9, 0x39, 0x2f, 0x17, 0x3a, 0x88, 0x0d, 0x05, 0x6a, 0x95,
-  0x1d, 0x29, 0xa7, 0xed, 0x47, 0xd6, 0x00, 0x6a, 0xd9, 0xaf, 0xb1, 0xb1,
-  0x29, 0xd1, 0xe5, 0x22, 0xef, 0xff, 0x21, 0x44, 0x0a, 0x00, 0xcc, 0x46,
-  0xf4, 0x40, 0xff, 0x5a, 0x29, 0xea, 0x20, 0x3c, 0x36, 0xa7, 0xd9, 0x1c,
-  0xa8, 0xe2, 0xb8, 0x81, 0xa8, 0xce, 0xf9, 0xfe, 0x3e, 0x61, 0xc5, 0x0e,
-  0xdc, 0x59, 0x01, 0xcb, 0x2f, 0xf9, 0x22, 0xeb, 0xa6, 0x2c, 0x23, 0xca,
-  0x3a, 0x07, 0x4d, 0xc1, 0x35, 0xb2, 0xe6, 0xed, 0xcb, 0x1a, 0x38, 0xff,
-  0xd4, 0xff, 0x9c, 0xed, 0x07, 0xe7, 0xfe, 0x38, 0xdc, 0x54, 0x0f, 0xf2,
-  0xad, 0x05, 0xf4, 0xd7, 0x14, 0xdd, 0xf8, 0x50, 0xd5, 0xe0, 0x16, 0x01,
-  0x12, 0xe0, 0x0c, 0x81, 0xd5, 0x22, 0x9d, 0x18, 0x21, 0x19, 0x2e, 0xea,
-  0xcf, 0xc0, 0x4e, 0x79, 0x40, 0x15, 0x99, 0xb7, 0xfd, 0xe4, 0x07, 0xac,
-  0x0a, 0x2a, 0xb7, 0x73, 0xee, 0xed, 0xd5, 0xd8, 0x1a, 0x42, 0xb1, 0x28,
-  0x86, 0x5a, 0x27, 0x31, 0x24, 0x07, 0x0e, 0xf2, 0x2e, 0x60, 0x70, 0xc9,
-  0xbd, 0x3c, 0xd1, 0x3b, 0x03, 0x2c, 0x34, 0xea, 0xe6, 0x91, 0xbe, 0xfe,
-  0x23, 0x1b, 0xf8, 0x03, 0x85, 0x0a, 0x37, 0x30, 0x45, 0x09, 0x46, 0x06,
-  0xe8, 0x20, 0xcf, 0xfb, 0x36, 0x91, 0x3b, 0xf0, 0xc7, 0xfe, 0x0e, 0x46,
-  0x19, 0x9e, 0x67, 0x18, 0xbd, 0xb4, 0xc8, 0x7f, 0xa8, 0x06, 0xc9, 0x0a,
-  0x39, 0xf3, 0x67, 0x1d, 0xcf, 0xb2, 0xba, 0xa2, 0x28, 0x98, 0xf0, 0x32,
-  0x2a, 0xf1, 0x00, 0x38, 0xb2, 0x57, 0xbc, 0x48, 0x8d, 0x1b, 0x58, 0xf4,
-  0x81, 0xdf, 0x40, 0x09, 0xc4, 0x0e, 0xaa, 0x49, 0x16, 0x64, 0x08, 0xf8,
-  0x10, 0xce, 0xaf, 0xfe, 0xd5, 0x1b, 0x11, 0x4a, 0xdf, 0xc8, 0x20, 0x1a,
-  0xe3, 0xef, 0x57, 0x4e, 0x5a, 0x63, 0x34, 0xe6, 0xe9, 0x22, 0x0a, 0xcc,
-  0x2a, 0x38, 0xe4, 0xff, 0x67, 0xfd, 0xb5, 0xaf, 0xfd, 0xea, 0xb1, 0x0d,
-  0xaa, 0xc1, 0xff, 0xc7, 0xf3, 0xab, 0xf3, 0x53, 0x33, 0x3b, 0xf3, 0xdb,
-  0xea, 0x2a, 0xb0, 0xd0, 0xc7, 0xe1, 0x16, 0xc8, 0x17, 0x56, 0x3e, 0xd3,
-  0x18, 0x23, 0x2d, 0x07, 0x02, 0x81, 0xb7, 0x1d, 0x17, 0x4b, 0xd2, 0xe3,
-  0x41, 0x46, 0x2b, 0xfe, 0x4d, 0x15, 0xce, 0xd3, 0xf4, 0xfa, 0xd0, 0x62,
-  0x25, 0x0f, 0xf3, 0xd8, 0x1c, 0x22, 0xc9, 0x35, 0xf9, 0x3c, 0x45, 0xd0,
-  0x01, 0x08, 0x19, 0x71, 0x3e, 0x0b, 0xda, 0xf2, 0x56, 0xfc, 0xf2, 0xef,
-  0x15, 0xae, 0x36, 0xf9, 0xa3, 0xf4, 0x4d, 0x15, 0xc4, 0x36, 0xb0, 0xee,
-  0xd2, 0xda, 0x36, 0xba, 0xa6, 0x81, 0x17, 0x7e, 0xc5, 0x04, 0x11, 0xe0,
-  0x51, 0xdd, 0xd1, 0x3e, 0x4e, 0x55, 0x55, 0x16, 0xd3, 0x51, 0x92, 0xb2,
-  0x1e, 0xd9, 0xb3, 0x45, 0xf4, 0xb7, 0x16, 0x26, 0xa1, 0xec, 0x95, 0x9c,
-  0xfb, 0xf7, 0x85, 0x67, 0x6f, 0x1e, 0x1e, 0x30, 0x20, 0xfc, 0x4c, 0x54,
-  0x5e, 0x32, 0xd1, 0x3e, 0x5b, 0xfe, 0xc3, 0xb4, 0xab, 0xf5, 0xfe, 0x1b,
-  0x03, 0xbc, 0x3a, 0x56, 0x4f, 0xa6, 0xce, 0x66, 0x12, 0x06, 0x3d, 0xd2,
-  0xcd, 0x5a, 0x56, 0xf7, 0x31, 0xd9, 0xce, 0xc1, 0x5c, 0xfd, 0xc0, 0x4a,
-  0x65, 0x08, 0x78, 0x28, 0xdd, 0x62, 0x1c, 0xef, 0xde, 0xe8, 0xd5, 0xca,
-  0xca, 0x7f, 0xb0, 0xbe, 0xce, 0x44, 0x56, 0xd2, 0x18, 0xbc, 0x44, 0x19,
-  0x40, 0xb9, 0xfc, 0x2c, 0x1f, 0xc2, 0x14, 0x47, 0xce, 0xd9, 0xf0, 0x2c,
-  0x59, 0x4f, 0x47, 0xda, 0xef, 0xd7, 0xfd, 0xdb, 0x10, 0x1e, 0x2a, 0x4c,
-  0xd4, 0x5c, 0x0f, 0xe6, 0x9a, 0x3f, 0x5e, 0x7f, 0xbb, 0x08, 0x4e, 0xd1,
-  0x3a, 0x6f, 0x38, 0xba, 0xed, 0xfa, 0x01, 0xe4, 0xd2, 0x69, 0xbb, 0xd8,
-  0x23, 0xa9, 0x61, 0x25, 0xb7, 0x32, 0x4b, 0xbd, 0x24, 0x5d, 0xed, 0x77,
-  0xfe, 0x00, 0x03, 0x69, 0xfc, 0x43, 0xbf, 0x7a, 0x76, 0xf9, 0x4e, 0xd1,
-  0xdb, 0x10, 0x09, 0xb3, 0x6c, 0x31, 0xd8, 0x04, 0xfa, 0xeb, 0xe1, 0xe5,
-  0x6a, 0x3a, 0xb6, 0xcf, 0x81, 0xd7, 0x62, 0xe7, 0xc2, 0x22, 0xed, 0xc5,
-  0xf2, 0x10, 0x2d, 0x02, 0xc0, 0x5b, 0xf2, 0x0c, 0xe3, 0xce, 0x28, 0x6d,
-  0xf9, 0x26, 0x99, 0x2e, 0xc7, 0xec, 0x34, 0x09, 0x19, 0xb6, 0x10, 0xce,
-  0xc6, 0xc3, 0xcb, 0x13, 0xa5, 0x13, 0xc0, 0x36, 0xb9, 0x08, 0xe4, 0xc2,
-  0x2b, 0xa7, 0x36, 0xd2, 0x27, 0xce, 0xb7, 0xa4, 0xfa, 0x47, 0x0b, 0x22,
-  0xd9, 0x24, 0x59, 0xf8, 0x8e, 0xaf, 0x78, 0xbe, 0x22, 0xa1, 0x1b, 0xc2,
-  0x1a, 0x34, 0x04, 0xd8, 0xcb, 0xba, 0xe4, 0xf1, 0x5c, 0x1e, 0x2e, 0x09,
-  0xef, 0x95, 0xf4, 0x3b, 0xdc, 0xed, 0x43, 0xaa, 0x14, 0x18, 0xe6, 0x39,
-  0xe7, 0x81, 0x02, 0xb8, 0xe9, 0x16, 0x28, 0x24, 0x50, 0x37, 0x81, 0x4f,
-  0x57, 0xb7, 0x25, 0xeb, 0xf9, 0x52, 0x56, 0xb9, 0x34, 0x4c, 0x73, 0xd9,
-  0xd7, 0xd9, 0x41, 0xf3, 0x1d, 0x0f, 0xc8, 0xfc, 0x62, 0x60, 0xa9, 0x16,
-  0x02, 0x24, 0xdf, 0xf8, 0xe4, 0xa9, 0xca, 0xe3, 0x39, 0xb8, 0x3a, 0x2c,
-  0xe4, 0x28, 0xea, 0x33, 0x70, 0x2b, 0xf2, 0x91, 0x27, 0x20, 0x56, 0xdb,
-  0xd3, 0x40, 0x0e, 0xea, 0x2a, 0x41, 0xba, 0x43, 0xc8, 0xc1, 0xfe, 0x4c,
-  0xa3, 0xdb, 0x1f, 0x98, 0x33, 0x30, 0xb7, 0xab, 0x26, 0x65, 0x39, 0x54,
-  0xc7, 0x1f, 0x17, 0xce, 0xcb, 0x95, 0x0f, 0xd7, 0x55, 0xbc, 0x93, 0xd7,
-  0xd4, 0x5c, 0x5c, 0xcd, 0xf3, 0xea, 0x12, 0x79, 0xcc, 0x1d, 0x81, 0xae,
-  0x45, 0x03, 0x9e, 0x11, 0xb9, 0xf3, 0x19, 0x02, 0x46, 0x37, 0x54, 0xe8,
-  0x45, 0xfb, 0xab, 0x11, 0x9d, 0xea, 0xcc, 0x53, 0xcc, 0xea, 0x35, 0x34,
-  0xfa, 0x73, 0x10, 0xeb, 0xf6, 0xf0, 0x92, 0xf4, 0xfb, 0xcf, 0xdc, 0x4b,
-  0x28, 0xef, 0x00, 0xf3, 0xd2, 0x5f, 0x1c, 0xc5, 0x3b, 0x13, 0x40, 0xf8,
-  0x1a, 0xd0, 0x9e, 0x33, 0xe2, 0x5a, 0xc6, 0xb7, 0x2e, 0xe9, 0xac, 0x4c,
-  0x3f, 0x8a, 0xac, 0x00, 0xa6, 0x4d, 0x43, 0x0c, 0x1d, 0xd8, 0x8b, 0xd1,
-  0xc4, 0x6e, 0xc5, 0x4c, 0x0e, 0xeb, 0x7f, 0xa3, 0x59, 0xfb, 0x98, 0xfe,
-  0x31, 0xcd, 0x3e, 0x1d, 0xb7, 0xbe, 0xb9, 0x4b, 0x7f, 0x8f, 0x05, 0x05,
-  0xe1, 0xd8, 0x2e, 0x00, 0xf5, 0x2a, 0x42, 0x06, 0x5b, 0xdb, 0x10, 0xbb,
-  0xa0, 0x1d, 0xf9, 0xe8, 0x21, 0x04, 0xc5, 0x30, 0x1b, 0xaf, 0xf0, 0x4d,
-  0x12, 0x24, 0x8e, 0xe1, 0xcf, 0x2d, 0x29, 0x26, 0x5a, 0x42, 0x41, 0xfc,
-  0x42, 0xfd, 0xc4, 0xcb, 0x20, 0xca, 0x30, 0x0c, 0xb2, 0xce, 0x41, 0x74,
-  0x9d, 0xf8, 0x40, 0x3b, 0xcd, 0xb6, 0xdb, 0xf4, 0xcc, 0xf7, 0xa3, 0x3c,
-  0xda, 0x0d, 0xcc, 0x34, 0x3b, 0xda, 0xc0, 0xfe, 0xb6, 0x45, 0x67, 0x45,
-  0xfe, 0xd1, 0xf5, 0x3b, 0xd9, 0x7f, 0xb3, 0x26, 0xc3, 0xfd, 0xdc, 0xe5,
-  0xf3, 0xc9, 0xe1, 0xeb, 0xfe, 0xd8, 0x5f, 0x74, 0x03, 0x38, 0xe9, 0x45,
-  0xd8, 0x36, 0xfa, 0xee, 0xcf, 0x3c, 0x1e, 0x02, 0xac, 0x66, 0xfc, 0xdf,
-  0xe3, 0xc5, 0x2b, 0x41, 0x30, 0xb1, 0x46, 0x19, 0x0c, 0xeb, 0x0b, 0x02,
-  0xc2, 0xcb, 0x48, 0x11, 0x2b, 0x7f, 0x4c, 0xd9, 0xea, 0xc9, 0x2a, 0x28,
-  0xcc, 0x20, 0x1d, 0xe6, 0xb9, 0xda, 0x1e, 0x2a, 0x2c, 0xc8, 0xb3, 0xd4,
-  0xd9, 0xf3, 0x2c, 0xfb, 0x50, 0x38, 0xe2, 0x10, 0xa9, 0xc9, 0xb3, 0xb8,
-  0xa8, 0xd8, 0x32, 0xd7, 0x2d, 0x29, 0xc1, 0xf0, 0x91, 0x26, 0xa5, 0xd7,
-  0xd7, 0xcc, 0x3c, 0x0b, 0xe1, 0xeb, 0x31, 0xf0, 0x2a, 0x18, 0xd6, 0xe5,
-  0xb9, 0xb4, 0xd6, 0x3a, 0xf9, 0x3d, 0xcc, 0x3c, 0x59, 0xf6, 0x32, 0xef,
-  0x4c, 0xdb, 0xb6, 0xeb, 0xa7, 0x38, 0x4b, 0x0f, 0x07, 0x24, 0xf7, 0xee,
-  0xe6, 0x03, 0x9a, 0x4e, 0xd7, 0xe8, 0x09, 0xf7, 0xaa, 0x1a, 0x1e, 0x4a,
-  0xfe, 0x18, 0x4f, 0x32, 0x01, 0x1a, 0x2e, 0x66, 0x21, 0x37, 0xc2, 0xd4,
-  0x0a, 0xbb, 0x00, 0xe8, 0x0f, 0x42, 0x9b, 0xd9, 0xef, 0x09, 0xfb, 0x05,
-  0xce, 0xb8, 0xb9, 0x23, 0x99, 0xa7, 0xb4, 0x35, 0xab, 0xdb, 0xb5, 0x81,
-  0x03, 0xb0, 0xd9, 0xfa, 0x5f, 0x1f, 0x22, 0xc6, 0x9c, 0xd2, 0x0d, 0x4d,
-  0x0a, 0x1c, 0x35, 0x34, 0x81, 0xb7, 0x18, 0x09, 0x5c, 0x52, 0x22, 0x0c,
-  0x6c, 0xe4, 0xe9, 0xf8, 0xff, 0x97, 0xda, 0x5d, 0xcf, 0xd7, 0x5c, 0x51,
-  0x29, 0x16, 0x1c, 0x2f, 0x54, 0x5c, 0x39, 0x1d, 0x26, 0x26, 0xe5, 0xc0,
-  0xeb, 0xc4, 0xe9, 0x27, 0xb3, 0x2b, 0x13, 0x1b, 0x11, 0xd9, 0x0b, 0xa5,
-  0xb5, 0x01, 0xd0, 0x17, 0xeb, 0xbd, 0x25, 0x05, 0xb5, 0xe7, 0xae, 0xb9,
-  0x34, 0x45, 0x1e, 0xf9, 0x2f, 0xef, 0x65, 0x3f, 0x1e, 0x4e, 0x06, 0xc5,
-  0x12, 0x16, 0x3b, 0xc2, 0x42, 0xef, 0xea, 0xcc, 0x2c, 0x20, 0xbc, 0xf9,
-  0xff, 0x31, 0x86, 0xbf, 0x15, 0x39, 0xda, 0x23, 0x43, 0x2e, 0xef, 0x43,
-  0x7f, 0x13, 0xe2, 0x16, 0x48, 0xc0, 0x60, 0xd5, 0x65, 0xc6, 0x6a, 0x5b,
-  0x46, 0xd4, 0xcf, 0xd6, 0x51, 0xec, 0x24, 0x08, 0xd5, 0xbd, 0xce, 0xfd,
-  0x42, 0x35, 0x24, 0x3f, 0xc2, 0x36, 0x19, 0x19, 0x22, 0x38, 0xaf, 0x37,
-  0xc4, 0x7f, 0x26, 0x61, 0x27, 0x42, 0xff, 0x11, 0xe5, 0xdf, 0xfc, 0x9a,
-  0xd3, 0xbb, 0x20, 0x17, 0x28, 0xf8, 0x34, 0x3e, 0x3b, 0x12, 0xc2, 0xed,
-  0x39, 0xec, 0xc3, 0x1c, 0x07, 0xf2, 0xeb, 0x3c, 0xe6, 0x01, 0xe3, 0x04,
-  0x29, 0xbb, 0xa4, 0x1e, 0x1d, 0x16, 0xff, 0x28, 0xf0, 0x4c, 0x46, 0x28,
-  0xea, 0xd2, 0xb4, 0xd1, 0x2d, 0x3f, 0xea, 0x08, 0xf2, 0x56, 0x0b, 0x16,
-  0x20, 0x28, 0xae, 0x5e, 0xbc, 0x73, 0xa1, 0x2e, 0x44, 0xd6, 0x9e, 0xd0,
-  0xe4, 0xea, 0xed, 0xe4, 0xdb, 0xa0, 0xe9, 0xf1, 0x55, 0x66, 0xdf, 0xe6,
-  0x40, 0x00, 0x81, 0x1d, 0x0a, 0xff, 0x08, 0x14, 0x42, 0xef, 0x37, 0x7a,
-  0x2f, 0xc7, 0x69, 0x46, 0xe2, 0x88, 0x06, 0x04, 0x3b, 0xbd, 0xf3, 0xde,
-  0xd3, 0xf5, 0x23, 0x55, 0x14, 0x17, 0x67, 0x4d, 0x6d, 0x38, 0xd2, 0xe8,
-  0xb2, 0xef, 0x14, 0x10, 0xda, 0x4c, 0x19, 0xe3, 0x32, 0x0d, 0xce, 0x5e,
-  0x90, 0xe4, 0xdd, 0xd5, 0x32, 0x53, 0x7f, 0xc7, 0x45, 0xc5, 0x04, 0x4f,
-  0x09, 0xbf, 0x04, 0x3e, 0x55, 0xac, 0xcc, 0xcc, 0x00, 0x55, 0x5f, 0xe1,
-  0xc5, 0x2d, 0x9c, 0xe5, 0xf5, 0x4a, 0xb9, 0x08, 0xa8, 0xdb, 0x9f, 0xf5,
-  0xa2, 0xa2, 0xe5, 0xe1, 0xff, 0xf0, 0x13, 0xbf, 0x11, 0x14, 0xec, 0x0b,
-  0xfb, 0xe9, 0x09, 0x54, 0xdd, 0xd8, 0xe3, 0xd9, 0x2b, 0xfe, 0xa2, 0xba,
-  0x7f, 0x15, 0x06, 0x15, 0x29, 0xc3, 0xff, 0x17, 0xc2, 0xd2, 0x3c, 0x8f,
-  0x32, 0xc3, 0xd4, 0x2c, 0x2c, 0x45, 0x13, 0x2b, 0x29, 0xf5, 0x3f, 0xb0,
-  0xba, 0x0a, 0xe6, 0x22, 0xd9, 0xd2, 0xb0, 0x26, 0xea, 0x4e, 0x22, 0x15,
-  0xad, 0x49, 0x3b, 0xc9, 0x12, 0xed, 0x43, 0xa9, 0x36, 0xd1, 0xe1, 0x0f,
-  0x38, 0xca, 0xf8, 0x1e, 0x46, 0xc7, 0x19, 0xed, 0x05, 0x02, 0xb0, 0x00,
-  0xf6, 0x18, 0x3b, 0x3c, 0x06, 0xbc, 0x0a, 0xf6, 0x03, 0x0a, 0xf3, 0x27,
-  0xcd, 0x1c, 0x00, 0x4c, 0xe4, 0x3a, 0xd2, 0x81, 0xf3, 0xc8, 0xeb, 0xc0,
-  0x39, 0x03, 0xfd, 0x35, 0x3f, 0x0f, 0x2c, 0x4b, 0x1c, 0x10, 0x4c, 0x35,
-  0xf6, 0xce, 0xc8, 0xae, 0xfe, 0x24, 0x0c, 0xb8, 0xce, 0x34, 0xce, 0x47,
-  0xcf, 0xb0, 0xfa, 0x2d, 0xf7, 0x10, 0xd1, 0x43, 0xf7, 0x1a, 0xeb, 0xe0,
-  0x59, 0x45, 0x11, 0x5c, 0x43, 0xc4, 0x60, 0xfa, 0xbe, 0x70, 0x08, 0x0e,
-  0x3d, 0x89, 0x54, 0xc4, 0xa5, 0x32, 0x30, 0x54, 0xb1, 0xa1, 0x1b, 0x56,
-  0xd5, 0x15, 0xc8, 0x2a, 0x3f, 0x81, 0xd0, 0x27, 0x0e, 0xe0, 0xf5, 0x10,
-  0xee, 0x57, 0xdc, 0x0f, 0x1d, 0xd3, 0xe2, 0x5b, 0x18, 0x1b, 0xe6, 0xf8,
-  0x60, 0x50, 0xd8, 0x38, 0xfa, 0xf4, 0x57, 0xc4, 0x52, 0xd4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x4c, 0xf6, 0xff, 0xff,
-  0x6b, 0xf9, 0xff, 0xff, 0xa9, 0xf3, 0xff, 0xff, 0x60, 0xf1, 0xff, 0xff,
-  0x1e, 0x1a, 0x00, 0x00, 0xcb, 0xfc, 0xff, 0xff, 0xe4, 0x08, 0x00, 0x00,
-  0x96, 0xfa, 0xff, 0xff, 0x8c, 0x18, 0x00, 0x00, 0xc6, 0xf7, 0xff, 0xff,
-  0x8d, 0xfa, 0xff, 0xff, 0x12, 0x09, 0x00, 0x00, 0xcf, 0x06, 0x00, 0x00,
-  0x8c, 0xfc, 0xff, 0xff, 0x0c, 0x0a, 0x00, 0x00, 0x9a, 0xe7, 0xff, 0xff,
-  0x05, 0x01, 0x00, 0x00, 0xb2, 0xfc, 0xff, 0xff, 0x5d, 0x08, 0x00, 0x00,
-  0x4a, 0xf4, 0xff, 0xff, 0xfb, 0x07, 0x00, 0x00, 0x8c, 0xf8, 0xff, 0xff,
-  0x1f, 0xed, 0xff, 0xff, 0xa1, 0xf2, 0xff, 0xff, 0x33, 0x04, 0x00, 0x00,
-  0x6a, 0xf2, 0xff, 0xff, 0x20, 0xfd, 0xff, 0xff, 0x31, 0x0b, 0x00, 0x00,
-  0x32, 0x06, 0x00, 0x00, 0xe0, 0xef, 0xff, 0xff, 0x63, 0x07, 0x00, 0x00,
-  0xc0, 0xf4, 0xff, 0xff, 0xfe, 0x0d, 0x00, 0x00, 0x30, 0xf8, 0xff, 0xff,
-  0x2e, 0x08, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x88, 0xf3, 0xff, 0xff,
-  0x24, 0xfc, 0xff, 0xff, 0x42, 0x06, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00,
-  0x53, 0x0a, 0x00, 0x00, 0x39, 0xfa, 0xff, 0xff, 0xaf, 0x02, 0x00, 0x00,
-  0x1f, 0x01, 0x00, 0x00, 0xbc, 0x05, 0x00, 0x00, 0x4a, 0xed, 0xff, 0xff,
-  0x70, 0xea, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0x73, 0x10, 0x00, 0x00,
-  0x5c, 0xf1, 0xff, 0xff, 0xdc, 0x03, 0x00, 0x00, 0x6b, 0x06, 0x00, 0x00,
-  0x9b, 0x00, 0x00, 0x00, 0xc0, 0xfb, 0xff, 0xff, 0xd9, 0x0d, 0x00, 0x00,
-  0xc6, 0x09, 0x00, 0x00, 0xa2, 0xf8, 0xff, 0xff, 0x50, 0xee, 0xff, 0xff,
-  0x6e, 0xf6, 0xff, 0xff, 0xd6, 0xfe, 0xff, 0xff, 0xda, 0x03, 0x00, 0x00,
-  0xf7, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x90, 0xf0, 0xff, 0xff,
-  0x5e, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0x7f, 0xf1, 0xf3, 0x7f, 0xa4, 0xc0, 0x43, 0x3a, 0xfd, 0x0b, 0x7f, 0x06,
-  0xbd, 0xfa, 0x28, 0x94, 0xc9, 0x50, 0x38, 0xe8, 0x81, 0xd3, 0x73, 0x14,
-  0x81, 0x24, 0x32, 0x1b, 0xfe, 0x69, 0x54, 0x7f, 0x81, 0xae, 0x21, 0x44,
-  0xe9, 0x81, 0x0d, 0x2c, 0x81, 0x33, 0xf6, 0x6d, 0x04, 0x7f, 0x89, 0xc7,
-  0xf2, 0x36, 0x0d, 0xb9, 0xa6, 0xe1, 0x7f, 0x7f, 0x3d, 0xfc, 0x81, 0xb3,
-  0xd5, 0x43, 0x48, 0x81, 0x30, 0xcd, 0x12, 0x83, 0xad, 0xdc, 0xb0, 0xfa,
-  0x10, 0xca, 0xfe, 0xc1, 0xce, 0x7f, 0x88, 0x9d, 0xde, 0x81, 0x23, 0x5a,
-  0x9c, 0xc8, 0xcb, 0x3a, 0x9d, 0x04, 0xb3, 0xf4, 0xf4, 0xe7, 0xab, 0x5c,
-  0x12, 0x9e, 0x40, 0x45, 0x42, 0x9a, 0xf9, 0x5b, 0x13, 0xde, 0x0e, 0x70,
-  0x5c, 0xdf, 0x81, 0x49, 0xce, 0x25, 0x5d, 0x33, 0x9e, 0x81, 0x09, 0x38,
-  0x87, 0x09, 0x81, 0x27, 0x1c, 0xd7, 0xf2, 0xd3, 0x5c, 0xad, 0x24, 0xbf,
-  0x4b, 0x63, 0x29, 0xd0, 0xf7, 0x6a, 0x11, 0x18, 0x31, 0x17, 0x14, 0xad,
-  0x8b, 0x32, 0x81, 0x7f, 0x36, 0xd4, 0xac, 0x01, 0x45, 0x49, 0x45, 0x4c,
-  0x7f, 0xaf, 0xed, 0x2d, 0x04, 0x3a, 0x5a, 0x7f, 0x41, 0x11, 0xd4, 0xc1,
-  0x4d, 0xb5, 0x08, 0x81, 0x0a, 0xbc, 0xb0, 0x07, 0x81, 0x20, 0x45, 0xe6,
-  0xbd, 0x97, 0x71, 0x43, 0xb1, 0x7f, 0x5d, 0x28, 0x1e, 0x7f, 0x61, 0xa7,
-  0x38, 0xa2, 0x9f, 0x54, 0x0e, 0xa1, 0x4d, 0xd3, 0xf7, 0xf1, 0x45, 0xc9,
-  0x81, 0x52, 0x03, 0x81, 0x7a, 0x1d, 0x2b, 0x4a, 0xcd, 0x13, 0x0a, 0x7f,
-  0xb3, 0x2f, 0x18, 0x7f, 0x06, 0x7f, 0x7f, 0x20, 0x2b, 0x81, 0x59, 0x25,
-  0xb4, 0x8d, 0xec, 0x13, 0x17, 0x08, 0xb1, 0x61, 0x4f, 0xfe, 0x3f, 0xdc,
-  0x12, 0x7f, 0x89, 0xee, 0xd0, 0xe4, 0x2f, 0x71, 0x9a, 0xcc, 0xd0, 0xd1,
-  0xe6, 0x05, 0x46, 0xeb, 0x2a, 0xe6, 0x81, 0x83, 0xce, 0xae, 0x45, 0x12,
-  0x8a, 0xee, 0x05, 0xc4, 0xfb, 0x72, 0x81, 0xcd, 0xa9, 0xbc, 0x4c, 0x7f,
-  0x42, 0xfa, 0xca, 0x43, 0xc9, 0x08, 0x81, 0x29, 0x25, 0xe0, 0xdc, 0x4a,
-  0x3f, 0x26, 0x40, 0xf5, 0x81, 0xea, 0x39, 0x05, 0xcb, 0xfd, 0x19, 0x36,
-  0x03, 0xed, 0x0a, 0x1e, 0xe6, 0x10, 0x0b, 0xf0, 0xa5, 0x8a, 0xfb, 0x05,
-  0x81, 0x08, 0xa5, 0x81, 0x02, 0xd2, 0x33, 0xd0, 0xe1, 0x81, 0x12, 0xc8,
-  0x26, 0x1d, 0x69, 0xb0, 0xd6, 0x30, 0x35, 0xae, 0x8d, 0x9b, 0x4b, 0x4a,
-  0x54, 0x19, 0x83, 0x0f, 0x33, 0x7f, 0xa6, 0x56, 0x00, 0xbd, 0xa9, 0x14,
-  0x39, 0xaf, 0xfd, 0x52, 0x11, 0x56, 0x54, 0x23, 0xb5, 0x09, 0xc9, 0xfe,
-  0x07, 0xd9, 0xd2, 0xf8, 0x1f, 0x10, 0xf1, 0x1b, 0xd5, 0x75, 0x81, 0xe6,
-  0x96, 0x8b, 0xa4, 0x20, 0x89, 0x34, 0x55, 0x65, 0x0b, 0x37, 0x96, 0x13,
-  0x39, 0xc6, 0x17, 0x4c, 0xff, 0x97, 0x11, 0x7f, 0x12, 0x7f, 0x46, 0x81,
-  0x4d, 0x65, 0xd4, 0x1a, 0x6d, 0xad, 0x4f, 0x05, 0x61, 0x23, 0x81, 0x5e,
-  0xd7, 0xfd, 0x40, 0x43, 0xcd, 0x76, 0x56, 0xef, 0x50, 0x77, 0xd2, 0xe1,
-  0x4b, 0xb2, 0x81, 0x7f, 0x4e, 0x81, 0xbc, 0x57, 0x7f, 0x55, 0x3d, 0x76,
-  0xce, 0xeb, 0xff, 0x81, 0x81, 0x2e, 0x46, 0x43, 0x3b, 0x03, 0xbc, 0x8b,
-  0x81, 0xe6, 0x81, 0x2a, 0xaa, 0xc0, 0xf2, 0xa1, 0x81, 0x11, 0x7f, 0x17,
-  0x81, 0x5f, 0x40, 0xda, 0x1f, 0xeb, 0xea, 0xfd, 0x7f, 0x21, 0xa7, 0x5f,
-  0xee, 0x01, 0xee, 0xe6, 0xec, 0xca, 0xb3, 0xae, 0xaf, 0xd2, 0x1b, 0x04,
-  0x74, 0xf5, 0x81, 0x07, 0xf4, 0x2d, 0x45, 0xf3, 0x07, 0xa1, 0x42, 0x26,
-  0xd7, 0x04, 0xbd, 0x7f, 0x12, 0x93, 0x7f, 0x33, 0xa8, 0xc0, 0xc0, 0x26,
-  0x83, 0x05, 0xa2, 0xc2, 0xb8, 0xc7, 0xb0, 0x95, 0x15, 0x23, 0x8d, 0x81,
-  0xfb, 0x7f, 0xe2, 0x27, 0x82, 0x32, 0x00, 0xd3, 0x42, 0x10, 0x4d, 0xbc,
-  0x65, 0x17, 0xfd, 0x6c, 0x22, 0x62, 0x8b, 0x1d, 0x3b, 0x81, 0xcc, 0x56,
-  0x4f, 0xd2, 0x1d, 0x0d, 0x29, 0x32, 0xe5, 0x67, 0x17, 0xff, 0x0b, 0x36,
-  0xac, 0x8f, 0x81, 0xb5, 0x24, 0xb1, 0xb0, 0x08, 0x08, 0xf4, 0xa2, 0xb9,
-  0xc7, 0x09, 0xd8, 0xd2, 0xbb, 0xe5, 0x02, 0x6f, 0xcc, 0x58, 0xeb, 0x2c,
-  0xaa, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x0c, 0xf7, 0xff, 0xff, 0x05, 0x0a, 0x00, 0x00, 0xca, 0x06, 0x00, 0x00,
-  0x16, 0x05, 0x00, 0x00, 0xfd, 0x06, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00,
-  0xbe, 0xf7, 0xff, 0xff, 0x72, 0xfd, 0xff, 0xff, 0x2a, 0x0b, 0x00, 0x00,
-  0xc0, 0xf6, 0xff, 0xff, 0x4d, 0xfa, 0xff, 0xff, 0xea, 0x0d, 0x00, 0x00,
-  0x61, 0x02, 0x00, 0x00, 0x47, 0xf7, 0xff, 0xff, 0x68, 0x04, 0x00, 0x00,
-  0xb0, 0x0b, 0x00, 0x00, 0x9f, 0xf8, 0xff, 0xff, 0xb8, 0x01, 0x00, 0x00,
-  0xa4, 0x00, 0x00, 0x00, 0xb0, 0xec, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0x32, 0xfb, 0xff, 0xff, 0xe2, 0x0c, 0x00, 0x00, 0x2b, 0xf4, 0xff, 0xff,
-  0x16, 0x0c, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00,
-  0xcf, 0xf8, 0xff, 0xff, 0xdc, 0xfa, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff,
-  0x49, 0xfa, 0xff, 0xff, 0x26, 0xf5, 0xff, 0xff, 0x05, 0xf9, 0xff, 0xff,
-  0xe1, 0xfd, 0xff, 0xff, 0x5d, 0xf9, 0xff, 0xff, 0xd5, 0xf5, 0xff, 0xff,
-  0xfb, 0x00, 0x00, 0x00, 0x18, 0x0a, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00,
-  0x39, 0xf9, 0xff, 0xff, 0xeb, 0x00, 0x00, 0x00, 0xd3, 0x0f, 0x00, 0x00,
-  0x67, 0x05, 0x00, 0x00, 0x04, 0xf5, 0xff, 0xff, 0x2d, 0xf7, 0xff, 0xff,
-  0x3e, 0xfe, 0xff, 0xff, 0x59, 0x09, 0x00, 0x00, 0x96, 0xf7, 0xff, 0xff,
-  0x85, 0x07, 0x00, 0x00, 0xcf, 0xf9, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00,
-  0x27, 0x06, 0x00, 0x00, 0xdc, 0x16, 0x00, 0x00, 0x90, 0x11, 0x00, 0x00,
-  0x2b, 0xfc, 0xff, 0xff, 0x67, 0xf6, 0xff, 0xff, 0x52, 0x13, 0x00, 0x00,
-  0x24, 0xfd, 0xff, 0xff, 0x90, 0x0b, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x00,
-  0x12, 0x07, 0x00, 0x00, 0x8b, 0xfc, 0xff, 0xff, 0xed, 0x00, 0x00, 0x00,
-  0x04, 0x08, 0x00, 0x00, 0xb6, 0xd8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x04, 0x4b, 0xe7, 0x0d, 0xf6, 0xed, 0x2f, 0x22,
-  0x37, 0x02, 0x3c, 0x70, 0xd9, 0x8a, 0x04, 0xbd, 0xaa, 0xed, 0x0e, 0xe3,
-  0xfd, 0x4f, 0x9b, 0x5c, 0xe6, 0xf0, 0xdb, 0x04, 0x11, 0x48, 0xef, 0x24,
-  0x18, 0x52, 0xf2, 0x1a, 0x0b, 0x84, 0xeb, 0x14, 0x41, 0x11, 0xd5, 0xe2,
-  0xdf, 0x13, 0x81, 0x39, 0x21, 0x4e, 0xe6, 0x2b, 0xe6, 0xcb, 0xdc, 0x23,
-  0x0b, 0x4b, 0xd2, 0xcc, 0xaf, 0x55, 0x16, 0xfa, 0xca, 0xe1, 0x26, 0x0d,
-  0xec, 0x01, 0xd9, 0x0a, 0xee, 0xc3, 0x1d, 0x1d, 0xd3, 0xac, 0xf9, 0x0f,
-  0x1e, 0xb7, 0x9c, 0x41, 0xc4, 0xbe, 0x33, 0x23, 0x0a, 0x37, 0xd2, 0x0e,
-  0xe2, 0x13, 0x0f, 0xc9, 0x27, 0x0c, 0xca, 0xf5, 0x95, 0x28, 0x52, 0x38,
-  0xb5, 0xfc, 0xa1, 0x13, 0xc1, 0x1e, 0x3a, 0x81, 0xfc, 0xe9, 0x18, 0x18,
-  0x09, 0x42, 0xba, 0xaf, 0x11, 0xd1, 0xd2, 0xc4, 0xc4, 0xb9, 0xf0, 0xdb,
-  0x40, 0x33, 0x2a, 0xd6, 0xfa, 0x1e, 0x19, 0xdb, 0xdf, 0xf1, 0x21, 0xf8,
-  0xf3, 0xd3, 0xeb, 0x2f, 0xe5, 0x27, 0x58, 0xdf, 0xd7, 0x38, 0xc1, 0xe2,
-  0x58, 0xf6, 0xfd, 0x41, 0xef, 0x0e, 0x1a, 0xf3, 0x05, 0x28, 0x00, 0x19,
-  0x2b, 0xc8, 0x14, 0xb3, 0x7f, 0x25, 0xfa, 0xba, 0xdb, 0x23, 0x1d, 0xe9,
-  0x57, 0xbe, 0x40, 0xf4, 0xcf, 0xf4, 0x43, 0x03, 0xf3, 0x1b, 0xd2, 0xeb,
-  0x0e, 0xf6, 0xd7, 0xcb, 0x12, 0xd9, 0x08, 0xe1, 0x1a, 0x06, 0x1d, 0xc5,
-  0x49, 0xd7, 0x05, 0xed, 0x12, 0x01, 0x04, 0xf8, 0x1b, 0xda, 0x07, 0x2f,
-  0xda, 0x18, 0xc0, 0xef, 0x19, 0x3e, 0x0e, 0xd3, 0x0e, 0xc0, 0xed, 0xfd,
-  0x15, 0xcb, 0x11, 0xed, 0xfe, 0xe5, 0x12, 0x17, 0xfa, 0xc9, 0xf2, 0x12,
-  0xfc, 0x30, 0xdd, 0xdc, 0xc0, 0x1e, 0x7f, 0xe6, 0x00, 0xdc, 0x0f, 0xef,
-  0x10, 0x3d, 0x3c, 0x1f, 0xd2, 0xde, 0xe1, 0xb8, 0xbb, 0x10, 0xe7, 0xf8,
-  0x41, 0x31, 0xda, 0x87, 0x26, 0x67, 0xc3, 0x68, 0xc1, 0xf7, 0x08, 0x41,
-  0x0c, 0xad, 0x81, 0xc9, 0xef, 0xf8, 0x1e, 0x1d, 0x06, 0x01, 0xf0, 0xd8,
-  0x9c, 0xb4, 0xd6, 0xe6, 0xeb, 0x05, 0xab, 0x13, 0xfc, 0xb8, 0xde, 0x16,
-  0x18, 0x5f, 0xe5, 0x08, 0xdf, 0x09, 0xc9, 0x08, 0xe6, 0x89, 0xa4, 0xca,
-  0x3f, 0xbb, 0x06, 0xd6, 0xc1, 0xea, 0x76, 0xc2, 0x20, 0xbc, 0xcf, 0xc7,
-  0x5d, 0x41, 0x09, 0xdf, 0xe2, 0x1e, 0x06, 0xd7, 0x6c, 0x2c, 0x08, 0x23,
-  0xc2, 0xd2, 0xcd, 0x0c, 0xed, 0xc8, 0xee, 0xd7, 0x3a, 0x42, 0xb8, 0xcd,
-  0x47, 0xd2, 0x31, 0xb8, 0xff, 0xde, 0xd9, 0xff, 0x07, 0x24, 0xe9, 0x07,
-  0xf1, 0xc7, 0xef, 0xe4, 0xd2, 0xc5, 0xd0, 0x0d, 0x55, 0xbb, 0x02, 0x7f,
-  0xd5, 0xf8, 0xf2, 0x1d, 0x3e, 0x04, 0x1b, 0x43, 0x3a, 0x13, 0xcf, 0x3f,
-  0xbe, 0xe3, 0x35, 0xcb, 0x20, 0x03, 0x24, 0xab, 0xca, 0x53, 0x1a, 0xf0,
-  0x01, 0x28, 0x33, 0xca, 0xfd, 0xea, 0xc5, 0x34, 0xfe, 0xe1, 0x50, 0xf4,
-  0x0b, 0x0d, 0x02, 0x27, 0x07, 0x2f, 0xfa, 0x0b, 0xf8, 0x40, 0xb8, 0xd5,
-  0xec, 0xea, 0xe5, 0xed, 0xe3, 0x01, 0x21, 0xd6, 0x7f, 0x1e, 0x17, 0xdc,
-  0x09, 0x37, 0x2f, 0xfe, 0x14, 0xcb, 0x25, 0xea, 0xca, 0xbc, 0x1c, 0x06,
-  0x26, 0x23, 0xd0, 0xcc, 0xde, 0xd4, 0xd1, 0x1e, 0xf6, 0x47, 0x3e, 0x91,
-  0x27, 0xcd, 0x0f, 0xbe, 0x4a, 0xb8, 0x24, 0xf3, 0x25, 0xb8, 0xeb, 0xcd,
-  0xcf, 0xf5, 0x7f, 0xd4, 0xc1, 0x21, 0x24, 0x32, 0xb6, 0x04, 0x0e, 0xf0,
-  0x1c, 0x3e, 0x1a, 0x0e, 0xfb, 0xe3, 0x12, 0x28, 0x0b, 0x30, 0xb2, 0x09,
-  0x52, 0x53, 0xd8, 0x0d, 0x00, 0x05, 0x06, 0x21, 0xd8, 0xf2, 0x1a, 0x4d,
-  0x16, 0x09, 0x1c, 0xdc, 0xeb, 0xfe, 0xb9, 0x33, 0xe3, 0xc3, 0xe2, 0x1b,
-  0x81, 0x22, 0x39, 0xea, 0x36, 0xb9, 0xcd, 0xff, 0x14, 0xb3, 0xba, 0x37,
-  0xac, 0x1a, 0x3b, 0xcd, 0xfb, 0xee, 0xbf, 0x3f, 0xff, 0xbe, 0x2e, 0x0e,
-  0xe6, 0x24, 0xd6, 0xf0, 0xe7, 0x15, 0x2d, 0xf7, 0xf0, 0xc4, 0xbc, 0xcc,
-  0xf5, 0xd4, 0x10, 0x35, 0x08, 0x62, 0x06, 0x43, 0xc5, 0xfc, 0x1d, 0xe0,
-  0x3d, 0x93, 0x01, 0xfd, 0x25, 0x30, 0xc0, 0xdf, 0x0b, 0xcf, 0x0b, 0x37,
-  0xd0, 0x1d, 0x34, 0xbf, 0x9f, 0x6e, 0x28, 0xe9, 0x21, 0x36, 0x44, 0x75,
-  0x16, 0x38, 0x49, 0x01, 0xe8, 0xf3, 0xda, 0xdb, 0xe4, 0x0c, 0x0a, 0x06,
-  0x55, 0x16, 0x3c, 0x58, 0xfd, 0x0d, 0x32, 0x62, 0x45, 0xfd, 0x1c, 0xf3,
-  0x40, 0x2c, 0x18, 0x7f, 0xf1, 0xc5, 0x10, 0x2c, 0xfb, 0xa8, 0xad, 0x9c,
-  0x38, 0xe0, 0xee, 0x3f, 0x5d, 0x1b, 0x19, 0x23, 0xff, 0x4f, 0x0b, 0x0d,
-  0x40, 0xc9, 0x55, 0xde, 0x07, 0x16, 0xe0, 0x32, 0x14, 0xf8, 0x9a, 0x39,
-  0xfa, 0x45, 0xeb, 0x7f, 0x37, 0x51, 0x71, 0x17, 0xc6, 0x2a, 0x01, 0xc1,
-  0x14, 0xdc, 0x47, 0x29, 0x4e, 0x71, 0xee, 0x52, 0x40, 0xed, 0xe0, 0x44,
-  0x4b, 0x05, 0x3f, 0xd0, 0x46, 0x01, 0xfe, 0x52, 0x70, 0xc8, 0x01, 0xf6,
-  0xfd, 0xfb, 0xbf, 0x8b, 0xbc, 0x01, 0x20, 0x47, 0x5f, 0x45, 0x3d, 0x33,
-  0x63, 0xd6, 0x34, 0xbe, 0x33, 0x6d, 0x51, 0x9e, 0xe7, 0xe7, 0xe0, 0x5d,
-  0x02, 0xb3, 0x48, 0x6b, 0x09, 0xf4, 0xf1, 0x10, 0x59, 0x5a, 0xfd, 0x31,
-  0xfb, 0x4a, 0x81, 0xfe, 0x44, 0x47, 0xe4, 0x2c, 0xa2, 0xb7, 0x94, 0x69,
-  0x64, 0xbc, 0x3b, 0x28, 0x97, 0x0f, 0x5b, 0x08, 0xeb, 0x40, 0xa2, 0x66,
-  0x1d, 0xed, 0x26, 0xe0, 0xf4, 0x36, 0xcc, 0x42, 0xf0, 0x3f, 0x74, 0xa6,
-  0x03, 0xf0, 0x04, 0xf4, 0x1b, 0xe4, 0x78, 0xff, 0x44, 0x9d, 0xf8, 0xd8,
-  0x37, 0x49, 0xf1, 0x5d, 0x2d, 0x44, 0xe0, 0x91, 0xfe, 0x35, 0xc8, 0x2b,
-  0x11, 0xe5, 0x31, 0xfd, 0x28, 0xf6, 0x04, 0xeb, 0xe3, 0xca, 0x5c, 0xa5,
-  0xfa, 0x34, 0xe4, 0x32, 0x21, 0xce, 0x40, 0xfc, 0xfb, 0xff, 0xc7, 0xc1,
-  0xf3, 0x1f, 0x30, 0x4a, 0xe8, 0xf2, 0x2e, 0xbc, 0x7f, 0x0e, 0xf9, 0xc4,
-  0xd9, 0x18, 0xd3, 0xb8, 0xe9, 0xc4, 0xad, 0xf4, 0x18, 0xad, 0xf8, 0xef,
-  0xc7, 0x05, 0xed, 0x17, 0xc2, 0x10, 0xe7, 0x3d, 0x33, 0x1d, 0x9f, 0xd6,
-  0xd8, 0xeb, 0x10, 0xd0, 0xf8, 0xfd, 0x7f, 0xc3, 0x2d, 0xc2, 0x30, 0x33,
-  0x53, 0xf0, 0xe1, 0x2d, 0xe6, 0x1f, 0x2d, 0x48, 0x7e, 0xd0, 0xcf, 0x37,
-  0xf7, 0x4d, 0xb4, 0xb8, 0xf2, 0x43, 0x60, 0x4f, 0x1b, 0x3e, 0xd7, 0x11,
-  0x3f, 0x95, 0x0a, 0xfd, 0xf8, 0x2b, 0x2a, 0xe0, 0x53, 0x38, 0x3d, 0xc4,
-  0xa9, 0x41, 0x25, 0x2d, 0x2b, 0x05, 0x00, 0x2c, 0x20, 0x0a, 0x0a, 0x3e,
-  0xea, 0x2f, 0x15, 0xad, 0xef, 0x03, 0x22, 0xf6, 0xce, 0x31, 0x81, 0xee,
-  0xb5, 0x1a, 0xf2, 0xfb, 0xea, 0x20, 0x19, 0xd5, 0xf5, 0x00, 0xc5, 0xe3,
-  0xc4, 0x35, 0xe5, 0xe5, 0xf8, 0x03, 0x24, 0x36, 0xcc, 0xee, 0xe0, 0xb4,
-  0xbb, 0xd6, 0x0a, 0x03, 0x1a, 0xf0, 0x19, 0xfd, 0x37, 0xc9, 0x23, 0xd8,
-  0xdd, 0xd2, 0xa6, 0x45, 0xf2, 0xfb, 0x2e, 0xea, 0x06, 0xaf, 0xd8, 0xbb,
-  0xfd, 0x21, 0x08, 0x0e, 0xe6, 0x39, 0x08, 0x5f, 0x2c, 0x12, 0x47, 0x6b,
-  0xb8, 0x28, 0x7f, 0x22, 0x06, 0x18, 0x00, 0xd3, 0xca, 0xf5, 0x11, 0x3a,
-  0x24, 0xfa, 0x46, 0xc2, 0xdf, 0x03, 0x4b, 0xeb, 0xfd, 0x0f, 0xe5, 0xc8,
-  0xe3, 0x26, 0xd1, 0x1f, 0x3a, 0xeb, 0x27, 0xc2, 0xfd, 0xdc, 0x03, 0xf8,
-  0x3d, 0xd8, 0x28, 0x31, 0x1b, 0xe2, 0xdf, 0x0a, 0x42, 0xf6, 0xe7, 0x5c,
-  0x06, 0xc4, 0x15, 0xed, 0x9b, 0x1a, 0xe3, 0x00, 0xda, 0xd7, 0xd5, 0x59,
-  0xd3, 0xf1, 0xce, 0x22, 0x9b, 0x07, 0xb9, 0xcc, 0x01, 0x46, 0x31, 0x3a,
-  0xcb, 0xe6, 0x8b, 0xbd, 0x38, 0x01, 0x5b, 0xb9, 0x51, 0x1d, 0x92, 0xae,
-  0x18, 0x11, 0x7b, 0xba, 0x8d, 0xa5, 0xe8, 0x2c, 0xbd, 0x39, 0x18, 0x16,
-  0x12, 0x10, 0x21, 0xe0, 0xce, 0xb4, 0x30, 0x36, 0xaa, 0x14, 0x90, 0x33,
-  0xa0, 0xba, 0xeb, 0xd2, 0xaa, 0x81, 0xb7, 0xdb, 0x00, 0xf5, 0x32, 0xdc,
-  0x2d, 0xe3, 0xfb, 0xd4, 0xe4, 0xd8, 0x2e, 0x05, 0x28, 0xca, 0x53, 0xd5,
-  0x1c, 0xbf, 0xe4, 0x5e, 0xdc, 0x3e, 0xed, 0xdc, 0x92, 0x3a, 0x15, 0x2b,
-  0x38, 0xeb, 0x21, 0x5b, 0x04, 0xbe, 0xd8, 0x16, 0xda, 0x33, 0xe2, 0x04,
-  0xe6, 0xcb, 0x09, 0xed, 0x72, 0xc0, 0xe0, 0xb7, 0x19, 0x18, 0xb9, 0xe0,
-  0x3d, 0x19, 0x30, 0xb3, 0x3a, 0xcd, 0x7f, 0xcf, 0xe2, 0x0b, 0x29, 0xff,
-  0x26, 0x27, 0x08, 0xd3, 0x4f, 0xbc, 0xfa, 0xd3, 0x25, 0xd9, 0x02, 0x60,
-  0xf5, 0x48, 0x21, 0x36, 0xac, 0xae, 0x49, 0xc5, 0x00, 0x44, 0x2b, 0x3c,
-  0x51, 0xe1, 0x1d, 0xb7, 0x12, 0x4d, 0x18, 0x18, 0xd0, 0xfd, 0xad, 0x44,
-  0xbf, 0xde, 0x64, 0x52, 0x05, 0xfb, 0x1e, 0x4b, 0x31, 0xa8, 0x5a, 0xd6,
-  0x5d, 0x74, 0x0f, 0x2d, 0x11, 0x14, 0xdc, 0xb5, 0xc8, 0x81, 0xd4, 0xca,
-  0xf6, 0x19, 0x1b, 0xf1, 0xd2, 0x39, 0xba, 0xdd, 0x21, 0x09, 0x3b, 0xf5,
-  0x2b, 0xc4, 0xa6, 0x47, 0x7f, 0xe2, 0x43, 0x29, 0x10, 0x03, 0x26, 0x41,
-  0xdd, 0xfc, 0xfb, 0x22, 0x02, 0xcb, 0x5a, 0xe4, 0x1d, 0x3c, 0x43, 0x15,
-  0x29, 0x2b, 0x12, 0xcb, 0x11, 0x20, 0xea, 0x24, 0xf0, 0xcd, 0xc6, 0x66,
-  0x2a, 0xd6, 0x15, 0xf1, 0xf2, 0xc3, 0xac, 0x70, 0x4d, 0x6e, 0x54, 0x1d,
-  0x52, 0xff, 0x60, 0x03, 0xf9, 0x69, 0x36, 0x1b, 0x04, 0x1b, 0x04, 0x07,
-  0x25, 0xd8, 0xef, 0x41, 0xeb, 0x4f, 0xcc, 0x56, 0x4d, 0x33, 0x27, 0x02,
-  0xe0, 0x09, 0x09, 0x24, 0xa1, 0xf5, 0xd9, 0x56, 0x2d, 0x18, 0x56, 0xe8,
-  0x15, 0x2a, 0x4b, 0x0e, 0xd3, 0xe4, 0x1e, 0xfa, 0x7a, 0xe9, 0x6e, 0xef,
-  0xd3, 0x3c, 0xf5, 0xb7, 0xca, 0x0e, 0xdf, 0x14, 0x34, 0x6f, 0xff, 0x7f,
-  0xc0, 0x03, 0x02, 0x48, 0xee, 0x41, 0xf6, 0x3d, 0x10, 0xa0, 0x15, 0x1c,
-  0xc1, 0x03, 0x07, 0x01, 0x6d, 0xef, 0x1d, 0xff, 0x17, 0x08, 0x10, 0x3f,
-  0xf8, 0xd4, 0xa8, 0x6c, 0xc8, 0x4e, 0xe7, 0x07, 0xf6, 0xe6, 0xbe, 0x4c,
-  0x2c, 0x3f, 0xd5, 0xc8, 0xf8, 0xf2, 0xf2, 0x3f, 0xf4, 0x27, 0xe7, 0xfd,
-  0xcb, 0xe5, 0xdc, 0xc1, 0xf5, 0x06, 0xfb, 0xe0, 0x7f, 0xbd, 0xb8, 0x46,
-  0x39, 0xc9, 0xc0, 0xc4, 0x5e, 0x43, 0x38, 0xd8, 0xcf, 0x06, 0x5a, 0x36,
-  0xbe, 0x32, 0x2a, 0xbb, 0x22, 0x08, 0x4d, 0xd3, 0xed, 0x44, 0x42, 0xb6,
-  0xb9, 0x81, 0x20, 0xc6, 0x06, 0x33, 0xd5, 0x8b, 0xe6, 0x4a, 0xdf, 0xe4,
-  0x12, 0x23, 0x39, 0xe9, 0xcb, 0x99, 0xfa, 0xc8, 0x2e, 0x31, 0x1e, 0x0c,
-  0xdf, 0x0b, 0xe7, 0xcc, 0xaa, 0x39, 0xd5, 0x1b, 0x06, 0x3a, 0x52, 0x20,
-  0xfb, 0x9c, 0x25, 0xb7, 0x96, 0xb6, 0x68, 0xd0, 0x40, 0x17, 0x2a, 0x5d,
-  0x00, 0xa7, 0xf7, 0xf7, 0x2b, 0x95, 0x1b, 0x5d, 0xb5, 0x48, 0xd6, 0x17,
-  0xb2, 0xf4, 0x19, 0x1a, 0x2f, 0xe0, 0x27, 0x0b, 0x10, 0x3e, 0xad, 0xbb,
-  0xb7, 0x04, 0xc8, 0xa4, 0xac, 0xef, 0x17, 0xe7, 0xd9, 0x81, 0xd4, 0xb8,
-  0xf3, 0xff, 0xdf, 0xec, 0xe3, 0x71, 0x4a, 0xf9, 0x08, 0xc7, 0x9b, 0xdd,
-  0xb3, 0xc8, 0x62, 0xe2, 0xe5, 0x3e, 0x0d, 0xf1, 0x2a, 0xb5, 0xea, 0x36,
-  0x26, 0xb2, 0x3d, 0x65, 0xc4, 0xf4, 0x09, 0x18, 0xc5, 0xa1, 0x00, 0xc7,
-  0xba, 0x49, 0x4f, 0x35, 0xbc, 0x4e, 0x32, 0x30, 0x1e, 0x24, 0x98, 0xf7,
-  0xee, 0x87, 0x03, 0x40, 0xf1, 0xca, 0x2f, 0x19, 0x81, 0x0a, 0xb2, 0xba,
-  0xc9, 0x3e, 0xe3, 0xf1, 0xd5, 0x01, 0xcb, 0x86, 0xc9, 0xf4, 0x46, 0x16,
-  0xec, 0xcd, 0xc1, 0xc2, 0xdd, 0xe2, 0xbc, 0x00, 0xbd, 0xfd, 0xc9, 0x25,
-  0x16, 0xa5, 0xb4, 0x16, 0xb5, 0xfc, 0x9e, 0xda, 0xc2, 0x31, 0x07, 0xf0,
-  0x30, 0x04, 0x35, 0x16, 0xc2, 0xa0, 0xd5, 0x4e, 0xf7, 0xb2, 0x39, 0x4c,
-  0x9a, 0xd9, 0x4d, 0xf3, 0xdd, 0xfb, 0x17, 0xa3, 0x2c, 0x2b, 0xed, 0x14,
-  0x0f, 0x7f, 0xef, 0xfe, 0x30, 0x24, 0x06, 0x23, 0x2b, 0xa6, 0x0e, 0xc2,
-  0x50, 0xb6, 0x25, 0xa1, 0xdb, 0x07, 0x01, 0x58, 0xf7, 0xe2, 0x99, 0xa3,
-  0xbd, 0xf8, 0xbf, 0x4e, 0xeb, 0xc9, 0xdf, 0x07, 0x1b, 0xf2, 0x13, 0x05,
-  0xf8, 0x5c, 0xee, 0x48, 0x1a, 0x07, 0xde, 0x5a, 0x10, 0xe5, 0x1f, 0xe2,
-  0x13, 0x2d, 0x46, 0xec, 0x17, 0xae, 0x29, 0x05, 0xcc, 0x35, 0x1d, 0x05,
-  0x1f, 0xcc, 0xf0, 0xf7, 0xfd, 0x46, 0xc4, 0xe1, 0xbe, 0xf8, 0xe0, 0x00,
-  0xf1, 0x22, 0xd9, 0xc8, 0x38, 0x08, 0xdb, 0x10, 0xe3, 0xda, 0xdb, 0xd7,
-  0xe5, 0xf9, 0xc7, 0x07, 0xc6, 0x2c, 0x15, 0x10, 0xce, 0xbe, 0x27, 0x2d,
-  0xe3, 0x35, 0xb3, 0xef, 0x29, 0x7f, 0x0a, 0xc7, 0xc8, 0x06, 0x13, 0xe8,
-  0x15, 0x39, 0xda, 0x02, 0x6e, 0xea, 0xea, 0x1e, 0x2e, 0x2b, 0x58, 0x45,
-  0x2f, 0xda, 0xfb, 0xda, 0xa8, 0xc6, 0x81, 0xb1, 0xc8, 0xfe, 0x3f, 0xdd,
-  0xca, 0x27, 0xcb, 0x00, 0x0c, 0xcc, 0xd5, 0x1c, 0x3c, 0x3c, 0x02, 0xef,
-  0x29, 0xf3, 0x42, 0x1f, 0xda, 0x03, 0xfc, 0xc7, 0x18, 0x13, 0x15, 0xcd,
-  0xb3, 0x14, 0x08, 0x0b, 0x0c, 0x2f, 0xfc, 0x0b, 0x5a, 0xdc, 0x04, 0xb5,
-  0xd9, 0x2d, 0xe7, 0xcd, 0xd7, 0x1d, 0xc8, 0x41, 0x6a, 0x10, 0x50, 0x8b,
-  0x31, 0x33, 0x0c, 0x7f, 0x30, 0xf6, 0x69, 0xdd, 0x3b, 0xee, 0xc1, 0x41,
-  0x63, 0x20, 0xf6, 0xd8, 0xbb, 0x14, 0x52, 0x51, 0x11, 0xbc, 0x03, 0x34,
-  0x29, 0x05, 0xb3, 0xdf, 0x01, 0x6c, 0xf2, 0x1f, 0x18, 0xab, 0xfb, 0xe1,
-  0xdf, 0xc5, 0xce, 0xaa, 0xdf, 0xe1, 0xb4, 0x05, 0x30, 0x40, 0x34, 0x05,
-  0xb6, 0x2c, 0x3a, 0xe7, 0xa7, 0x24, 0x06, 0xe4, 0x18, 0xcc, 0xfb, 0x62,
-  0x1b, 0x2f, 0xec, 0xdb, 0x23, 0xf6, 0xf8, 0x25, 0x63, 0x16, 0x6a, 0xae,
-  0x2e, 0x27, 0xf7, 0xe0, 0x23, 0x07, 0x08, 0x0e, 0xf8, 0x56, 0x10, 0xe5,
-  0x53, 0xc9, 0x03, 0x3e, 0x09, 0xe3, 0x22, 0xd7, 0x02, 0x01, 0x46, 0x2f,
-  0x07, 0x4a, 0x17, 0xc1, 0x07, 0xb2, 0xfb, 0xdf, 0x1d, 0x3a, 0xe9, 0xf1,
-  0xe0, 0x7f, 0x07, 0x17, 0xef, 0x5b, 0x18, 0x23, 0x06, 0x07, 0xfe, 0xb3,
-  0x04, 0x25, 0xd2, 0xfe, 0xc5, 0x06, 0x17, 0xcf, 0xaa, 0xba, 0x21, 0x32,
-  0xac, 0xac, 0x81, 0xb2, 0xca, 0x3d, 0xa7, 0x1c, 0xb0, 0x4f, 0xe1, 0xf7,
-  0xf9, 0xcb, 0x3e, 0x40, 0x3c, 0xcb, 0xd6, 0x6c, 0x47, 0xa5, 0x4e, 0x11,
-  0x07, 0xbb, 0xab, 0x94, 0x17, 0x07, 0x06, 0xa1, 0xe8, 0x0e, 0xcb, 0x0a,
-  0xa0, 0xc6, 0x0b, 0x8f, 0x47, 0x94, 0x2c, 0xff, 0xe4, 0x0b, 0xf2, 0x0b,
-  0xdf, 0xb7, 0xea, 0x3f, 0x0b, 0x9d, 0x39, 0xd1, 0xe4, 0xa3, 0x16, 0xd2,
-  0x24, 0x18, 0xd1, 0xbd, 0x23, 0xda, 0x51, 0xe7, 0x49, 0x38, 0xf6, 0x33,
-  0x5d, 0x34, 0x20, 0xcb, 0x27, 0xbf, 0x83, 0xe4, 0x63, 0x2b, 0xd4, 0x22,
-  0xf5, 0xb9, 0x02, 0xc3, 0xb8, 0xd9, 0x2c, 0x43, 0xdb, 0xb7, 0xe1, 0xe8,
-  0x70, 0xaf, 0x17, 0xaf, 0x3c, 0x0a, 0x4c, 0xa0, 0x50, 0x45, 0x2e, 0x81,
-  0xd5, 0xe5, 0x6f, 0xc1, 0x63, 0x23, 0xbd, 0x9a, 0xfa, 0xb5, 0x0c, 0x1e,
-  0xc5, 0x5a, 0x26, 0x24, 0x99, 0xbc, 0x7f, 0xab, 0x6a, 0x33, 0x21, 0x2c,
-  0x72, 0xd4, 0xc5, 0x74, 0x38, 0x05, 0x35, 0x10, 0xc1, 0x0d, 0x16, 0xfa,
-  0xf0, 0xa2, 0xba, 0xf2, 0xeb, 0x81, 0x0a, 0x6d, 0x3e, 0x39, 0x08, 0x6f,
-  0xe9, 0x12, 0x8b, 0xc3, 0x70, 0xe6, 0xed, 0xa1, 0x2c, 0xff, 0x58, 0xec,
-  0x96, 0x4b, 0x2f, 0x16, 0xac, 0x36, 0x0a, 0x85, 0x46, 0xea, 0xf9, 0xa5,
-  0x46, 0x2b, 0xe2, 0x51, 0xbc, 0x39, 0x51, 0xb5, 0xe6, 0xc9, 0xef, 0x67,
-  0xad, 0x27, 0x0c, 0x1b, 0xe2, 0xbf, 0xae, 0x10, 0xd3, 0x07, 0x7f, 0xc1,
-  0xe2, 0x2d, 0xdf, 0x32, 0x02, 0xf8, 0x18, 0x3a, 0xdb, 0x7a, 0xd0, 0xd1,
-  0x30, 0xff, 0x0d, 0xee, 0x5e, 0x2b, 0x25, 0x64, 0xd9, 0x1f, 0x07, 0xb8,
-  0x07, 0xfb, 0x50, 0xfa, 0x4b, 0x22, 0x3c, 0x62, 0x32, 0x38, 0x7d, 0x10,
-  0x1c, 0xe4, 0x08, 0xe3, 0xd0, 0x05, 0x0e, 0x03, 0x9c, 0xf6, 0x86, 0x16,
-  0x97, 0xde, 0x36, 0xc8, 0x20, 0xdd, 0x16, 0x0f, 0xdc, 0xb4, 0xc3, 0x9f,
-  0xc9, 0xb4, 0x4c, 0x50, 0x11, 0xd5, 0x4d, 0x4c, 0xca, 0x7f, 0x43, 0xaa,
-  0x59, 0x22, 0x36, 0x36, 0xb7, 0xce, 0x38, 0xef, 0x97, 0xf0, 0x02, 0x48,
-  0xd4, 0x4b, 0xb6, 0x28, 0x1f, 0x55, 0x33, 0x49, 0xd8, 0xc7, 0xc1, 0xff,
-  0xcb, 0x40, 0x7c, 0x00, 0xc9, 0x0d, 0x5a, 0x54, 0xbd, 0x53, 0xa2, 0x11,
-  0x11, 0x28, 0xb5, 0xda, 0xe8, 0x02, 0x19, 0x0f, 0x29, 0xc2, 0x32, 0xcf,
-  0x48, 0x3e, 0x0a, 0xce, 0x22, 0x11, 0x7f, 0x20, 0x44, 0xe1, 0xf3, 0xdb,
-  0xd9, 0x10, 0xde, 0xf9, 0x2e, 0x04, 0xed, 0xe4, 0x21, 0x31, 0x44, 0x3c,
-  0x03, 0x5b, 0xdb, 0xdb, 0x18, 0x03, 0xd3, 0xa4, 0xc2, 0x24, 0xa7, 0xd4,
-  0x06, 0x24, 0xd2, 0x01, 0x41, 0xe6, 0x2d, 0x1d, 0x9f, 0xd5, 0xff, 0xc5,
-  0x61, 0xf3, 0x17, 0x2b, 0x2f, 0x5a, 0x31, 0xa3, 0x47, 0x3b, 0xe2, 0xab,
-  0x3c, 0xef, 0x28, 0x33, 0x53, 0xd1, 0xf9, 0x5d, 0xc0, 0xd1, 0x63, 0xc7,
-  0xf9, 0x2b, 0xd3, 0xf1, 0x1f, 0x6a, 0x3b, 0x4c, 0x02, 0x34, 0xb1, 0x8b,
-  0xb4, 0x49, 0xad, 0x15, 0x04, 0x3e, 0x66, 0xd2, 0x7f, 0xce, 0xe1, 0xf8,
-  0xae, 0x10, 0xe0, 0xf9, 0xd1, 0xf6, 0x29, 0xba, 0xc7, 0x87, 0x6a, 0x1a,
-  0xc0, 0x2e, 0xf8, 0x21, 0x18, 0xe6, 0x20, 0x05, 0x09, 0x3e, 0xac, 0xcd,
-  0xd2, 0x42, 0xee, 0xda, 0xf4, 0x5c, 0xfd, 0x15, 0xf0, 0x27, 0x26, 0x46,
-  0x0e, 0x10, 0x6d, 0xb3, 0x31, 0x21, 0x99, 0xd2, 0xfe, 0xd5, 0x13, 0xd4,
-  0x47, 0x43, 0xdb, 0x1c, 0xc6, 0x28, 0x2b, 0x63, 0x2c, 0xac, 0x32, 0xf3,
-  0x68, 0x81, 0xff, 0xaa, 0x38, 0xfe, 0x24, 0x2e, 0xd1, 0x3a, 0x44, 0x11,
-  0x42, 0x8a, 0xc8, 0x55, 0xe3, 0x50, 0xf4, 0x59, 0xd7, 0xff, 0x00, 0x15,
-  0xd8, 0x38, 0xe5, 0x05, 0x55, 0x60, 0xdc, 0x3f, 0x37, 0x44, 0x29, 0x6b,
-  0xf0, 0x0b, 0xfd, 0x23, 0x4d, 0xd2, 0x52, 0x9c, 0xc9, 0xd0, 0xae, 0xef,
-  0xf4, 0x13, 0xeb, 0xde, 0xb5, 0x62, 0xc9, 0xdc, 0x8e, 0x23, 0xf0, 0xe0,
-  0x06, 0xb4, 0xf8, 0x32, 0x7f, 0xb2, 0x46, 0xce, 0x72, 0xea, 0xb2, 0xe7,
-  0x11, 0xca, 0xa5, 0xb4, 0xda, 0xe8, 0xba, 0x18, 0x42, 0x60, 0x0d, 0x9a,
-  0x16, 0xb5, 0x25, 0xfb, 0xfc, 0xb3, 0x49, 0x7f, 0xe6, 0xfb, 0xdd, 0xe3,
-  0x42, 0xfc, 0x32, 0xb9, 0x57, 0x16, 0xbb, 0x06, 0xcc, 0x78, 0x2c, 0xfc,
-  0xf4, 0xc0, 0x02, 0xb2, 0x68, 0x52, 0x58, 0x1d, 0xe2, 0xdd, 0xd4, 0x10,
-  0x10, 0xb8, 0x22, 0xfa, 0x21, 0x4c, 0xe2, 0xab, 0xe1, 0xa2, 0x53, 0x2d,
-  0x0f, 0x00, 0x0e, 0xab, 0xb7, 0xf3, 0x41, 0x54, 0x9e, 0x70, 0xbf, 0x03,
-  0x34, 0xdf, 0x4e, 0x65, 0xc6, 0xf7, 0x49, 0x35, 0x9f, 0x3f, 0x15, 0x21,
-  0x3c, 0xf4, 0x0a, 0xf7, 0xf9, 0x9e, 0xf1, 0x4a, 0xac, 0x2f, 0xf2, 0x0b,
-  0xbb, 0xe9, 0xe4, 0xf9, 0x02, 0xb1, 0x4e, 0xc0, 0xdc, 0x35, 0xbe, 0x1d,
-  0x23, 0xee, 0xd3, 0x36, 0x0c, 0xa7, 0xc4, 0xde, 0x08, 0x20, 0xe0, 0xa6,
-  0x29, 0x31, 0xfe, 0x2e, 0x13, 0x14, 0x17, 0x81, 0x2a, 0xc5, 0xfd, 0x11,
-  0x31, 0x36, 0x42, 0xe0, 0x2c, 0x0b, 0xf5, 0x24, 0x30, 0xc0, 0x59, 0xc1,
-  0xfe, 0x49, 0xce, 0x50, 0x0e, 0x70, 0x45, 0xc2, 0xb9, 0x7f, 0x17, 0x31,
-  0x12, 0xd6, 0x93, 0xf8, 0x69, 0x30, 0x26, 0x34, 0xeb, 0x6b, 0xf6, 0xa3,
-  0x50, 0xf4, 0x48, 0x39, 0x21, 0xe6, 0xc1, 0xf6, 0x1b, 0xfb, 0x14, 0x6d,
-  0xdd, 0xca, 0x09, 0x9a, 0x5e, 0xa7, 0xa1, 0xde, 0xe1, 0xb8, 0x0b, 0xea,
-  0xb7, 0xf0, 0xe5, 0xf4, 0x36, 0x0c, 0x2d, 0x58, 0xf7, 0x1b, 0x42, 0x3f,
-  0x43, 0x49, 0x01, 0x27, 0x3e, 0xea, 0xa7, 0xc5, 0x56, 0x1b, 0x25, 0x0c,
-  0xd7, 0x1d, 0x4a, 0xba, 0x2e, 0x17, 0xa6, 0xed, 0x36, 0x11, 0x21, 0x3c,
-  0xdd, 0x26, 0xd4, 0x9c, 0x6c, 0x20, 0xe8, 0x2a, 0xe8, 0x08, 0xf0, 0xee,
-  0x2a, 0x47, 0x0a, 0x7b, 0xe2, 0x6e, 0x01, 0x23, 0x0d, 0x91, 0xcc, 0xff,
-  0x23, 0xb0, 0x0e, 0xd7, 0x10, 0x7f, 0xcb, 0xe1, 0x54, 0xe4, 0x20, 0x23,
-  0x10, 0x39, 0x34, 0x2b, 0x56, 0xd1, 0x33, 0x1a, 0x16, 0xde, 0xfe, 0xb2,
-  0xfe, 0xec, 0xfd, 0xfa, 0x06, 0xf2, 0x33, 0x18, 0x0b, 0x33, 0x03, 0x51,
-  0x42, 0xd2, 0x0a, 0xef, 0xe5, 0x47, 0xce, 0x1f, 0x61, 0xcc, 0x22, 0x09,
-  0xbb, 0x0f, 0xac, 0xeb, 0x0e, 0xff, 0x42, 0x16, 0x06, 0xeb, 0xde, 0xab,
-  0x15, 0x8e, 0x59, 0x0e, 0xe0, 0xdc, 0x13, 0xd0, 0x32, 0x1c, 0x33, 0xbd,
-  0xbc, 0x35, 0x1c, 0xed, 0xf5, 0x2f, 0x7f, 0x62, 0xe2, 0xc4, 0xea, 0x2a,
-  0xbb, 0x3e, 0xa0, 0x14, 0x0f, 0xf5, 0x5f, 0xf9, 0x2f, 0x51, 0x26, 0xc6,
-  0xb9, 0xf8, 0xe4, 0x26, 0xef, 0x31, 0xe3, 0xc7, 0x01, 0x5c, 0xe1, 0xde,
-  0xf5, 0x01, 0xf2, 0x38, 0xff, 0x56, 0x38, 0xd0, 0xc5, 0x01, 0xf9, 0xc8,
-  0x09, 0xa8, 0x61, 0xec, 0x7f, 0xac, 0x30, 0xae, 0xf3, 0xc2, 0x9e, 0xc0,
-  0x03, 0x40, 0x23, 0xd7, 0x20, 0xba, 0x17, 0x98, 0x23, 0x2a, 0xeb, 0x0a,
-  0x40, 0x9e, 0xbb, 0x3d, 0x2a, 0x13, 0xed, 0x63, 0xc7, 0xc0, 0xfc, 0x04,
-  0x56, 0x17, 0xed, 0x92, 0xc7, 0xf7, 0x88, 0x0e, 0x45, 0x67, 0xb8, 0xf5,
-  0x12, 0xe2, 0x28, 0xb6, 0x70, 0x18, 0x51, 0x00, 0x24, 0x1d, 0xb6, 0x03,
-  0x9e, 0x37, 0x0a, 0x16, 0x2f, 0x4b, 0x53, 0x24, 0xa2, 0xab, 0xb5, 0x39,
-  0x9a, 0xd9, 0x43, 0xba, 0x60, 0xc3, 0xa8, 0x50, 0xd5, 0x7c, 0x1b, 0xea,
-  0x2f, 0xd5, 0xb9, 0x81, 0xeb, 0x59, 0x43, 0x38, 0xc3, 0x5c, 0xb5, 0x5d,
-  0x2e, 0x32, 0x45, 0x3b, 0x18, 0xb8, 0x4f, 0xd4, 0xf5, 0x74, 0xea, 0xdd,
-  0x29, 0xd0, 0xfe, 0x06, 0x55, 0xde, 0x3b, 0x65, 0xb6, 0xad, 0x2f, 0x28,
-  0x69, 0x17, 0x3a, 0x51, 0x35, 0xb4, 0x62, 0xbe, 0x2d, 0x68, 0x2d, 0xfb,
-  0x1a, 0x55, 0x57, 0x5a, 0xa0, 0xcf, 0x03, 0xdc, 0x52, 0x21, 0xfe, 0x14,
-  0xc2, 0xf5, 0xf4, 0x52, 0x52, 0x15, 0x1a, 0x46, 0x21, 0xdd, 0x7f, 0x6a,
-  0x14, 0xe3, 0x0c, 0xe1, 0x1c, 0x96, 0xe0, 0x0a, 0xb3, 0x42, 0x1d, 0xd8,
-  0xff, 0xd3, 0x58, 0xf0, 0x1e, 0xb2, 0x81, 0x51, 0x2b, 0xcf, 0x52, 0x15,
-  0xd0, 0xc0, 0x4d, 0xa3, 0x2a, 0xdd, 0x55, 0x01, 0x63, 0x21, 0x47, 0x6c,
-  0x3c, 0xae, 0x49, 0x0a, 0xea, 0x5a, 0xbf, 0x59, 0xff, 0x02, 0x82, 0xc9,
-  0xac, 0x99, 0xbc, 0xd3, 0xd8, 0xf6, 0xc4, 0xa7, 0xd3, 0xf6, 0xcf, 0x25,
-  0x44, 0x9c, 0x0c, 0x46, 0xcc, 0xcf, 0x1c, 0x1b, 0xfa, 0xce, 0x15, 0xc7,
-  0x42, 0xe1, 0x1f, 0x19, 0x2d, 0xeb, 0x2d, 0xae, 0xfc, 0x7f, 0x0a, 0x33,
-  0xf7, 0xfb, 0x47, 0xc4, 0xb5, 0xc4, 0xeb, 0xb2, 0xe3, 0x50, 0x22, 0x0b,
-  0x04, 0xb8, 0x26, 0x48, 0x0e, 0x38, 0xb6, 0x4d, 0x03, 0x1d, 0xdf, 0xdc,
-  0x24, 0xfb, 0xff, 0x20, 0x2f, 0xd2, 0xc3, 0x63, 0xf4, 0x10, 0xf2, 0x4d,
-  0xd0, 0x0e, 0x29, 0xd0, 0x03, 0xc8, 0x54, 0x19, 0x4b, 0x65, 0x84, 0x78,
-  0x51, 0x75, 0x7a, 0xc0, 0xfb, 0xd4, 0x6f, 0xcc, 0x13, 0x34, 0xb5, 0xca,
-  0x4b, 0xee, 0x99, 0x53, 0xfb, 0x17, 0x45, 0xfa, 0x43, 0x2f, 0x37, 0xcd,
-  0x0f, 0x68, 0x6a, 0x66, 0xca, 0x04, 0x31, 0x24, 0x40, 0x6b, 0x32, 0x04,
-  0x48, 0x5c, 0xe3, 0x7f, 0xd8, 0x6d, 0xdf, 0xf2, 0xc0, 0xa9, 0x5f, 0x49,
-  0xee, 0xbb, 0xbe, 0x0b, 0x63, 0xa3, 0x70, 0x26, 0x02, 0xd0, 0xe7, 0x52,
-  0xdf, 0xcb, 0xb3, 0x02, 0x05, 0x15, 0x7f, 0xe7, 0x11, 0x3e, 0xad, 0x1c,
-  0xe8, 0x25, 0x13, 0xde, 0x49, 0xf7, 0xcf, 0x46, 0xfd, 0xd6, 0xef, 0x00,
-  0xf2, 0xcf, 0x01, 0xcf, 0xad, 0x2a, 0x54, 0x43, 0x1b, 0xbb, 0xd0, 0x11,
-  0xab, 0xcf, 0xf9, 0x88, 0x04, 0x2b, 0xd0, 0x25, 0x3c, 0x0f, 0x10, 0x03,
-  0xd4, 0x25, 0x49, 0xf9, 0x3a, 0x03, 0x55, 0xfd, 0xf0, 0xc5, 0x0c, 0x0c,
-  0x0c, 0xe1, 0x2a, 0x39, 0x2d, 0x1d, 0xcb, 0xac, 0x4b, 0x1f, 0x27, 0xc2,
-  0x7f, 0xc1, 0x2c, 0x70, 0x27, 0x21, 0xa4, 0xc4, 0x52, 0xec, 0x4e, 0xdf,
-  0x4a, 0x67, 0xf6, 0x61, 0x10, 0xb9, 0xfa, 0xd4, 0x1f, 0x74, 0xe5, 0x5e,
-  0xb0, 0xd8, 0xe6, 0x5e, 0x3c, 0xbe, 0xd3, 0x24, 0x1b, 0x37, 0x57, 0xb4,
-  0x0b, 0x26, 0x10, 0x49, 0xb5, 0x2d, 0x14, 0xe1, 0x10, 0x3e, 0x22, 0x27,
-  0xf9, 0x16, 0x5d, 0x10, 0xe0, 0x4f, 0x40, 0x88, 0xe9, 0xe7, 0xe9, 0x2e,
-  0x2f, 0xdb, 0x08, 0x3b, 0xf4, 0x25, 0x40, 0xcf, 0xdd, 0xd7, 0x0c, 0x45,
-  0x05, 0x6e, 0x81, 0xbd, 0xba, 0x29, 0xdf, 0x0f, 0x7e, 0x03, 0x1e, 0x4d,
-  0xfe, 0x11, 0x06, 0xc7, 0xaa, 0xe1, 0x49, 0x0e, 0xff, 0x4a, 0x09, 0x98,
-  0x31, 0xf5, 0x86, 0x36, 0x8c, 0xba, 0x25, 0xac, 0x56, 0xfd, 0x9f, 0xfa,
-  0xbb, 0x06, 0x31, 0x35, 0x15, 0xe5, 0xd1, 0xf1, 0xe5, 0xe6, 0xe3, 0x35,
-  0xc2, 0x3b, 0x1e, 0xed, 0xcf, 0x95, 0x3c, 0x0f, 0xf7, 0x18, 0xff, 0xf8,
-  0xc9, 0x2f, 0xa9, 0x09, 0x3c, 0x16, 0xe0, 0xc1, 0xfa, 0x43, 0xd4, 0x25,
-  0x47, 0x09, 0x3c, 0xe4, 0x29, 0x81, 0x00, 0x8f, 0x07, 0xe5, 0x16, 0xdb,
-  0x07, 0x17, 0xbe, 0xc0, 0x9b, 0xcc, 0xd7, 0x67, 0xa9, 0x9b, 0x44, 0xca,
-  0x37, 0xe7, 0xb4, 0x06, 0x9a, 0xe5, 0x43, 0x51, 0x24, 0x35, 0x5c, 0x46,
-  0xde, 0xa8, 0x15, 0x04, 0xc7, 0x38, 0x36, 0x09, 0x0d, 0xfd, 0xd0, 0x07,
-  0x2b, 0x19, 0x81, 0xf3, 0x96, 0xef, 0x1a, 0xf8, 0xff, 0x08, 0xfd, 0xbe,
-  0xbf, 0xee, 0x04, 0x1a, 0xdb, 0x28, 0xf2, 0xfd, 0x05, 0xd6, 0x55, 0x28,
-  0x12, 0xc4, 0xfb, 0x98, 0x01, 0xdf, 0x46, 0x20, 0x08, 0xfe, 0x14, 0x2c,
-  0x35, 0xbc, 0x48, 0x42, 0xc4, 0xa9, 0x83, 0x0c, 0xff, 0xd5, 0x1a, 0x0b,
-  0x09, 0x9d, 0xc9, 0xc5, 0x2b, 0xe1, 0x2b, 0xe6, 0x58, 0xb3, 0x4f, 0x05,
-  0x14, 0x0e, 0x4a, 0xa6, 0x05, 0x34, 0xe1, 0x23, 0x56, 0x1f, 0xf7, 0x18,
-  0x15, 0xd6, 0x1e, 0xe4, 0xd6, 0xf7, 0x0e, 0xbd, 0xd0, 0x22, 0xd4, 0x7f,
-  0xdd, 0x29, 0xf8, 0xd8, 0x8e, 0x69, 0x4a, 0xf7, 0x3e, 0x19, 0x50, 0xcc,
-  0x4a, 0x30, 0x40, 0x03, 0x5f, 0x7b, 0x3a, 0x3f, 0xc3, 0xf4, 0xec, 0xef,
-  0xe1, 0x0b, 0x3c, 0xd9, 0x2b, 0xf2, 0x16, 0xcd, 0xdb, 0xd2, 0x2b, 0xbc,
-  0x5c, 0x3a, 0x6e, 0x01, 0xc8, 0xa7, 0xfc, 0x61, 0x1a, 0x30, 0xf2, 0xd3,
-  0x5b, 0xd1, 0xc7, 0xef, 0x6b, 0x64, 0xcf, 0xa2, 0xc5, 0xee, 0xd5, 0x39,
-  0x33, 0x1a, 0xab, 0x2c, 0x88, 0x08, 0x65, 0x4f, 0x52, 0x5d, 0x69, 0x5e,
-  0x65, 0xea, 0x29, 0x01, 0xde, 0x17, 0xe9, 0xf9, 0x33, 0x9d, 0xd8, 0x97,
-  0x81, 0x50, 0xa7, 0xda, 0x09, 0xa9, 0x6b, 0x40, 0xb8, 0x79, 0x96, 0xe8,
-  0xca, 0x5a, 0x31, 0xfa, 0x99, 0x0f, 0xde, 0x6e, 0x95, 0xf4, 0x3a, 0xb0,
-  0xf7, 0x0e, 0x00, 0xed, 0xf2, 0x2d, 0xf1, 0xfa, 0x4b, 0xdc, 0xb2, 0x38,
-  0xd1, 0x1c, 0xc4, 0x0b, 0xcf, 0x0b, 0xf9, 0x00, 0x21, 0x81, 0x5a, 0xb7,
-  0x4e, 0xe8, 0x12, 0x38, 0x02, 0x1c, 0x07, 0xa0, 0xd5, 0xca, 0xfc, 0x50,
-  0xe5, 0xd9, 0xe4, 0xee, 0xa1, 0xe7, 0xd7, 0xd9, 0xe8, 0xfa, 0xea, 0x56,
-  0x4a, 0x0c, 0x2b, 0x49, 0x35, 0xa6, 0xe9, 0x55, 0x9d, 0xa4, 0x4b, 0xd3,
-  0x53, 0xa4, 0xee, 0xd2, 0x19, 0xf3, 0xa4, 0x03, 0xf8, 0x2f, 0xb9, 0xe2,
-  0x81, 0x28, 0x53, 0xff, 0x21, 0xca, 0xf8, 0xf2, 0x59, 0xb3, 0xe8, 0x72,
-  0x96, 0x97, 0xc5, 0x44, 0xa7, 0xfe, 0x01, 0xaa, 0x12, 0x3c, 0xcf, 0x12,
-  0x0f, 0xc5, 0xbf, 0xd9, 0xd3, 0xdf, 0x3a, 0xb0, 0xbd, 0xe5, 0x65, 0xe1,
-  0xa5, 0x18, 0x49, 0x5e, 0x19, 0xef, 0x72, 0x32, 0x86, 0x00, 0x1f, 0xf2,
-  0x2b, 0x31, 0xdf, 0x01, 0x24, 0x81, 0x1d, 0xfc, 0xe5, 0x08, 0x42, 0xcb,
-  0x13, 0xec, 0x8f, 0xed, 0x35, 0xc9, 0xe7, 0xee, 0xd6, 0x43, 0xd5, 0xfb,
-  0x53, 0x11, 0x1a, 0x22, 0xba, 0x99, 0xaf, 0xe2, 0xf0, 0x0b, 0x1b, 0xbf,
-  0x0f, 0x25, 0x18, 0x2c, 0xab, 0xec, 0x2d, 0x20, 0xba, 0xd3, 0x59, 0x08,
-  0x1c, 0x40, 0xc3, 0x27, 0x03, 0x6b, 0x35, 0x02, 0x05, 0xa0, 0xcb, 0x08,
-  0x2a, 0xe5, 0x23, 0x54, 0xb5, 0xc4, 0xff, 0xca, 0x60, 0x27, 0x0d, 0x22,
-  0x4d, 0x21, 0x56, 0x22, 0x21, 0xe6, 0xfa, 0x4d, 0x61, 0x3c, 0xe9, 0x10,
-  0x95, 0xf8, 0x0e, 0x0a, 0x47, 0xd8, 0xce, 0x3b, 0xeb, 0xed, 0x10, 0xa1,
-  0xb7, 0xc3, 0xf7, 0x0c, 0xf8, 0xcd, 0xdb, 0xea, 0x46, 0x9c, 0xfc, 0x81,
-  0x1a, 0xeb, 0xbd, 0xec, 0x30, 0xc6, 0x0b, 0x21, 0x5f, 0x11, 0x06, 0xdd,
-  0xec, 0xc9, 0x54, 0xee, 0x16, 0xe7, 0x46, 0x52, 0xc5, 0xf3, 0x33, 0x16,
-  0xf2, 0xe3, 0x0e, 0xdc, 0xf6, 0x5c, 0x95, 0x49, 0x33, 0x0b, 0x04, 0xd8,
-  0x60, 0xbf, 0xdb, 0x81, 0xb3, 0xb6, 0xa6, 0x0d, 0x66, 0x12, 0xf7, 0x6b,
-  0xd2, 0xa5, 0x52, 0x38, 0x0a, 0xff, 0xb6, 0x46, 0x34, 0x3f, 0x21, 0xcc,
-  0xad, 0x05, 0x47, 0xc7, 0x5c, 0xf7, 0x67, 0xe4, 0xa4, 0x9e, 0x32, 0xd1,
-  0xcb, 0xbb, 0x4a, 0xae, 0xd3, 0x10, 0x08, 0x38, 0x20, 0x3a, 0x10, 0x46,
-  0xfc, 0xf7, 0xf1, 0xf7, 0x34, 0x7f, 0xc4, 0x20, 0x24, 0x10, 0xf2, 0x3b,
-  0xea, 0x28, 0xbf, 0x0f, 0xeb, 0xf3, 0xfb, 0xe1, 0xc8, 0x00, 0xcc, 0x0b,
-  0xea, 0xe8, 0xee, 0x44, 0xdf, 0x2f, 0x1e, 0x1c, 0xca, 0xfb, 0x38, 0xdf,
-  0x20, 0xd9, 0x02, 0x36, 0x36, 0x13, 0x24, 0x2e, 0xd7, 0x3c, 0xe0, 0x02,
-  0x25, 0xc9, 0x56, 0xc6, 0x0a, 0xac, 0xe8, 0x1a, 0x36, 0x35, 0xc6, 0xec,
-  0x2b, 0xee, 0x09, 0xe9, 0x29, 0xc3, 0x56, 0xc5, 0xb4, 0xdb, 0xf1, 0xbc,
-  0xd3, 0x07, 0xde, 0xe3, 0x38, 0xdb, 0x1a, 0xd2, 0x47, 0xc9, 0xe3, 0x49,
-  0xc7, 0xbb, 0xb1, 0x7f, 0xd4, 0x74, 0xfa, 0x12, 0xe9, 0x1b, 0xd5, 0x48,
-  0xe8, 0xba, 0x45, 0x45, 0x35, 0x27, 0x20, 0xb7, 0xda, 0xb9, 0x21, 0xd8,
-  0xcb, 0xde, 0x3e, 0xb7, 0x23, 0x0f, 0x02, 0x44, 0xe4, 0x62, 0xea, 0x04,
-  0xbc, 0x24, 0xf6, 0xea, 0x3d, 0x0b, 0xc5, 0x52, 0xc2, 0xe8, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff,
-  0xe2, 0x11, 0x00, 0x00, 0x50, 0xfa, 0xff, 0xff, 0xe7, 0x04, 0x00, 0x00,
-  0xa6, 0x14, 0x00, 0x00, 0xf7, 0xfd, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff,
-  0xee, 0xf6, 0xff, 0xff, 0xc7, 0x05, 0x00, 0x00, 0xbf, 0xe4, 0xff, 0xff,
-  0xeb, 0xe2, 0xff, 0xff, 0x36, 0xee, 0xff, 0xff, 0xc6, 0x08, 0x00, 0x00,
-  0xc2, 0xee, 0xff, 0xff, 0x83, 0x12, 0x00, 0x00, 0x0c, 0xf5, 0xff, 0xff,
-  0xc3, 0x16, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0x6f, 0xf8, 0xff, 0xff,
-  0x72, 0xe2, 0xff, 0xff, 0x47, 0xe9, 0xff, 0xff, 0x62, 0xfc, 0xff, 0xff,
-  0x3e, 0x09, 0x00, 0x00, 0x46, 0x13, 0x00, 0x00, 0xee, 0x12, 0x00, 0x00,
-  0x84, 0xf5, 0xff, 0xff, 0xdf, 0x01, 0x00, 0x00, 0xab, 0x02, 0x00, 0x00,
-  0x38, 0xf8, 0xff, 0xff, 0xdf, 0xf0, 0xff, 0xff, 0x1d, 0x1d, 0x00, 0x00,
-  0xf0, 0x04, 0x00, 0x00, 0xe3, 0xf5, 0xff, 0xff, 0x76, 0xf0, 0xff, 0xff,
-  0x03, 0xf8, 0xff, 0xff, 0x85, 0xfe, 0xff, 0xff, 0xf1, 0xfa, 0xff, 0xff,
-  0x68, 0xfb, 0xff, 0xff, 0xea, 0x03, 0x00, 0x00, 0xad, 0xf3, 0xff, 0xff,
-  0xb8, 0x05, 0x00, 0x00, 0x4f, 0xf2, 0xff, 0xff, 0x5d, 0xf2, 0xff, 0xff,
-  0x44, 0xfd, 0xff, 0xff, 0x93, 0x03, 0x00, 0x00, 0x9a, 0xf5, 0xff, 0xff,
-  0xd7, 0xde, 0xff, 0xff, 0x5b, 0x0a, 0x00, 0x00, 0xcd, 0xf8, 0xff, 0xff,
-  0x4d, 0xdb, 0xff, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0xa7, 0xe8, 0xff, 0xff,
-  0x54, 0xf9, 0xff, 0xff, 0x31, 0xfb, 0xff, 0xff, 0xa0, 0x0b, 0x00, 0x00,
-  0x30, 0xf3, 0xff, 0xff, 0x48, 0xfa, 0xff, 0xff, 0x81, 0xfc, 0xff, 0xff,
-  0x32, 0x0f, 0x00, 0x00, 0x25, 0xfa, 0xff, 0xff, 0x84, 0xfd, 0xff, 0xff,
-  0x72, 0x00, 0x00, 0x00, 0xaf, 0xfb, 0xff, 0xff, 0xb4, 0x02, 0x00, 0x00,
-  0xce, 0xe9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0x4c, 0x24, 0x7f, 0xdb, 0xb8, 0x81, 0x50, 0xa4, 0xe7, 0xd3, 0x81, 0x81,
-  0x4e, 0xa4, 0x83, 0x85, 0x0b, 0x7f, 0x87, 0x81, 0x8d, 0x81, 0x26, 0xe9,
-  0xe8, 0x7f, 0x8e, 0x2b, 0xc4, 0x81, 0x5d, 0x57, 0xb8, 0x91, 0xd0, 0x81,
-  0x7f, 0xc8, 0x81, 0x74, 0xf6, 0xd8, 0xe6, 0x81, 0x62, 0x7f, 0xf3, 0x49,
-  0x81, 0xec, 0x51, 0x0a, 0x48, 0x7f, 0xc0, 0x81, 0xec, 0x5c, 0x7f, 0x6b,
-  0x29, 0xd3, 0x90, 0xeb, 0x17, 0xd8, 0x6c, 0x0d, 0x81, 0xf1, 0x69, 0x81,
-  0x81, 0xb6, 0xf5, 0xe5, 0x4b, 0x81, 0x81, 0x0f, 0xe4, 0x21, 0xd4, 0xda,
-  0xf7, 0xff, 0x49, 0x92, 0x16, 0x46, 0xe6, 0xeb, 0xc0, 0xc5, 0x06, 0x5b,
-  0xbb, 0xfe, 0x10, 0x1b, 0x27, 0x81, 0x99, 0x7f, 0x44, 0xcb, 0x84, 0xf7,
-  0x57, 0x64, 0xe8, 0xc2, 0x9e, 0xec, 0x71, 0xc9, 0x7f, 0x6a, 0xd5, 0xb2,
-  0x83, 0x50, 0x78, 0x6d, 0x0f, 0x81, 0xd2, 0xe7, 0xb2, 0x2b, 0x6f, 0x06,
-  0x8f, 0xa1, 0x7f, 0x09, 0x8b, 0xba, 0x9a, 0x33, 0x03, 0xac, 0x90, 0x9a,
-  0x10, 0x21, 0x8c, 0x07, 0xf0, 0x11, 0x38, 0x81, 0x2c, 0x52, 0x81, 0x48,
-  0xc7, 0xa1, 0x51, 0x7f, 0xd1, 0xf9, 0x03, 0x5c, 0x47, 0x9e, 0xcb, 0x45,
-  0x1d, 0x9f, 0xb7, 0x5c, 0x7f, 0x6f, 0x17, 0x81, 0x03, 0x10, 0x66, 0x12,
-  0x72, 0x6e, 0xd1, 0xb2, 0xc6, 0x52, 0x7d, 0x7f, 0x7f, 0x8b, 0xf1, 0x18,
-  0x81, 0xa6, 0x0c, 0xc4, 0xdb, 0xf5, 0x2d, 0x26, 0xa0, 0xfb, 0x9c, 0xf5,
-  0x33, 0xd1, 0xb1, 0x6e, 0xea, 0x41, 0xc0, 0xb9, 0x81, 0x19, 0x5b, 0xd4,
-  0x10, 0x2b, 0xaa, 0x87, 0x81, 0xa0, 0x2e, 0xfb, 0x8f, 0xd6, 0xdf, 0xbd,
-  0x62, 0xb0, 0x2b, 0x05, 0x2f, 0xd1, 0xce, 0xb5, 0x48, 0x57, 0xf0, 0x2f,
-  0xf7, 0x81, 0x22, 0xe8, 0x18, 0x43, 0x81, 0xd8, 0x81, 0x23, 0x4d, 0x71,
-  0xf2, 0xea, 0x94, 0x10, 0x96, 0x8b, 0x11, 0x81, 0xbb, 0xb9, 0x34, 0x1d,
-  0xf2, 0x81, 0x0b, 0xb8, 0x2f, 0xfa, 0xa7, 0x36, 0xcd, 0x5b, 0x03, 0xd6,
-  0xb2, 0xb5, 0x4e, 0xc5, 0xe1, 0x19, 0x99, 0x81, 0xdc, 0x3f, 0x7f, 0x1f,
-  0xf9, 0xdc, 0x1a, 0x2a, 0x3c, 0x28, 0xe3, 0x2b, 0x4c, 0x81, 0x3d, 0x2e,
-  0x4e, 0x26, 0xba, 0x24, 0x21, 0x17, 0x64, 0x06, 0x1e, 0x32, 0xa5, 0x08,
-  0xf8, 0x13, 0x39, 0x64, 0x12, 0xb3, 0xd6, 0x0f, 0xa3, 0x81, 0x11, 0x8e,
-  0xcc, 0x16, 0x33, 0xb4, 0xe4, 0xdb, 0xb0, 0x95, 0x36, 0x2e, 0xd6, 0x2f,
-  0x95, 0x7e, 0xb0, 0x13, 0x0b, 0x52, 0x6f, 0xd1, 0x81, 0x26, 0xa4, 0x87,
-  0xe0, 0xbf, 0x39, 0xff, 0xa9, 0xf8, 0xf7, 0x03, 0x33, 0xe2, 0xf6, 0x23,
-  0x6d, 0xc0, 0xca, 0x0b, 0x3e, 0x41, 0x81, 0x5c, 0xc4, 0xe6, 0x10, 0xed,
-  0x14, 0x45, 0xcb, 0x1c, 0xae, 0x20, 0x29, 0x5e, 0x60, 0xee, 0x83, 0xc7,
-  0x46, 0x8a, 0x53, 0xcf, 0xfa, 0xbf, 0x6e, 0x36, 0xd5, 0x02, 0xe6, 0xce,
-  0x4d, 0x82, 0xb4, 0x81, 0x8b, 0x19, 0xaf, 0xed, 0xb5, 0xcb, 0x4c, 0x94,
-  0x0c, 0x6e, 0x04, 0x1b, 0xc6, 0x8a, 0xeb, 0xff, 0x81, 0xdb, 0x81, 0xd3,
-  0x4d, 0xe8, 0x10, 0x33, 0x3e, 0xa8, 0x8c, 0xaa, 0x6a, 0x7a, 0xe8, 0x06,
-  0x07, 0x92, 0x62, 0xfa, 0x24, 0x54, 0xde, 0x24, 0x86, 0x7c, 0x36, 0x65,
-  0x61, 0x04, 0x97, 0xab, 0xa7, 0xf4, 0x49, 0xb8, 0xb7, 0x21, 0x3c, 0x28,
-  0xd6, 0xdd, 0xea, 0x0c, 0x5b, 0xb7, 0xcd, 0x94, 0x81, 0x55, 0xbb, 0xaf,
-  0xeb, 0x3d, 0x7f, 0xa6, 0xf2, 0x3f, 0xea, 0x12, 0xfc, 0xb7, 0x61, 0xee,
-  0x2d, 0xf4, 0xd0, 0xcc, 0x4c, 0xa2, 0x21, 0x4c, 0x68, 0x07, 0x81, 0x13,
-  0x41, 0x5c, 0xa1, 0x40, 0xf5, 0xe5, 0x0a, 0xd3, 0x39, 0x4f, 0xc1, 0x35,
-  0xd9, 0x66, 0x69, 0x4e, 0x29, 0x09, 0xbb, 0x0a, 0x84, 0xaa, 0x60, 0xaa,
-  0xf2, 0xc3, 0x40, 0xaa, 0xe2, 0xc9, 0xea, 0x19, 0x7f, 0xa8, 0xf7, 0x00,
-  0xb0, 0x7d, 0x81, 0xc0, 0xf5, 0xd6, 0x65, 0xbd, 0x3e, 0x5c, 0xd0, 0xd6,
-  0x01, 0xdb, 0x4a, 0xc8, 0xd8, 0x81, 0xec, 0x5a, 0x53, 0xa5, 0xf0, 0x3a,
-  0x7f, 0xa5, 0xc7, 0x55, 0x66, 0x62, 0xed, 0x1e, 0xf0, 0x05, 0x7f, 0x81,
-  0x1f, 0x61, 0xf0, 0x2c, 0x99, 0x7f, 0x45, 0x40, 0x01, 0xfd, 0x81, 0x81,
-  0x1a, 0xec, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x22, 0x0e, 0x00, 0x00, 0x0c, 0x14, 0x00, 0x00, 0xe9, 0xec, 0xff, 0xff,
-  0xb5, 0x16, 0x00, 0x00, 0xb8, 0x12, 0x00, 0x00, 0xe6, 0x0e, 0x00, 0x00,
-  0xa2, 0xed, 0xff, 0xff, 0xef, 0x00, 0x00, 0x00, 0xf2, 0x15, 0x00, 0x00,
-  0x57, 0x12, 0x00, 0x00, 0x25, 0x18, 0x00, 0x00, 0x31, 0x07, 0x00, 0x00,
-  0xf9, 0xed, 0xff, 0xff, 0xf1, 0x1e, 0x00, 0x00, 0xf8, 0x20, 0x00, 0x00,
-  0xa2, 0x03, 0x00, 0x00, 0x62, 0x0b, 0x00, 0x00, 0xce, 0xe2, 0xff, 0xff,
-  0x5e, 0x19, 0x00, 0x00, 0xfa, 0x10, 0x00, 0x00, 0x11, 0x0e, 0x00, 0x00,
-  0xcd, 0x02, 0x00, 0x00, 0xcc, 0xe7, 0xff, 0xff, 0x43, 0x1d, 0x00, 0x00,
-  0x1c, 0xff, 0xff, 0xff, 0xda, 0xfb, 0xff, 0xff, 0xe7, 0x14, 0x00, 0x00,
-  0x4c, 0x04, 0x00, 0x00, 0x89, 0x14, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
-  0x13, 0xe8, 0xff, 0xff, 0xe0, 0xf6, 0xff, 0xff, 0xde, 0x0e, 0x00, 0x00,
-  0x88, 0x0a, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff,
-  0x48, 0xee, 0xff, 0xff, 0x97, 0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x42, 0xf3, 0xff, 0xff, 0x22, 0xe6, 0xff, 0xff, 0xd5, 0x10, 0x00, 0x00,
-  0x4c, 0x16, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x91, 0xef, 0xff, 0xff,
-  0x03, 0xf4, 0xff, 0xff, 0x74, 0x07, 0x00, 0x00, 0x1b, 0xf9, 0xff, 0xff,
-  0x78, 0x08, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x6f, 0xe9, 0xff, 0xff,
-  0xa0, 0x05, 0x00, 0x00, 0x2b, 0xfb, 0xff, 0xff, 0x6f, 0xfc, 0xff, 0xff,
-  0x27, 0x19, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0xb5, 0x18, 0x00, 0x00,
-  0x8f, 0xfa, 0xff, 0xff, 0x20, 0xe9, 0xff, 0xff, 0x30, 0xf2, 0xff, 0xff,
-  0xa6, 0xf2, 0xff, 0xff, 0x26, 0x0a, 0x00, 0x00, 0xa8, 0x19, 0x00, 0x00,
-  0xfa, 0x03, 0x00, 0x00, 0x26, 0xed, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0xf2, 0xe3, 0xc9, 0x0e, 0xaa, 0x16, 0x07, 0x34,
-  0xaf, 0x4e, 0x65, 0xbc, 0x08, 0x30, 0xb0, 0x26, 0x0f, 0x2e, 0xcf, 0x42,
-  0xcc, 0xee, 0xde, 0xf2, 0x44, 0xca, 0xcf, 0x03, 0x59, 0x1d, 0x42, 0xc5,
-  0xb4, 0xb4, 0xbc, 0xb6, 0xc7, 0x15, 0x0e, 0x0f, 0x20, 0x4f, 0x02, 0xe2,
-  0x43, 0xf7, 0xff, 0xe6, 0xdc, 0xc6, 0xc3, 0xfe, 0x32, 0x20, 0x81, 0xed,
-  0xe0, 0xdb, 0x2b, 0xb8, 0x38, 0x18, 0xc3, 0x23, 0x4a, 0x01, 0xfd, 0x27,
-  0x62, 0x1a, 0xed, 0x26, 0xe8, 0x37, 0xda, 0x7f, 0xb8, 0x84, 0x53, 0x38,
-  0x13, 0x24, 0xd9, 0x3b, 0xc6, 0x15, 0x01, 0x4a, 0x14, 0xe8, 0xbb, 0x53,
-  0xcf, 0xb1, 0xce, 0x58, 0xc3, 0xfc, 0xe7, 0x27, 0x3a, 0x2d, 0xc8, 0xf4,
-  0xfa, 0x30, 0xe1, 0x0f, 0x39, 0x43, 0xaf, 0x44, 0x53, 0x40, 0xa1, 0xd8,
-  0x3a, 0x01, 0x79, 0x4f, 0x08, 0xee, 0x12, 0x69, 0x3d, 0x34, 0x34, 0x05,
-  0x25, 0xc5, 0xed, 0xab, 0xf6, 0x63, 0xee, 0xf3, 0xfa, 0x62, 0x2a, 0x12,
-  0x02, 0x79, 0xb2, 0xcb, 0xfe, 0x06, 0xeb, 0x62, 0x46, 0xff, 0x37, 0xe4,
-  0x12, 0x09, 0x06, 0xeb, 0x58, 0x6f, 0x4f, 0xdb, 0xcf, 0xfd, 0x0e, 0xdf,
-  0xe2, 0x7f, 0xe8, 0xe9, 0xc9, 0x00, 0x4f, 0xe4, 0x0c, 0xfd, 0x42, 0xf0,
-  0x25, 0xcc, 0xed, 0xdf, 0x0f, 0x08, 0xf8, 0xf0, 0xca, 0x0f, 0x1b, 0xdf,
-  0xf7, 0x9c, 0xab, 0xe4, 0x50, 0x30, 0x6d, 0x5e, 0xfc, 0xd1, 0x32, 0xdd,
-  0x4e, 0x81, 0x86, 0x67, 0x70, 0x38, 0x1a, 0x39, 0xed, 0x5e, 0x20, 0xd9,
-  0xfb, 0x07, 0xbb, 0x64, 0x53, 0x9a, 0x28, 0xdf, 0xf0, 0xc4, 0x0f, 0x4e,
-  0xb9, 0x2f, 0xc6, 0xf7, 0x44, 0x0d, 0x55, 0xde, 0xe2, 0x3a, 0x32, 0xc6,
-  0x58, 0xfa, 0x9d, 0xe9, 0x65, 0xad, 0xcc, 0x27, 0x39, 0xc2, 0x56, 0x0a,
-  0x4f, 0xe4, 0xf2, 0x12, 0xdb, 0x47, 0x1b, 0xf9, 0xd9, 0xb9, 0xf3, 0x1f,
-  0x2e, 0xb7, 0xe7, 0xdd, 0x54, 0xc5, 0x3f, 0xef, 0xe2, 0xff, 0xed, 0x0f,
-  0x28, 0xd0, 0x42, 0x26, 0x48, 0xe4, 0x3a, 0xe8, 0xf4, 0x55, 0xdb, 0x20,
-  0xfd, 0xc2, 0xc9, 0xe7, 0x03, 0x4f, 0xcb, 0xea, 0xf8, 0xd7, 0x0c, 0x41,
-  0x12, 0x2e, 0xd5, 0x3f, 0xe8, 0x61, 0x2f, 0x20, 0x02, 0xeb, 0xec, 0xec,
-  0x32, 0x7f, 0x2b, 0x00, 0xe0, 0x3f, 0x1b, 0x54, 0xca, 0xf3, 0x4b, 0x11,
-  0xef, 0xbb, 0x0e, 0x42, 0x21, 0x0d, 0xe4, 0xf3, 0x67, 0x43, 0xc1, 0x46,
-  0xe4, 0x81, 0xc9, 0x33, 0xf8, 0x1b, 0xec, 0x10, 0x59, 0xec, 0x16, 0xf1,
-  0x1b, 0x63, 0xfa, 0xe6, 0x20, 0xd2, 0xc5, 0xdc, 0xf4, 0x25, 0x00, 0xdf,
-  0xc0, 0x0a, 0xfe, 0x39, 0xe8, 0x16, 0xd6, 0x3e, 0xbb, 0x5f, 0x44, 0x11,
-  0xfb, 0x46, 0x05, 0x0c, 0x6d, 0x76, 0x12, 0x31, 0x05, 0x3f, 0x19, 0x5f,
-  0xcf, 0x16, 0x58, 0x15, 0x16, 0xdd, 0x3a, 0x1e, 0x2a, 0x22, 0xba, 0x13,
-  0x45, 0xd9, 0x5b, 0xd3, 0xf4, 0xd0, 0xf6, 0xdd, 0xf9, 0xf1, 0xf9, 0x38,
-  0xe2, 0xe9, 0x25, 0xd6, 0x4e, 0x2a, 0x1d, 0xd4, 0xdc, 0x49, 0x13, 0xff,
-  0x06, 0x43, 0xd1, 0x09, 0xbe, 0xde, 0xe6, 0x55, 0xe1, 0xcc, 0xdc, 0x41,
-  0xe5, 0x56, 0xf4, 0xdd, 0xf7, 0x18, 0xfd, 0x02, 0x29, 0x7f, 0x09, 0x19,
-  0xd7, 0x4b, 0xf8, 0x3a, 0xe9, 0xe2, 0xe9, 0x23, 0x12, 0xe7, 0x0c, 0x26,
-  0x28, 0x27, 0xd9, 0xe9, 0x57, 0xdd, 0xe1, 0x41, 0xc2, 0xc7, 0xd1, 0x47,
-  0x19, 0xe2, 0x58, 0xf5, 0xf3, 0xf6, 0x0c, 0x06, 0xe5, 0x68, 0x04, 0x10,
-  0x99, 0xbc, 0xd8, 0xf0, 0x44, 0x1d, 0xdf, 0xec, 0xec, 0x3e, 0x1e, 0x2a,
-  0xcf, 0x55, 0xb2, 0x3c, 0xdd, 0x67, 0x51, 0x09, 0x1d, 0x2a, 0xe0, 0x37,
-  0x45, 0x5e, 0x11, 0xea, 0x1d, 0x57, 0x1f, 0x7c, 0xd9, 0xc7, 0x7f, 0xb8,
-  0x09, 0xfe, 0x12, 0x42, 0x39, 0xf7, 0xe8, 0xfa, 0x3e, 0xe6, 0xec, 0x3c,
-  0xdd, 0x21, 0x3b, 0x17, 0xe9, 0x06, 0x78, 0x1a, 0x4b, 0xed, 0x0b, 0xda,
-  0xf4, 0x2d, 0xaa, 0x2c, 0x9d, 0xa9, 0xdc, 0xfd, 0xf0, 0x4e, 0x18, 0xe8,
-  0xb6, 0xe6, 0xfa, 0x2e, 0xef, 0xed, 0xb6, 0x44, 0xe2, 0x53, 0x15, 0x08,
-  0x13, 0xe4, 0xe4, 0x51, 0x54, 0x66, 0xfc, 0x2a, 0xc0, 0x4f, 0x0d, 0x7f,
-  0xcc, 0x17, 0x2c, 0x00, 0xef, 0xcb, 0x56, 0x4d, 0x00, 0x1c, 0x2d, 0x2b,
-  0x4d, 0x9b, 0x1b, 0x0c, 0x0e, 0x81, 0x02, 0x5f, 0xe2, 0x2e, 0x15, 0x06,
-  0xd6, 0x1c, 0xe0, 0x4d, 0x1b, 0xba, 0x1b, 0x3b, 0xf7, 0xd6, 0xf0, 0x48,
-  0xb3, 0xfe, 0xc7, 0x2b, 0x3a, 0xd5, 0x45, 0xd2, 0x2e, 0xe9, 0x2c, 0x04,
-  0x24, 0xe6, 0xf3, 0xdd, 0x34, 0xf0, 0xe0, 0x4a, 0x28, 0xd4, 0x5a, 0x47,
-  0xf4, 0xe2, 0xee, 0xed, 0x07, 0x0a, 0x07, 0x22, 0x1c, 0xd4, 0x2a, 0x59,
-  0x31, 0x60, 0x1b, 0x03, 0x34, 0x2b, 0x81, 0xe9, 0xe2, 0x9c, 0x53, 0x06,
-  0x06, 0xe7, 0x48, 0x14, 0x16, 0x1d, 0xbf, 0x34, 0x11, 0xd6, 0xc4, 0x5f,
-  0x86, 0x25, 0xf8, 0x17, 0xd0, 0x30, 0xc0, 0x01, 0x2d, 0x65, 0x0c, 0xdb,
-  0xce, 0xb1, 0xc8, 0x22, 0x58, 0xf7, 0xf8, 0xe5, 0x08, 0x06, 0x12, 0x17,
-  0x4f, 0xee, 0x38, 0x3c, 0xb7, 0xce, 0xed, 0x43, 0x0c, 0x3b, 0x03, 0xe8,
-  0x37, 0xde, 0xeb, 0x43, 0x50, 0x2a, 0xdf, 0x09, 0x37, 0x22, 0xaa, 0x18,
-  0xda, 0xc8, 0xfc, 0x5b, 0xb7, 0xf9, 0xf5, 0x0d, 0x0f, 0x10, 0xe0, 0x1a,
-  0xf9, 0x1b, 0xe2, 0x0e, 0xda, 0xa7, 0x01, 0x0c, 0xe7, 0xfb, 0x0d, 0x08,
-  0x05, 0x45, 0xff, 0x1e, 0xef, 0xf4, 0xe2, 0x2c, 0x15, 0x15, 0x19, 0xfb,
-  0x28, 0xc7, 0x0d, 0x01, 0x4f, 0x26, 0x1a, 0x37, 0xc0, 0x0c, 0xe7, 0x7f,
-  0xe7, 0x2c, 0x03, 0x11, 0x40, 0x24, 0x5b, 0x46, 0x06, 0x30, 0x44, 0x36,
-  0x19, 0x90, 0xec, 0xf1, 0x48, 0xc0, 0x7f, 0xe9, 0xb8, 0x20, 0x9a, 0x10,
-  0x2f, 0x22, 0xc8, 0x48, 0xd6, 0x93, 0xf1, 0x4d, 0x0f, 0x03, 0x2d, 0x41,
-  0xb2, 0xcf, 0xf6, 0x39, 0x19, 0x40, 0x08, 0xd7, 0xd9, 0x2b, 0xef, 0xfb,
-  0x5c, 0xec, 0xfc, 0xe2, 0x42, 0xe2, 0xe1, 0x44, 0x29, 0xdd, 0x07, 0x52,
-  0xc0, 0xe5, 0xe1, 0xd8, 0x08, 0x16, 0xaf, 0xa8, 0x11, 0xdf, 0x04, 0x46,
-  0xf3, 0xde, 0x47, 0x42, 0xfc, 0x9a, 0xaf, 0x1b, 0x2f, 0x81, 0xec, 0x5d,
-  0x46, 0x41, 0x09, 0xc2, 0xff, 0x48, 0xd3, 0x57, 0x49, 0xcf, 0xee, 0x20,
-  0xdc, 0x1f, 0x46, 0x35, 0xff, 0x0b, 0x16, 0x1c, 0x7a, 0xd3, 0xf6, 0xce,
-  0x1d, 0xda, 0xb7, 0xe9, 0x4d, 0xe6, 0xcf, 0xd0, 0x08, 0xf1, 0xd3, 0x1f,
-  0xf6, 0xd3, 0x5b, 0x08, 0x46, 0xc6, 0xea, 0x19, 0x2d, 0xfe, 0xa8, 0xd2,
-  0x2d, 0xed, 0x0f, 0xeb, 0xb2, 0x3e, 0x07, 0x22, 0xba, 0x13, 0x32, 0x18,
-  0xe8, 0x0c, 0xd1, 0x44, 0xe1, 0xcd, 0xe7, 0x69, 0xe0, 0xbf, 0xdc, 0xeb,
-  0xf7, 0xf9, 0xeb, 0x39, 0x7f, 0xf5, 0x44, 0xa1, 0xd6, 0xde, 0xb9, 0xa9,
-  0xe9, 0x3c, 0x2e, 0xfb, 0xa9, 0x63, 0x44, 0xee, 0xec, 0xf1, 0xef, 0x44,
-  0x09, 0xad, 0xdc, 0x40, 0xf5, 0x1c, 0xe3, 0xc1, 0xe3, 0x0a, 0x4a, 0xe2,
-  0xd7, 0xfb, 0x1c, 0xed, 0xf1, 0x09, 0xf8, 0x1e, 0xe8, 0xe5, 0xe5, 0xf8,
-  0xe8, 0xff, 0xdf, 0x4c, 0xe2, 0xc6, 0xd9, 0xf0, 0x19, 0xe6, 0x0c, 0xe2,
-  0xdb, 0xeb, 0x3f, 0xd3, 0x1b, 0x46, 0xf9, 0xe7, 0x28, 0xc4, 0xdf, 0xf7,
-  0xe4, 0x2e, 0xcf, 0xf7, 0xf5, 0x36, 0xe6, 0x40, 0xcb, 0x09, 0xd7, 0x3c,
-  0xd9, 0x35, 0x04, 0x06, 0x1c, 0xea, 0xe3, 0x33, 0x30, 0x7f, 0x43, 0xfe,
-  0x03, 0x47, 0x2a, 0x36, 0xf2, 0xd7, 0x20, 0x30, 0x6b, 0x53, 0x6d, 0xed,
-  0xe6, 0xc8, 0x7f, 0x2c, 0x5b, 0xc1, 0x0c, 0x49, 0x7a, 0x09, 0x53, 0x12,
-  0xc8, 0xc5, 0xc9, 0x3d, 0x22, 0x63, 0xe6, 0x73, 0xa0, 0xa3, 0xbd, 0x0b,
-  0xc2, 0xcd, 0x49, 0x4a, 0xa9, 0xea, 0xbe, 0x43, 0x64, 0xf8, 0x4c, 0xc1,
-  0x31, 0xd1, 0x20, 0xe9, 0x27, 0xad, 0x05, 0xf6, 0x04, 0xf8, 0x18, 0xf7,
-  0x38, 0xa4, 0x66, 0x37, 0xdb, 0xd7, 0xf5, 0x13, 0xd2, 0x14, 0xf6, 0x32,
-  0xe5, 0x97, 0xe1, 0x1e, 0xb1, 0xe9, 0xb1, 0x1c, 0x99, 0x18, 0x7f, 0xb1,
-  0x07, 0x25, 0xeb, 0xca, 0x18, 0x0a, 0x2e, 0x36, 0x19, 0xc3, 0x10, 0xd6,
-  0x68, 0xe3, 0x0b, 0x2b, 0x26, 0x6e, 0xca, 0xc6, 0x12, 0xcf, 0x30, 0xb5,
-  0xc7, 0x68, 0x9a, 0xf1, 0xee, 0xe5, 0x6d, 0x0a, 0xfe, 0xf5, 0x45, 0x21,
-  0x23, 0x2c, 0x57, 0xb0, 0x02, 0x01, 0xa4, 0x18, 0x2d, 0xfe, 0x16, 0xf5,
-  0x2c, 0xd2, 0xb8, 0xca, 0x49, 0xd5, 0x1e, 0xf4, 0x30, 0xfd, 0x26, 0x23,
-  0x2f, 0xe1, 0xaa, 0xfe, 0x0e, 0x21, 0x25, 0xe6, 0xb9, 0x17, 0xce, 0xcf,
-  0x09, 0x15, 0xd0, 0x60, 0x2a, 0xdc, 0xe9, 0x3a, 0x8d, 0xc9, 0xe9, 0x0b,
-  0x38, 0xb1, 0x3d, 0x1f, 0x42, 0xcd, 0x26, 0xd0, 0x29, 0x20, 0x0d, 0xef,
-  0x7f, 0xe6, 0xf6, 0xdb, 0x5f, 0x39, 0xf0, 0x4a, 0x4c, 0xb6, 0x2f, 0x2f,
-  0xef, 0xc1, 0xf1, 0xfa, 0xfe, 0xce, 0xfb, 0x02, 0x1d, 0xd8, 0xdb, 0x28,
-  0x4b, 0x06, 0xde, 0xe1, 0x28, 0xe6, 0x2c, 0x20, 0xef, 0xca, 0xd8, 0x00,
-  0x14, 0xe9, 0x7f, 0x0c, 0x0e, 0xeb, 0x18, 0xfe, 0xf1, 0x59, 0xdf, 0xf4,
-  0xc4, 0x9d, 0xe7, 0xf7, 0x40, 0x29, 0x1e, 0xed, 0xfc, 0x13, 0xf0, 0x48,
-  0xde, 0xb1, 0xb4, 0x35, 0xec, 0x61, 0x5a, 0x0d, 0x21, 0x4a, 0xf5, 0x61,
-  0x27, 0x73, 0x02, 0x1a, 0xcc, 0x4d, 0x18, 0x66, 0xc8, 0xcb, 0x4c, 0x0e,
-  0x5d, 0xdd, 0x2f, 0xed, 0xe7, 0x5f, 0x2f, 0xf8, 0x18, 0x36, 0xbb, 0x32,
-  0x62, 0x13, 0x6b, 0x3e, 0xf9, 0xef, 0xf8, 0xf0, 0xf2, 0x49, 0xd6, 0x01,
-  0xd3, 0xc3, 0x0e, 0x37, 0xde, 0xbc, 0x0e, 0x72, 0x9f, 0x2c, 0xf1, 0x2f,
-  0x2f, 0xc6, 0xf3, 0xcf, 0x0b, 0xa6, 0xbc, 0x02, 0x7f, 0xd1, 0xb8, 0xff,
-  0x65, 0xde, 0xe4, 0x02, 0xf4, 0xef, 0x5c, 0x5f, 0xf3, 0xa5, 0xe9, 0xc2,
-  0x33, 0x4a, 0xd6, 0x23, 0x2e, 0x3a, 0xfd, 0xdd, 0xa9, 0xde, 0x7f, 0x1b,
-  0xc9, 0x37, 0xe5, 0x2b, 0x72, 0xb6, 0xcc, 0xe0, 0x33, 0xf5, 0xb5, 0xed,
-  0xc0, 0x18, 0xea, 0x44, 0x38, 0xa8, 0x68, 0x24, 0x2d, 0xe4, 0x4c, 0x1e,
-  0x33, 0x29, 0x23, 0x34, 0x65, 0xb8, 0xf8, 0xd1, 0x2f, 0x2a, 0xc1, 0x15,
-  0x33, 0xd0, 0x4c, 0x32, 0x2f, 0x44, 0xfa, 0x55, 0x58, 0xb0, 0x5a, 0x1e,
-  0xee, 0xed, 0x14, 0xbc, 0x1b, 0xd3, 0xde, 0xde, 0x34, 0x04, 0x01, 0x29,
-  0xd7, 0x45, 0x53, 0x37, 0x43, 0x83, 0xbf, 0x08, 0x5c, 0xe7, 0xf1, 0xe3,
-  0x49, 0x08, 0x96, 0xf6, 0x59, 0x26, 0xd8, 0x7f, 0x12, 0xbd, 0xd8, 0x5c,
-  0x03, 0x1c, 0x28, 0x24, 0x9e, 0xf6, 0xd3, 0x20, 0x5e, 0xb8, 0xe6, 0xe5,
-  0x19, 0xde, 0x36, 0xd5, 0x47, 0xc8, 0xd3, 0x06, 0x0a, 0x0d, 0xed, 0x40,
-  0x13, 0xd3, 0x33, 0x27, 0xee, 0xe3, 0xfc, 0x3a, 0x14, 0x3a, 0xaa, 0xe5,
-  0x39, 0x35, 0xee, 0x4d, 0xf1, 0xbf, 0x7f, 0x4d, 0xe9, 0x2e, 0x12, 0xd6,
-  0x7b, 0xa8, 0x0d, 0x57, 0xf6, 0x5a, 0x45, 0x00, 0x4a, 0x55, 0xfa, 0x57,
-  0xb0, 0xee, 0x4b, 0xf8, 0xaa, 0xac, 0x11, 0x2b, 0xdc, 0xb6, 0x45, 0x50,
-  0x56, 0xaf, 0x07, 0xe0, 0x3c, 0x1e, 0x21, 0x08, 0x16, 0xe5, 0x27, 0xc9,
-  0x54, 0x04, 0xd7, 0xd7, 0x10, 0xba, 0xfb, 0xfd, 0xa9, 0xa6, 0xd2, 0xa3,
-  0x53, 0x49, 0x13, 0x3f, 0x2f, 0xf5, 0x1e, 0x03, 0x1a, 0x1d, 0x7f, 0x10,
-  0xff, 0x03, 0xfa, 0xfa, 0x4a, 0xbc, 0x67, 0xef, 0xe9, 0xde, 0x2d, 0x36,
-  0x1a, 0x32, 0xe2, 0x66, 0xd3, 0x81, 0xd3, 0x02, 0xeb, 0xcd, 0xc9, 0x26,
-  0xa2, 0x1b, 0x21, 0x21, 0x39, 0x40, 0xea, 0xb3, 0x37, 0xef, 0xb1, 0xf5,
-  0x6a, 0xce, 0xf1, 0xfb, 0xe6, 0xc6, 0xef, 0xdf, 0x4d, 0x05, 0x5c, 0x6b,
-  0xb2, 0xce, 0xdc, 0xdc, 0x1a, 0xf9, 0xa6, 0xdd, 0x37, 0x1c, 0x62, 0x1b,
-  0x19, 0x5a, 0x7a, 0x0e, 0xc1, 0xfc, 0xc0, 0xf7, 0x7a, 0xf7, 0x6b, 0xdc,
-  0x2e, 0x5e, 0xb8, 0xfe, 0xe7, 0x45, 0xda, 0xdc, 0x2e, 0xb9, 0x1a, 0xb4,
-  0x3d, 0xe5, 0xe4, 0x14, 0xc8, 0xc1, 0xbb, 0x47, 0x45, 0x5a, 0x7f, 0xb5,
-  0x54, 0xfe, 0x54, 0x11, 0x0c, 0x03, 0xdf, 0xcc, 0x52, 0x32, 0x11, 0x1c,
-  0x31, 0x9a, 0x5f, 0x2f, 0xdb, 0xdd, 0x10, 0xb5, 0xfe, 0xe5, 0xb3, 0xb9,
-  0x06, 0xe8, 0xda, 0x17, 0x1e, 0xb7, 0xe8, 0xd4, 0x64, 0xb7, 0x61, 0x64,
-  0xd6, 0xe7, 0x9f, 0x24, 0xdd, 0xfb, 0x56, 0xf4, 0x23, 0xe9, 0x25, 0xca,
-  0xd4, 0x7c, 0xbb, 0x1c, 0xd0, 0xbb, 0x03, 0xdb, 0x12, 0xdf, 0xef, 0xf7,
-  0xc9, 0xd3, 0xfc, 0x5a, 0xe8, 0xcb, 0x81, 0x50, 0xd3, 0x4a, 0xf7, 0xee,
-  0x3f, 0xc8, 0xcf, 0x5b, 0x67, 0x68, 0x19, 0xd8, 0xad, 0x6e, 0x0b, 0x69,
-  0xf2, 0xed, 0xfc, 0x01, 0xfb, 0xaf, 0x06, 0x9e, 0x11, 0x35, 0xea, 0xf0,
-  0xb3, 0xf1, 0x54, 0x03, 0xc8, 0x22, 0xa8, 0xcb, 0x12, 0xad, 0xf5, 0xbf,
-  0xbb, 0xef, 0x3a, 0x09, 0x55, 0x6f, 0x7f, 0xd3, 0xfb, 0x33, 0xa5, 0xe6,
-  0x31, 0x3c, 0xad, 0xfd, 0xf6, 0xdc, 0xdf, 0x30, 0xb3, 0xa4, 0xda, 0x5b,
-  0xe0, 0x5d, 0xf2, 0x29, 0x0c, 0x34, 0x02, 0x4d, 0x41, 0x71, 0x2a, 0xeb,
-  0x2d, 0x4e, 0x64, 0xf6, 0xcb, 0x26, 0x89, 0xf5, 0xef, 0xc5, 0x2e, 0x5f,
-  0xd4, 0x0f, 0x7f, 0x27, 0x37, 0xcd, 0xb7, 0x5c, 0xea, 0x91, 0x78, 0x6c,
-  0xb2, 0x65, 0x20, 0x48, 0x3b, 0x08, 0xc2, 0x51, 0xfb, 0x8d, 0xf2, 0xf0,
-  0x8f, 0xd3, 0xe0, 0x21, 0xb3, 0xc7, 0x10, 0x1b, 0x66, 0x9c, 0x53, 0xa2,
-  0xd2, 0x19, 0x3f, 0x0b, 0x14, 0xf1, 0x04, 0xba, 0x2f, 0x05, 0xbc, 0xd1,
-  0x59, 0xc1, 0x07, 0xe7, 0xd3, 0xf5, 0x18, 0xd2, 0x25, 0x31, 0x15, 0x16,
-  0xf2, 0x45, 0x08, 0x39, 0x32, 0x0e, 0x19, 0xf8, 0x4d, 0xad, 0xda, 0x20,
-  0x35, 0xeb, 0x6d, 0x7f, 0x2c, 0x1a, 0xc2, 0x2b, 0x60, 0x32, 0xe1, 0x43,
-  0xc8, 0xf9, 0xfb, 0x08, 0xa6, 0xbb, 0x0f, 0x57, 0xdd, 0x1d, 0x08, 0x42,
-  0x4c, 0x09, 0x3c, 0xb3, 0x2a, 0xf6, 0x33, 0xdb, 0x6e, 0xf5, 0xce, 0x16,
-  0x62, 0x13, 0xca, 0xef, 0x4e, 0xbc, 0xf6, 0x4b, 0x10, 0x99, 0xf0, 0x26,
-  0x28, 0x39, 0xbe, 0x02, 0xfe, 0xf1, 0xf9, 0x1b, 0x0e, 0x51, 0x7d, 0x18,
-  0x3d, 0x38, 0xe3, 0x27, 0x4c, 0xf8, 0x4d, 0x70, 0xc5, 0xd2, 0xc4, 0x05,
-  0x0f, 0x1c, 0xb2, 0x06, 0x47, 0xe0, 0xe2, 0xf9, 0xe3, 0x9c, 0x1c, 0x1b,
-  0x19, 0x10, 0xc4, 0x10, 0x45, 0xb5, 0x04, 0x9b, 0xd9, 0x0e, 0xa3, 0xfe,
-  0x7f, 0x00, 0xc3, 0xca, 0x54, 0xe7, 0xe1, 0x66, 0x4e, 0xc1, 0x3d, 0x3f,
-  0xb6, 0xaa, 0x07, 0xc2, 0x29, 0xee, 0x11, 0xe5, 0x51, 0xbb, 0xdb, 0x05,
-  0xd0, 0x49, 0xe6, 0xe7, 0xbd, 0x76, 0xcb, 0x1f, 0xfe, 0xcd, 0xbb, 0xce,
-  0x06, 0x17, 0x59, 0x6e, 0x76, 0x39, 0x3f, 0xb7, 0xde, 0xd9, 0x00, 0xef,
-  0x7f, 0x66, 0x19, 0xb7, 0xb4, 0x55, 0xfb, 0x1e, 0x04, 0x36, 0xaa, 0xd6,
-  0xc7, 0xd5, 0x47, 0xfc, 0x21, 0xe6, 0x52, 0x75, 0x9c, 0x0a, 0x33, 0x52,
-  0x54, 0xd0, 0x85, 0xc6, 0x20, 0x16, 0x7a, 0x12, 0xb9, 0xb3, 0xed, 0x42,
-  0xea, 0xfb, 0x26, 0xd5, 0xbb, 0x2f, 0x61, 0x52, 0x2f, 0x38, 0xa4, 0x38,
-  0x7f, 0xce, 0x01, 0xcc, 0x1b, 0x3a, 0xa4, 0xe1, 0x67, 0x03, 0xd1, 0xf7,
-  0x18, 0x9d, 0x42, 0xbc, 0xf5, 0x11, 0x5c, 0x40, 0xd0, 0xe6, 0x1e, 0x53,
-  0x77, 0xcd, 0x36, 0xf6, 0xec, 0xab, 0xef, 0xfa, 0x24, 0xcd, 0x40, 0x01,
-  0x37, 0x3a, 0xe9, 0xd4, 0x0e, 0xbe, 0xf7, 0xfe, 0x27, 0xf0, 0xdb, 0xd6,
-  0x08, 0x4c, 0x27, 0xd2, 0xf5, 0xf7, 0xba, 0x37, 0xbe, 0x3b, 0xaf, 0xe3,
-  0xf2, 0x4f, 0x25, 0xd1, 0xc9, 0x1e, 0xdf, 0x1d, 0x1b, 0xc7, 0x0f, 0x34,
-  0x28, 0x29, 0x01, 0xe0, 0x41, 0x07, 0xc5, 0x00, 0x0d, 0x7f, 0x20, 0xed,
-  0xf6, 0xe7, 0x00, 0xaf, 0x2e, 0x64, 0xa7, 0xd3, 0x46, 0xfd, 0xf8, 0xd2,
-  0x24, 0x1d, 0xd4, 0xcd, 0x06, 0xe0, 0x2f, 0xef, 0xd6, 0xe6, 0xd5, 0xe2,
-  0x55, 0x06, 0x5b, 0xc5, 0x13, 0xeb, 0x2b, 0xdb, 0xea, 0xaa, 0xb4, 0xeb,
-  0xe5, 0x59, 0xf9, 0x28, 0xcc, 0x19, 0x4e, 0xe0, 0x13, 0x7f, 0xad, 0x36,
-  0x14, 0x2e, 0x4f, 0x58, 0x38, 0xd8, 0x09, 0x17, 0xf4, 0xe9, 0x36, 0xc8,
-  0x3e, 0x00, 0x4e, 0xe4, 0x1e, 0x03, 0xea, 0xee, 0x0e, 0x54, 0x19, 0x05,
-  0xee, 0x1d, 0x6c, 0xf6, 0xec, 0x11, 0x16, 0x22, 0xf8, 0xef, 0x0a, 0x32,
-  0x1e, 0x21, 0xa0, 0x0b, 0x0e, 0xf2, 0x1f, 0xbd, 0x0e, 0xd8, 0x21, 0x38,
-  0xd4, 0xf9, 0x0d, 0x19, 0xb9, 0xf0, 0xf2, 0xe0, 0xc4, 0x27, 0x64, 0xe5,
-  0xf0, 0x26, 0xde, 0xd4, 0x04, 0x11, 0xf2, 0x2e, 0x0e, 0xf5, 0x1e, 0xcf,
-  0xc9, 0xe4, 0xe1, 0xf6, 0x4d, 0x7f, 0x09, 0xc6, 0xe5, 0x26, 0xcd, 0xcf,
-  0xeb, 0x05, 0xab, 0xe4, 0xfc, 0xee, 0x17, 0x00, 0xf1, 0x1b, 0xd7, 0xf5,
-  0xdd, 0xc2, 0xfb, 0xca, 0x0d, 0xf2, 0xd4, 0xc5, 0xfd, 0x13, 0x45, 0xff,
-  0x16, 0xcd, 0x04, 0xfc, 0x43, 0x52, 0x7f, 0x2b, 0x01, 0x1f, 0x4c, 0x2a,
-  0xe0, 0xe6, 0x12, 0xcf, 0xff, 0xea, 0x41, 0xe4, 0xd5, 0xed, 0x33, 0xdf,
-  0x5c, 0x2c, 0xb0, 0x6e, 0x31, 0x01, 0x30, 0xdf, 0x95, 0xf0, 0xfb, 0x5a,
-  0xfa, 0x1f, 0x13, 0x59, 0x22, 0xf2, 0x41, 0xcd, 0xd8, 0x26, 0xd4, 0xfb,
-  0x6e, 0xd7, 0xcb, 0xdb, 0x42, 0x00, 0xcb, 0xe4, 0x45, 0xa4, 0x17, 0x33,
-  0x14, 0xa2, 0xf9, 0x43, 0x43, 0x52, 0xf0, 0xeb, 0x25, 0xe7, 0xd8, 0x2f,
-  0x0b, 0x1e, 0xe7, 0xea, 0x59, 0x47, 0xe5, 0x36, 0x0a, 0x09, 0xe9, 0x15,
-  0x20, 0x0e, 0x1c, 0xf8, 0x09, 0xee, 0x2e, 0xdc, 0xc6, 0x3b, 0xf3, 0x09,
-  0xf1, 0xb8, 0xea, 0xe8, 0x19, 0x43, 0xcb, 0xf0, 0xe6, 0x4f, 0x04, 0x4e,
-  0xd2, 0xc4, 0xc9, 0x29, 0xeb, 0x60, 0x2c, 0x0d, 0xfc, 0x23, 0xf6, 0xda,
-  0x1b, 0x7f, 0x1e, 0xfb, 0xbf, 0x4d, 0x16, 0x57, 0xc3, 0xce, 0x48, 0xea,
-  0xea, 0xe9, 0x5c, 0xef, 0xc5, 0xd6, 0x7f, 0x14, 0xc3, 0x38, 0xda, 0x4c,
-  0x5c, 0xba, 0x4e, 0xfa, 0x25, 0x3f, 0x9b, 0x53, 0x20, 0x23, 0x14, 0x19,
-  0xd2, 0xda, 0x02, 0x3e, 0xd5, 0xbe, 0x0f, 0x0e, 0xbf, 0x00, 0x0d, 0x46,
-  0x2b, 0xa8, 0x5d, 0xb9, 0x47, 0xf6, 0x15, 0xfa, 0x05, 0xe6, 0x3f, 0xf6,
-  0x0c, 0xde, 0xbd, 0x0d, 0x36, 0x99, 0x46, 0x3a, 0x2d, 0xdb, 0xf1, 0xb5,
-  0x43, 0xcf, 0xa2, 0x4a, 0x67, 0xd9, 0xf2, 0x53, 0xbe, 0x24, 0x1e, 0x48,
-  0xc1, 0x94, 0x9b, 0x36, 0x6c, 0x8c, 0x73, 0x04, 0x48, 0x25, 0xa9, 0xe2,
-  0xd8, 0x28, 0xf9, 0x6e, 0x0e, 0xc3, 0x24, 0xe9, 0xbe, 0x19, 0xff, 0x11,
-  0x4f, 0xef, 0x06, 0x58, 0x7f, 0x3e, 0x57, 0xfd, 0x02, 0xbf, 0x07, 0xf3,
-  0x70, 0xc1, 0xb5, 0xdb, 0x4b, 0x18, 0x3f, 0x02, 0x47, 0xa7, 0xf7, 0xef,
-  0xab, 0xb4, 0xda, 0xa2, 0xfd, 0xc9, 0x3e, 0xba, 0x6e, 0x2c, 0x2a, 0xe6,
-  0xe7, 0x56, 0x1a, 0x07, 0x39, 0x0b, 0xe2, 0xf2, 0x37, 0xb9, 0x15, 0x0e,
-  0x2c, 0x01, 0xd4, 0xea, 0x57, 0x0d, 0x03, 0x55, 0xda, 0xfb, 0xaf, 0x50,
-  0xc0, 0xb1, 0x08, 0xff, 0xfd, 0xd4, 0x00, 0x21, 0x7f, 0xcc, 0x02, 0xc4,
-  0xec, 0xd7, 0xd5, 0x00, 0x4b, 0xc3, 0x07, 0x33, 0x44, 0xdb, 0x16, 0x36,
-  0x20, 0xa6, 0x4f, 0x38, 0xea, 0xb3, 0xff, 0x3d, 0x1e, 0x0d, 0xeb, 0xd7,
-  0x28, 0xe2, 0x18, 0x4c, 0x2e, 0x26, 0x3f, 0xfb, 0x28, 0xf4, 0x2e, 0x1f,
-  0x0a, 0xbe, 0xea, 0xfc, 0xf4, 0x3e, 0x05, 0xf0, 0xff, 0x2c, 0xdc, 0x2f,
-  0x30, 0xe6, 0x43, 0xd4, 0xdd, 0x05, 0x16, 0x42, 0xcb, 0xdc, 0xd9, 0x45,
-  0x7f, 0x02, 0xf3, 0xc5, 0xe4, 0xaa, 0x0e, 0xf4, 0x35, 0xf7, 0xe8, 0xc0,
-  0xf2, 0x05, 0xd2, 0xf4, 0x04, 0xcd, 0x35, 0x34, 0xba, 0xba, 0xd9, 0xec,
-  0xfa, 0x2d, 0xaa, 0xdb, 0xe3, 0xc1, 0xdc, 0x1d, 0x32, 0xee, 0xe6, 0xe4,
-  0x33, 0x05, 0xfe, 0x04, 0xcb, 0x91, 0xf1, 0x28, 0xd2, 0x06, 0xfc, 0x2d,
-  0x0b, 0xf7, 0x26, 0xe4, 0xb4, 0x6a, 0xf3, 0x2f, 0xb8, 0x18, 0xe5, 0x01,
-  0xef, 0x17, 0xeb, 0xee, 0xea, 0x4e, 0xdb, 0x43, 0xe8, 0xeb, 0xe5, 0x4b,
-  0xe1, 0x54, 0x22, 0xfd, 0x17, 0x28, 0xd7, 0xfc, 0x31, 0x7f, 0x0d, 0x22,
-  0xc8, 0x48, 0x08, 0x6d, 0xd9, 0xbf, 0x39, 0x33, 0x2e, 0xb6, 0xc1, 0xf3,
-  0xe2, 0x29, 0xf7, 0xf8, 0xfc, 0x05, 0x5e, 0x94, 0xf1, 0x3a, 0xf7, 0xda,
-  0xcc, 0xc7, 0x54, 0x33, 0xd4, 0x0e, 0x1b, 0xfc, 0xe8, 0xf4, 0xce, 0xb5,
-  0x6f, 0x52, 0x1c, 0xd2, 0x3e, 0xfa, 0xcf, 0xf7, 0x02, 0x58, 0xcb, 0x1f,
-  0xf6, 0x3b, 0x27, 0xec, 0x2f, 0x19, 0x2b, 0xe5, 0xd5, 0xcd, 0xef, 0x3d,
-  0xe4, 0x09, 0xed, 0xd7, 0xe8, 0x1f, 0x7f, 0xe0, 0xff, 0xb9, 0xc6, 0xde,
-  0xdc, 0x07, 0x04, 0xfc, 0xfb, 0xba, 0xeb, 0xe7, 0xe9, 0x4d, 0x2f, 0x41,
-  0x00, 0x24, 0xe0, 0x20, 0xe6, 0xe4, 0x3b, 0x07, 0x0b, 0xef, 0x21, 0xe6,
-  0xc0, 0x7f, 0xf7, 0xf5, 0xe5, 0xc0, 0xc9, 0x01, 0xde, 0xd8, 0xee, 0xf4,
-  0xb0, 0x1c, 0xec, 0x31, 0xc5, 0xa8, 0xf7, 0x41, 0xec, 0x47, 0xd9, 0xfe,
-  0x2e, 0xc4, 0xd9, 0x1f, 0x50, 0x44, 0x26, 0x13, 0xb4, 0x4a, 0x2c, 0x0e,
-  0x07, 0x06, 0x28, 0xcc, 0xe7, 0x08, 0x56, 0x44, 0xff, 0x0a, 0x7f, 0x16,
-  0xc8, 0x0e, 0x3e, 0x42, 0x47, 0x88, 0x64, 0x53, 0xb3, 0xf3, 0x05, 0xd1,
-  0xc8, 0x2d, 0xf5, 0x52, 0x17, 0xa0, 0xca, 0xeb, 0xe4, 0x33, 0x00, 0x06,
-  0xf4, 0xfc, 0xed, 0x54, 0x33, 0x99, 0x63, 0xef, 0x38, 0xc6, 0xd9, 0xfc,
-  0x4a, 0xb5, 0x3a, 0xdf, 0x36, 0xf1, 0x0a, 0xb0, 0x54, 0xaf, 0x38, 0x01,
-  0x02, 0xdd, 0xda, 0xd8, 0xe9, 0xc1, 0xaf, 0x3e, 0xf5, 0xf3, 0x61, 0x55,
-  0xce, 0x46, 0x5b, 0xfa, 0x1a, 0x1c, 0xaa, 0x3b, 0x0d, 0xdc, 0x6d, 0xcb,
-  0xe0, 0xb6, 0xa7, 0x0e, 0xd0, 0x4a, 0xec, 0x75, 0xd3, 0x00, 0x21, 0x10,
-  0xcb, 0x25, 0x3a, 0x48, 0x9d, 0xba, 0x36, 0x40, 0x5f, 0xd2, 0x46, 0xb5,
-  0x0d, 0xbc, 0xcd, 0x0c, 0x64, 0xac, 0x01, 0xb9, 0x31, 0x0f, 0xe5, 0xfd,
-  0x44, 0xb1, 0x3c, 0x13, 0x9f, 0x81, 0xdb, 0x17, 0x14, 0xec, 0xc7, 0x26,
-  0x42, 0x16, 0x20, 0x48, 0x31, 0x45, 0x1c, 0x1b, 0xfb, 0xcb, 0x97, 0xe1,
-  0xf1, 0x8f, 0x29, 0x06, 0xce, 0xf4, 0xb4, 0x3b, 0x60, 0x25, 0xa6, 0x2d,
-  0x23, 0xb5, 0xc3, 0x5e, 0xc8, 0xcd, 0xfe, 0x33, 0x11, 0xb6, 0x1d, 0x21,
-  0x61, 0x55, 0xd6, 0xe8, 0x30, 0x3a, 0xea, 0xfa, 0x65, 0xf0, 0x2b, 0xd6,
-  0x17, 0xc6, 0x09, 0x21, 0x00, 0xfa, 0x7f, 0x68, 0xea, 0xd3, 0xf9, 0x43,
-  0x10, 0x4f, 0xdb, 0x26, 0x06, 0xbc, 0x16, 0x2e, 0x68, 0x4a, 0xd1, 0xf3,
-  0x06, 0xc8, 0xd9, 0xdb, 0xd2, 0xd0, 0x47, 0x58, 0xda, 0xe0, 0x1e, 0xf2,
-  0xd5, 0x0f, 0xf0, 0x33, 0xf4, 0x27, 0x99, 0x06, 0xb7, 0x8c, 0x17, 0x03,
-  0x22, 0x04, 0xc9, 0xe1, 0xd2, 0x47, 0xf4, 0x4e, 0xc1, 0xf0, 0xbe, 0x3d,
-  0xee, 0x42, 0xd5, 0xf5, 0x3a, 0x3b, 0x20, 0x69, 0x64, 0x72, 0xea, 0x6a,
-  0xf9, 0x2b, 0xef, 0x7f, 0xf0, 0x52, 0x1a, 0x07, 0x0e, 0xe7, 0x15, 0x12,
-  0x3b, 0xdc, 0xc8, 0xfd, 0x34, 0x16, 0xe8, 0xf1, 0xfd, 0xce, 0xec, 0x1b,
-  0xf2, 0xf9, 0x32, 0x40, 0x0f, 0xf6, 0x2c, 0x02, 0xda, 0x24, 0xea, 0xdb,
-  0x2a, 0xe0, 0xfd, 0xf5, 0x26, 0x20, 0xf0, 0xfa, 0xe2, 0xd0, 0xe3, 0x45,
-  0xf3, 0x19, 0xff, 0x27, 0xd5, 0x46, 0xfb, 0x05, 0x08, 0xf8, 0x00, 0xf2,
-  0x2e, 0x7f, 0xf9, 0x0a, 0xcb, 0x3a, 0xfe, 0x2d, 0xf9, 0xf2, 0x07, 0x35,
-  0x2f, 0xf9, 0x1c, 0x1e, 0x21, 0x1a, 0xd0, 0xf6, 0x47, 0xae, 0x1d, 0x21,
-  0xc5, 0xbf, 0xb4, 0x33, 0xf0, 0xd3, 0x6c, 0x44, 0xb5, 0xf2, 0x19, 0x12,
-  0x17, 0x77, 0xd4, 0xec, 0xbd, 0xab, 0xd8, 0xe6, 0x25, 0xf9, 0xd1, 0xef,
-  0xc7, 0x3c, 0xfc, 0x45, 0xca, 0x0d, 0x92, 0x45, 0xec, 0x7f, 0x1f, 0x05,
-  0x27, 0x04, 0xcc, 0x55, 0x5d, 0x6f, 0x22, 0xf2, 0xea, 0x5f, 0x24, 0x31,
-  0xea, 0x03, 0x5a, 0x0b, 0x02, 0xae, 0xce, 0x53, 0x0a, 0x75, 0xd2, 0x0d,
-  0xf6, 0xc5, 0xf2, 0xb8, 0xba, 0x7f, 0xb4, 0xe9, 0xc5, 0xec, 0x65, 0x55,
-  0xea, 0xd3, 0xdd, 0xca, 0x60, 0xf7, 0xdc, 0x1b, 0x12, 0xf4, 0x60, 0xc4,
-  0x59, 0xd9, 0x24, 0xf4, 0xed, 0x47, 0xfc, 0xde, 0x4e, 0xf7, 0xc9, 0xdc,
-  0xfe, 0xfd, 0xfc, 0x3f, 0x18, 0xc1, 0x10, 0x3b, 0x4e, 0xf9, 0x06, 0x4d,
-  0x52, 0xf8, 0x62, 0xc4, 0xc8, 0x21, 0xea, 0xae, 0x63, 0x2c, 0x51, 0x2d,
-  0x2a, 0x33, 0x2b, 0x38, 0xdc, 0xa3, 0xaa, 0x0e, 0x6d, 0xed, 0x47, 0xef,
-  0xeb, 0xe6, 0xad, 0x0d, 0x5f, 0x24, 0x11, 0x62, 0xe5, 0xcc, 0xdf, 0xfc,
-  0x26, 0xd2, 0xff, 0x3f, 0xef, 0x0d, 0xf8, 0x1d, 0x7f, 0x8d, 0xff, 0xcb,
-  0xfa, 0xd6, 0x58, 0xff, 0x46, 0xe5, 0xeb, 0xc3, 0x1e, 0x0a, 0x05, 0x42,
-  0x0e, 0xbb, 0xe0, 0x1e, 0x18, 0xce, 0xea, 0xba, 0x18, 0xe6, 0xa0, 0x34,
-  0xd5, 0x29, 0xe1, 0x51, 0x14, 0x5f, 0xa6, 0xeb, 0x81, 0x1b, 0x48, 0x35,
-  0x09, 0x76, 0xd0, 0x15, 0xef, 0xe8, 0x12, 0xec, 0x16, 0xb5, 0xda, 0xd5,
-  0x0d, 0xee, 0xb4, 0x10, 0xf4, 0x42, 0x2e, 0x16, 0x14, 0xec, 0xe3, 0x8d,
-  0x38, 0x41, 0xb5, 0x0e, 0x29, 0x1d, 0x21, 0x13, 0xc1, 0x10, 0xe6, 0xf0,
-  0xb0, 0x03, 0xd2, 0xd9, 0xeb, 0x24, 0xf8, 0xfe, 0x12, 0xde, 0x34, 0xbc,
-  0xd4, 0xf0, 0xec, 0xee, 0x19, 0x26, 0x4e, 0x60, 0xf6, 0x14, 0x4d, 0x01,
-  0x07, 0x00, 0xcf, 0xdb, 0x3a, 0xf8, 0x06, 0xe3, 0xfe, 0xe6, 0xe4, 0x05,
-  0x34, 0x03, 0x22, 0x6f, 0xd5, 0xa6, 0xf7, 0x28, 0xa1, 0xeb, 0xe2, 0x00,
-  0xb0, 0x2f, 0xbc, 0x43, 0x2c, 0x2a, 0x33, 0xbc, 0x53, 0xdd, 0xae, 0x09,
-  0x21, 0xc9, 0xd5, 0xef, 0xf7, 0x4b, 0xf6, 0xfe, 0x4a, 0xcb, 0x61, 0x0b,
-  0x0f, 0xee, 0xd2, 0xd9, 0x1f, 0xb5, 0x81, 0xfe, 0xd7, 0xb4, 0x50, 0xd0,
-  0x5c, 0x56, 0xb1, 0x25, 0x2d, 0x3e, 0x56, 0x03, 0x0e, 0xf5, 0xe4, 0xe0,
-  0xd7, 0xe4, 0xa6, 0x17, 0x62, 0xfc, 0xfd, 0xa9, 0x60, 0x61, 0x75, 0xa2,
-  0x20, 0x4c, 0xad, 0xe4, 0x20, 0x22, 0x05, 0xeb, 0xbc, 0x9a, 0xc7, 0x21,
-  0x24, 0xe3, 0x07, 0x37, 0xea, 0x7f, 0xdc, 0xf3, 0x18, 0xe5, 0x1a, 0x0d,
-  0xfb, 0x76, 0xf4, 0x22, 0x81, 0x49, 0x79, 0xde, 0xf6, 0xb2, 0xf9, 0xb2,
-  0x0b, 0x39, 0x1f, 0x73, 0x22, 0x5a, 0x54, 0x39, 0xc5, 0xac, 0x3a, 0x58,
-  0x42, 0x8b, 0x5d, 0x44, 0x28, 0x06, 0x2d, 0xd6, 0xc7, 0x4f, 0xf5, 0x39,
-  0x4d, 0xac, 0xec, 0x48, 0xc7, 0xfe, 0x31, 0x1a, 0xd1, 0xa1, 0xee, 0x5d,
-  0x7f, 0xd5, 0x01, 0xe3, 0xf5, 0x39, 0x94, 0x0a, 0x54, 0xec, 0x2f, 0xdb,
-  0x0b, 0x17, 0x11, 0xfb, 0xf5, 0xef, 0x54, 0x11, 0x61, 0xa1, 0xc3, 0x8f,
-  0x15, 0xc1, 0xad, 0x22, 0xc6, 0xf5, 0x0b, 0xe0, 0x2c, 0x30, 0xb6, 0x22,
-  0xe1, 0x36, 0x55, 0xe6, 0xf9, 0xf1, 0xe0, 0xba, 0xe8, 0xba, 0x0f, 0x55,
-  0x01, 0xf4, 0x41, 0x26, 0x02, 0x4e, 0x46, 0xbc, 0x13, 0x3e, 0x3c, 0xfe,
-  0xc3, 0x38, 0x1d, 0xe3, 0xf7, 0xc8, 0x07, 0x4e, 0x2d, 0x0e, 0xe1, 0x10,
-  0x13, 0x0e, 0x29, 0xf8, 0x2e, 0x34, 0x38, 0x1e, 0x0d, 0x19, 0xff, 0x05,
-  0xc2, 0x53, 0x7f, 0xe3, 0xbf, 0x02, 0x24, 0x10, 0x04, 0x2d, 0x9f, 0xa2,
-  0xbf, 0xf5, 0x27, 0xb3, 0xbd, 0x5c, 0x47, 0x9c, 0x95, 0x7f, 0x93, 0x54,
-  0xe3, 0x11, 0x3b, 0xdb, 0x52, 0xe1, 0xcd, 0xd6, 0xc8, 0x11, 0x23, 0x02,
-  0x1d, 0x1f, 0x21, 0xd4, 0x37, 0xb5, 0x52, 0xa6, 0xcb, 0x1f, 0xe7, 0xee,
-  0x0b, 0xe0, 0xef, 0xbf, 0x0d, 0x43, 0x0e, 0x2c, 0x41, 0x44, 0xa8, 0x63,
-  0xd8, 0xf1, 0x9e, 0xfb, 0x73, 0xfe, 0x23, 0xbb, 0xe1, 0x49, 0xf8, 0xd9,
-  0x1a, 0x29, 0x1c, 0xc5, 0xeb, 0x14, 0xea, 0x03, 0x2c, 0xd1, 0xe8, 0xe5,
-  0xe7, 0x0a, 0xf2, 0x03, 0x37, 0xe4, 0x19, 0x1a, 0xd6, 0xf0, 0x55, 0xbc,
-  0x51, 0x38, 0xe5, 0xe6, 0xd9, 0x08, 0x35, 0xf2, 0x3d, 0xfb, 0x2d, 0x0f,
-  0xd0, 0x0b, 0x1e, 0x5a, 0xa3, 0xe3, 0xde, 0x4b, 0xf1, 0x36, 0x2b, 0xeb,
-  0x1b, 0xfc, 0xee, 0xc5, 0x08, 0x51, 0x17, 0xd7, 0xd3, 0x7f, 0x0c, 0x47,
-  0xdf, 0xd8, 0x04, 0x25, 0x2b, 0xba, 0x70, 0x34, 0x3d, 0xdd, 0x1f, 0x05,
-  0x0b, 0x9c, 0xce, 0xff, 0x3e, 0x92, 0x56, 0x68, 0x0d, 0x2d, 0x47, 0x37,
-  0x1d, 0x0b, 0xaa, 0x0e, 0xbd, 0x9e, 0x40, 0xc6, 0xa4, 0x94, 0xc8, 0x6d,
-  0xa8, 0xe6, 0xce, 0x3d, 0x7f, 0x35, 0x40, 0xd1, 0xd5, 0x0d, 0x25, 0xff,
-  0x57, 0xb5, 0x1e, 0xfd, 0x59, 0xcf, 0x16, 0x48, 0x19, 0xf5, 0x37, 0x78,
-  0x1b, 0x9f, 0xe8, 0xfe, 0xfb, 0x04, 0x30, 0xa8, 0x0c, 0xbc, 0x7f, 0xfb,
-  0xdf, 0xec, 0x20, 0x5b, 0x08, 0xae, 0x27, 0x0c, 0x36, 0xc8, 0x15, 0x68,
-  0x3c, 0x48, 0xa8, 0xec, 0x22, 0x28, 0xd4, 0x0b, 0xe3, 0xe7, 0xe8, 0x54,
-  0xdd, 0x9a, 0xe1, 0x4a, 0x43, 0xc9, 0xd4, 0x3a, 0x1e, 0xac, 0x1a, 0xb0,
-  0x2a, 0x13, 0x2f, 0xf8, 0x33, 0xd7, 0x27, 0x1a, 0x0e, 0xfd, 0xe0, 0xe6,
-  0x1c, 0xa3, 0x74, 0x03, 0x28, 0xc9, 0x20, 0x12, 0x3d, 0x4b, 0xf8, 0xfb,
-  0x42, 0xec, 0x18, 0x24, 0x4a, 0x45, 0xec, 0x05, 0x66, 0x2b, 0xb6, 0x30,
-  0xf9, 0xf2, 0x15, 0x03, 0xbc, 0xcd, 0x13, 0x23, 0xdc, 0x07, 0xf5, 0x14,
-  0x06, 0x42, 0xb2, 0xf6, 0x15, 0x14, 0xf7, 0x1b, 0x30, 0x04, 0x37, 0x03,
-  0xb7, 0x0c, 0x25, 0x2e, 0xdd, 0x05, 0xec, 0x49, 0x05, 0x55, 0xd0, 0x02,
-  0x1c, 0x28, 0xee, 0x50, 0x35, 0x6d, 0x09, 0x0e, 0x9b, 0x37, 0xfa, 0x7f,
-  0xfc, 0x05, 0xe7, 0xbd, 0xe0, 0xde, 0x1d, 0x1e, 0x3b, 0xe9, 0xd8, 0xea,
-  0x52, 0x1f, 0xdc, 0xed, 0xd3, 0x15, 0xc7, 0x14, 0x0a, 0x0f, 0xda, 0x2c,
-  0x24, 0xe6, 0x1b, 0xf2, 0x38, 0x56, 0x04, 0x1a, 0x2a, 0xe8, 0x0a, 0xdf,
-  0x07, 0x11, 0x0c, 0xe6, 0xd9, 0xd5, 0xdf, 0x47, 0xe2, 0xc6, 0xf9, 0x36,
-  0xb6, 0x4b, 0x58, 0x08, 0x02, 0x0f, 0xd8, 0xc8, 0x3c, 0x7f, 0x33, 0xfb,
-  0x2a, 0x49, 0x0e, 0x4d, 0x00, 0x27, 0x27, 0xda, 0x32, 0xfd, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
-  0x83, 0xf5, 0xff, 0xff, 0xb5, 0xf7, 0xff, 0xff, 0xe0, 0xf1, 0xff, 0xff,
-  0xa3, 0xf8, 0xff, 0xff, 0x35, 0xf9, 0xff, 0xff, 0xd0, 0xfa, 0xff, 0xff,
-  0x9b, 0xf8, 0xff, 0xff, 0xb3, 0xfb, 0xff, 0xff, 0xd8, 0xfb, 0xff, 0xff,
-  0x10, 0xfc, 0xff, 0xff, 0xb3, 0xfd, 0xff, 0xff, 0x4b, 0xfc, 0xff, 0xff,
-  0xcc, 0x03, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,
-  0xd9, 0xf3, 0xff, 0xff, 0x21, 0x05, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00,
-  0xa2, 0xfa, 0xff, 0xff, 0x35, 0xfb, 0xff, 0xff, 0x13, 0xf9, 0xff, 0xff,
-  0x68, 0xfc, 0xff, 0xff, 0x95, 0xf9, 0xff, 0xff, 0x3e, 0xfe, 0xff, 0xff,
-  0x68, 0xf3, 0xff, 0xff, 0xe5, 0x04, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
-  0x1c, 0x04, 0x00, 0x00, 0xb1, 0xf4, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xff,
-  0x6e, 0xfb, 0xff, 0xff, 0xb5, 0xfd, 0xff, 0xff, 0xd3, 0xfc, 0xff, 0xff,
-  0x4c, 0xf3, 0xff, 0xff, 0x37, 0x03, 0x00, 0x00, 0xf3, 0xf6, 0xff, 0xff,
-  0x0a, 0xf7, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00,
-  0x5b, 0xfe, 0xff, 0xff, 0xf0, 0xfe, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff,
-  0xd7, 0xf9, 0xff, 0xff, 0x43, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0x5b, 0xfa, 0xff, 0xff, 0xee, 0xfe, 0xff, 0xff,
-  0xd9, 0xfa, 0xff, 0xff, 0xb2, 0xfc, 0xff, 0xff, 0x23, 0xfe, 0xff, 0xff,
-  0x26, 0xfd, 0xff, 0xff, 0x81, 0x02, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xff,
-  0x2d, 0xfc, 0xff, 0xff, 0xc2, 0xfa, 0xff, 0xff, 0xdb, 0xf3, 0xff, 0xff,
-  0xa9, 0x06, 0x00, 0x00, 0x64, 0xfe, 0xff, 0xff, 0x39, 0xfd, 0xff, 0xff,
-  0xb4, 0xff, 0xff, 0xff, 0x72, 0xf6, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff,
-  0x3e, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-  0x48, 0x9f, 0x45, 0xae, 0xc1, 0x8d, 0xf4, 0x8f, 0xb1, 0xd1, 0x8c, 0xa2,
-  0xe7, 0xbf, 0x1f, 0xec, 0xe2, 0x3f, 0xf2, 0xbb, 0xb9, 0x19, 0xa0, 0xbf,
-  0xa2, 0xd4, 0x99, 0x20, 0xae, 0xa8, 0xad, 0x35, 0xe3, 0x47, 0x38, 0x44,
-  0xc5, 0xb8, 0xdc, 0xac, 0xac, 0xb2, 0xc7, 0x37, 0xdb, 0xdf, 0x9c, 0x96,
-  0x8f, 0xc9, 0x93, 0x33, 0xbc, 0x33, 0xcf, 0x43, 0xce, 0x46, 0x10, 0x05,
-  0x9d, 0xa8, 0x8c, 0x99, 0xdf, 0x28, 0xc1, 0xcc, 0x5f, 0x3b, 0x64, 0x72,
-  0x53, 0xde, 0xed, 0x0d, 0xf4, 0xc1, 0xc4, 0x42, 0xc8, 0xce, 0x09, 0x4a,
-  0xc4, 0xd3, 0xaf, 0x8b, 0xc1, 0x97, 0x60, 0x37, 0xc5, 0xeb, 0xc3, 0xc4,
-  0xa7, 0xe7, 0xbf, 0xfc, 0xf5, 0x77, 0x93, 0xa7, 0xe1, 0x93, 0x66, 0x02,
-  0x6b, 0xc2, 0x9e, 0xe6, 0x06, 0x79, 0x23, 0xb5, 0x9c, 0xc8, 0xac, 0x4f,
-  0xb2, 0x09, 0xca, 0x3c, 0xb2, 0xb4, 0x1c, 0x64, 0x19, 0x3e, 0xeb, 0x5e,
-  0xb2, 0xc0, 0xa9, 0xf5, 0x10, 0x58, 0x27, 0x06, 0x74, 0x5b, 0xf3, 0xc6,
-  0x5a, 0xe9, 0x5c, 0xdf, 0x5f, 0x5a, 0x4e, 0x50, 0x74, 0x1c, 0xb2, 0x98,
-  0x6c, 0x69, 0x59, 0xff, 0x75, 0x1c, 0xf5, 0x09, 0x65, 0xc0, 0x56, 0x68,
-  0x56, 0x77, 0xf3, 0x02, 0x95, 0x63, 0x61, 0x42, 0xed, 0xd9, 0xaa, 0x15,
-  0x7f, 0x18, 0x78, 0xda, 0x74, 0xb0, 0xf4, 0xcc, 0x43, 0x40, 0xee, 0x97,
-  0x0a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00,
-  0x22, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x84, 0xa8, 0xff, 0xff, 0x88, 0xa8, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
-  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00,
-  0xfc, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00,
-  0x5c, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
-  0x58, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
-  0x9c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-  0x1e, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x68, 0xa9, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0xf6, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x72, 0xfd, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-  0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc2, 0xfd, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x4a, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf0, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x8e, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe2, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x16, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x6a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
-  0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0x80, 0x53, 0x00, 0x00, 0x14, 0x53, 0x00, 0x00,
-  0xa8, 0x52, 0x00, 0x00, 0x38, 0x52, 0x00, 0x00, 0xd4, 0x51, 0x00, 0x00,
-  0x00, 0x4e, 0x00, 0x00, 0x9c, 0x4a, 0x00, 0x00, 0x90, 0x46, 0x00, 0x00,
-  0x74, 0x42, 0x00, 0x00, 0x88, 0x3e, 0x00, 0x00, 0x24, 0x3b, 0x00, 0x00,
-  0x18, 0x37, 0x00, 0x00, 0x10, 0x33, 0x00, 0x00, 0x20, 0x2f, 0x00, 0x00,
-  0xbc, 0x2b, 0x00, 0x00, 0xb0, 0x27, 0x00, 0x00, 0xa8, 0x23, 0x00, 0x00,
-  0xb8, 0x1f, 0x00, 0x00, 0x54, 0x1c, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00,
-  0x48, 0x14, 0x00, 0x00, 0x68, 0x10, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00,
-  0x78, 0x0c, 0x00, 0x00, 0x64, 0x0b, 0x00, 0x00, 0x28, 0x0a, 0x00, 0x00,
-  0x0c, 0x09, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00, 0xb4, 0x06, 0x00, 0x00,
-  0x78, 0x05, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00,
-  0x1c, 0x02, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2a, 0xad, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x14, 0xad, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b,
-  0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
-  0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
-  0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa2, 0xad, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x8c, 0xad, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1b, 0x4d, 0x23, 0x3e, 0x26, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74, 0x4d,
-  0x75, 0x6c, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e,
-  0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x2a, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x14, 0xae, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x4e, 0x86, 0xdb, 0x3d, 0x1a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xa2, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x94, 0xae, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x4e, 0x86, 0xdb, 0x3d, 0x1f, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x70, 0x6f,
-  0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x2f, 0x41, 0x76, 0x67, 0x50,
-  0x6f, 0x6f, 0x6c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x32, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x24, 0xaf, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x4e, 0x86, 0xdb, 0x3d,
-  0x93, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x32, 0xb0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0xb0, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xa1, 0x92, 0x84, 0x3d, 0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x37, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x6a, 0xb1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5c, 0xb1, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xb1, 0x5a, 0x13, 0x3d, 0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x36, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x82, 0xb2, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x74, 0xb2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x75, 0xb1, 0x6d, 0x3d, 0xca, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x35, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xba, 0xb3, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xac, 0xb3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0xeb, 0xe5, 0x3e, 0x3d, 0xa9, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x34, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x34, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xd2, 0xb4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xc4, 0xb4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x95, 0x7b, 0x3d,
-  0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x0a, 0xb6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xfc, 0xb5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x65, 0x93, 0x2b, 0x3d,
-  0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x22, 0xb7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0xb7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa0, 0x6c, 0x31, 0x3d, 0xc4, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x5a, 0xb8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4c, 0xb8, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x80, 0xd6, 0x3c, 0x9f, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x2f,
-  0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62,
-  0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69,
-  0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x6a, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x5c, 0xb9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x6c, 0xc7, 0x3d,
-  0x18, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66,
-  0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x5a, 0xba, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0xcc, 0xb9, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xd4, 0x6d, 0x02, 0x39, 0x48, 0x6c, 0xc0, 0x39,
-  0x42, 0x82, 0x2a, 0x39, 0x6a, 0x81, 0xaf, 0x39, 0x37, 0x9b, 0x8d, 0x39,
-  0x4d, 0x4a, 0xf4, 0x38, 0x56, 0x58, 0xce, 0x38, 0xcc, 0x5a, 0xfc, 0x39,
-  0x84, 0xf4, 0x2a, 0x39, 0xe8, 0xfc, 0x72, 0x39, 0x7e, 0x33, 0x53, 0x3a,
-  0x91, 0xba, 0xf3, 0x38, 0x55, 0xaa, 0xf8, 0x39, 0x9a, 0x59, 0x9e, 0x39,
-  0x21, 0x46, 0x86, 0x39, 0x6c, 0x2e, 0x07, 0x3a, 0x20, 0x36, 0x01, 0x39,
-  0xf3, 0x93, 0x1d, 0x39, 0xca, 0x0f, 0xe3, 0x38, 0xc9, 0x5a, 0xd0, 0x38,
-  0x37, 0x42, 0x38, 0x39, 0xe3, 0xc1, 0xc1, 0x38, 0x05, 0x8c, 0x64, 0x39,
-  0x3f, 0xe0, 0x96, 0x3a, 0x43, 0xcf, 0x31, 0x39, 0xad, 0x5a, 0x0f, 0x3a,
-  0xd2, 0xe1, 0x11, 0x39, 0xf4, 0x30, 0x71, 0x39, 0xe6, 0x37, 0x15, 0x39,
-  0x67, 0x84, 0x65, 0x39, 0x64, 0xb3, 0x93, 0x39, 0xc2, 0x10, 0xcd, 0x38,
-  0xb9, 0x94, 0xa1, 0x39, 0x83, 0x93, 0x0a, 0x39, 0x92, 0xd4, 0x04, 0x39,
-  0x37, 0xfa, 0x3e, 0x3a, 0xbc, 0xd2, 0x19, 0x3a, 0x01, 0x99, 0x24, 0x39,
-  0xd5, 0x1c, 0x8c, 0x39, 0xcf, 0x10, 0x06, 0x39, 0x78, 0x3c, 0xda, 0x39,
-  0xfd, 0x5c, 0xc6, 0x38, 0x8c, 0x49, 0x6f, 0x39, 0x2f, 0x78, 0xdc, 0x39,
-  0xe9, 0xfd, 0x09, 0x3a, 0xf1, 0xb5, 0x0d, 0x3a, 0x85, 0x66, 0x2f, 0x3a,
-  0x7f, 0x4d, 0x13, 0x39, 0xc7, 0xe6, 0x36, 0x39, 0xdc, 0xa2, 0x32, 0x39,
-  0x17, 0xfe, 0x79, 0x39, 0xf2, 0x32, 0xc4, 0x39, 0xe5, 0x81, 0xa7, 0x38,
-  0xa8, 0x0d, 0x9e, 0x39, 0xcc, 0xe3, 0xc9, 0x38, 0x83, 0x0e, 0x0d, 0x39,
-  0x3e, 0xf2, 0x39, 0x39, 0x38, 0x44, 0xe6, 0x38, 0x37, 0xa0, 0xa8, 0x39,
-  0xcb, 0xb6, 0xa2, 0x39, 0xdb, 0x48, 0x46, 0x39, 0x1f, 0xb2, 0x8b, 0x39,
-  0x2d, 0x74, 0xd7, 0x38, 0x25, 0x05, 0x97, 0x39, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xbc, 0x03, 0x00, 0x00, 0x2c, 0xbd, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xff, 0x34, 0x4b, 0x37, 0x7f, 0xe5, 0x15, 0x38, 0x52, 0xd3, 0x84, 0x37,
-  0xc6, 0xb7, 0x08, 0x38, 0x02, 0x9f, 0xdc, 0x37, 0x01, 0x4d, 0x3e, 0x37,
-  0xe0, 0xbd, 0x20, 0x37, 0x3c, 0x95, 0x44, 0x38, 0x53, 0x2c, 0x85, 0x37,
-  0x4a, 0x49, 0xbd, 0x37, 0x4a, 0x86, 0xa4, 0x38, 0x09, 0xdd, 0x3d, 0x37,
-  0x81, 0xb5, 0x41, 0x38, 0x27, 0xb5, 0xf6, 0x37, 0x87, 0x32, 0xd1, 0x37,
-  0x70, 0x9c, 0x52, 0x38, 0x5e, 0x4f, 0x49, 0x37, 0x36, 0x81, 0x75, 0x37,
-  0x3d, 0xe1, 0x30, 0x37, 0xa1, 0x4e, 0x22, 0x37, 0x59, 0x89, 0x8f, 0x37,
-  0x9b, 0xef, 0x16, 0x37, 0x70, 0x09, 0xb2, 0x37, 0x2a, 0x10, 0xeb, 0x38,
-  0x43, 0x83, 0x8a, 0x37, 0x25, 0x58, 0x5f, 0x38, 0x64, 0x48, 0x63, 0x37,
-  0xfd, 0xe2, 0xbb, 0x37, 0x09, 0x7b, 0x68, 0x37, 0xed, 0xca, 0xb2, 0x37,
-  0xbf, 0x1d, 0xe6, 0x37, 0xb2, 0xbe, 0x1f, 0x37, 0xcc, 0xbd, 0xfb, 0x37,
-  0x78, 0xe6, 0x57, 0x37, 0xc2, 0xf2, 0x4e, 0x37, 0x38, 0xc5, 0x94, 0x38,
-  0xa6, 0xa7, 0x6f, 0x38, 0x80, 0x38, 0x80, 0x37, 0x42, 0x4b, 0xda, 0x37,
-  0x74, 0xdf, 0x50, 0x37, 0x3d, 0x01, 0x2a, 0x38, 0x1f, 0x86, 0x1a, 0x37,
-  0x4e, 0x67, 0xba, 0x37, 0x9a, 0xbe, 0x2b, 0x38, 0x64, 0xfd, 0x56, 0x38,
-  0xa6, 0xc8, 0x5c, 0x38, 0xd3, 0xa2, 0x88, 0x38, 0xfe, 0x7e, 0x65, 0x37,
-  0xb2, 0x7a, 0x8e, 0x37, 0x19, 0x28, 0x8b, 0x37, 0x2c, 0xbe, 0xc2, 0x37,
-  0x86, 0xd6, 0x18, 0x38, 0xc5, 0x7c, 0x02, 0x37, 0xd4, 0x3e, 0xf6, 0x37,
-  0x67, 0x45, 0x1d, 0x37, 0xcb, 0xc3, 0x5b, 0x37, 0xe5, 0xd9, 0x90, 0x37,
-  0x59, 0x60, 0x33, 0x37, 0xcf, 0x5b, 0x03, 0x38, 0xb9, 0x81, 0xfd, 0x37,
-  0x70, 0x76, 0x9a, 0x37, 0x01, 0xa5, 0xd9, 0x37, 0x5e, 0xd6, 0x27, 0x37,
-  0xa7, 0x49, 0xeb, 0x37, 0x9e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68,
-  0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x96, 0xc1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00,
-  0x02, 0xd2, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x8d, 0x81, 0xae, 0x3b, 0xda, 0x61, 0x1d, 0x3c, 0x37, 0x3f, 0xce, 0x3b,
-  0x48, 0x77, 0x4a, 0x3c, 0x6d, 0xc8, 0x6d, 0x3c, 0x54, 0x80, 0x91, 0x3b,
-  0xe0, 0xd6, 0x46, 0x3b, 0x73, 0xdd, 0x7d, 0x3c, 0x0c, 0xaf, 0x68, 0x3b,
-  0x3a, 0xf2, 0x09, 0x3c, 0xa3, 0x29, 0x2c, 0x3c, 0x61, 0xc2, 0xa3, 0x3b,
-  0x4c, 0x9b, 0x89, 0x3c, 0x9d, 0x46, 0x61, 0x3c, 0xaf, 0x84, 0x68, 0x3c,
-  0x70, 0x36, 0x78, 0x3c, 0x73, 0x98, 0x77, 0x3b, 0x6e, 0xa7, 0xa6, 0x3b,
-  0x10, 0x8f, 0xc0, 0x3b, 0x32, 0xd1, 0xed, 0x3b, 0x6c, 0xce, 0xe6, 0x3b,
-  0x93, 0xc5, 0xfa, 0x3b, 0x9a, 0xb9, 0xa2, 0x3b, 0x4f, 0x46, 0x4b, 0x3c,
-  0xa5, 0x13, 0xea, 0x3b, 0xa4, 0x29, 0x9a, 0x3c, 0x99, 0x9d, 0xb6, 0x3b,
-  0x25, 0x6f, 0x9b, 0x3c, 0x53, 0x53, 0xe9, 0x3b, 0xe6, 0x18, 0xfc, 0x3b,
-  0xff, 0x8f, 0x46, 0x3c, 0x25, 0x6f, 0xd9, 0x3b, 0xb2, 0xf7, 0x59, 0x3c,
-  0x9f, 0xc6, 0x81, 0x3c, 0xa5, 0x20, 0xbb, 0x3b, 0x6a, 0xe1, 0x96, 0x3c,
-  0xfa, 0x66, 0xea, 0x3b, 0xd1, 0x0f, 0xee, 0x3b, 0x42, 0x60, 0x87, 0x3c,
-  0xeb, 0xeb, 0xa4, 0x3b, 0x20, 0x6a, 0x35, 0x3c, 0xd6, 0x16, 0xb6, 0x3b,
-  0x00, 0x81, 0x8c, 0x3b, 0x2f, 0x56, 0xf9, 0x3b, 0x51, 0xad, 0x3a, 0x3c,
-  0x0d, 0x34, 0x12, 0x3c, 0x9d, 0xef, 0x88, 0x3c, 0xae, 0xa1, 0xaa, 0x3b,
-  0xf2, 0x7a, 0xd4, 0x3b, 0x2d, 0x1d, 0xb8, 0x3b, 0x5b, 0x66, 0x01, 0x3c,
-  0x67, 0x11, 0x71, 0x3c, 0x55, 0x89, 0xc3, 0x3b, 0xf2, 0xe7, 0x69, 0x3c,
-  0x0f, 0xc1, 0x50, 0x3b, 0x88, 0xdf, 0xd3, 0x3b, 0x79, 0xad, 0x01, 0x3c,
-  0xcf, 0x9e, 0x9f, 0x3b, 0x76, 0x91, 0x2c, 0x3c, 0xa4, 0xdb, 0xfc, 0x3b,
-  0xd9, 0xb7, 0x68, 0x3c, 0x7d, 0x10, 0x02, 0x3c, 0xc3, 0x7b, 0x9c, 0x3b,
-  0x4d, 0xa0, 0xfa, 0x3b, 0xb0, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
-  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f,
-  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
-  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
-  0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x9a, 0xc5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe0, 0x03, 0x00, 0x00, 0x0c, 0xc5, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x9a, 0x37, 0x12, 0x39, 0x89, 0xde, 0x83, 0x39, 0x08, 0xd0, 0x2c, 0x39,
-  0x02, 0xa5, 0xa9, 0x39, 0x82, 0x3c, 0xc7, 0x39, 0x24, 0xd4, 0xf3, 0x38,
-  0x1a, 0x9b, 0xa6, 0x38, 0x21, 0xb6, 0xd4, 0x39, 0xbe, 0xf6, 0xc2, 0x38,
-  0x01, 0x2b, 0x67, 0x39, 0xf1, 0x40, 0x90, 0x39, 0x6b, 0x36, 0x09, 0x39,
-  0x54, 0x99, 0xe6, 0x39, 0xbc, 0xc1, 0xbc, 0x39, 0x3f, 0xd3, 0xc2, 0x39,
-  0xb0, 0xf9, 0xcf, 0x39, 0x50, 0x75, 0xcf, 0x38, 0x57, 0xa3, 0x0b, 0x39,
-  0xee, 0x57, 0x21, 0x39, 0xdb, 0x43, 0x47, 0x39, 0x08, 0x64, 0x41, 0x39,
-  0x9f, 0x1e, 0x52, 0x39, 0x90, 0x58, 0x08, 0x39, 0x79, 0x52, 0xaa, 0x39,
-  0x88, 0x21, 0x44, 0x39, 0xf0, 0x2b, 0x01, 0x3a, 0x1b, 0x03, 0x19, 0x39,
-  0xad, 0x3c, 0x02, 0x3a, 0x63, 0x80, 0x43, 0x39, 0xf0, 0x3a, 0x53, 0x39,
-  0xb7, 0x5f, 0xa6, 0x39, 0xb1, 0x2f, 0x36, 0x39, 0x1c, 0xa2, 0xb6, 0x39,
-  0xed, 0x79, 0xd9, 0x39, 0xe9, 0xca, 0x1c, 0x39, 0xd6, 0xd7, 0xfc, 0x39,
-  0x5b, 0x67, 0x44, 0x39, 0x53, 0x78, 0x47, 0x39, 0x64, 0xdc, 0xe2, 0x39,
-  0xb9, 0x2f, 0x0a, 0x39, 0x7a, 0x01, 0x98, 0x39, 0x31, 0x92, 0x18, 0x39,
-  0x43, 0x74, 0xeb, 0x38, 0xca, 0xea, 0x50, 0x39, 0x47, 0x6a, 0x9c, 0x39,
-  0x51, 0x01, 0x75, 0x39, 0x9f, 0x79, 0xe5, 0x39, 0x86, 0xf8, 0x0e, 0x39,
-  0x14, 0x09, 0x32, 0x39, 0x81, 0x44, 0x1a, 0x39, 0x9b, 0xd8, 0x58, 0x39,
-  0x28, 0xfd, 0xc9, 0x39, 0xa1, 0xd6, 0x23, 0x39, 0xeb, 0xfc, 0xc3, 0x39,
-  0xd3, 0xe9, 0xae, 0x38, 0xdc, 0x86, 0x31, 0x39, 0xc8, 0x4f, 0x59, 0x39,
-  0x9d, 0xbe, 0x05, 0x39, 0xef, 0x97, 0x90, 0x39, 0x1d, 0xde, 0x53, 0x39,
-  0x1e, 0xfe, 0xc2, 0x39, 0xb6, 0xf5, 0x59, 0x39, 0xbf, 0x1d, 0x03, 0x39,
-  0x64, 0xff, 0x51, 0x39, 0xc3, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x31, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64,
-  0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9a, 0xc9, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00,
-  0x0c, 0xc9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xb3, 0x64, 0x59, 0x3b, 0xcd, 0x43, 0x74, 0x3b,
-  0xdc, 0x57, 0x5e, 0x3b, 0x01, 0xcf, 0x54, 0x3b, 0x6d, 0x31, 0x58, 0x3b,
-  0x6b, 0x98, 0x40, 0x3b, 0x73, 0x91, 0x52, 0x3b, 0xd8, 0x94, 0x82, 0x3b,
-  0x8e, 0x9b, 0x60, 0x3b, 0x8f, 0x1c, 0xa1, 0x3b, 0x8b, 0x45, 0x85, 0x3b,
-  0xd3, 0xc4, 0x7c, 0x3b, 0x4f, 0x93, 0x6c, 0x3b, 0xea, 0x6d, 0x47, 0x3b,
-  0xcb, 0x60, 0x83, 0x3b, 0xd2, 0x5b, 0x80, 0x3b, 0x2f, 0x9d, 0x52, 0x3b,
-  0x01, 0xfa, 0xb3, 0x3b, 0x39, 0x14, 0x3f, 0x3b, 0xc7, 0x60, 0x50, 0x3b,
-  0xda, 0xe7, 0xdd, 0x3a, 0x3e, 0xe4, 0x5e, 0x3b, 0x77, 0x70, 0x2f, 0x3b,
-  0x22, 0x62, 0xc9, 0x3b, 0xf3, 0x86, 0x7e, 0x3b, 0xda, 0x1e, 0x8e, 0x3b,
-  0x3d, 0xcd, 0x97, 0x3b, 0x57, 0xdb, 0x6a, 0x3b, 0xe4, 0x29, 0x28, 0x3b,
-  0xdc, 0x1a, 0x98, 0x3b, 0x53, 0x3c, 0x7c, 0x3b, 0x72, 0x3e, 0x92, 0x3b,
-  0xe3, 0xc0, 0x4d, 0x3b, 0x7c, 0x36, 0x12, 0x3b, 0x5f, 0xab, 0x57, 0x3b,
-  0xd4, 0x31, 0x89, 0x3b, 0x32, 0xf2, 0x0a, 0x3b, 0xe4, 0x56, 0x45, 0x3b,
-  0x35, 0x39, 0x7f, 0x3b, 0xe4, 0xd2, 0x27, 0x3b, 0x7a, 0xf4, 0x07, 0x3b,
-  0xe3, 0x01, 0x91, 0x3b, 0xb5, 0x08, 0x0b, 0x3b, 0x5e, 0x8c, 0x47, 0x3b,
-  0x59, 0x35, 0x75, 0x3b, 0x6c, 0x6c, 0x69, 0x3b, 0x76, 0x21, 0x83, 0x3b,
-  0x9f, 0x5e, 0x84, 0x3b, 0xdc, 0xb2, 0x5a, 0x3b, 0x1b, 0xb6, 0x1a, 0x3b,
-  0x35, 0xa3, 0x74, 0x3b, 0x2a, 0xb8, 0x8d, 0x3b, 0xd3, 0xcc, 0x59, 0x3b,
-  0xd8, 0x41, 0x70, 0x3b, 0xf0, 0x28, 0x2a, 0x3b, 0x49, 0xc2, 0x67, 0x3b,
-  0xb0, 0x9f, 0x4e, 0x3b, 0x25, 0x17, 0x85, 0x3b, 0xe0, 0x97, 0x69, 0x3b,
-  0xa1, 0x92, 0x3d, 0x3b, 0xac, 0xe4, 0x86, 0x3b, 0x3c, 0x3d, 0xa2, 0x3b,
-  0xf0, 0xa3, 0x41, 0x3b, 0xb0, 0xa3, 0x88, 0x3b, 0x15, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xfa, 0xcc, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0x03, 0x00, 0x00,
-  0x6c, 0xcc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xde, 0xaa, 0x16, 0x39,
-  0x86, 0x4a, 0x29, 0x39, 0x17, 0x19, 0x1a, 0x39, 0x6c, 0x7d, 0x13, 0x39,
-  0xe8, 0xd5, 0x15, 0x39, 0x1b, 0x7b, 0x05, 0x39, 0xe9, 0xef, 0x11, 0x39,
-  0xa4, 0x00, 0x35, 0x39, 0xdb, 0xaa, 0x1b, 0x39, 0x37, 0x52, 0x5f, 0x39,
-  0x43, 0xbb, 0x38, 0x39, 0x57, 0x2f, 0x2f, 0x39, 0x3c, 0xf6, 0x23, 0x39,
-  0x9e, 0x37, 0x0a, 0x39, 0x57, 0x1b, 0x36, 0x39, 0xe6, 0xeb, 0x31, 0x39,
-  0x0b, 0xf8, 0x11, 0x39, 0x71, 0x78, 0x79, 0x39, 0x0f, 0x6e, 0x04, 0x39,
-  0x55, 0x6b, 0x10, 0x39, 0x76, 0xcb, 0x99, 0x38, 0x62, 0x7a, 0x1a, 0x39,
-  0x67, 0x2e, 0xf3, 0x38, 0x4d, 0x92, 0x8b, 0x39, 0x4e, 0x67, 0x30, 0x39,
-  0x45, 0xff, 0x44, 0x39, 0xa1, 0x6a, 0x52, 0x39, 0x4e, 0xc5, 0x22, 0x39,
-  0xa3, 0x18, 0xe9, 0x38, 0x39, 0xd6, 0x52, 0x39, 0xbc, 0xd0, 0x2e, 0x39,
-  0x75, 0xb6, 0x4a, 0x39, 0xab, 0x99, 0x0e, 0x39, 0x6c, 0xab, 0xca, 0x38,
-  0x00, 0x79, 0x15, 0x39, 0x55, 0x2b, 0x3e, 0x39, 0xd3, 0x98, 0xc0, 0x38,
-  0xd0, 0xc4, 0x08, 0x39, 0xd9, 0xe2, 0x30, 0x39, 0x0b, 0xa0, 0xe8, 0x38,
-  0x71, 0x73, 0xbc, 0x38, 0xab, 0xff, 0x48, 0x39, 0x07, 0xb8, 0xc0, 0x38,
-  0xb9, 0x4c, 0x0a, 0x39, 0xee, 0xf1, 0x29, 0x39, 0x02, 0xc7, 0x21, 0x39,
-  0x8d, 0xc3, 0x35, 0x39, 0x2d, 0x7b, 0x37, 0x39, 0x76, 0x92, 0x17, 0x39,
-  0x1c, 0x73, 0xd6, 0x38, 0xa5, 0x8c, 0x29, 0x39, 0xef, 0x70, 0x44, 0x39,
-  0x08, 0xf3, 0x16, 0x39, 0x78, 0x83, 0x26, 0x39, 0x03, 0xdd, 0xeb, 0x38,
-  0xab, 0x9f, 0x20, 0x39, 0x15, 0x34, 0x0f, 0x39, 0xf3, 0x7a, 0x38, 0x39,
-  0x20, 0xe5, 0x21, 0x39, 0xd2, 0x62, 0x03, 0x39, 0xaf, 0xfa, 0x3a, 0x39,
-  0x5b, 0xe2, 0x60, 0x39, 0x83, 0x34, 0x06, 0x39, 0x4e, 0x66, 0x3d, 0x39,
-  0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xe6, 0xd0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00, 0x52, 0xe1, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xa5, 0x36, 0x23, 0x3c, 0x3b, 0x8d, 0x96, 0x3b,
-  0xf8, 0x99, 0x46, 0x3c, 0x1b, 0xfe, 0x13, 0x3c, 0x87, 0xf4, 0xb7, 0x3b,
-  0xb7, 0x06, 0xcd, 0x3b, 0x32, 0x62, 0xf0, 0x3b, 0xec, 0x4a, 0x17, 0x3c,
-  0xac, 0x50, 0xf4, 0x3b, 0x03, 0x2d, 0x36, 0x3c, 0xbc, 0x37, 0x08, 0x3c,
-  0xde, 0xcb, 0x01, 0x3c, 0x35, 0xaa, 0x69, 0x3c, 0xf6, 0x75, 0xc7, 0x3b,
-  0x5c, 0xcf, 0x9b, 0x3b, 0xa9, 0x31, 0x46, 0x3c, 0x67, 0xea, 0xb9, 0x3b,
-  0x64, 0x0c, 0x24, 0x3c, 0x80, 0x4b, 0xeb, 0x3b, 0x73, 0x5e, 0x10, 0x3c,
-  0x1f, 0x6b, 0x91, 0x3b, 0x23, 0x0f, 0x1b, 0x3c, 0xea, 0xcf, 0x68, 0x3c,
-  0xad, 0x3f, 0x27, 0x3c, 0x0d, 0xe8, 0xc8, 0x3b, 0xa1, 0x60, 0xab, 0x3b,
-  0x2b, 0x04, 0xea, 0x3b, 0x61, 0x29, 0xb8, 0x3b, 0x58, 0xd5, 0xf0, 0x3b,
-  0x96, 0x2a, 0x4a, 0x3b, 0x79, 0x35, 0x00, 0x3c, 0x3a, 0x5f, 0x07, 0x3c,
-  0xc2, 0x48, 0xba, 0x3b, 0x4c, 0x60, 0x9a, 0x3b, 0x55, 0x0c, 0x19, 0x3c,
-  0xe2, 0x9b, 0x09, 0x3c, 0x27, 0xf2, 0xc5, 0x3b, 0x57, 0x65, 0x19, 0x3c,
-  0x72, 0x58, 0xc2, 0x3b, 0x62, 0x53, 0x13, 0x3c, 0x16, 0xd0, 0xde, 0x3b,
-  0xb2, 0x68, 0xec, 0x3b, 0x24, 0x09, 0x16, 0x3c, 0x57, 0xab, 0xdd, 0x3b,
-  0x92, 0xbd, 0x00, 0x3c, 0xfe, 0x46, 0x10, 0x3c, 0x16, 0xbc, 0x70, 0x3b,
-  0x12, 0xc5, 0xae, 0x3b, 0x41, 0x75, 0xe9, 0x3b, 0xbe, 0x86, 0x13, 0x3c,
-  0x69, 0x96, 0xf5, 0x3b, 0x3c, 0x25, 0xf3, 0x3b, 0x39, 0x04, 0xb5, 0x3b,
-  0x19, 0x25, 0xe7, 0x3b, 0xff, 0x7c, 0x0b, 0x3c, 0x0f, 0x2a, 0x0c, 0x3c,
-  0xdb, 0xcf, 0x40, 0x3b, 0xf3, 0xc7, 0xe2, 0x3b, 0x65, 0xb9, 0x0b, 0x3c,
-  0x83, 0x67, 0xa9, 0x3b, 0x9c, 0x0c, 0xe5, 0x3b, 0x94, 0xaf, 0x1e, 0x3c,
-  0xc6, 0xce, 0xef, 0x3b, 0xbe, 0xe0, 0xff, 0x3b, 0xb6, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xea, 0xd4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xe8, 0x03, 0x00, 0x00, 0x5c, 0xd4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0xda, 0x39,
-  0x0a, 0xce, 0x49, 0x39, 0x31, 0x1b, 0x05, 0x3a, 0xe3, 0x5f, 0xc6, 0x39,
-  0x80, 0x94, 0x76, 0x39, 0x88, 0x69, 0x89, 0x39, 0xff, 0x1b, 0xa1, 0x39,
-  0x4f, 0xcc, 0xca, 0x39, 0x8e, 0xbe, 0xa3, 0x39, 0xe9, 0x31, 0xf4, 0x39,
-  0x51, 0x97, 0xb6, 0x39, 0xd1, 0xfb, 0xad, 0x39, 0x3a, 0x9b, 0x1c, 0x3a,
-  0xa3, 0xae, 0x85, 0x39, 0x70, 0xda, 0x50, 0x39, 0x49, 0xd5, 0x04, 0x3a,
-  0x3b, 0x35, 0x79, 0x39, 0x75, 0xe5, 0xdb, 0x39, 0xe8, 0xb2, 0x9d, 0x39,
-  0x6c, 0x84, 0xc1, 0x39, 0x8f, 0xec, 0x42, 0x39, 0xc6, 0xd8, 0xcf, 0x39,
-  0xed, 0x08, 0x1c, 0x3a, 0xa8, 0x2f, 0xe0, 0x39, 0xad, 0xa6, 0x86, 0x39,
-  0x6f, 0xb8, 0x65, 0x39, 0x85, 0xd7, 0x9c, 0x39, 0x58, 0xdb, 0x76, 0x39,
-  0x2b, 0x69, 0xa1, 0x39, 0xd8, 0x7e, 0x07, 0x39, 0x12, 0xdb, 0xab, 0x39,
-  0x1a, 0x75, 0xb5, 0x39, 0xb6, 0xb3, 0x79, 0x39, 0x6a, 0xee, 0x4e, 0x39,
-  0xb6, 0x26, 0xcd, 0x39, 0xb6, 0x74, 0xb8, 0x39, 0xb8, 0xaa, 0x84, 0x39,
-  0x06, 0x9e, 0xcd, 0x39, 0xfa, 0x40, 0x82, 0x39, 0x0b, 0x7b, 0xc5, 0x39,
-  0x48, 0x55, 0x95, 0x39, 0x0c, 0x72, 0x9e, 0x39, 0xfb, 0x1c, 0xc9, 0x39,
-  0x14, 0x91, 0x94, 0x39, 0x80, 0x91, 0xac, 0x39, 0xfb, 0x64, 0xc1, 0x39,
-  0x3e, 0x58, 0x21, 0x39, 0x86, 0x44, 0x6a, 0x39, 0xbd, 0x77, 0x9c, 0x39,
-  0xe3, 0xbf, 0xc5, 0x39, 0xde, 0x98, 0xa4, 0x39, 0xdd, 0xf5, 0xa2, 0x39,
-  0x16, 0xa4, 0x72, 0x39, 0xdd, 0xea, 0x9a, 0x39, 0x9c, 0xf9, 0xba, 0x39,
-  0x97, 0xe1, 0xbb, 0x39, 0xdb, 0x39, 0x01, 0x39, 0x22, 0xfe, 0x97, 0x39,
-  0x92, 0x4a, 0xbb, 0x39, 0x5c, 0x13, 0x63, 0x39, 0x4d, 0x83, 0x99, 0x39,
-  0x4b, 0xb5, 0xd4, 0x39, 0x31, 0xb9, 0xa0, 0x39, 0x72, 0x7e, 0xab, 0x39,
-  0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xf2, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x34, 0x03, 0x00, 0x00, 0x64, 0xd8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4a, 0xb3, 0x4a, 0x3b,
-  0x96, 0xbc, 0x45, 0x3b, 0x95, 0x07, 0x2b, 0x3b, 0xc5, 0x5d, 0x5b, 0x3b,
-  0xc7, 0x75, 0x2b, 0x3b, 0x7b, 0xdd, 0xa1, 0x3b, 0xdc, 0x28, 0x6f, 0x3b,
-  0x6e, 0x79, 0x27, 0x3b, 0xf6, 0x14, 0x18, 0x3b, 0x9d, 0x6c, 0x6d, 0x3b,
-  0xe3, 0xfa, 0x48, 0x3b, 0x10, 0x31, 0x14, 0x3b, 0xc8, 0xd8, 0x45, 0x3b,
-  0x90, 0x74, 0x6b, 0x3b, 0x3c, 0xaf, 0x9d, 0x3b, 0x64, 0x3d, 0x6c, 0x3b,
-  0xb6, 0xab, 0x3b, 0x3b, 0x36, 0x98, 0x92, 0x3b, 0x0f, 0xfb, 0xb0, 0x3b,
-  0xaa, 0x2b, 0x3c, 0x3b, 0x05, 0xd3, 0x53, 0x3b, 0x8e, 0x90, 0x7b, 0x3b,
-  0x12, 0xd6, 0x3b, 0x3b, 0x3a, 0xe5, 0x57, 0x3b, 0x1b, 0xce, 0x55, 0x3b,
-  0x7d, 0xa0, 0x22, 0x3b, 0xa1, 0x2e, 0x72, 0x3b, 0x64, 0x14, 0x6e, 0x3b,
-  0x9e, 0x17, 0x5b, 0x3b, 0xa6, 0x59, 0xaf, 0x3b, 0x95, 0xe6, 0x5c, 0x3b,
-  0xb8, 0x28, 0x8c, 0x3b, 0xe3, 0xc8, 0x83, 0x3b, 0xd6, 0x72, 0x72, 0x3b,
-  0x60, 0x0a, 0x32, 0x3b, 0x2e, 0x2e, 0x6a, 0x3b, 0x09, 0x16, 0x77, 0x3b,
-  0x9a, 0x7a, 0xa0, 0x3b, 0x59, 0x28, 0x65, 0x3b, 0x51, 0x32, 0x74, 0x3b,
-  0x96, 0x4e, 0x8c, 0x3b, 0x72, 0x0a, 0x34, 0x3b, 0xbe, 0x6a, 0x3e, 0x3b,
-  0xc2, 0x09, 0x7c, 0x3b, 0x0e, 0x62, 0x48, 0x3b, 0x3f, 0x54, 0x50, 0x3b,
-  0x59, 0x1f, 0x68, 0x3b, 0x59, 0x9d, 0x5c, 0x3b, 0x6a, 0x62, 0x5c, 0x3b,
-  0x2d, 0x33, 0x52, 0x3b, 0xcf, 0x81, 0x31, 0x3b, 0xef, 0xb5, 0x17, 0x3b,
-  0xc1, 0xdf, 0x5b, 0x3b, 0x98, 0x1f, 0x4a, 0x3b, 0x77, 0xcd, 0x79, 0x3b,
-  0xd2, 0x5f, 0x86, 0x3b, 0x9a, 0xbb, 0x33, 0x3b, 0xf4, 0xbf, 0x5d, 0x3b,
-  0x5d, 0xc2, 0x5f, 0x3b, 0x9f, 0xad, 0x31, 0x3b, 0xb2, 0x38, 0x6f, 0x3b,
-  0xdc, 0x72, 0x85, 0x3b, 0xb3, 0xc6, 0x47, 0x3b, 0x64, 0x75, 0x6b, 0x3b,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x52, 0xdc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xcc, 0x03, 0x00, 0x00, 0xc4, 0xdb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x8e, 0x34, 0x47, 0x39, 0xc3, 0x53, 0x42, 0x39, 0xa5, 0x14, 0x28, 0x39,
-  0x78, 0x95, 0x57, 0x39, 0xf0, 0x80, 0x28, 0x39, 0xff, 0x12, 0x9f, 0x39,
-  0x31, 0x09, 0x6b, 0x39, 0x2f, 0x96, 0x24, 0x39, 0xa9, 0x75, 0x15, 0x39,
-  0x9b, 0x54, 0x69, 0x39, 0xbf, 0x83, 0x45, 0x39, 0xef, 0xa2, 0x11, 0x39,
-  0x78, 0x6f, 0x42, 0x39, 0x3f, 0x65, 0x67, 0x39, 0x34, 0xf7, 0x9a, 0x39,
-  0x9c, 0x2a, 0x68, 0x39, 0x51, 0x6f, 0x38, 0x39, 0x22, 0x11, 0x90, 0x39,
-  0xda, 0xed, 0xad, 0x39, 0x11, 0xed, 0x38, 0x39, 0x03, 0x2c, 0x50, 0x39,
-  0x21, 0x3a, 0x77, 0x39, 0xf2, 0x98, 0x38, 0x39, 0x3f, 0x2c, 0x54, 0x39,
-  0x5a, 0x1e, 0x52, 0x39, 0xa4, 0xd2, 0x1f, 0x39, 0x9e, 0x01, 0x6e, 0x39,
-  0x7d, 0xf9, 0x69, 0x39, 0x87, 0x50, 0x57, 0x39, 0xa4, 0x53, 0xac, 0x39,
-  0x82, 0x17, 0x59, 0x39, 0x0c, 0xbe, 0x89, 0x39, 0x2e, 0x83, 0x81, 0x39,
-  0xa6, 0x44, 0x6e, 0x39, 0x7e, 0xf8, 0x2e, 0x39, 0x7d, 0x24, 0x66, 0x39,
-  0x61, 0xd3, 0x72, 0x39, 0x3c, 0xb6, 0x9d, 0x39, 0xd4, 0x34, 0x61, 0x39,
-  0x6a, 0xfc, 0x6f, 0x39, 0x43, 0xe3, 0x89, 0x39, 0xbb, 0xef, 0x30, 0x39,
-  0x3a, 0x22, 0x3b, 0x39, 0x3e, 0xb1, 0x77, 0x39, 0x8c, 0xed, 0x44, 0x39,
-  0xaa, 0xbc, 0x4c, 0x39, 0xbe, 0x1e, 0x64, 0x39, 0x8a, 0xcf, 0x58, 0x39,
-  0x9f, 0x95, 0x58, 0x39, 0x56, 0x93, 0x4e, 0x39, 0x47, 0x72, 0x2e, 0x39,
-  0x45, 0x18, 0x15, 0x39, 0x36, 0x15, 0x58, 0x39, 0x68, 0xa3, 0x46, 0x39,
-  0xd1, 0x7e, 0x75, 0x39, 0xaf, 0x0e, 0x84, 0x39, 0x3f, 0xa2, 0x30, 0x39,
-  0x22, 0xed, 0x59, 0x39, 0xac, 0xe6, 0x5b, 0x39, 0x56, 0x9d, 0x2e, 0x39,
-  0xc1, 0x18, 0x6b, 0x39, 0xce, 0x25, 0x83, 0x39, 0xdf, 0x54, 0x44, 0x39,
-  0x0f, 0x66, 0x67, 0x39, 0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x34, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x34, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00,
-  0xaa, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf0, 0x1e, 0xb3, 0x3b,
-  0x8d, 0x77, 0x8b, 0x3b, 0xd9, 0x2d, 0xc3, 0x3b, 0xe1, 0x12, 0x9f, 0x3b,
-  0x11, 0xac, 0x16, 0x3c, 0xf4, 0xf6, 0xb1, 0x3b, 0x17, 0xd3, 0xde, 0x3b,
-  0x81, 0x2d, 0x26, 0x3c, 0x11, 0x95, 0x01, 0x3c, 0xfa, 0x55, 0xb0, 0x3b,
-  0x9b, 0x31, 0x1a, 0x3c, 0x6b, 0x09, 0xcb, 0x3b, 0xb2, 0xbf, 0xee, 0x3b,
-  0x51, 0x02, 0xd4, 0x3b, 0xb7, 0x11, 0xd6, 0x3b, 0x89, 0x57, 0x88, 0x3b,
-  0x36, 0x3d, 0x8f, 0x3b, 0xca, 0xfc, 0x0b, 0x3c, 0x41, 0xae, 0x01, 0x3c,
-  0xdf, 0x39, 0x48, 0x3b, 0x9c, 0xe3, 0x06, 0x3c, 0x64, 0x75, 0xe9, 0x3b,
-  0xe5, 0x28, 0x84, 0x3b, 0x0c, 0xa8, 0x96, 0x3b, 0x0c, 0x7e, 0x04, 0x3c,
-  0x4f, 0x24, 0x18, 0x3c, 0xb1, 0xa1, 0xb6, 0x3b, 0xf0, 0x81, 0xcd, 0x3b,
-  0x9d, 0xed, 0x06, 0x3c, 0xd6, 0x6e, 0xb8, 0x3b, 0x25, 0x78, 0x15, 0x3c,
-  0x18, 0xd6, 0xc9, 0x3b, 0xd7, 0xc2, 0xe1, 0x3b, 0x34, 0x22, 0xd8, 0x3b,
-  0x19, 0xa9, 0xe1, 0x3b, 0x50, 0x83, 0xa4, 0x3b, 0x46, 0x43, 0x11, 0x3c,
-  0x1c, 0xa3, 0x96, 0x3b, 0x8c, 0x35, 0x21, 0x3c, 0xb9, 0xbb, 0x1a, 0x3c,
-  0x25, 0x83, 0x2e, 0x3c, 0xa9, 0x79, 0x8c, 0x3b, 0xe8, 0xe3, 0x0c, 0x3c,
-  0x7d, 0xbf, 0xb3, 0x3b, 0x7e, 0x3f, 0xd7, 0x3b, 0x2a, 0x3a, 0xf2, 0x3b,
-  0x46, 0xea, 0xac, 0x3b, 0xad, 0xb0, 0xcd, 0x3b, 0x6f, 0xf0, 0xfd, 0x3b,
-  0xb8, 0x9d, 0xa4, 0x3b, 0x55, 0x0c, 0xbf, 0x3b, 0x6b, 0x5f, 0x1a, 0x3c,
-  0x31, 0x2b, 0x33, 0x3b, 0x02, 0xee, 0x54, 0x3b, 0xf9, 0x2d, 0x07, 0x3c,
-  0x7f, 0x92, 0xb4, 0x3b, 0x37, 0x95, 0x3c, 0x3b, 0x83, 0x9f, 0x23, 0x3c,
-  0x56, 0xdc, 0x88, 0x3b, 0x4c, 0x1d, 0xb3, 0x3b, 0x9c, 0x96, 0xe1, 0x3b,
-  0x94, 0x30, 0x0b, 0x3c, 0xce, 0x7a, 0x5a, 0x3c, 0xbe, 0x0a, 0xad, 0x3b,
-  0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x42, 0xe4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00, 0xb4, 0xe3, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xd5, 0x91, 0x85, 0x39, 0xf9, 0xff, 0x4f, 0x39, 0x52, 0x8b, 0x91, 0x39,
-  0xc2, 0x3d, 0x6d, 0x39, 0x0e, 0xb6, 0xe0, 0x39, 0x1e, 0xb5, 0x84, 0x39,
-  0xca, 0x28, 0xa6, 0x39, 0x0a, 0xd6, 0xf7, 0x39, 0x08, 0x42, 0xc1, 0x39,
-  0x2e, 0x7e, 0x83, 0x39, 0x9a, 0xf6, 0xe5, 0x39, 0x57, 0x67, 0x97, 0x39,
-  0xb3, 0x08, 0xb2, 0x39, 0x21, 0x18, 0x9e, 0x39, 0x68, 0xa1, 0x9f, 0x39,
-  0xd6, 0x56, 0x4b, 0x39, 0x27, 0xa0, 0x55, 0x39, 0xaf, 0xc6, 0xd0, 0x39,
-  0x98, 0x67, 0xc1, 0x39, 0xc7, 0x4e, 0x15, 0x39, 0x26, 0x2c, 0xc9, 0x39,
-  0xcd, 0x16, 0xae, 0x39, 0x18, 0x1a, 0x45, 0x39, 0x0f, 0xb0, 0x60, 0x39,
-  0x17, 0x99, 0xc5, 0x39, 0x2e, 0xe7, 0xe2, 0x39, 0x08, 0x30, 0x88, 0x39,
-  0x02, 0x3f, 0x99, 0x39, 0x12, 0x3b, 0xc9, 0x39, 0xe7, 0x87, 0x89, 0x39,
-  0xd2, 0xea, 0xde, 0x39, 0x2c, 0x82, 0x96, 0x39, 0x5e, 0x59, 0xa8, 0x39,
-  0x80, 0x2b, 0xa1, 0x39, 0x2c, 0x46, 0xa8, 0x39, 0x6c, 0x5a, 0x75, 0x39,
-  0xc9, 0xa4, 0xd8, 0x39, 0xb2, 0xa8, 0x60, 0x39, 0x0e, 0x6d, 0xf0, 0x39,
-  0x97, 0xc4, 0xe6, 0x39, 0x11, 0x22, 0x02, 0x3a, 0xea, 0x80, 0x51, 0x39,
-  0x5f, 0x1f, 0xd2, 0x39, 0x8e, 0x09, 0x86, 0x39, 0x71, 0x82, 0xa0, 0x39,
-  0xb8, 0xa0, 0xb4, 0x39, 0x2c, 0xf1, 0x80, 0x39, 0xdc, 0x61, 0x99, 0x39,
-  0x84, 0x5c, 0xbd, 0x39, 0xce, 0x81, 0x75, 0x39, 0xbc, 0x76, 0x8e, 0x39,
-  0xed, 0x3a, 0xe6, 0x39, 0xf8, 0x9a, 0x05, 0x39, 0xe2, 0xc7, 0x1e, 0x39,
-  0x0e, 0x9b, 0xc9, 0x39, 0xe7, 0xa6, 0x86, 0x39, 0x1d, 0xa0, 0x0c, 0x39,
-  0xae, 0x06, 0xf4, 0x39, 0xe5, 0x1c, 0x4c, 0x39, 0x9c, 0x90, 0x85, 0x39,
-  0x63, 0x38, 0xa8, 0x39, 0x20, 0x96, 0xcf, 0x39, 0x5d, 0xeb, 0x22, 0x3a,
-  0x62, 0x09, 0x81, 0x39, 0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x35, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x4a, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0xbc, 0xe7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x09, 0xa6, 0x2f, 0x3b, 0xfb, 0x44, 0x2a, 0x3b, 0xcf, 0x29, 0xa2, 0x3b,
-  0x3a, 0x45, 0xb3, 0x3b, 0x78, 0xdf, 0x1e, 0x3b, 0xc1, 0xe1, 0x7c, 0x3b,
-  0x41, 0x92, 0xa1, 0x3b, 0xf0, 0xa9, 0x4d, 0x3b, 0xd8, 0xcf, 0x32, 0x3b,
-  0xa5, 0xeb, 0x26, 0x3b, 0xcd, 0xf7, 0x1c, 0x3b, 0xcb, 0xfe, 0x2a, 0x3b,
-  0x0b, 0x6a, 0x98, 0x3b, 0x69, 0xa0, 0x45, 0x3b, 0xa1, 0x48, 0x84, 0x3b,
-  0x24, 0x67, 0x42, 0x3b, 0x5d, 0x55, 0x07, 0x3b, 0x61, 0x9d, 0x77, 0x3b,
-  0xb6, 0xda, 0x11, 0x3b, 0xf7, 0x90, 0x57, 0x3b, 0xee, 0xb7, 0x2e, 0x3b,
-  0x5b, 0x3b, 0x50, 0x3b, 0x70, 0xeb, 0x4c, 0x3b, 0x3b, 0xcb, 0x37, 0x3b,
-  0x97, 0x9f, 0xe7, 0x3a, 0xd5, 0x68, 0x2b, 0x3b, 0x79, 0x0c, 0x85, 0x3b,
-  0xef, 0x00, 0x5d, 0x3b, 0x1c, 0x57, 0x5f, 0x3b, 0x07, 0x91, 0x59, 0x3b,
-  0xe5, 0x47, 0xe6, 0x3a, 0x02, 0x1c, 0x56, 0x3b, 0x1c, 0xd2, 0x3e, 0x3b,
-  0xc6, 0xfd, 0x7b, 0x3b, 0xf4, 0x14, 0x14, 0x3b, 0xf2, 0x56, 0x90, 0x3b,
-  0xb6, 0xd7, 0x4a, 0x3b, 0x9b, 0xaa, 0x30, 0x3b, 0x1f, 0x75, 0x38, 0x3b,
-  0x65, 0x7d, 0x83, 0x3b, 0x48, 0xd0, 0x08, 0x3b, 0xb5, 0x76, 0x18, 0x3b,
-  0x93, 0x70, 0x31, 0x3b, 0x04, 0xcf, 0x74, 0x3b, 0x53, 0x10, 0x6e, 0x3b,
-  0xe2, 0x12, 0x4c, 0x3b, 0x03, 0xd8, 0x43, 0x3b, 0xe5, 0xb6, 0x2d, 0x3b,
-  0xb2, 0x44, 0x94, 0x3b, 0x92, 0x5b, 0x22, 0x3b, 0xc7, 0xf3, 0x4b, 0x3b,
-  0xa0, 0xa3, 0xee, 0x3a, 0x22, 0xcd, 0x0a, 0x3b, 0x50, 0xf8, 0x0e, 0x3b,
-  0x82, 0xc9, 0x4e, 0x3b, 0x81, 0x7d, 0x4d, 0x3b, 0xc2, 0x3c, 0x16, 0x3b,
-  0xe9, 0x57, 0x14, 0x3b, 0xb1, 0x65, 0x4e, 0x3b, 0x23, 0xde, 0x48, 0x3b,
-  0x99, 0x50, 0x3b, 0x3b, 0x95, 0x92, 0x31, 0x3b, 0x6d, 0xba, 0x98, 0x3b,
-  0x63, 0xcd, 0x55, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xaa, 0xeb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xc8, 0x03, 0x00, 0x00, 0x1c, 0xeb, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x78, 0x16, 0x23, 0x39, 0xe4, 0x17, 0x1e, 0x39, 0x1e, 0x91, 0x96, 0x39,
-  0x5b, 0x73, 0xa6, 0x39, 0x03, 0x83, 0x13, 0x39, 0x4b, 0xcc, 0x6a, 0x39,
-  0x66, 0x04, 0x96, 0x39, 0xe4, 0xf4, 0x3e, 0x39, 0x5e, 0x06, 0x26, 0x39,
-  0xdd, 0xfb, 0x1a, 0x39, 0x38, 0xbe, 0x11, 0x39, 0x6a, 0xc4, 0x1e, 0x39,
-  0xd3, 0x83, 0x8d, 0x39, 0x7f, 0x7e, 0x37, 0x39, 0xdf, 0xa5, 0x75, 0x39,
-  0x3e, 0x80, 0x34, 0x39, 0xae, 0x4f, 0xfb, 0x38, 0x58, 0xe8, 0x65, 0x39,
-  0x95, 0x6c, 0x07, 0x39, 0xa2, 0x26, 0x48, 0x39, 0x64, 0x39, 0x22, 0x39,
-  0x4b, 0x57, 0x41, 0x39, 0x03, 0x44, 0x3e, 0x39, 0x8d, 0xa6, 0x2a, 0x39,
-  0x4e, 0x0f, 0xd7, 0x38, 0xdf, 0x26, 0x1f, 0x39, 0x8d, 0x11, 0x77, 0x39,
-  0x10, 0x33, 0x4d, 0x39, 0x76, 0x5e, 0x4f, 0x39, 0x14, 0x02, 0x4a, 0x39,
-  0x30, 0xd0, 0xd5, 0x38, 0x59, 0xcc, 0x46, 0x39, 0xca, 0x2c, 0x31, 0x39,
-  0x9e, 0xf8, 0x69, 0x39, 0x0c, 0x7e, 0x09, 0x39, 0x8c, 0x04, 0x86, 0x39,
-  0x4f, 0x56, 0x3c, 0x39, 0x68, 0x08, 0x24, 0x39, 0x4b, 0x44, 0x2b, 0x39,
-  0x79, 0x2c, 0x74, 0x39, 0x52, 0x0f, 0xfe, 0x38, 0x95, 0x8f, 0x0d, 0x39,
-  0x38, 0xc0, 0x24, 0x39, 0x5a, 0x4d, 0x63, 0x39, 0x23, 0x0a, 0x5d, 0x39,
-  0xf2, 0x7a, 0x3d, 0x39, 0xbd, 0xd6, 0x35, 0x39, 0xbd, 0x4a, 0x21, 0x39,
-  0x60, 0xaa, 0x89, 0x39, 0x52, 0xbf, 0x16, 0x39, 0x10, 0x5e, 0x3d, 0x39,
-  0xe7, 0x92, 0xdd, 0x38, 0x20, 0xe0, 0x00, 0x39, 0xfd, 0xbe, 0x04, 0x39,
-  0xe5, 0xff, 0x3f, 0x39, 0xa2, 0xcb, 0x3e, 0x39, 0x64, 0x7e, 0x0b, 0x39,
-  0x37, 0xbc, 0x09, 0x39, 0x38, 0xa3, 0x3f, 0x39, 0xe4, 0x80, 0x3a, 0x39,
-  0x76, 0xeb, 0x2d, 0x39, 0xcb, 0xdf, 0x24, 0x39, 0x76, 0xce, 0x8d, 0x39,
-  0x59, 0x83, 0x46, 0x39, 0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x36, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x92, 0xef, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xec, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x14, 0xfa, 0x5a, 0x3b, 0xd2, 0xca, 0xac, 0x3b,
-  0x7e, 0x47, 0x65, 0x3b, 0x64, 0x2e, 0x5a, 0x3b, 0x5a, 0x01, 0xc7, 0x3b,
-  0x7a, 0xed, 0x97, 0x3b, 0xbf, 0x8e, 0x7f, 0x3b, 0x0c, 0x1f, 0x37, 0x3c,
-  0x7b, 0xb8, 0xad, 0x3b, 0x3f, 0x47, 0x6e, 0x3b, 0x52, 0x98, 0x5d, 0x3b,
-  0x1c, 0x42, 0xaa, 0x3b, 0xe6, 0xb5, 0x8d, 0x3b, 0x8d, 0x15, 0x3d, 0x3b,
-  0x41, 0xeb, 0x9b, 0x3b, 0x16, 0x72, 0xf8, 0x3b, 0x8a, 0x30, 0x7f, 0x3b,
-  0x1f, 0x33, 0x20, 0x3b, 0xf1, 0x05, 0x27, 0x3b, 0xe1, 0x7d, 0x84, 0x3b,
-  0x3e, 0x2f, 0x74, 0x3b, 0x3c, 0x85, 0x14, 0x3c, 0x5f, 0xe1, 0xa1, 0x3b,
-  0x03, 0x4d, 0xca, 0x3b, 0x54, 0x9a, 0x56, 0x3c, 0x3d, 0x51, 0x82, 0x3c,
-  0xfc, 0x98, 0xa8, 0x3b, 0xb6, 0x13, 0x93, 0x3b, 0xa3, 0xea, 0x8b, 0x3b,
-  0x7a, 0x1e, 0x38, 0x3b, 0xa7, 0x97, 0x9c, 0x3b, 0x77, 0x5b, 0xb6, 0x3b,
-  0xd6, 0xc5, 0x81, 0x3b, 0x73, 0xc2, 0xc1, 0x3b, 0xa9, 0xbe, 0x1d, 0x3c,
-  0x5b, 0xd7, 0xda, 0x3b, 0x8f, 0x97, 0x83, 0x3b, 0xf3, 0x19, 0x4b, 0x3b,
-  0xaf, 0x8b, 0xdb, 0x3b, 0x07, 0x79, 0xde, 0x3b, 0x34, 0xad, 0x96, 0x3b,
-  0x75, 0x47, 0x29, 0x3b, 0x62, 0xeb, 0x58, 0x3b, 0xf4, 0xc3, 0xf5, 0x3b,
-  0xac, 0xd6, 0x8a, 0x3b, 0xf3, 0x29, 0x09, 0x3c, 0x57, 0xb2, 0xa3, 0x3b,
-  0xb9, 0xb6, 0x17, 0x3c, 0xeb, 0xa4, 0xe4, 0x3b, 0xfe, 0x65, 0xad, 0x3b,
-  0x9e, 0xe8, 0x3d, 0x3b, 0xef, 0x0a, 0xc5, 0x3b, 0x10, 0x5f, 0x59, 0x3c,
-  0xbc, 0x78, 0xb4, 0x3c, 0x3f, 0x13, 0xc7, 0x3b, 0x56, 0x59, 0xd5, 0x3b,
-  0x53, 0xcd, 0x1f, 0x3b, 0x7e, 0x92, 0x75, 0x3c, 0xc4, 0x0c, 0x9c, 0x3b,
-  0xca, 0x18, 0xf6, 0x3b, 0x2f, 0x2a, 0x9e, 0x3b, 0x9e, 0x92, 0x9b, 0x3b,
-  0xa5, 0x1d, 0x2c, 0x3b, 0xe9, 0x95, 0xd7, 0x3b, 0xb6, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xaa, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xe8, 0x03, 0x00, 0x00, 0x1c, 0xf3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5a, 0x16, 0xfc, 0x38,
-  0x5b, 0xeb, 0x46, 0x39, 0x47, 0xf9, 0x03, 0x39, 0xdd, 0x2b, 0xfb, 0x38,
-  0x8d, 0x18, 0x65, 0x39, 0x5f, 0xe6, 0x2e, 0x39, 0x81, 0x19, 0x13, 0x39,
-  0x67, 0xcf, 0xd2, 0x39, 0xf3, 0xfc, 0x47, 0x39, 0x53, 0x27, 0x09, 0x39,
-  0xf0, 0x19, 0xff, 0x38, 0x8e, 0x00, 0x44, 0x39, 0x4e, 0x23, 0x23, 0x39,
-  0xb9, 0xac, 0xd9, 0x38, 0xa6, 0x7e, 0x33, 0x39, 0x87, 0x01, 0x8f, 0x39,
-  0x47, 0xe3, 0x12, 0x39, 0x37, 0x6c, 0xb8, 0x38, 0x2a, 0x47, 0xc0, 0x38,
-  0x70, 0x86, 0x18, 0x39, 0xa2, 0x8d, 0x0c, 0x39, 0x3e, 0xfa, 0xaa, 0x39,
-  0x85, 0x5b, 0x3a, 0x39, 0xc7, 0xe3, 0x68, 0x39, 0x4a, 0x0d, 0xf7, 0x39,
-  0xa1, 0x05, 0x16, 0x3a, 0x26, 0x17, 0x42, 0x39, 0xd8, 0x50, 0x29, 0x39,
-  0x9a, 0x12, 0x21, 0x39, 0x74, 0xf5, 0xd3, 0x38, 0x1d, 0x45, 0x34, 0x39,
-  0x3f, 0xee, 0x51, 0x39, 0x26, 0x65, 0x15, 0x39, 0x99, 0x0e, 0x5f, 0x39,
-  0xba, 0x98, 0xb5, 0x39, 0x61, 0xee, 0x7b, 0x39, 0x4b, 0x7d, 0x17, 0x39,
-  0xb4, 0xcf, 0xe9, 0x38, 0xf9, 0xbd, 0x7c, 0x39, 0x4f, 0x0e, 0x80, 0x39,
-  0xac, 0x75, 0x2d, 0x39, 0x01, 0xe0, 0xc2, 0x38, 0x04, 0xb8, 0xf9, 0x38,
-  0x96, 0x76, 0x8d, 0x39, 0xe8, 0xd4, 0x1f, 0x39, 0x5c, 0xe7, 0x9d, 0x39,
-  0xcc, 0x72, 0x3c, 0x39, 0x57, 0xa7, 0xae, 0x39, 0xb3, 0x9b, 0x83, 0x39,
-  0xfd, 0x9d, 0x47, 0x39, 0xb4, 0x9f, 0xda, 0x38, 0x2b, 0xd6, 0x62, 0x39,
-  0x30, 0x3d, 0xfa, 0x39, 0x86, 0xc2, 0x4f, 0x3a, 0x27, 0x2d, 0x65, 0x39,
-  0xc3, 0x9b, 0x75, 0x39, 0x07, 0xf7, 0xb7, 0x38, 0x1e, 0x5a, 0x0d, 0x3a,
-  0x3a, 0xa5, 0x33, 0x39, 0x6b, 0xa7, 0x8d, 0x39, 0x82, 0x14, 0x36, 0x39,
-  0x9c, 0x18, 0x33, 0x39, 0xfe, 0x23, 0xc6, 0x38, 0xe9, 0x2e, 0x78, 0x39,
-  0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x37, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xb2, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x34, 0x03, 0x00, 0x00, 0x24, 0xf7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2f, 0x6a, 0x37, 0x3b,
-  0x5d, 0x61, 0x89, 0x3b, 0x38, 0xf9, 0x42, 0x3b, 0x65, 0x2a, 0x49, 0x3b,
-  0xec, 0x86, 0xa0, 0x3b, 0x13, 0x06, 0xac, 0x3b, 0x60, 0x34, 0xa5, 0x3b,
-  0x5d, 0x1b, 0xa7, 0x3b, 0x78, 0xc0, 0xbb, 0x3b, 0x99, 0x15, 0x97, 0x3b,
-  0xba, 0x01, 0x9b, 0x3b, 0x7c, 0x4f, 0x06, 0x3c, 0x85, 0x81, 0x8a, 0x3b,
-  0x56, 0xb9, 0x68, 0x3b, 0xdd, 0xd9, 0x31, 0x3b, 0x69, 0xfc, 0xbb, 0x3b,
-  0x9c, 0xd3, 0x50, 0x3b, 0x31, 0xe4, 0x27, 0x3b, 0xd5, 0xaf, 0x86, 0x3b,
-  0x78, 0x9a, 0xb2, 0x3b, 0x82, 0x14, 0x6e, 0x3b, 0x78, 0xeb, 0x89, 0x3b,
-  0x87, 0x59, 0x84, 0x3b, 0xf8, 0x4e, 0x72, 0x3b, 0xbe, 0xfd, 0x54, 0x3b,
-  0x0f, 0xe0, 0x62, 0x3b, 0x62, 0x14, 0x8a, 0x3b, 0xf1, 0x5e, 0x8c, 0x3b,
-  0x60, 0xc5, 0x52, 0x3b, 0x0b, 0x52, 0x5e, 0x3b, 0xc7, 0xfa, 0x75, 0x3b,
-  0x0e, 0xc2, 0x1d, 0x3b, 0x45, 0xca, 0x7f, 0x3b, 0xd1, 0xe7, 0x25, 0x3b,
-  0x6d, 0x56, 0x29, 0x3b, 0x72, 0xd4, 0x6b, 0x3b, 0x0b, 0xc3, 0x65, 0x3b,
-  0xfc, 0x2e, 0xae, 0x3b, 0x15, 0xda, 0x82, 0x3b, 0x81, 0xa6, 0x6e, 0x3b,
-  0xa9, 0x79, 0x6d, 0x3b, 0x29, 0x49, 0x86, 0x3b, 0x28, 0x45, 0xb0, 0x3b,
-  0xc9, 0x81, 0x4d, 0x3b, 0xec, 0x6c, 0xb1, 0x3b, 0x4a, 0xe0, 0x83, 0x3b,
-  0x92, 0x74, 0x48, 0x3b, 0xc8, 0xc9, 0x8c, 0x3b, 0x7a, 0x00, 0xb0, 0x3b,
-  0x06, 0xc7, 0xcd, 0x3b, 0x00, 0x1a, 0x9f, 0x3b, 0xc2, 0x0d, 0x1c, 0x3b,
-  0xe4, 0x3f, 0x80, 0x3b, 0x53, 0xf1, 0x23, 0x3b, 0x5e, 0x0e, 0x89, 0x3b,
-  0x61, 0xbc, 0x8f, 0x3b, 0xe4, 0x7b, 0x6a, 0x3b, 0x8a, 0xf0, 0x97, 0x3b,
-  0x42, 0x8c, 0x0d, 0x3b, 0x03, 0x0e, 0x9a, 0x3b, 0x1d, 0xf6, 0x39, 0x3b,
-  0x2e, 0xf6, 0x76, 0x3b, 0x11, 0xc4, 0xc0, 0x3b, 0xeb, 0x69, 0xa9, 0x3b,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x12, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xb0, 0x03, 0x00, 0x00, 0x84, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9c, 0xf7, 0x3d, 0x39,
-  0xc8, 0x49, 0x8e, 0x39, 0x5b, 0xf0, 0x49, 0x39, 0x2a, 0x5a, 0x50, 0x39,
-  0x07, 0x43, 0xa6, 0x39, 0x53, 0x2b, 0xb2, 0x39, 0x43, 0x1b, 0xab, 0x39,
-  0xa5, 0x13, 0xad, 0x39, 0x8f, 0x75, 0xc2, 0x39, 0x58, 0x7b, 0x9c, 0x39,
-  0x59, 0x8b, 0xa0, 0x39, 0xd3, 0x1b, 0x0b, 0x3a, 0x3b, 0x74, 0x8f, 0x39,
-  0xb9, 0x09, 0x71, 0x39, 0x68, 0x34, 0x38, 0x39, 0xa5, 0xb3, 0xc2, 0x39,
-  0x71, 0x49, 0x58, 0x39, 0xa6, 0xe3, 0x2d, 0x39, 0x9e, 0x7f, 0x8b, 0x39,
-  0xe5, 0xfb, 0xb8, 0x39, 0xe1, 0x95, 0x76, 0x39, 0xd2, 0xd8, 0x8e, 0x39,
-  0xf0, 0x13, 0x89, 0x39, 0x03, 0xf7, 0x7a, 0x39, 0xa9, 0x99, 0x5c, 0x39,
-  0xf4, 0xfa, 0x6a, 0x39, 0x32, 0x03, 0x8f, 0x39, 0xb5, 0x62, 0x91, 0x39,
-  0xfd, 0x4c, 0x5a, 0x39, 0x49, 0x43, 0x66, 0x39, 0x65, 0xc4, 0x7e, 0x39,
-  0xd6, 0x64, 0x23, 0x39, 0xce, 0x76, 0x84, 0x39, 0x1d, 0xd5, 0x2b, 0x39,
-  0x1c, 0x63, 0x2f, 0x39, 0x3d, 0x41, 0x74, 0x39, 0x57, 0xf8, 0x6d, 0x39,
-  0xfd, 0x67, 0xb4, 0x39, 0xcb, 0x86, 0x87, 0x39, 0x17, 0x2d, 0x77, 0x39,
-  0x80, 0xf5, 0x75, 0x39, 0x47, 0x15, 0x8b, 0x39, 0x3e, 0x91, 0xb6, 0x39,
-  0x42, 0xd9, 0x54, 0x39, 0x93, 0xc3, 0xb7, 0x39, 0x5e, 0x96, 0x88, 0x39,
-  0xd8, 0x9d, 0x4f, 0x39, 0x5d, 0xd1, 0x91, 0x39, 0x1c, 0x4a, 0xb6, 0x39,
-  0xf8, 0x20, 0xd5, 0x39, 0x12, 0xc9, 0xa4, 0x39, 0xf4, 0xa0, 0x21, 0x39,
-  0xcd, 0xd4, 0x84, 0x39, 0xab, 0xcc, 0x29, 0x39, 0xd2, 0xf3, 0x8d, 0x39,
-  0xec, 0xde, 0x94, 0x39, 0x5f, 0xdc, 0x72, 0x39, 0x1c, 0x5e, 0x9d, 0x39,
-  0xca, 0x9a, 0x12, 0x39, 0xed, 0x8e, 0x9f, 0x39, 0xd5, 0x9a, 0x40, 0x39,
-  0xc7, 0xc8, 0x7f, 0x39, 0x04, 0xa7, 0xc7, 0x39, 0x4c, 0x77, 0xaf, 0x39,
-  0x92, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xe2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x3c, 0x00, 0x00, 0x00, 0x54, 0xfe, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xe7, 0x2d, 0xac, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74, 0x4d,
-  0x75, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x00, 0xb4, 0xfe, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x99, 0xa5, 0x13, 0x3a, 0x22, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66,
-  0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f, 0x31, 0x2f, 0x52,
-  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66,
-  0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-  0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xa8, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x6c, 0xc7, 0x3d,
-  0x17, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
-  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xa8, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-  0xd0, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xe0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x16
-};
-unsigned int sed_coughing_ds_cnn_quantized_tflite_len = 48688;
-const char *sed_coughing_labels[] = {
-  "_silence_",
-  "_unknown_",
-  "coughing",
-};
-unsigned int sed_coughing_labels_num = 3;
-const unsigned char *sed_coughing_model_ptr = sed_coughing_ds_cnn_quantized_tflite;
@@ -1,4068 +0,0 @@
-const unsigned char sed_glass_breaking_ds_cnn_quantized_tflite[] = {
-  0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x30, 0x65, 0x00, 0x00, 0x40, 0x65, 0x00, 0x00, 0x68, 0xbd, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x64, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x9a, 0x9a, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xdc, 0xff, 0xff, 0xff, 0x27, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49,
-  0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00,
-  0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f,
-  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x48, 0x64, 0x00, 0x00, 0x40, 0x64, 0x00, 0x00, 0x20, 0x64, 0x00, 0x00,
-  0x08, 0x64, 0x00, 0x00, 0xec, 0x63, 0x00, 0x00, 0x1c, 0x63, 0x00, 0x00,
-  0x0c, 0x62, 0x00, 0x00, 0xfc, 0x51, 0x00, 0x00, 0xec, 0x50, 0x00, 0x00,
-  0x9c, 0x4e, 0x00, 0x00, 0x8c, 0x4d, 0x00, 0x00, 0x7c, 0x3d, 0x00, 0x00,
-  0x6c, 0x3c, 0x00, 0x00, 0x1c, 0x3a, 0x00, 0x00, 0x0c, 0x39, 0x00, 0x00,
-  0xfc, 0x28, 0x00, 0x00, 0xec, 0x27, 0x00, 0x00, 0x9c, 0x25, 0x00, 0x00,
-  0x8c, 0x24, 0x00, 0x00, 0x7c, 0x14, 0x00, 0x00, 0x6c, 0x13, 0x00, 0x00,
-  0x1c, 0x11, 0x00, 0x00, 0x0c, 0x10, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-  0xf4, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
-  0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
-  0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xae, 0x9b, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x32, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00, 0x12, 0x9c, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
-  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x45, 0xff, 0xff, 0x64, 0x45, 0xff, 0xff, 0x68, 0x45, 0xff, 0xff,
-  0x6c, 0x45, 0xff, 0xff, 0x70, 0x45, 0xff, 0xff, 0x74, 0x45, 0xff, 0xff,
-  0x78, 0x45, 0xff, 0xff, 0x7c, 0x45, 0xff, 0xff, 0x80, 0x45, 0xff, 0xff,
-  0x84, 0x45, 0xff, 0xff, 0x88, 0x45, 0xff, 0xff, 0x8c, 0x45, 0xff, 0xff,
-  0x90, 0x45, 0xff, 0xff, 0x94, 0x45, 0xff, 0xff, 0x66, 0x9c, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x15, 0x01, 0xc6, 0xfd,
-  0xdf, 0xe9, 0x00, 0x33, 0xf7, 0x00, 0x0c, 0xd6, 0xf6, 0x41, 0xe1, 0x1e,
-  0x79, 0xe6, 0x03, 0x0e, 0x17, 0xee, 0x7f, 0x2c, 0x23, 0x18, 0xc2, 0x03,
-  0x72, 0xf2, 0x39, 0x2b, 0xef, 0xf6, 0x76, 0x12, 0x50, 0x01, 0xba, 0xf2,
-  0x41, 0x02, 0x1b, 0xe4, 0xe2, 0xfa, 0x03, 0xc1, 0x26, 0xfa, 0xf0, 0xf2,
-  0x13, 0xf8, 0x1b, 0xba, 0xe8, 0xdc, 0x05, 0x08, 0x0e, 0xe0, 0xfa, 0x2b,
-  0xee, 0x25, 0xdf, 0xfe, 0x15, 0xf3, 0xe3, 0xdc, 0xdb, 0xff, 0x32, 0x12,
-  0x3a, 0x2c, 0xf9, 0x0b, 0x3b, 0x70, 0x7c, 0x7f, 0x06, 0xff, 0x3b, 0x65,
-  0x4d, 0x2b, 0xf9, 0x04, 0xf2, 0x2d, 0xf4, 0x32, 0x1c, 0xef, 0x38, 0x21,
-  0x1f, 0x1d, 0xd3, 0xd4, 0xf7, 0x3e, 0x09, 0x2a, 0x06, 0x0e, 0x17, 0x04,
-  0xf4, 0x2f, 0xee, 0xcc, 0x1b, 0x29, 0xfb, 0xf0, 0xb7, 0xe7, 0x91, 0x3b,
-  0xdc, 0xd7, 0x2e, 0xa1, 0x12, 0x00, 0xbb, 0x9f, 0xc7, 0xbb, 0x05, 0xbe,
-  0x8c, 0xf2, 0xb0, 0xce, 0x30, 0xc1, 0xaf, 0xbd, 0xcd, 0xaf, 0xfc, 0x05,
-  0xf3, 0xf9, 0xf5, 0xbe, 0xeb, 0x1e, 0x44, 0x0c, 0x3f, 0x30, 0xc6, 0xef,
-  0xd5, 0x16, 0x81, 0xbf, 0xe7, 0xc4, 0xa5, 0x37, 0x81, 0xbb, 0x3d, 0x90,
-  0xa4, 0x3f, 0xf8, 0x8c, 0x00, 0x9f, 0xb3, 0xd3, 0xaa, 0xfc, 0xed, 0xff,
-  0xc7, 0x91, 0x09, 0x85, 0x93, 0x81, 0xe3, 0xbc, 0xfe, 0xc8, 0x2d, 0xe0,
-  0xca, 0xce, 0x3d, 0x38, 0xbe, 0x28, 0xbe, 0x08, 0x2a, 0xa7, 0xed, 0xc6,
-  0x15, 0xea, 0xcd, 0xc9, 0xff, 0x27, 0xcd, 0xe1, 0xe7, 0xf2, 0x35, 0x01,
-  0xce, 0xee, 0x2e, 0x3a, 0xca, 0xe4, 0xf7, 0xe6, 0xf3, 0x1a, 0xbf, 0xf3,
-  0x0b, 0xf8, 0x43, 0xee, 0xea, 0x3b, 0xed, 0x13, 0xd9, 0xe1, 0x4a, 0xa8,
-  0xbb, 0x13, 0x81, 0xdc, 0x2a, 0xca, 0xa0, 0xe4, 0xb0, 0xdf, 0x59, 0xfc,
-  0xbd, 0x20, 0xeb, 0xf2, 0x20, 0xd5, 0xc5, 0x3b, 0xe5, 0xcb, 0xf7, 0xdd,
-  0xc1, 0x38, 0xee, 0x24, 0x39, 0xf8, 0xc0, 0x28, 0xce, 0x0f, 0x43, 0xf8,
-  0xd7, 0xdc, 0x03, 0x06, 0x2f, 0x20, 0x16, 0x1f, 0xc6, 0x47, 0x39, 0x27,
-  0xf6, 0xfe, 0xe9, 0x48, 0x42, 0xf9, 0x16, 0x19, 0x7f, 0x4d, 0x46, 0x46,
-  0x3c, 0x3c, 0xfb, 0xff, 0x02, 0xef, 0xfa, 0xee, 0x14, 0x00, 0xf3, 0xfc,
-  0xfb, 0xfd, 0x08, 0xf1, 0xf6, 0x03, 0x00, 0xfe, 0x00, 0xfc, 0xff, 0xfc,
-  0xfb, 0xfe, 0xfb, 0x00, 0xf2, 0xfe, 0x0f, 0xfd, 0x01, 0xee, 0xef, 0x05,
-  0x0a, 0x1a, 0xf5, 0x00, 0xf4, 0x08, 0xfd, 0x07, 0x00, 0xf9, 0xf3, 0x03,
-  0xea, 0xfb, 0x07, 0x06, 0xf8, 0x08, 0xf0, 0xf8, 0xe1, 0xfe, 0x00, 0x06,
-  0x20, 0x0e, 0xf8, 0x28, 0x28, 0x21, 0x37, 0x02, 0x7f, 0x7b, 0x46, 0x25,
-  0x27, 0x29, 0x3b, 0xfc, 0xdb, 0xf1, 0xe9, 0x05, 0x15, 0xd7, 0xe6, 0xe9,
-  0xea, 0xc7, 0xfa, 0x23, 0x22, 0xee, 0xf5, 0xfb, 0xf1, 0x1e, 0xfb, 0xdf,
-  0xd7, 0xea, 0xfb, 0x1f, 0xfb, 0xf8, 0xda, 0xd4, 0xf2, 0xf2, 0xf1, 0xee,
-  0x0c, 0xec, 0xed, 0xfa, 0xf1, 0x11, 0x15, 0x00, 0x28, 0x05, 0xee, 0x14,
-  0xd2, 0xf3, 0x3a, 0x26, 0x0a, 0x05, 0xf7, 0xf3, 0x7f, 0x52, 0x29, 0x36,
-  0xde, 0xf3, 0x35, 0x2b, 0x13, 0xf1, 0x16, 0xd6, 0x3d, 0x1c, 0x0b, 0x0c,
-  0xdc, 0xe5, 0x1c, 0xf4, 0xf6, 0x09, 0x01, 0xff, 0x04, 0xf6, 0xfe, 0x04,
-  0xd9, 0xc4, 0xeb, 0xf4, 0x0a, 0xeb, 0xe2, 0xf2, 0xf6, 0x01, 0x12, 0x08,
-  0x01, 0xe1, 0x18, 0x01, 0x0e, 0x03, 0xe9, 0x0d, 0x15, 0xbf, 0xc4, 0x14,
-  0xcf, 0xcf, 0xca, 0xc2, 0xc6, 0x0e, 0xb4, 0xea, 0xa1, 0xd3, 0xdd, 0x81,
-  0x99, 0xa9, 0xdc, 0x07, 0xee, 0xea, 0x08, 0xee, 0xef, 0xfa, 0xa0, 0xcb,
-  0xd7, 0xb3, 0x21, 0x2c, 0xe1, 0xec, 0xf0, 0xdf, 0xfc, 0xe7, 0x1d, 0x1f,
-  0x00, 0xe6, 0x0a, 0xc9, 0xd8, 0xe3, 0xee, 0xe3, 0x0c, 0xfa, 0x0e, 0xf9,
-  0xc9, 0xec, 0x03, 0xf3, 0xf5, 0xc8, 0xd2, 0xff, 0xe7, 0x05, 0xdf, 0x2c,
-  0xe3, 0x0b, 0x1d, 0x0b, 0x21, 0xfe, 0x17, 0xfb, 0xe5, 0xf6, 0x10, 0x1a,
-  0xd6, 0xf5, 0xf7, 0xf8, 0xf8, 0xef, 0xe3, 0xee, 0x2b, 0x7f, 0x64, 0x41,
-  0x42, 0x40, 0x3d, 0x32, 0x47, 0x13, 0x22, 0x41, 0xd5, 0x24, 0x37, 0x33,
-  0x08, 0xe4, 0xdf, 0x06, 0x14, 0xef, 0xf2, 0xd1, 0x06, 0x17, 0x1d, 0x1d,
-  0xd9, 0xe4, 0xfc, 0xd5, 0xe7, 0xce, 0xf6, 0xbc, 0x65, 0x3d, 0x51, 0x48,
-  0x31, 0x57, 0xdc, 0xe8, 0x0f, 0xc6, 0x10, 0xf6, 0x83, 0xc2, 0xd2, 0xc3,
-  0x0f, 0xc9, 0xb6, 0xdc, 0x2f, 0xf8, 0x25, 0x42, 0x93, 0x0d, 0xbc, 0xf5,
-  0x02, 0xf4, 0x81, 0xc3, 0xd4, 0x9e, 0xf9, 0xb8, 0xd3, 0x05, 0xca, 0xaa,
-  0xc0, 0xb7, 0xbf, 0x4d, 0x02, 0x4c, 0x29, 0x35, 0xd8, 0xee, 0x41, 0xf6,
-  0x16, 0x4f, 0x26, 0xdb, 0x4a, 0xf1, 0xfc, 0x49, 0x53, 0x34, 0x6d, 0x3f,
-  0x7f, 0x61, 0xba, 0xb6, 0xb3, 0xf7, 0xc6, 0xd2, 0xd2, 0xb8, 0xed, 0xf8,
-  0xf8, 0x24, 0x3b, 0xd7, 0x1e, 0x24, 0x15, 0x29, 0x37, 0x01, 0xf4, 0x42,
-  0x0c, 0x38, 0x07, 0x26, 0xf4, 0x02, 0x08, 0xc0, 0x02, 0xff, 0x14, 0x03,
-  0x2a, 0xdf, 0xf7, 0xf2, 0x05, 0x2a, 0x1c, 0xfd, 0xde, 0xd7, 0x1e, 0xec,
-  0xf0, 0xf2, 0xf2, 0xc0, 0xe3, 0x06, 0xe9, 0xc8, 0x77, 0x7f, 0x41, 0x4f,
-  0x47, 0x56, 0x25, 0x2e, 0x39, 0x33, 0x7e, 0x48, 0x02, 0xfc, 0x1c, 0x0f,
-  0x70, 0x6d, 0xf2, 0x02, 0x00, 0xe6, 0x13, 0x0c, 0x00, 0x32, 0xde, 0xf6,
-  0xff, 0x1e, 0xef, 0xfb, 0xfd, 0x01, 0x06, 0xff, 0xed, 0x28, 0xe8, 0xf6,
-  0x28, 0xf8, 0x03, 0x09, 0x03, 0xd9, 0x14, 0xf2, 0x03, 0xeb, 0x13, 0xce,
-  0x05, 0xee, 0xf1, 0xe9, 0xfa, 0xd1, 0xc6, 0xb5, 0x7a, 0x73, 0x56, 0x22,
-  0x2f, 0x68, 0x55, 0x7f, 0x30, 0x35, 0x49, 0x59, 0xfe, 0x22, 0xf5, 0x10,
-  0x11, 0x24, 0x0e, 0x17, 0x0e, 0xf9, 0xf4, 0x43, 0x1a, 0x28, 0x22, 0xf8,
-  0xda, 0xd8, 0xd7, 0xec, 0x01, 0x39, 0x04, 0xe8, 0xea, 0x0a, 0xe8, 0xe0,
-  0x02, 0x04, 0xe7, 0xdf, 0xc3, 0xdd, 0xe1, 0xe3, 0xde, 0xcb, 0x00, 0xea,
-  0x17, 0x0b, 0xfc, 0x2b, 0xdd, 0xed, 0xed, 0xee, 0xfa, 0x22, 0xe9, 0xeb,
-  0xf3, 0x18, 0xdc, 0xe3, 0xe9, 0xe9, 0xef, 0xf3, 0xdf, 0x33, 0xe5, 0xff,
-  0xee, 0xd1, 0xe9, 0x2d, 0xe9, 0xf0, 0x10, 0xe6, 0x21, 0x66, 0x65, 0x0f,
-  0x45, 0x04, 0x72, 0x7f, 0x3f, 0x10, 0x53, 0xfd, 0x28, 0x12, 0xf4, 0xed,
-  0x2b, 0xe3, 0x13, 0xf6, 0xc6, 0xc9, 0x13, 0x0e, 0xf0, 0xf1, 0xe5, 0xff,
-  0xfa, 0xf9, 0xef, 0xd7, 0x06, 0xf5, 0x0c, 0x10, 0xe0, 0x2f, 0xa9, 0x13,
-  0xe8, 0xd5, 0xe5, 0xfe, 0x39, 0xb7, 0x2f, 0xde, 0xd0, 0x03, 0x19, 0xea,
-  0xe9, 0x1f, 0xfa, 0xd0, 0xae, 0xaf, 0xf0, 0xce, 0xbe, 0xdb, 0xe6, 0x11,
-  0x3c, 0x18, 0xb8, 0x2b, 0xc3, 0x08, 0xea, 0xca, 0xb9, 0xc8, 0x24, 0xe8,
-  0x33, 0xdd, 0x2f, 0x36, 0x27, 0x40, 0x17, 0x57, 0xe0, 0xff, 0xd9, 0xca,
-  0x10, 0x0f, 0x67, 0x45, 0x7b, 0x33, 0x3a, 0x7f, 0xcb, 0x0d, 0x22, 0xeb,
-  0x0c, 0x12, 0xec, 0xf1, 0x03, 0x28, 0xfb, 0x34, 0x01, 0x0e, 0x03, 0x12,
-  0x7f, 0x51, 0xb9, 0xb5, 0xf1, 0x0c, 0x17, 0x34, 0x3c, 0x21, 0x5d, 0x45,
-  0x44, 0x63, 0xfc, 0xf8, 0xfe, 0x15, 0x1e, 0x37, 0xd6, 0x01, 0x06, 0xfe,
-  0x09, 0x08, 0xf7, 0xd0, 0xef, 0xe2, 0x0b, 0xef, 0xe9, 0xf0, 0xe9, 0xc9,
-  0xec, 0xeb, 0x05, 0xfb, 0xca, 0xf0, 0xf8, 0xcf, 0xf9, 0xc6, 0xbf, 0xcc,
-  0xcb, 0xb9, 0xf0, 0xe2, 0xcf, 0xed, 0x0b, 0xe0, 0xc2, 0xab, 0xfa, 0x0d,
-  0xc3, 0xb5, 0x81, 0xa2, 0xb8, 0xd2, 0xc7, 0xaf, 0x00, 0xa9, 0x13, 0xbe,
-  0x00, 0xd4, 0x21, 0xda, 0xc7, 0x2b, 0xcf, 0xef, 0x29, 0x19, 0xc0, 0xf4,
-  0xc9, 0xc8, 0xf9, 0xc6, 0xfa, 0xfd, 0xf8, 0xde, 0xcf, 0x25, 0xc8, 0x1b,
-  0xdb, 0x1b, 0x0a, 0xff, 0xf7, 0xff, 0xc0, 0xd2, 0xd8, 0x0f, 0x09, 0x06,
-  0x03, 0xdf, 0xe0, 0xf4, 0x05, 0x12, 0xe8, 0xfd, 0x18, 0xf6, 0xf8, 0xeb,
-  0xcb, 0xc9, 0x08, 0xf7, 0x27, 0x15, 0xe4, 0x16, 0x19, 0x3d, 0x32, 0x1f,
-  0x41, 0x1a, 0x7f, 0x6f, 0x58, 0x67, 0x4d, 0x08, 0x2a, 0x47, 0x1e, 0x23,
-  0x1e, 0xd4, 0x20, 0x27, 0xf1, 0x0c, 0x12, 0xfa, 0x09, 0xf2, 0x0b, 0xdc,
-  0x0c, 0xe0, 0xd9, 0xe6, 0xfc, 0xe4, 0x19, 0xe3, 0x6e, 0x62, 0x2f, 0x3c,
-  0x56, 0xe8, 0x70, 0x3a, 0x46, 0xe4, 0x17, 0xe8, 0x5f, 0x54, 0x49, 0x09,
-  0x5e, 0x7f, 0xd5, 0xe4, 0x18, 0xcf, 0x2e, 0x35, 0xa3, 0x3b, 0xf0, 0x1e,
-  0x49, 0x33, 0xe2, 0xad, 0x9c, 0x09, 0x47, 0x25, 0xb1, 0xa9, 0xb5, 0xac,
-  0xeb, 0x08, 0x8c, 0xbb, 0x06, 0xce, 0xd1, 0xd8, 0x8f, 0xc4, 0xda, 0x03,
-  0x27, 0x01, 0xda, 0xdc, 0xeb, 0xdb, 0x1c, 0x33, 0x21, 0x02, 0xf1, 0x0b,
-  0x0d, 0xb9, 0x26, 0xf5, 0xe2, 0xe7, 0xdc, 0xf4, 0x1d, 0xdb, 0xd3, 0xa6,
-  0xa0, 0x81, 0x3e, 0x09, 0x03, 0xef, 0xe6, 0xcb, 0x37, 0x24, 0x12, 0xf7,
-  0x1a, 0x32, 0x32, 0x01, 0x06, 0x0b, 0xd3, 0xfc, 0x21, 0x2d, 0xfb, 0xd5,
-  0xcc, 0x0f, 0xfe, 0xe0, 0xef, 0xc4, 0xcd, 0xf7, 0xf5, 0xd8, 0xe1, 0xc7,
-  0xc1, 0xcf, 0xec, 0x1c, 0xe3, 0x04, 0xd8, 0xe8, 0x4b, 0x07, 0xfa, 0xe2,
-  0x18, 0x47, 0x0f, 0xff, 0xf5, 0xd0, 0x40, 0xe0, 0x1b, 0x17, 0xae, 0xb9,
-  0xd0, 0xa4, 0xe4, 0x30, 0xde, 0x00, 0xbd, 0xe0, 0xb9, 0x16, 0xfd, 0xed,
-  0xc9, 0xf1, 0x03, 0xdc, 0xb9, 0x0b, 0xc5, 0xe9, 0xa1, 0xb9, 0xb4, 0xb9,
-  0x81, 0xca, 0xe4, 0xd5, 0x05, 0xb0, 0x1e, 0xb3, 0x0b, 0x00, 0xf1, 0x0a,
-  0xeb, 0x09, 0x59, 0x15, 0x6f, 0x6c, 0x2e, 0x46, 0x86, 0x98, 0xeb, 0xf3,
-  0xbf, 0xc8, 0x81, 0xd6, 0xb2, 0xbc, 0xbb, 0xda, 0xda, 0xb7, 0xc4, 0xc1,
-  0x9e, 0xb5, 0xe0, 0xac, 0xc3, 0xbf, 0xdd, 0xf6, 0x00, 0xdf, 0xf3, 0xe7,
-  0xfb, 0xda, 0xef, 0x1d, 0xdb, 0x46, 0x00, 0xf6, 0xde, 0x25, 0x18, 0xe1,
-  0x2b, 0x4a, 0x00, 0x10, 0xde, 0x1a, 0x32, 0x01, 0xf4, 0x06, 0xe4, 0xf9,
-  0x08, 0xef, 0xca, 0x10, 0xfd, 0x02, 0xf9, 0xef, 0x85, 0xf9, 0xd5, 0x81,
-  0xaa, 0xf4, 0xbf, 0x16, 0x15, 0xff, 0x0e, 0x25, 0xb9, 0x13, 0xc5, 0xf2,
-  0x13, 0xd1, 0xd8, 0x05, 0xd9, 0xb7, 0xde, 0xf1, 0xcf, 0xbb, 0xdc, 0xe3,
-  0xfa, 0x4c, 0x99, 0xee, 0x0d, 0xb0, 0xd6, 0xf2, 0xef, 0xab, 0xa6, 0xfc,
-  0xca, 0xc1, 0xff, 0xea, 0xd4, 0xb5, 0xc0, 0xca, 0xfb, 0xc7, 0x0d, 0x29,
-  0x30, 0x29, 0x03, 0xe8, 0x34, 0x4b, 0x36, 0x54, 0x57, 0x60, 0x27, 0x32,
-  0x08, 0x2a, 0x7f, 0x5d, 0x60, 0xff, 0x07, 0x04, 0x5e, 0x2e, 0xf6, 0xe4,
-  0xf1, 0xfb, 0x1d, 0x47, 0x3f, 0x13, 0x27, 0x0f, 0x67, 0x39, 0x61, 0x25,
-  0x4c, 0x3b, 0x30, 0xe9, 0x13, 0x1d, 0x0f, 0xee, 0xe9, 0xdf, 0xf4, 0xb8,
-  0xdb, 0xff, 0x18, 0xd0, 0xd7, 0x19, 0xe9, 0x09, 0x40, 0xeb, 0x03, 0x14,
-  0xef, 0xe1, 0x10, 0xf2, 0x10, 0xdd, 0xf6, 0x27, 0xa9, 0xd7, 0x8b, 0xe1,
-  0x9f, 0x81, 0xff, 0xce, 0x1d, 0xef, 0xcc, 0xd7, 0x26, 0x11, 0xdc, 0x12,
-  0xe4, 0xc8, 0xc6, 0x0a, 0x18, 0x11, 0xc2, 0xb6, 0xb0, 0x0e, 0x00, 0xb4,
-  0xc7, 0xfa, 0xee, 0xb5, 0x2b, 0xd2, 0xcb, 0xe5, 0x00, 0x06, 0xe3, 0x34,
-  0x3f, 0xd3, 0xe1, 0xce, 0x07, 0xcf, 0xf8, 0xf9, 0xd3, 0x17, 0xda, 0x2f,
-  0x30, 0xc7, 0x06, 0xce, 0xe3, 0xca, 0xfa, 0x14, 0xcc, 0xd3, 0xe4, 0xf7,
-  0xfd, 0x05, 0xf2, 0xe3, 0xc2, 0xf7, 0xf6, 0xf7, 0xa8, 0xd1, 0x21, 0x27,
-  0xcc, 0xb4, 0x81, 0xd7, 0xfd, 0xcd, 0xdd, 0xe3, 0xbb, 0xf8, 0xf6, 0x9a,
-  0x05, 0x0a, 0xf0, 0x07, 0xb6, 0xc2, 0xf1, 0xba, 0xbc, 0xe2, 0xb9, 0xda,
-  0xfb, 0xe5, 0xfa, 0xe4, 0xb3, 0xcf, 0x17, 0x08, 0x0e, 0xc1, 0xb4, 0x3c,
-  0xf8, 0xde, 0xc9, 0xb1, 0x25, 0x36, 0xb9, 0xd0, 0xf2, 0x37, 0x30, 0x07,
-  0x01, 0x01, 0x05, 0xfa, 0x06, 0xe6, 0xf1, 0x4e, 0x28, 0x02, 0xe4, 0xfd,
-  0x28, 0x37, 0xf0, 0xff, 0x07, 0x03, 0xfc, 0xf8, 0x2e, 0x6a, 0x7f, 0x62,
-  0x7a, 0x4f, 0x31, 0x19, 0x1f, 0xfa, 0x0a, 0xf4, 0xf2, 0xf9, 0xe5, 0xf4,
-  0xdb, 0xbf, 0x00, 0xd5, 0xdc, 0xc0, 0xae, 0xaa, 0xed, 0x03, 0x02, 0x0d,
-  0xcb, 0x99, 0xfc, 0x26, 0x16, 0xf3, 0xc4, 0xef, 0x81, 0xbb, 0x82, 0x88,
-  0xc8, 0xaa, 0x10, 0xa1, 0xeb, 0xbf, 0xf1, 0xc5, 0x05, 0xc7, 0x14, 0xe7,
-  0x33, 0x13, 0xfc, 0x42, 0xf2, 0xd9, 0x20, 0xea, 0x34, 0xf5, 0x2c, 0xfd,
-  0x35, 0x21, 0x09, 0x38, 0x2a, 0xf4, 0x13, 0x09, 0x15, 0xe3, 0xfe, 0xe9,
-  0x4a, 0x47, 0xf9, 0x4b, 0x07, 0x2c, 0x26, 0x39, 0x47, 0xee, 0xe9, 0xe5,
-  0x48, 0x14, 0x6b, 0x0f, 0x17, 0x14, 0x67, 0x78, 0xe1, 0xb3, 0xec, 0xc3,
-  0xd0, 0x35, 0xec, 0xaa, 0xdc, 0xfc, 0x04, 0xfb, 0xac, 0xbb, 0xc3, 0xa3,
-  0x21, 0x3c, 0x9e, 0x9a, 0xd6, 0xbd, 0xd9, 0xf3, 0x81, 0x8c, 0xec, 0xfb,
-  0xca, 0xc1, 0xb0, 0x05, 0xe7, 0xec, 0xda, 0xcd, 0xc7, 0xfb, 0xed, 0xc1,
-  0xd3, 0x1d, 0x00, 0xd9, 0xd7, 0xc3, 0xbb, 0xd5, 0xb3, 0x03, 0xdb, 0xeb,
-  0xe4, 0xe1, 0x0b, 0xe7, 0x03, 0xd6, 0x16, 0xe0, 0xd1, 0xf4, 0x0a, 0xc4,
-  0xcd, 0x1d, 0x06, 0xd1, 0xe4, 0xf3, 0x11, 0x1d, 0x8f, 0x8f, 0xba, 0x81,
-  0xd0, 0xbb, 0xa4, 0x93, 0xbd, 0x98, 0xe4, 0xd0, 0x00, 0xfc, 0x04, 0xf4,
-  0x0f, 0xe2, 0x0f, 0x1f, 0x18, 0xe0, 0xd6, 0xf4, 0xfc, 0xdf, 0xda, 0x15,
-  0xbd, 0xfb, 0xed, 0x16, 0x0b, 0x00, 0xf8, 0xf3, 0x14, 0x01, 0xff, 0x2a,
-  0x17, 0xfc, 0xe1, 0xfb, 0x0e, 0xf9, 0xe6, 0x2e, 0xdd, 0x0b, 0xd7, 0xd3,
-  0xde, 0xce, 0xe9, 0xe0, 0xba, 0xbf, 0x95, 0xb4, 0xe4, 0xd4, 0xfc, 0xbc,
-  0x8d, 0x81, 0xed, 0xe4, 0xcc, 0x03, 0x83, 0xc8, 0xd7, 0x02, 0xe1, 0xeb,
-  0xfb, 0xc2, 0xe4, 0x1b, 0xe4, 0x0c, 0xeb, 0xbf, 0x1c, 0xe0, 0x19, 0xf5,
-  0xf0, 0x03, 0x30, 0x23, 0x24, 0xcf, 0x06, 0xa9, 0x05, 0xd3, 0x1d, 0xd5,
-  0xaa, 0xa6, 0xb6, 0x17, 0x0b, 0x09, 0x9e, 0xfd, 0xd8, 0x08, 0xe0, 0xf7,
-  0xe1, 0xf1, 0xec, 0x0e, 0xe7, 0x2a, 0x16, 0x0c, 0xdf, 0x1d, 0x15, 0xfb,
-  0x06, 0x0c, 0xd4, 0xe2, 0x08, 0xef, 0x00, 0x1e, 0xd8, 0xef, 0x23, 0x15,
-  0x30, 0x3e, 0xbf, 0xe8, 0x09, 0x47, 0x57, 0x52, 0xc0, 0xfa, 0x2f, 0x38,
-  0x5b, 0x7f, 0xca, 0xb4, 0x1c, 0x31, 0x0b, 0x26, 0xc1, 0xdc, 0xf1, 0x2e,
-  0x25, 0x12, 0xf4, 0xd8, 0x07, 0x17, 0xfa, 0x39, 0x0e, 0xde, 0x05, 0xf9,
-  0xf9, 0x04, 0x23, 0xf3, 0xed, 0x04, 0xf5, 0xf2, 0x12, 0xe8, 0x26, 0x1c,
-  0xe4, 0x38, 0xe9, 0xf7, 0x37, 0x0a, 0xe2, 0x17, 0xe7, 0xe9, 0x1c, 0x3e,
-  0x37, 0x7f, 0xed, 0xc0, 0x32, 0x34, 0xf7, 0x65, 0xf6, 0xe1, 0x07, 0x07,
-  0xdd, 0x23, 0x02, 0xed, 0x13, 0xdf, 0x11, 0x20, 0xf5, 0xe0, 0xf8, 0x01,
-  0xcc, 0x1b, 0xed, 0x05, 0x22, 0x08, 0xcc, 0x00, 0x31, 0x11, 0x32, 0x07,
-  0x3c, 0x4e, 0xea, 0x1e, 0xcb, 0xe2, 0x19, 0x44, 0xdb, 0xb7, 0x11, 0xc6,
-  0xee, 0x16, 0x12, 0xc9, 0x04, 0x32, 0x28, 0x38, 0xe8, 0xfb, 0x28, 0xf9,
-  0xf3, 0x10, 0xe3, 0xc7, 0xbc, 0xae, 0xf3, 0x2b, 0xc1, 0xe0, 0x1e, 0x10,
-  0x42, 0x3e, 0x13, 0x1d, 0x22, 0x0a, 0x38, 0x5f, 0x0b, 0x1b, 0xff, 0x18,
-  0x53, 0x70, 0x3f, 0x10, 0x04, 0x22, 0x78, 0x7f, 0x0a, 0xcf, 0x3f, 0x7f,
-  0x1b, 0x4b, 0xf0, 0xc4, 0xf2, 0x28, 0x12, 0x2c, 0xd8, 0xd6, 0x0d, 0x27,
-  0x37, 0x19, 0xc2, 0xf6, 0xf7, 0x17, 0x00, 0x2d, 0xec, 0xe4, 0x2c, 0x09,
-  0x0d, 0x39, 0xee, 0xd2, 0xfa, 0xf9, 0xf6, 0xfc, 0xea, 0xe7, 0x17, 0x0e,
-  0xdb, 0xdd, 0xed, 0xe5, 0x2a, 0x1f, 0xec, 0xf9, 0x15, 0x01, 0x1e, 0x11,
-  0x05, 0x0b, 0xdc, 0x10, 0xdb, 0x03, 0xed, 0xec, 0xfd, 0x10, 0xc6, 0x12,
-  0x34, 0x69, 0x11, 0xcc, 0xe1, 0x6a, 0x7f, 0x70, 0x53, 0xf2, 0xde, 0x22,
-  0x34, 0x1a, 0x37, 0x24, 0xda, 0xeb, 0x3d, 0x0f, 0xf7, 0x02, 0x01, 0x14,
-  0x1c, 0x24, 0xf8, 0xf5, 0x43, 0x3b, 0x09, 0xfe, 0x0c, 0xee, 0x23, 0x34,
-  0xfa, 0xed, 0x20, 0xeb, 0xfe, 0xe5, 0x19, 0x35, 0xfb, 0xc1, 0xff, 0xe1,
-  0xf9, 0xfe, 0xc8, 0xb7, 0xfd, 0xb0, 0xd6, 0xd8, 0x22, 0xff, 0x8a, 0x10,
-  0x24, 0xd9, 0x15, 0xe2, 0x98, 0xda, 0xba, 0xa8, 0xf4, 0xd8, 0x2c, 0xb9,
-  0x10, 0xfd, 0x05, 0xee, 0xc3, 0x87, 0x8e, 0xa9, 0x3a, 0x89, 0x90, 0x98,
-  0x1c, 0xc0, 0x9d, 0xbd, 0xd3, 0x81, 0xe6, 0x8b, 0xb2, 0xc8, 0xe6, 0xc2,
-  0xc5, 0x22, 0x00, 0xf9, 0x1f, 0x01, 0xed, 0x20, 0xc5, 0xc1, 0x1c, 0x06,
-  0x33, 0x22, 0xf5, 0x0c, 0x35, 0x04, 0x32, 0x0b, 0xe0, 0x1a, 0x2c, 0x20,
-  0x15, 0x07, 0x10, 0xe2, 0x16, 0x12, 0xe9, 0xe6, 0xba, 0xd0, 0xc4, 0xe1,
-  0xc4, 0xc4, 0xfe, 0xe4, 0x22, 0xee, 0xe7, 0xd2, 0xfb, 0x15, 0x06, 0xf7,
-  0x0d, 0x1a, 0x16, 0x17, 0x38, 0x0f, 0x18, 0x04, 0x33, 0x6e, 0x28, 0x39,
-  0x52, 0x7f, 0x4a, 0x37, 0x3c, 0x0f, 0x2e, 0x2e, 0xf0, 0x03, 0x1f, 0x20,
-  0x18, 0x16, 0xe8, 0xed, 0xf9, 0xe7, 0x01, 0x04, 0xfd, 0xea, 0xdb, 0x08,
-  0x09, 0xf2, 0x0d, 0xce, 0xcd, 0xe6, 0xf1, 0xc5, 0x0a, 0xc9, 0x9f, 0x0a,
-  0xfe, 0xc8, 0xf2, 0xfa, 0x99, 0x12, 0x45, 0xfe, 0x11, 0x29, 0x07, 0x3a,
-  0x7f, 0x26, 0x11, 0x35, 0x36, 0x29, 0x4b, 0xf4, 0x11, 0x13, 0x30, 0xc3,
-  0x07, 0xa5, 0xfe, 0xf6, 0x1e, 0xcd, 0xcb, 0xe8, 0xed, 0xfa, 0xed, 0xe6,
-  0xf9, 0xf3, 0x1e, 0xf1, 0x27, 0xef, 0xf7, 0x12, 0xe2, 0x08, 0x35, 0x5b,
-  0x41, 0x7f, 0xa3, 0xad, 0x40, 0x2a, 0x15, 0x6d, 0x86, 0xc0, 0x3f, 0x0a,
-  0x5e, 0x6d, 0xf4, 0xf7, 0xe4, 0xfd, 0x07, 0x53, 0xfd, 0xc8, 0x4c, 0x3e,
-  0x2e, 0x27, 0x28, 0xd0, 0x36, 0xf2, 0x15, 0xfc, 0xfb, 0xfa, 0x19, 0xf2,
-  0x31, 0xbf, 0xe0, 0x2f, 0xe6, 0xf4, 0xd2, 0xca, 0xe4, 0x27, 0xfb, 0x05,
-  0xd9, 0xe4, 0x03, 0xcd, 0xd6, 0xd0, 0xd0, 0x0f, 0x32, 0xe8, 0x56, 0x47,
-  0x23, 0x24, 0x33, 0xd1, 0x40, 0x32, 0x10, 0x2d, 0x4a, 0x12, 0x74, 0x53,
-  0x67, 0x08, 0x2c, 0xe1, 0x2f, 0x7f, 0x5f, 0xe1, 0x21, 0xc4, 0x28, 0x2b,
-  0xfe, 0xda, 0xbd, 0x07, 0x03, 0xde, 0xea, 0xb9, 0xca, 0xd1, 0xbc, 0xae,
-  0xf9, 0xa9, 0x2e, 0xfc, 0xa6, 0xb9, 0xec, 0x1b, 0xda, 0xdd, 0x0a, 0xf6,
-  0xbb, 0xed, 0xf5, 0xec, 0x08, 0xe7, 0xdc, 0xee, 0x00, 0x89, 0x9a, 0x89,
-  0xc0, 0xc8, 0x0f, 0x0c, 0xb3, 0x8b, 0xbb, 0xbe, 0xcb, 0xc1, 0x01, 0x8c,
-  0xaf, 0x97, 0x07, 0xd5, 0xdc, 0x82, 0x9e, 0xc4, 0xe8, 0x07, 0xac, 0xa2,
-  0xe6, 0x81, 0x08, 0xc8, 0xd0, 0x9e, 0x93, 0x04, 0x5e, 0xf1, 0xdb, 0xe6,
-  0xd6, 0xf5, 0x10, 0xf0, 0xdb, 0xb5, 0x10, 0xfd, 0xe2, 0xd3, 0xf6, 0xc8,
-  0x2e, 0xb6, 0xd3, 0xe2, 0x22, 0x0d, 0xab, 0xde, 0xdc, 0xee, 0xe1, 0xd7,
-  0xc0, 0xf2, 0xfc, 0xf2, 0xd7, 0x02, 0xde, 0xf8, 0xa1, 0xc4, 0xec, 0xca,
-  0xae, 0xd4, 0xb6, 0x91, 0xf3, 0xf9, 0x81, 0xc1, 0x28, 0xe6, 0xf8, 0xf4,
-  0xd9, 0xb3, 0xe0, 0xde, 0x07, 0xea, 0xfb, 0xf5, 0xf5, 0xcf, 0xe9, 0xbe,
-  0xb3, 0xcf, 0x08, 0x02, 0xf0, 0xef, 0xce, 0xe4, 0xfd, 0xf2, 0x1f, 0x18,
-  0xcd, 0xe2, 0xf3, 0xdb, 0xde, 0xf4, 0x16, 0xcc, 0xc6, 0x28, 0xe3, 0xb2,
-  0x05, 0x13, 0x05, 0x9a, 0x1c, 0x9a, 0xcc, 0xb4, 0xde, 0xdf, 0x24, 0xad,
-  0xf0, 0xe4, 0x2c, 0xfd, 0xd1, 0xfa, 0xeb, 0xeb, 0xd7, 0xaf, 0xfc, 0xa4,
-  0xe3, 0x96, 0xf2, 0x81, 0x8a, 0xc2, 0xd1, 0x9a, 0xc6, 0xf7, 0xa0, 0x13,
-  0xe2, 0xe0, 0xd6, 0xc4, 0xea, 0xd8, 0xc1, 0xaf, 0xbf, 0xb4, 0x20, 0xfc,
-  0xed, 0xe0, 0x38, 0xe9, 0xf7, 0xf7, 0xdc, 0xc3, 0x67, 0x7f, 0x02, 0x2b,
-  0x3d, 0x48, 0xf1, 0x1c, 0xe0, 0xed, 0xf3, 0x4f, 0x00, 0x40, 0xd5, 0xf4,
-  0x07, 0x1e, 0x02, 0x2b, 0xf6, 0xf8, 0xcf, 0xe9, 0x0c, 0x32, 0xde, 0xfc,
-  0x02, 0xf9, 0xd8, 0x31, 0x1f, 0xe8, 0xcc, 0x01, 0xed, 0x18, 0x08, 0x07,
-  0xb8, 0xd4, 0xea, 0x28, 0xf9, 0xfa, 0xdd, 0xf8, 0x30, 0x2a, 0x1e, 0x20,
-  0x30, 0x10, 0x2f, 0x54, 0x2d, 0x1f, 0x31, 0xfa, 0xe8, 0xc6, 0xeb, 0x0f,
-  0xa6, 0x9a, 0x1a, 0xff, 0x32, 0x0d, 0xbe, 0xb7, 0x05, 0x08, 0x1e, 0x0f,
-  0x12, 0xf1, 0xf5, 0xd2, 0x4b, 0xd9, 0x2e, 0xe0, 0x91, 0xe6, 0xba, 0x1d,
-  0xe5, 0x94, 0xbd, 0xb8, 0xd6, 0x07, 0xf6, 0x8a, 0xe7, 0x9e, 0xe0, 0xd1,
-  0xe1, 0x81, 0xba, 0xfd, 0xd8, 0x36, 0xb9, 0x03, 0xf4, 0xe1, 0x4f, 0x1b,
-  0xdb, 0xc4, 0xdd, 0xee, 0x1e, 0x17, 0x15, 0xe3, 0x0a, 0xec, 0x16, 0x14,
-  0xe7, 0xf2, 0x00, 0xf5, 0xed, 0x12, 0xed, 0x06, 0x27, 0xd3, 0xe5, 0xff,
-  0x2a, 0xf5, 0x2a, 0xe3, 0xce, 0xef, 0x14, 0xf7, 0x7f, 0x0a, 0xf5, 0xea,
-  0x22, 0x17, 0x34, 0x18, 0x00, 0xf2, 0xd9, 0x0c, 0xf8, 0x00, 0x10, 0xf9,
-  0xe8, 0x06, 0xf4, 0xe1, 0xf6, 0xef, 0x01, 0x02, 0xfb, 0xf9, 0xf7, 0x0e,
-  0xf3, 0x0b, 0x11, 0xfa, 0x04, 0x08, 0x0a, 0xf2, 0xc1, 0xb5, 0xec, 0xd5,
-  0xa6, 0x81, 0xdd, 0xff, 0xd0, 0xbf, 0x8d, 0xb6, 0x1d, 0xfe, 0x20, 0x13,
-  0xf6, 0x09, 0xe5, 0xd7, 0xed, 0x1a, 0xe4, 0xca, 0xf4, 0xf9, 0x36, 0x03,
-  0x21, 0xdc, 0xf2, 0x09, 0x26, 0x3b, 0x20, 0xf8, 0x0d, 0x3c, 0x01, 0x05,
-  0xe4, 0x07, 0xf0, 0x02, 0xfc, 0xf7, 0xf1, 0xdf, 0xc5, 0x12, 0xe7, 0xc1,
-  0xf2, 0xaf, 0xfc, 0xf8, 0xcd, 0xeb, 0xe8, 0xf1, 0x9d, 0xc2, 0x04, 0x28,
-  0xf7, 0xeb, 0xcf, 0xfc, 0x11, 0xf0, 0x04, 0x27, 0x38, 0x32, 0x3f, 0x25,
-  0x65, 0x52, 0xfe, 0xd6, 0x29, 0x21, 0xf3, 0x1c, 0xa3, 0x85, 0x99, 0xa3,
-  0xc6, 0x81, 0x2f, 0x16, 0x26, 0xfd, 0xfd, 0xe4, 0x67, 0x1d, 0x09, 0x20,
-  0x06, 0x16, 0x1b, 0x1b, 0xf9, 0x19, 0xd5, 0xeb, 0xde, 0xe2, 0x0c, 0xc1,
-  0xfd, 0xdf, 0xff, 0xd6, 0xc7, 0xf6, 0xd8, 0xb4, 0x92, 0xc8, 0xee, 0x9f,
-  0xec, 0x22, 0x04, 0xe2, 0x2a, 0xdf, 0xde, 0x24, 0x0b, 0x02, 0xd3, 0x27,
-  0x1f, 0x35, 0xcf, 0xcc, 0xe2, 0xe4, 0xef, 0x02, 0xb4, 0x06, 0xd0, 0xb9,
-  0xf2, 0xf9, 0xe9, 0x1a, 0xd9, 0xde, 0x20, 0xd4, 0x26, 0x44, 0x0b, 0x03,
-  0x46, 0x37, 0x69, 0x61, 0x2f, 0x4e, 0x08, 0x5c, 0x58, 0x34, 0x79, 0x7f,
-  0x19, 0x44, 0x38, 0x1e, 0x52, 0x5a, 0x38, 0x2c, 0x7f, 0x49, 0x14, 0x24,
-  0x09, 0x2f, 0x47, 0x26, 0x25, 0x00, 0xee, 0xf6, 0xfb, 0xd3, 0x11, 0xd2,
-  0xfe, 0x0f, 0x13, 0xb6, 0xee, 0xd7, 0x15, 0xf7, 0x15, 0xc0, 0xe7, 0xd6,
-  0x05, 0x02, 0x03, 0x04, 0xe6, 0xef, 0x0e, 0xfb, 0x24, 0xed, 0xc6, 0xf5,
-  0xee, 0xf8, 0xf3, 0xf8, 0xdd, 0xfa, 0xdb, 0xe9, 0x03, 0xef, 0x0e, 0x29,
-  0x0f, 0xf7, 0x23, 0x1f, 0x24, 0x17, 0xed, 0xe4, 0x26, 0xe4, 0x20, 0x23,
-  0xf8, 0xf3, 0xf1, 0xbc, 0xcb, 0x25, 0x21, 0xfa, 0x28, 0xfe, 0x1a, 0xce,
-  0x3d, 0xf0, 0x1c, 0xaa, 0xba, 0x11, 0x30, 0x20, 0xf4, 0xa2, 0xd3, 0x0f,
-  0xf4, 0xc4, 0x0e, 0xae, 0xf1, 0xeb, 0xbf, 0xc4, 0x81, 0xdc, 0xae, 0xbb,
-  0x9c, 0xdf, 0x96, 0xe0, 0xdd, 0xe3, 0xbc, 0xf2, 0x01, 0xc9, 0x9f, 0xe1,
-  0x0e, 0xd7, 0xba, 0xff, 0xeb, 0x15, 0xc3, 0x27, 0x17, 0xf0, 0xb4, 0x2a,
-  0x10, 0xff, 0xa6, 0xb2, 0x1d, 0xad, 0xf3, 0x02, 0xdb, 0xd2, 0x8c, 0x94,
-  0xb8, 0xa4, 0xca, 0xee, 0x02, 0xc6, 0xc8, 0xb8, 0x81, 0xb6, 0xe2, 0xe9,
-  0xe8, 0xbf, 0xb9, 0xec, 0xae, 0xba, 0xe0, 0x22, 0xd8, 0xfc, 0xfe, 0x10,
-  0xf7, 0xe3, 0x04, 0x0e, 0x05, 0xfb, 0xf6, 0x1d, 0xd3, 0x5c, 0xf8, 0x21,
-  0x0e, 0x36, 0x6a, 0x4d, 0x51, 0x02, 0x0d, 0x33, 0x21, 0x1d, 0xdc, 0xec,
-  0x63, 0x37, 0xff, 0x14, 0xf2, 0x45, 0x7e, 0x0f, 0x7f, 0x58, 0xfa, 0x57,
-  0x73, 0x38, 0x25, 0x03, 0xab, 0xf7, 0xda, 0xd0, 0xf0, 0xdc, 0xc7, 0xf3,
-  0xd5, 0xcb, 0xfb, 0xf3, 0xe4, 0x21, 0xfc, 0x21, 0xef, 0xfa, 0xe0, 0xf6,
-  0x06, 0x1b, 0x0e, 0xf3, 0xde, 0x31, 0x22, 0xec, 0x07, 0xdf, 0x0b, 0x16,
-  0xcf, 0xf5, 0xf6, 0x02, 0x1a, 0xd5, 0xd3, 0x08, 0x06, 0xd2, 0xfb, 0xe1,
-  0xf8, 0x14, 0x02, 0x03, 0x39, 0x2e, 0xf8, 0x0e, 0x26, 0x28, 0x0d, 0x15,
-  0x30, 0x07, 0xdc, 0x0a, 0x2a, 0x3e, 0x29, 0x0e, 0xdd, 0xea, 0x6a, 0x7f,
-  0x7e, 0x7b, 0xb0, 0x19, 0x10, 0x4a, 0x7e, 0x3e, 0xd0, 0xed, 0xff, 0x0a,
-  0x24, 0x42, 0xda, 0xb4, 0xfb, 0x22, 0x25, 0xff, 0xd1, 0x03, 0xfa, 0x3b,
-  0x2f, 0x00, 0xf0, 0xeb, 0xeb, 0x27, 0x29, 0xe9, 0x00, 0x0f, 0xfd, 0xf4,
-  0xdb, 0x07, 0xf8, 0xf0, 0x1f, 0xf9, 0xff, 0x14, 0x04, 0xfd, 0x0f, 0x03,
-  0xfb, 0x03, 0x03, 0xf6, 0x0b, 0xf3, 0x14, 0x38, 0xd9, 0xfb, 0x2b, 0x10,
-  0x4d, 0x7f, 0xe6, 0xea, 0x10, 0x00, 0x2f, 0x61, 0xfe, 0xe5, 0x0a, 0xf6,
-  0x06, 0x02, 0xf1, 0xfd, 0x0d, 0x04, 0x0a, 0xf6, 0x03, 0xf9, 0x24, 0xf3,
-  0xff, 0xf7, 0x03, 0xf9, 0xf5, 0x0f, 0xf4, 0xdb, 0x44, 0x18, 0xdd, 0xba,
-  0x81, 0x8d, 0x68, 0x3f, 0xb5, 0xde, 0xd9, 0xba, 0x1a, 0xc8, 0x2a, 0xf1,
-  0xa2, 0xc3, 0x53, 0x03, 0x00, 0xd6, 0xef, 0xca, 0xec, 0xbf, 0xb6, 0x23,
-  0xb2, 0x04, 0xc8, 0xb3, 0x1e, 0x3c, 0xe1, 0xe3, 0xf9, 0xa2, 0x05, 0xf4,
-  0xf2, 0xa3, 0xbb, 0xc4, 0x48, 0x2e, 0xaf, 0xaa, 0xcc, 0x2b, 0x50, 0xdc,
-  0xc9, 0xdb, 0xcd, 0xde, 0x46, 0xcf, 0x2c, 0xe9, 0x3d, 0x69, 0x4d, 0x05,
-  0x56, 0x10, 0x7f, 0x69, 0x63, 0x35, 0x2f, 0x6e, 0x60, 0x60, 0x47, 0x6d,
-  0x3c, 0xdc, 0x39, 0x72, 0x52, 0xe2, 0x45, 0x0b, 0x25, 0xd4, 0xfe, 0xed,
-  0xe1, 0xff, 0xad, 0x16, 0xa6, 0xa5, 0x0c, 0x16, 0xc0, 0xc6, 0x2e, 0xf9,
-  0xa6, 0xbe, 0x00, 0xea, 0x00, 0xfb, 0xa1, 0xa2, 0xcd, 0xfd, 0xb6, 0xbb,
-  0xed, 0xf9, 0xbc, 0xc1, 0x24, 0x26, 0x8e, 0x0f, 0x3e, 0x4a, 0x4a, 0x27,
-  0x21, 0x52, 0x14, 0xef, 0x1e, 0x29, 0x3d, 0x52, 0x22, 0x75, 0x73, 0x40,
-  0x5e, 0x7f, 0x1f, 0x06, 0xfa, 0x3e, 0x16, 0x41, 0xea, 0xe4, 0x33, 0x12,
-  0x5d, 0x1d, 0x1b, 0xe8, 0xfc, 0x2c, 0x18, 0x27, 0xfa, 0x10, 0xda, 0xeb,
-  0x18, 0xef, 0xc4, 0x07, 0xff, 0xed, 0xfb, 0xec, 0xc3, 0x0f, 0xe9, 0x0d,
-  0x09, 0x23, 0x0b, 0xd6, 0x21, 0x26, 0x19, 0xf3, 0x0d, 0xe9, 0x6c, 0x25,
-  0xd8, 0xd5, 0x03, 0xe7, 0x5f, 0x2d, 0xe5, 0x0a, 0xf5, 0x04, 0x7f, 0xdd,
-  0xf1, 0x08, 0x02, 0xeb, 0x26, 0xe2, 0xf5, 0xea, 0xfc, 0xc9, 0x4a, 0xc0,
-  0x04, 0x2c, 0xee, 0xda, 0x20, 0xf4, 0xcf, 0x40, 0x14, 0x09, 0xe6, 0x02,
-  0xef, 0x06, 0xf8, 0xf2, 0x02, 0xf9, 0x1b, 0xec, 0xfa, 0xf6, 0xef, 0x12,
-  0xf3, 0x13, 0xfc, 0x2f, 0xd0, 0xe9, 0xc3, 0xeb, 0xed, 0x02, 0xfc, 0xf5,
-  0xf7, 0x05, 0xff, 0x07, 0xec, 0xfe, 0x00, 0xfe, 0xeb, 0x1c, 0x02, 0xe4,
-  0x12, 0x0f, 0xf4, 0x32, 0xf4, 0xe7, 0x12, 0xf0, 0xf2, 0x7f, 0x22, 0x04,
-  0x1b, 0xef, 0xdd, 0x36, 0x25, 0xf5, 0xff, 0xf2, 0xdb, 0xf4, 0x0d, 0x06,
-  0xe7, 0xf5, 0xeb, 0xea, 0xfd, 0x15, 0x08, 0xfc, 0xec, 0xeb, 0x01, 0x0a,
-  0xf8, 0xfe, 0x00, 0xf9, 0xf4, 0x0e, 0x03, 0xf5, 0xec, 0x49, 0x3e, 0xf9,
-  0x48, 0x0a, 0x67, 0xe7, 0x08, 0x53, 0x58, 0x47, 0x65, 0x79, 0x7f, 0xf7,
-  0xf5, 0x4b, 0xfb, 0x6d, 0x7c, 0xec, 0x03, 0x3e, 0xe8, 0xde, 0x40, 0x02,
-  0xd0, 0x19, 0x1c, 0xaf, 0xd8, 0xd7, 0xfe, 0xb0, 0x0f, 0xf0, 0xc5, 0x03,
-  0x12, 0x36, 0x16, 0xc4, 0xef, 0x10, 0xcb, 0xed, 0x03, 0x14, 0x19, 0xec,
-  0xfd, 0xee, 0x26, 0xde, 0xfa, 0xf0, 0x14, 0xd8, 0xaf, 0xe9, 0x32, 0xd9,
-  0x14, 0xac, 0x88, 0xcc, 0xd1, 0x1b, 0x10, 0x9a, 0xdf, 0xd9, 0x1c, 0x02,
-  0x07, 0xa1, 0xc0, 0x18, 0xf9, 0xe6, 0xd7, 0xb9, 0xa2, 0xc4, 0xc3, 0xa8,
-  0xb6, 0xc7, 0xea, 0x93, 0xca, 0xb6, 0xb9, 0xde, 0xd6, 0x88, 0xa3, 0xbe,
-  0xf3, 0xe9, 0x81, 0x08, 0xc7, 0xeb, 0xf0, 0x95, 0xf3, 0xf4, 0xce, 0xa7,
-  0x9b, 0xe6, 0x99, 0xb4, 0xc6, 0x08, 0xe0, 0x20, 0x72, 0xab, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x44, 0x21, 0x00, 0x00,
-  0x97, 0x80, 0x00, 0x00, 0xf4, 0x35, 0xff, 0xff, 0x93, 0x7e, 0xff, 0xff,
-  0x3e, 0xcd, 0xff, 0xff, 0x3e, 0x17, 0x00, 0x00, 0xe9, 0x17, 0x00, 0x00,
-  0xbb, 0x1e, 0x00, 0x00, 0x82, 0x63, 0xff, 0xff, 0xdc, 0x2f, 0x00, 0x00,
-  0x4e, 0xc3, 0xff, 0xff, 0xc2, 0x14, 0x00, 0x00, 0x0f, 0x41, 0x00, 0x00,
-  0x70, 0x28, 0x00, 0x00, 0xe2, 0x1c, 0x00, 0x00, 0x34, 0xeb, 0xff, 0xff,
-  0x9a, 0x1a, 0x00, 0x00, 0x0e, 0x48, 0xff, 0xff, 0x6a, 0x44, 0x00, 0x00,
-  0x88, 0x1d, 0x00, 0x00, 0x16, 0xc5, 0xff, 0xff, 0x69, 0xb2, 0xff, 0xff,
-  0x15, 0x5c, 0xff, 0xff, 0xc2, 0x76, 0xff, 0xff, 0x55, 0x83, 0x00, 0x00,
-  0x72, 0x6b, 0xff, 0xff, 0x6b, 0x31, 0xff, 0xff, 0x9c, 0x13, 0x00, 0x00,
-  0x53, 0x1f, 0x00, 0x00, 0x67, 0x1e, 0xff, 0xff, 0x17, 0x83, 0xff, 0xff,
-  0x06, 0x4e, 0xff, 0xff, 0xd2, 0x1d, 0x00, 0x00, 0x63, 0x1c, 0x00, 0x00,
-  0xa4, 0x5c, 0x00, 0x00, 0xb6, 0x0e, 0x00, 0x00, 0xf2, 0x24, 0x00, 0x00,
-  0x3f, 0x45, 0xff, 0xff, 0x34, 0x39, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xff,
-  0x07, 0x13, 0x00, 0x00, 0xbb, 0x1a, 0x00, 0x00, 0x90, 0x08, 0xff, 0xff,
-  0x7d, 0x35, 0xff, 0xff, 0x80, 0x3c, 0xff, 0xff, 0xcb, 0x24, 0x00, 0x00,
-  0x01, 0x7e, 0xff, 0xff, 0x97, 0x06, 0x00, 0x00, 0xba, 0xad, 0xff, 0xff,
-  0xa5, 0x03, 0x00, 0x00, 0x49, 0x54, 0x00, 0x00, 0xf7, 0xf7, 0xff, 0xff,
-  0x3c, 0x6d, 0xff, 0xff, 0x71, 0x78, 0xff, 0xff, 0xea, 0x11, 0x00, 0x00,
-  0x27, 0x7c, 0x00, 0x00, 0xa6, 0x19, 0x00, 0x00, 0x8f, 0x88, 0xff, 0xff,
-  0x9e, 0x2a, 0x00, 0x00, 0x17, 0x8e, 0x00, 0x00, 0x8a, 0x05, 0x00, 0x00,
-  0x19, 0x04, 0x00, 0x00, 0xf7, 0x62, 0x00, 0x00, 0x39, 0xfc, 0xfe, 0xff,
-  0x7e, 0xac, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0x62, 0xf4, 0xe9, 0x81, 0x9f, 0x7f, 0xdb, 0x4a, 0xe7, 0xaa, 0xbd, 0x05,
-  0x54, 0x02, 0x07, 0x04, 0xe9, 0x29, 0x04, 0x5e, 0xad, 0xa8, 0x7f, 0x7f,
-  0xe8, 0x70, 0x87, 0xbe, 0xae, 0x7f, 0x63, 0xa3, 0xbe, 0x9a, 0x0c, 0x0b,
-  0xd2, 0xfe, 0xcd, 0x39, 0xad, 0xac, 0xb3, 0xa0, 0x07, 0x7f, 0xe4, 0x7f,
-  0x1d, 0x81, 0xf8, 0x66, 0xf2, 0xfd, 0xb1, 0x6e, 0xe0, 0xdb, 0x06, 0x4d,
-  0x29, 0xc4, 0x07, 0xf1, 0xf4, 0x3e, 0x65, 0xb6, 0x79, 0x62, 0xaa, 0x7f,
-  0xfb, 0x81, 0x4f, 0xe0, 0xe6, 0x4e, 0x3b, 0x38, 0x03, 0x1b, 0xd4, 0xfe,
-  0x36, 0x81, 0xae, 0x53, 0xde, 0x48, 0xb4, 0x4b, 0xdd, 0xc7, 0x72, 0x7e,
-  0xc4, 0x21, 0x20, 0xb1, 0x2a, 0x71, 0x33, 0xe8, 0x7f, 0xcd, 0x9e, 0xc4,
-  0xe8, 0x01, 0x51, 0xf5, 0x8c, 0xb9, 0xae, 0xdc, 0x2d, 0x4f, 0x34, 0xc1,
-  0xf6, 0x08, 0x1e, 0xbe, 0xe2, 0xdc, 0x1f, 0x52, 0x81, 0x44, 0xf4, 0xcc,
-  0xa9, 0xfa, 0xbd, 0xe1, 0x66, 0xa0, 0x8d, 0x7f, 0x98, 0xc1, 0x99, 0x33,
-  0xf0, 0x53, 0x21, 0xee, 0xf9, 0xa4, 0xa8, 0x29, 0xfe, 0x53, 0x81, 0x7f,
-  0x41, 0x13, 0xc2, 0x2f, 0x1a, 0x79, 0xdb, 0x71, 0x58, 0x20, 0x64, 0xac,
-  0xec, 0xe2, 0xdb, 0xf1, 0x81, 0xb1, 0x4a, 0x97, 0x0b, 0xea, 0x81, 0x81,
-  0x2c, 0x6b, 0xc3, 0x81, 0x24, 0x7b, 0xfd, 0x68, 0x08, 0x7f, 0xab, 0xf0,
-  0x64, 0x1f, 0x6b, 0x21, 0x81, 0xd3, 0xa7, 0x66, 0x2f, 0x1c, 0x74, 0x5b,
-  0xdd, 0x81, 0x7a, 0x22, 0x81, 0x81, 0x7f, 0x7f, 0x94, 0x39, 0x1f, 0x40,
-  0xee, 0x13, 0xda, 0xf2, 0x2d, 0x78, 0x6f, 0x0c, 0xf5, 0xe6, 0x81, 0x14,
-  0x54, 0x9b, 0x07, 0xc3, 0xb3, 0x3f, 0x0a, 0x2e, 0xb5, 0x51, 0x8f, 0xed,
-  0xa6, 0xdc, 0xfd, 0xb2, 0x41, 0x55, 0xbe, 0x48, 0xcf, 0x81, 0x30, 0x40,
-  0x7f, 0xff, 0x1d, 0xa7, 0xc3, 0x8f, 0x09, 0x32, 0x2c, 0xad, 0x5d, 0x66,
-  0xbe, 0xcf, 0x88, 0x40, 0xbf, 0xcd, 0x2d, 0x37, 0xaa, 0x9f, 0x31, 0x45,
-  0x4f, 0xde, 0xe2, 0x2b, 0x81, 0xcd, 0xd6, 0xdc, 0xda, 0x53, 0x7e, 0x4d,
-  0x54, 0x07, 0xd2, 0xa4, 0x81, 0x42, 0x81, 0xd3, 0x6d, 0x35, 0x0a, 0x7f,
-  0x0f, 0x17, 0x5b, 0x61, 0xc3, 0xf4, 0x16, 0x2d, 0xf5, 0x7f, 0xae, 0x3b,
-  0x2d, 0x5c, 0x2e, 0x7f, 0xd9, 0xc0, 0xe4, 0x0a, 0xc6, 0x81, 0x26, 0x2a,
-  0x6c, 0x02, 0x61, 0x1a, 0x18, 0xde, 0x7f, 0xde, 0xe0, 0xad, 0x81, 0x0f,
-  0xc5, 0xbc, 0x3a, 0xb3, 0x2c, 0xbd, 0xd9, 0x59, 0xcd, 0x81, 0xea, 0x95,
-  0x8b, 0x4b, 0x7f, 0xf8, 0x1a, 0x7f, 0xed, 0x7f, 0x09, 0x7f, 0x82, 0x7f,
-  0x54, 0xd7, 0x81, 0x82, 0x0c, 0x18, 0x52, 0xbe, 0x81, 0x2b, 0xec, 0x2b,
-  0x79, 0xbd, 0x66, 0xc4, 0x7f, 0x45, 0x6d, 0x02, 0xa4, 0x40, 0x7f, 0xd0,
-  0xdd, 0x39, 0x7f, 0x8f, 0xa3, 0xe6, 0xda, 0x28, 0x2b, 0xf2, 0xf8, 0xdd,
-  0x4a, 0x09, 0x4b, 0x64, 0xba, 0xb9, 0x31, 0x4b, 0xef, 0x31, 0x6f, 0xb1,
-  0xff, 0x66, 0xa3, 0xf4, 0x81, 0xf2, 0x3c, 0xcd, 0xd8, 0xb6, 0x0d, 0x1c,
-  0xe4, 0x08, 0x59, 0xa3, 0x03, 0x7f, 0x21, 0x6a, 0x7c, 0x63, 0x46, 0xb7,
-  0x0f, 0x00, 0xd9, 0x65, 0x6b, 0x68, 0x2c, 0x41, 0xcc, 0x2c, 0x7f, 0x1d,
-  0x3e, 0x29, 0x04, 0x81, 0xe6, 0xe5, 0x42, 0x3c, 0x27, 0xd3, 0x40, 0xf1,
-  0x57, 0xed, 0xc3, 0xb2, 0xf8, 0xfa, 0xdd, 0x7f, 0x1e, 0x02, 0xe0, 0x07,
-  0x87, 0xe9, 0x5a, 0x0e, 0x22, 0x2d, 0xdc, 0xca, 0x8e, 0xe6, 0xee, 0x7f,
-  0x3e, 0xd5, 0x38, 0xca, 0xbb, 0x43, 0xcf, 0x20, 0xcb, 0x7a, 0x95, 0xd9,
-  0xeb, 0xa8, 0xf5, 0x0c, 0xbb, 0x07, 0xc8, 0x19, 0xc1, 0x74, 0xc4, 0x24,
-  0x27, 0xfe, 0xfa, 0x14, 0xd3, 0xf2, 0x0f, 0xf1, 0x58, 0xaa, 0x7e, 0xe3,
-  0x20, 0xe9, 0x81, 0x08, 0x7f, 0x1b, 0x06, 0xd3, 0x81, 0x00, 0xce, 0x56,
-  0xef, 0xc1, 0xe7, 0xcb, 0x81, 0x44, 0x50, 0x17, 0x2c, 0x2b, 0xf8, 0x41,
-  0xc0, 0xed, 0x02, 0x4c, 0x7f, 0x46, 0x31, 0xfb, 0x28, 0x1d, 0x14, 0x33,
-  0xe9, 0xea, 0x9b, 0x93, 0xd9, 0xb0, 0x81, 0x1b, 0x26, 0xf1, 0x0b, 0xa5,
-  0x7f, 0x44, 0x7f, 0xff, 0xee, 0xd0, 0xed, 0x3b, 0xd4, 0xe9, 0x0b, 0xee,
-  0xca, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xcd, 0x01, 0x00, 0x00, 0x9d, 0x08, 0x00, 0x00, 0x5e, 0xe2, 0xff, 0xff,
-  0xaa, 0x08, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0xed, 0xff, 0xff, 0xff,
-  0xf1, 0x07, 0x00, 0x00, 0xb2, 0xeb, 0xff, 0xff, 0x76, 0xee, 0xff, 0xff,
-  0x1e, 0x13, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x75, 0xfd, 0xff, 0xff,
-  0x18, 0x0c, 0x00, 0x00, 0x48, 0x0a, 0x00, 0x00, 0xfc, 0xfe, 0xff, 0xff,
-  0x2c, 0xe9, 0xff, 0xff, 0x9a, 0x11, 0x00, 0x00, 0x6b, 0x0e, 0x00, 0x00,
-  0x33, 0xf5, 0xff, 0xff, 0x8e, 0xf7, 0xff, 0xff, 0xc6, 0x0c, 0x00, 0x00,
-  0x53, 0x0d, 0x00, 0x00, 0xb8, 0xf4, 0xff, 0xff, 0xad, 0xea, 0xff, 0xff,
-  0x5e, 0x09, 0x00, 0x00, 0xa9, 0xee, 0xff, 0xff, 0x8c, 0x18, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x52, 0x10, 0x00, 0x00, 0x7f, 0xef, 0xff, 0xff,
-  0x8c, 0xe2, 0xff, 0xff, 0xa0, 0xf0, 0xff, 0xff, 0xd6, 0xf9, 0xff, 0xff,
-  0xe2, 0xfa, 0xff, 0xff, 0x1a, 0x03, 0x00, 0x00, 0x82, 0xfe, 0xff, 0xff,
-  0xcc, 0x00, 0x00, 0x00, 0x9e, 0xee, 0xff, 0xff, 0x6d, 0x05, 0x00, 0x00,
-  0x98, 0x01, 0x00, 0x00, 0x2d, 0xfd, 0xff, 0xff, 0xdb, 0xfb, 0xff, 0xff,
-  0x10, 0x18, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0xae, 0x06, 0x00, 0x00,
-  0xeb, 0xfa, 0xff, 0xff, 0xf1, 0xf9, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff,
-  0xae, 0x12, 0x00, 0x00, 0x2b, 0x0d, 0x00, 0x00, 0xd5, 0x0d, 0x00, 0x00,
-  0x26, 0xff, 0xff, 0xff, 0xba, 0xe8, 0xff, 0xff, 0x38, 0xe0, 0xff, 0xff,
-  0xe2, 0x00, 0x00, 0x00, 0xd1, 0xfb, 0xff, 0xff, 0xe6, 0xfb, 0xff, 0xff,
-  0x6f, 0xf9, 0xff, 0xff, 0x10, 0xf4, 0xff, 0xff, 0x27, 0xea, 0xff, 0xff,
-  0x16, 0x00, 0x00, 0x00, 0xad, 0xfe, 0xff, 0xff, 0xdb, 0xf9, 0xff, 0xff,
-  0xda, 0x0a, 0x00, 0x00, 0xd6, 0xaf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0xb5, 0x14, 0xd0, 0xd0, 0x5f, 0x30, 0xeb, 0xbb,
-  0xb0, 0x37, 0xf3, 0xe0, 0xa7, 0x83, 0xbd, 0x19, 0x49, 0x38, 0x04, 0xf2,
-  0xcd, 0x41, 0x47, 0xd0, 0x4e, 0x17, 0xd1, 0xd2, 0xdd, 0xe7, 0xfc, 0xe8,
-  0x81, 0xe0, 0xc5, 0xc2, 0xf0, 0x1f, 0x48, 0xaf, 0x35, 0x3b, 0xde, 0xf0,
-  0x04, 0xd0, 0xfb, 0x97, 0xc5, 0xd6, 0xcf, 0xcd, 0x2d, 0xc7, 0x91, 0xac,
-  0x5a, 0xf6, 0xdc, 0xcb, 0xd9, 0xe0, 0xe3, 0xea, 0x95, 0xad, 0x52, 0xba,
-  0x00, 0x0e, 0x19, 0x8e, 0xf0, 0x63, 0x24, 0x06, 0xd6, 0x20, 0xe7, 0x3d,
-  0x63, 0xfa, 0x5e, 0xbd, 0xa6, 0xa0, 0x5c, 0x07, 0xc4, 0x54, 0x17, 0x73,
-  0xf1, 0x95, 0x96, 0x1d, 0xda, 0x85, 0x28, 0x6b, 0x3b, 0x87, 0x21, 0x09,
-  0x1a, 0xc6, 0x05, 0x56, 0x43, 0x99, 0xb1, 0xe8, 0xdc, 0x1f, 0x53, 0x93,
-  0x0a, 0x27, 0x40, 0x8e, 0x52, 0xe7, 0x3b, 0xe6, 0x2c, 0x7f, 0xe0, 0xfe,
-  0x04, 0x16, 0x4b, 0x63, 0x2f, 0xf4, 0x33, 0xc8, 0x1a, 0x21, 0xe8, 0x4d,
-  0xc5, 0x9f, 0x2f, 0x05, 0x1f, 0xcb, 0x09, 0x01, 0x30, 0xf4, 0x21, 0x17,
-  0xfa, 0x37, 0x49, 0xb8, 0x70, 0xf4, 0xcd, 0xf5, 0x97, 0xba, 0x10, 0x1c,
-  0xea, 0xad, 0xfa, 0xea, 0x01, 0x32, 0xce, 0x07, 0xdc, 0xf6, 0xc9, 0x8b,
-  0x7f, 0x9c, 0x36, 0xf2, 0xf8, 0xb8, 0xc9, 0x26, 0xd6, 0xbf, 0x52, 0x02,
-  0xed, 0xde, 0x4b, 0xe7, 0xa8, 0x61, 0xc9, 0x52, 0x58, 0x59, 0x29, 0x1a,
-  0x18, 0x2a, 0x1f, 0x01, 0xd5, 0xae, 0xda, 0xb4, 0xac, 0xca, 0x93, 0xed,
-  0xb9, 0x33, 0x54, 0xf4, 0xf2, 0x40, 0xdb, 0xa6, 0xad, 0xf4, 0xc7, 0x40,
-  0xa3, 0xd5, 0xb1, 0x54, 0x35, 0xe1, 0xcd, 0xfa, 0x1e, 0x31, 0xb9, 0xb1,
-  0x20, 0xa7, 0x01, 0x10, 0x7b, 0xa2, 0x37, 0x81, 0xcc, 0x11, 0xf6, 0xde,
-  0xa0, 0xad, 0x16, 0x98, 0x48, 0xf4, 0xad, 0x53, 0xe7, 0xcd, 0x13, 0xc8,
-  0xee, 0xce, 0xef, 0x22, 0x44, 0x51, 0xe9, 0xd8, 0xd3, 0xef, 0x27, 0xb4,
-  0x31, 0xec, 0x45, 0xe9, 0xa8, 0x47, 0xda, 0xc3, 0xcb, 0xc7, 0x47, 0xae,
-  0xba, 0x4a, 0xe9, 0xbf, 0x8e, 0x94, 0x0c, 0xa4, 0xe4, 0xe0, 0x1d, 0xdf,
-  0x5b, 0x00, 0xb3, 0xc2, 0x19, 0xa0, 0xf6, 0x5e, 0x1d, 0x42, 0x0d, 0x7f,
-  0x36, 0x3e, 0xca, 0x4a, 0xb8, 0xae, 0x1e, 0xca, 0xab, 0xa5, 0x25, 0x21,
-  0x42, 0x09, 0x53, 0xce, 0x28, 0x27, 0x81, 0xaf, 0x25, 0xc9, 0x12, 0x20,
-  0xdc, 0x19, 0x17, 0xff, 0x31, 0x25, 0xea, 0x6c, 0xb1, 0xef, 0xfb, 0x45,
-  0xb0, 0xe1, 0x5c, 0x48, 0x1a, 0x2a, 0xb6, 0x45, 0x73, 0x94, 0xc7, 0xd5,
-  0x40, 0xfe, 0x40, 0xf4, 0x16, 0xf0, 0x17, 0xde, 0x26, 0xfa, 0x4f, 0x71,
-  0x24, 0x12, 0xbf, 0x01, 0xff, 0xac, 0x18, 0x02, 0xee, 0x17, 0x15, 0x43,
-  0x07, 0x29, 0xfd, 0xde, 0xb8, 0xd1, 0xe4, 0x1d, 0x1d, 0x2d, 0xe7, 0x42,
-  0xb1, 0x1b, 0x15, 0x2d, 0xe3, 0x4d, 0x34, 0x33, 0x5e, 0x5f, 0x47, 0x73,
-  0x40, 0xfd, 0x2a, 0x27, 0xa9, 0x12, 0x38, 0x27, 0x4b, 0xab, 0xc0, 0x07,
-  0x57, 0x8d, 0xe1, 0x9d, 0xf5, 0xea, 0xfb, 0xd4, 0xf9, 0xfd, 0xab, 0xc8,
-  0xab, 0xd8, 0xf4, 0x2c, 0xd7, 0x00, 0xcc, 0x31, 0xe1, 0xd4, 0x0e, 0xe8,
-  0x81, 0x4d, 0x57, 0xde, 0x02, 0xa2, 0xee, 0xfe, 0x31, 0xf6, 0x37, 0xde,
-  0xb8, 0xf5, 0x0e, 0xc8, 0x34, 0xe8, 0xdd, 0x03, 0xf4, 0xe3, 0xc0, 0x28,
-  0x0e, 0xed, 0x25, 0x14, 0xff, 0x43, 0x37, 0xeb, 0x27, 0x2d, 0x38, 0xdb,
-  0x13, 0xd2, 0x16, 0xeb, 0x7f, 0x28, 0xcd, 0x0f, 0xd7, 0x0c, 0xd4, 0x49,
-  0xf4, 0xdb, 0xd9, 0x06, 0x00, 0xe3, 0x19, 0xd8, 0x0e, 0x2b, 0xf9, 0x3c,
-  0xda, 0x26, 0x37, 0x09, 0x18, 0xc7, 0x02, 0xf7, 0x33, 0x0f, 0xdb, 0x23,
-  0xb4, 0x40, 0x3b, 0xfc, 0xc1, 0x38, 0x1e, 0x81, 0x5e, 0x50, 0xc3, 0xfd,
-  0xc3, 0xf0, 0x3a, 0x26, 0xa3, 0xf2, 0xbc, 0x9e, 0xd3, 0x5c, 0xe5, 0x1c,
-  0xe9, 0xe8, 0xe1, 0xed, 0xd1, 0x07, 0x00, 0x03, 0x3c, 0x21, 0x5f, 0x41,
-  0xce, 0xb4, 0x55, 0xdd, 0xe0, 0xc1, 0xed, 0xb5, 0xd4, 0x4a, 0xf2, 0x3c,
-  0xec, 0x17, 0xc8, 0x0d, 0xbd, 0xf1, 0x39, 0xa5, 0x08, 0x4d, 0xfa, 0xe9,
-  0x4a, 0x33, 0xec, 0x1b, 0x9b, 0xc1, 0x3a, 0xe5, 0xc7, 0x9b, 0x3c, 0xe6,
-  0xcb, 0x60, 0x01, 0x81, 0x18, 0x04, 0x49, 0x15, 0x6b, 0x33, 0xba, 0x2c,
-  0xcd, 0x62, 0xf8, 0x63, 0x52, 0x4e, 0x21, 0x9c, 0x93, 0xde, 0xb3, 0xe4,
-  0x6d, 0x38, 0xa9, 0xb9, 0xae, 0xab, 0xcb, 0xd5, 0xae, 0x03, 0xd3, 0xa0,
-  0x25, 0xaf, 0x0f, 0xd2, 0x06, 0x22, 0xb2, 0x21, 0x05, 0x27, 0xbc, 0x46,
-  0xff, 0x1f, 0x1c, 0x22, 0xa2, 0x02, 0xc2, 0xd0, 0x07, 0xf3, 0xe0, 0x62,
-  0x58, 0xcf, 0x1f, 0xe4, 0x41, 0x1a, 0x4f, 0x0e, 0x06, 0x3b, 0xd9, 0x48,
-  0x14, 0xfc, 0xaa, 0x23, 0xfe, 0xd4, 0x53, 0xfe, 0x31, 0xe4, 0xc9, 0x1f,
-  0xc0, 0x49, 0x7f, 0xc6, 0xc0, 0x26, 0xf4, 0x23, 0xc9, 0x70, 0xd9, 0x12,
-  0x43, 0x09, 0xb0, 0x6a, 0xcd, 0xcb, 0x09, 0xf6, 0xf0, 0x9e, 0x1c, 0xf3,
-  0xdf, 0xdd, 0xc7, 0x0b, 0x15, 0x76, 0xd3, 0xa2, 0xe6, 0x55, 0xe4, 0x2a,
-  0x57, 0x3c, 0xb9, 0xd6, 0xc3, 0xa3, 0xad, 0xb2, 0x98, 0x2d, 0xdb, 0x81,
-  0x1d, 0x36, 0x0d, 0x65, 0xe7, 0x00, 0x4a, 0xdb, 0x53, 0x55, 0x2d, 0x11,
-  0x5c, 0x50, 0xe1, 0xb0, 0xd4, 0xb5, 0x1c, 0xe2, 0x47, 0xf3, 0x5c, 0xd0,
-  0xd4, 0xd9, 0xc5, 0xe1, 0xab, 0x55, 0xdf, 0x77, 0xaa, 0x1d, 0x56, 0x10,
-  0x71, 0xa1, 0xa6, 0x16, 0x4c, 0xcc, 0xc1, 0x19, 0xba, 0xfe, 0x85, 0xf4,
-  0xda, 0xf9, 0x90, 0x56, 0x0d, 0xe0, 0xc6, 0xc8, 0xfa, 0x05, 0xbb, 0x0e,
-  0xc7, 0x5b, 0xc8, 0x0a, 0x5d, 0x7f, 0xc7, 0xdc, 0xe7, 0x01, 0x2c, 0xca,
-  0xf7, 0xc6, 0xf7, 0xcd, 0x0c, 0x2e, 0xab, 0x9d, 0xe3, 0xc8, 0x09, 0xd4,
-  0x0b, 0x1e, 0xf9, 0x52, 0x2b, 0x75, 0xb2, 0x76, 0x39, 0x04, 0xb9, 0xf9,
-  0x1a, 0xd6, 0xaf, 0x7c, 0x22, 0x4d, 0xe9, 0x62, 0xf4, 0x0d, 0x18, 0xf7,
-  0x64, 0x05, 0xcb, 0x48, 0x1a, 0x48, 0x59, 0xfa, 0x4b, 0x16, 0xcc, 0x0d,
-  0x39, 0x33, 0x35, 0xd9, 0xd0, 0xba, 0xdd, 0xef, 0xd4, 0x0c, 0xd8, 0xbb,
-  0xba, 0xfa, 0x4f, 0x44, 0xe9, 0xb1, 0x3d, 0xcc, 0x0d, 0xf7, 0xb6, 0xe9,
-  0x00, 0x20, 0x5f, 0x2c, 0x48, 0x3e, 0xe9, 0x03, 0x40, 0xfb, 0xc0, 0x3b,
-  0xc5, 0x02, 0x28, 0xfe, 0x30, 0x06, 0x3c, 0x1c, 0x16, 0xfb, 0x1f, 0xdb,
-  0x4a, 0xe4, 0xfe, 0xf9, 0x7f, 0x35, 0x53, 0xe3, 0xdb, 0x19, 0xbc, 0x1e,
-  0xc9, 0x99, 0x60, 0x29, 0xf2, 0xda, 0x41, 0x4b, 0x95, 0xd6, 0xfd, 0xf6,
-  0xdd, 0x39, 0x94, 0x07, 0x96, 0x5d, 0x35, 0xfa, 0x0a, 0xfe, 0xb8, 0xd7,
-  0x50, 0x5f, 0x00, 0xc3, 0x22, 0x76, 0x0c, 0xa7, 0xc7, 0x4a, 0x39, 0x99,
-  0xf4, 0xd4, 0x6e, 0xaa, 0x08, 0x4b, 0x88, 0xa1, 0x6f, 0xb1, 0xa7, 0x97,
-  0x5a, 0x0c, 0x18, 0x49, 0xfd, 0x1b, 0xab, 0xbc, 0xef, 0xfe, 0x52, 0xbf,
-  0x74, 0x81, 0xda, 0x49, 0x54, 0xd2, 0xf1, 0xea, 0x91, 0x5e, 0x8a, 0x81,
-  0x22, 0x67, 0xa3, 0xdb, 0x8d, 0xe8, 0x91, 0x90, 0x0b, 0xe6, 0xc8, 0x12,
-  0x5c, 0x2b, 0xfe, 0xa1, 0x01, 0x23, 0xa8, 0x5c, 0x1c, 0x02, 0xf3, 0x9d,
-  0xe6, 0xbc, 0x19, 0x58, 0x19, 0x29, 0xc0, 0x10, 0x5b, 0x67, 0xc4, 0xb0,
-  0xd1, 0xbc, 0xb1, 0x13, 0xff, 0x79, 0xf5, 0xfd, 0x49, 0xa0, 0xce, 0x51,
-  0xd2, 0xe4, 0xcb, 0x8a, 0x86, 0x0d, 0xce, 0x45, 0x69, 0x33, 0xa4, 0x3c,
-  0x50, 0x15, 0xe1, 0x23, 0xe6, 0xa6, 0x22, 0x3e, 0xe9, 0x36, 0xe8, 0x3f,
-  0x44, 0xfc, 0x01, 0xb4, 0xc1, 0x32, 0xd3, 0x52, 0xc7, 0x15, 0xcd, 0xa0,
-  0xd1, 0xc3, 0xf6, 0x4f, 0xae, 0x96, 0x17, 0x26, 0xd8, 0xe5, 0x47, 0x1b,
-  0x81, 0xd0, 0xae, 0xf0, 0x45, 0xb9, 0xfc, 0xc2, 0xf4, 0xb8, 0x25, 0x29,
-  0xb6, 0x03, 0xb2, 0x18, 0xb1, 0xf1, 0x07, 0xb5, 0xc4, 0xfb, 0xdf, 0xbf,
-  0xd3, 0xd1, 0xe9, 0xd5, 0xf5, 0x9a, 0xf8, 0xda, 0x1b, 0x29, 0xe9, 0xff,
-  0xcc, 0x10, 0x27, 0xdb, 0xed, 0xd3, 0x25, 0xa6, 0xfb, 0x30, 0xf9, 0xf8,
-  0x27, 0x2e, 0x4d, 0x1a, 0x15, 0x22, 0x0a, 0x03, 0xc2, 0xca, 0x22, 0xb8,
-  0xdc, 0x14, 0xa5, 0x41, 0xbd, 0xb4, 0x1f, 0xf5, 0xe6, 0xef, 0xce, 0x27,
-  0x3f, 0xea, 0xf4, 0xc8, 0x32, 0xc0, 0x15, 0xf2, 0x31, 0x0d, 0x81, 0xca,
-  0xd4, 0x29, 0xfc, 0x14, 0x10, 0x18, 0x9d, 0x3d, 0x24, 0xc2, 0xa1, 0x79,
-  0xbb, 0xf6, 0x1b, 0xf5, 0x2e, 0x8d, 0x1c, 0x49, 0x67, 0xba, 0x31, 0x62,
-  0xb6, 0xdc, 0xc1, 0x2d, 0x93, 0xe1, 0x0e, 0x01, 0xf4, 0x1b, 0x40, 0x23,
-  0x46, 0x91, 0xd8, 0x81, 0xe3, 0x4d, 0x38, 0xaf, 0xfa, 0xfb, 0xc7, 0xca,
-  0x26, 0x0b, 0x52, 0x54, 0x75, 0xf1, 0xbf, 0x0c, 0xcf, 0x56, 0xc8, 0xb2,
-  0xea, 0x55, 0xc3, 0x9e, 0x1e, 0x48, 0xbb, 0x4d, 0xdb, 0xc7, 0xf7, 0x43,
-  0xc0, 0x43, 0x1e, 0x44, 0xef, 0xe5, 0x39, 0xcf, 0xc1, 0x09, 0x31, 0x03,
-  0xf7, 0x43, 0xbd, 0x35, 0x39, 0xe1, 0x11, 0x16, 0xa9, 0x31, 0x4f, 0xc1,
-  0x06, 0x16, 0x2a, 0x05, 0xff, 0xa0, 0x0d, 0xe0, 0xcb, 0xe9, 0xd2, 0x0b,
-  0x1e, 0x3f, 0xe9, 0x2b, 0x09, 0x26, 0x13, 0xdd, 0xc4, 0xbc, 0xfc, 0x41,
-  0x24, 0xd8, 0xc2, 0x36, 0x81, 0x25, 0x49, 0x88, 0xf6, 0x3a, 0x12, 0x3d,
-  0x14, 0x7f, 0x3d, 0x58, 0xa9, 0x78, 0x29, 0xb4, 0xad, 0xad, 0x5e, 0x74,
-  0xc3, 0x5d, 0xeb, 0x01, 0xad, 0x05, 0x52, 0x5d, 0x18, 0x79, 0x34, 0xa7,
-  0x0b, 0xc1, 0x28, 0x67, 0xfe, 0xc8, 0xa2, 0x73, 0x1d, 0xff, 0x2d, 0x60,
-  0xe8, 0x65, 0x00, 0xe2, 0xf0, 0x1d, 0xfd, 0xd7, 0xee, 0xde, 0x4b, 0xb6,
-  0x45, 0xdd, 0x1a, 0xee, 0x3a, 0xb2, 0x75, 0x5f, 0xa8, 0xf4, 0xa3, 0xdf,
-  0xd3, 0xc5, 0xe4, 0x50, 0xc6, 0x31, 0xba, 0x53, 0xba, 0xdf, 0x0e, 0x0f,
-  0x4f, 0xde, 0xb9, 0xe2, 0xb8, 0xc9, 0x39, 0x34, 0x51, 0x10, 0x52, 0x43,
-  0xde, 0xe0, 0x09, 0xbd, 0x0a, 0x10, 0xc8, 0xe9, 0xf0, 0x48, 0x13, 0x12,
-  0x09, 0xbb, 0xf2, 0xda, 0x07, 0xdc, 0x10, 0x81, 0x45, 0x64, 0x0a, 0x1b,
-  0xe0, 0xb4, 0x2c, 0xf3, 0x07, 0xe1, 0xd3, 0x36, 0xc9, 0x01, 0xe1, 0x38,
-  0xb5, 0x00, 0xc8, 0x08, 0x8a, 0x2a, 0x11, 0xcb, 0xd7, 0x0e, 0x40, 0x4b,
-  0xcc, 0x08, 0xd7, 0xfa, 0xeb, 0x06, 0xe6, 0x51, 0x6b, 0x06, 0x7f, 0xd7,
-  0xd8, 0xba, 0xb7, 0xf8, 0xec, 0x1a, 0x14, 0x4b, 0x4d, 0xa9, 0x5f, 0x4d,
-  0xd3, 0x39, 0x13, 0xc3, 0x51, 0x40, 0x4c, 0xf7, 0xda, 0x35, 0xba, 0x47,
-  0xe1, 0xff, 0xd9, 0xf0, 0x3d, 0x5d, 0x12, 0x0d, 0xc2, 0x4d, 0xb4, 0xd8,
-  0x01, 0xb4, 0xf8, 0xac, 0x59, 0x95, 0xb2, 0xde, 0x15, 0x1f, 0x90, 0xdb,
-  0xeb, 0x12, 0xf1, 0x34, 0xb4, 0xff, 0xb9, 0x64, 0x37, 0xa9, 0x5b, 0xea,
-  0xe5, 0xf9, 0x48, 0xb6, 0xea, 0xd5, 0x14, 0x40, 0xf7, 0x9d, 0xc4, 0xd9,
-  0xd0, 0xcc, 0x1f, 0xe7, 0xca, 0xb9, 0xb2, 0xba, 0x0f, 0x9d, 0x20, 0xda,
-  0xc7, 0xbc, 0x0f, 0xee, 0x0f, 0x4e, 0x39, 0xd6, 0xfe, 0x0d, 0xb3, 0x61,
-  0xf1, 0x43, 0x02, 0x59, 0x4e, 0x05, 0x4f, 0x41, 0x81, 0xe5, 0xdf, 0xd4,
-  0x27, 0x9d, 0xc0, 0x0d, 0x19, 0xe2, 0xbf, 0x42, 0x1c, 0x22, 0x7f, 0xdd,
-  0x59, 0x32, 0xce, 0xc9, 0x59, 0xcd, 0x31, 0xd8, 0x29, 0x47, 0x0a, 0xd0,
-  0xd5, 0xef, 0x2d, 0xcb, 0xd2, 0xe9, 0x07, 0xc0, 0xd9, 0x31, 0xd4, 0x0d,
-  0x2d, 0xc5, 0x36, 0x89, 0x48, 0x35, 0x0e, 0xbe, 0xe6, 0xf0, 0x0f, 0x1d,
-  0x47, 0x6c, 0x2a, 0x0b, 0x23, 0x36, 0x38, 0x50, 0x38, 0xb7, 0xc0, 0x17,
-  0x3a, 0x5d, 0x1a, 0xf0, 0x0d, 0x04, 0xfc, 0xd9, 0xc4, 0xa0, 0x2f, 0x6b,
-  0x31, 0x97, 0x48, 0xdb, 0x3e, 0x37, 0x08, 0x90, 0xb2, 0xf7, 0x42, 0xbf,
-  0xa7, 0xeb, 0x04, 0xa4, 0x7f, 0x06, 0xe8, 0x18, 0x34, 0x1d, 0xe6, 0xf3,
-  0x18, 0xe4, 0x54, 0xb9, 0x1d, 0x4f, 0xb5, 0x21, 0xe5, 0xd1, 0x40, 0xba,
-  0xdf, 0x47, 0x29, 0x3f, 0x30, 0x46, 0x53, 0xf5, 0x99, 0xb2, 0xd8, 0x02,
-  0xdb, 0xf2, 0x2c, 0xc1, 0x4e, 0x3a, 0xb2, 0x04, 0x41, 0x35, 0xd1, 0xaf,
-  0x50, 0x8f, 0xe7, 0xd4, 0x10, 0x8c, 0x37, 0x1f, 0xad, 0x45, 0x61, 0xe0,
-  0xec, 0x44, 0x12, 0xf7, 0xa1, 0x77, 0xd9, 0x48, 0x2a, 0x3d, 0xd8, 0x39,
-  0x81, 0xcc, 0xdd, 0xc7, 0x1d, 0x12, 0x3f, 0xf1, 0x36, 0x2d, 0x0a, 0xc0,
-  0xc3, 0xcc, 0x00, 0x2e, 0x2c, 0xc6, 0x6f, 0x0b, 0x0c, 0x1c, 0xd1, 0xf8,
-  0x07, 0x3e, 0x61, 0x38, 0x28, 0x1f, 0x41, 0x55, 0x1d, 0xd1, 0xe6, 0x19,
-  0xb1, 0x3b, 0x34, 0x5f, 0x9c, 0xf5, 0x87, 0xed, 0x1b, 0xf8, 0x3b, 0x49,
-  0xf6, 0x3b, 0xb7, 0xdd, 0xc9, 0x41, 0xc5, 0x22, 0xb2, 0x56, 0x34, 0x69,
-  0x6f, 0x9a, 0x88, 0x08, 0x2b, 0xa1, 0x77, 0xc6, 0x6b, 0x06, 0xf1, 0xf9,
-  0x64, 0x81, 0xb3, 0x1d, 0xb9, 0xb1, 0x51, 0xd7, 0xa6, 0x10, 0x30, 0x74,
-  0x2a, 0x14, 0x13, 0x2e, 0x1d, 0xae, 0x21, 0x3b, 0x32, 0xd3, 0x1f, 0x3b,
-  0x35, 0x10, 0x2a, 0x19, 0x81, 0xa8, 0x32, 0xd9, 0xa9, 0xae, 0xdb, 0xf0,
-  0x3a, 0x8e, 0x4a, 0xf3, 0xc3, 0x96, 0xc6, 0xe9, 0x40, 0xd7, 0xa3, 0x1a,
-  0xed, 0x5a, 0xfe, 0x2a, 0x30, 0xd7, 0x31, 0x05, 0x81, 0xe3, 0xd6, 0x5e,
-  0xea, 0xf0, 0xe1, 0x0a, 0x91, 0xdc, 0x9d, 0x9e, 0x63, 0x07, 0x29, 0x9c,
-  0x59, 0x53, 0xb8, 0x3d, 0xc5, 0x9e, 0x72, 0x68, 0x3e, 0xaa, 0x4e, 0xab,
-  0xd6, 0x20, 0xfd, 0x4e, 0x81, 0xb3, 0x10, 0x64, 0x5f, 0x66, 0x31, 0x49,
-  0x0d, 0xc2, 0xc8, 0xf8, 0xc4, 0x53, 0x96, 0xfa, 0xb7, 0x18, 0xd6, 0x67,
-  0x39, 0xbc, 0xfb, 0xc1, 0x91, 0xf9, 0x81, 0xf8, 0xd7, 0xf8, 0xc8, 0x0b,
-  0xa4, 0xc3, 0x31, 0x30, 0x47, 0x4b, 0xfe, 0x1c, 0x0d, 0xce, 0xce, 0x1b,
-  0xb0, 0x30, 0xfa, 0xc3, 0xcf, 0xe3, 0x9a, 0xcc, 0x56, 0xff, 0x00, 0x18,
-  0x29, 0x42, 0x1c, 0xc4, 0x5b, 0x00, 0x6d, 0xa9, 0xf3, 0xfe, 0x5f, 0xcb,
-  0x39, 0xca, 0x37, 0x41, 0x29, 0xce, 0xcd, 0xa7, 0xbb, 0xdc, 0xc3, 0x4e,
-  0xfa, 0x31, 0x2e, 0x84, 0x5a, 0x46, 0x30, 0xd9, 0xa0, 0xe3, 0x63, 0xe9,
-  0xfc, 0x62, 0x1b, 0x01, 0x3b, 0xf8, 0x1d, 0x28, 0x98, 0x21, 0x00, 0xd8,
-  0x5b, 0xe8, 0x42, 0xdd, 0x81, 0xd0, 0xd8, 0xa6, 0x35, 0xe5, 0x1b, 0x2b,
-  0x24, 0xa5, 0x14, 0xf7, 0x4b, 0x4e, 0x19, 0xc7, 0x05, 0xab, 0x65, 0xc1,
-  0xf6, 0xef, 0x1d, 0xf3, 0xd5, 0x5c, 0xf3, 0x14, 0x65, 0xb0, 0xee, 0x35,
-  0x39, 0x41, 0x51, 0x05, 0xf4, 0x2f, 0xe9, 0x19, 0xe7, 0x20, 0x2e, 0x3f,
-  0xb7, 0x21, 0xef, 0xbb, 0xc2, 0xf1, 0xe0, 0xd7, 0x19, 0xf2, 0xb0, 0x27,
-  0x51, 0xe9, 0x57, 0xc4, 0x4b, 0xf7, 0xeb, 0xbf, 0x24, 0x3b, 0xfe, 0xf7,
-  0x1f, 0xff, 0x07, 0xdb, 0x71, 0xbf, 0xfd, 0xa8, 0x1f, 0x15, 0x2c, 0xd7,
-  0xda, 0x47, 0x41, 0x28, 0xea, 0x14, 0x14, 0x33, 0x00, 0x7f, 0x62, 0x67,
-  0xfd, 0x1e, 0x4b, 0xf3, 0xde, 0x90, 0x4b, 0xad, 0xc7, 0x1d, 0x12, 0x81,
-  0xdb, 0x37, 0x4b, 0x4b, 0xc4, 0xd6, 0xfa, 0x23, 0xdb, 0x1b, 0x99, 0xf7,
-  0x1a, 0xe9, 0x0e, 0x20, 0xdf, 0xcd, 0x2f, 0xe7, 0xdc, 0x08, 0xbe, 0x5d,
-  0xa3, 0x59, 0xda, 0x18, 0x47, 0xe7, 0x01, 0x1c, 0x32, 0x20, 0xb7, 0xc0,
-  0x4f, 0x52, 0xff, 0xe4, 0x57, 0xd5, 0x2d, 0xa7, 0x7d, 0xa1, 0x3c, 0x4d,
-  0xd3, 0xcb, 0xb6, 0xa3, 0x44, 0xda, 0xf7, 0x06, 0x3a, 0xa2, 0xd6, 0xb7,
-  0x27, 0x26, 0xc4, 0xe7, 0x05, 0x08, 0xec, 0xdf, 0x30, 0xfc, 0xd6, 0xe6,
-  0x03, 0xf7, 0xb8, 0x14, 0x95, 0xd8, 0xe3, 0x00, 0x52, 0xc1, 0xc2, 0xe3,
-  0x05, 0x5c, 0xcf, 0x16, 0xf1, 0x04, 0x3d, 0x2d, 0xf1, 0xf3, 0x0d, 0xbb,
-  0xa2, 0x81, 0x3e, 0x30, 0x46, 0x42, 0xf6, 0x28, 0x54, 0xb9, 0x13, 0xeb,
-  0x5d, 0x47, 0xd1, 0xb2, 0x28, 0x5d, 0x31, 0x16, 0xe5, 0x20, 0xfe, 0x20,
-  0xee, 0x05, 0x26, 0x3e, 0x41, 0x08, 0xed, 0x01, 0xc4, 0x39, 0x40, 0x24,
-  0xd3, 0x41, 0xf2, 0xf8, 0x09, 0xec, 0xea, 0xb3, 0x15, 0x32, 0xca, 0xd7,
-  0x24, 0xee, 0xd0, 0xbd, 0x1b, 0xbf, 0x2e, 0xf6, 0xcd, 0x08, 0xfa, 0x43,
-  0xcb, 0x3e, 0x25, 0x2d, 0xd8, 0x10, 0xbd, 0x7f, 0xf4, 0xe6, 0x2a, 0x30,
-  0xfd, 0x4a, 0xd7, 0xf4, 0xcb, 0x13, 0x06, 0xbf, 0xdf, 0x57, 0x13, 0x3a,
-  0xc4, 0xd6, 0xc6, 0x21, 0xce, 0xaf, 0xaf, 0xf0, 0xd8, 0xf4, 0xec, 0xca,
-  0x7f, 0xa0, 0xd1, 0xac, 0xe8, 0x0f, 0xf6, 0x6a, 0xaf, 0x13, 0xc8, 0x42,
-  0x09, 0x7f, 0x1f, 0x07, 0x48, 0x8e, 0x8f, 0x19, 0x2b, 0x8c, 0x2f, 0xf4,
-  0xd9, 0x4c, 0x03, 0xad, 0xeb, 0x29, 0x96, 0xb6, 0xdd, 0xda, 0xcf, 0xde,
-  0xcf, 0x6e, 0xd6, 0x2e, 0xb0, 0xa5, 0xcf, 0x6b, 0x00, 0xdb, 0x2a, 0x9b,
-  0x36, 0x45, 0x7f, 0x60, 0xec, 0xea, 0xc4, 0xc0, 0xd1, 0xea, 0x1a, 0xa9,
-  0x42, 0xcd, 0xbc, 0x26, 0xf6, 0xd7, 0x68, 0xa8, 0x81, 0xc8, 0xd1, 0xc9,
-  0x42, 0xbd, 0x1b, 0xce, 0xc8, 0xdc, 0xf2, 0xb9, 0x29, 0x06, 0xe4, 0xdc,
-  0x1d, 0x59, 0xd9, 0x50, 0xcc, 0xf1, 0x19, 0x2f, 0xd2, 0x39, 0x0e, 0x11,
-  0x4d, 0xb8, 0x28, 0xf7, 0x02, 0x76, 0x22, 0x42, 0xfc, 0xf4, 0x53, 0x59,
-  0x5e, 0xbd, 0xe9, 0x3d, 0xfc, 0x0a, 0x32, 0xe0, 0xe8, 0x36, 0xf9, 0x3d,
-  0x10, 0xeb, 0xd7, 0x76, 0xca, 0xe7, 0xc5, 0xd2, 0xe9, 0x9e, 0xc7, 0x13,
-  0xb4, 0xbb, 0xc6, 0xc1, 0xf0, 0x34, 0xd5, 0x1e, 0x95, 0xa0, 0x34, 0x0a,
-  0xf5, 0x90, 0x43, 0xc6, 0x79, 0xa2, 0x8f, 0x93, 0x92, 0x71, 0x81, 0xba,
-  0xfa, 0x91, 0xe1, 0x33, 0x20, 0x36, 0xd6, 0xed, 0xc8, 0xf0, 0x1a, 0x5e,
-  0x05, 0x62, 0xdf, 0x6f, 0x19, 0xac, 0x63, 0x30, 0xff, 0x98, 0xbf, 0xa0,
-  0x2f, 0xac, 0x2a, 0x30, 0xcf, 0xfe, 0x43, 0xf5, 0xb3, 0x24, 0xd3, 0x9f,
-  0x4e, 0x35, 0x27, 0x58, 0x12, 0x47, 0x5b, 0x3a, 0xa8, 0xbf, 0xca, 0xdb,
-  0x54, 0x3b, 0x59, 0x0f, 0xcb, 0x17, 0x55, 0x31, 0xf2, 0x23, 0x1b, 0x52,
-  0x40, 0x37, 0xab, 0x16, 0x6f, 0xc8, 0xdf, 0xc3, 0xb5, 0x69, 0xa9, 0xd6,
-  0x3d, 0xb8, 0x81, 0xbd, 0x2a, 0xa2, 0x1f, 0xaf, 0x4c, 0x1d, 0xc4, 0x2b,
-  0x19, 0x02, 0xd6, 0x0c, 0x9f, 0xb2, 0xc1, 0x10, 0x43, 0xe7, 0xf4, 0xfe,
-  0x4f, 0xe9, 0xfe, 0x0a, 0x01, 0xd0, 0xfc, 0x5b, 0x2c, 0x2a, 0x0c, 0xb5,
-  0xd4, 0x4c, 0x2e, 0xfa, 0x0c, 0x35, 0xe0, 0x7f, 0xe6, 0xe3, 0xad, 0x22,
-  0x8d, 0xe8, 0xff, 0x3f, 0xb3, 0x0f, 0x00, 0x93, 0x02, 0x2e, 0xe2, 0x03,
-  0xe7, 0x21, 0x50, 0xa8, 0x0e, 0xfb, 0x28, 0xdd, 0xe0, 0x55, 0x6a, 0xe4,
-  0x50, 0xb5, 0x52, 0xd6, 0x20, 0x1f, 0xdf, 0xb4, 0x15, 0x96, 0xe9, 0x6f,
-  0x73, 0x40, 0xfa, 0x66, 0x0c, 0x59, 0x28, 0x44, 0x50, 0x3e, 0x53, 0x9d,
-  0x9a, 0x3f, 0xf1, 0xcb, 0x6e, 0x4e, 0x17, 0x08, 0x2e, 0x27, 0xca, 0xad,
-  0x55, 0x6f, 0x52, 0x50, 0xc8, 0x30, 0x3a, 0xd5, 0xcf, 0x14, 0x59, 0x4a,
-  0x55, 0xf8, 0x73, 0xfc, 0x8b, 0xcc, 0xe0, 0x78, 0x1c, 0x57, 0x18, 0xc5,
-  0xeb, 0x5d, 0x4b, 0x81, 0x10, 0x56, 0x61, 0x2e, 0x62, 0x8d, 0x21, 0x26,
-  0x2e, 0x1f, 0x41, 0xeb, 0x39, 0x19, 0x12, 0xff, 0x48, 0x31, 0xa2, 0xee,
-  0x2b, 0xcc, 0xc2, 0x69, 0x23, 0x00, 0xf0, 0x70, 0xd9, 0xa8, 0x97, 0xdf,
-  0x57, 0xf7, 0x2a, 0xe2, 0x2a, 0xce, 0x53, 0x22, 0xc5, 0x81, 0x55, 0x39,
-  0xf4, 0xf0, 0xc1, 0xb6, 0x9d, 0x5f, 0xcc, 0x88, 0x25, 0xcc, 0x3f, 0xc0,
-  0xdd, 0xac, 0x63, 0xdb, 0xb2, 0x9a, 0x13, 0xf7, 0x8b, 0xf7, 0x1f, 0xa3,
-  0xff, 0xba, 0x53, 0xc4, 0xf8, 0xa8, 0x20, 0xd7, 0xac, 0xe4, 0x0a, 0x1b,
-  0x36, 0xdd, 0xf6, 0x0b, 0x41, 0x30, 0xe9, 0xd3, 0xfd, 0x20, 0x24, 0x28,
-  0x44, 0xe0, 0xe4, 0xc5, 0x44, 0x47, 0x27, 0x1a, 0xf7, 0x56, 0xe9, 0xf5,
-  0xe9, 0x64, 0x98, 0xab, 0x23, 0xe0, 0x33, 0xe9, 0x4f, 0xdf, 0x49, 0x59,
-  0x44, 0x7f, 0xca, 0xe2, 0x46, 0xc2, 0xcb, 0x4f, 0x0a, 0x47, 0xbb, 0x2a,
-  0x78, 0x4a, 0xdd, 0xc5, 0xeb, 0xfe, 0x02, 0xc0, 0x20, 0xd0, 0xf4, 0x1d,
-  0x0f, 0xe4, 0x32, 0x3f, 0xf6, 0xfa, 0xeb, 0x01, 0x19, 0x0a, 0xe1, 0x1b,
-  0x2b, 0x1f, 0xcd, 0x10, 0xd1, 0x0f, 0xfe, 0xe6, 0xeb, 0xfc, 0x0a, 0x1b,
-  0xe7, 0xe3, 0x35, 0xf0, 0x17, 0xeb, 0x24, 0xc5, 0xf3, 0x00, 0xea, 0xe7,
-  0x01, 0x13, 0x1d, 0xe0, 0xd9, 0x1c, 0xd1, 0x7f, 0x36, 0xf4, 0xee, 0x1f,
-  0xe2, 0x39, 0x14, 0x31, 0xde, 0xcb, 0x1a, 0xe0, 0xed, 0xc4, 0x32, 0xe4,
-  0x1e, 0xd0, 0xac, 0xcb, 0x22, 0x2b, 0xaf, 0xd5, 0x4b, 0x2a, 0x31, 0x63,
-  0xb5, 0x18, 0xba, 0x9b, 0x6d, 0x17, 0x38, 0x29, 0x2b, 0xae, 0x11, 0xd4,
-  0xa5, 0x0f, 0xa9, 0xd5, 0x24, 0xf5, 0xd5, 0xef, 0x98, 0xb7, 0xe3, 0xb0,
-  0xde, 0x5d, 0x40, 0x0b, 0x28, 0xd1, 0x00, 0xf1, 0x2d, 0xa4, 0xcb, 0x86,
-  0x52, 0x07, 0x45, 0xdf, 0xeb, 0x08, 0x1e, 0xa5, 0xda, 0x57, 0xf9, 0x12,
-  0xe8, 0x7f, 0x75, 0x3a, 0xdb, 0x3a, 0x0d, 0xf2, 0x37, 0x69, 0x51, 0x5a,
-  0x44, 0x24, 0xd3, 0x3f, 0xaa, 0x7f, 0xb0, 0xf1, 0xbe, 0x2d, 0x3b, 0x43,
-  0xea, 0xca, 0x48, 0x28, 0xc5, 0xad, 0xba, 0x68, 0xe2, 0x40, 0xc8, 0x2a,
-  0xf8, 0x53, 0xd2, 0x6d, 0xf9, 0xb1, 0xf7, 0x86, 0x3b, 0x48, 0x21, 0x98,
-  0xaa, 0xd0, 0xde, 0xf5, 0xc9, 0xb1, 0x22, 0xe4, 0x13, 0xfe, 0x9b, 0x39,
-  0x54, 0x1b, 0xf7, 0xde, 0x11, 0xd4, 0x21, 0xae, 0x4d, 0xd5, 0xb3, 0xd4,
-  0x34, 0x28, 0x52, 0xd7, 0xf0, 0x02, 0xfd, 0x99, 0x26, 0xb8, 0x14, 0x0c,
-  0x50, 0x27, 0xa0, 0x29, 0xfa, 0x1c, 0xb8, 0x06, 0xf9, 0x58, 0x29, 0xca,
-  0xb1, 0x4d, 0xd8, 0xc9, 0x16, 0x4f, 0x2d, 0xf9, 0xee, 0xf2, 0x42, 0xf5,
-  0xe4, 0x22, 0x06, 0xbb, 0xd3, 0x58, 0x0f, 0x03, 0x28, 0x4c, 0x81, 0x24,
-  0xd2, 0x5d, 0xaa, 0x63, 0xce, 0x13, 0x18, 0xfd, 0x57, 0xf5, 0xb1, 0x2e,
-  0xf2, 0xef, 0x07, 0x3b, 0xb7, 0x7e, 0x06, 0xe1, 0xb3, 0xb5, 0x48, 0x28,
-  0x30, 0x3b, 0xc5, 0x4c, 0xce, 0xb6, 0x9a, 0x39, 0xca, 0x04, 0xbc, 0xc9,
-  0x9e, 0xab, 0x39, 0x54, 0x34, 0x5c, 0xf6, 0xff, 0xd3, 0x5d, 0xf4, 0x09,
-  0xae, 0xdb, 0x6c, 0x01, 0x15, 0xc2, 0x27, 0x1e, 0x43, 0x1d, 0x0e, 0x5b,
-  0x59, 0xdd, 0x51, 0x5e, 0x0e, 0xcd, 0x0d, 0xaf, 0x81, 0x46, 0xe6, 0x55,
-  0x08, 0x06, 0x31, 0x6d, 0x98, 0xe7, 0x09, 0x3a, 0xd9, 0xe9, 0x25, 0x28,
-  0x20, 0xca, 0xec, 0x29, 0xca, 0x56, 0xeb, 0x43, 0xbb, 0x52, 0xf7, 0xb9,
-  0x2e, 0xe1, 0xda, 0x92, 0x1f, 0x13, 0xef, 0x12, 0x29, 0xf2, 0x44, 0xe5,
-  0xa5, 0x0e, 0xc0, 0x75, 0x50, 0x1a, 0xc8, 0x96, 0x90, 0x26, 0x0f, 0xf6,
-  0xfc, 0x1b, 0xe6, 0xbe, 0xad, 0xd6, 0x68, 0x15, 0x17, 0xe1, 0x26, 0xf9,
-  0x81, 0xb9, 0x2a, 0x18, 0xc4, 0xf7, 0x51, 0x56, 0x27, 0x25, 0xc5, 0x0d,
-  0x43, 0x0b, 0xb8, 0x0c, 0x9e, 0x14, 0x67, 0xf4, 0x06, 0x04, 0x7f, 0x4d,
-  0x9b, 0x2c, 0xbf, 0xeb, 0xbb, 0x12, 0xb5, 0xd1, 0x26, 0x03, 0x17, 0xc9,
-  0xd1, 0xfa, 0xd5, 0x0f, 0xde, 0x65, 0xed, 0x37, 0x05, 0x3b, 0xb7, 0x55,
-  0xda, 0xe0, 0xb1, 0x04, 0xce, 0x46, 0x29, 0x23, 0x40, 0x2f, 0x5b, 0xf7,
-  0x0d, 0x0e, 0xd1, 0x0d, 0xd7, 0x2f, 0x02, 0x08, 0x45, 0xb2, 0xee, 0xba,
-  0x12, 0x14, 0xa9, 0xce, 0xea, 0xcf, 0x4f, 0x97, 0x48, 0xff, 0xd3, 0xe8,
-  0x00, 0xf8, 0x7f, 0xe5, 0xca, 0x30, 0xfd, 0xb4, 0x64, 0xdb, 0xf2, 0xd9,
-  0xe4, 0xd3, 0x2f, 0x4f, 0x09, 0x3a, 0x49, 0x39, 0xf2, 0x17, 0xe3, 0xe5,
-  0xc3, 0xcc, 0xdc, 0xf2, 0x17, 0x26, 0xee, 0xf9, 0x4b, 0x20, 0xb6, 0x16,
-  0xf3, 0x19, 0x1a, 0xae, 0x03, 0xf7, 0x3b, 0x58, 0xee, 0x0e, 0x19, 0xf9,
-  0xb1, 0x10, 0xeb, 0xfc, 0x1b, 0xc9, 0x2e, 0xb1, 0x16, 0x2e, 0x67, 0xb6,
-  0x2f, 0xda, 0x0b, 0xd2, 0xf6, 0x59, 0x33, 0xdd, 0xc9, 0xb1, 0x46, 0xfe,
-  0xe6, 0xe1, 0xe7, 0x04, 0xd4, 0xf2, 0xd5, 0x22, 0x11, 0xb4, 0x45, 0xca,
-  0xe4, 0xc2, 0xcb, 0xbd, 0x96, 0xc0, 0xb3, 0x23, 0xb0, 0x07, 0xec, 0x07,
-  0x29, 0xfb, 0x19, 0x55, 0xfe, 0x0d, 0xbb, 0x2f, 0x0b, 0x0c, 0x81, 0xb1,
-  0x9c, 0x2a, 0x06, 0x3c, 0x5e, 0xea, 0x06, 0x19, 0x90, 0xf8, 0xeb, 0xe9,
-  0x04, 0x46, 0xd3, 0xbb, 0x4a, 0x93, 0xa0, 0x49, 0x87, 0x26, 0xaa, 0xef,
-  0x8f, 0x47, 0xd9, 0xc5, 0xd4, 0xe6, 0x09, 0xda, 0xf7, 0xd4, 0xe9, 0x2c,
-  0x15, 0x0a, 0x4b, 0x23, 0xc1, 0x7f, 0x07, 0x31, 0x67, 0xbe, 0x67, 0xd5,
-  0xe2, 0x1c, 0x3c, 0x28, 0x2f, 0xcb, 0xc0, 0xd8, 0xdc, 0xf9, 0x2a, 0xdb,
-  0x2c, 0xc3, 0x0f, 0xd3, 0xfe, 0x01, 0x0e, 0xd0, 0xff, 0x7f, 0x1d, 0x07,
-  0x4f, 0xfa, 0x3a, 0xdc, 0x36, 0x14, 0xfb, 0x49, 0x3f, 0x41, 0xa8, 0x05,
-  0xbc, 0x07, 0xd9, 0x15, 0x0f, 0xd0, 0x2a, 0x4a, 0xe9, 0xf9, 0x5c, 0x47,
-  0xc6, 0x05, 0x18, 0xfb, 0xf3, 0xf6, 0x40, 0x9d, 0x42, 0x62, 0x02, 0x4a,
-  0x00, 0x1b, 0xbd, 0xd5, 0x4f, 0xcb, 0x5f, 0x0c, 0x54, 0x34, 0xdc, 0x63,
-  0x05, 0x9b, 0x7d, 0x3d, 0xb8, 0x84, 0xbd, 0x63, 0xf2, 0x03, 0xc4, 0x08,
-  0x7f, 0x4e, 0xf5, 0xc0, 0xbc, 0x12, 0x1d, 0x1a, 0xaf, 0xc2, 0xac, 0xa9,
-  0x14, 0x27, 0xee, 0x03, 0xd4, 0x45, 0x89, 0x1c, 0xb2, 0xb0, 0xbc, 0x93,
-  0x9e, 0x45, 0xd1, 0x04, 0xbb, 0x4d, 0x42, 0xff, 0x30, 0xc9, 0xb5, 0x69,
-  0x81, 0xbb, 0x56, 0xdc, 0xc5, 0xbd, 0x1c, 0x10, 0x9e, 0x4b, 0xf8, 0xb4,
-  0x60, 0xb8, 0x2d, 0x02, 0xbd, 0x0a, 0xa0, 0xe9, 0xf1, 0xe7, 0xbd, 0x16,
-  0x0f, 0xbb, 0xfc, 0x42, 0x4a, 0xd1, 0x10, 0x9f, 0x7f, 0x3d, 0x51, 0x1e,
-  0x64, 0x6d, 0xbf, 0x9f, 0x58, 0xca, 0x4f, 0xcf, 0x64, 0xe9, 0xc1, 0xfd,
-  0x5a, 0x0c, 0xe7, 0x64, 0x4c, 0x31, 0xc6, 0xa7, 0xb8, 0xf4, 0xc9, 0x37,
-  0xb5, 0x95, 0xbc, 0x36, 0xc4, 0xf3, 0xf2, 0xeb, 0x24, 0xe5, 0x08, 0xf5,
-  0x97, 0xb3, 0xf2, 0xc9, 0x9d, 0xe5, 0x4a, 0x19, 0x94, 0x38, 0xdf, 0xbb,
-  0x68, 0xa5, 0x26, 0x0e, 0x2f, 0x4b, 0xcd, 0x42, 0xdf, 0x0a, 0x56, 0xad,
-  0x7c, 0xf4, 0xde, 0x45, 0xd4, 0xc0, 0x0f, 0x81, 0xe3, 0xd2, 0xc6, 0xd2,
-  0x15, 0xe2, 0xe5, 0xe9, 0x06, 0xb5, 0xd4, 0x2a, 0x3d, 0xc8, 0xc8, 0x1a,
-  0x35, 0xb3, 0x20, 0xf8, 0xc1, 0xf5, 0xe8, 0x2c, 0xff, 0xfc, 0x0a, 0x50,
-  0x0d, 0xd9, 0x44, 0x08, 0xf3, 0x5f, 0x23, 0xd1, 0xf3, 0x9e, 0x1a, 0x50,
-  0xa5, 0x51, 0xcd, 0xf6, 0xbc, 0xec, 0xea, 0xa8, 0xcd, 0xd2, 0xca, 0x88,
-  0xfe, 0x3e, 0x16, 0xbb, 0xc3, 0x20, 0x59, 0xaf, 0xa0, 0xe5, 0xe3, 0xd2,
-  0xa9, 0xe9, 0x0e, 0x2d, 0x1a, 0x64, 0x7f, 0xf0, 0x12, 0xda, 0x58, 0x6b,
-  0x13, 0x8d, 0xf3, 0xcb, 0x34, 0x25, 0xba, 0x53, 0x30, 0x69, 0x4f, 0xf3,
-  0xce, 0xcc, 0xd7, 0xc6, 0xd1, 0x37, 0xa7, 0xf3, 0xee, 0x5f, 0x96, 0x3f,
-  0xdf, 0xc5, 0xfa, 0x97, 0xd5, 0x67, 0xd1, 0xc8, 0xed, 0x1e, 0xd1, 0x19,
-  0xfb, 0xd5, 0x4a, 0x1b, 0xbf, 0xa9, 0x6a, 0xe9, 0x44, 0xb1, 0x37, 0x0d,
-  0x2d, 0xa2, 0x97, 0x16, 0xce, 0xcc, 0x04, 0x39, 0x16, 0x3e, 0x7f, 0x3c,
-  0xfa, 0xb2, 0x55, 0xc3, 0x10, 0xd2, 0xe0, 0x45, 0x28, 0x40, 0xe8, 0xc2,
-  0x23, 0xf1, 0xa3, 0x33, 0x97, 0x2a, 0xe2, 0x60, 0x39, 0x93, 0xe0, 0xb4,
-  0x77, 0x55, 0xbc, 0x42, 0xca, 0x99, 0x1a, 0xa6, 0xfb, 0x25, 0xb9, 0xff,
-  0x8a, 0xe4, 0xf0, 0x0e, 0xe8, 0x36, 0x28, 0x64, 0x6c, 0x3e, 0x29, 0x47,
-  0xd1, 0xf6, 0xf4, 0x20, 0xd2, 0xe5, 0xb1, 0xfc, 0x51, 0x7f, 0xb8, 0xe3,
-  0x63, 0x16, 0x99, 0x0e, 0x13, 0xda, 0x2b, 0x08, 0xfb, 0xab, 0xb2, 0xfb,
-  0x5f, 0x36, 0xdc, 0xaa, 0x5c, 0xc5, 0x34, 0xdf, 0xf8, 0xd7, 0xe9, 0xb8,
-  0xd4, 0x27, 0xe1, 0x4c, 0xa6, 0x32, 0x38, 0x04, 0xcc, 0x3f, 0x12, 0xaa,
-  0xea, 0x4b, 0xd4, 0xff, 0x23, 0xba, 0xf1, 0xae, 0x1f, 0x54, 0x38, 0xc0,
-  0x11, 0x2e, 0x95, 0xc2, 0xf0, 0x4c, 0x5b, 0xf7, 0xcf, 0xb5, 0x17, 0xf1,
-  0xec, 0x57, 0xcc, 0x0e, 0xca, 0x14, 0xbf, 0xf8, 0x03, 0xc5, 0xc7, 0xc8,
-  0xe0, 0x0c, 0xc2, 0x02, 0xbf, 0x5e, 0x3e, 0xb8, 0xd6, 0x2e, 0xf3, 0xc9,
-  0xa8, 0x81, 0x55, 0x8a, 0xe4, 0xa9, 0x5a, 0x85, 0x4e, 0xd6, 0x28, 0x60,
-  0x50, 0xed, 0x36, 0x52, 0xdb, 0x3c, 0x18, 0x42, 0x37, 0xd5, 0xba, 0x07,
-  0xa8, 0x9b, 0x97, 0x37, 0x2f, 0xed, 0x16, 0x52, 0x2d, 0x71, 0x40, 0x44,
-  0xeb, 0xd0, 0x00, 0x85, 0x9b, 0x04, 0xa9, 0x2a, 0x51, 0xd2, 0x04, 0x1d,
-  0xb7, 0x00, 0x3f, 0x58, 0x65, 0x99, 0xb9, 0xcf, 0xe6, 0x29, 0x31, 0x53,
-  0xe9, 0x1c, 0x1c, 0x09, 0x52, 0xc9, 0x4b, 0xb1, 0x4d, 0xad, 0xb5, 0x00,
-  0x49, 0x0f, 0xe4, 0x03, 0x60, 0xb4, 0x45, 0x9e, 0x0d, 0x42, 0xd4, 0xf4,
-  0xfb, 0xd9, 0x0f, 0x58, 0x3f, 0x30, 0x66, 0x81, 0xa0, 0x23, 0x18, 0x16,
-  0xdc, 0x88, 0x43, 0x00, 0x39, 0x2c, 0x83, 0xa9, 0xef, 0x5a, 0xb0, 0x45,
-  0x56, 0x67, 0x6d, 0xad, 0xce, 0x0e, 0x40, 0xac, 0x61, 0x00, 0x92, 0x0c,
-  0xff, 0x60, 0x3b, 0xbd, 0x13, 0x42, 0xfa, 0x31, 0x32, 0x71, 0xcf, 0x47,
-  0xfa, 0x65, 0x39, 0x0d, 0xed, 0x63, 0x12, 0xb0, 0xad, 0xfc, 0x50, 0xe8,
-  0x50, 0x81, 0x0a, 0xfe, 0xf6, 0xdf, 0xe5, 0x43, 0x43, 0x37, 0xce, 0x7b,
-  0x92, 0xd6, 0x2c, 0x4e, 0xb1, 0x13, 0xf5, 0x0c, 0x4e, 0xb6, 0xdc, 0xbf,
-  0xbd, 0x23, 0x4f, 0xe6, 0x57, 0xb5, 0x35, 0xea, 0x51, 0x17, 0xc6, 0x28,
-  0x09, 0x6a, 0x28, 0x11, 0x46, 0xfb, 0xdd, 0xe4, 0xf5, 0x04, 0x1a, 0xed,
-  0x8c, 0xbf, 0x4c, 0x5a, 0xdc, 0xb1, 0x3d, 0x81, 0x1c, 0x6c, 0x37, 0x1e,
-  0x65, 0x9f, 0x4e, 0xc1, 0x06, 0xe6, 0x48, 0x1e, 0x09, 0x43, 0x58, 0x85,
-  0x4a, 0x53, 0xb9, 0x50, 0xff, 0x57, 0x3c, 0x86, 0xe2, 0xbf, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa0, 0x1d, 0x00, 0x00,
-  0xeb, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x05, 0x14, 0x00, 0x00,
-  0xbb, 0x0c, 0x00, 0x00, 0x05, 0xf7, 0xff, 0xff, 0x7b, 0x03, 0x00, 0x00,
-  0xe7, 0xf5, 0xff, 0xff, 0xb2, 0x05, 0x00, 0x00, 0xd5, 0x0a, 0x00, 0x00,
-  0xa6, 0xf7, 0xff, 0xff, 0x4f, 0x09, 0x00, 0x00, 0x20, 0xf4, 0xff, 0xff,
-  0x53, 0xf4, 0xff, 0xff, 0xeb, 0x06, 0x00, 0x00, 0x05, 0x16, 0x00, 0x00,
-  0x4a, 0x14, 0x00, 0x00, 0x36, 0x10, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00,
-  0x5b, 0x02, 0x00, 0x00, 0x22, 0xf3, 0xff, 0xff, 0x31, 0x08, 0x00, 0x00,
-  0xa5, 0xfc, 0xff, 0xff, 0x37, 0x13, 0x00, 0x00, 0xae, 0xf1, 0xff, 0xff,
-  0xbe, 0x01, 0x00, 0x00, 0x19, 0xf3, 0xff, 0xff, 0x67, 0xfd, 0xff, 0xff,
-  0x87, 0x07, 0x00, 0x00, 0x11, 0x09, 0x00, 0x00, 0x95, 0xff, 0xff, 0xff,
-  0xa4, 0xee, 0xff, 0xff, 0x9e, 0x01, 0x00, 0x00, 0xa1, 0xff, 0xff, 0xff,
-  0xc5, 0xfa, 0xff, 0xff, 0x4a, 0x0f, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00,
-  0xa2, 0x16, 0x00, 0x00, 0xbd, 0xf8, 0xff, 0xff, 0xb1, 0x02, 0x00, 0x00,
-  0x47, 0xd8, 0xff, 0xff, 0xfa, 0x09, 0x00, 0x00, 0x55, 0xf2, 0xff, 0xff,
-  0xe9, 0xfd, 0xff, 0xff, 0x30, 0x03, 0x00, 0x00, 0xc9, 0xf9, 0xff, 0xff,
-  0x7f, 0xfb, 0xff, 0xff, 0x3d, 0xf9, 0xff, 0xff, 0x1c, 0x05, 0x00, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xca, 0x10, 0x00, 0x00,
-  0xbc, 0x07, 0x00, 0x00, 0x17, 0xee, 0xff, 0xff, 0x5c, 0x1c, 0x00, 0x00,
-  0xc2, 0x00, 0x00, 0x00, 0x82, 0x13, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00,
-  0xcd, 0xfd, 0xff, 0xff, 0x39, 0x04, 0x00, 0x00, 0xef, 0x0a, 0x00, 0x00,
-  0x24, 0xfa, 0xff, 0xff, 0x9a, 0xeb, 0xff, 0xff, 0x79, 0xf6, 0xff, 0xff,
-  0xee, 0xc0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0xad, 0xdb, 0x7f, 0x81, 0xe7, 0xdb, 0xdf, 0xe0, 0xd6, 0x56, 0x54, 0x39,
-  0x31, 0x00, 0x33, 0x81, 0xb2, 0x04, 0xd3, 0xbb, 0x02, 0x6d, 0x7f, 0x81,
-  0x5d, 0x02, 0x09, 0x4d, 0x0b, 0x7e, 0x31, 0x7f, 0xb0, 0x4b, 0x31, 0xaf,
-  0xa5, 0xfb, 0x64, 0x30, 0x47, 0xa6, 0xa9, 0x7f, 0xd7, 0xf0, 0xcd, 0x7f,
-  0xd7, 0x1a, 0x79, 0x44, 0x49, 0x73, 0x64, 0x29, 0x32, 0x16, 0x7f, 0xaa,
-  0x48, 0x48, 0x99, 0x40, 0xb0, 0x16, 0x67, 0xd8, 0x04, 0x17, 0x09, 0x2a,
-  0xe9, 0x21, 0x1d, 0xde, 0xd8, 0x2c, 0x7f, 0x2e, 0x52, 0x42, 0x7f, 0x7e,
-  0xbc, 0x1e, 0xf7, 0x5e, 0x11, 0x9f, 0xcc, 0x40, 0x49, 0x46, 0x7f, 0xcc,
-  0x18, 0x75, 0x89, 0x7f, 0xc6, 0x39, 0xf8, 0x86, 0x30, 0x77, 0x81, 0x1a,
-  0x31, 0x43, 0xd5, 0xf6, 0x4b, 0xbc, 0x7f, 0xce, 0x50, 0xf7, 0x3c, 0x53,
-  0x81, 0x0b, 0xd0, 0x98, 0x7f, 0x1a, 0xed, 0x5e, 0x81, 0xc6, 0x58, 0x91,
-  0x7f, 0xea, 0x59, 0xa2, 0xcc, 0x0d, 0x83, 0xf0, 0xf2, 0x9b, 0x63, 0x3c,
-  0x81, 0x1f, 0xf7, 0x5f, 0x25, 0x9f, 0xe8, 0x3a, 0x46, 0x61, 0x7f, 0x4d,
-  0x1a, 0x93, 0x1a, 0xb5, 0xd1, 0x47, 0x36, 0x6e, 0xf9, 0x1a, 0xe2, 0xf2,
-  0xbc, 0x0f, 0x17, 0xfd, 0xd9, 0xdf, 0x42, 0x2c, 0xe2, 0x4a, 0x0a, 0x49,
-  0x7f, 0x0b, 0xc6, 0x55, 0x08, 0xb2, 0x0f, 0x14, 0x2d, 0x7f, 0x03, 0x40,
-  0x48, 0x7f, 0x40, 0x1a, 0x37, 0x23, 0x7f, 0x08, 0xe2, 0xa1, 0x46, 0x4a,
-  0x81, 0x27, 0xc3, 0xdf, 0xed, 0x7f, 0x08, 0x00, 0x38, 0x1b, 0x42, 0xdc,
-  0xf8, 0xb7, 0xab, 0x32, 0x8b, 0x51, 0x8a, 0xd8, 0x27, 0x63, 0xd8, 0x33,
-  0xd8, 0x3b, 0x1c, 0xc7, 0xb8, 0x1e, 0x9f, 0xbb, 0x24, 0x20, 0xf2, 0xd5,
-  0xf8, 0x81, 0x76, 0x81, 0x21, 0x4c, 0xd6, 0x48, 0xf7, 0x16, 0x33, 0xf5,
-  0xe2, 0x63, 0x81, 0x07, 0x29, 0x3d, 0x3a, 0x78, 0xe2, 0x9b, 0x1e, 0xcb,
-  0x78, 0xe8, 0xae, 0xea, 0x09, 0xf4, 0x08, 0x4f, 0xeb, 0x10, 0x43, 0x7f,
-  0xd9, 0xd9, 0xf3, 0x0c, 0x81, 0x18, 0x03, 0x7f, 0x4f, 0x32, 0xae, 0xeb,
-  0x5d, 0x24, 0x85, 0xbd, 0x52, 0x0e, 0x21, 0x97, 0xd8, 0xea, 0x18, 0x9e,
-  0xce, 0x61, 0x23, 0x26, 0x15, 0xe9, 0x1a, 0x8c, 0xcb, 0xab, 0x42, 0x7f,
-  0x82, 0xc7, 0x3d, 0xc4, 0x16, 0xb5, 0x19, 0x7f, 0xe3, 0xf2, 0xd3, 0xdd,
-  0x5e, 0x81, 0xf6, 0x81, 0x9c, 0x01, 0xbf, 0xfe, 0x42, 0x81, 0xeb, 0x7e,
-  0x12, 0xed, 0xe0, 0xc9, 0x7f, 0xbb, 0xaa, 0xd3, 0x35, 0x42, 0x5f, 0x78,
-  0x7f, 0x7f, 0xc9, 0x24, 0x81, 0x0d, 0x76, 0xa9, 0x7f, 0x7f, 0xaf, 0xa9,
-  0xd4, 0x51, 0x5d, 0xb7, 0xbf, 0x81, 0xa5, 0xb6, 0xaf, 0x13, 0x8c, 0x1b,
-  0xb2, 0x81, 0xc5, 0x6e, 0x88, 0xcb, 0xa3, 0x50, 0x15, 0xe6, 0x6f, 0xd5,
-  0x3a, 0x5d, 0x2d, 0x19, 0x57, 0x64, 0x39, 0x60, 0x2e, 0xbc, 0x81, 0xd3,
-  0xaf, 0x1c, 0x13, 0x49, 0xe9, 0x38, 0xe4, 0xca, 0x3e, 0x81, 0x5a, 0x27,
-  0x53, 0xc7, 0xf2, 0x24, 0xac, 0xe4, 0xb4, 0x10, 0xa4, 0x7f, 0x97, 0xbb,
-  0x1a, 0x2c, 0xfa, 0x7f, 0x81, 0x53, 0xf3, 0x40, 0x81, 0xf6, 0x7f, 0x7c,
-  0x81, 0x46, 0xdb, 0xfa, 0xc6, 0x4f, 0x81, 0x8a, 0xd2, 0xa8, 0xb9, 0x81,
-  0x91, 0xf1, 0x12, 0x05, 0x62, 0xe1, 0x32, 0x59, 0xc3, 0xda, 0x1e, 0x7d,
-  0x7f, 0x81, 0x28, 0xc8, 0xda, 0x0f, 0xca, 0xe0, 0x30, 0xed, 0x50, 0x65,
-  0xfd, 0xb5, 0xef, 0x44, 0x46, 0x1c, 0xe5, 0x40, 0x49, 0xba, 0xe2, 0x0f,
-  0x01, 0xc0, 0xc5, 0xac, 0x28, 0x34, 0xe1, 0x8d, 0xf9, 0x81, 0xfe, 0xf0,
-  0x01, 0x2d, 0x07, 0x25, 0x4c, 0x7e, 0xcb, 0xb2, 0x17, 0xcd, 0x00, 0x5e,
-  0xa2, 0xbd, 0x1b, 0xdf, 0xce, 0x00, 0x9c, 0xf7, 0x00, 0x02, 0xe5, 0x7e,
-  0xa1, 0x9d, 0xe7, 0x52, 0x05, 0xcf, 0xd8, 0x81, 0x4a, 0x9b, 0x99, 0xf2,
-  0xb4, 0x55, 0xd3, 0x44, 0x2d, 0x7c, 0x16, 0xa9, 0xc2, 0x7f, 0xe4, 0xfe,
-  0x00, 0xe0, 0x13, 0x1a, 0x31, 0xee, 0x7f, 0x0c, 0x1b, 0x66, 0x81, 0x04,
-  0xf0, 0xd0, 0x51, 0x01, 0x6a, 0xc6, 0x34, 0xb2, 0x14, 0x91, 0x34, 0x38,
-  0x12, 0x87, 0x03, 0xf4, 0xcb, 0x81, 0x09, 0x5f, 0x19, 0xd8, 0xf1, 0x13,
-  0x3a, 0xc3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xc7, 0x01, 0x00, 0x00, 0xda, 0xfb, 0xff, 0xff, 0xad, 0xf3, 0xff, 0xff,
-  0x76, 0xfe, 0xff, 0xff, 0xd5, 0xfc, 0xff, 0xff, 0x4d, 0x08, 0x00, 0x00,
-  0xc5, 0xf8, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0x90, 0xfd, 0xff, 0xff,
-  0xf8, 0x06, 0x00, 0x00, 0xdd, 0x05, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00,
-  0xde, 0x02, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x43, 0xfd, 0xff, 0xff,
-  0xa8, 0xfa, 0xff, 0xff, 0x86, 0x05, 0x00, 0x00, 0x47, 0xf6, 0xff, 0xff,
-  0x03, 0xfc, 0xff, 0xff, 0x6f, 0xf6, 0xff, 0xff, 0x68, 0xfa, 0xff, 0xff,
-  0xea, 0x02, 0x00, 0x00, 0xce, 0xfc, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff,
-  0xe7, 0xfb, 0xff, 0xff, 0xbc, 0xfd, 0xff, 0xff, 0x29, 0xff, 0xff, 0xff,
-  0xc6, 0xed, 0xff, 0xff, 0x71, 0xfa, 0xff, 0xff, 0xab, 0xfa, 0xff, 0xff,
-  0xc7, 0x02, 0x00, 0x00, 0x44, 0xff, 0xff, 0xff, 0xea, 0x02, 0x00, 0x00,
-  0xa7, 0xf5, 0xff, 0xff, 0x67, 0x05, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00,
-  0xca, 0xfc, 0xff, 0xff, 0x13, 0xf2, 0xff, 0xff, 0x96, 0x03, 0x00, 0x00,
-  0x43, 0x0a, 0x00, 0x00, 0xed, 0x06, 0x00, 0x00, 0xb4, 0xfe, 0xff, 0xff,
-  0xd7, 0x03, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
-  0xc5, 0xff, 0xff, 0xff, 0x53, 0xfe, 0xff, 0xff, 0x6e, 0xfb, 0xff, 0xff,
-  0x5d, 0x02, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x98, 0xfa, 0xff, 0xff,
-  0x5e, 0x05, 0x00, 0x00, 0xad, 0xfb, 0xff, 0xff, 0x8e, 0x04, 0x00, 0x00,
-  0x63, 0x01, 0x00, 0x00, 0x11, 0xf6, 0xff, 0xff, 0xfb, 0x10, 0x00, 0x00,
-  0xa6, 0x0a, 0x00, 0x00, 0x8b, 0xfd, 0xff, 0xff, 0x17, 0x07, 0x00, 0x00,
-  0x0c, 0xfc, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0xaa, 0x06, 0x00, 0x00,
-  0x35, 0xf6, 0xff, 0xff, 0x46, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x3f, 0x4c, 0xf4, 0xb8, 0x66, 0x41, 0xdd, 0x0b,
-  0x5d, 0x7b, 0x3f, 0xe7, 0x0e, 0xc8, 0x7a, 0xea, 0xee, 0xd9, 0x10, 0x29,
-  0xde, 0xcf, 0xba, 0x98, 0x4c, 0x2a, 0x02, 0x1b, 0xb2, 0x7f, 0x64, 0x20,
-  0x3e, 0xa5, 0x32, 0xad, 0x5c, 0xf8, 0xcf, 0xd5, 0x21, 0xa6, 0x1a, 0x6c,
-  0x14, 0x71, 0x1f, 0x2b, 0x18, 0x54, 0xa2, 0x61, 0x6c, 0xae, 0xe9, 0xb2,
-  0xc9, 0xad, 0xec, 0xa9, 0x95, 0x7e, 0x22, 0xbd, 0xbf, 0x35, 0x2c, 0x7f,
-  0xdc, 0x07, 0xff, 0x5c, 0xd2, 0xc4, 0xe8, 0xc8, 0x51, 0xae, 0x69, 0x11,
-  0x1e, 0x9a, 0xe5, 0x1a, 0x25, 0x2f, 0xd0, 0xcb, 0x24, 0xed, 0xc0, 0xe9,
-  0x48, 0x08, 0x04, 0x5f, 0x2d, 0x43, 0xb7, 0xcf, 0x35, 0xfe, 0xfd, 0xd2,
-  0xc8, 0x52, 0xda, 0x38, 0xc9, 0xe0, 0xe2, 0x10, 0x57, 0x34, 0x26, 0x10,
-  0x0f, 0xf0, 0xf3, 0x4e, 0xdf, 0xf7, 0x16, 0xf6, 0xe0, 0xd2, 0xc5, 0xde,
-  0xaa, 0x63, 0xef, 0x21, 0xac, 0x18, 0x4d, 0x22, 0x3e, 0x16, 0x01, 0x91,
-  0xab, 0xd7, 0xf5, 0xc3, 0x29, 0x61, 0xb6, 0xed, 0x95, 0xef, 0x53, 0x1b,
-  0x65, 0xaf, 0x61, 0xbb, 0x33, 0xde, 0xab, 0xaf, 0x31, 0xbe, 0x30, 0x53,
-  0xf8, 0x3b, 0x52, 0x2d, 0x38, 0xed, 0x25, 0xb5, 0x7f, 0xd7, 0xd3, 0xd1,
-  0x1e, 0x0c, 0x2d, 0x1a, 0xd0, 0x10, 0x5c, 0xf2, 0xdc, 0x74, 0xf4, 0xab,
-  0xcf, 0x8f, 0xd8, 0x3e, 0x04, 0xf0, 0x20, 0xf1, 0x15, 0x37, 0x0b, 0xf2,
-  0xd2, 0x31, 0xd1, 0xf7, 0xeb, 0xf0, 0xc5, 0x02, 0x12, 0xd4, 0xd8, 0xeb,
-  0xf2, 0xf8, 0xd3, 0xe0, 0xb3, 0x06, 0x81, 0xed, 0xda, 0x09, 0xcc, 0x38,
-  0xc7, 0x12, 0xe5, 0x1e, 0x4a, 0xef, 0xf2, 0x25, 0xfe, 0xe1, 0xb9, 0xf9,
-  0x17, 0x21, 0xdb, 0x13, 0x3a, 0x18, 0xa5, 0xf1, 0xfa, 0x11, 0xe6, 0x07,
-  0xd7, 0xc8, 0x1b, 0x3f, 0xce, 0x01, 0xd0, 0xe8, 0x20, 0x00, 0xd3, 0xd0,
-  0x47, 0xd8, 0x53, 0x01, 0x05, 0x1d, 0xf5, 0xd4, 0xc1, 0x9f, 0x25, 0x2b,
-  0xcd, 0x81, 0x40, 0xbc, 0x06, 0x7b, 0x30, 0xdd, 0x8f, 0x08, 0xb8, 0x33,
-  0xfd, 0x29, 0x45, 0x9a, 0x45, 0xd5, 0xa8, 0x09, 0x2c, 0x10, 0x3f, 0xe7,
-  0xed, 0x0d, 0x25, 0x4d, 0x21, 0x03, 0x4b, 0x1b, 0xe9, 0xc7, 0x4b, 0xd0,
-  0xba, 0x4d, 0x4d, 0x05, 0xc4, 0xfe, 0xcd, 0x03, 0x37, 0xa5, 0x36, 0x23,
-  0x6f, 0x7f, 0xa7, 0xa2, 0xe1, 0xa8, 0x13, 0x0b, 0x15, 0x5e, 0x25, 0xf7,
-  0xec, 0xa0, 0xfe, 0x3c, 0xcd, 0x3d, 0x24, 0x22, 0xf5, 0xf9, 0xc5, 0x61,
-  0x4b, 0x1e, 0x9f, 0xe1, 0x1e, 0x00, 0xd1, 0x07, 0x11, 0xa2, 0x6e, 0x64,
-  0x61, 0x76, 0x17, 0xa4, 0x54, 0xf8, 0xa4, 0xa4, 0x23, 0x79, 0xf6, 0x5f,
-  0x04, 0x3f, 0x2a, 0x01, 0x40, 0x15, 0xe0, 0x1c, 0x54, 0x13, 0x37, 0x4b,
-  0x06, 0x61, 0xd9, 0x95, 0x01, 0x42, 0x41, 0x1e, 0x38, 0xe1, 0xd6, 0xf4,
-  0x0b, 0x7f, 0x09, 0xe8, 0x0c, 0x0a, 0x28, 0x20, 0xd1, 0x1d, 0xf3, 0x1e,
-  0x14, 0x0e, 0xb8, 0xf8, 0xe3, 0xb9, 0x04, 0xd2, 0x14, 0xce, 0xfe, 0xf0,
-  0xeb, 0x2d, 0x10, 0x4d, 0x1b, 0xe3, 0x0d, 0x3a, 0xad, 0x09, 0x35, 0x1f,
-  0x1f, 0xe1, 0xfe, 0xd4, 0xf3, 0xce, 0x34, 0x33, 0xf4, 0x10, 0xf8, 0xd5,
-  0xc1, 0x27, 0xca, 0xf3, 0x0d, 0x05, 0xda, 0x28, 0x7f, 0xb5, 0x45, 0xf0,
-  0x51, 0x19, 0xe0, 0xa2, 0x1d, 0x2a, 0xd3, 0xf2, 0xc7, 0xdd, 0xcb, 0xc6,
-  0x02, 0xe3, 0x8e, 0x9a, 0xe7, 0x5a, 0xbe, 0xb9, 0xd9, 0x2a, 0x45, 0xc6,
-  0x26, 0x2b, 0x13, 0x26, 0xfa, 0x2f, 0x10, 0x0e, 0xe9, 0xe1, 0x11, 0xba,
-  0x22, 0xea, 0xab, 0x23, 0xbe, 0xf1, 0xa2, 0xd6, 0xe2, 0xb7, 0x52, 0x0a,
-  0xe5, 0xbd, 0x1b, 0xe2, 0x26, 0x1a, 0xef, 0x4b, 0x09, 0x28, 0xe5, 0xb7,
-  0xe2, 0xd5, 0x0f, 0x08, 0xa6, 0xe9, 0xda, 0xfd, 0xc7, 0x55, 0x32, 0x1e,
-  0x21, 0xe6, 0x1a, 0x25, 0x2e, 0x0d, 0x53, 0xe2, 0xf7, 0xe0, 0x09, 0xf3,
-  0x03, 0x26, 0x9b, 0x48, 0xc3, 0xe3, 0xef, 0x0e, 0x46, 0xb9, 0xf4, 0xe9,
-  0x01, 0xfd, 0xf1, 0xcb, 0x23, 0xcd, 0x38, 0xe0, 0x1e, 0xca, 0x5c, 0xed,
-  0x38, 0x42, 0xd9, 0x20, 0xfd, 0x17, 0x09, 0x18, 0x1f, 0xe4, 0x1c, 0x0d,
-  0xdf, 0xd4, 0x81, 0xff, 0x29, 0xe7, 0xc9, 0xc0, 0xe3, 0x2f, 0xbe, 0xfe,
-  0xcd, 0xbc, 0x3f, 0x29, 0x1b, 0xd7, 0xec, 0x01, 0xb9, 0xc1, 0xcd, 0x11,
-  0x44, 0x1c, 0xe7, 0x58, 0x4a, 0x17, 0x7f, 0xbe, 0x04, 0xc2, 0x60, 0x3d,
-  0xe4, 0x0e, 0x25, 0xf5, 0x14, 0xf5, 0xc4, 0x9a, 0xe1, 0x0e, 0xf6, 0xb0,
-  0xc4, 0x4b, 0x63, 0xce, 0x36, 0x42, 0x20, 0x35, 0x79, 0xee, 0xff, 0xfd,
-  0x01, 0xf6, 0xe9, 0x2a, 0xf1, 0x08, 0x6c, 0xe3, 0xbb, 0x31, 0x3f, 0x51,
-  0xd0, 0xb3, 0x39, 0x29, 0x2b, 0x26, 0x92, 0x09, 0xee, 0xb0, 0xd3, 0xc8,
-  0x0c, 0xef, 0xbd, 0x2a, 0xd9, 0xae, 0xcb, 0xc5, 0xd5, 0x34, 0x16, 0x05,
-  0x19, 0xeb, 0x38, 0x14, 0x21, 0xc7, 0x52, 0x3c, 0x00, 0x12, 0x81, 0x08,
-  0xe7, 0x08, 0x60, 0x2d, 0xe2, 0x2b, 0x3a, 0xc6, 0x24, 0xaf, 0xed, 0xfa,
-  0x42, 0xcd, 0x52, 0xe1, 0xdc, 0xfd, 0x57, 0xa0, 0x34, 0x04, 0x62, 0x4e,
-  0xe3, 0xff, 0x20, 0xcb, 0xb9, 0x36, 0x0c, 0xef, 0xe6, 0x72, 0x33, 0xe6,
-  0xb6, 0xed, 0x5c, 0xf9, 0x27, 0x01, 0x6b, 0x30, 0x02, 0xaf, 0xd6, 0xe4,
-  0x0d, 0x5d, 0x12, 0x4c, 0x3b, 0xe5, 0xf5, 0x5f, 0x89, 0xab, 0x06, 0x9f,
-  0x7f, 0xee, 0xbc, 0xbc, 0x78, 0xba, 0x22, 0xc1, 0x3f, 0x40, 0x21, 0x14,
-  0x0c, 0x28, 0xac, 0x51, 0x26, 0x8c, 0xf8, 0xee, 0x1c, 0xa5, 0xbc, 0x64,
-  0x1a, 0xc0, 0xdc, 0xd4, 0xce, 0x5c, 0xc8, 0x1c, 0x15, 0xea, 0xa8, 0xe9,
-  0xf4, 0x30, 0x31, 0xfb, 0xd0, 0xac, 0x23, 0xe6, 0x3e, 0xa4, 0xd4, 0xc2,
-  0xb9, 0xca, 0x12, 0x2b, 0x1a, 0x5c, 0x6f, 0xf5, 0xee, 0xd6, 0xcd, 0x23,
-  0xf0, 0x2e, 0x29, 0x18, 0x20, 0x22, 0x2e, 0xc0, 0xd3, 0x20, 0xfa, 0x0e,
-  0x16, 0x1b, 0x0f, 0xa2, 0x27, 0x22, 0xea, 0xd0, 0x21, 0x81, 0xb4, 0xe7,
-  0x2a, 0x42, 0xe9, 0x36, 0xf8, 0x3d, 0x30, 0xe9, 0x02, 0x3b, 0xd4, 0x17,
-  0xc4, 0xc5, 0x49, 0xfb, 0xe0, 0x69, 0xd6, 0xc6, 0x1f, 0x38, 0xed, 0x19,
-  0xb0, 0x4f, 0x49, 0x03, 0x3e, 0xd4, 0x62, 0xfd, 0x27, 0xe5, 0x1a, 0xff,
-  0x45, 0xe8, 0xda, 0xb9, 0xd9, 0x45, 0x81, 0x73, 0xa7, 0xaa, 0x10, 0x3f,
-  0x21, 0x13, 0xaf, 0x05, 0x07, 0xab, 0x3d, 0xed, 0x3a, 0x5e, 0xed, 0x0e,
-  0xef, 0x3a, 0xb9, 0xff, 0xe3, 0x04, 0x27, 0x59, 0x79, 0x3b, 0x0b, 0x5b,
-  0xf1, 0xcd, 0x0b, 0x27, 0x02, 0xdf, 0xbd, 0xdd, 0xe3, 0x43, 0xc3, 0x09,
-  0x26, 0xd0, 0xc9, 0xbc, 0x8d, 0xf5, 0xff, 0x23, 0x18, 0x26, 0xac, 0xf9,
-  0xd6, 0x51, 0x0b, 0xfd, 0x6f, 0x08, 0x10, 0xb8, 0x18, 0xb1, 0xb6, 0x02,
-  0x36, 0xb2, 0x7f, 0xc4, 0x5d, 0x9d, 0x48, 0xdf, 0xd0, 0x16, 0xb6, 0x34,
-  0x00, 0xc2, 0x30, 0x66, 0x60, 0x15, 0xf2, 0xcd, 0xe5, 0xb5, 0x38, 0xca,
-  0xd4, 0xb0, 0xb6, 0x17, 0x18, 0xf4, 0xef, 0x22, 0x13, 0x50, 0x06, 0xf2,
-  0x27, 0xd6, 0xcf, 0xe5, 0x13, 0x56, 0xd6, 0xe0, 0x15, 0x0c, 0xf5, 0x1d,
-  0xe1, 0x0e, 0x3d, 0xf5, 0xed, 0x21, 0xd0, 0x20, 0x3a, 0x8a, 0xf2, 0xcc,
-  0x46, 0xf6, 0xf8, 0xfb, 0xb6, 0x41, 0x7f, 0x4c, 0x0b, 0x21, 0xe6, 0xf5,
-  0x12, 0x00, 0xd9, 0x94, 0xc8, 0xf3, 0xec, 0xec, 0xf5, 0xf4, 0xf8, 0x2d,
-  0x14, 0x17, 0x13, 0x46, 0xf6, 0xea, 0x3b, 0xd6, 0xb1, 0x58, 0xb8, 0xdd,
-  0x2e, 0xd7, 0x17, 0xaf, 0x3d, 0xc4, 0x3b, 0xf6, 0x34, 0xee, 0x9f, 0xbd,
-  0x08, 0x03, 0xec, 0x84, 0xce, 0x26, 0xd3, 0x5a, 0xe3, 0x3c, 0x20, 0xfc,
-  0x2d, 0x26, 0x0c, 0x35, 0x7f, 0x5d, 0xb7, 0xf2, 0x2b, 0xe9, 0x0c, 0x5c,
-  0xd9, 0x9f, 0xed, 0x19, 0x51, 0xbd, 0xca, 0xbc, 0x68, 0x1e, 0xd8, 0x8d,
-  0x01, 0xce, 0xef, 0x8c, 0xd9, 0xb7, 0x59, 0x5a, 0x12, 0xca, 0xfc, 0x65,
-  0xa5, 0x91, 0x2a, 0xa8, 0xdc, 0xa4, 0x19, 0x7c, 0x5e, 0xed, 0x4d, 0x61,
-  0x50, 0xcc, 0xd5, 0x68, 0x6b, 0x31, 0x37, 0x94, 0x91, 0xfa, 0xef, 0x24,
-  0x8c, 0x27, 0x36, 0xef, 0xef, 0x63, 0x43, 0xe9, 0xe6, 0xf0, 0x38, 0xf2,
-  0xcb, 0x4a, 0xd1, 0xc9, 0xfa, 0x3c, 0x53, 0x0e, 0x9d, 0x2d, 0xe8, 0x94,
-  0x76, 0xb7, 0xe7, 0x15, 0xab, 0xe5, 0x02, 0x7f, 0xae, 0xf0, 0xa5, 0x38,
-  0x0f, 0x50, 0x22, 0x65, 0x3f, 0x38, 0xf9, 0xbb, 0x6c, 0x02, 0x22, 0xf0,
-  0x2c, 0x32, 0x25, 0x25, 0x67, 0xf8, 0x3b, 0xfb, 0xc2, 0x49, 0xfe, 0x0b,
-  0x1c, 0x5a, 0xe6, 0x46, 0xba, 0x1a, 0xd5, 0x49, 0x27, 0x13, 0x14, 0x2d,
-  0x5b, 0x3d, 0xc1, 0x1d, 0x58, 0xbf, 0x98, 0x22, 0xfe, 0x01, 0xda, 0xb3,
-  0x37, 0xa3, 0x31, 0xbf, 0x1e, 0x0f, 0x46, 0x81, 0x9d, 0xb0, 0x27, 0xd1,
-  0xc9, 0xed, 0xcc, 0xb9, 0x28, 0x2e, 0xef, 0xfa, 0x19, 0xa9, 0x0a, 0x2f,
-  0x3e, 0x43, 0xcd, 0xcb, 0x17, 0x58, 0x05, 0x60, 0x81, 0x46, 0xce, 0xcd,
-  0x01, 0xd0, 0xb2, 0x41, 0x13, 0x12, 0x3b, 0x8a, 0xfe, 0xcd, 0xea, 0x07,
-  0xbc, 0x24, 0x43, 0x32, 0xe7, 0xb7, 0x95, 0x9c, 0xdf, 0x0a, 0x42, 0xe6,
-  0x44, 0x2b, 0xbe, 0x1b, 0x50, 0xf8, 0x02, 0x2f, 0x12, 0xce, 0x1f, 0x32,
-  0xcc, 0x04, 0xb4, 0xed, 0x0d, 0x01, 0x06, 0xef, 0x31, 0xec, 0xc3, 0xd2,
-  0x29, 0x01, 0xc3, 0xc2, 0xe2, 0xae, 0xde, 0xf4, 0x0e, 0x0b, 0xc7, 0xf5,
-  0xcc, 0xbd, 0xf3, 0xc4, 0x47, 0x81, 0xa2, 0x6c, 0x2b, 0x24, 0x61, 0xe2,
-  0x21, 0x21, 0xf1, 0xe7, 0x4c, 0xd0, 0x5f, 0x0a, 0xf1, 0xca, 0xd2, 0x36,
-  0x67, 0xfe, 0xed, 0x8a, 0xb8, 0xb1, 0xef, 0x03, 0xf3, 0x6c, 0xf8, 0x4a,
-  0x77, 0x65, 0xef, 0x61, 0x31, 0x6d, 0x0f, 0x66, 0x02, 0x15, 0x93, 0x21,
-  0x1f, 0x04, 0x08, 0xaa, 0xfa, 0x32, 0x24, 0xc2, 0x24, 0x43, 0xc7, 0x14,
-  0xa5, 0x57, 0x55, 0xf6, 0x02, 0xfd, 0x6e, 0x02, 0x0a, 0xdc, 0x0a, 0xae,
-  0x5c, 0x9e, 0x5b, 0x81, 0x02, 0x25, 0x4f, 0xd7, 0xda, 0xe0, 0xed, 0x13,
-  0xad, 0x1a, 0x1a, 0x23, 0x50, 0x32, 0xe7, 0xb2, 0x41, 0x3d, 0x1d, 0xcc,
-  0x86, 0x5b, 0x4f, 0x09, 0x2f, 0x9e, 0x20, 0x21, 0xc4, 0x36, 0x3f, 0x3a,
-  0x4f, 0x2d, 0x22, 0xd7, 0x0c, 0x31, 0x1d, 0x4d, 0x79, 0xc9, 0x34, 0xef,
-  0xa4, 0xab, 0x1e, 0x40, 0x46, 0x45, 0xdb, 0xf7, 0x9f, 0xdd, 0x4c, 0xb3,
-  0x50, 0xc4, 0xaa, 0x62, 0x30, 0xb4, 0xef, 0x3d, 0x46, 0xc8, 0xb0, 0xae,
-  0x12, 0xbc, 0xf7, 0xca, 0x54, 0xbc, 0xbf, 0xf6, 0x34, 0x01, 0xcd, 0xca,
-  0x05, 0xa5, 0x5f, 0x2f, 0x29, 0xdf, 0x03, 0x49, 0x94, 0x60, 0x30, 0x4e,
-  0x7f, 0x1b, 0xd3, 0x34, 0xc7, 0xbd, 0x2f, 0xe4, 0xc7, 0x70, 0x2f, 0x14,
-  0x1c, 0xb3, 0xdb, 0xff, 0xae, 0xb0, 0x67, 0x28, 0xbb, 0x19, 0x2b, 0xa8,
-  0xae, 0x2f, 0x99, 0xa5, 0xbf, 0xfa, 0xea, 0x0f, 0xc5, 0xc9, 0x09, 0x1a,
-  0xee, 0xb6, 0x27, 0xea, 0x81, 0x26, 0x8e, 0xbb, 0xa7, 0x39, 0x12, 0xa7,
-  0xdb, 0xd0, 0x2d, 0x05, 0x47, 0xf2, 0x1f, 0x33, 0xa6, 0xbc, 0x1c, 0xf8,
-  0xfa, 0x27, 0xae, 0xd5, 0xfd, 0x48, 0x20, 0x14, 0xf5, 0x8f, 0xe6, 0x9c,
-  0x5d, 0x85, 0xdd, 0xad, 0x29, 0x16, 0xfd, 0x0d, 0xd0, 0x29, 0x22, 0x35,
-  0x44, 0x9e, 0x25, 0x4e, 0x55, 0xd9, 0x06, 0x9a, 0xec, 0xc4, 0xc4, 0x5b,
-  0xde, 0xb6, 0xbe, 0xfb, 0x24, 0x72, 0x04, 0x10, 0x66, 0xd3, 0xd3, 0x9c,
-  0xe2, 0x5c, 0xa3, 0xb4, 0xe6, 0xb0, 0x40, 0x26, 0x05, 0x52, 0x10, 0x93,
-  0x3c, 0x06, 0x81, 0xfb, 0x55, 0x40, 0x52, 0x1f, 0x1b, 0x2a, 0xb0, 0x99,
-  0x59, 0x26, 0x6c, 0xdb, 0x50, 0xf6, 0xe5, 0xe2, 0xdc, 0xc4, 0xea, 0x0d,
-  0x5d, 0x1f, 0xfa, 0x9b, 0xe0, 0x27, 0x01, 0x22, 0xf0, 0x51, 0x05, 0x0e,
-  0xeb, 0xfe, 0x19, 0xb5, 0xf2, 0x37, 0xf7, 0xce, 0x50, 0x81, 0xe3, 0xfc,
-  0xc0, 0x43, 0x4b, 0xe2, 0x13, 0xe9, 0x7d, 0x4b, 0xe0, 0x5a, 0x4e, 0x99,
-  0xd0, 0x3f, 0xd4, 0xc7, 0x49, 0x47, 0xf7, 0x47, 0xc6, 0x0e, 0xe7, 0x4c,
-  0x61, 0x10, 0xcf, 0xbd, 0x3f, 0xcb, 0xe9, 0x31, 0x09, 0xed, 0xb3, 0xb3,
-  0x2f, 0xf6, 0x68, 0xdc, 0x35, 0xd8, 0x4e, 0x02, 0x15, 0x71, 0xd9, 0xcd,
-  0xf3, 0xf6, 0x38, 0x30, 0xc9, 0xf9, 0x35, 0xe1, 0xe4, 0xe8, 0xd8, 0xaf,
-  0x86, 0xe9, 0xb2, 0x19, 0xf6, 0xee, 0xff, 0xba, 0x2f, 0x10, 0x1e, 0x32,
-  0xd2, 0xff, 0xc6, 0x03, 0xac, 0x25, 0xf8, 0x63, 0xad, 0x2f, 0x7f, 0xbc,
-  0x30, 0x2c, 0xce, 0xef, 0x39, 0x7c, 0x5f, 0x43, 0xb5, 0x56, 0xb8, 0x38,
-  0x30, 0x52, 0xd9, 0x0c, 0x9d, 0x3e, 0xc7, 0xd8, 0x3d, 0x3b, 0x51, 0xe5,
-  0xe9, 0x1b, 0xb0, 0x31, 0x49, 0x07, 0x81, 0x21, 0xc9, 0x1a, 0xa7, 0x04,
-  0xdd, 0x1c, 0xa1, 0xbd, 0x0d, 0xb7, 0xfb, 0x15, 0xb6, 0x5a, 0x20, 0x2e,
-  0x5f, 0x0f, 0x02, 0xd0, 0x41, 0x26, 0x44, 0x11, 0xf9, 0x2d, 0xdb, 0xb7,
-  0x2c, 0xde, 0xbd, 0x5f, 0x59, 0xdf, 0x34, 0x20, 0x6d, 0x3a, 0xaa, 0x0e,
-  0xf8, 0xc1, 0x03, 0xe3, 0x19, 0x1a, 0xe6, 0x60, 0x1c, 0x5b, 0x1a, 0x54,
-  0x22, 0xc9, 0xb9, 0xcd, 0xd0, 0x55, 0xbd, 0x67, 0x1d, 0x02, 0x02, 0x09,
-  0x53, 0xf9, 0xf1, 0xc3, 0xcf, 0xa6, 0x29, 0xf4, 0xdb, 0x2e, 0x7d, 0xf8,
-  0x6b, 0xc9, 0x35, 0x16, 0xe3, 0xdd, 0x11, 0x39, 0x7f, 0xd8, 0x04, 0xa2,
-  0xb1, 0xd9, 0x3c, 0xe2, 0xc4, 0xec, 0xb3, 0x34, 0xf1, 0x2a, 0xae, 0x24,
-  0x52, 0xf5, 0x1c, 0x1f, 0x31, 0x71, 0xb3, 0xd9, 0xed, 0xef, 0x04, 0xee,
-  0xbb, 0xe1, 0x8f, 0xf1, 0xe3, 0x40, 0xcb, 0xb2, 0x00, 0xfe, 0xc8, 0x08,
-  0x45, 0xee, 0xe4, 0xe7, 0xe5, 0x22, 0x3e, 0x13, 0x0b, 0xd4, 0x31, 0x1b,
-  0xe8, 0x0d, 0xea, 0xba, 0x37, 0xf0, 0x33, 0xb0, 0xfc, 0xc6, 0x44, 0xe6,
-  0xe2, 0xd6, 0xcd, 0x39, 0x02, 0xc9, 0x12, 0x2f, 0xcc, 0xb6, 0x26, 0x81,
-  0x31, 0x08, 0xfd, 0xf5, 0xfb, 0xd9, 0x24, 0xf5, 0xf3, 0xff, 0xb5, 0xcf,
-  0x36, 0x37, 0x34, 0xe8, 0xd8, 0x65, 0x51, 0x40, 0x9e, 0xb6, 0xb4, 0xcd,
-  0xe0, 0x9e, 0xd5, 0x44, 0xb6, 0x9d, 0xf8, 0xec, 0x5d, 0xa3, 0x2e, 0x38,
-  0x5d, 0x64, 0x3b, 0x62, 0xc5, 0xfa, 0xb9, 0x1d, 0x63, 0xb1, 0xe0, 0x4d,
-  0xcb, 0x31, 0xd5, 0x57, 0xfd, 0x14, 0xdf, 0x0c, 0xba, 0xf1, 0x21, 0x15,
-  0x00, 0x81, 0xae, 0x7c, 0x90, 0xda, 0x02, 0x89, 0x31, 0xfa, 0x11, 0xdb,
-  0x38, 0xd4, 0x36, 0xbf, 0xe3, 0xc7, 0x0f, 0x37, 0xc8, 0x41, 0x6e, 0xc0,
-  0xb1, 0xb9, 0x01, 0x41, 0xf7, 0xd9, 0x40, 0x00, 0x09, 0xcf, 0x55, 0x37,
-  0x64, 0xda, 0xd9, 0xe5, 0xf8, 0xa3, 0xfe, 0xab, 0xc7, 0x81, 0xb8, 0xff,
-  0x23, 0x5b, 0xdc, 0xc1, 0xc3, 0xad, 0xd7, 0xde, 0xc9, 0xe9, 0x23, 0x1f,
-  0xcf, 0x4f, 0xda, 0xfc, 0x23, 0x17, 0xe7, 0xea, 0xde, 0xd3, 0x1d, 0x74,
-  0x01, 0x1b, 0x5f, 0xc3, 0x03, 0x57, 0x4a, 0xfa, 0x38, 0xf5, 0x3b, 0x18,
-  0xb9, 0x3d, 0xc5, 0x72, 0xf0, 0x32, 0xe2, 0xb1, 0x9c, 0x36, 0xe6, 0x57,
-  0xb4, 0xb5, 0x18, 0xcb, 0x23, 0x15, 0x1c, 0x60, 0x40, 0x7f, 0x69, 0xca,
-  0xeb, 0x38, 0x57, 0x0f, 0x1c, 0xbf, 0xc5, 0x26, 0xf5, 0x25, 0xd7, 0x29,
-  0x36, 0xd8, 0xe3, 0xe0, 0x0d, 0xd1, 0x32, 0x2a, 0xf0, 0xb9, 0xce, 0x30,
-  0x19, 0xaa, 0x10, 0xd5, 0x33, 0xc3, 0x40, 0xaf, 0x1a, 0x41, 0xfd, 0xfe,
-  0x14, 0xb4, 0xf1, 0xff, 0xde, 0xb5, 0xba, 0xbc, 0xb9, 0x24, 0xd1, 0xef,
-  0x18, 0xf6, 0xd1, 0x39, 0xf2, 0x06, 0x33, 0x0d, 0x58, 0x93, 0xf3, 0x2e,
-  0x4d, 0x0e, 0x2d, 0x4b, 0xad, 0xd4, 0x56, 0xf8, 0x9e, 0x4c, 0x7f, 0x19,
-  0x0c, 0xb3, 0x07, 0xc2, 0x3b, 0xad, 0xbf, 0x00, 0x4f, 0xf8, 0x18, 0x41,
-  0xb0, 0xe8, 0x57, 0x12, 0x18, 0xf3, 0xf3, 0x3f, 0x58, 0x9f, 0xbc, 0xdc,
-  0xd9, 0xf4, 0x09, 0xe4, 0xd9, 0xb9, 0xe2, 0x9b, 0x67, 0x36, 0x3b, 0x5b,
-  0x16, 0xf2, 0xc2, 0xcd, 0x37, 0xf5, 0xc6, 0x24, 0x15, 0x01, 0x14, 0x08,
-  0xfb, 0x9c, 0xb7, 0xfb, 0xe0, 0x0d, 0x48, 0x0a, 0x0a, 0x0e, 0x17, 0xfa,
-  0xd8, 0x81, 0xf2, 0xdc, 0x1e, 0xcc, 0x21, 0xcf, 0xc7, 0xe3, 0x0d, 0x12,
-  0xee, 0xb4, 0x56, 0xcf, 0xeb, 0xcd, 0xc6, 0x16, 0x4c, 0xc1, 0xd7, 0xd5,
-  0x17, 0xef, 0xef, 0xe7, 0xf6, 0x02, 0xc8, 0xc6, 0xe2, 0xa4, 0xfa, 0x34,
-  0xe3, 0x3d, 0x66, 0x4d, 0xff, 0x1a, 0x13, 0x7a, 0x57, 0xf5, 0x38, 0x7f,
-  0x68, 0x9e, 0xe0, 0x4a, 0xda, 0xf4, 0x57, 0x1d, 0xbc, 0x30, 0x0a, 0x22,
-  0x02, 0xfe, 0xe2, 0xf9, 0x2b, 0x31, 0x2f, 0x49, 0xec, 0xfa, 0xc6, 0xac,
-  0x70, 0x12, 0xc6, 0x57, 0xb4, 0x4b, 0x36, 0xd9, 0x03, 0xe8, 0xa4, 0xaf,
-  0x1d, 0x43, 0x58, 0xf0, 0xa2, 0x85, 0x18, 0x05, 0xc0, 0xcd, 0xdd, 0xeb,
-  0x09, 0xe0, 0x0e, 0x50, 0x1d, 0x0c, 0x12, 0x2d, 0xd0, 0x65, 0xa8, 0xd9,
-  0xdd, 0x70, 0x04, 0x4b, 0x2b, 0xda, 0x2d, 0x42, 0x42, 0x0e, 0x14, 0x1c,
-  0x36, 0xa7, 0x84, 0x0e, 0x9b, 0xd7, 0x73, 0x03, 0x52, 0x1f, 0x3a, 0x99,
-  0x81, 0xe1, 0x5c, 0xeb, 0x5c, 0xae, 0x2f, 0x16, 0xb6, 0xd2, 0xf9, 0xac,
-  0xc8, 0xd2, 0xd5, 0xe6, 0x33, 0x97, 0xec, 0x23, 0xff, 0xbf, 0xe4, 0xeb,
-  0xe2, 0xb1, 0x98, 0x9f, 0x92, 0x37, 0x7a, 0x41, 0x05, 0x00, 0x06, 0x2b,
-  0xc1, 0xaa, 0xe2, 0xf5, 0x23, 0x17, 0x26, 0x0f, 0xb3, 0xa4, 0x00, 0x3d,
-  0x5d, 0xf8, 0x0c, 0xab, 0x20, 0x20, 0xcb, 0x36, 0xbc, 0xe7, 0x7f, 0x3e,
-  0x54, 0xe4, 0xd7, 0x37, 0x0a, 0x19, 0xfe, 0x23, 0x08, 0x01, 0xd2, 0x2f,
-  0xe3, 0xc5, 0x22, 0xd0, 0xe7, 0xbb, 0xe9, 0x43, 0x0c, 0x3f, 0x0e, 0x04,
-  0x30, 0xeb, 0xe4, 0xc1, 0xda, 0xf9, 0x1f, 0x02, 0x1b, 0x29, 0xdc, 0xc7,
-  0xcc, 0x10, 0xd9, 0xc0, 0xe3, 0xdd, 0xc8, 0xbc, 0x5d, 0x27, 0x1a, 0xc3,
-  0x3e, 0x9b, 0xf2, 0xa8, 0xe6, 0x0e, 0xc2, 0xca, 0x2b, 0xb3, 0xc8, 0xf4,
-  0xf8, 0x0a, 0xd4, 0xd4, 0x9c, 0xd4, 0xc3, 0x1d, 0x10, 0xf8, 0xea, 0x17,
-  0x1c, 0x0a, 0xf3, 0xe7, 0x14, 0xce, 0xcc, 0x19, 0x43, 0xd2, 0x13, 0xbf,
-  0x34, 0x3c, 0x81, 0x1a, 0x40, 0x03, 0x51, 0x08, 0x42, 0x33, 0x10, 0xff,
-  0xc0, 0x95, 0xef, 0x1a, 0x32, 0xbc, 0xd9, 0x31, 0xe1, 0x31, 0x06, 0x53,
-  0xc0, 0xef, 0xcf, 0x61, 0x46, 0xe4, 0x33, 0xf4, 0x29, 0x4c, 0x29, 0x03,
-  0x49, 0x7f, 0xfc, 0x1b, 0xbb, 0x01, 0x11, 0x55, 0x4f, 0x3b, 0xed, 0x36,
-  0x21, 0x50, 0x06, 0x37, 0xc1, 0x1b, 0xce, 0xc8, 0xe7, 0xa9, 0x4d, 0xaf,
-  0xdf, 0xf5, 0xbe, 0xdb, 0xc8, 0xd4, 0xda, 0x23, 0x06, 0xb2, 0x22, 0x47,
-  0x0d, 0x3b, 0x5d, 0x16, 0xf9, 0xc5, 0x23, 0xc5, 0xfc, 0xd7, 0xc9, 0x01,
-  0x47, 0xe5, 0x1e, 0xbb, 0xec, 0x0b, 0x3c, 0xc7, 0x2d, 0x14, 0x4a, 0x3e,
-  0x0b, 0xda, 0xf1, 0xc5, 0x05, 0x2e, 0xd7, 0x1a, 0xf2, 0x35, 0xfa, 0x09,
-  0x44, 0x31, 0x17, 0x3d, 0x4d, 0x1d, 0x81, 0xd7, 0xfa, 0xd8, 0x9b, 0xfe,
-  0x2d, 0x33, 0xa9, 0x51, 0x6e, 0xc4, 0xc8, 0x24, 0x48, 0xc6, 0x0b, 0xb5,
-  0xde, 0x3f, 0xfb, 0xe7, 0x34, 0xb1, 0x10, 0x3b, 0x34, 0x0b, 0xd9, 0xec,
-  0x17, 0x1a, 0x0a, 0xf3, 0xe9, 0xe9, 0x0d, 0x28, 0xc9, 0xd4, 0xf6, 0x81,
-  0x1a, 0x33, 0xfe, 0x0a, 0xd4, 0x12, 0xdb, 0x1d, 0xda, 0x37, 0xa5, 0xda,
-  0xd6, 0xdd, 0xb4, 0xd8, 0xb0, 0xc7, 0xcc, 0x38, 0x3f, 0xe5, 0xec, 0x10,
-  0xfa, 0x11, 0x1b, 0x5b, 0x03, 0x0e, 0x23, 0x00, 0x03, 0xf1, 0xb6, 0x89,
-  0xd7, 0x2f, 0xc5, 0xd3, 0xe7, 0x0b, 0xf5, 0xef, 0xfd, 0x34, 0xcb, 0x0d,
-  0x11, 0xf2, 0xd8, 0x3c, 0x3d, 0xf3, 0xc7, 0xc6, 0x6a, 0x98, 0x67, 0xcb,
-  0x36, 0xd3, 0x37, 0xfb, 0xea, 0xb7, 0x1d, 0x35, 0x1b, 0xda, 0xbb, 0x23,
-  0xc7, 0x03, 0xaa, 0xbe, 0xe7, 0x23, 0x66, 0x04, 0x4a, 0x09, 0x70, 0x09,
-  0x7f, 0xdb, 0xb8, 0x41, 0x62, 0x24, 0x07, 0xc5, 0xef, 0x2d, 0xc8, 0xda,
-  0x1e, 0x50, 0xf2, 0x36, 0xd8, 0xfd, 0x10, 0xd2, 0xcd, 0xfb, 0x24, 0x64,
-  0x55, 0xa9, 0x68, 0x98, 0x00, 0xff, 0x37, 0xbb, 0xe6, 0xdd, 0x11, 0xb9,
-  0xaf, 0xcf, 0xbe, 0x46, 0xf1, 0xd0, 0x47, 0x0a, 0xeb, 0xf1, 0xec, 0x19,
-  0x22, 0x8e, 0x1c, 0x2a, 0xc2, 0xd8, 0xc9, 0x58, 0x20, 0xe0, 0xea, 0x58,
-  0x22, 0xce, 0xc4, 0xea, 0xeb, 0xe6, 0x7f, 0x18, 0x63, 0xe9, 0xbd, 0x44,
-  0x3c, 0xc7, 0x02, 0x03, 0x2c, 0x32, 0xc4, 0x4a, 0xa9, 0x08, 0x3f, 0x13,
-  0x08, 0xc5, 0xc7, 0x9f, 0x10, 0xfd, 0x06, 0x31, 0x01, 0x5a, 0xda, 0x30,
-  0x6d, 0x04, 0x0a, 0xc4, 0x1c, 0xf0, 0xf0, 0xe5, 0xec, 0x1e, 0x15, 0xda,
-  0x23, 0xf5, 0xd8, 0xd7, 0x16, 0xa8, 0xd1, 0x02, 0x2a, 0xf3, 0x2f, 0x60,
-  0x1c, 0x7e, 0x18, 0xf5, 0x7b, 0xe1, 0x53, 0xc5, 0xe8, 0x1b, 0x56, 0x13,
-  0x27, 0x3e, 0x33, 0x81, 0xd4, 0xb4, 0xdb, 0x91, 0x43, 0x60, 0x18, 0x4e,
-  0x1c, 0xc1, 0xb7, 0xdf, 0xd0, 0x49, 0xd9, 0xe1, 0x49, 0x09, 0xae, 0x12,
-  0x2a, 0x3a, 0x1f, 0xda, 0x23, 0x6e, 0xfc, 0xdb, 0xdf, 0x1d, 0xb8, 0x00,
-  0x65, 0x22, 0xb9, 0xa5, 0xe1, 0x05, 0x09, 0xd9, 0x7f, 0x0b, 0x28, 0x65,
-  0x1d, 0xf3, 0xb9, 0x15, 0x75, 0xe7, 0x04, 0xfc, 0x17, 0xcc, 0xe0, 0xf0,
-  0x69, 0x0e, 0xb2, 0xff, 0xf0, 0x4d, 0x7a, 0x01, 0x15, 0x38, 0x16, 0xc7,
-  0x9e, 0x53, 0x10, 0x9f, 0x53, 0x00, 0x0f, 0xa4, 0x1e, 0x22, 0x03, 0x40,
-  0x4b, 0xef, 0xfa, 0x08, 0xd5, 0xc5, 0xcd, 0x4a, 0x1c, 0x11, 0x56, 0x14,
-  0xc5, 0xa0, 0x44, 0x4d, 0xc1, 0xc4, 0x47, 0xbc, 0xb1, 0xf0, 0x39, 0xcc,
-  0x23, 0x40, 0xc6, 0x20, 0xd9, 0xd9, 0x98, 0xd3, 0x56, 0x4b, 0xf4, 0x81,
-  0x41, 0x00, 0x32, 0xc6, 0x1c, 0xc1, 0x53, 0x03, 0x39, 0x98, 0xf5, 0x15,
-  0x38, 0x05, 0xfd, 0xc3, 0xa9, 0xbe, 0x3c, 0xa0, 0xa9, 0x67, 0x59, 0x5a,
-  0xcb, 0x94, 0x49, 0x39, 0x27, 0xab, 0xfa, 0x14, 0x34, 0x45, 0xf2, 0xbc,
-  0xf8, 0x52, 0xec, 0xe3, 0xc0, 0xe1, 0x1c, 0xea, 0xc7, 0x64, 0xe5, 0x13,
-  0xb3, 0xe5, 0xeb, 0x13, 0xd7, 0xa4, 0x33, 0x1c, 0x7f, 0xdd, 0xf7, 0xc7,
-  0x36, 0x1d, 0xf4, 0x01, 0x16, 0x42, 0x4b, 0x9e, 0xd2, 0xe0, 0xad, 0x6c,
-  0xeb, 0x20, 0x16, 0x4f, 0x0e, 0xc6, 0x05, 0xc3, 0x29, 0xa4, 0xdc, 0xfe,
-  0xa8, 0x0d, 0xd5, 0x3c, 0xff, 0x11, 0x2d, 0x3e, 0x1b, 0x6a, 0x54, 0xbb,
-  0xd2, 0x5e, 0x5c, 0x07, 0x40, 0x93, 0xc2, 0xdc, 0x51, 0x04, 0x0a, 0x4d,
-  0x0d, 0x15, 0x31, 0x31, 0xb7, 0x3e, 0x1f, 0xec, 0x38, 0xd4, 0xe3, 0xf0,
-  0xeb, 0x4f, 0xfe, 0x13, 0xbd, 0xdf, 0xe8, 0x17, 0x3a, 0x56, 0x56, 0x7f,
-  0xd2, 0x1d, 0x1f, 0xe1, 0xdd, 0xdc, 0xcc, 0xc0, 0xfd, 0x2b, 0xe2, 0xe0,
-  0xf9, 0x35, 0xda, 0x43, 0xf1, 0xbb, 0x12, 0x1d, 0x16, 0xb5, 0xa6, 0x0c,
-  0x09, 0x10, 0xf2, 0xb0, 0x27, 0x26, 0xb3, 0xab, 0x6f, 0x11, 0x1a, 0xc4,
-  0x2e, 0x2c, 0x5e, 0x3c, 0x1e, 0x22, 0x88, 0x09, 0xdd, 0x57, 0x7b, 0xce,
-  0xc1, 0xf0, 0x26, 0x0b, 0xe1, 0xaa, 0xd2, 0xbf, 0x42, 0x93, 0xe0, 0xac,
-  0x1e, 0x18, 0x0a, 0x04, 0xeb, 0xe9, 0x51, 0x68, 0x4e, 0x67, 0xf0, 0x67,
-  0x1b, 0x5e, 0x18, 0x27, 0xba, 0x75, 0x4a, 0xd5, 0x4c, 0xe0, 0x34, 0x52,
-  0x21, 0x77, 0x27, 0x36, 0x81, 0xd5, 0x50, 0x62, 0x76, 0x07, 0x59, 0xa4,
-  0xc8, 0xd5, 0x57, 0xe9, 0x33, 0x1e, 0x08, 0x92, 0x05, 0x30, 0x74, 0x23,
-  0xdc, 0xf2, 0x9b, 0xc9, 0x61, 0xf1, 0xe2, 0xd4, 0x6b, 0xb6, 0x45, 0x51,
-  0xed, 0x7f, 0x08, 0xc4, 0x0f, 0x27, 0x45, 0xa8, 0x31, 0x79, 0x3d, 0xf9,
-  0xfc, 0x1d, 0x89, 0x0f, 0x1b, 0x2f, 0x48, 0x18, 0x27, 0xb3, 0xb6, 0xee,
-  0x31, 0xe9, 0x3b, 0x40, 0x35, 0x82, 0xfa, 0x51, 0x96, 0xca, 0x30, 0xd6,
-  0xc2, 0x22, 0x96, 0xd9, 0xd5, 0xab, 0xbf, 0xe6, 0x52, 0x6c, 0x91, 0xbf,
-  0xcf, 0x93, 0xf7, 0x10, 0xf3, 0xff, 0x86, 0xbe, 0xf3, 0x65, 0xc6, 0x30,
-  0xf0, 0xbc, 0xc0, 0x3a, 0xca, 0xc3, 0xe7, 0xb8, 0x03, 0x92, 0xae, 0xa8,
-  0x02, 0x4f, 0x23, 0xad, 0x36, 0xf8, 0x31, 0x35, 0xd1, 0x28, 0x5b, 0x4e,
-  0x56, 0x3f, 0x96, 0x81, 0xde, 0x06, 0x19, 0x89, 0xab, 0xcd, 0xdf, 0xeb,
-  0xea, 0xe7, 0x06, 0x9e, 0x23, 0x2f, 0x5f, 0x32, 0xe4, 0x18, 0x3f, 0x13,
-  0x2e, 0xf3, 0x2f, 0x17, 0xb0, 0xf7, 0xc7, 0xf0, 0x41, 0xd0, 0xec, 0xbb,
-  0xf0, 0x13, 0x9d, 0x5e, 0x1b, 0x02, 0x03, 0x3f, 0xcc, 0x57, 0xbb, 0x55,
-  0x1c, 0x3d, 0xf0, 0x27, 0xcd, 0x92, 0xce, 0x60, 0x17, 0xdc, 0xf4, 0x1d,
-  0xc1, 0x37, 0xca, 0xd7, 0xe1, 0xe6, 0xf6, 0x1c, 0x9d, 0xb1, 0xed, 0xc7,
-  0x1c, 0x5c, 0x14, 0xe5, 0x7f, 0x34, 0x8c, 0xe4, 0x1f, 0x3a, 0x21, 0x21,
-  0x02, 0x2c, 0x41, 0xc8, 0xeb, 0xd4, 0xfc, 0xb2, 0x9f, 0x0b, 0x4e, 0x38,
-  0xb0, 0x9c, 0x56, 0xad, 0x36, 0xa6, 0x3d, 0x15, 0x63, 0xd7, 0x44, 0x47,
-  0x4e, 0xa3, 0xb1, 0x60, 0xd5, 0x5d, 0xa9, 0x4f, 0x30, 0x11, 0x7f, 0xca,
-  0x0b, 0xa9, 0xc1, 0x0f, 0xbf, 0xee, 0x50, 0xef, 0xb7, 0x16, 0x3d, 0x07,
-  0xc5, 0x94, 0xcd, 0x4a, 0x5f, 0x3d, 0x3b, 0x39, 0xde, 0x24, 0x12, 0x29,
-  0xe3, 0x57, 0xc7, 0x3c, 0xbc, 0x11, 0x4d, 0x53, 0x46, 0x53, 0x18, 0xc2,
-  0x9f, 0x54, 0xcb, 0xe6, 0x3b, 0x0e, 0x32, 0xd2, 0x17, 0xc2, 0xe5, 0xe8,
-  0xdc, 0x30, 0x09, 0x81, 0x50, 0x0d, 0xdc, 0x25, 0xdf, 0x08, 0x84, 0xd9,
-  0xac, 0x08, 0x36, 0x4a, 0x56, 0xc3, 0x24, 0xd0, 0x3c, 0xe2, 0xbb, 0x68,
-  0xf7, 0xcc, 0xc8, 0x1a, 0x91, 0x52, 0x06, 0x69, 0x3c, 0x3e, 0x57, 0x42,
-  0xde, 0x56, 0xef, 0x1d, 0x37, 0x85, 0xac, 0x36, 0x2e, 0xd4, 0x1a, 0x1b,
-  0xc9, 0xd5, 0x51, 0x1e, 0xe9, 0x2a, 0xd6, 0x55, 0x16, 0x2c, 0x52, 0x52,
-  0xf2, 0xb2, 0xcf, 0x22, 0x17, 0x46, 0xb5, 0x88, 0xd9, 0xc4, 0x16, 0xc9,
-  0x08, 0x63, 0xcb, 0xc8, 0x63, 0x33, 0x81, 0xea, 0xde, 0xac, 0xdc, 0xc0,
-  0xbc, 0xfb, 0xf0, 0x5e, 0xe0, 0xce, 0x42, 0x0c, 0x1c, 0x38, 0x37, 0x17,
-  0x06, 0x13, 0xad, 0x13, 0x29, 0x0c, 0xc4, 0x0c, 0x10, 0x33, 0x2f, 0xe5,
-  0x41, 0x33, 0xd0, 0xb4, 0x16, 0x35, 0x65, 0x41, 0x3d, 0x03, 0x30, 0x0e,
-  0x87, 0xae, 0xba, 0x29, 0x10, 0xf7, 0x22, 0xd7, 0x9e, 0x03, 0xc6, 0x7f,
-  0x24, 0x07, 0x15, 0x19, 0x2b, 0x5b, 0xaf, 0x75, 0x40, 0x9c, 0x70, 0x1e,
-  0x5a, 0xac, 0xc4, 0xc5, 0x1b, 0xc2, 0xd3, 0xdd, 0xd7, 0x3c, 0xf3, 0xd0,
-  0x8d, 0x1f, 0xbe, 0x58, 0x3e, 0xb0, 0xcf, 0xb5, 0xe9, 0xe0, 0x11, 0x35,
-  0xb9, 0xc8, 0x06, 0xc8, 0x2a, 0x5c, 0x20, 0x1e, 0x53, 0xb9, 0xb1, 0x2c,
-  0x6b, 0xe3, 0x26, 0x81, 0x01, 0xc0, 0x21, 0xef, 0xae, 0x4f, 0x41, 0xc5,
-  0x94, 0x2b, 0xe9, 0xfb, 0x06, 0x66, 0x51, 0x6c, 0x47, 0xfb, 0x01, 0x31,
-  0x94, 0x6f, 0x0b, 0x50, 0xd3, 0xe5, 0xed, 0xc7, 0x36, 0xb6, 0xf6, 0x03,
-  0x05, 0x99, 0xf5, 0x11, 0xcb, 0x48, 0x25, 0x44, 0x94, 0xda, 0xeb, 0x68,
-  0x06, 0x3b, 0x76, 0xc0, 0xb1, 0xea, 0xce, 0x27, 0xea, 0x40, 0x21, 0xac,
-  0xae, 0x3d, 0xe5, 0x41, 0xff, 0x2c, 0x5c, 0x8d, 0xce, 0x41, 0x2a, 0xee,
-  0xed, 0x1e, 0xf0, 0x21, 0x0f, 0x13, 0x34, 0x7f, 0x19, 0xcd, 0xf6, 0x91,
-  0xb7, 0x08, 0x26, 0xae, 0x4e, 0xc8, 0x1a, 0xd3, 0x1e, 0x1b, 0xf6, 0x24,
-  0x53, 0x3d, 0xab, 0xf2, 0xb7, 0xd8, 0xfb, 0x60, 0xf4, 0xd1, 0x43, 0xdb,
-  0x60, 0xe6, 0xe1, 0xd6, 0x2e, 0xf5, 0x00, 0xc6, 0x02, 0xce, 0x26, 0xbe,
-  0x22, 0xe3, 0xce, 0xec, 0x4e, 0x0e, 0x11, 0xea, 0x35, 0xbf, 0xf4, 0xd6,
-  0x10, 0x2d, 0xd9, 0x1a, 0x2a, 0x01, 0xca, 0x48, 0xf0, 0x16, 0x19, 0xb7,
-  0x4e, 0x2c, 0x2c, 0x16, 0x27, 0xe8, 0x16, 0x17, 0xfe, 0x04, 0x46, 0xb9,
-  0x32, 0x54, 0x81, 0x84, 0xd3, 0x20, 0xce, 0xfa, 0xed, 0x5b, 0x0f, 0xe1,
-  0xbf, 0x3e, 0x18, 0xf8, 0xfe, 0x23, 0x60, 0xf4, 0x43, 0xf9, 0x28, 0x33,
-  0xd8, 0xd8, 0x77, 0x10, 0xf1, 0x3f, 0xc4, 0x29, 0x51, 0x07, 0x07, 0x1e,
-  0x1b, 0xee, 0xe6, 0xfa, 0xdd, 0xd9, 0x2b, 0xc8, 0xde, 0x67, 0xf5, 0x4b,
-  0xfb, 0x0f, 0xb2, 0x0e, 0x1d, 0x59, 0x0e, 0x9d, 0x35, 0x3f, 0xfb, 0x12,
-  0xc2, 0x2a, 0x5e, 0xf1, 0x26, 0x34, 0xeb, 0xad, 0xec, 0x36, 0xf7, 0xdb,
-  0x00, 0x05, 0x43, 0xff, 0x2e, 0x47, 0x05, 0x08, 0xdf, 0x3b, 0x2d, 0x34,
-  0x55, 0x56, 0x42, 0xf0, 0x1f, 0xd3, 0x7f, 0xe5, 0x45, 0xd2, 0x1d, 0x43,
-  0x12, 0x29, 0xb1, 0x49, 0x18, 0x04, 0x2c, 0x24, 0x20, 0xd6, 0x9d, 0xc4,
-  0xa8, 0xbb, 0x21, 0xe0, 0xaf, 0x46, 0x05, 0xa1, 0xbe, 0xc6, 0xbc, 0x2a,
-  0x4c, 0x0f, 0xff, 0x93, 0x52, 0x48, 0xd1, 0x0b, 0xfd, 0x61, 0x27, 0x50,
-  0x5b, 0x19, 0x0d, 0x19, 0x0b, 0xcf, 0xad, 0xd6, 0x81, 0x04, 0x33, 0xf7,
-  0x24, 0x00, 0xb8, 0x05, 0x33, 0x18, 0x06, 0xe9, 0xbc, 0xb1, 0xf2, 0xd4,
-  0x19, 0xfc, 0xbd, 0xf3, 0x55, 0xd8, 0x10, 0xfb, 0xf0, 0xee, 0x2e, 0x1d,
-  0x02, 0x11, 0x28, 0x32, 0x48, 0xf7, 0xb5, 0xd4, 0xf3, 0xe8, 0xc7, 0x2b,
-  0xbb, 0xb8, 0xde, 0xdd, 0xe8, 0x1d, 0x01, 0x3c, 0x37, 0x53, 0xbb, 0x4b,
-  0x2c, 0x15, 0xd1, 0x1d, 0x9f, 0x1c, 0x08, 0x22, 0xd0, 0x81, 0xcd, 0x2f,
-  0x4b, 0x0b, 0x3d, 0xf6, 0xdc, 0x37, 0xfa, 0xb0, 0xea, 0xf1, 0x48, 0x22,
-  0xff, 0x2d, 0xea, 0x3c, 0x0e, 0x4b, 0xff, 0x11, 0xd9, 0xc5, 0xd1, 0xc7,
-  0x34, 0xcf, 0xf6, 0x08, 0xf4, 0x62, 0xbf, 0xa4, 0x26, 0xed, 0x19, 0x03,
-  0xa8, 0xd6, 0x0e, 0xb9, 0xac, 0x5b, 0x76, 0xd2, 0x40, 0xba, 0x4d, 0xda,
-  0x34, 0x50, 0xe1, 0x0a, 0xe3, 0x37, 0x46, 0xd5, 0x6f, 0x34, 0xd2, 0x25,
-  0xe9, 0xee, 0x91, 0x17, 0x7f, 0xc7, 0x5b, 0xbb, 0x5b, 0xc8, 0xd8, 0xed,
-  0xb2, 0x4f, 0x64, 0xe9, 0xbb, 0x28, 0xb7, 0xb2, 0x52, 0xd4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x44, 0xf5, 0xff, 0xff,
-  0x63, 0x01, 0x00, 0x00, 0x28, 0xfc, 0xff, 0xff, 0x3a, 0x0d, 0x00, 0x00,
-  0x97, 0xff, 0xff, 0xff, 0x8a, 0xee, 0xff, 0xff, 0x99, 0xfc, 0xff, 0xff,
-  0x14, 0x0a, 0x00, 0x00, 0xf1, 0xff, 0xff, 0xff, 0x3c, 0xfd, 0xff, 0xff,
-  0x44, 0xff, 0xff, 0xff, 0x09, 0xfd, 0xff, 0xff, 0x84, 0x02, 0x00, 0x00,
-  0x52, 0xf4, 0xff, 0xff, 0xc4, 0x07, 0x00, 0x00, 0x06, 0xfb, 0xff, 0xff,
-  0x37, 0xfc, 0xff, 0xff, 0x43, 0xfd, 0xff, 0xff, 0x56, 0xf6, 0xff, 0xff,
-  0x37, 0x02, 0x00, 0x00, 0xc9, 0xfe, 0xff, 0xff, 0xb8, 0xf1, 0xff, 0xff,
-  0x5a, 0xfe, 0xff, 0xff, 0xc6, 0x18, 0x00, 0x00, 0x72, 0xfc, 0xff, 0xff,
-  0x95, 0xfa, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xff, 0xf9, 0xf6, 0xff, 0xff,
-  0x1a, 0xf9, 0xff, 0xff, 0xac, 0x0b, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00,
-  0x51, 0x02, 0x00, 0x00, 0x60, 0xfa, 0xff, 0xff, 0xdb, 0x08, 0x00, 0x00,
-  0xac, 0x06, 0x00, 0x00, 0x23, 0xf7, 0xff, 0xff, 0x38, 0x02, 0x00, 0x00,
-  0xb2, 0xfe, 0xff, 0xff, 0xd7, 0x0d, 0x00, 0x00, 0x09, 0xf3, 0xff, 0xff,
-  0x02, 0xfb, 0xff, 0xff, 0x8a, 0x0b, 0x00, 0x00, 0xfd, 0xf9, 0xff, 0xff,
-  0xaa, 0x01, 0x00, 0x00, 0x7a, 0xf8, 0xff, 0xff, 0xe8, 0xf5, 0xff, 0xff,
-  0x51, 0x03, 0x00, 0x00, 0xb2, 0xfb, 0xff, 0xff, 0xf9, 0x01, 0x00, 0x00,
-  0xae, 0xea, 0xff, 0xff, 0x3d, 0xfe, 0xff, 0xff, 0x08, 0x12, 0x00, 0x00,
-  0xce, 0xfc, 0xff, 0xff, 0xad, 0xf7, 0xff, 0xff, 0x3e, 0xf7, 0xff, 0xff,
-  0xe2, 0x00, 0x00, 0x00, 0xcf, 0x02, 0x00, 0x00, 0xd6, 0xf9, 0xff, 0xff,
-  0x88, 0xfe, 0xff, 0xff, 0xb7, 0xf6, 0xff, 0xff, 0xd2, 0xed, 0xff, 0xff,
-  0xf5, 0x02, 0x00, 0x00, 0xc0, 0xfd, 0xff, 0xff, 0xb2, 0x01, 0x00, 0x00,
-  0x5e, 0xd5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0x42, 0xa0, 0x81, 0xbd, 0x7f, 0xad, 0x1b, 0x61, 0x2e, 0xb2, 0x92, 0xba,
-  0xb6, 0xe9, 0x8f, 0x4a, 0x4a, 0x1f, 0x1f, 0x4d, 0x81, 0x7f, 0xd2, 0xfd,
-  0x5f, 0xd7, 0xca, 0x7f, 0xb5, 0xdf, 0x10, 0x7f, 0xaa, 0x4c, 0x7f, 0x7f,
-  0x3e, 0x34, 0x0a, 0x66, 0x16, 0xa6, 0x43, 0x7f, 0x81, 0xf3, 0x9e, 0xf9,
-  0xba, 0xf5, 0x81, 0x9b, 0xff, 0xf4, 0x13, 0x16, 0x6a, 0xba, 0x4e, 0x5c,
-  0x68, 0x14, 0x31, 0x7f, 0xe5, 0xb9, 0x99, 0x81, 0x21, 0xac, 0xf8, 0x2e,
-  0xf8, 0xc4, 0x74, 0x41, 0x12, 0x81, 0x2d, 0x7f, 0x55, 0x7f, 0x55, 0x55,
-  0xca, 0x41, 0x81, 0xee, 0x7f, 0x3b, 0x00, 0x14, 0x0e, 0x26, 0x5a, 0x56,
-  0x44, 0xd2, 0x1f, 0x01, 0xfb, 0xa8, 0x1f, 0xac, 0x45, 0xe5, 0xfe, 0x22,
-  0xfe, 0xf3, 0x0f, 0x35, 0xb6, 0x23, 0xdc, 0x8c, 0xf8, 0xe9, 0x78, 0xc0,
-  0xa2, 0xc5, 0xc9, 0xd4, 0x2e, 0x5d, 0x73, 0x2a, 0x7f, 0x52, 0x34, 0x92,
-  0x1c, 0x09, 0x6e, 0x79, 0x07, 0x81, 0xb3, 0xea, 0x85, 0x2a, 0x81, 0x7e,
-  0x60, 0xe6, 0x08, 0xfe, 0x15, 0x22, 0x00, 0x81, 0x25, 0xe4, 0x5d, 0x3d,
-  0xa9, 0x49, 0x34, 0xd5, 0x13, 0xf1, 0x6a, 0xb3, 0x7f, 0x97, 0x81, 0x67,
-  0x4a, 0xa7, 0xc5, 0x3f, 0xc1, 0x2a, 0x27, 0xe3, 0x99, 0x2f, 0x0d, 0x81,
-  0x45, 0x0e, 0x7f, 0x48, 0x16, 0x2c, 0x79, 0xbb, 0x7f, 0x39, 0x41, 0xa1,
-  0x12, 0x31, 0xd9, 0x33, 0x1b, 0x1b, 0x7f, 0x7f, 0xb7, 0x3a, 0xad, 0xa7,
-  0xc1, 0x8e, 0x32, 0x22, 0x7f, 0x52, 0x1e, 0x64, 0x9d, 0x58, 0xcb, 0xe0,
-  0xe6, 0x17, 0x5d, 0x3b, 0xe0, 0xea, 0x31, 0xd6, 0x8d, 0x29, 0x59, 0x0a,
-  0x49, 0x3e, 0xe7, 0x04, 0x7f, 0x16, 0x7f, 0x43, 0xda, 0x2d, 0x0c, 0x7f,
-  0xfc, 0xed, 0xbe, 0xdc, 0x9e, 0x7f, 0x62, 0x7f, 0xfd, 0x20, 0x31, 0x40,
-  0x5f, 0x41, 0x7b, 0xe1, 0x6d, 0xac, 0xa2, 0x03, 0xcc, 0xf8, 0x67, 0x39,
-  0xf5, 0xf6, 0x14, 0x0a, 0x44, 0x31, 0x46, 0xd7, 0x32, 0x13, 0x7f, 0xf5,
-  0xa2, 0x10, 0xa6, 0xf8, 0xf7, 0xbb, 0x37, 0x23, 0xf8, 0x4f, 0xe5, 0xe3,
-  0x33, 0x55, 0x3b, 0x04, 0x0c, 0xe0, 0xe4, 0xa2, 0x1d, 0xa8, 0xc1, 0x7c,
-  0x28, 0xb9, 0x7f, 0x5d, 0xda, 0x5a, 0x13, 0xe8, 0xd7, 0x6f, 0x50, 0x5f,
-  0x7f, 0x7f, 0xbf, 0x7f, 0x9e, 0xdb, 0x3e, 0x33, 0x40, 0xf8, 0x2d, 0x16,
-  0xcf, 0x38, 0xc9, 0x33, 0xc0, 0xeb, 0x6d, 0xc6, 0x81, 0xe3, 0x96, 0x10,
-  0x4d, 0xea, 0x63, 0x28, 0xce, 0x0c, 0xb2, 0xe9, 0x17, 0x27, 0x94, 0xdf,
-  0xc2, 0x3e, 0x7f, 0x1a, 0xd1, 0x5f, 0xfe, 0x1f, 0xfc, 0xcb, 0xf8, 0x81,
-  0x42, 0xbf, 0x8e, 0x60, 0xb4, 0xf9, 0x3f, 0x49, 0xb9, 0x38, 0xc6, 0x15,
-  0x3a, 0x42, 0x33, 0xe5, 0x72, 0xf0, 0xf9, 0xe8, 0x97, 0xfb, 0x25, 0xf5,
-  0xbe, 0x9b, 0x96, 0xf9, 0xbc, 0x29, 0xea, 0x14, 0x81, 0xd7, 0x77, 0x99,
-  0xaf, 0xd2, 0x3b, 0x1d, 0x0f, 0x75, 0x18, 0x7f, 0xe1, 0xe0, 0xa7, 0x30,
-  0x77, 0x2b, 0x7f, 0x05, 0x81, 0xf0, 0xcf, 0xb8, 0xd3, 0xd9, 0xee, 0xe6,
-  0x2d, 0x0f, 0x01, 0x8c, 0x43, 0x7f, 0xe5, 0xe7, 0x90, 0xf0, 0x0a, 0x1b,
-  0xb3, 0x52, 0xe9, 0x20, 0x8f, 0x07, 0xd3, 0x0e, 0x4c, 0x9f, 0x28, 0xb6,
-  0x3b, 0x7f, 0x7f, 0x56, 0xf9, 0x81, 0xf0, 0x21, 0xf4, 0x7f, 0xab, 0xd8,
-  0x8e, 0xc1, 0xc5, 0x27, 0x17, 0x17, 0x6a, 0x26, 0x0e, 0x74, 0x14, 0xf9,
-  0xf7, 0x21, 0xe7, 0xfe, 0xe7, 0x81, 0x60, 0xf1, 0x28, 0x7f, 0x56, 0xfa,
-  0xf6, 0x10, 0xaa, 0x36, 0x11, 0xb9, 0xe5, 0x45, 0x48, 0x6b, 0x70, 0xfd,
-  0xae, 0x81, 0x62, 0x17, 0x85, 0x0f, 0x39, 0x36, 0x36, 0xf8, 0xae, 0xb7,
-  0xfb, 0xea, 0xd5, 0x61, 0x23, 0x5e, 0x64, 0x15, 0x6b, 0x87, 0x64, 0xd4,
-  0xf7, 0x10, 0xab, 0xe0, 0x9e, 0xbb, 0x7f, 0x81, 0xbf, 0x04, 0x4c, 0x05,
-  0x04, 0xd9, 0x7f, 0x1f, 0x49, 0x43, 0x2b, 0x1a, 0x1e, 0x49, 0x4b, 0xe9,
-  0xf4, 0x73, 0x8a, 0x3e, 0x7f, 0x7f, 0x9e, 0xb3, 0x78, 0x81, 0xb5, 0x25,
-  0xea, 0x5e, 0x82, 0x2a, 0x2f, 0xe4, 0x92, 0xd3, 0x81, 0x7f, 0x54, 0x10,
-  0x7f, 0x1b, 0x0a, 0x22, 0x30, 0xe7, 0x81, 0xa6, 0x8c, 0x4a, 0xe7, 0xc7,
-  0xaa, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xda, 0xf7, 0xff, 0xff, 0x2c, 0x0b, 0x00, 0x00, 0xa3, 0x05, 0x00, 0x00,
-  0x02, 0x06, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x2a, 0xfd, 0xff, 0xff,
-  0x50, 0xfd, 0xff, 0xff, 0xc3, 0xf5, 0xff, 0xff, 0xeb, 0x0d, 0x00, 0x00,
-  0xf8, 0x08, 0x00, 0x00, 0xa7, 0xfc, 0xff, 0xff, 0x2f, 0x08, 0x00, 0x00,
-  0x6e, 0x0b, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0xda, 0xfc, 0xff, 0xff,
-  0xd9, 0xf6, 0xff, 0xff, 0x59, 0xfb, 0xff, 0xff, 0x0d, 0xf6, 0xff, 0xff,
-  0x26, 0xf6, 0xff, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0x22, 0x09, 0x00, 0x00,
-  0xe0, 0xf5, 0xff, 0xff, 0x05, 0x0b, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00,
-  0x8b, 0xf7, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xc2, 0xf5, 0xff, 0xff,
-  0xd6, 0xfa, 0xff, 0xff, 0xa4, 0x07, 0x00, 0x00, 0xb5, 0xf4, 0xff, 0xff,
-  0x79, 0xfa, 0xff, 0xff, 0xe6, 0xfc, 0xff, 0xff, 0xc6, 0x00, 0x00, 0x00,
-  0x10, 0xf8, 0xff, 0xff, 0xee, 0xfb, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xff,
-  0x5d, 0xf6, 0xff, 0xff, 0xa8, 0x0b, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00,
-  0x55, 0x01, 0x00, 0x00, 0xb5, 0xf6, 0xff, 0xff, 0x67, 0x00, 0x00, 0x00,
-  0x5b, 0xff, 0xff, 0xff, 0xa6, 0xf2, 0xff, 0xff, 0x94, 0x0a, 0x00, 0x00,
-  0x4a, 0x04, 0x00, 0x00, 0x96, 0xfb, 0xff, 0xff, 0x87, 0xf8, 0xff, 0xff,
-  0x6d, 0x16, 0x00, 0x00, 0x34, 0xf5, 0xff, 0xff, 0x06, 0x02, 0x00, 0x00,
-  0x3c, 0x07, 0x00, 0x00, 0x43, 0xfe, 0xff, 0xff, 0xda, 0xf8, 0xff, 0xff,
-  0xd5, 0xf8, 0xff, 0xff, 0x93, 0xfa, 0xff, 0xff, 0xf3, 0xf7, 0xff, 0xff,
-  0xec, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x7d, 0xfc, 0xff, 0xff,
-  0x74, 0xfb, 0xff, 0xff, 0x63, 0xf5, 0xff, 0xff, 0x5d, 0xf1, 0xff, 0xff,
-  0x09, 0xfc, 0xff, 0xff, 0xb6, 0xd8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x42, 0xe3, 0x04, 0x08, 0xd9, 0xd8, 0x65, 0x38,
-  0x68, 0x1f, 0x3f, 0x42, 0xd1, 0x0b, 0xf0, 0x59, 0xfa, 0x03, 0xab, 0x11,
-  0xf8, 0x31, 0xe6, 0x2d, 0x1f, 0xc8, 0xc2, 0x05, 0x4a, 0x27, 0x0f, 0x17,
-  0x3d, 0xc3, 0x24, 0xe6, 0xe8, 0x06, 0x24, 0xfd, 0x13, 0x32, 0xc0, 0xf9,
-  0xe8, 0x43, 0x16, 0x42, 0x7f, 0xd8, 0xd1, 0xcd, 0x1e, 0xce, 0x42, 0xdc,
-  0x0f, 0xf8, 0xcb, 0x1f, 0xc9, 0x21, 0xe6, 0x11, 0xdf, 0x94, 0xb2, 0x1b,
-  0xd5, 0x4d, 0x34, 0xd8, 0xe3, 0xe4, 0xff, 0x23, 0x04, 0xd1, 0x32, 0xa9,
-  0xcf, 0x37, 0x20, 0xcc, 0x07, 0x39, 0xc4, 0x39, 0xa5, 0x05, 0xec, 0x3f,
-  0xa4, 0x14, 0xd0, 0x47, 0x1a, 0xbd, 0x22, 0xd7, 0x0a, 0x03, 0x52, 0xcc,
-  0xe3, 0x3a, 0x5d, 0xbc, 0xb3, 0xfe, 0x2b, 0x3d, 0xfd, 0x5f, 0x0a, 0x0a,
-  0x23, 0xfc, 0x44, 0x01, 0xe1, 0x66, 0xdd, 0xe9, 0xfc, 0x44, 0x7f, 0x10,
-  0x54, 0xbb, 0xaf, 0xea, 0xe9, 0x1e, 0x50, 0xef, 0x1c, 0xcf, 0x20, 0xff,
-  0x33, 0xad, 0xf5, 0x19, 0x3b, 0x52, 0x28, 0x11, 0x16, 0x4d, 0xb5, 0x98,
-  0x51, 0x51, 0xb1, 0xeb, 0x89, 0xaf, 0x4a, 0x70, 0xf7, 0x35, 0x1f, 0xf9,
-  0x5c, 0x0e, 0x1d, 0x0a, 0x9f, 0x15, 0x24, 0x01, 0x4f, 0xa0, 0xa6, 0xea,
-  0x85, 0xed, 0x3f, 0xc3, 0xd8, 0x7f, 0x4a, 0xdb, 0x92, 0xad, 0xee, 0xb3,
-  0x69, 0x00, 0x36, 0xbc, 0x2b, 0xc6, 0x0a, 0xe1, 0xf5, 0xee, 0x49, 0x35,
-  0x5b, 0x3d, 0x46, 0x53, 0x41, 0xe9, 0x0c, 0x3b, 0x2b, 0x12, 0xc1, 0x4a,
-  0xbc, 0x20, 0x97, 0x12, 0x06, 0xb1, 0xc5, 0x8c, 0xf7, 0x07, 0xa2, 0xb9,
-  0x9f, 0xeb, 0xe8, 0x19, 0xaf, 0x20, 0x01, 0x43, 0x2f, 0x81, 0xcf, 0xa1,
-  0x44, 0xdf, 0x26, 0xfd, 0x7f, 0xea, 0xfb, 0xcb, 0xd9, 0x2f, 0x19, 0xd4,
-  0xb0, 0xc8, 0x51, 0x47, 0x3c, 0xde, 0xda, 0x8c, 0xe2, 0x36, 0xfa, 0xbe,
-  0x7d, 0xca, 0x49, 0xd3, 0xc3, 0x82, 0xc9, 0xb5, 0x81, 0xba, 0x04, 0xdd,
-  0xff, 0xfa, 0xc4, 0x15, 0x4d, 0x5e, 0x3e, 0x08, 0x5b, 0x66, 0xa4, 0x67,
-  0xe5, 0x1f, 0x57, 0xee, 0xb2, 0x3a, 0xd4, 0x0a, 0x64, 0xb4, 0xa5, 0x63,
-  0x02, 0xb4, 0x4c, 0x3b, 0xb1, 0xad, 0x6d, 0x2d, 0xd6, 0x7a, 0xf4, 0xe4,
-  0x76, 0xd9, 0xfe, 0xe9, 0xe7, 0x10, 0x97, 0x0d, 0x76, 0xc4, 0x6a, 0x5f,
-  0x07, 0x18, 0x29, 0x7a, 0x31, 0xd5, 0x2f, 0x3b, 0x7f, 0x0c, 0xf5, 0x3e,
-  0x9d, 0x54, 0x37, 0xcd, 0xe2, 0xa5, 0x24, 0x0b, 0x6e, 0xa3, 0x06, 0xbb,
-  0xb7, 0x08, 0xe8, 0x03, 0x2a, 0x9a, 0xc0, 0xb5, 0x36, 0xf4, 0xc2, 0x53,
-  0x5e, 0xba, 0x55, 0x35, 0xeb, 0x39, 0x46, 0xc8, 0x18, 0xbe, 0x28, 0x04,
-  0xe9, 0xe9, 0x37, 0x43, 0xf8, 0xe1, 0xf2, 0x15, 0xf5, 0x6a, 0xa3, 0x43,
-  0x57, 0xde, 0x4a, 0x2b, 0x1b, 0x3b, 0x58, 0x4c, 0xba, 0x77, 0x35, 0x46,
-  0x1f, 0x93, 0x1c, 0x13, 0x29, 0x0f, 0xe5, 0x81, 0xae, 0xce, 0xd1, 0x10,
-  0x29, 0x56, 0xeb, 0x1c, 0xeb, 0xf6, 0x5c, 0x3c, 0x37, 0x2f, 0xfa, 0x1f,
-  0x1c, 0xb5, 0x1d, 0xd5, 0x5c, 0x94, 0xb5, 0x31, 0x17, 0x33, 0xb1, 0xdc,
-  0x18, 0xb9, 0x57, 0x23, 0x28, 0x3f, 0x36, 0x4f, 0x41, 0xdb, 0xd5, 0x17,
-  0xc4, 0x51, 0x44, 0x6a, 0x93, 0xd1, 0xd0, 0xff, 0x96, 0x49, 0xa8, 0x20,
-  0x3b, 0x81, 0x35, 0xd8, 0x27, 0xcb, 0xeb, 0xd3, 0x57, 0xab, 0xbd, 0x35,
-  0x0f, 0x38, 0xcc, 0x2b, 0xfe, 0xa8, 0xb6, 0x40, 0x41, 0xd1, 0x23, 0x22,
-  0x14, 0xd2, 0x2d, 0x4b, 0xad, 0xfb, 0x09, 0x9f, 0x91, 0x63, 0x2d, 0xe4,
-  0xed, 0x34, 0xc6, 0x96, 0x70, 0x02, 0x30, 0xd6, 0xfb, 0xa6, 0xf3, 0xb4,
-  0x87, 0xba, 0x4e, 0x02, 0xf1, 0xd1, 0xf4, 0xc2, 0x9f, 0x10, 0xd1, 0xc4,
-  0x19, 0x0d, 0x4d, 0x17, 0xbe, 0xb2, 0x32, 0x26, 0x11, 0x0c, 0xde, 0x5c,
-  0xce, 0xad, 0x5f, 0x03, 0x29, 0x2e, 0x3f, 0x4c, 0xe9, 0x36, 0x1c, 0xf3,
-  0x44, 0xa2, 0x2f, 0x40, 0x61, 0x28, 0xd9, 0x81, 0xd6, 0xa2, 0x79, 0xa8,
-  0x9d, 0xe6, 0xeb, 0xd5, 0xf1, 0x12, 0xdf, 0xbc, 0x24, 0x13, 0x4a, 0xbc,
-  0x40, 0x97, 0xe1, 0xce, 0xfa, 0xbc, 0x73, 0x41, 0xe5, 0x12, 0x88, 0xf7,
-  0xed, 0x69, 0x54, 0x17, 0x07, 0xe9, 0xc7, 0x98, 0x46, 0x42, 0x03, 0x7f,
-  0x16, 0xee, 0xd2, 0x12, 0x03, 0xf4, 0x5a, 0x02, 0x0e, 0xc8, 0x4d, 0x26,
-  0x4c, 0x59, 0xd5, 0xf8, 0x1b, 0xcd, 0x3f, 0x25, 0xcc, 0xe4, 0xe6, 0x10,
-  0x0e, 0xff, 0x60, 0x10, 0x53, 0x49, 0xb0, 0xef, 0xa8, 0x1a, 0x0b, 0x47,
-  0x60, 0xdc, 0xf7, 0xb5, 0x0f, 0x43, 0xea, 0x4c, 0x25, 0xd2, 0x6a, 0x2d,
-  0x55, 0x7d, 0x10, 0xf1, 0xfd, 0x3c, 0xa7, 0x02, 0x9f, 0x0e, 0x2a, 0xc9,
-  0x4f, 0x17, 0xb7, 0xe2, 0xbb, 0xd5, 0xfe, 0xb1, 0x9a, 0x0d, 0xff, 0xeb,
-  0x12, 0xa8, 0x0f, 0xc1, 0xdd, 0xe5, 0xd9, 0x59, 0xa6, 0xf7, 0x3a, 0xf8,
-  0xb8, 0x81, 0x03, 0x25, 0x1a, 0x18, 0xf9, 0xcd, 0x24, 0xc3, 0xec, 0x4f,
-  0x07, 0xe8, 0x37, 0x0f, 0x11, 0xb0, 0xb7, 0xea, 0xc2, 0xe5, 0x27, 0x1c,
-  0x09, 0xc5, 0xea, 0xbc, 0x30, 0x1d, 0xec, 0x29, 0x2a, 0xcc, 0x07, 0x0f,
-  0xe7, 0xa3, 0x34, 0x09, 0xec, 0x0e, 0x5a, 0x7f, 0xed, 0x2f, 0x24, 0xca,
-  0xc6, 0xdc, 0xbd, 0xfe, 0x30, 0xe5, 0x5d, 0xce, 0x37, 0xf0, 0xa8, 0xd1,
-  0x40, 0xda, 0xdc, 0xc5, 0x31, 0xaf, 0xf4, 0x30, 0xc1, 0xea, 0x18, 0x42,
-  0xa3, 0xee, 0x44, 0xc7, 0xd6, 0xbf, 0xcc, 0xd1, 0x56, 0xc5, 0xd8, 0xd5,
-  0x40, 0xb4, 0xaf, 0xf8, 0x28, 0x0c, 0x74, 0xe1, 0xc6, 0xf1, 0xf4, 0xc8,
-  0xbf, 0x55, 0xf3, 0xc9, 0xd9, 0xdd, 0x26, 0x3d, 0x21, 0x0d, 0x17, 0xfb,
-  0x3f, 0x30, 0x3a, 0xfb, 0xd6, 0x07, 0x39, 0xec, 0xe7, 0xc7, 0x0f, 0x03,
-  0x16, 0xe2, 0x06, 0x16, 0x3b, 0x03, 0xdd, 0x2a, 0xda, 0x2e, 0x59, 0xe6,
-  0x0b, 0xe5, 0xe4, 0xc2, 0x3c, 0x2b, 0x08, 0x3c, 0x0c, 0xfe, 0x38, 0xbe,
-  0x11, 0xad, 0x40, 0x0a, 0x31, 0x5b, 0xc4, 0xe0, 0x7f, 0xe5, 0xbe, 0x4b,
-  0x22, 0x34, 0xfb, 0x33, 0xe6, 0x00, 0x11, 0xfa, 0x37, 0x48, 0x1f, 0xc1,
-  0x99, 0xdb, 0x27, 0xcb, 0xd8, 0xc2, 0x2b, 0xf3, 0xa4, 0xbc, 0x3e, 0xec,
-  0xa4, 0x91, 0x47, 0xaa, 0x33, 0x58, 0x63, 0x28, 0x0f, 0xe4, 0xa3, 0x3d,
-  0x55, 0x46, 0x0a, 0x39, 0x05, 0xd7, 0xe2, 0x02, 0xfb, 0x10, 0xcf, 0x07,
-  0xdc, 0x7f, 0x1b, 0x01, 0x54, 0xd0, 0x70, 0x11, 0x08, 0x2b, 0xdc, 0x7a,
-  0xe4, 0x6e, 0x31, 0x7e, 0x07, 0x33, 0x10, 0xb1, 0xdf, 0x5c, 0x62, 0x29,
-  0x25, 0xc4, 0xca, 0x5a, 0x0c, 0xc0, 0x35, 0xa9, 0xef, 0x1d, 0x2f, 0xf7,
-  0x52, 0x62, 0x36, 0x3e, 0xde, 0xc6, 0x3f, 0xcc, 0x5e, 0x09, 0x18, 0xae,
-  0x78, 0x02, 0xca, 0x7f, 0xdd, 0xb3, 0xec, 0x12, 0xdf, 0xdd, 0x4f, 0xbd,
-  0x3b, 0x0f, 0x10, 0x99, 0x67, 0x16, 0x14, 0xeb, 0xff, 0xe5, 0x72, 0x63,
-  0x04, 0x2e, 0x7c, 0xad, 0x6a, 0x17, 0xb4, 0x6e, 0xf4, 0x9d, 0x29, 0x00,
-  0x82, 0xbd, 0xc0, 0xaf, 0x98, 0xba, 0x32, 0xfe, 0x32, 0xfd, 0x37, 0x40,
-  0xda, 0x28, 0x1f, 0x49, 0x58, 0x6b, 0x2d, 0xd4, 0xcd, 0x30, 0xc9, 0x78,
-  0x04, 0x4c, 0xee, 0xd8, 0xa2, 0xe9, 0x2f, 0xb4, 0xf3, 0xdb, 0xa1, 0x53,
-  0x98, 0xc5, 0xb6, 0x26, 0xed, 0x6a, 0xe0, 0xb0, 0x21, 0x4c, 0x4c, 0xcc,
-  0xd3, 0x07, 0x19, 0xb8, 0x81, 0x52, 0xd9, 0x38, 0xe8, 0xf8, 0xcb, 0x28,
-  0xfa, 0xd1, 0x81, 0xcb, 0x1a, 0xf9, 0x0c, 0xb8, 0x3a, 0x55, 0x26, 0x0b,
-  0x2a, 0xaf, 0xfb, 0x11, 0xb9, 0x42, 0xa6, 0x24, 0x23, 0x9f, 0xf1, 0x64,
-  0xd1, 0x0d, 0xe7, 0xf1, 0x15, 0xdc, 0xe9, 0xae, 0xd2, 0xe5, 0x49, 0x23,
-  0xda, 0x66, 0xd1, 0xf8, 0x35, 0xfb, 0x16, 0x25, 0xa2, 0x7e, 0xd4, 0xdd,
-  0xf6, 0xc6, 0x1f, 0xf5, 0xf2, 0x0a, 0x31, 0xfa, 0xf0, 0x48, 0xb0, 0xb1,
-  0xa0, 0xf9, 0x49, 0xe8, 0x8d, 0xd5, 0x19, 0x01, 0x99, 0xe5, 0xc5, 0x81,
-  0xe7, 0xd2, 0xe4, 0xcd, 0x21, 0xf0, 0xd8, 0xa4, 0xe9, 0xea, 0xa3, 0x1d,
-  0xfd, 0xf2, 0x4c, 0xd2, 0x18, 0xd2, 0xa1, 0xb2, 0xf5, 0x29, 0x1f, 0x81,
-  0x85, 0xfe, 0x93, 0xe7, 0x4e, 0x6b, 0x98, 0xbb, 0x0d, 0xdb, 0x53, 0x9c,
-  0x8f, 0x11, 0xe1, 0xfb, 0x1d, 0xd5, 0xa1, 0x90, 0x1b, 0xb5, 0xf0, 0xb5,
-  0xcc, 0x0f, 0x13, 0xa9, 0xb0, 0x0d, 0x17, 0xff, 0x51, 0xa3, 0x51, 0xf5,
-  0x07, 0xad, 0xc4, 0xab, 0x20, 0xea, 0x1c, 0x31, 0xd1, 0xb6, 0xde, 0x4b,
-  0x7f, 0xae, 0xfd, 0x24, 0xc8, 0x6d, 0x01, 0xad, 0x9c, 0xd2, 0xff, 0xd9,
-  0x44, 0x43, 0x5f, 0x3f, 0xe9, 0x76, 0x23, 0xf1, 0xe3, 0xe5, 0xb6, 0xdf,
-  0x64, 0xaa, 0x19, 0xf8, 0x2b, 0xfc, 0x52, 0x13, 0xff, 0x59, 0x4c, 0x04,
-  0x1a, 0xd0, 0xaa, 0x9b, 0x3c, 0xb6, 0xdc, 0xe8, 0x22, 0x33, 0xc0, 0xe7,
-  0x37, 0xe9, 0x15, 0x10, 0xc8, 0xec, 0x12, 0x5b, 0x02, 0x3f, 0x47, 0x05,
-  0x23, 0x47, 0xc7, 0xf6, 0x32, 0x5b, 0x5f, 0x1b, 0xcd, 0xc9, 0x3a, 0x4d,
-  0x4c, 0x1f, 0x57, 0xfe, 0xd3, 0xe1, 0x09, 0x61, 0xea, 0x8a, 0x1a, 0xfc,
-  0x7f, 0xf4, 0x44, 0xef, 0xd6, 0x08, 0x07, 0x61, 0x95, 0x48, 0x06, 0x2b,
-  0x6d, 0xc6, 0x98, 0xb3, 0xf7, 0xa1, 0xde, 0xd3, 0x0d, 0xd6, 0x31, 0xf7,
-  0xd3, 0xcf, 0x99, 0x50, 0xd9, 0x30, 0xb4, 0x2f, 0xf0, 0xe9, 0x5f, 0xca,
-  0xe8, 0x25, 0xe7, 0xe5, 0xcf, 0xa3, 0xd2, 0xd5, 0x56, 0xe5, 0x06, 0x65,
-  0x18, 0xc8, 0xec, 0x4e, 0xf1, 0xed, 0xdc, 0xf0, 0xeb, 0xdc, 0x3a, 0xd9,
-  0x04, 0xc2, 0x36, 0xbf, 0xfd, 0x51, 0x1c, 0x1f, 0x1b, 0xa4, 0x1f, 0x1b,
-  0xee, 0x23, 0xed, 0xc7, 0xb7, 0x8e, 0x9f, 0x12, 0x30, 0xce, 0x1b, 0xe5,
-  0x7f, 0x22, 0xa8, 0xeb, 0xba, 0x25, 0x52, 0x23, 0x97, 0xcc, 0xde, 0x05,
-  0x03, 0x15, 0xc3, 0xb4, 0x81, 0x34, 0x5b, 0x35, 0xe5, 0xd0, 0xbe, 0xee,
-  0xe5, 0xed, 0xa0, 0x00, 0x1e, 0x3d, 0x3f, 0x23, 0x1e, 0x17, 0x76, 0x5f,
-  0x42, 0x31, 0x4c, 0xc0, 0x58, 0x28, 0xb9, 0x42, 0x2e, 0x29, 0xf2, 0x84,
-  0xc6, 0xb5, 0x36, 0xd3, 0xf7, 0x26, 0xc7, 0xcd, 0x22, 0xeb, 0xd3, 0x9c,
-  0x19, 0x39, 0xb7, 0x01, 0x23, 0x1a, 0xec, 0xfc, 0x60, 0xe0, 0xa8, 0x47,
-  0x00, 0xe7, 0xdc, 0xd3, 0x1a, 0x5c, 0x29, 0x30, 0xa6, 0x4f, 0xf7, 0x26,
-  0xed, 0x9e, 0x48, 0xe1, 0xdb, 0xd3, 0x36, 0x36, 0x0b, 0x34, 0xaf, 0x2a,
-  0xa3, 0xcd, 0x8f, 0xe5, 0xcd, 0xfd, 0xfd, 0xd7, 0xa5, 0x20, 0xe0, 0xdc,
-  0x24, 0xcd, 0x50, 0x31, 0x3a, 0x81, 0x31, 0x47, 0xc4, 0x1e, 0x51, 0x40,
-  0xe8, 0xd6, 0xc4, 0x58, 0x15, 0x44, 0x0c, 0xba, 0x22, 0xae, 0xed, 0xed,
-  0xb3, 0x9a, 0xe5, 0x9f, 0xb8, 0xa9, 0xf0, 0xdc, 0x07, 0xf6, 0xa8, 0xb3,
-  0xa2, 0x3e, 0x11, 0x44, 0x25, 0xc3, 0x3c, 0xe7, 0x0e, 0xf1, 0xfb, 0x02,
-  0x7f, 0x51, 0x35, 0xa8, 0x5e, 0xe8, 0x0e, 0x3f, 0xfb, 0xd5, 0xe5, 0xf9,
-  0xdd, 0xa5, 0x23, 0x09, 0xce, 0xe6, 0xca, 0xc7, 0xb8, 0x07, 0xb5, 0x1c,
-  0xc0, 0x78, 0x37, 0xc9, 0x55, 0x30, 0x94, 0x10, 0xe9, 0x63, 0x34, 0xc4,
-  0x57, 0xcd, 0xeb, 0xfe, 0x2c, 0xd5, 0xc4, 0x21, 0xd8, 0x1c, 0xb9, 0xc4,
-  0xdb, 0x55, 0x3f, 0x24, 0x17, 0x4d, 0x18, 0xf8, 0xd7, 0x4a, 0x43, 0x19,
-  0x19, 0x55, 0x51, 0xf7, 0x5f, 0xdd, 0x22, 0x26, 0xf4, 0x23, 0xc2, 0x21,
-  0x10, 0x32, 0xc2, 0x24, 0x43, 0xab, 0xc0, 0x46, 0xe3, 0xe0, 0xe4, 0xf1,
-  0xb0, 0xdb, 0x7f, 0x3d, 0x22, 0x2d, 0x28, 0x05, 0x17, 0x1a, 0xf5, 0x10,
-  0x2c, 0xe0, 0xef, 0xe7, 0xf9, 0x57, 0x2e, 0xf2, 0xd5, 0x0f, 0xe4, 0x53,
-  0xfe, 0x54, 0xd7, 0xbf, 0xd0, 0x00, 0x1d, 0x0b, 0xce, 0xeb, 0xaa, 0xfd,
-  0xf0, 0x4e, 0xf5, 0x23, 0xd0, 0x22, 0xd0, 0xad, 0xdb, 0xd5, 0x1b, 0x08,
-  0xee, 0xd3, 0xf7, 0xcf, 0x9d, 0xaa, 0x0c, 0xd0, 0xa9, 0x53, 0xcb, 0x02,
-  0xe9, 0xc8, 0x2b, 0x36, 0x29, 0x50, 0xf4, 0x4c, 0x56, 0xe0, 0x34, 0x03,
-  0x3d, 0x70, 0x19, 0x12, 0xdf, 0x3e, 0xe2, 0xd2, 0x81, 0x2b, 0x22, 0x2f,
-  0x12, 0xd5, 0xc8, 0xbc, 0xea, 0x18, 0xf5, 0x2b, 0xf3, 0xdf, 0x28, 0x19,
-  0x19, 0xd5, 0xda, 0xa8, 0x67, 0x16, 0xee, 0x3c, 0xfe, 0x48, 0xdc, 0x3f,
-  0x64, 0xf0, 0xf7, 0x39, 0x1a, 0x41, 0x17, 0x2b, 0xc7, 0x5e, 0x26, 0xa9,
-  0xef, 0x22, 0xed, 0x7d, 0x30, 0xce, 0xc4, 0xe0, 0xab, 0xcc, 0xe1, 0xad,
-  0x86, 0xc6, 0x64, 0x45, 0x3e, 0xd3, 0x03, 0xaf, 0x53, 0x12, 0x69, 0x35,
-  0x5d, 0xd0, 0xc9, 0x64, 0xdf, 0x7f, 0x3b, 0x43, 0x8f, 0xb7, 0x1e, 0xd6,
-  0xbb, 0xe8, 0x48, 0x53, 0x31, 0x2b, 0x58, 0x22, 0x0f, 0xf3, 0xf6, 0x1c,
-  0xed, 0x24, 0xfa, 0x1f, 0x15, 0xce, 0xd5, 0x25, 0xfe, 0xca, 0xb9, 0x3e,
-  0x25, 0x34, 0x27, 0xdd, 0xc1, 0xec, 0x27, 0xdd, 0xf3, 0x0f, 0xa2, 0x17,
-  0xa8, 0xf9, 0x1f, 0x0f, 0x01, 0x7f, 0x2f, 0xdc, 0xae, 0x8f, 0xac, 0x17,
-  0x4c, 0xdc, 0xff, 0x4f, 0x2b, 0xdf, 0x9d, 0xf5, 0xbc, 0x38, 0xf4, 0x4e,
-  0xc1, 0xe9, 0x27, 0x40, 0xeb, 0xe4, 0xf3, 0x8b, 0x68, 0x4a, 0x1a, 0x81,
-  0x13, 0x17, 0xc8, 0x8c, 0x52, 0xfd, 0xfe, 0x2a, 0x39, 0xf8, 0xe5, 0x0e,
-  0x01, 0xfe, 0xe4, 0xad, 0x4f, 0xd4, 0xeb, 0x27, 0xe3, 0x9c, 0x20, 0xc8,
-  0xe9, 0x27, 0x5b, 0x53, 0x33, 0x1a, 0xff, 0xa9, 0x1b, 0xdf, 0xd7, 0x33,
-  0xec, 0xf8, 0xad, 0x30, 0x0a, 0x52, 0x46, 0xf8, 0x36, 0xdb, 0x4d, 0x23,
-  0xa4, 0xb9, 0x43, 0xc6, 0xd1, 0x41, 0xdc, 0x9a, 0x71, 0xed, 0x9f, 0x41,
-  0xd1, 0xa1, 0xbe, 0x23, 0xf4, 0xd2, 0x69, 0x5b, 0x34, 0x18, 0x48, 0x4d,
-  0xf3, 0xba, 0xad, 0x03, 0x81, 0x0c, 0xc1, 0x04, 0xd1, 0x30, 0x33, 0xd9,
-  0xc4, 0xd7, 0xc8, 0xc5, 0x13, 0xf6, 0xcb, 0x3c, 0xd5, 0x97, 0x56, 0x2f,
-  0xc4, 0x0b, 0xe1, 0x04, 0x21, 0x39, 0x1a, 0x2e, 0xc6, 0xd3, 0x29, 0x67,
-  0x31, 0x3d, 0xae, 0xa6, 0xf0, 0x38, 0x0d, 0x40, 0x41, 0x43, 0xa5, 0xa4,
-  0x00, 0xfb, 0x14, 0xf3, 0xdb, 0xf8, 0x4e, 0x3f, 0x3f, 0xa2, 0xc1, 0x31,
-  0xce, 0x09, 0x01, 0x27, 0x62, 0xf7, 0x1e, 0x0f, 0x7a, 0x36, 0x44, 0x6c,
-  0x48, 0xad, 0x14, 0x13, 0x0e, 0x81, 0xae, 0x28, 0x18, 0x24, 0xbf, 0xf7,
-  0x0a, 0xa4, 0x28, 0xf4, 0x92, 0x6d, 0xdc, 0xe4, 0x5b, 0xda, 0xae, 0x01,
-  0x54, 0x60, 0xca, 0x48, 0xcf, 0xf9, 0x2c, 0x40, 0x4d, 0x22, 0xc9, 0xeb,
-  0x91, 0xeb, 0x92, 0x08, 0x0f, 0x45, 0x4f, 0x4a, 0xf3, 0x89, 0xd3, 0x02,
-  0x5c, 0x37, 0xba, 0x58, 0xf9, 0x10, 0x41, 0xb5, 0xe3, 0x31, 0xf9, 0x57,
-  0x14, 0x61, 0x53, 0x07, 0xc2, 0x7f, 0xb5, 0x34, 0x1d, 0x38, 0x7a, 0x74,
-  0x21, 0x21, 0xb6, 0x49, 0x2f, 0x05, 0x78, 0x4f, 0x33, 0x70, 0x78, 0x7b,
-  0x27, 0xd6, 0x0b, 0xc8, 0x50, 0xc7, 0x39, 0x7f, 0x42, 0x06, 0x12, 0x23,
-  0x0f, 0xe2, 0xc3, 0x32, 0x9c, 0xe5, 0x82, 0xd3, 0xf5, 0x0e, 0xdd, 0xe0,
-  0xb2, 0x1c, 0x98, 0x0c, 0x0b, 0x45, 0x1d, 0x36, 0x07, 0x92, 0x26, 0x2a,
-  0xbd, 0xf6, 0x2c, 0x8b, 0x87, 0x23, 0x5f, 0xa7, 0x52, 0x06, 0x7f, 0xc2,
-  0x02, 0x07, 0xaf, 0xb3, 0xba, 0xdf, 0x2d, 0xbe, 0x1c, 0xf8, 0xea, 0x13,
-  0x5a, 0xec, 0x5b, 0x1f, 0xfe, 0x75, 0xb4, 0xce, 0x3b, 0x25, 0x23, 0xef,
-  0xe6, 0x13, 0xd8, 0xae, 0xd4, 0xb1, 0xba, 0xd2, 0x3d, 0x46, 0x91, 0xf0,
-  0x51, 0x32, 0x09, 0xd2, 0xf6, 0x06, 0xf3, 0x3c, 0xf7, 0x04, 0x5b, 0xf0,
-  0x0c, 0x1e, 0x2b, 0x2a, 0x13, 0xe4, 0x37, 0x48, 0x04, 0x37, 0x51, 0xf8,
-  0x63, 0x11, 0xdd, 0x34, 0x43, 0xac, 0x29, 0x59, 0xd3, 0xd4, 0xf5, 0x0d,
-  0xfe, 0x1d, 0xc3, 0x24, 0xcd, 0xfb, 0x07, 0xea, 0x13, 0xb6, 0xa5, 0x14,
-  0x16, 0xfc, 0x3e, 0x27, 0x1c, 0x13, 0x29, 0xbd, 0x2f, 0xcc, 0x43, 0x20,
-  0xd1, 0x0e, 0x08, 0x81, 0x13, 0x57, 0x33, 0x20, 0xbe, 0xe8, 0xb0, 0x7f,
-  0x13, 0xf8, 0x24, 0x65, 0x05, 0x8c, 0xec, 0x57, 0xde, 0xd6, 0x20, 0x3e,
-  0xb0, 0xf6, 0x05, 0x4b, 0xf4, 0x0c, 0xdb, 0x3a, 0xdf, 0xc9, 0xf4, 0xcc,
-  0xda, 0x0f, 0x3a, 0xb8, 0x0a, 0xaa, 0xab, 0x35, 0x6a, 0x8a, 0x46, 0x02,
-  0xe8, 0x77, 0xee, 0x82, 0x17, 0x0b, 0x5a, 0x50, 0x1b, 0xe4, 0x58, 0x05,
-  0xdb, 0x32, 0xc8, 0x33, 0x45, 0x67, 0x0a, 0x56, 0x2e, 0xbd, 0xce, 0xf0,
-  0x2e, 0x51, 0xc8, 0x18, 0x23, 0xf4, 0x11, 0xeb, 0x27, 0x23, 0x5f, 0x5f,
-  0x43, 0xc5, 0xf1, 0x0f, 0x53, 0x05, 0xec, 0x3b, 0xea, 0x37, 0x1a, 0xcd,
-  0x12, 0x0e, 0x47, 0x4c, 0xf1, 0xb4, 0x1a, 0xb9, 0xe7, 0xc5, 0x13, 0x27,
-  0xf6, 0xe8, 0x46, 0xde, 0x33, 0x17, 0xdc, 0xa9, 0x5b, 0x31, 0x3b, 0xff,
-  0x15, 0xe3, 0x13, 0x33, 0x22, 0xe4, 0x15, 0x27, 0xcc, 0xda, 0x81, 0xb8,
-  0x32, 0x40, 0x18, 0xf5, 0x2e, 0xbd, 0x42, 0x0a, 0xeb, 0xc4, 0x59, 0xf2,
-  0x11, 0xb5, 0x15, 0x6b, 0x3c, 0x0d, 0xbc, 0xa5, 0xec, 0xbf, 0x4b, 0x13,
-  0xe4, 0x1a, 0xae, 0x6c, 0xbe, 0xfb, 0xb5, 0xec, 0x84, 0x0a, 0x2d, 0x26,
-  0x6b, 0x33, 0x60, 0x42, 0x06, 0x04, 0xd8, 0x15, 0xda, 0x14, 0x6d, 0x0b,
-  0x99, 0x45, 0x7a, 0x1a, 0x10, 0x50, 0xec, 0xc3, 0x02, 0xab, 0x57, 0x68,
-  0xe1, 0x34, 0x13, 0xd8, 0x6c, 0xe0, 0x7f, 0x29, 0x23, 0x33, 0x25, 0xdd,
-  0xfe, 0x12, 0xe6, 0xfb, 0x3a, 0xcb, 0xd5, 0x12, 0xd2, 0xe7, 0x03, 0xc5,
-  0xe2, 0xed, 0xfd, 0x14, 0xc8, 0xd1, 0xf1, 0x19, 0xca, 0x37, 0x1b, 0x02,
-  0xb2, 0xbd, 0x2d, 0xf1, 0xe4, 0xec, 0xc7, 0xd5, 0x38, 0xb4, 0xd3, 0x2d,
-  0x06, 0x7f, 0x47, 0xf3, 0xab, 0xde, 0x01, 0xbc, 0xde, 0xb6, 0x26, 0x49,
-  0x3a, 0x3c, 0xc0, 0xcb, 0x3c, 0xe4, 0x1d, 0x28, 0xe9, 0x2c, 0x54, 0xf7,
-  0xe2, 0x26, 0xb8, 0xc8, 0x54, 0xc2, 0x00, 0xf3, 0x38, 0xc9, 0x81, 0x48,
-  0x9a, 0xce, 0x16, 0xc0, 0xdb, 0x1d, 0x35, 0x36, 0xc6, 0x3e, 0x6b, 0xd4,
-  0x1a, 0x44, 0xae, 0xcc, 0xfe, 0x03, 0xdb, 0xc1, 0xb0, 0xb1, 0x4f, 0xf4,
-  0x4c, 0xd3, 0xee, 0x15, 0xe1, 0x0e, 0x03, 0xee, 0x2d, 0x14, 0x52, 0x3e,
-  0x4a, 0x5e, 0x8f, 0xae, 0x30, 0x33, 0x7f, 0x62, 0x27, 0x33, 0xad, 0xfa,
-  0x56, 0xd3, 0x0e, 0xc7, 0xbf, 0x4b, 0x07, 0xe6, 0x64, 0xc2, 0x21, 0x3d,
-  0x13, 0x06, 0x9e, 0xc6, 0x52, 0x47, 0x2e, 0xde, 0x13, 0xe2, 0x6b, 0x00,
-  0xe8, 0xcc, 0x3a, 0xe3, 0x35, 0xe4, 0xc4, 0x44, 0x63, 0x45, 0x34, 0xa7,
-  0xb9, 0xea, 0xe4, 0x47, 0xcc, 0x78, 0x34, 0x12, 0x3f, 0xff, 0x81, 0xea,
-  0x12, 0xde, 0xb1, 0x28, 0xd3, 0x1d, 0x50, 0x47, 0x3f, 0xa8, 0xed, 0x37,
-  0xac, 0x05, 0xb7, 0x92, 0xb5, 0x26, 0x14, 0x33, 0x1c, 0x28, 0x56, 0x14,
-  0xfa, 0xfd, 0xc4, 0xa7, 0x3f, 0x05, 0xbd, 0xfb, 0x24, 0xc1, 0xcd, 0xfc,
-  0x12, 0x10, 0xc9, 0x30, 0xee, 0xe8, 0xe4, 0xce, 0xea, 0xf3, 0x39, 0x08,
-  0x7f, 0x69, 0xc1, 0xb7, 0xf2, 0xf9, 0xe1, 0xbf, 0xbb, 0xf5, 0xf8, 0xa5,
-  0x05, 0xb2, 0xa8, 0xcc, 0xe5, 0xf8, 0x27, 0xcb, 0x0b, 0x0f, 0xdc, 0xf4,
-  0xba, 0x2a, 0x33, 0xec, 0xb5, 0x28, 0xe3, 0x05, 0x13, 0xfe, 0x2a, 0xc3,
-  0xd6, 0x8d, 0xcf, 0xd1, 0xb1, 0x89, 0xa1, 0x31, 0x81, 0x34, 0x31, 0x38,
-  0xfe, 0xcc, 0x44, 0xfa, 0x38, 0x3d, 0x1c, 0x33, 0xa4, 0xa1, 0xb1, 0xc0,
-  0xf7, 0x25, 0x61, 0xf5, 0xd0, 0x66, 0x66, 0x22, 0x46, 0x73, 0xbc, 0xf9,
-  0x28, 0x19, 0xb5, 0x62, 0x3e, 0xc4, 0x21, 0x07, 0xe4, 0x1f, 0x9d, 0x62,
-  0xc3, 0x3e, 0xe8, 0x12, 0x31, 0x4c, 0xb5, 0x08, 0xfc, 0x55, 0xd1, 0x07,
-  0xef, 0x9d, 0xf3, 0x4a, 0x79, 0x8b, 0x35, 0xd3, 0xf7, 0xd6, 0xa3, 0x8a,
-  0xa9, 0x14, 0xe9, 0x1e, 0x38, 0x09, 0x2a, 0x81, 0x2b, 0x49, 0xa1, 0xd2,
-  0xc9, 0x1b, 0x21, 0x3c, 0x47, 0xac, 0xea, 0x42, 0xa0, 0xb5, 0x0b, 0x25,
-  0x0c, 0x5c, 0x39, 0x2a, 0x02, 0x27, 0xd8, 0xaf, 0xf8, 0x1d, 0xc1, 0x3a,
-  0x37, 0x5f, 0xb4, 0xf0, 0x0f, 0x1d, 0xed, 0xf5, 0xbc, 0x64, 0xa9, 0xbf,
-  0xfa, 0x17, 0x2a, 0xbc, 0xf8, 0xef, 0x10, 0x5b, 0x2a, 0x13, 0xef, 0xe8,
-  0xd7, 0xc8, 0x29, 0xcc, 0x31, 0xed, 0x2c, 0x05, 0x11, 0x0b, 0x0e, 0x41,
-  0x47, 0x0e, 0x07, 0xe6, 0xf6, 0xf8, 0xe7, 0x32, 0x19, 0x11, 0x23, 0xd7,
-  0xfe, 0xf8, 0x2e, 0x31, 0xf1, 0xc8, 0xf6, 0xf6, 0xaf, 0x66, 0xe5, 0x07,
-  0xdc, 0xc5, 0xd5, 0xde, 0x47, 0x20, 0x18, 0xff, 0x7f, 0xec, 0xf2, 0xc4,
-  0xe4, 0xfb, 0xfe, 0x21, 0xaa, 0xd7, 0xee, 0x32, 0xe1, 0x0c, 0xfc, 0xf0,
-  0x87, 0xbb, 0x18, 0x67, 0x29, 0x38, 0xfe, 0x7a, 0x75, 0x7a, 0xb8, 0xcf,
-  0x7f, 0xe8, 0x46, 0x1e, 0x1a, 0xdf, 0x63, 0x29, 0x1b, 0xb2, 0x7d, 0x9b,
-  0xc8, 0x0e, 0x26, 0xf5, 0x2b, 0x17, 0x0b, 0x9e, 0xc6, 0xd5, 0x5b, 0x42,
-  0x8a, 0x20, 0xe0, 0x2a, 0x7c, 0x45, 0x25, 0xf9, 0x42, 0xcc, 0x26, 0x12,
-  0x77, 0x8e, 0x53, 0x4a, 0x6c, 0xcd, 0xf9, 0xc5, 0xb5, 0x99, 0x26, 0xfa,
-  0xe9, 0x39, 0x06, 0x7b, 0x42, 0x6f, 0x26, 0xf6, 0xfb, 0x10, 0xd9, 0x11,
-  0x6e, 0xc4, 0x5e, 0x4b, 0x05, 0xd7, 0xde, 0xce, 0xbb, 0xc1, 0xc0, 0x3b,
-  0xf9, 0x52, 0x81, 0xfb, 0xad, 0x16, 0x65, 0x27, 0x8a, 0x3d, 0xfb, 0x09,
-  0x40, 0x6b, 0xde, 0x12, 0x49, 0x28, 0xc0, 0x09, 0x11, 0x04, 0x60, 0x3a,
-  0x0d, 0x48, 0x0f, 0x4f, 0xe4, 0xd8, 0x0d, 0x21, 0x20, 0xa5, 0xf8, 0x00,
-  0xe5, 0x10, 0x64, 0xf5, 0x25, 0x8c, 0x53, 0x0f, 0xd4, 0x02, 0xf0, 0xf0,
-  0x1c, 0x12, 0x4a, 0x21, 0x54, 0x30, 0xb1, 0x10, 0xb7, 0xc5, 0x0b, 0x42,
-  0xf2, 0xdf, 0xca, 0xb2, 0x25, 0x10, 0xf3, 0xca, 0x2a, 0xf1, 0x45, 0x54,
-  0x19, 0xbb, 0xea, 0x10, 0x01, 0xd5, 0x51, 0xc9, 0x7f, 0xdf, 0x25, 0xce,
-  0xda, 0xd3, 0xfa, 0xec, 0xf8, 0x3e, 0xe5, 0xe2, 0x46, 0xe3, 0x46, 0x33,
-  0x22, 0x4f, 0x20, 0x58, 0xff, 0x33, 0x02, 0x37, 0xdf, 0x02, 0x54, 0xad,
-  0x73, 0x05, 0xee, 0xf5, 0x15, 0x24, 0x09, 0xb5, 0xd7, 0xee, 0xbe, 0xec,
-  0x4c, 0xb6, 0xf2, 0x53, 0xc4, 0xe6, 0x0d, 0xe6, 0x1e, 0x43, 0xb6, 0x51,
-  0xc4, 0xac, 0x37, 0x32, 0x9e, 0xc9, 0x77, 0xfc, 0x0b, 0xd7, 0x04, 0x4b,
-  0x50, 0x60, 0x19, 0xc6, 0xc5, 0xb1, 0xc7, 0x3e, 0xb3, 0xba, 0x1a, 0x2b,
-  0x3e, 0x20, 0xfa, 0xde, 0x7f, 0x64, 0x4a, 0xb6, 0xd2, 0xef, 0xb0, 0x2e,
-  0x2a, 0xeb, 0x00, 0x15, 0xe9, 0xe2, 0x41, 0xe3, 0x1b, 0xf6, 0x43, 0x69,
-  0xec, 0x12, 0x24, 0x30, 0xd1, 0xa1, 0xda, 0x48, 0x1a, 0xd3, 0x90, 0x97,
-  0xf4, 0xbc, 0xf6, 0xf8, 0xd4, 0x4a, 0xcb, 0x2c, 0x53, 0x09, 0xb8, 0xe4,
-  0xc4, 0xd5, 0x57, 0x81, 0xe6, 0x7b, 0xf6, 0x41, 0xac, 0x26, 0xf8, 0xe8,
-  0xef, 0xd9, 0xf2, 0x2f, 0x70, 0xdb, 0xcf, 0xff, 0x22, 0x29, 0x52, 0x0b,
-  0xf0, 0x20, 0xe4, 0xde, 0x32, 0x35, 0xca, 0xb1, 0x3f, 0xcb, 0x67, 0x94,
-  0x41, 0x03, 0x8a, 0xe5, 0x36, 0xd1, 0xf4, 0x63, 0x33, 0x96, 0xb9, 0xc7,
-  0xc0, 0x0d, 0x28, 0x2e, 0x2e, 0x51, 0xe8, 0x09, 0x3c, 0x3f, 0x7f, 0x21,
-  0x49, 0x08, 0xc0, 0xd9, 0x10, 0xe6, 0xbb, 0xd2, 0xa6, 0xc2, 0x40, 0xd8,
-  0xf4, 0x00, 0x56, 0xee, 0x68, 0x1d, 0x25, 0x4f, 0xbf, 0x78, 0x94, 0x75,
-  0x0c, 0xc3, 0xa9, 0x0f, 0xdf, 0x08, 0x64, 0xf1, 0x34, 0x2a, 0xe7, 0xfe,
-  0xb3, 0x51, 0x0a, 0x38, 0xee, 0xd9, 0x03, 0x02, 0x6f, 0x28, 0xa6, 0x06,
-  0xd3, 0x47, 0xe6, 0xb1, 0xc5, 0x0c, 0xf0, 0x1e, 0xdc, 0xc0, 0x9a, 0x25,
-  0x25, 0xf8, 0xaf, 0x66, 0x05, 0x01, 0xf3, 0x45, 0x35, 0x2d, 0xe0, 0x1d,
-  0x50, 0x81, 0x41, 0x35, 0xee, 0xfb, 0x24, 0xe0, 0xef, 0xf3, 0x42, 0xb1,
-  0x8f, 0xf9, 0xf4, 0xed, 0x3b, 0xee, 0xcc, 0xe5, 0xf2, 0x10, 0x03, 0x2d,
-  0x13, 0xfd, 0x29, 0x9e, 0xeb, 0x45, 0x48, 0xe8, 0x41, 0xb9, 0x02, 0xfa,
-  0xdc, 0xda, 0xb5, 0xac, 0x35, 0x15, 0x05, 0xb8, 0xaf, 0xd3, 0x15, 0xe3,
-  0x22, 0x54, 0x31, 0xcd, 0xfa, 0xda, 0x13, 0x2f, 0x09, 0x1f, 0x48, 0x73,
-  0x42, 0xfb, 0xc9, 0x38, 0x19, 0x31, 0xcd, 0x19, 0xd6, 0xbb, 0xdf, 0x07,
-  0x26, 0xe1, 0x50, 0x3a, 0x40, 0xd5, 0xd8, 0xee, 0x2e, 0xbb, 0x31, 0xec,
-  0x4a, 0x52, 0x42, 0x38, 0x7f, 0x27, 0x43, 0x33, 0xb8, 0x16, 0x66, 0x13,
-  0x4b, 0xd5, 0xe7, 0x83, 0x33, 0x18, 0x1a, 0xca, 0x3d, 0x17, 0xe7, 0x24,
-  0x44, 0x55, 0x00, 0xfd, 0x3a, 0xb1, 0xd7, 0xb9, 0xcf, 0xf9, 0xd0, 0x2f,
-  0x7f, 0x6b, 0x55, 0xd9, 0x31, 0x27, 0xb0, 0xf3, 0xe2, 0x43, 0x03, 0x10,
-  0xf0, 0xbb, 0xd1, 0xe9, 0x2d, 0x08, 0x17, 0xf0, 0x5d, 0x3e, 0xa6, 0xff,
-  0xd0, 0xd5, 0xbd, 0x60, 0x91, 0x13, 0xed, 0x1c, 0xab, 0x2f, 0x64, 0xaf,
-  0x31, 0x54, 0x44, 0x51, 0x7f, 0x2f, 0x19, 0xe3, 0x48, 0xf8, 0xe6, 0xb6,
-  0xf6, 0x01, 0x61, 0xdd, 0x52, 0xf0, 0x21, 0x24, 0xc7, 0x15, 0x1c, 0xf8,
-  0x28, 0x27, 0x0f, 0xd3, 0x44, 0x42, 0xe9, 0x3c, 0xb8, 0xda, 0xc7, 0xc1,
-  0xcb, 0xf6, 0x2b, 0xe2, 0x5e, 0xf3, 0x66, 0x4d, 0xb1, 0x44, 0xf6, 0x60,
-  0xba, 0xc6, 0x5b, 0x73, 0x5f, 0x21, 0xc1, 0x1e, 0x24, 0xd4, 0xd9, 0x08,
-  0x40, 0xcc, 0x3f, 0xe6, 0xb7, 0xbc, 0xaf, 0xe6, 0xa1, 0x53, 0x08, 0x33,
-  0xb8, 0x3a, 0x61, 0x0a, 0x11, 0xa5, 0xf9, 0x30, 0xd3, 0x58, 0xf0, 0x18,
-  0x62, 0x17, 0x7f, 0xb2, 0x4f, 0x38, 0x46, 0x42, 0x67, 0xf6, 0x5b, 0xd0,
-  0xb7, 0x2b, 0xdc, 0x64, 0xbd, 0xc1, 0x0e, 0x39, 0xb8, 0x10, 0xf4, 0x46,
-  0xc0, 0x11, 0x37, 0x5d, 0xbd, 0x4d, 0xdd, 0xe7, 0xb8, 0xe1, 0xf5, 0x5c,
-  0xea, 0xe0, 0xbe, 0xba, 0x56, 0xad, 0x20, 0xe2, 0xaf, 0xb0, 0x3d, 0x1a,
-  0xc4, 0x1d, 0x0a, 0x21, 0xd7, 0xfa, 0xe7, 0xdf, 0x1f, 0x02, 0xe2, 0xd5,
-  0xc4, 0xe2, 0x39, 0x7f, 0x50, 0x23, 0x9d, 0x27, 0xd3, 0xc1, 0x5e, 0x10,
-  0x16, 0x3d, 0xd9, 0xa6, 0xc4, 0xb7, 0xe1, 0x43, 0xf0, 0x1a, 0xd7, 0x51,
-  0xf7, 0x0c, 0x05, 0x09, 0x03, 0x13, 0xe6, 0xe6, 0xed, 0x69, 0xd4, 0x2e,
-  0xd7, 0xbd, 0x1f, 0xe9, 0xca, 0xc8, 0x26, 0x0e, 0x0a, 0xf8, 0xd5, 0xa3,
-  0xcb, 0xed, 0x0a, 0x0d, 0xf0, 0xf6, 0x00, 0x23, 0x17, 0xd7, 0xc8, 0xf9,
-  0x19, 0x39, 0x34, 0xf9, 0xfb, 0x35, 0x23, 0x39, 0xfc, 0xfd, 0xcc, 0xf6,
-  0x13, 0x34, 0xcd, 0x20, 0xd7, 0xb2, 0xe6, 0x30, 0xe7, 0xae, 0xce, 0xfe,
-  0x16, 0xb7, 0x29, 0x0c, 0xd6, 0x7f, 0x33, 0xc5, 0xe3, 0x2f, 0x2d, 0xc3,
-  0x2e, 0xda, 0x1d, 0x1d, 0xe0, 0x08, 0xb0, 0x2b, 0xb8, 0x43, 0xbe, 0x12,
-  0x34, 0xf8, 0xfc, 0xf1, 0x4d, 0xcc, 0xa3, 0x0a, 0xf6, 0x0b, 0x65, 0xfe,
-  0x7f, 0x48, 0x08, 0x31, 0xb1, 0x36, 0x3f, 0x00, 0xba, 0xcf, 0x41, 0xdd,
-  0x49, 0xfa, 0x79, 0xc2, 0xcd, 0x62, 0xd0, 0x4c, 0xda, 0x9b, 0x26, 0x1e,
-  0x30, 0x89, 0x33, 0xd2, 0x3b, 0x8b, 0xc3, 0xbf, 0xc5, 0x20, 0x2e, 0x32,
-  0x0d, 0xf1, 0x2f, 0x2a, 0x3c, 0x29, 0xbc, 0x52, 0xe7, 0x04, 0x15, 0x05,
-  0xe8, 0x06, 0xec, 0x31, 0x30, 0x24, 0x0b, 0x38, 0xfd, 0xcd, 0xae, 0xe3,
-  0x1a, 0xcb, 0x45, 0x58, 0xf1, 0x48, 0xaf, 0x0b, 0x39, 0xe2, 0x32, 0xe7,
-  0x13, 0x08, 0x4f, 0xf9, 0x48, 0x21, 0x3b, 0x4d, 0xc8, 0x37, 0x9c, 0xc1,
-  0x27, 0xfb, 0xea, 0xb1, 0x9f, 0xdb, 0x5c, 0xb6, 0xa4, 0x60, 0xea, 0x1c,
-  0xcb, 0x16, 0x35, 0xfd, 0xe3, 0xd7, 0xe1, 0xe4, 0x7f, 0x4e, 0x4f, 0x06,
-  0xc2, 0xf9, 0x34, 0x30, 0xcb, 0x39, 0xb0, 0xa1, 0xe2, 0x53, 0x44, 0x07,
-  0xdc, 0x2c, 0xcd, 0x28, 0xb2, 0x40, 0xf7, 0x15, 0xd6, 0x81, 0xd1, 0xd8,
-  0x19, 0xec, 0x2e, 0xdc, 0xc7, 0xac, 0x1d, 0xa6, 0x93, 0xae, 0x20, 0x46,
-  0xcf, 0x5f, 0x24, 0x37, 0xe1, 0xa6, 0x4d, 0x2d, 0xf6, 0x68, 0x24, 0xb6,
-  0x31, 0x84, 0xd6, 0x55, 0x0d, 0x22, 0xee, 0x25, 0xb8, 0xd5, 0xf8, 0x19,
-  0xe0, 0x22, 0xed, 0x18, 0xed, 0xf4, 0x9c, 0x07, 0xf7, 0x4a, 0xe4, 0x03,
-  0xd1, 0x12, 0x37, 0x16, 0xc3, 0xdc, 0xfa, 0x00, 0x52, 0x2b, 0x1b, 0x34,
-  0x3e, 0xdb, 0x49, 0xe4, 0x37, 0x23, 0x23, 0xd5, 0x23, 0x14, 0xf7, 0xf7,
-  0x49, 0xb5, 0xba, 0xc0, 0x0d, 0x0c, 0x0e, 0x3f, 0xe6, 0xfe, 0xad, 0xde,
-  0xb3, 0xf7, 0x94, 0xf4, 0xd5, 0xd8, 0x01, 0x15, 0xf0, 0x7f, 0xfc, 0xbf,
-  0xc0, 0x07, 0x18, 0x07, 0x0d, 0x1b, 0xb7, 0x37, 0xee, 0xff, 0xc0, 0xed,
-  0xc8, 0x60, 0xeb, 0xb2, 0xe8, 0x0d, 0x52, 0x05, 0x10, 0x0c, 0x49, 0xf4,
-  0xca, 0xee, 0x04, 0xdc, 0x39, 0xf7, 0xab, 0x03, 0xd9, 0xd0, 0x81, 0x3e,
-  0x22, 0x05, 0x23, 0xd1, 0xcd, 0xde, 0x55, 0xd5, 0xef, 0xac, 0xe2, 0xdb,
-  0x4d, 0x0a, 0x31, 0x15, 0xc9, 0x0b, 0x2d, 0x14, 0xa5, 0xec, 0x14, 0x12,
-  0xcf, 0x94, 0xe2, 0x4e, 0x57, 0x4d, 0xcf, 0x28, 0x31, 0xd6, 0xc5, 0xbc,
-  0x30, 0xc7, 0x44, 0xea, 0xc5, 0xf5, 0x02, 0x2a, 0x22, 0x2b, 0x04, 0x2f,
-  0x44, 0x35, 0xf6, 0x25, 0xfc, 0x13, 0x04, 0x06, 0x35, 0x63, 0xf8, 0x6f,
-  0x7c, 0xa7, 0xb6, 0x4c, 0x5d, 0xf9, 0x0f, 0xfb, 0x00, 0xf1, 0x24, 0xce,
-  0x34, 0xf2, 0x50, 0xe0, 0x7f, 0x4d, 0xa4, 0x9a, 0xdc, 0xd3, 0xd2, 0xc4,
-  0xfa, 0x0b, 0x53, 0xf6, 0xd6, 0x8a, 0x26, 0xbd, 0xf0, 0x0c, 0x46, 0xfb,
-  0x18, 0xcf, 0x30, 0xe0, 0xf5, 0xac, 0xb6, 0x20, 0xac, 0xfe, 0x08, 0xaa,
-  0xcd, 0x43, 0x23, 0xed, 0xf9, 0xfb, 0x0c, 0x76, 0xd8, 0x31, 0xfc, 0x04,
-  0x02, 0xce, 0x24, 0x21, 0xe3, 0x26, 0x09, 0xd7, 0xf0, 0xc3, 0xc9, 0xd4,
-  0x46, 0x16, 0xfb, 0xe4, 0xc0, 0x2d, 0xfc, 0x32, 0x51, 0xbe, 0x05, 0xef,
-  0xcd, 0xef, 0x22, 0x29, 0x7f, 0xbd, 0x52, 0x23, 0x23, 0x22, 0x2c, 0xa0,
-  0x24, 0x0d, 0x21, 0xdc, 0xdd, 0x02, 0x3f, 0x08, 0x42, 0xf1, 0x2c, 0x17,
-  0x58, 0xd1, 0xf5, 0xf0, 0x43, 0x32, 0x6f, 0x03, 0xc2, 0xe8, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0xf0, 0xff, 0xff,
-  0x74, 0xff, 0xff, 0xff, 0x82, 0x01, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00,
-  0xc3, 0xff, 0xff, 0xff, 0xb0, 0xf6, 0xff, 0xff, 0x16, 0xf5, 0xff, 0xff,
-  0xb7, 0x12, 0x00, 0x00, 0x07, 0xf5, 0xff, 0xff, 0x95, 0xec, 0xff, 0xff,
-  0x56, 0x17, 0x00, 0x00, 0x2f, 0x0a, 0x00, 0x00, 0x69, 0xf2, 0xff, 0xff,
-  0xd1, 0xef, 0xff, 0xff, 0x8e, 0xf8, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-  0x35, 0x08, 0x00, 0x00, 0x92, 0x1b, 0x00, 0x00, 0xd6, 0xf7, 0xff, 0xff,
-  0xaa, 0xf1, 0xff, 0xff, 0x3d, 0x04, 0x00, 0x00, 0xab, 0xef, 0xff, 0xff,
-  0x0c, 0x14, 0x00, 0x00, 0x16, 0xe7, 0xff, 0xff, 0x19, 0xf0, 0xff, 0xff,
-  0x49, 0x0a, 0x00, 0x00, 0x3b, 0xf6, 0xff, 0xff, 0xb2, 0xfe, 0xff, 0xff,
-  0xbc, 0xfa, 0xff, 0xff, 0x20, 0x03, 0x00, 0x00, 0xf6, 0xea, 0xff, 0xff,
-  0x56, 0xea, 0xff, 0xff, 0x26, 0x05, 0x00, 0x00, 0x4b, 0xf2, 0xff, 0xff,
-  0xb0, 0xfc, 0xff, 0xff, 0x82, 0xf2, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff,
-  0x8c, 0x07, 0x00, 0x00, 0x1c, 0xfe, 0xff, 0xff, 0x58, 0xee, 0xff, 0xff,
-  0x8b, 0x09, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x08, 0xfd, 0xff, 0xff, 0x86, 0xdf, 0xff, 0xff, 0x61, 0xf1, 0xff, 0xff,
-  0xaf, 0xf6, 0xff, 0xff, 0xd7, 0xf8, 0xff, 0xff, 0x0b, 0xfd, 0xff, 0xff,
-  0x0e, 0xf5, 0xff, 0xff, 0x4e, 0x06, 0x00, 0x00, 0xd8, 0xf0, 0xff, 0xff,
-  0x87, 0xf8, 0xff, 0xff, 0xc6, 0xed, 0xff, 0xff, 0x1b, 0xfc, 0xff, 0xff,
-  0x94, 0x03, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x22, 0xf6, 0xff, 0xff,
-  0xab, 0xf7, 0xff, 0xff, 0x18, 0x0d, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x01, 0xfa, 0xff, 0xff, 0x4d, 0xf7, 0xff, 0xff,
-  0xce, 0xe9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
-  0xce, 0x44, 0x1d, 0xcb, 0xb7, 0x49, 0x7f, 0x27, 0x7f, 0x21, 0x38, 0x75,
-  0xd5, 0x1f, 0xc1, 0x6c, 0xb4, 0x00, 0x7f, 0x45, 0xbe, 0x5a, 0x1d, 0x7f,
-  0x31, 0xc0, 0x7f, 0xef, 0xdb, 0x1c, 0x7f, 0x8e, 0x6b, 0x5f, 0x21, 0x7f,
-  0x25, 0xc2, 0x37, 0x60, 0xc6, 0xd2, 0xee, 0x81, 0x7f, 0x86, 0x4f, 0x15,
-  0x81, 0x18, 0x09, 0x9a, 0x81, 0xcf, 0x34, 0x3f, 0x60, 0x1a, 0x0c, 0xbc,
-  0x7f, 0x81, 0xc6, 0x03, 0xdb, 0x46, 0xad, 0x92, 0x81, 0x60, 0xfa, 0x4c,
-  0x61, 0x8c, 0x79, 0x70, 0xc0, 0xee, 0xa6, 0x53, 0x02, 0x68, 0x4d, 0x6d,
-  0x81, 0x4d, 0xf5, 0x44, 0x35, 0xbc, 0x34, 0x97, 0x20, 0xe4, 0x4c, 0x3a,
-  0x58, 0x7f, 0x71, 0x57, 0x6e, 0xdc, 0x57, 0x4d, 0x81, 0xa9, 0x81, 0x96,
-  0x34, 0x52, 0x67, 0x17, 0x8c, 0x0b, 0xce, 0x81, 0x94, 0x99, 0xef, 0x23,
-  0x50, 0x7f, 0x7f, 0xe7, 0x3a, 0xd8, 0xa1, 0x05, 0x81, 0xf3, 0x26, 0xfa,
-  0x84, 0x7f, 0x4b, 0x40, 0x33, 0xca, 0x6a, 0x79, 0x30, 0x1e, 0x81, 0x7f,
-  0xa7, 0x81, 0x5d, 0x7f, 0xe1, 0x38, 0x7f, 0x48, 0x24, 0x81, 0x47, 0x97,
-  0x07, 0x7f, 0x68, 0x81, 0x36, 0x23, 0x3f, 0x26, 0x49, 0x81, 0x7f, 0x7f,
-  0xb7, 0x81, 0xaf, 0xed, 0x64, 0x13, 0x07, 0x81, 0x97, 0x1f, 0x6d, 0xb6,
-  0xb1, 0x1a, 0xe8, 0x43, 0x35, 0x1c, 0xfc, 0xad, 0x69, 0xbc, 0xca, 0x25,
-  0x10, 0x48, 0x81, 0xde, 0x24, 0x2a, 0x4b, 0x08, 0xf0, 0x81, 0x45, 0x2d,
-  0x81, 0xc8, 0x0d, 0x6a, 0xe6, 0xd4, 0x4f, 0x67, 0xb8, 0x41, 0x11, 0x4c,
-  0xa9, 0xde, 0x57, 0xc6, 0xf5, 0xff, 0x38, 0x12, 0x4c, 0x73, 0x7f, 0x33,
-  0x5c, 0xdc, 0x2e, 0x44, 0xd1, 0xc7, 0xde, 0x19, 0x50, 0xa6, 0x6b, 0xa0,
-  0x3d, 0x81, 0xd0, 0xda, 0xfa, 0x81, 0xbd, 0x4b, 0x1f, 0x2d, 0xf1, 0x0c,
-  0x6d, 0x8b, 0xd4, 0xf2, 0xfd, 0x22, 0xef, 0xb0, 0x1a, 0x5d, 0x0c, 0x66,
-  0x14, 0x99, 0x51, 0x1c, 0x42, 0x33, 0x19, 0x16, 0xf7, 0x0c, 0x50, 0xee,
-  0xf4, 0x25, 0x52, 0x2b, 0x8e, 0xc2, 0x2c, 0xd9, 0x25, 0x45, 0xe2, 0x9f,
-  0x29, 0xc2, 0xe0, 0x05, 0x14, 0xfd, 0x78, 0x24, 0xee, 0x94, 0x17, 0xcc,
-  0x30, 0x81, 0x35, 0x86, 0x2e, 0xee, 0x09, 0xf5, 0xe0, 0x12, 0xb1, 0x0e,
-  0x3e, 0x57, 0x1e, 0x08, 0x51, 0xd6, 0xdd, 0x6d, 0x16, 0x7a, 0xfc, 0xa5,
-  0x0a, 0x4c, 0x31, 0x34, 0x57, 0x24, 0x30, 0x2a, 0x22, 0x09, 0x0c, 0x54,
-  0x81, 0x5d, 0x26, 0x64, 0xd1, 0x59, 0x26, 0x3a, 0x81, 0xbb, 0x3c, 0x81,
-  0x1d, 0x28, 0x07, 0xf2, 0x09, 0x57, 0x67, 0xef, 0x7f, 0xc9, 0x67, 0x28,
-  0xcc, 0xe8, 0xc4, 0xa7, 0x5a, 0xa8, 0x39, 0xfb, 0x03, 0xfa, 0xeb, 0x27,
-  0xc5, 0xd5, 0x1b, 0x56, 0x33, 0x0a, 0x58, 0xd3, 0x63, 0x8e, 0x81, 0x55,
-  0x0c, 0x29, 0xe6, 0x09, 0xa6, 0x1c, 0x2e, 0xd0, 0x65, 0xf3, 0x77, 0x56,
-  0x83, 0xf6, 0x16, 0x6d, 0xe7, 0x03, 0x61, 0x26, 0x2f, 0x79, 0x20, 0x5f,
-  0xc0, 0x9f, 0x54, 0xc8, 0x81, 0x0b, 0x4b, 0xd0, 0x4c, 0xee, 0xf1, 0x35,
-  0x7b, 0x9e, 0x6b, 0x4b, 0xfa, 0x14, 0xb5, 0x1f, 0x6e, 0xc9, 0x06, 0xef,
-  0x38, 0xf8, 0x81, 0x22, 0x1d, 0x0c, 0xda, 0x7f, 0x7f, 0x2a, 0x33, 0x8a,
-  0x7f, 0xd9, 0xde, 0x14, 0x1b, 0x7f, 0x28, 0xa4, 0x89, 0x5a, 0x34, 0x52,
-  0x3c, 0xa5, 0x61, 0xfb, 0xda, 0x81, 0xe7, 0x59, 0xda, 0xd6, 0x3e, 0x44,
-  0xea, 0x27, 0xe6, 0x3e, 0x9c, 0xb8, 0x04, 0xc8, 0x19, 0x40, 0x37, 0xcd,
-  0x64, 0x3c, 0x19, 0xc5, 0x5b, 0xb3, 0x57, 0x2b, 0x0b, 0x23, 0xe3, 0xfb,
-  0x2c, 0xef, 0x27, 0x38, 0x39, 0x15, 0x8d, 0xc1, 0x35, 0xa4, 0xc6, 0x36,
-  0x5c, 0x0d, 0x59, 0xc4, 0x4c, 0x81, 0xe6, 0x24, 0x15, 0xf8, 0xbc, 0x81,
-  0xfe, 0x64, 0x03, 0x7f, 0x33, 0x1d, 0x7f, 0x7f, 0xa4, 0x8b, 0x0a, 0x2b,
-  0xff, 0x04, 0x6d, 0x3c, 0x03, 0x7f, 0x48, 0x5d, 0x81, 0x87, 0x2f, 0xd2,
-  0xca, 0x44, 0x4e, 0x2f, 0x7f, 0x36, 0x54, 0xdc, 0x61, 0x8e, 0x2c, 0x52,
-  0xf1, 0x0b, 0x11, 0xeb, 0x54, 0x0c, 0x7f, 0x1c, 0x4f, 0x04, 0xfa, 0x20,
-  0x0c, 0xfc, 0x81, 0x56, 0x67, 0x67, 0x61, 0x81, 0x66, 0xa5, 0xd4, 0x7f,
-  0x1a, 0xec, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xd6, 0x00, 0x00, 0x00, 0x3e, 0xf3, 0xff, 0xff, 0xc4, 0x02, 0x00, 0x00,
-  0x06, 0x10, 0x00, 0x00, 0x5f, 0x06, 0x00, 0x00, 0x23, 0xf0, 0xff, 0xff,
-  0x05, 0xf7, 0xff, 0xff, 0xe5, 0xf2, 0xff, 0xff, 0xe7, 0xf8, 0xff, 0xff,
-  0x85, 0x09, 0x00, 0x00, 0xeb, 0xeb, 0xff, 0xff, 0xab, 0xf3, 0xff, 0xff,
-  0x62, 0x04, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
-  0xb0, 0xf6, 0xff, 0xff, 0xaa, 0x0a, 0x00, 0x00, 0x49, 0xff, 0xff, 0xff,
-  0x8f, 0xf4, 0xff, 0xff, 0x01, 0xfa, 0xff, 0xff, 0x6b, 0x0b, 0x00, 0x00,
-  0x21, 0xfa, 0xff, 0xff, 0x5a, 0xf7, 0xff, 0xff, 0x59, 0xff, 0xff, 0xff,
-  0x8a, 0x06, 0x00, 0x00, 0x92, 0x18, 0x00, 0x00, 0x8a, 0xf4, 0xff, 0xff,
-  0x77, 0x12, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xa7, 0xf7, 0xff, 0xff,
-  0xad, 0xfb, 0xff, 0xff, 0x32, 0x06, 0x00, 0x00, 0xfc, 0xf2, 0xff, 0xff,
-  0xeb, 0xf3, 0xff, 0xff, 0xc3, 0xf4, 0xff, 0xff, 0xd0, 0xfa, 0xff, 0xff,
-  0x74, 0xe9, 0xff, 0xff, 0x97, 0x15, 0x00, 0x00, 0xbb, 0xed, 0xff, 0xff,
-  0xc6, 0xfc, 0xff, 0xff, 0xa6, 0x0b, 0x00, 0x00, 0xf3, 0x08, 0x00, 0x00,
-  0x27, 0x08, 0x00, 0x00, 0x24, 0x0d, 0x00, 0x00, 0x13, 0xfc, 0xff, 0xff,
-  0x96, 0x07, 0x00, 0x00, 0xfe, 0xf2, 0xff, 0xff, 0x37, 0x02, 0x00, 0x00,
-  0x4c, 0xfe, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0x8d, 0x03, 0x00, 0x00,
-  0x1f, 0x02, 0x00, 0x00, 0x6d, 0x08, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00,
-  0x1c, 0x05, 0x00, 0x00, 0x62, 0xf3, 0xff, 0xff, 0x8f, 0xf3, 0xff, 0xff,
-  0x2a, 0xf6, 0xff, 0xff, 0x40, 0xf6, 0xff, 0xff, 0xc8, 0x0f, 0x00, 0x00,
-  0xd0, 0xf1, 0xff, 0xff, 0xed, 0x16, 0x00, 0x00, 0xee, 0x0c, 0x00, 0x00,
-  0x29, 0xf6, 0xff, 0xff, 0x26, 0xed, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0xd1, 0xde, 0x14, 0xfa, 0xe8, 0xde, 0xdb, 0xdd,
-  0xfb, 0xdd, 0x07, 0xf8, 0x1c, 0xe2, 0xe5, 0x28, 0xe8, 0x1f, 0xf7, 0x3c,
-  0x22, 0x4e, 0xda, 0x7f, 0x00, 0xf7, 0xf1, 0xf3, 0xf1, 0xf3, 0xf2, 0x10,
-  0xea, 0x38, 0x16, 0x05, 0x0f, 0x04, 0x06, 0x49, 0x0f, 0x40, 0x09, 0xed,
-  0x15, 0x26, 0x18, 0xea, 0xf7, 0xe1, 0x0b, 0x20, 0x17, 0xd8, 0x02, 0x1d,
-  0x34, 0xe4, 0x1b, 0x32, 0x1c, 0x2c, 0xe4, 0x17, 0xcd, 0xc5, 0x2c, 0x33,
-  0xbd, 0xfc, 0x38, 0xf0, 0x19, 0xb7, 0xf7, 0x4b, 0xb1, 0x98, 0xed, 0x28,
-  0x09, 0xcb, 0x06, 0x06, 0xf2, 0x3b, 0xf1, 0x51, 0xf8, 0x3e, 0xc6, 0xe6,
-  0x11, 0x32, 0x7f, 0x0b, 0xce, 0xf1, 0x00, 0x4d, 0xec, 0x1f, 0xbf, 0x44,
-  0xfb, 0x22, 0x09, 0x18, 0x59, 0xd9, 0xd9, 0xfc, 0x0f, 0xf9, 0xe7, 0xc0,
-  0x22, 0xf4, 0x3d, 0xe7, 0x06, 0xfc, 0x5b, 0x40, 0x01, 0xfb, 0x4a, 0x23,
-  0x22, 0xf1, 0x4b, 0x4b, 0x18, 0x5c, 0xe4, 0xbb, 0xf0, 0xdc, 0x04, 0xc2,
-  0x0c, 0xd8, 0xc9, 0x0c, 0x24, 0x34, 0x42, 0xe5, 0x71, 0xb7, 0x18, 0x1f,
-  0x26, 0x8b, 0x07, 0x48, 0xb9, 0xcd, 0xb0, 0xf5, 0x5a, 0x13, 0x59, 0x09,
-  0xe5, 0xeb, 0x11, 0xc5, 0x45, 0x12, 0x18, 0x10, 0x10, 0x1b, 0xd4, 0x17,
-  0xf6, 0x45, 0x14, 0x30, 0xf9, 0xcf, 0x32, 0xe3, 0x42, 0x51, 0xf9, 0x81,
-  0x5a, 0x45, 0xb6, 0x21, 0x28, 0x06, 0xe9, 0xa7, 0xd0, 0xfd, 0xb8, 0xde,
-  0xfe, 0x21, 0xcf, 0x7f, 0x56, 0xf7, 0xaf, 0xf0, 0xf7, 0xd3, 0xeb, 0x2a,
-  0xc1, 0xd6, 0xec, 0xb5, 0x28, 0x02, 0xea, 0x9a, 0x1b, 0x0b, 0xc0, 0xe8,
-  0xf2, 0xf0, 0xff, 0xd8, 0xb8, 0xf5, 0x43, 0x00, 0x38, 0x5c, 0xc7, 0xd0,
-  0x52, 0x00, 0x0c, 0x3d, 0x10, 0xfa, 0xf1, 0x3d, 0xe6, 0x34, 0x31, 0xbe,
-  0x09, 0x62, 0x3b, 0x59, 0xaf, 0xc2, 0xdb, 0xec, 0x0c, 0xf6, 0xc5, 0xf9,
-  0xc2, 0x0e, 0xc6, 0x39, 0x7f, 0xcb, 0xfa, 0x12, 0x35, 0x11, 0x3a, 0x1e,
-  0xe1, 0x30, 0x06, 0x51, 0x09, 0x6d, 0x31, 0x14, 0x20, 0xde, 0x11, 0x2d,
-  0xcb, 0xe4, 0xf1, 0xf8, 0xe0, 0x39, 0x16, 0x15, 0xa6, 0x4d, 0x48, 0x17,
-  0x37, 0xdd, 0xeb, 0xd2, 0x28, 0x22, 0x4c, 0x1e, 0x72, 0x1e, 0xbe, 0x24,
-  0x54, 0x3a, 0x2b, 0xec, 0x22, 0xf3, 0x03, 0x29, 0xfc, 0xed, 0xf3, 0xa4,
-  0x1e, 0x0d, 0xd8, 0x27, 0xed, 0x1d, 0xc3, 0x27, 0xf5, 0x03, 0xd8, 0xf0,
-  0x09, 0x17, 0x1c, 0x58, 0xfa, 0xd5, 0xe0, 0x40, 0x05, 0x03, 0xd6, 0x7f,
-  0xef, 0x16, 0xef, 0xe7, 0xf4, 0x10, 0x3e, 0xed, 0x29, 0x2d, 0x0a, 0x29,
-  0xe7, 0xd9, 0xf8, 0x35, 0x0e, 0x44, 0x22, 0x4f, 0x1d, 0xca, 0x03, 0x0c,
-  0xf0, 0xf5, 0x15, 0x12, 0xc7, 0xfe, 0x2d, 0xf3, 0x43, 0xfb, 0xea, 0x19,
-  0x28, 0x21, 0xf1, 0xf5, 0xe9, 0x2c, 0xfe, 0xec, 0x1a, 0xe4, 0xe0, 0x29,
-  0x0c, 0xd7, 0x1d, 0xea, 0xd6, 0x0d, 0x0e, 0x53, 0xf5, 0x1b, 0xfe, 0x00,
-  0x43, 0x64, 0xe1, 0x7f, 0x1c, 0x1c, 0x0d, 0x0c, 0xe3, 0x12, 0x4e, 0xc6,
-  0xe1, 0x24, 0x25, 0xe1, 0x19, 0x14, 0x11, 0x56, 0x34, 0x28, 0xe6, 0x06,
-  0x46, 0xda, 0x09, 0x29, 0xfb, 0x14, 0xec, 0x25, 0xe9, 0xef, 0x38, 0xe4,
-  0x2b, 0xb2, 0xee, 0x0d, 0x13, 0xfc, 0xd0, 0xf6, 0x18, 0xdc, 0x36, 0xe0,
-  0x10, 0xc0, 0x27, 0x52, 0x0a, 0x40, 0x4b, 0x4b, 0x08, 0x1b, 0xf7, 0xa5,
-  0x1b, 0xdd, 0x40, 0xdc, 0xff, 0x06, 0x28, 0x1e, 0x15, 0x16, 0xa7, 0x9b,
-  0xb9, 0x02, 0xcd, 0x38, 0x1c, 0x22, 0xaf, 0x17, 0x1e, 0x4a, 0x17, 0xce,
-  0x15, 0xdb, 0xf4, 0xfe, 0x34, 0xf0, 0x1c, 0x09, 0x7f, 0xca, 0xe2, 0xd4,
-  0x52, 0x51, 0x1f, 0xf6, 0xe6, 0x02, 0xd7, 0xd8, 0xee, 0x10, 0x21, 0x22,
-  0xe5, 0x40, 0x33, 0x17, 0xe0, 0x7f, 0x02, 0xd6, 0xd0, 0x09, 0xe2, 0xee,
-  0x2c, 0x0e, 0xe8, 0x29, 0x3e, 0xc2, 0x2c, 0xdb, 0x05, 0xf0, 0xef, 0x0a,
-  0xf9, 0xfc, 0xcd, 0x15, 0xd7, 0xc4, 0xc3, 0x28, 0x1d, 0xe1, 0xf9, 0x11,
-  0xf6, 0xa5, 0x0d, 0x17, 0x12, 0x48, 0x18, 0x50, 0xdd, 0x1c, 0x14, 0x04,
-  0xe9, 0x0e, 0x29, 0xec, 0x49, 0xdd, 0xd1, 0xcb, 0x6a, 0x1f, 0x1b, 0xad,
-  0x4c, 0x5d, 0xb5, 0x15, 0xff, 0x3d, 0x48, 0x77, 0xf2, 0x7f, 0x17, 0xbf,
-  0x14, 0xbc, 0x04, 0x05, 0xc0, 0x1e, 0x2f, 0x0d, 0x7d, 0xf0, 0x52, 0xb4,
-  0x44, 0xed, 0x1b, 0xc3, 0x2a, 0x9b, 0xdf, 0xea, 0x13, 0x3c, 0x17, 0x26,
-  0x44, 0xf7, 0xfb, 0xb7, 0xe9, 0xab, 0x2a, 0x0d, 0x64, 0x65, 0x19, 0x4e,
-  0xd5, 0xd7, 0xd7, 0x13, 0xb8, 0x04, 0x38, 0x2b, 0xea, 0xf7, 0xb2, 0xab,
-  0xf1, 0xc9, 0xde, 0xb4, 0x09, 0x6c, 0x19, 0x58, 0x12, 0x1c, 0xfb, 0xdd,
-  0x02, 0x3a, 0xd2, 0xfc, 0xec, 0x28, 0x81, 0xe4, 0x15, 0x49, 0xed, 0x55,
-  0x26, 0x1b, 0xfb, 0x49, 0x4b, 0x35, 0xee, 0x6c, 0x5b, 0xb6, 0x1b, 0x33,
-  0xf1, 0x3f, 0xd9, 0x04, 0x2c, 0xe4, 0x23, 0x0e, 0xf9, 0xd4, 0xf8, 0x48,
-  0x0e, 0x1a, 0x27, 0x39, 0xff, 0x40, 0xe1, 0x32, 0xe3, 0x10, 0x11, 0xb7,
-  0xe3, 0xff, 0xf6, 0x12, 0x27, 0xf9, 0xf1, 0x53, 0x68, 0x17, 0xf7, 0xea,
-  0xb7, 0xd4, 0x24, 0xe8, 0xd8, 0xdc, 0xce, 0x11, 0xf7, 0xdd, 0x04, 0xd2,
-  0x06, 0xf0, 0x0d, 0x5e, 0x3e, 0xea, 0xe8, 0x46, 0x56, 0x51, 0x1b, 0x7f,
-  0x36, 0xe6, 0xee, 0x03, 0x20, 0x1f, 0x36, 0x2b, 0x0d, 0xf0, 0x20, 0x0c,
-  0x13, 0x1d, 0x36, 0x4e, 0xe0, 0xe4, 0x2b, 0x05, 0x38, 0xc5, 0xe8, 0x43,
-  0x09, 0xdf, 0xd5, 0xf3, 0xff, 0xfb, 0xfa, 0xf8, 0x32, 0x21, 0x05, 0x3c,
-  0x55, 0x05, 0xc0, 0x08, 0xfc, 0xce, 0x3d, 0xfd, 0xfc, 0x0b, 0x07, 0x1c,
-  0x26, 0xf6, 0x21, 0xd1, 0x0e, 0x3f, 0xe2, 0xe2, 0x59, 0xe9, 0x49, 0xd7,
-  0x04, 0xb4, 0xb3, 0xf3, 0xc8, 0xe2, 0xc7, 0x6d, 0xbe, 0x38, 0x09, 0x22,
-  0x48, 0x0e, 0x41, 0xc0, 0xe1, 0x81, 0x1d, 0x21, 0x1e, 0xf4, 0x6b, 0xff,
-  0xf2, 0xfc, 0x44, 0x3b, 0xfd, 0x19, 0x44, 0xde, 0x1e, 0xef, 0xf0, 0xc6,
-  0x40, 0x32, 0xae, 0xa3, 0x02, 0x69, 0x0a, 0xf8, 0x0d, 0x22, 0xe6, 0x47,
-  0x13, 0xfb, 0xfe, 0x14, 0xde, 0xe0, 0x32, 0x07, 0x00, 0xfc, 0xf6, 0xf3,
-  0xee, 0x37, 0x67, 0x08, 0x51, 0x09, 0xd4, 0xe6, 0xcd, 0x81, 0xd1, 0x57,
-  0xfd, 0x1b, 0xc8, 0xef, 0x48, 0xc2, 0x33, 0x09, 0xff, 0xda, 0xf4, 0x25,
-  0x29, 0x08, 0x49, 0x1b, 0xc3, 0x04, 0x18, 0xfb, 0xfc, 0xfd, 0x11, 0xf4,
-  0x45, 0xf5, 0xd0, 0xf3, 0x07, 0xea, 0xda, 0xd4, 0x09, 0x03, 0x34, 0x31,
-  0x09, 0xfc, 0x43, 0x03, 0x3f, 0x41, 0x09, 0xc9, 0x0b, 0xd3, 0x2e, 0xd7,
-  0xdb, 0x1d, 0xe1, 0x27, 0xf1, 0x22, 0x6c, 0xf9, 0x7f, 0xfc, 0x02, 0xc8,
-  0xd5, 0xcb, 0xbf, 0x7a, 0xbb, 0xd6, 0xdd, 0x3f, 0x4a, 0xf9, 0x20, 0xf1,
-  0x05, 0xa7, 0xf4, 0x13, 0x7b, 0xee, 0x4a, 0x15, 0xb8, 0xfe, 0x02, 0xe7,
-  0x0d, 0xe8, 0x3f, 0xf3, 0x1b, 0x50, 0x58, 0xe5, 0xe3, 0x60, 0xcd, 0xab,
-  0x1f, 0x0f, 0x38, 0x32, 0x0f, 0xcf, 0xd5, 0xe1, 0xc8, 0x0d, 0xf3, 0xdb,
-  0xfc, 0xe7, 0xf4, 0xf1, 0xdd, 0xf7, 0xfc, 0x1e, 0x17, 0x27, 0xfa, 0x43,
-  0x10, 0x02, 0x22, 0x7f, 0xd1, 0x27, 0x15, 0xe2, 0xe5, 0x2f, 0x51, 0xe4,
-  0xf6, 0x0d, 0xf2, 0x2f, 0x15, 0xec, 0xc7, 0x2e, 0xf7, 0x12, 0xe5, 0x10,
-  0x23, 0x19, 0xf0, 0xf4, 0x07, 0xce, 0xda, 0xed, 0x0d, 0x1b, 0x23, 0xf1,
-  0xe8, 0x10, 0xfc, 0x07, 0x16, 0x14, 0xd9, 0xe6, 0x1e, 0xd6, 0x9a, 0x3a,
-  0x49, 0xfc, 0x97, 0x12, 0x61, 0xbb, 0xed, 0xea, 0xdc, 0xe7, 0x3b, 0xd8,
-  0xa4, 0x28, 0x32, 0xc0, 0xcf, 0xc1, 0x36, 0xea, 0x31, 0x5e, 0xa6, 0xc8,
-  0xea, 0x34, 0x30, 0xc9, 0xf0, 0xfd, 0xda, 0xf8, 0xf1, 0x4b, 0x39, 0xd9,
-  0x11, 0xe9, 0x42, 0xfe, 0x14, 0x54, 0xd9, 0xd4, 0x59, 0xab, 0xe4, 0xde,
-  0xf7, 0x7f, 0xb4, 0xc3, 0x85, 0x55, 0x4f, 0xec, 0x09, 0x89, 0x00, 0x43,
-  0x32, 0xe8, 0x11, 0xe8, 0xc9, 0x30, 0xcb, 0x0d, 0xde, 0x22, 0x06, 0xe8,
-  0xe1, 0xc7, 0xd6, 0xe2, 0xe3, 0x55, 0x3a, 0x23, 0xf5, 0xbf, 0xca, 0x1a,
-  0x43, 0xaf, 0x1e, 0x7b, 0xa9, 0x06, 0xd7, 0xe7, 0x62, 0xff, 0x3a, 0xc2,
-  0x1f, 0xba, 0xe8, 0xe5, 0x6b, 0xeb, 0x58, 0x59, 0xd1, 0x3d, 0x1a, 0xc1,
-  0x00, 0xf5, 0xf0, 0x33, 0x7f, 0x08, 0x42, 0x1d, 0x19, 0x45, 0xca, 0xed,
-  0xe7, 0xfd, 0xfe, 0x1d, 0x09, 0x0d, 0x2c, 0x2d, 0xe5, 0xfa, 0xfe, 0x0b,
-  0xe2, 0x1b, 0x18, 0x09, 0xf8, 0x23, 0xf3, 0xea, 0x3f, 0x30, 0x3c, 0xe9,
-  0x11, 0xea, 0xce, 0xe3, 0xfb, 0xe7, 0xf5, 0x41, 0xdb, 0xe2, 0xef, 0x02,
-  0x45, 0xdf, 0x27, 0xf1, 0xfa, 0xb0, 0x14, 0x1f, 0x10, 0x34, 0x1b, 0xf8,
-  0xdc, 0x2c, 0xe6, 0xfe, 0x14, 0x17, 0x0b, 0xe9, 0x4a, 0x0b, 0xc6, 0xf3,
-  0x49, 0x11, 0xe6, 0x81, 0x1b, 0x17, 0x3b, 0x4b, 0x16, 0x25, 0xc6, 0x7f,
-  0xb3, 0x30, 0x43, 0xe5, 0xdb, 0x3c, 0x42, 0xf9, 0xd5, 0xfd, 0xe9, 0xf5,
-  0x05, 0xc2, 0x5d, 0xd5, 0xeb, 0x08, 0xd4, 0xf6, 0x07, 0x88, 0x04, 0x4d,
-  0xee, 0xa6, 0xdc, 0x40, 0x2b, 0xfc, 0xea, 0xd5, 0xd9, 0xc7, 0x2e, 0xc1,
-  0x18, 0x17, 0x0a, 0x55, 0x07, 0x07, 0xea, 0x2a, 0xe6, 0xb1, 0xef, 0xe2,
-  0x3d, 0x49, 0xfe, 0xd8, 0xc7, 0x42, 0x12, 0x81, 0xe7, 0xf0, 0x34, 0x20,
-  0x13, 0x3e, 0x3a, 0x2c, 0x0e, 0x28, 0x05, 0xb4, 0xcc, 0xd1, 0xa6, 0xfd,
-  0x03, 0x2d, 0x4b, 0x0d, 0x56, 0xb2, 0x2d, 0xdd, 0x26, 0xb5, 0xb6, 0x08,
-  0xff, 0xde, 0xc0, 0x70, 0xe3, 0x17, 0xf4, 0xf6, 0x4f, 0x0b, 0x33, 0xfd,
-  0xd1, 0x81, 0xf5, 0x00, 0xd0, 0x1f, 0x3f, 0x12, 0x06, 0x32, 0x27, 0xdf,
-  0xb6, 0x27, 0x42, 0x2a, 0x21, 0x09, 0x1d, 0xd4, 0x48, 0xf3, 0x17, 0xc3,
-  0x47, 0x61, 0xe3, 0xfd, 0xde, 0x41, 0x33, 0x3b, 0x19, 0x41, 0xd4, 0xd7,
-  0xf4, 0xf8, 0xbc, 0xd4, 0xe7, 0xdb, 0x14, 0xea, 0x1e, 0x03, 0x44, 0xfb,
-  0x6f, 0xb2, 0x24, 0x01, 0x2a, 0xbc, 0x0e, 0x2e, 0xdd, 0x02, 0xee, 0xf1,
-  0x37, 0xdc, 0x28, 0xd6, 0x37, 0xa1, 0xe5, 0xdb, 0x11, 0x51, 0x51, 0x56,
-  0x0f, 0x28, 0x0d, 0x00, 0xd9, 0x2a, 0x3a, 0xf7, 0xf7, 0x23, 0xe8, 0xff,
-  0x6e, 0x11, 0xfd, 0x81, 0x0f, 0x4f, 0xe3, 0x2a, 0x1b, 0x44, 0xc2, 0x29,
-  0xca, 0xdf, 0xc3, 0x02, 0x10, 0xa0, 0x3a, 0x22, 0x3f, 0xae, 0x47, 0x9c,
-  0xbc, 0x72, 0x5e, 0xd2, 0xc5, 0x25, 0xb3, 0xf4, 0x6e, 0x2b, 0xc5, 0x1b,
-  0xda, 0x74, 0xf1, 0x08, 0xc5, 0xa8, 0xa3, 0xc4, 0x32, 0x1e, 0x4c, 0x04,
-  0x30, 0x13, 0x91, 0x68, 0xe1, 0x05, 0x5f, 0x0c, 0xec, 0xcb, 0x81, 0x4f,
-  0x70, 0xd8, 0xb9, 0x05, 0xf6, 0x40, 0x3a, 0xa0, 0xae, 0xbc, 0x26, 0xd4,
-  0xff, 0x05, 0xef, 0x43, 0x15, 0xdc, 0x34, 0xe6, 0x1c, 0x4e, 0xc7, 0x7f,
-  0x5d, 0xb1, 0xaa, 0xa5, 0xa1, 0x43, 0x25, 0xdf, 0xa7, 0x05, 0x56, 0xfd,
-  0x4b, 0x5a, 0x0f, 0x10, 0x18, 0x10, 0xf2, 0x02, 0x19, 0xb3, 0x0e, 0x08,
-  0x3a, 0x4a, 0xe7, 0xd8, 0x37, 0xf8, 0x16, 0xbb, 0x17, 0xa6, 0xcf, 0xa1,
-  0x72, 0xe1, 0xe6, 0xad, 0xe8, 0x1a, 0x07, 0x37, 0xc1, 0xca, 0x36, 0x25,
-  0xdc, 0xc7, 0x38, 0xf6, 0xfd, 0xba, 0x36, 0xc0, 0x19, 0x33, 0xf9, 0x36,
-  0xe9, 0x31, 0x0f, 0xda, 0x00, 0xf1, 0x3d, 0x63, 0xed, 0xcf, 0xba, 0x22,
-  0x44, 0x3d, 0xcd, 0x7f, 0xdc, 0xc2, 0x46, 0x07, 0x09, 0x2c, 0x30, 0xba,
-  0x25, 0x44, 0x0e, 0xdf, 0x26, 0x1e, 0xdb, 0x3c, 0xf7, 0x12, 0x1c, 0x1c,
-  0x3c, 0xef, 0xea, 0x08, 0xc8, 0x17, 0x05, 0x11, 0x08, 0x10, 0xf0, 0xeb,
-  0x46, 0x10, 0x26, 0x15, 0x54, 0x2c, 0xb6, 0xea, 0x30, 0xa7, 0xdd, 0x30,
-  0xeb, 0xf0, 0xb5, 0x5a, 0x48, 0x03, 0xfb, 0x02, 0x08, 0xc6, 0x1d, 0xd3,
-  0xcd, 0x14, 0x15, 0x22, 0xf5, 0xda, 0xe2, 0x0c, 0x5c, 0x5c, 0x02, 0xfa,
-  0xe0, 0x10, 0xb8, 0xfa, 0xfa, 0xda, 0xcf, 0x23, 0xc8, 0x7f, 0x24, 0xca,
-  0x32, 0xfa, 0x10, 0xb6, 0x32, 0xf7, 0x57, 0x60, 0x52, 0xe1, 0x05, 0x1e,
-  0x3d, 0x2f, 0x16, 0xe7, 0xf5, 0x3d, 0x65, 0x59, 0xbd, 0xf1, 0xf7, 0xc4,
-  0xc2, 0xe3, 0xd5, 0x02, 0x12, 0xeb, 0x30, 0xd8, 0xf1, 0xd6, 0x13, 0xda,
-  0xe5, 0xe2, 0x3a, 0x09, 0x06, 0xaa, 0x76, 0x02, 0xec, 0xe3, 0x40, 0xde,
-  0xfe, 0xc5, 0xec, 0x7f, 0x0d, 0xb4, 0xfd, 0xf1, 0x24, 0xe7, 0x03, 0xe1,
-  0x08, 0xb6, 0xf8, 0x1d, 0xe7, 0xd7, 0x24, 0x24, 0xd8, 0x56, 0x46, 0xd2,
-  0x0a, 0xe2, 0xf7, 0xd0, 0x77, 0xc2, 0x42, 0xd6, 0x04, 0x3c, 0x12, 0xa9,
-  0xd9, 0x5b, 0x4b, 0x17, 0x37, 0xf9, 0xea, 0x51, 0x06, 0x05, 0x47, 0x15,
-  0x0e, 0x40, 0xce, 0xcb, 0x3a, 0x52, 0x23, 0x2f, 0x5d, 0x44, 0x7f, 0xe4,
-  0x72, 0x2f, 0xf3, 0xf4, 0x0a, 0x86, 0xf3, 0x19, 0xff, 0x07, 0xa9, 0x5d,
-  0x74, 0x38, 0xe8, 0xad, 0x00, 0x12, 0xf2, 0x08, 0x6f, 0xd0, 0x56, 0x67,
-  0xb1, 0xd5, 0x63, 0xd1, 0xaf, 0xba, 0x44, 0xca, 0x78, 0xd8, 0xfe, 0xc8,
-  0xdc, 0xc2, 0x0d, 0x8b, 0xf9, 0x2d, 0x36, 0xec, 0xc7, 0x4f, 0xfa, 0xe2,
-  0xf4, 0x35, 0xda, 0xfc, 0xf6, 0x2e, 0xc5, 0x08, 0xb3, 0x2d, 0xd1, 0x30,
-  0x17, 0x10, 0x06, 0x39, 0xfe, 0x26, 0xcb, 0x7f, 0x0d, 0xf4, 0x32, 0xff,
-  0x09, 0x05, 0xea, 0xc6, 0x25, 0xf1, 0x33, 0xf8, 0xe8, 0xcf, 0xd7, 0x11,
-  0x03, 0x42, 0x47, 0x0b, 0xf7, 0xff, 0xca, 0xfd, 0x05, 0x00, 0x13, 0x31,
-  0xe2, 0x9b, 0x3a, 0x0f, 0x3e, 0x1f, 0xf8, 0xf6, 0x73, 0x2e, 0x1d, 0xda,
-  0x22, 0xfd, 0x25, 0x0c, 0x2f, 0x09, 0xe9, 0x18, 0xf3, 0xce, 0xcf, 0x6c,
-  0x0c, 0xf2, 0xe3, 0xc6, 0xc1, 0x1f, 0x02, 0xf4, 0xe2, 0xe3, 0x3a, 0xe3,
-  0x2e, 0xf5, 0xf9, 0xdb, 0xe7, 0x4f, 0x0c, 0x16, 0x04, 0x19, 0xef, 0x16,
-  0x2f, 0x3b, 0xb7, 0xd3, 0xda, 0x1a, 0xe8, 0x00, 0x4c, 0x1a, 0xdd, 0xcb,
-  0x7f, 0xcf, 0xd8, 0xcf, 0x19, 0x3b, 0x05, 0xa0, 0xc5, 0xe4, 0x10, 0x37,
-  0xef, 0x1d, 0x1d, 0xe1, 0x62, 0xcd, 0x2e, 0xbf, 0xb9, 0xfb, 0xda, 0xdc,
-  0x59, 0x31, 0x1b, 0x13, 0xcd, 0x32, 0xcf, 0xea, 0x10, 0xf2, 0x01, 0x15,
-  0xe8, 0x07, 0xf8, 0xbe, 0xc4, 0x7d, 0x18, 0x9a, 0xb6, 0x31, 0xc0, 0xda,
-  0x2a, 0xa6, 0xdf, 0x33, 0xb5, 0x3a, 0xe9, 0x23, 0x21, 0x28, 0x23, 0xde,
-  0xf5, 0x0b, 0xc8, 0xeb, 0x7f, 0xc0, 0xdf, 0xcd, 0x19, 0x43, 0xea, 0x01,
-  0xb5, 0x42, 0x62, 0x07, 0xef, 0xa3, 0xde, 0x1b, 0xeb, 0x11, 0x0f, 0x10,
-  0x12, 0x12, 0x46, 0xc8, 0xc9, 0x46, 0x38, 0x02, 0xe6, 0xc0, 0x27, 0xc5,
-  0x26, 0xe9, 0x4b, 0xca, 0x25, 0xea, 0x56, 0xe9, 0xeb, 0xe9, 0xb2, 0x7f,
-  0xe8, 0x9c, 0x30, 0xdf, 0x44, 0xc3, 0xf1, 0x11, 0x19, 0x8f, 0x34, 0xd6,
-  0x4d, 0xe7, 0x2f, 0x3f, 0xf6, 0x49, 0x0a, 0xf2, 0xec, 0xc2, 0x20, 0xf4,
-  0x0e, 0x2d, 0xee, 0x11, 0x33, 0x45, 0x11, 0xb5, 0x01, 0x41, 0x49, 0x46,
-  0x0f, 0xd0, 0xed, 0x32, 0x22, 0x47, 0x42, 0xfa, 0xe8, 0x3c, 0xf1, 0x0c,
-  0xd9, 0x13, 0x08, 0xf9, 0xe4, 0x89, 0x72, 0x2a, 0x7f, 0x1f, 0xa0, 0xdc,
-  0x54, 0x8c, 0xb4, 0x78, 0xb9, 0xaf, 0x87, 0x30, 0x6f, 0xad, 0xf6, 0x01,
-  0xee, 0x87, 0x51, 0x16, 0xec, 0xf4, 0x35, 0x71, 0xcd, 0x5e, 0x34, 0xec,
-  0xff, 0xbc, 0xfb, 0xb3, 0x02, 0x08, 0x05, 0xc0, 0x3d, 0x53, 0xd7, 0xc1,
-  0x12, 0x7f, 0xfb, 0x2d, 0x15, 0x52, 0x96, 0x7f, 0xc9, 0x4d, 0xdb, 0x93,
-  0xc9, 0x92, 0x32, 0xdc, 0xe3, 0x0b, 0xe4, 0x9d, 0xf7, 0x26, 0x73, 0xb9,
-  0xfd, 0xc2, 0xd2, 0x11, 0xf9, 0xe8, 0x0c, 0xe5, 0xb9, 0xf7, 0x18, 0x53,
-  0x3d, 0xe7, 0xca, 0x02, 0x35, 0x85, 0xb7, 0xa6, 0x7e, 0xe0, 0x05, 0x59,
-  0x19, 0xa2, 0xfd, 0x4d, 0x58, 0xf3, 0x51, 0x50, 0x10, 0x30, 0xd8, 0x2a,
-  0x9a, 0x20, 0x24, 0xb5, 0xbd, 0x15, 0x7d, 0xfe, 0x29, 0xc4, 0xf7, 0xa6,
-  0x15, 0xc2, 0x4e, 0xd3, 0x5b, 0x41, 0x08, 0x7f, 0x10, 0xc9, 0x05, 0xc8,
-  0xea, 0xd1, 0x10, 0xee, 0xa6, 0xd2, 0xf2, 0xe8, 0x50, 0xf9, 0xdc, 0xf0,
-  0xef, 0xcf, 0xdb, 0x09, 0x0a, 0xba, 0x1a, 0x35, 0x10, 0xe5, 0x18, 0xf5,
-  0xda, 0x47, 0x46, 0xd4, 0x4d, 0x9a, 0xe7, 0xe4, 0x48, 0xe8, 0xfd, 0xe8,
-  0x1b, 0xe0, 0x0b, 0xd0, 0xda, 0xc0, 0x54, 0x40, 0xcd, 0x95, 0x04, 0x30,
-  0xf8, 0xe6, 0x38, 0x62, 0x11, 0x23, 0xea, 0x19, 0x16, 0x17, 0xdd, 0xdd,
-  0xbd, 0xca, 0x33, 0x02, 0xec, 0x0b, 0x45, 0xfd, 0x4e, 0xc1, 0x24, 0xea,
-  0x15, 0xcb, 0xcb, 0x48, 0xde, 0xd9, 0xf7, 0x50, 0x3d, 0x22, 0x48, 0xcb,
-  0x24, 0xc5, 0x22, 0xe8, 0x4a, 0x16, 0x49, 0x5f, 0x13, 0x08, 0x0c, 0x2e,
-  0xd5, 0xd0, 0x32, 0x3e, 0xee, 0x3a, 0xb0, 0xee, 0x0d, 0x40, 0xe9, 0x81,
-  0x2a, 0xf6, 0x28, 0x05, 0xf0, 0x04, 0x04, 0x20, 0xed, 0x21, 0xfc, 0x11,
-  0xf2, 0x05, 0x18, 0xf1, 0x2b, 0x0b, 0x33, 0x29, 0x00, 0x1d, 0xf9, 0x25,
-  0x31, 0x5a, 0xe7, 0x7f, 0xee, 0x0d, 0x28, 0xcf, 0xff, 0xf6, 0x0f, 0xf7,
-  0xea, 0x33, 0xee, 0x29, 0xcb, 0x27, 0x17, 0x21, 0x0b, 0x2f, 0x05, 0x20,
-  0x1a, 0xf5, 0xe6, 0x13, 0xfc, 0xe0, 0xe1, 0xcf, 0x1a, 0xe9, 0x25, 0x15,
-  0x0a, 0xde, 0x19, 0x37, 0x23, 0x1b, 0xf3, 0x03, 0x24, 0x18, 0xff, 0x36,
-  0xd5, 0xf4, 0xd6, 0xc5, 0xaf, 0x27, 0x1a, 0x10, 0xbf, 0x15, 0x33, 0xda,
-  0xe6, 0xa6, 0x6f, 0xea, 0x10, 0xe1, 0xb6, 0xdd, 0x15, 0xb8, 0x21, 0x48,
-  0xcd, 0xf9, 0xfb, 0x32, 0x36, 0x0d, 0x45, 0xe9, 0x30, 0x94, 0xaa, 0xfd,
-  0x2f, 0xe7, 0x4e, 0xfb, 0xeb, 0x0a, 0x12, 0xd6, 0xff, 0x22, 0x4e, 0xbc,
-  0x5e, 0x06, 0x29, 0x14, 0x6a, 0x00, 0xfd, 0x81, 0xe5, 0x44, 0x32, 0x3d,
-  0x20, 0x04, 0x04, 0x28, 0x0c, 0x36, 0x2a, 0xb4, 0x1b, 0xd2, 0x17, 0xd7,
-  0x2c, 0xc8, 0x01, 0xe7, 0x63, 0xb2, 0x2f, 0xdc, 0x3d, 0xfb, 0xbe, 0xde,
-  0x16, 0x91, 0xdf, 0x03, 0xce, 0xdb, 0xd7, 0x3f, 0x3d, 0x28, 0x1d, 0xda,
-  0xec, 0x06, 0x18, 0xce, 0xe7, 0x20, 0x2e, 0x09, 0x0e, 0x08, 0xdd, 0x47,
-  0xc3, 0xc4, 0x04, 0x05, 0x08, 0x26, 0x03, 0xcf, 0x17, 0x0b, 0x22, 0x81,
-  0x32, 0x45, 0x3a, 0x3e, 0xfc, 0xfe, 0x28, 0x61, 0x0f, 0x09, 0x07, 0xcf,
-  0xcd, 0x14, 0x1c, 0x15, 0xc2, 0x1e, 0x24, 0xd0, 0x22, 0xc8, 0x60, 0xf6,
-  0x35, 0xd9, 0xd6, 0x03, 0xd0, 0xef, 0xca, 0xfd, 0xf3, 0xda, 0xef, 0x29,
-  0x23, 0xec, 0x38, 0x03, 0xfc, 0x96, 0x21, 0x15, 0x45, 0x1c, 0x46, 0x56,
-  0xc5, 0xf2, 0xfc, 0x05, 0x14, 0xca, 0x2a, 0xc4, 0xf7, 0xcf, 0x01, 0x13,
-  0x09, 0x3e, 0xf4, 0x81, 0xf1, 0x11, 0xca, 0x0f, 0xf0, 0xaf, 0x04, 0x18,
-  0x0d, 0xd6, 0xd2, 0xed, 0x41, 0x34, 0xe9, 0x54, 0x3c, 0x29, 0xe3, 0xb7,
-  0x26, 0x19, 0xe5, 0xef, 0xa7, 0xe0, 0xdd, 0xd1, 0x53, 0x6a, 0x09, 0x81,
-  0x23, 0x55, 0x24, 0x4c, 0x42, 0xbb, 0xdc, 0xe1, 0xe2, 0x7e, 0xf2, 0x0a,
-  0x2f, 0x46, 0xf1, 0xfa, 0xf1, 0x3a, 0x44, 0xe6, 0x36, 0x03, 0xc3, 0xb7,
-  0x3b, 0x4e, 0xd4, 0x3a, 0xd7, 0x2c, 0x42, 0xe3, 0xfa, 0xbc, 0x09, 0x28,
-  0x08, 0xed, 0x0d, 0x57, 0x4c, 0x6e, 0x00, 0x28, 0xee, 0xf3, 0x23, 0xfd,
-  0xf8, 0xca, 0x4b, 0xec, 0x66, 0xf9, 0x4a, 0x1b, 0x23, 0x0d, 0x04, 0xd1,
-  0xd5, 0x9e, 0xc2, 0x7f, 0xea, 0x20, 0xa5, 0x22, 0x39, 0xee, 0x46, 0x11,
-  0xdb, 0x99, 0xf8, 0xef, 0xd1, 0x55, 0x37, 0x7b, 0xc3, 0xd5, 0x42, 0x32,
-  0x0b, 0x17, 0x59, 0x16, 0x5f, 0xa6, 0xce, 0xb5, 0x12, 0xf6, 0xba, 0xa3,
-  0x6c, 0x03, 0x39, 0x1c, 0x1c, 0xa2, 0xe8, 0xba, 0x25, 0xf1, 0x3c, 0xbc,
-  0x49, 0xd2, 0x28, 0x4a, 0x2d, 0xff, 0x46, 0x2b, 0x20, 0x01, 0xfc, 0x2c,
-  0xe7, 0x37, 0x0e, 0x7f, 0xce, 0x25, 0x15, 0xcb, 0x07, 0x32, 0x2f, 0xee,
-  0xd2, 0x06, 0x26, 0x18, 0x43, 0xfc, 0xaa, 0x3a, 0x23, 0x39, 0xca, 0x1b,
-  0x48, 0xa8, 0xb4, 0xa5, 0xcf, 0xc3, 0xdb, 0xbe, 0xdf, 0xf7, 0xf6, 0xce,
-  0x1b, 0xcd, 0x36, 0xfc, 0x21, 0xe9, 0x18, 0x27, 0xe5, 0x0e, 0xde, 0x50,
-  0x4a, 0x32, 0x03, 0x12, 0xcb, 0xad, 0xbf, 0xca, 0x2e, 0x21, 0x34, 0xfa,
-  0x67, 0xc9, 0x28, 0x09, 0x1a, 0xdb, 0xc3, 0xcc, 0x14, 0xe8, 0xfe, 0x7d,
-  0xca, 0x1e, 0x0f, 0xee, 0x6f, 0xb9, 0x10, 0xe8, 0x17, 0xcd, 0x11, 0x07,
-  0xff, 0x40, 0x14, 0x7f, 0x0c, 0x22, 0xfa, 0x2f, 0xff, 0xf8, 0x1d, 0xb6,
-  0x1c, 0xf9, 0xe8, 0xf0, 0x63, 0x3e, 0xe8, 0xf0, 0x2e, 0x2b, 0xfd, 0x06,
-  0xe1, 0x50, 0x0b, 0xf3, 0x14, 0x1d, 0x9e, 0x32, 0x09, 0xb1, 0x0e, 0x7f,
-  0xe3, 0xeb, 0xdc, 0xe8, 0x20, 0x09, 0x17, 0x02, 0x97, 0x0d, 0x2b, 0xbc,
-  0x14, 0x38, 0xca, 0xaf, 0x38, 0x28, 0xf1, 0xb8, 0xd9, 0xcd, 0xd6, 0xcc,
-  0x05, 0x7c, 0xdc, 0x01, 0xcb, 0xf8, 0x1f, 0xad, 0x2e, 0xe3, 0x39, 0x11,
-  0x14, 0x0f, 0x24, 0x1a, 0xeb, 0xf0, 0x56, 0xd3, 0xe3, 0x13, 0x30, 0xe9,
-  0xff, 0x1f, 0x50, 0xf4, 0xe0, 0x36, 0x49, 0x7f, 0xfe, 0x57, 0x28, 0xdc,
-  0x00, 0xbf, 0x50, 0xdc, 0x43, 0xbd, 0xe1, 0xc0, 0xdb, 0x16, 0x2a, 0xec,
-  0x01, 0xb9, 0x2e, 0x07, 0xe8, 0x18, 0x21, 0x78, 0xe8, 0xbd, 0xca, 0x4b,
-  0x26, 0x11, 0x2b, 0xd7, 0xcf, 0xa1, 0xdb, 0xf5, 0x29, 0x2c, 0xfa, 0x69,
-  0xf2, 0x1d, 0x03, 0x45, 0x1a, 0xd7, 0x35, 0x12, 0x34, 0x2d, 0x1b, 0xfd,
-  0x41, 0x38, 0xff, 0xb3, 0xbe, 0xfa, 0x55, 0x24, 0xaf, 0x37, 0xe3, 0x0d,
-  0x0e, 0xeb, 0xd2, 0xe5, 0x0c, 0x59, 0xfa, 0x18, 0xd0, 0x44, 0xd8, 0x2e,
-  0x26, 0x09, 0xfd, 0x33, 0x37, 0x7f, 0x1e, 0x6e, 0xde, 0x36, 0x07, 0x1a,
-  0xc5, 0x3d, 0x6e, 0xca, 0xe5, 0x17, 0x08, 0x5d, 0xbc, 0x2c, 0xaf, 0x26,
-  0x3b, 0x3d, 0xe0, 0xf3, 0x59, 0xc3, 0x1b, 0xc3, 0x04, 0xc4, 0xe6, 0x1b,
-  0xde, 0xc9, 0x51, 0x35, 0x29, 0xb1, 0x33, 0xf8, 0xfd, 0x2d, 0xf5, 0x08,
-  0xea, 0xe8, 0x1d, 0x5c, 0xf6, 0x0a, 0x0d, 0xee, 0xf2, 0xe5, 0x12, 0x14,
-  0x1b, 0x09, 0x2c, 0xfb, 0x09, 0x28, 0x61, 0xf0, 0x2b, 0xf7, 0xe5, 0xd6,
-  0x01, 0xe0, 0xf2, 0x61, 0xda, 0x11, 0x18, 0x23, 0x19, 0xf8, 0x33, 0xc5,
-  0x2a, 0xdc, 0xf7, 0xe8, 0xf9, 0x0c, 0x27, 0x06, 0xf1, 0x15, 0xfd, 0xfa,
-  0xfb, 0xf8, 0x03, 0x2d, 0xfd, 0x16, 0xd7, 0xf7, 0x23, 0x07, 0xea, 0x81,
-  0x20, 0x4b, 0xef, 0x27, 0xbb, 0xc8, 0xde, 0x7f, 0x30, 0xf7, 0x15, 0xe0,
-  0xe8, 0x0a, 0x40, 0x12, 0xce, 0xe1, 0xed, 0xe1, 0x3f, 0x14, 0x3e, 0xee,
-  0xd3, 0xdf, 0xde, 0x0b, 0xef, 0xe5, 0x2d, 0x0f, 0xef, 0xc5, 0x0a, 0x1f,
-  0x42, 0xe2, 0x1e, 0xf6, 0xc1, 0xaf, 0x1d, 0xd0, 0xfe, 0xe9, 0xeb, 0x34,
-  0xe5, 0x08, 0xec, 0x21, 0xff, 0xe1, 0x45, 0x41, 0x68, 0x02, 0xf2, 0xe2,
-  0xd8, 0x57, 0x11, 0xf1, 0xfd, 0x56, 0xe7, 0x4c, 0xa6, 0x43, 0x1a, 0xe7,
-  0x0f, 0x63, 0xec, 0x24, 0xc4, 0x02, 0xb5, 0x0a, 0xf8, 0xd2, 0x15, 0x02,
-  0x14, 0x00, 0x1a, 0x0b, 0x32, 0xdb, 0x17, 0xeb, 0xcd, 0xff, 0x20, 0x71,
-  0x0b, 0xc8, 0x1b, 0x1d, 0x65, 0xd1, 0x25, 0xf1, 0x01, 0x8c, 0x03, 0xde,
-  0x1f, 0x47, 0x4f, 0x7d, 0xb7, 0xe4, 0x16, 0x0b, 0xf5, 0x1d, 0x25, 0xc8,
-  0x2f, 0xb9, 0x28, 0xe7, 0x7c, 0x10, 0x1a, 0x81, 0x3e, 0x4c, 0x3d, 0x09,
-  0xd2, 0xf7, 0xca, 0xd4, 0xd7, 0xf5, 0xf0, 0xe3, 0x43, 0xfb, 0xfe, 0xd8,
-  0x34, 0xe6, 0x47, 0x4e, 0x49, 0xf7, 0x05, 0x38, 0xfd, 0x3b, 0x2f, 0x7f,
-  0xd7, 0xf0, 0xfe, 0x22, 0x29, 0xef, 0x37, 0x44, 0xf6, 0x26, 0xe0, 0x31,
-  0xea, 0x2d, 0x12, 0x4c, 0x1f, 0x34, 0x1b, 0x1a, 0x37, 0xc5, 0xd7, 0xd5,
-  0xf7, 0x05, 0xe2, 0x29, 0xea, 0x12, 0xe4, 0x2d, 0xf0, 0x0c, 0xf9, 0x15,
-  0x1e, 0x01, 0xd7, 0x0d, 0x02, 0x36, 0x04, 0x2a, 0x18, 0x22, 0x10, 0xeb,
-  0x16, 0xec, 0xd2, 0xf2, 0xbf, 0xed, 0x2f, 0xbb, 0x21, 0xc3, 0x54, 0xe6,
-  0x3f, 0xcc, 0x02, 0x0a, 0x25, 0xa8, 0x27, 0x07, 0xce, 0x20, 0x2b, 0x10,
-  0x51, 0x0d, 0xf3, 0xcc, 0xc8, 0xd0, 0xe4, 0xce, 0x4b, 0xf4, 0x4b, 0x6b,
-  0xc7, 0x00, 0x16, 0xe8, 0xe0, 0x1f, 0xed, 0x04, 0x21, 0xf2, 0x2a, 0xdf,
-  0x33, 0x24, 0xdd, 0x81, 0xd3, 0x53, 0xfa, 0xdf, 0x22, 0x9d, 0x46, 0xba,
-  0x42, 0x10, 0xcb, 0xb7, 0x65, 0xff, 0x21, 0x40, 0x31, 0xda, 0xe0, 0x0b,
-  0xaf, 0xdd, 0xfe, 0x69, 0xfd, 0x11, 0x44, 0x3c, 0x46, 0x42, 0x44, 0x31,
-  0xeb, 0x3e, 0x6f, 0x0e, 0xc3, 0xbd, 0xe6, 0x64, 0x4d, 0xcb, 0x98, 0x7f,
-  0x46, 0xf0, 0x2f, 0x0c, 0x6f, 0xcc, 0x31, 0xd6, 0x01, 0x23, 0xd3, 0xb5,
-  0xe9, 0x3d, 0x41, 0x26, 0x33, 0xbc, 0xfd, 0x19, 0x1c, 0x13, 0x1a, 0x47,
-  0xfe, 0xd7, 0x07, 0xfc, 0x0d, 0x11, 0x08, 0x22, 0xf8, 0xd1, 0xfc, 0xf7,
-  0x26, 0xc5, 0xcc, 0xff, 0xf8, 0x05, 0xfa, 0x19, 0x09, 0x2c, 0x0f, 0x7f,
-  0xfc, 0xf2, 0xed, 0x10, 0x05, 0xf3, 0x2b, 0x20, 0xf6, 0x3e, 0xfe, 0x30,
-  0x0a, 0x15, 0x21, 0x15, 0xfe, 0xe5, 0x04, 0x08, 0x08, 0x13, 0xdc, 0xed,
-  0x1f, 0xe9, 0xdb, 0x04, 0x19, 0x1e, 0x11, 0xf0, 0xf9, 0xf8, 0xf0, 0x2f,
-  0x14, 0x1a, 0xfc, 0xeb, 0x1e, 0x17, 0x4d, 0x23, 0x4a, 0x25, 0xff, 0x3a,
-  0x71, 0xac, 0xc5, 0xe0, 0xf0, 0x81, 0x07, 0xa7, 0x22, 0xd5, 0xdd, 0xfd,
-  0xbd, 0xa7, 0x1f, 0x59, 0x40, 0x4f, 0xaa, 0xd6, 0xdc, 0xf2, 0xfd, 0xe4,
-  0x0d, 0xd0, 0xf1, 0xfe, 0x60, 0x5c, 0x16, 0xbf, 0x11, 0xfc, 0xf5, 0x1e,
-  0xdf, 0x2a, 0xc4, 0x99, 0x33, 0xab, 0x15, 0x15, 0x35, 0x43, 0x09, 0xb2,
-  0xf3, 0xf8, 0x4c, 0x30, 0x0d, 0x8f, 0xec, 0xff, 0x3e, 0xf9, 0x2f, 0xb5,
-  0x12, 0x26, 0xc2, 0x1a, 0x2f, 0xc1, 0x2d, 0xd9, 0x19, 0xef, 0x05, 0x37,
-  0x55, 0x2b, 0xde, 0x18, 0x33, 0x7f, 0x09, 0x57, 0xdb, 0x32, 0xf8, 0xc5,
-  0x38, 0xef, 0x1b, 0x0b, 0xc7, 0x40, 0x0f, 0x16, 0xab, 0xf6, 0x3c, 0x6f,
-  0xf4, 0xf2, 0xe8, 0x0e, 0x6f, 0xfd, 0xcf, 0x31, 0x11, 0xca, 0xe7, 0x00,
-  0x30, 0x25, 0xed, 0x32, 0x1f, 0x19, 0xc8, 0x13, 0x43, 0xfb, 0xfb, 0x0e,
-  0xd3, 0xc3, 0x40, 0x0e, 0xf6, 0x63, 0xe9, 0xdb, 0xb8, 0x2a, 0xb5, 0xe1,
-  0x0d, 0x32, 0x38, 0x2c, 0xef, 0x4a, 0x2a, 0xf6, 0xf4, 0xdb, 0xe3, 0xef,
-  0xe7, 0x92, 0x15, 0x5b, 0x03, 0x08, 0xf7, 0x1b, 0x56, 0x41, 0x15, 0xf8,
-  0x09, 0x83, 0xf6, 0xdf, 0x54, 0x2d, 0x21, 0x09, 0xce, 0x41, 0x0d, 0xed,
-  0xeb, 0x28, 0x38, 0xf4, 0x56, 0x1c, 0x05, 0xd8, 0x46, 0x06, 0x2e, 0x81,
-  0x44, 0x39, 0xf1, 0x2d, 0xfa, 0x20, 0xe5, 0x16, 0x23, 0x14, 0x11, 0x07,
-  0xec, 0xe0, 0x10, 0xfa, 0xfe, 0xf0, 0x28, 0x1a, 0x05, 0xe0, 0xf1, 0x0c,
-  0x29, 0x36, 0xee, 0x7f, 0xf1, 0x16, 0xe1, 0x07, 0x1b, 0xec, 0x0b, 0xfa,
-  0xee, 0x2b, 0x07, 0x0e, 0xf1, 0x04, 0x22, 0x45, 0x15, 0x0f, 0x00, 0x08,
-  0x1c, 0x11, 0x20, 0xe1, 0xfb, 0xf4, 0xee, 0xd0, 0x0f, 0x19, 0xe9, 0x0f,
-  0x1e, 0xbd, 0x03, 0x3b, 0x2a, 0xf7, 0xd8, 0xd5, 0x2b, 0x44, 0xc2, 0x25,
-  0xd0, 0xe1, 0xcb, 0xf7, 0x04, 0x27, 0xd5, 0x1f, 0x23, 0xd4, 0xf9, 0x46,
-  0xe6, 0x3d, 0xf7, 0x6a, 0x4a, 0x7f, 0xef, 0x7c, 0xb8, 0x28, 0x17, 0xf1,
-  0x0b, 0xdd, 0xe0, 0xe2, 0xd3, 0xb5, 0x34, 0x32, 0x26, 0xcc, 0xd1, 0x5a,
-  0x2d, 0x61, 0xe8, 0x17, 0x4d, 0x2b, 0xc6, 0xf4, 0xd7, 0x27, 0xd5, 0xcf,
-  0xeb, 0xda, 0x51, 0x41, 0x05, 0xdf, 0x0c, 0x58, 0x2b, 0xfc, 0x25, 0x3c,
-  0x7f, 0xd2, 0xc9, 0xe5, 0x0c, 0x27, 0xbd, 0xbd, 0xd4, 0xb3, 0xdd, 0x32,
-  0xb4, 0x49, 0x0c, 0x00, 0xbb, 0xde, 0x06, 0x1f, 0x8c, 0x0e, 0x06, 0xe0,
-  0x68, 0x77, 0x27, 0xf5, 0xd5, 0x02, 0xcd, 0x45, 0x05, 0xa4, 0xb2, 0xf1,
-  0x3b, 0x73, 0x40, 0xbe, 0x0d, 0x27, 0x40, 0xbc, 0x5b, 0x45, 0x12, 0x01,
-  0x45, 0xc5, 0xec, 0xa2, 0x2c, 0x13, 0xd5, 0x17, 0xaf, 0xf0, 0x7c, 0xe8,
-  0xdb, 0x14, 0x22, 0xf0, 0x36, 0xf1, 0x1d, 0x33, 0x06, 0x19, 0xd9, 0x24,
-  0x1d, 0xcf, 0xf4, 0xd0, 0x05, 0xff, 0xf4, 0x4e, 0x38, 0x0e, 0xdd, 0x48,
-  0x23, 0x40, 0x17, 0x7f, 0x03, 0x1f, 0x23, 0xdc, 0x0b, 0x05, 0x16, 0xd3,
-  0x0a, 0x29, 0xeb, 0x38, 0xc7, 0xf0, 0xe8, 0x54, 0x2a, 0x29, 0x0a, 0xe9,
-  0xfc, 0xdb, 0x19, 0x00, 0x05, 0xfe, 0xdf, 0xe3, 0x2f, 0x28, 0x16, 0x08,
-  0x0c, 0xd6, 0xf9, 0x37, 0x0a, 0xf4, 0xef, 0x01, 0x36, 0x33, 0xdf, 0xdc,
-  0xf0, 0x14, 0xc3, 0x59, 0xfc, 0x9b, 0xf4, 0x27, 0x10, 0xe4, 0xc3, 0xc9,
-  0xaf, 0xb0, 0x0e, 0x04, 0xb6, 0xa9, 0xd7, 0xfd, 0x73, 0x6a, 0x8f, 0xb7,
-  0x0c, 0x3f, 0xfd, 0xa2, 0x1a, 0xef, 0xb6, 0xfc, 0xed, 0x2d, 0x17, 0x24,
-  0x26, 0xf6, 0x4d, 0xe1, 0x16, 0xb4, 0x7f, 0x1f, 0x29, 0xc0, 0xb7, 0xbd,
-  0x07, 0x69, 0x4b, 0xe9, 0xb4, 0x28, 0xd1, 0x47, 0xd6, 0x85, 0x29, 0xc0,
-  0xb2, 0x02, 0x0e, 0x0a, 0xe6, 0x4d, 0x23, 0xd6, 0xe6, 0xc7, 0x35, 0xc1,
-  0xb0, 0x0f, 0xd7, 0xf3, 0x51, 0x28, 0x7f, 0x13, 0x60, 0xdd, 0xc5, 0x08,
-  0xba, 0x9c, 0xe0, 0x68, 0xee, 0xc0, 0x9d, 0x2d, 0x11, 0xd0, 0x13, 0xb1,
-  0x31, 0x1d, 0x26, 0xee, 0x20, 0x18, 0x4f, 0x2f, 0xf7, 0x2e, 0x54, 0xc6,
-  0xf0, 0xfd, 0x43, 0x21, 0x5f, 0xff, 0xde, 0xc8, 0x23, 0x51, 0xf1, 0x9d,
-  0x33, 0x01, 0x25, 0xff, 0x19, 0xf2, 0xb8, 0xcc, 0xf3, 0xdb, 0xe0, 0xca,
-  0x43, 0xe2, 0x40, 0x28, 0x09, 0xf6, 0x54, 0x54, 0xe3, 0xef, 0x03, 0x68,
-  0x45, 0x7f, 0xfb, 0x4e, 0xdb, 0x02, 0x4f, 0xda, 0x32, 0xb4, 0x0c, 0xc6,
-  0xe3, 0x02, 0x0f, 0x0d, 0xb4, 0x23, 0xf7, 0x1c, 0x20, 0x1b, 0x0c, 0x07,
-  0x2c, 0x15, 0x2c, 0x45, 0xf2, 0xc7, 0x12, 0x2a, 0xf8, 0xb4, 0x4b, 0x30,
-  0x1b, 0x11, 0x70, 0x45, 0x1d, 0xec, 0x41, 0xd3, 0x32, 0xfd, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x71, 0xfc, 0xff, 0xff,
-  0x0a, 0xf9, 0xff, 0xff, 0x46, 0xfe, 0xff, 0xff, 0x3c, 0x05, 0x00, 0x00,
-  0x90, 0xf8, 0xff, 0xff, 0xbb, 0xfc, 0xff, 0xff, 0xeb, 0xfa, 0xff, 0xff,
-  0x4f, 0xfb, 0xff, 0xff, 0x6b, 0xfc, 0xff, 0xff, 0xc2, 0xfb, 0xff, 0xff,
-  0xc6, 0xfa, 0xff, 0xff, 0x57, 0xfa, 0xff, 0xff, 0x9d, 0xfe, 0xff, 0xff,
-  0x10, 0xff, 0xff, 0xff, 0xf2, 0xfa, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff,
-  0x67, 0x03, 0x00, 0x00, 0x1d, 0xfc, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
-  0x7e, 0x01, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x36, 0xfe, 0xff, 0xff,
-  0xdb, 0x02, 0x00, 0x00, 0xe4, 0xfe, 0xff, 0xff, 0xea, 0xfb, 0xff, 0xff,
-  0x63, 0xf9, 0xff, 0xff, 0xce, 0xfe, 0xff, 0xff, 0xc7, 0xf5, 0xff, 0xff,
-  0xc4, 0xfe, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x73, 0x01, 0x00, 0x00,
-  0x87, 0xf9, 0xff, 0xff, 0x31, 0xfb, 0xff, 0xff, 0x45, 0x03, 0x00, 0x00,
-  0x6c, 0x05, 0x00, 0x00, 0x4b, 0xfa, 0xff, 0xff, 0x2c, 0xf8, 0xff, 0xff,
-  0xc5, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff,
-  0xbf, 0xfc, 0xff, 0xff, 0x6a, 0xfc, 0xff, 0xff, 0x6a, 0xff, 0xff, 0xff,
-  0xe7, 0xf8, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0xa5, 0xf8, 0xff, 0xff,
-  0x96, 0xf7, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xff, 0xb5, 0xfd, 0xff, 0xff,
-  0x82, 0xfb, 0xff, 0xff, 0xc3, 0xf9, 0xff, 0xff, 0xce, 0xfe, 0xff, 0xff,
-  0x06, 0xf8, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff,
-  0x5a, 0xf9, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0x24, 0xfb, 0xff, 0xff,
-  0x97, 0xf8, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x5e, 0xf9, 0xff, 0xff,
-  0xfa, 0x03, 0x00, 0x00, 0xf3, 0xfa, 0xff, 0xff, 0x58, 0xf8, 0xff, 0xff,
-  0x3e, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-  0xdb, 0x20, 0xe7, 0xef, 0x38, 0x98, 0xd1, 0x29, 0x96, 0xdb, 0x8e, 0x0e,
-  0x92, 0xda, 0xb5, 0xef, 0x49, 0x92, 0xa2, 0xe6, 0x97, 0x8e, 0x39, 0x38,
-  0xe5, 0x44, 0xe5, 0x9d, 0x9a, 0x4f, 0x39, 0xdf, 0xa5, 0x19, 0x41, 0x8b,
-  0xb9, 0xe0, 0xde, 0xc8, 0x4e, 0xf0, 0x1c, 0xde, 0x45, 0x01, 0xe7, 0xd8,
-  0xf5, 0xf5, 0xf2, 0xd7, 0x1c, 0x08, 0x22, 0xde, 0xb6, 0xc8, 0xd7, 0x2d,
-  0xb4, 0xff, 0xb3, 0x2d, 0x6c, 0x42, 0x24, 0xb9, 0x36, 0x3e, 0x7c, 0xe3,
-  0xff, 0xe3, 0x16, 0x73, 0x8f, 0xd7, 0xba, 0x6d, 0xa9, 0xad, 0xa7, 0x88,
-  0xd9, 0xc1, 0xb6, 0xf6, 0x6c, 0xc9, 0xab, 0xa2, 0x3e, 0xa7, 0xaf, 0xa5,
-  0xbf, 0xb8, 0xe3, 0xad, 0x33, 0xd7, 0xba, 0xa7, 0xe3, 0x05, 0x69, 0x13,
-  0x00, 0xb9, 0x42, 0xd8, 0xc7, 0x2e, 0x7f, 0xac, 0x4c, 0x6b, 0x1d, 0x7f,
-  0xf7, 0x4a, 0x74, 0xfb, 0x68, 0xa9, 0xcb, 0x5d, 0xe5, 0xd7, 0x6a, 0xd3,
-  0xdc, 0xf2, 0xc8, 0x0f, 0x3f, 0x66, 0xf3, 0x26, 0x11, 0x47, 0x29, 0xca,
-  0x08, 0x4e, 0x14, 0x34, 0x18, 0x07, 0x2c, 0x14, 0x22, 0xe1, 0x48, 0x66,
-  0x1b, 0xbc, 0xd9, 0x48, 0x3e, 0x49, 0xf3, 0x21, 0xbc, 0x5d, 0x68, 0x3f,
-  0x20, 0x6a, 0xbf, 0x5f, 0x0b, 0x68, 0xae, 0x23, 0x3b, 0x62, 0xcc, 0x6e,
-  0xec, 0xfe, 0xfc, 0xba, 0x3a, 0xdd, 0xc3, 0xf9, 0xb1, 0xd7, 0x70, 0xf9,
-  0x0a, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x91, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00,
-  0x22, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x84, 0xa8, 0xff, 0xff, 0x88, 0xa8, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
-  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
-  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00,
-  0xfc, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00,
-  0x5c, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
-  0x58, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
-  0x9c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xe6, 0xfc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-  0x1e, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x68, 0xa9, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0xf6, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x72, 0xfd, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-  0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc2, 0xfd, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x06, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x4a, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf0, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x8e, 0xfe, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe2, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0xd2, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x16, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x6a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
-  0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0x80, 0x53, 0x00, 0x00, 0x14, 0x53, 0x00, 0x00,
-  0xa8, 0x52, 0x00, 0x00, 0x38, 0x52, 0x00, 0x00, 0xd4, 0x51, 0x00, 0x00,
-  0x00, 0x4e, 0x00, 0x00, 0x9c, 0x4a, 0x00, 0x00, 0x90, 0x46, 0x00, 0x00,
-  0x74, 0x42, 0x00, 0x00, 0x88, 0x3e, 0x00, 0x00, 0x24, 0x3b, 0x00, 0x00,
-  0x18, 0x37, 0x00, 0x00, 0x10, 0x33, 0x00, 0x00, 0x20, 0x2f, 0x00, 0x00,
-  0xbc, 0x2b, 0x00, 0x00, 0xb0, 0x27, 0x00, 0x00, 0xa8, 0x23, 0x00, 0x00,
-  0xb8, 0x1f, 0x00, 0x00, 0x54, 0x1c, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00,
-  0x48, 0x14, 0x00, 0x00, 0x68, 0x10, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00,
-  0x78, 0x0c, 0x00, 0x00, 0x64, 0x0b, 0x00, 0x00, 0x28, 0x0a, 0x00, 0x00,
-  0x0c, 0x09, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00, 0xb4, 0x06, 0x00, 0x00,
-  0x78, 0x05, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00,
-  0x1c, 0x02, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2a, 0xad, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x14, 0xad, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b,
-  0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
-  0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
-  0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa2, 0xad, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x8c, 0xad, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xec, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xbe, 0x93, 0xc6, 0x3d, 0x26, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74, 0x4d,
-  0x75, 0x6c, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x6e,
-  0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x2a, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x14, 0xae, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x1e, 0xe5, 0x25, 0x3e, 0x1a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x74, 0x66, 0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xa2, 0xae, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x94, 0xae, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1e, 0xe5, 0x25, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x61, 0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x70, 0x6f,
-  0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x32, 0x64, 0x2f, 0x41, 0x76, 0x67, 0x50,
-  0x6f, 0x6f, 0x6c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x32, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x24, 0xaf, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x1e, 0xe5, 0x25, 0x3e,
-  0x93, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x32, 0xb0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x24, 0xb0, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x95, 0x40, 0xe8, 0x3d, 0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x37, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x6a, 0xb1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5c, 0xb1, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x6e, 0x0f, 0x63, 0x3d, 0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x36, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x82, 0xb2, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x74, 0xb2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x8b, 0x3d, 0xca, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x35, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xba, 0xb3, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xac, 0xb3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x3c, 0x81, 0x5f, 0x3d, 0xa9, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x34, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x34, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xd2, 0xb4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xc4, 0xb4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x74, 0xd2, 0x8d, 0x3d,
-  0xca, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x31, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x0a, 0xb6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xe8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xfc, 0xb5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x42, 0x93, 0x4a, 0x3d,
-  0xa9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x22, 0xb7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x01, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0xb7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x66, 0x98, 0x6f, 0x3d, 0xc4, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
-  0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46,
-  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
-  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69,
-  0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x31, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x5a, 0xb8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4c, 0xb8, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf6, 0x78, 0xf4, 0x3c, 0x9f, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x2f,
-  0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62,
-  0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69,
-  0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x6a, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x5c, 0xb9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xc3, 0x3d,
-  0x18, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66,
-  0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x5a, 0xba, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0xcc, 0xb9, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x9d, 0xeb, 0xe1, 0x39, 0xb7, 0x23, 0x24, 0x39,
-  0x39, 0xee, 0xbf, 0x38, 0xfc, 0xaf, 0x1b, 0x39, 0x27, 0xe9, 0x93, 0x39,
-  0x54, 0xd3, 0x02, 0x3a, 0x8c, 0xcc, 0xef, 0x39, 0x66, 0xc4, 0xfa, 0x39,
-  0x52, 0x2d, 0xf0, 0x38, 0x5e, 0xa6, 0x9e, 0x39, 0x0f, 0xc1, 0x7d, 0x39,
-  0x87, 0x6e, 0x06, 0x3a, 0x45, 0x65, 0x34, 0x39, 0x1d, 0x9c, 0x42, 0x39,
-  0xb7, 0x07, 0xfb, 0x39, 0x60, 0xdf, 0xa0, 0x39, 0xdd, 0x1b, 0xb4, 0x39,
-  0x12, 0xcf, 0xd4, 0x38, 0x31, 0x21, 0x72, 0x39, 0x45, 0x80, 0x79, 0x39,
-  0x0f, 0xff, 0x8a, 0x39, 0x12, 0xc9, 0x40, 0x39, 0x09, 0xc9, 0xe3, 0x38,
-  0xd2, 0x5c, 0x0b, 0x39, 0x70, 0x3a, 0x15, 0x39, 0x12, 0xc6, 0x03, 0x39,
-  0xe9, 0xa8, 0xd2, 0x38, 0x1c, 0xbd, 0xb1, 0x39, 0xc8, 0x40, 0x7e, 0x39,
-  0x56, 0xed, 0xb2, 0x38, 0xdc, 0xa3, 0x12, 0x39, 0xae, 0xfe, 0xcf, 0x38,
-  0xb7, 0xe9, 0xb8, 0x39, 0xe5, 0x11, 0x08, 0x3a, 0xf0, 0x71, 0x44, 0x39,
-  0xaa, 0x37, 0x3f, 0x3a, 0x02, 0xfe, 0x94, 0x39, 0x49, 0x9e, 0xde, 0x38,
-  0xa8, 0x3c, 0x85, 0x39, 0x09, 0xfb, 0x57, 0x3a, 0x5a, 0x3d, 0xc5, 0x39,
-  0xb9, 0xe5, 0x89, 0x39, 0x17, 0x92, 0x98, 0x38, 0x2d, 0x7d, 0xda, 0x38,
-  0xaf, 0x90, 0xaa, 0x38, 0xb3, 0x25, 0xad, 0x39, 0x87, 0xa0, 0x0e, 0x39,
-  0xc3, 0x44, 0xee, 0x3a, 0xef, 0xd2, 0x40, 0x39, 0xa0, 0x9c, 0xdc, 0x39,
-  0xff, 0x7a, 0x3d, 0x39, 0x6b, 0x2e, 0x4d, 0x3a, 0xc8, 0x32, 0xeb, 0x38,
-  0x9c, 0x5d, 0x06, 0x39, 0xf5, 0x88, 0xd9, 0x39, 0x62, 0x99, 0x2d, 0x39,
-  0x41, 0x5e, 0xfc, 0x39, 0x8b, 0xbd, 0x24, 0x39, 0x20, 0x48, 0x42, 0x39,
-  0xa1, 0x96, 0x03, 0x39, 0x46, 0xb1, 0x86, 0x3a, 0xb9, 0x6f, 0xda, 0x3a,
-  0xd1, 0x85, 0x3a, 0x39, 0xac, 0xb5, 0x8b, 0x38, 0x13, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xba, 0xbd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xbc, 0x03, 0x00, 0x00, 0x2c, 0xbd, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xdd, 0xf5, 0x2c, 0x38, 0x04, 0x53, 0x7b, 0x37, 0x3e, 0xf0, 0x12, 0x37,
-  0xfe, 0x61, 0x6e, 0x37, 0xb5, 0x79, 0xe2, 0x37, 0xab, 0x50, 0x48, 0x38,
-  0xed, 0x95, 0x37, 0x38, 0x90, 0xfb, 0x3f, 0x38, 0x03, 0xe0, 0x37, 0x37,
-  0x33, 0xeb, 0xf2, 0x37, 0xf9, 0x44, 0xc2, 0x37, 0x3d, 0xd6, 0x4d, 0x38,
-  0x84, 0x1b, 0x8a, 0x37, 0x59, 0xfd, 0x94, 0x37, 0x19, 0x2f, 0x40, 0x38,
-  0x72, 0x52, 0xf6, 0x37, 0x52, 0xe3, 0x09, 0x38, 0x28, 0xec, 0x22, 0x37,
-  0xb4, 0x5e, 0xb9, 0x37, 0x6a, 0x03, 0xbf, 0x37, 0x73, 0xd3, 0xd4, 0x37,
-  0xca, 0x97, 0x93, 0x37, 0x5f, 0x63, 0x2e, 0x37, 0x03, 0x63, 0x55, 0x37,
-  0x25, 0x7e, 0x64, 0x37, 0x59, 0xc4, 0x49, 0x37, 0xf7, 0x46, 0x21, 0x37,
-  0xcd, 0x12, 0x08, 0x38, 0xc1, 0xa6, 0xc2, 0x37, 0xb6, 0xfb, 0x08, 0x37,
-  0xa1, 0x87, 0x60, 0x37, 0xaa, 0x3c, 0x1f, 0x37, 0xdf, 0x90, 0x0d, 0x38,
-  0x5b, 0x58, 0x50, 0x38, 0x09, 0x65, 0x96, 0x37, 0x7b, 0x64, 0x92, 0x38,
-  0x9e, 0x21, 0xe4, 0x37, 0xb2, 0x6e, 0x2a, 0x37, 0xe6, 0x01, 0xcc, 0x37,
-  0xc8, 0x59, 0xa5, 0x38, 0xc4, 0x00, 0x17, 0x38, 0xae, 0x24, 0xd3, 0x37,
-  0x4a, 0x9c, 0xe9, 0x36, 0x65, 0x45, 0x27, 0x37, 0xde, 0x94, 0x02, 0x37,
-  0xed, 0x8e, 0x04, 0x38, 0x9e, 0x62, 0x5a, 0x37, 0xfb, 0x69, 0x36, 0x39,
-  0x57, 0x9f, 0x93, 0x37, 0x73, 0xe5, 0x28, 0x38, 0x0d, 0x10, 0x91, 0x37,
-  0x3e, 0x15, 0x9d, 0x38, 0x40, 0x10, 0x34, 0x37, 0x55, 0xbc, 0x4d, 0x37,
-  0x6d, 0x8a, 0x26, 0x38, 0x7e, 0xe7, 0x84, 0x37, 0x57, 0x35, 0x41, 0x38,
-  0x8d, 0x3e, 0x7c, 0x37, 0x0c, 0xbd, 0x94, 0x37, 0xb5, 0x7b, 0x49, 0x37,
-  0x70, 0x3c, 0xce, 0x38, 0x18, 0x3b, 0x27, 0x39, 0x5e, 0xcc, 0x8e, 0x37,
-  0x0f, 0xeb, 0xd5, 0x36, 0x9e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68,
-  0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x96, 0xc1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00,
-  0x02, 0xd2, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xf6, 0x94, 0x7f, 0x3c, 0x66, 0x80, 0x25, 0x3c, 0xd3, 0xb4, 0x35, 0x3b,
-  0x3e, 0xa4, 0xe5, 0x3b, 0x6b, 0xf1, 0x2c, 0x3c, 0x5f, 0xea, 0x58, 0x3c,
-  0x9b, 0x0d, 0x1e, 0x3c, 0xe1, 0xd4, 0xb0, 0x3b, 0x21, 0x97, 0x95, 0x3b,
-  0xb7, 0xe8, 0xbf, 0x3b, 0x39, 0x45, 0x61, 0x3c, 0xe4, 0x96, 0x37, 0x3c,
-  0xe8, 0xb5, 0x14, 0x3c, 0xef, 0xaf, 0x16, 0x3c, 0xc5, 0x8f, 0x6e, 0x3c,
-  0xeb, 0xfc, 0x54, 0x3b, 0x4b, 0x85, 0xda, 0x3b, 0x4d, 0xec, 0xa9, 0x3b,
-  0x84, 0x7d, 0x1e, 0x3c, 0x0d, 0x94, 0xf9, 0x3b, 0x11, 0xae, 0xbb, 0x3b,
-  0xb4, 0x8f, 0xa9, 0x3b, 0x32, 0x38, 0xd6, 0x3b, 0x0a, 0xb3, 0x79, 0x3b,
-  0x9c, 0xe8, 0x34, 0x3c, 0xc4, 0x96, 0x99, 0x3b, 0x4d, 0x88, 0x3c, 0x3b,
-  0x14, 0x23, 0x52, 0x3c, 0xe9, 0x25, 0xa4, 0x3b, 0x67, 0x22, 0x9d, 0x3b,
-  0xc3, 0x23, 0x31, 0x3b, 0x78, 0x45, 0xa0, 0x3b, 0x1d, 0x34, 0x46, 0x3c,
-  0x9d, 0x28, 0x32, 0x3c, 0x53, 0xf1, 0x76, 0x3c, 0x1b, 0xd3, 0x47, 0x3c,
-  0xd3, 0x18, 0x81, 0x3c, 0xdc, 0x96, 0x9b, 0x3b, 0x31, 0x58, 0x2c, 0x3c,
-  0xc8, 0xa4, 0x8e, 0x3c, 0xd8, 0x51, 0x46, 0x3c, 0x56, 0xfd, 0xc0, 0x3b,
-  0x02, 0xf0, 0x4c, 0x3b, 0x7a, 0xe5, 0x0f, 0x3c, 0x6a, 0xcc, 0x14, 0x3c,
-  0x53, 0xc2, 0x55, 0x3c, 0xa3, 0xed, 0x2c, 0x3c, 0x49, 0xca, 0x63, 0x3c,
-  0x76, 0x6f, 0x85, 0x3b, 0x94, 0x18, 0xea, 0x3b, 0x17, 0x2d, 0x00, 0x3c,
-  0x33, 0xe3, 0x6a, 0x3c, 0x71, 0xbe, 0x68, 0x3b, 0x5f, 0xec, 0x2a, 0x3b,
-  0xa7, 0x89, 0x5c, 0x3c, 0xa5, 0xa9, 0x44, 0x3c, 0x50, 0x9b, 0x91, 0x3c,
-  0xda, 0x0b, 0x1b, 0x3c, 0xc7, 0xb4, 0xa9, 0x3b, 0x26, 0x74, 0xb0, 0x3b,
-  0xf9, 0x71, 0x5e, 0x3c, 0x9e, 0x5b, 0x89, 0x3c, 0xdb, 0x04, 0x79, 0x3c,
-  0x2c, 0xbf, 0xd0, 0x3b, 0xb0, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
-  0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f,
-  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
-  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e,
-  0x76, 0x32, 0x64, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
-  0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x9a, 0xc5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe0, 0x03, 0x00, 0x00, 0x0c, 0xc5, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xbe, 0x12, 0xf4, 0x39, 0x94, 0x0c, 0x9e, 0x39, 0x34, 0x86, 0xad, 0x38,
-  0x0d, 0x4d, 0x5b, 0x39, 0xd1, 0x27, 0xa5, 0x39, 0xe1, 0x25, 0xcf, 0x39,
-  0xa6, 0xef, 0x96, 0x39, 0x74, 0xde, 0x28, 0x39, 0xba, 0xda, 0x0e, 0x39,
-  0x7c, 0x44, 0x37, 0x39, 0x6b, 0x20, 0xd7, 0x39, 0x90, 0x52, 0xaf, 0x39,
-  0xa5, 0x03, 0x8e, 0x39, 0xe3, 0xe6, 0x8f, 0x39, 0xc0, 0xd1, 0xe3, 0x39,
-  0xb3, 0x65, 0xcb, 0x38, 0x4c, 0xae, 0x50, 0x39, 0x83, 0x45, 0x22, 0x39,
-  0x85, 0x5a, 0x97, 0x39, 0x0a, 0x57, 0x6e, 0x39, 0x96, 0x3a, 0x33, 0x39,
-  0x16, 0xed, 0x21, 0x39, 0xc8, 0x92, 0x4c, 0x39, 0xa1, 0x74, 0xee, 0x38,
-  0x30, 0xc3, 0xac, 0x39, 0x45, 0xac, 0x12, 0x39, 0xfe, 0x0a, 0xb4, 0x38,
-  0xb9, 0xac, 0xc8, 0x39, 0xb2, 0xc1, 0x1c, 0x39, 0x09, 0x0f, 0x16, 0x39,
-  0xc9, 0x29, 0xa9, 0x38, 0xf1, 0x0d, 0x19, 0x39, 0x53, 0x47, 0xbd, 0x39,
-  0xe4, 0x22, 0xaa, 0x39, 0xb2, 0xd2, 0xeb, 0x39, 0xa1, 0xd3, 0xbe, 0x39,
-  0x52, 0x91, 0xf6, 0x39, 0x4e, 0x95, 0x14, 0x39, 0x7e, 0x95, 0xa4, 0x39,
-  0x75, 0x38, 0x08, 0x3a, 0xb7, 0x63, 0xbd, 0x39, 0xa6, 0x4c, 0x38, 0x39,
-  0x97, 0xb5, 0xc3, 0x38, 0xb6, 0x6a, 0x89, 0x39, 0x24, 0x19, 0x8e, 0x39,
-  0x38, 0x22, 0xcc, 0x39, 0x35, 0x24, 0xa5, 0x39, 0x6f, 0x88, 0xd9, 0x39,
-  0x92, 0xda, 0xfe, 0x38, 0x0a, 0x8e, 0x5f, 0x39, 0x14, 0xcf, 0x74, 0x39,
-  0x89, 0x4f, 0xe0, 0x39, 0x7d, 0x43, 0xde, 0x38, 0x0e, 0x3a, 0xa3, 0x38,
-  0x68, 0x9b, 0xd2, 0x39, 0x9e, 0xce, 0xbb, 0x39, 0xd5, 0x0c, 0x0b, 0x3a,
-  0x8e, 0x10, 0x94, 0x39, 0x7d, 0x10, 0x22, 0x39, 0x14, 0x82, 0x28, 0x39,
-  0xbd, 0x6d, 0xd4, 0x39, 0x3a, 0x2c, 0x03, 0x3a, 0x4a, 0xce, 0xed, 0x39,
-  0xd8, 0x58, 0x47, 0x39, 0xc3, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x31, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64,
-  0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x9a, 0xc9, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00,
-  0x0c, 0xc9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xd6, 0x86, 0x54, 0x3b, 0x88, 0xdc, 0x3b, 0x3b,
-  0xb0, 0xd9, 0x83, 0x3b, 0x47, 0xf2, 0x55, 0x3b, 0x6a, 0x5b, 0x68, 0x3b,
-  0x61, 0x04, 0x99, 0x3b, 0xe8, 0x37, 0x83, 0x3b, 0x31, 0xe7, 0x97, 0x3b,
-  0x56, 0x20, 0x7a, 0x3b, 0x04, 0x43, 0x4c, 0x3b, 0xa5, 0x1b, 0x12, 0x3b,
-  0xbb, 0xcf, 0x21, 0x3b, 0xf7, 0x5f, 0x59, 0x3b, 0x13, 0x9b, 0x8d, 0x3b,
-  0x25, 0xe8, 0x77, 0x3b, 0x1b, 0x20, 0x31, 0x3b, 0x3e, 0xea, 0x54, 0x3b,
-  0x5c, 0x9e, 0x58, 0x3b, 0x65, 0x69, 0x4c, 0x3b, 0x8d, 0x83, 0x8f, 0x3b,
-  0x33, 0xc7, 0x63, 0x3b, 0x3e, 0x1b, 0xb4, 0x3b, 0x2e, 0x15, 0x9c, 0x3b,
-  0xff, 0x18, 0x25, 0x3b, 0xa7, 0x6c, 0x83, 0x3b, 0xa9, 0x71, 0x64, 0x3b,
-  0x64, 0x5b, 0x45, 0x3b, 0xfe, 0x4b, 0x15, 0x3b, 0x50, 0xf2, 0x40, 0x3b,
-  0x04, 0x31, 0x87, 0x3b, 0x3b, 0x2f, 0x64, 0x3b, 0xea, 0xc6, 0xb2, 0x3b,
-  0xc3, 0xb3, 0x9c, 0x3b, 0x19, 0xd2, 0x69, 0x3b, 0xe4, 0x8a, 0xca, 0x3b,
-  0x84, 0x7e, 0x45, 0x3b, 0xdc, 0x02, 0x30, 0x3b, 0x17, 0xad, 0x50, 0x3b,
-  0xaf, 0xb0, 0x9d, 0x3b, 0xfc, 0x9e, 0x94, 0x3b, 0xc8, 0xbd, 0x38, 0x3b,
-  0x7a, 0x03, 0x24, 0x3b, 0x68, 0x2c, 0x9e, 0x3b, 0x17, 0x1b, 0xc5, 0x3b,
-  0x66, 0x6b, 0x6e, 0x3b, 0xde, 0x73, 0x58, 0x3b, 0xeb, 0xc5, 0x9a, 0x3b,
-  0x0b, 0x2f, 0x7a, 0x3b, 0x3f, 0xb5, 0x91, 0x3b, 0x50, 0x1a, 0x80, 0x3b,
-  0x08, 0x84, 0x97, 0x3b, 0x31, 0xc1, 0x8b, 0x3b, 0x58, 0xd2, 0x38, 0x3b,
-  0x9d, 0xba, 0x56, 0x3b, 0xd5, 0x31, 0x6f, 0x3b, 0xeb, 0xd0, 0x94, 0x3b,
-  0x80, 0x35, 0x6b, 0x3b, 0x14, 0x58, 0x46, 0x3b, 0xbe, 0x08, 0x5a, 0x3b,
-  0xfe, 0x4b, 0x38, 0x3b, 0x4b, 0x42, 0x46, 0x3b, 0x65, 0xc2, 0x77, 0x3b,
-  0xec, 0x41, 0x3e, 0x3b, 0xba, 0x22, 0x41, 0x3b, 0x15, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xfa, 0xcc, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0x03, 0x00, 0x00,
-  0x6c, 0xcc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x67, 0xe8, 0x46, 0x39,
-  0xb9, 0xd2, 0x2f, 0x39, 0x72, 0xcd, 0x76, 0x39, 0x8d, 0x3c, 0x48, 0x39,
-  0xab, 0x77, 0x59, 0x39, 0x2e, 0x36, 0x8f, 0x39, 0x9e, 0x9e, 0x75, 0x39,
-  0x45, 0x2b, 0x8e, 0x39, 0x17, 0x19, 0x6a, 0x39, 0x2a, 0x2c, 0x3f, 0x39,
-  0xca, 0xbe, 0x08, 0x39, 0x43, 0x71, 0x17, 0x39, 0xff, 0x71, 0x4b, 0x39,
-  0x13, 0x88, 0x84, 0x39, 0x4f, 0x05, 0x68, 0x39, 0x6b, 0xc6, 0x25, 0x39,
-  0x70, 0x45, 0x47, 0x39, 0xcc, 0xbc, 0x4a, 0x39, 0x15, 0x50, 0x3f, 0x39,
-  0x40, 0x51, 0x86, 0x39, 0x92, 0x2e, 0x55, 0x39, 0xa7, 0x90, 0xa8, 0x39,
-  0xb1, 0x14, 0x92, 0x39, 0x9f, 0x84, 0x1a, 0x39, 0x5a, 0x01, 0x76, 0x39,
-  0x1b, 0xce, 0x55, 0x39, 0xcf, 0xb5, 0x38, 0x39, 0xd3, 0xba, 0x0b, 0x39,
-  0x15, 0x95, 0x34, 0x39, 0x7b, 0x0e, 0x7d, 0x39, 0xef, 0x8f, 0x55, 0x39,
-  0x22, 0x52, 0xa7, 0x39, 0x1c, 0xa9, 0x92, 0x39, 0x57, 0xd6, 0x5a, 0x39,
-  0x3e, 0x90, 0xbd, 0x39, 0xaf, 0xd6, 0x38, 0x39, 0x73, 0xbb, 0x24, 0x39,
-  0xd2, 0x4d, 0x43, 0x39, 0xd3, 0x95, 0x93, 0x39, 0xe7, 0x18, 0x8b, 0x39,
-  0x28, 0xe7, 0x2c, 0x39, 0xe2, 0x80, 0x19, 0x39, 0x9e, 0x09, 0x94, 0x39,
-  0xa1, 0x79, 0xb8, 0x39, 0x33, 0x24, 0x5f, 0x39, 0x07, 0x95, 0x4a, 0x39,
-  0xea, 0xda, 0x90, 0x39, 0xdb, 0x26, 0x6a, 0x39, 0xf3, 0x5e, 0x88, 0x39,
-  0xa7, 0xc9, 0x6f, 0x39, 0x76, 0xce, 0x8d, 0x39, 0x8f, 0xcc, 0x82, 0x39,
-  0x67, 0xfa, 0x2c, 0x39, 0x0d, 0xf8, 0x48, 0x39, 0xeb, 0xdd, 0x5f, 0x39,
-  0xa3, 0x47, 0x8b, 0x39, 0xf8, 0x22, 0x5c, 0x39, 0x4e, 0xa2, 0x39, 0x39,
-  0xf5, 0x0f, 0x4c, 0x39, 0xa9, 0x7c, 0x2c, 0x39, 0xea, 0x8d, 0x39, 0x39,
-  0xfa, 0xe1, 0x67, 0x39, 0xce, 0x10, 0x32, 0x39, 0x65, 0xc2, 0x34, 0x39,
-  0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x32, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xe6, 0xd0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00, 0x52, 0xe1, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xcc, 0xa2, 0x30, 0x3c, 0x1d, 0x33, 0x1b, 0x3c,
-  0x87, 0x51, 0x93, 0x3b, 0xc8, 0x48, 0xd6, 0x3b, 0xcd, 0xbc, 0x4d, 0x3c,
-  0x2c, 0x4c, 0xb2, 0x3b, 0x9a, 0xb5, 0xfa, 0x3b, 0x92, 0x7a, 0x01, 0x3c,
-  0xad, 0xd7, 0x15, 0x3c, 0x8f, 0x2f, 0x0a, 0x3c, 0x1a, 0x50, 0xcf, 0x3b,
-  0xd1, 0xaa, 0x3f, 0x3c, 0x1f, 0xfc, 0x19, 0x3c, 0xb9, 0x79, 0xd8, 0x3b,
-  0xd4, 0xac, 0xdb, 0x3b, 0x2c, 0x2a, 0x1a, 0x3c, 0x28, 0x29, 0x38, 0x3c,
-  0x0b, 0x2b, 0x1a, 0x3c, 0xe9, 0xdb, 0x03, 0x3c, 0xb5, 0x92, 0xab, 0x3b,
-  0xa7, 0xbf, 0xdc, 0x3b, 0x97, 0xe5, 0x14, 0x3c, 0x84, 0xfe, 0xd2, 0x3b,
-  0x65, 0x45, 0x59, 0x3c, 0x5d, 0xb4, 0x1a, 0x3c, 0x0c, 0x5c, 0x06, 0x3c,
-  0xef, 0xe0, 0x52, 0x3c, 0x8a, 0x57, 0x7b, 0x3b, 0xb0, 0x0f, 0xc9, 0x3b,
-  0xf1, 0x9e, 0xb6, 0x3b, 0x64, 0xf2, 0xeb, 0x3b, 0xdd, 0x60, 0x4d, 0x3c,
-  0xe3, 0x90, 0x2e, 0x3c, 0x2f, 0x06, 0xb9, 0x3b, 0xde, 0xdd, 0x8e, 0x3b,
-  0xdf, 0x66, 0x2f, 0x3c, 0xf2, 0xce, 0x09, 0x3c, 0x96, 0x7a, 0x8b, 0x3b,
-  0x27, 0xd2, 0xef, 0x3b, 0x13, 0x6c, 0xa4, 0x3b, 0xfb, 0x60, 0xc3, 0x3b,
-  0xb2, 0xe6, 0x8a, 0x3c, 0x19, 0xa2, 0xdd, 0x3b, 0xa2, 0x06, 0x17, 0x3c,
-  0x92, 0x28, 0x59, 0x3c, 0x7d, 0x91, 0x43, 0x3c, 0x73, 0xa0, 0x7e, 0x3c,
-  0x22, 0x0d, 0x16, 0x3c, 0xd6, 0x7a, 0x2d, 0x3c, 0x92, 0xf8, 0x41, 0x3c,
-  0xec, 0xbe, 0xe8, 0x3b, 0x86, 0x0f, 0x12, 0x3c, 0x8e, 0x3c, 0x09, 0x3c,
-  0x03, 0x1f, 0xb0, 0x3b, 0x13, 0x3a, 0x73, 0x3c, 0x20, 0x6d, 0xab, 0x3b,
-  0x3e, 0x80, 0x9a, 0x3b, 0xb5, 0x22, 0x97, 0x3b, 0x2a, 0x04, 0x32, 0x3c,
-  0x29, 0x81, 0xe4, 0x3b, 0xb5, 0x15, 0x4b, 0x3c, 0x9c, 0x99, 0xde, 0x3b,
-  0xee, 0x19, 0xf9, 0x3b, 0x38, 0xb0, 0xd5, 0x3b, 0xb6, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xea, 0xd4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xe8, 0x03, 0x00, 0x00, 0x5c, 0xd4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0xc6, 0x0b, 0x3a,
-  0x36, 0x9f, 0xf5, 0x39, 0x25, 0x26, 0x69, 0x39, 0xb1, 0x90, 0xa9, 0x39,
-  0x52, 0xcd, 0x22, 0x3a, 0xaa, 0x16, 0x8d, 0x39, 0x82, 0x63, 0xc6, 0x39,
-  0x64, 0xea, 0xcc, 0x39, 0xc0, 0x24, 0xed, 0x39, 0x08, 0xb2, 0xda, 0x39,
-  0x75, 0x0c, 0xa4, 0x39, 0x09, 0xab, 0x17, 0x3a, 0x08, 0xb3, 0xf3, 0x39,
-  0x92, 0x4c, 0xab, 0x39, 0xbc, 0xd4, 0xad, 0x39, 0xe9, 0xfb, 0xf3, 0x39,
-  0x69, 0xba, 0x11, 0x3a, 0x4a, 0xfd, 0xf3, 0x39, 0xbe, 0xae, 0xd0, 0x39,
-  0x74, 0xc4, 0x87, 0x39, 0x35, 0xae, 0xae, 0x39, 0x9f, 0xa5, 0xeb, 0x39,
-  0x33, 0xf6, 0xa6, 0x39, 0xbd, 0xed, 0x2b, 0x3a, 0x9e, 0xd6, 0xf4, 0x39,
-  0xd6, 0xa3, 0xd4, 0x39, 0xca, 0xde, 0x26, 0x3a, 0xa7, 0xe3, 0x46, 0x39,
-  0x09, 0x1a, 0x9f, 0x39, 0x77, 0x82, 0x90, 0x39, 0xfc, 0xb4, 0xba, 0x39,
-  0x92, 0x84, 0x22, 0x3a, 0xbd, 0x22, 0x0a, 0x3a, 0x4f, 0x69, 0x92, 0x39,
-  0x7f, 0x1a, 0x62, 0x39, 0x11, 0xcc, 0x0a, 0x3a, 0x21, 0x19, 0xda, 0x39,
-  0xeb, 0xbd, 0x5c, 0x39, 0xc6, 0xc5, 0xbd, 0x39, 0xdb, 0x1b, 0x82, 0x39,
-  0xe9, 0x9a, 0x9a, 0x39, 0xdd, 0xd3, 0x5b, 0x3a, 0x65, 0x61, 0xaf, 0x39,
-  0x37, 0x04, 0xef, 0x39, 0xed, 0xd6, 0x2b, 0x3a, 0x4c, 0xc1, 0x1a, 0x3a,
-  0x13, 0x7d, 0x49, 0x3a, 0x5a, 0x79, 0xed, 0x39, 0xb7, 0x46, 0x09, 0x3a,
-  0xb7, 0x7d, 0x19, 0x3a, 0x88, 0x2c, 0xb8, 0x39, 0x89, 0x28, 0xe7, 0x39,
-  0x72, 0x31, 0xd9, 0x39, 0xc8, 0x5d, 0x8b, 0x39, 0xbc, 0x77, 0x40, 0x3a,
-  0xb7, 0xa6, 0x87, 0x39, 0x21, 0x84, 0x74, 0x39, 0xa5, 0x30, 0x6f, 0x39,
-  0xaf, 0xdd, 0x0c, 0x3a, 0x5b, 0xd1, 0xb4, 0x39, 0xf3, 0xb3, 0x20, 0x3a,
-  0x41, 0x25, 0xb0, 0x39, 0xc0, 0x1d, 0xc5, 0x39, 0xf7, 0x17, 0xa9, 0x39,
-  0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x33, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x33, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x31, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xf2, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x34, 0x03, 0x00, 0x00, 0x64, 0xd8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5f, 0x81, 0x1c, 0x3b,
-  0x48, 0x62, 0x54, 0x3b, 0xdd, 0xca, 0x4d, 0x3b, 0x36, 0x4b, 0xa1, 0x3b,
-  0xbb, 0x1d, 0x5f, 0x3b, 0x89, 0xc3, 0x1e, 0x3b, 0x3e, 0x2c, 0x9b, 0x3b,
-  0x9b, 0x84, 0x4e, 0x3b, 0xfa, 0x47, 0x9b, 0x3b, 0x13, 0x89, 0x79, 0x3b,
-  0x7d, 0xa0, 0x4d, 0x3b, 0x8f, 0xf9, 0x61, 0x3b, 0x04, 0xbc, 0x71, 0x3b,
-  0x54, 0x6b, 0x32, 0x3b, 0x0f, 0x36, 0x79, 0x3b, 0x03, 0xfe, 0x73, 0x3b,
-  0x21, 0x0e, 0x16, 0x3b, 0x88, 0x99, 0x31, 0x3b, 0x4b, 0x8b, 0x44, 0x3b,
-  0x2b, 0x87, 0x65, 0x3b, 0xcb, 0x96, 0x3f, 0x3b, 0x1b, 0x49, 0x51, 0x3b,
-  0x8c, 0xcf, 0x2c, 0x3b, 0xb2, 0x96, 0x09, 0x3b, 0xb4, 0xa0, 0x65, 0x3b,
-  0x2d, 0x1c, 0x57, 0x3b, 0xee, 0xa8, 0x54, 0x3b, 0xeb, 0x33, 0x61, 0x3b,
-  0x93, 0x57, 0x38, 0x3b, 0xe4, 0x42, 0x36, 0x3b, 0xe1, 0x08, 0x14, 0x3b,
-  0xec, 0x11, 0x33, 0x3b, 0xef, 0x8e, 0x60, 0x3b, 0x11, 0xae, 0x6a, 0x3b,
-  0x76, 0xc9, 0x87, 0x3b, 0x69, 0xda, 0x4d, 0x3b, 0xf0, 0x39, 0x4a, 0x3b,
-  0xe2, 0x32, 0x70, 0x3b, 0x4d, 0xce, 0x33, 0x3b, 0x2a, 0x75, 0x4e, 0x3b,
-  0xd5, 0x09, 0x81, 0x3b, 0x65, 0x10, 0x6b, 0x3b, 0x4e, 0x2b, 0x46, 0x3b,
-  0xff, 0xa4, 0x5c, 0x3b, 0x9b, 0xab, 0x5b, 0x3b, 0x39, 0xee, 0x3d, 0x3b,
-  0x43, 0x18, 0x41, 0x3b, 0x08, 0x52, 0x42, 0x3b, 0xfd, 0xf3, 0x8b, 0x3b,
-  0x1e, 0x9b, 0x41, 0x3b, 0xc2, 0x69, 0x3d, 0x3b, 0x6a, 0xf8, 0xf9, 0x3a,
-  0x07, 0x30, 0x59, 0x3b, 0x72, 0x16, 0x21, 0x3b, 0xdd, 0x6e, 0x63, 0x3b,
-  0x7b, 0x01, 0x47, 0x3b, 0xf7, 0xc4, 0x6d, 0x3b, 0xb7, 0x43, 0x53, 0x3b,
-  0x8e, 0xde, 0x6a, 0x3b, 0xcb, 0xd4, 0x81, 0x3b, 0x4c, 0x70, 0x71, 0x3b,
-  0x2f, 0x9e, 0x49, 0x3b, 0xa8, 0xc3, 0x8c, 0x3b, 0x67, 0x6d, 0x49, 0x3b,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x52, 0xdc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x28, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xcc, 0x03, 0x00, 0x00, 0xc4, 0xdb, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xd5, 0x67, 0x2d, 0x39, 0x75, 0x51, 0x6b, 0x39, 0xd3, 0x03, 0x64, 0x39,
-  0x0b, 0xb6, 0xb2, 0x39, 0x97, 0x35, 0x77, 0x39, 0x6e, 0xe8, 0x2f, 0x39,
-  0xde, 0xed, 0xab, 0x39, 0x9f, 0xd1, 0x64, 0x39, 0x98, 0x0c, 0xac, 0x39,
-  0xa3, 0x3d, 0x8a, 0x39, 0xdf, 0xd4, 0x63, 0x39, 0x72, 0x60, 0x7a, 0x39,
-  0x48, 0xeb, 0x85, 0x39, 0x94, 0xaf, 0x45, 0x39, 0xa6, 0x0f, 0x8a, 0x39,
-  0x7d, 0x2b, 0x87, 0x39, 0x48, 0x42, 0x26, 0x39, 0x21, 0xc7, 0x44, 0x39,
-  0x97, 0xc4, 0x59, 0x39, 0x47, 0x50, 0x7e, 0x39, 0x1d, 0x47, 0x54, 0x39,
-  0xa1, 0xe2, 0x67, 0x39, 0xc1, 0x78, 0x3f, 0x39, 0x38, 0x72, 0x18, 0x39,
-  0x92, 0x6c, 0x7e, 0x39, 0xb7, 0x56, 0x6e, 0x39, 0xbc, 0x9f, 0x6b, 0x39,
-  0x76, 0x85, 0x79, 0x39, 0x8f, 0x3f, 0x4c, 0x39, 0x5a, 0xf1, 0x49, 0x39,
-  0x2d, 0x05, 0x24, 0x39, 0x2a, 0x68, 0x46, 0x39, 0xa9, 0xce, 0x78, 0x39,
-  0xcc, 0x02, 0x82, 0x39, 0x2e, 0x73, 0x96, 0x39, 0x0d, 0x15, 0x64, 0x39,
-  0x51, 0x10, 0x60, 0x39, 0x7d, 0x11, 0x85, 0x39, 0xe2, 0x38, 0x47, 0x39,
-  0x84, 0xc0, 0x64, 0x39, 0xfe, 0xf8, 0x8e, 0x39, 0x46, 0x39, 0x82, 0x39,
-  0x87, 0x91, 0x5b, 0x39, 0x88, 0x78, 0x74, 0x39, 0x35, 0x64, 0x73, 0x39,
-  0xb2, 0x70, 0x52, 0x39, 0x35, 0xf2, 0x55, 0x39, 0xdb, 0x4d, 0x57, 0x39,
-  0xe0, 0x10, 0x9b, 0x39, 0x31, 0x83, 0x56, 0x39, 0xed, 0xdd, 0x51, 0x39,
-  0x51, 0x7b, 0x0a, 0x39, 0xff, 0xa3, 0x70, 0x39, 0x94, 0x7b, 0x32, 0x39,
-  0x0f, 0xfe, 0x7b, 0x39, 0xd4, 0x7e, 0x5c, 0x39, 0xf3, 0xb8, 0x83, 0x39,
-  0xf2, 0x13, 0x6a, 0x39, 0xa9, 0x1d, 0x82, 0x39, 0xde, 0xd9, 0x8f, 0x39,
-  0x55, 0xc1, 0x85, 0x39, 0xbe, 0x63, 0x5f, 0x39, 0xf8, 0xf6, 0x9b, 0x39,
-  0xb1, 0x2d, 0x5f, 0x39, 0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x34, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x34, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x32, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x32, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x03, 0x00, 0x00,
-  0xaa, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc4, 0x36, 0xa2, 0x3b,
-  0x7c, 0x4b, 0x62, 0x3b, 0xd4, 0x64, 0xbd, 0x3b, 0x1f, 0x33, 0xff, 0x3b,
-  0x0d, 0x25, 0x41, 0x3c, 0x50, 0xaf, 0xbd, 0x3b, 0x1d, 0x4a, 0xb8, 0x3b,
-  0xa9, 0x10, 0xbb, 0x3b, 0x4a, 0xc8, 0xa8, 0x3b, 0x35, 0x45, 0xb0, 0x3b,
-  0x51, 0xb9, 0xc8, 0x3b, 0xce, 0x32, 0xb7, 0x3b, 0xfc, 0x5f, 0x91, 0x3b,
-  0xd9, 0xff, 0xfc, 0x3b, 0x2d, 0x36, 0xd9, 0x3b, 0x2b, 0x45, 0xe5, 0x3b,
-  0xc5, 0x10, 0x27, 0x3c, 0x17, 0xb9, 0xb0, 0x3b, 0xc1, 0x16, 0xd6, 0x3b,
-  0xb5, 0xeb, 0xf2, 0x3b, 0x0e, 0xee, 0x9e, 0x3b, 0x45, 0xfe, 0xa3, 0x3b,
-  0x75, 0xce, 0x73, 0x3b, 0x01, 0x48, 0x72, 0x3c, 0x6a, 0xf5, 0xb4, 0x3b,
-  0x3f, 0x75, 0x3e, 0x3c, 0x1a, 0xbc, 0x93, 0x3b, 0x99, 0xe5, 0x12, 0x3c,
-  0x00, 0x4d, 0xbe, 0x3b, 0x6b, 0xfb, 0xd2, 0x3b, 0xdc, 0xce, 0xc9, 0x3b,
-  0xee, 0x02, 0x0c, 0x3c, 0xd5, 0x71, 0xed, 0x3b, 0xa9, 0x23, 0xd9, 0x3b,
-  0x84, 0x3e, 0x03, 0x3c, 0x43, 0x95, 0x31, 0x3c, 0x13, 0x6d, 0xbd, 0x3b,
-  0x09, 0x1c, 0xaf, 0x3b, 0xdb, 0x08, 0x50, 0x3c, 0xc2, 0xf4, 0xf6, 0x3b,
-  0x89, 0x01, 0xde, 0x3b, 0xa4, 0xcb, 0x37, 0x3c, 0x09, 0xd2, 0xc9, 0x3b,
-  0x23, 0x67, 0x72, 0x3b, 0x7b, 0x2f, 0x92, 0x3b, 0x5b, 0x54, 0xf7, 0x3b,
-  0x24, 0x8c, 0xef, 0x3b, 0x44, 0xb5, 0x96, 0x3b, 0x23, 0x7b, 0x5e, 0x3b,
-  0x64, 0x95, 0x8b, 0x3b, 0x83, 0xa5, 0xe5, 0x3b, 0x3e, 0x03, 0x05, 0x3c,
-  0xc5, 0x17, 0x06, 0x3c, 0xc8, 0x4e, 0x96, 0x3b, 0xcc, 0xf3, 0xbd, 0x3b,
-  0x2e, 0x7e, 0xde, 0x3b, 0x5e, 0x34, 0xb7, 0x3b, 0x81, 0xd4, 0x23, 0x3c,
-  0x04, 0x02, 0x08, 0x3c, 0xf1, 0xa3, 0xd0, 0x3b, 0xf3, 0x21, 0xab, 0x3b,
-  0x9e, 0x1d, 0xc2, 0x3b, 0xc7, 0x69, 0x7a, 0x3b, 0xae, 0x90, 0xea, 0x3b,
-  0xb6, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61,
-  0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x32, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
-  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x42, 0xe4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xe8, 0x03, 0x00, 0x00, 0xb4, 0xe3, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x98, 0x9f, 0x8d, 0x39, 0xfe, 0x91, 0x45, 0x39, 0x71, 0x5a, 0xa5, 0x39,
-  0x5d, 0xce, 0xde, 0x39, 0xc7, 0xa0, 0x28, 0x3a, 0x78, 0x9b, 0xa5, 0x39,
-  0x98, 0xe5, 0xa0, 0x39, 0xf2, 0x51, 0xa3, 0x39, 0xad, 0x5b, 0x93, 0x39,
-  0x45, 0xe5, 0x99, 0x39, 0xc2, 0x3e, 0xaf, 0x39, 0xbd, 0xf1, 0x9f, 0x39,
-  0x00, 0xd8, 0x7d, 0x39, 0x96, 0xe2, 0xdc, 0x39, 0xd8, 0xa3, 0xbd, 0x39,
-  0xfe, 0x2a, 0xc8, 0x39, 0xf2, 0xdb, 0x11, 0x3a, 0x72, 0x4a, 0x9a, 0x39,
-  0xe6, 0xe9, 0xba, 0x39, 0xf4, 0x15, 0xd4, 0x39, 0x99, 0xc1, 0x8a, 0x39,
-  0x48, 0x2d, 0x8f, 0x39, 0xec, 0xdb, 0x54, 0x39, 0x08, 0x87, 0x53, 0x3a,
-  0x21, 0xfd, 0x9d, 0x39, 0x48, 0x48, 0x26, 0x3a, 0x6f, 0xfb, 0x80, 0x39,
-  0x28, 0x40, 0x00, 0x3a, 0x24, 0x25, 0xa6, 0x39, 0x84, 0x33, 0xb8, 0x39,
-  0x12, 0x31, 0xb0, 0x39, 0x77, 0x7a, 0xf4, 0x39, 0x07, 0x4e, 0xcf, 0x39,
-  0xae, 0x93, 0xbd, 0x39, 0x6c, 0x2b, 0xe5, 0x39, 0xab, 0x0a, 0x1b, 0x3a,
-  0xa4, 0x61, 0xa5, 0x39, 0xd2, 0xe1, 0x98, 0x39, 0xbc, 0xa0, 0x35, 0x3a,
-  0xe0, 0x9b, 0xd7, 0x39, 0x69, 0xd3, 0xc1, 0x39, 0x2d, 0x77, 0x20, 0x3a,
-  0xd8, 0x33, 0xb0, 0x39, 0x36, 0xa2, 0x53, 0x39, 0x51, 0x42, 0x7f, 0x39,
-  0x57, 0xef, 0xd7, 0x39, 0x01, 0x24, 0xd1, 0x39, 0xfb, 0x93, 0x83, 0x39,
-  0x94, 0x3d, 0x42, 0x39, 0x32, 0xbb, 0x73, 0x39, 0x1b, 0x7f, 0xc8, 0x39,
-  0xf2, 0x41, 0xe8, 0x39, 0xcc, 0x24, 0xea, 0x39, 0x81, 0x3a, 0x83, 0x39,
-  0x43, 0xd7, 0xa5, 0x39, 0x3c, 0x40, 0xc2, 0x39, 0x1a, 0xf3, 0x9f, 0x39,
-  0xd1, 0x08, 0x0f, 0x3a, 0xd5, 0x7c, 0xed, 0x39, 0x22, 0x28, 0xb6, 0x39,
-  0xf7, 0x68, 0x95, 0x39, 0xcb, 0x79, 0xa9, 0x39, 0x8e, 0xa0, 0x5a, 0x39,
-  0x71, 0xca, 0xcc, 0x39, 0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x35, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x35, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x32, 0x2f,
-  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x4a, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x34, 0x03, 0x00, 0x00, 0xbc, 0xe7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x37, 0xf1, 0x57, 0x3b, 0x46, 0x7b, 0x25, 0x3b, 0xdd, 0xc9, 0x04, 0x3b,
-  0xf4, 0x32, 0x3a, 0x3b, 0xf7, 0x30, 0xe1, 0x3a, 0x39, 0x29, 0x7d, 0x3b,
-  0xb6, 0x80, 0x21, 0x3b, 0x12, 0x58, 0xd2, 0x3a, 0x29, 0x0c, 0x15, 0x3b,
-  0x37, 0xaa, 0x28, 0x3b, 0x0d, 0xd6, 0x4b, 0x3b, 0x31, 0x0a, 0x66, 0x3b,
-  0xeb, 0xc9, 0x60, 0x3b, 0x49, 0xc2, 0x1a, 0x3b, 0x8b, 0xd6, 0x27, 0x3b,
-  0x27, 0xb1, 0x32, 0x3b, 0xe8, 0xfb, 0x1b, 0x3b, 0x94, 0x64, 0xad, 0x3a,
-  0x12, 0xcb, 0x74, 0x3b, 0x4f, 0x49, 0x23, 0x3b, 0x71, 0xed, 0x33, 0x3b,
-  0x9d, 0xa9, 0x06, 0x3b, 0xb2, 0xeb, 0xb6, 0x3a, 0xdc, 0x77, 0xca, 0x3a,
-  0xe1, 0xe5, 0x46, 0x3b, 0xba, 0x63, 0x8a, 0x3b, 0xff, 0x4b, 0x26, 0x3b,
-  0x88, 0xa4, 0x4c, 0x3b, 0xd8, 0x6b, 0x1f, 0x3b, 0x97, 0xc5, 0x29, 0x3b,
-  0x4c, 0x8f, 0x01, 0x3b, 0x78, 0x6c, 0x0b, 0x3b, 0x16, 0xff, 0x81, 0x3b,
-  0x30, 0x9b, 0x56, 0x3b, 0x90, 0xeb, 0x56, 0x3b, 0xd4, 0xe8, 0x69, 0x3b,
-  0x57, 0xd4, 0x02, 0x3b, 0x3e, 0xfc, 0x8b, 0x3b, 0x9c, 0x2c, 0x33, 0x3b,
-  0xd8, 0xb4, 0x03, 0x3b, 0x26, 0xbb, 0x32, 0x3b, 0x66, 0x2e, 0x37, 0x3b,
-  0x58, 0xb5, 0x58, 0x3b, 0x01, 0x36, 0x98, 0x3b, 0x57, 0x79, 0xda, 0x3a,
-  0xed, 0x2a, 0x34, 0x3b, 0x34, 0xee, 0x3d, 0x3b, 0xf9, 0x30, 0x09, 0x3b,
-  0x44, 0x0e, 0x30, 0x3b, 0xe4, 0x58, 0x25, 0x3b, 0x6b, 0x47, 0x60, 0x3b,
-  0x5f, 0xd3, 0x4b, 0x3b, 0xbd, 0x25, 0x35, 0x3b, 0x52, 0xb2, 0x20, 0x3b,
-  0x89, 0xf0, 0x35, 0x3b, 0x19, 0xe4, 0x36, 0x3b, 0x8e, 0xc1, 0x68, 0x3b,
-  0xa2, 0xa4, 0x4c, 0x3b, 0xca, 0x1b, 0x42, 0x3b, 0xd3, 0x32, 0x4b, 0x3b,
-  0xa6, 0x39, 0x74, 0x3b, 0x8f, 0x38, 0x6a, 0x3b, 0x85, 0xf7, 0x1e, 0x3b,
-  0x87, 0xd6, 0x3c, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xaa, 0xeb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xc8, 0x03, 0x00, 0x00, 0x1c, 0xeb, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x7f, 0xed, 0x6a, 0x39, 0xd2, 0x07, 0x34, 0x39, 0x94, 0x76, 0x10, 0x39,
-  0xcc, 0x91, 0x4a, 0x39, 0x6b, 0xfd, 0xf4, 0x38, 0x9a, 0xb5, 0x89, 0x39,
-  0xb5, 0xb3, 0x2f, 0x39, 0x5a, 0xd6, 0xe4, 0x38, 0xd2, 0x26, 0x22, 0x39,
-  0x69, 0x7e, 0x37, 0x39, 0xdb, 0xc1, 0x5d, 0x39, 0xc6, 0x43, 0x7a, 0x39,
-  0x50, 0x8d, 0x74, 0x39, 0x7f, 0x5d, 0x28, 0x39, 0x21, 0x98, 0x36, 0x39,
-  0x08, 0x67, 0x42, 0x39, 0xb0, 0xb2, 0x29, 0x39, 0x30, 0xa3, 0xbc, 0x38,
-  0x5b, 0x28, 0x85, 0x39, 0x73, 0xa4, 0x31, 0x39, 0x21, 0xbf, 0x43, 0x39,
-  0x82, 0x80, 0x12, 0x39, 0xc0, 0x00, 0xc7, 0x38, 0xe0, 0x44, 0xdc, 0x38,
-  0x8a, 0x62, 0x58, 0x39, 0x81, 0x8e, 0x96, 0x39, 0xe5, 0xea, 0x34, 0x39,
-  0x7e, 0xa2, 0x5e, 0x39, 0xfd, 0x6f, 0x2d, 0x39, 0xb3, 0xb2, 0x38, 0x39,
-  0x57, 0xf3, 0x0c, 0x39, 0x86, 0xae, 0x17, 0x39, 0xf5, 0x6c, 0x8d, 0x39,
-  0x66, 0x79, 0x69, 0x39, 0xd7, 0xd0, 0x69, 0x39, 0x81, 0x79, 0x7e, 0x39,
-  0xf6, 0x54, 0x0e, 0x39, 0xf0, 0x4a, 0x98, 0x39, 0x58, 0xed, 0x42, 0x39,
-  0x34, 0x49, 0x0f, 0x39, 0xe8, 0x71, 0x42, 0x39, 0x51, 0x49, 0x47, 0x39,
-  0xdf, 0xc2, 0x6b, 0x39, 0xdd, 0x97, 0xa5, 0x39, 0x9b, 0xae, 0xed, 0x38,
-  0x05, 0x02, 0x44, 0x39, 0x08, 0xa1, 0x4e, 0x39, 0xc8, 0x40, 0x15, 0x39,
-  0xcf, 0x88, 0x3f, 0x39, 0x6a, 0xe2, 0x33, 0x39, 0x56, 0xff, 0x73, 0x39,
-  0xf1, 0xbe, 0x5d, 0x39, 0xe2, 0x12, 0x45, 0x39, 0x2c, 0xd3, 0x2e, 0x39,
-  0x82, 0xef, 0x45, 0x39, 0x7c, 0xf8, 0x46, 0x39, 0x45, 0x38, 0x7d, 0x39,
-  0x9a, 0xa2, 0x5e, 0x39, 0xa7, 0x2c, 0x53, 0x39, 0x48, 0x10, 0x5d, 0x39,
-  0x41, 0xd9, 0x84, 0x39, 0x3f, 0xd0, 0x7e, 0x39, 0x70, 0xf1, 0x2c, 0x39,
-  0xc4, 0x70, 0x4d, 0x39, 0xa8, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x36, 0x2f, 0x52, 0x65,
-  0x6c, 0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74,
-  0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x36, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64,
-  0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
-  0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32,
-  0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f,
-  0x33, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x92, 0xef, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x03, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xec, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x2d, 0xde, 0x06, 0x3c, 0x6e, 0x46, 0x2d, 0x3b,
-  0x5e, 0x60, 0xd3, 0x3b, 0x72, 0x7b, 0x9c, 0x3b, 0xf4, 0x56, 0x79, 0x3b,
-  0xb4, 0x5b, 0x4b, 0x3b, 0xad, 0xc6, 0x6c, 0x3b, 0x72, 0x06, 0xb9, 0x3b,
-  0x29, 0xba, 0xb3, 0x3b, 0x9f, 0x80, 0x6d, 0x3b, 0x0c, 0xb1, 0x3a, 0x3b,
-  0x4f, 0x04, 0x88, 0x3b, 0x19, 0xae, 0x85, 0x3b, 0x0e, 0x6e, 0xa8, 0x3b,
-  0xa6, 0xd9, 0xc4, 0x3b, 0xe5, 0xa3, 0xc7, 0x3b, 0xec, 0x8a, 0xd6, 0x3b,
-  0x82, 0x44, 0x29, 0x3c, 0x6f, 0x4f, 0xbf, 0x3b, 0xf9, 0x95, 0xd7, 0x3b,
-  0xf9, 0xf1, 0xd8, 0x3b, 0x99, 0x26, 0x08, 0x3c, 0x29, 0x66, 0x04, 0x3c,
-  0x6f, 0x16, 0x4b, 0x3d, 0xcc, 0x33, 0x26, 0x3b, 0x9e, 0x57, 0x5b, 0x3b,
-  0xe2, 0x0a, 0x4c, 0x3b, 0x1b, 0x57, 0xa6, 0x3b, 0xb0, 0xa6, 0x7e, 0x3c,
-  0x0d, 0x74, 0xad, 0x3b, 0x25, 0x12, 0x1e, 0x3c, 0x81, 0x9b, 0x8d, 0x3b,
-  0x6a, 0x59, 0xab, 0x3b, 0x01, 0x33, 0x4e, 0x3b, 0x4b, 0xc5, 0x71, 0x3b,
-  0x3d, 0x55, 0xb3, 0x3b, 0x70, 0xbb, 0xf4, 0x3a, 0x3b, 0xa2, 0x80, 0x3b,
-  0xc5, 0x38, 0x14, 0x3b, 0x21, 0x59, 0x85, 0x3c, 0x11, 0x96, 0xd0, 0x3b,
-  0xf9, 0xa4, 0x8b, 0x3b, 0x5c, 0x0f, 0xa0, 0x3b, 0xa0, 0x90, 0xd8, 0x3b,
-  0xa3, 0x46, 0x4b, 0x3c, 0x85, 0x4b, 0x78, 0x3b, 0x4a, 0xc7, 0x27, 0x3b,
-  0x29, 0x96, 0xa5, 0x3b, 0x21, 0xa1, 0xfa, 0x3b, 0x06, 0x8a, 0x64, 0x3c,
-  0x91, 0xcf, 0xe8, 0x3b, 0x07, 0x85, 0x96, 0x3b, 0x14, 0x0a, 0xf7, 0x3b,
-  0xec, 0xf6, 0x8d, 0x3b, 0x42, 0xaf, 0x8a, 0x3b, 0xad, 0x23, 0xa3, 0x3b,
-  0x3b, 0x0e, 0x8d, 0x3b, 0x1c, 0xf2, 0x59, 0x3b, 0x61, 0xe9, 0xbe, 0x3b,
-  0xbd, 0xd4, 0x90, 0x3b, 0x89, 0x51, 0x7e, 0x3b, 0xfd, 0x12, 0x86, 0x3b,
-  0x4a, 0x3b, 0xa1, 0x3b, 0x18, 0x89, 0x53, 0x3b, 0xb6, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
-  0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
-  0x6e, 0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61,
-  0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xaa, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xe8, 0x03, 0x00, 0x00, 0x1c, 0xf3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x46, 0x3e, 0xef, 0x39,
-  0xe5, 0xaf, 0x19, 0x39, 0x31, 0x7b, 0xbb, 0x39, 0xe5, 0xca, 0x8a, 0x39,
-  0x22, 0x27, 0x5d, 0x39, 0x92, 0x5e, 0x34, 0x39, 0x71, 0x02, 0x52, 0x39,
-  0xde, 0x1b, 0xa4, 0x39, 0xe7, 0x68, 0x9f, 0x39, 0x5e, 0xa7, 0x52, 0x39,
-  0x3e, 0x96, 0x25, 0x39, 0x09, 0x48, 0x71, 0x39, 0xde, 0x22, 0x6d, 0x39,
-  0xbd, 0x63, 0x95, 0x39, 0xdc, 0x98, 0xae, 0x39, 0x5c, 0x12, 0xb1, 0x39,
-  0x1e, 0x4a, 0xbe, 0x39, 0xf3, 0x21, 0x16, 0x3a, 0xf7, 0xae, 0xa9, 0x39,
-  0xfa, 0x36, 0xbf, 0x39, 0xa3, 0x6b, 0xc0, 0x39, 0xdd, 0x84, 0xf1, 0x39,
-  0x22, 0xdd, 0xea, 0x39, 0x22, 0x21, 0x34, 0x3b, 0xf2, 0x69, 0x13, 0x39,
-  0xe9, 0x8b, 0x42, 0x39, 0xf3, 0xf9, 0x34, 0x39, 0x44, 0x89, 0x93, 0x39,
-  0x27, 0xdd, 0x61, 0x3a, 0x5c, 0xd8, 0x99, 0x39, 0x9e, 0x33, 0x0c, 0x3a,
-  0xd9, 0x32, 0x7b, 0x39, 0x9d, 0xfa, 0x97, 0x39, 0xa7, 0xe3, 0x36, 0x39,
-  0x84, 0x70, 0x56, 0x39, 0x64, 0x0f, 0x9f, 0x39, 0xf4, 0x10, 0xd9, 0x38,
-  0x36, 0x2f, 0x64, 0x39, 0x46, 0x77, 0x03, 0x39, 0x24, 0x8c, 0x6c, 0x3a,
-  0xa3, 0x01, 0xb9, 0x39, 0x67, 0xb7, 0x77, 0x39, 0x44, 0xf7, 0x8d, 0x39,
-  0x4b, 0x15, 0xc0, 0x39, 0xe3, 0x4b, 0x34, 0x3a, 0xee, 0x39, 0x5c, 0x39,
-  0xd3, 0xcf, 0x14, 0x39, 0x21, 0xde, 0x92, 0x39, 0xfb, 0x4b, 0xde, 0x39,
-  0x2a, 0xb4, 0x4a, 0x3a, 0x16, 0x7e, 0xce, 0x39, 0x08, 0x81, 0x85, 0x39,
-  0xd3, 0x1c, 0xdb, 0x39, 0x03, 0xd5, 0x7b, 0x39, 0x87, 0x03, 0x76, 0x39,
-  0x78, 0xb2, 0x90, 0x39, 0x3e, 0x38, 0x7a, 0x39, 0xd2, 0x4e, 0x41, 0x39,
-  0x73, 0x54, 0xa9, 0x39, 0x5e, 0x75, 0x80, 0x39, 0xa1, 0x91, 0x61, 0x39,
-  0xd6, 0xd5, 0x6d, 0x39, 0x4a, 0x01, 0x8f, 0x39, 0x50, 0x9f, 0x3b, 0x39,
-  0xc9, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x37, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x37, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x63,
-  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x33, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xb2, 0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x34, 0x03, 0x00, 0x00, 0x24, 0xf7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xeb, 0xf2, 0x9c, 0x3b,
-  0xcd, 0xee, 0x59, 0x3b, 0xfb, 0x82, 0x3b, 0x3b, 0x51, 0xe9, 0x4e, 0x3b,
-  0x4d, 0xd5, 0x57, 0x3b, 0x47, 0x0f, 0xba, 0x3b, 0x6e, 0xcb, 0x70, 0x3b,
-  0x81, 0x64, 0x9e, 0x3b, 0xee, 0x00, 0x66, 0x3b, 0xc3, 0x68, 0x26, 0x3b,
-  0x44, 0x0f, 0xb3, 0x3b, 0x67, 0x4a, 0x82, 0x3b, 0xb0, 0x10, 0x5e, 0x3b,
-  0xd7, 0xce, 0x91, 0x3b, 0xe5, 0x0c, 0x5d, 0x3b, 0x86, 0xaf, 0x95, 0x3b,
-  0x96, 0x0e, 0x50, 0x3b, 0x05, 0x63, 0x59, 0x3b, 0xb0, 0xb8, 0xa8, 0x3b,
-  0x78, 0xfa, 0x6e, 0x3b, 0x7a, 0x67, 0x77, 0x3b, 0x92, 0x12, 0x81, 0x3b,
-  0x18, 0x2c, 0x81, 0x3b, 0xf0, 0xb5, 0x4a, 0x3b, 0x8f, 0xf8, 0x8f, 0x3b,
-  0x05, 0xde, 0x44, 0x3b, 0x4e, 0xd7, 0x70, 0x3b, 0x1a, 0x3e, 0x2a, 0x3b,
-  0x90, 0x0e, 0xab, 0x3b, 0x05, 0xf4, 0x87, 0x3b, 0xb3, 0xe1, 0x4b, 0x3b,
-  0xce, 0xfe, 0x4d, 0x3b, 0xa0, 0x78, 0x1a, 0x3b, 0xd1, 0xb6, 0x4a, 0x3b,
-  0x88, 0x01, 0x4b, 0x3b, 0x0c, 0x29, 0x82, 0x3b, 0x82, 0x3b, 0x99, 0x3b,
-  0x8c, 0x43, 0x50, 0x3b, 0x7a, 0x45, 0x5f, 0x3b, 0xf2, 0x62, 0x68, 0x3b,
-  0x4c, 0x92, 0x60, 0x3b, 0xb0, 0x1b, 0x50, 0x3b, 0xaa, 0xac, 0x5d, 0x3b,
-  0xfd, 0x9e, 0x6e, 0x3b, 0x89, 0x47, 0x51, 0x3b, 0xd6, 0xf2, 0x51, 0x3b,
-  0x9f, 0x61, 0x39, 0x3b, 0xbe, 0xcc, 0x8f, 0x3b, 0xd8, 0x9c, 0x9a, 0x3b,
-  0x4c, 0xcf, 0x78, 0x3b, 0xac, 0x10, 0x62, 0x3b, 0x0f, 0x4b, 0x52, 0x3b,
-  0x45, 0xad, 0x26, 0x3b, 0x10, 0x19, 0xba, 0x3b, 0x35, 0xf4, 0x4c, 0x3b,
-  0x41, 0xa4, 0x4c, 0x3b, 0x6d, 0xb5, 0x67, 0x3b, 0x07, 0xf6, 0xbb, 0x3b,
-  0x31, 0xf5, 0x5d, 0x3b, 0x7f, 0x9a, 0x39, 0x3b, 0x82, 0x5b, 0x87, 0x3b,
-  0x67, 0x58, 0x4a, 0x3b, 0x3b, 0xa9, 0x20, 0x3b, 0x23, 0x0d, 0x49, 0x3b,
-  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f,
-  0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x12, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x24, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xb0, 0x03, 0x00, 0x00, 0x84, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xbd, 0x63, 0x0e, 0x3a,
-  0x64, 0xb7, 0xc5, 0x39, 0x01, 0x1e, 0xaa, 0x39, 0xa4, 0xb7, 0xbb, 0x39,
-  0xc1, 0xcf, 0xc3, 0x39, 0xc8, 0xcc, 0x28, 0x3a, 0x1b, 0x75, 0xda, 0x39,
-  0x0a, 0xb3, 0x0f, 0x3a, 0xde, 0xaa, 0xd0, 0x39, 0xec, 0xf8, 0x96, 0x39,
-  0x02, 0x73, 0x22, 0x3a, 0x98, 0x68, 0xec, 0x39, 0x25, 0x77, 0xc9, 0x39,
-  0x3b, 0x48, 0x04, 0x3a, 0x73, 0x8b, 0xc8, 0x39, 0xd4, 0xcc, 0x07, 0x3a,
-  0xb5, 0xc1, 0xbc, 0x39, 0x94, 0x38, 0xc5, 0x39, 0xf0, 0x11, 0x19, 0x3a,
-  0x46, 0xcf, 0xd8, 0x39, 0x30, 0x74, 0xe0, 0x39, 0xc8, 0x32, 0xea, 0x39,
-  0x18, 0x61, 0xea, 0x39, 0x05, 0xe8, 0xb7, 0x39, 0x94, 0x9d, 0x02, 0x3a,
-  0xdf, 0x9a, 0xb2, 0x39, 0xe1, 0x7f, 0xda, 0x39, 0x3a, 0x73, 0x9a, 0x39,
-  0x5a, 0x30, 0x1b, 0x3a, 0xe1, 0xae, 0xf6, 0x39, 0xf9, 0xf7, 0xb8, 0x39,
-  0xe2, 0xe2, 0xba, 0x39, 0x49, 0x24, 0x8c, 0x39, 0xd1, 0xe8, 0xb7, 0x39,
-  0x9a, 0x2c, 0xb8, 0x39, 0x12, 0x2c, 0xec, 0x39, 0x96, 0x04, 0x0b, 0x3a,
-  0xc1, 0xf1, 0xbc, 0x39, 0x4a, 0x8f, 0xca, 0x39, 0x4b, 0xd4, 0xd2, 0x39,
-  0x3c, 0xbd, 0xcb, 0x39, 0x98, 0xcd, 0xbc, 0x39, 0x66, 0x1c, 0xc9, 0x39,
-  0x48, 0x7c, 0xd8, 0x39, 0xa0, 0xdd, 0xbd, 0x39, 0x09, 0x79, 0xbe, 0x39,
-  0x3c, 0x2f, 0xa8, 0x39, 0xd3, 0x75, 0x02, 0x3a, 0x25, 0x45, 0x0c, 0x3a,
-  0xa2, 0xba, 0xe1, 0x39, 0x24, 0x18, 0xcd, 0x39, 0x13, 0xc9, 0xbe, 0x39,
-  0x13, 0x37, 0x97, 0x39, 0xa9, 0xd5, 0x28, 0x3a, 0x04, 0xf1, 0xb9, 0x39,
-  0x7b, 0xa8, 0xb9, 0x39, 0xdf, 0x36, 0xd2, 0x39, 0x61, 0x86, 0x2a, 0x3a,
-  0x33, 0x5e, 0xc9, 0x39, 0xd6, 0x62, 0xa8, 0x39, 0x27, 0x9a, 0xf5, 0x39,
-  0x29, 0x93, 0xb7, 0x39, 0xe5, 0xc1, 0x91, 0x39, 0xa0, 0x66, 0xb6, 0x39,
-  0x92, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x72, 0x65,
-  0x5f, 0x6c, 0x75, 0x5f, 0x38, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e,
-  0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x5f, 0x38, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f, 0x42,
-  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34,
-  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x5f, 0x34, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xe2, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x3c, 0x00, 0x00, 0x00, 0x54, 0xfe, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x21, 0xf9, 0x8c, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x4d, 0x61, 0x74, 0x4d,
-  0x75, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x00, 0xb4, 0xfe, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x7b, 0xb5, 0x36, 0x3a, 0x22, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff,
-  0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66,
-  0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x5f, 0x31, 0x2f, 0x52,
-  0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00,
-  0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x2f, 0x74, 0x66,
-  0x2e, 0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x2f, 0x52, 0x65, 0x73,
-  0x68, 0x61, 0x70, 0x65, 0x2f, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
-  0x20, 0x00, 0x1c, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xa8, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xc3, 0x3d,
-  0x17, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
-  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x3a, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xa8, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
-  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-  0xd0, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xe0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0xff, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x16
-};
-unsigned int sed_glass_breaking_ds_cnn_quantized_tflite_len = 48688;
-const char *sed_glass_breaking_labels[] = {
-  "_silence_",
-  "_unknown_",
-  "glass_breaking",
-};
-unsigned int sed_glass_breaking_labels_num = 3;
-const unsigned char *sed_glass_breaking_model_ptr = sed_glass_breaking_ds_cnn_quantized_tflite;
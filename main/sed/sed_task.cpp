@@ -1,27 +1,25 @@
 #include "sed_task.h"
 #include "audio_preprocessor.h"
+#include "nn_engine.h"
+#include "static_audio_preprocessor.h"
 #include "i2s_rx_slot.h"
 #include "mic_reader.h"
 
 #include "freertos/FreeRTOS.h"
-#include "freertos/event_groups.h"
 #include "freertos/queue.h"
-#include "freertos/ringbuf.h"
-#include "freertos/semphr.h"
-#include "freertos/stream_buffer.h"
 #include "freertos/task.h"
 
 #include "esp_agc.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 
-static const char *TAG = "sed_task";
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
-#define SED_EVENT_START_MSK BIT0
-#define SED_EVENT_STOP_MSK  BIT1
-#define SED_STATUS_BUSY_MSK BIT2
+static const char *TAG = "sed_task";
 
-#define MFCC_DATA_FRAME_SZ  (SED_NUM_FBANK_BINS * sizeof(float))
+#define MFCC_DATA_FRAME_SZ  (SED_NUM_FBANK_BINS * sizeof(int8_t))
 #define MFCC_DATA_BUFFER_SZ (MFCC_DATA_FRAME_SZ * SED_FRAME_NUM)
 
 #define SED_FRAME_SZ          SED_FRAME_LEN *ELEM_BYTES
@@ -30,23 +28,114 @@ static const char *TAG = "sed_task";
 #define AGC_FRAME_LEN_MS 10
 #define AGC_FRAME_LEN    (CONFIG_SAMPLE_RATE / 1000 * AGC_FRAME_LEN_MS)
 
-#define SED_WINDOW  3
-#define REQ_CAT_IDX 2
+#define SED_PROFILER_DUMP_WINDOWS 500
+#define SED_GATE_STATS_WINDOWS    500
+
+#if CONFIG_SED_STREAMING
+// Streaming models need every step: all of them run on each, pp_task waits
+// for the engines up to the next frame. A step dropped all the same resets
+// the states of the engine's models.
+#define SED_INFERENCE_BUDGET_US 0
+#define SED_BUFFER_WAIT         pdMS_TO_TICKS(SED_STRIDE_MS)
+#else
+#define SED_INFERENCE_BUDGET_US (CONFIG_SED_INFERENCE_BUDGET_MS * 1000)
+#define SED_BUFFER_WAIT         0
+#endif
+
+#if CONFIG_SED_IN_PLACE_INPUT
+// A single model gets the window straight into its input tensor, windows
+// arriving while it runs are dropped as when both buffers are busy.
+#define SED_IN_PLACE 1
+#else
+#define SED_IN_PLACE 0
+#endif
+
+#if CONFIG_PREPROCESSING_FIXED_POINT
+typedef AudioPreprocessor sed_preprocessor_t;
+#else
+typedef StaticAudioPreprocessor<SED_FRAME_LEN, SED_NUM_FBANK_BINS, 0,
+                                SED_MEL_LOW_FREQ, SED_MEL_HIGH_FREQ>
+  sed_preprocessor_t;
+#endif
 
 QueueHandle_t xSEDResultQueue = NULL;
-static StreamBufferHandle_t xSEDFramesBuffer = NULL;
-static EventGroupHandle_t xSEDEventGroup = NULL;
+// Completed windows of all the engines.
+static QueueHandle_t xSEDEngineResultQueue = NULL;
 
 static void *s_agc_handle = NULL;
 
 static TaskHandle_t xPPTaskHandle = NULL;
 static TaskHandle_t xSEDTaskHandle = NULL;
-static AudioPreprocessor *pp = NULL;
+static sed_preprocessor_t *pp = NULL;
+static AudioPreprocessor::QuantParams s_input_quant;
+// Frames of a request: the window, or the step of streaming models.
+static size_t s_request_frames = SED_FRAME_NUM;
+
+struct sed_model_state_t {
+  sed_model_conf_t conf;
+  // One bit per result of the aggregation window, set on detections.
+  uint32_t history;
+  uint8_t trig;
+};
+
+static sed_model_state_t s_models[SED_MODELS_MAX];
+static size_t s_models_num = 0;
+// Engine w runs the models SED_MODEL_WORKER maps to w, on its own core with
+// SED_DUAL_CORE.
+static nn_engine_handle_t s_engines[SED_WORKERS_NUM] = {NULL};
+static size_t s_engines_num = 0;
+
+#if CONFIG_SED_GATE
+// Log-mel features are natural logs of mel band magnitudes, the gate score
+// is their mean in dB.
+static float s_gate_weights[SED_NUM_FBANK_BINS];
+
+static int set_gates() {
+  std::fill(s_gate_weights, s_gate_weights + SED_NUM_FBANK_BINS,
+            20.f / logf(10.f) / SED_NUM_FBANK_BINS);
+  const nn_model_gate_t gate = {.model = NULL,
+                                .category = 0,
+                                .weights = s_gate_weights,
+                                .features_num = SED_NUM_FBANK_BINS,
+                                .bias = 0,
+                                .threshold = CONFIG_SED_GATE_LEVEL_DB};
+  for (size_t i = 0; i < s_models_num; i++) {
+    if (nn_model_set_gate(s_models[i].conf.model_handle, &gate) < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void log_gate_stats() {
+  for (size_t i = 0; i < s_models_num; i++) {
+    nn_model_gate_stats_t stats;
+    if (nn_model_get_gate_stats(s_models[i].conf.model_handle, &stats) < 0 ||
+        !stats.windows) {
+      continue;
+    }
+    ESP_LOGI(TAG, "model %d gate: %u of %u windows passed (%.1f%%)", i,
+             stats.passed, stats.windows, 100.f * stats.passed / stats.windows);
+  }
+}
+#endif
+
+// Copy the last n frames of the ring buffer up to frame_counter, oldest
+// first.
+static void copy_frames(int8_t *dst, const int8_t *mfcc_buffer,
+                        size_t frame_counter, size_t n) {
+  const size_t first = (frame_counter + 1 + SED_FRAME_NUM - n) % SED_FRAME_NUM;
+  const size_t head = std::min(n, SED_FRAME_NUM - first);
+  memcpy(dst, &mfcc_buffer[first * SED_NUM_FBANK_BINS],
+         head * MFCC_DATA_FRAME_SZ);
+  memcpy(&dst[head * SED_NUM_FBANK_BINS], mfcc_buffer,
+         (n - head) * MFCC_DATA_FRAME_SZ);
+}
 
 static void pp_task(void *pv) {
-  AudioPreprocessor *preprocessor = static_cast<AudioPreprocessor *>(pv);
+  sed_preprocessor_t *preprocessor = static_cast<sed_preprocessor_t *>(pv);
   uint8_t proc_frame[SED_FRAME_SZ] = {0};
-  float mfcc_buffer[SED_FEATURES_LEN] = {0};
+  int8_t mfcc_buffer[SED_FEATURES_LEN] = {0};
 
   audio_t *proc_buf = (audio_t *)&proc_frame[0];
   audio_t *half_proc_buf = (audio_t *)&proc_frame[SED_FRAME_SHIFT_BYTES];
@@ -58,6 +147,7 @@ static void pp_task(void *pv) {
   }
 
   size_t frame_counter = 0;
+  size_t dropped = 0;
   for (;;) {
     for (size_t i = 0; i < SED_FRAME_SHIFT / AGC_FRAME_LEN; i++) {
       audio_t *ptr = &half_proc_buf[i * AGC_FRAME_LEN];
@@ -72,7 +162,7 @@ static void pp_task(void *pv) {
 
     preprocessor->LogMelCompute(
       (audio_t *)proc_frame, &mfcc_buffer[current_frame * SED_NUM_FBANK_BINS],
-      1 << 15);
+      1 << 15, s_input_quant);
 
     memmove(proc_frame, half_proc_buf, SED_FRAME_SHIFT_BYTES);
     memset(half_proc_buf, 0, SED_FRAME_SHIFT_BYTES);
@@ -80,66 +170,105 @@ static void pp_task(void *pv) {
     ESP_LOGV(TAG, "pp_frame: %d(%d), %lld us", current_frame, frame_counter,
              esp_timer_get_time() - t1);
 
-    if ((frame_counter + 1) >= SED_FRAME_NUM) {
-      if (!(xEventGroupGetBits(xSEDEventGroup) & SED_STATUS_BUSY_MSK)) {
-        for (size_t k = 1; k <= SED_FRAME_NUM; k++) {
-          const size_t frame_num = (frame_counter + k) % SED_FRAME_NUM;
-          void *frame_ptr =
-            (void *)&mfcc_buffer[frame_num * SED_NUM_FBANK_BINS];
-
-          const auto xBytesSent = xStreamBufferSend(xSEDFramesBuffer, frame_ptr,
-                                                    MFCC_DATA_FRAME_SZ, 0);
-          if (xBytesSent < MFCC_DATA_FRAME_SZ) {
-            ESP_LOGW(TAG, "xSEDFramesBuffer: xBytesSent=%d (%d)", xBytesSent,
-                     MFCC_DATA_FRAME_SZ);
-          }
+#if CONFIG_SED_STREAMING
+    const bool send = (frame_counter + 1) % s_request_frames == 0;
+#else
+    const bool send = (frame_counter + 1) >= SED_FRAME_NUM;
+#endif
+    if (send) {
+      // The engines share the wait, the next frame does not wait for them.
+      const TickType_t start = xTaskGetTickCount();
+      for (size_t w = 0; w < s_engines_num; w++) {
+        const TickType_t waited = xTaskGetTickCount() - start;
+        // The engine still has both buffers, it falls behind the frames.
+        int8_t *window = static_cast<int8_t *>(nn_engine_get_buffer(
+          s_engines[w],
+          SED_BUFFER_WAIT - std::min<TickType_t>(waited, SED_BUFFER_WAIT)));
+        if (!window) {
+          ESP_LOGW(TAG, "engine %d busy, dropped window %d (%d dropped)", w,
+                   frame_counter, ++dropped);
+#if CONFIG_SED_STREAMING
+          // The stream has a gap, its models start over on the next step.
+          nn_engine_reset_state(s_engines[w]);
+#endif
+          continue;
         }
-        ESP_LOGV(TAG, "sent frames: [%d; %d]", frame_counter - SED_FRAME_NUM,
-                 frame_counter);
+        copy_frames(window, mfcc_buffer, frame_counter, s_request_frames);
+        nn_engine_submit(s_engines[w], window, NULL);
       }
-      ESP_LOGV(TAG, "skipped frame: %d", frame_counter);
+      ESP_LOGV(TAG, "sent frames: [%d; %d]", frame_counter - s_request_frames,
+               frame_counter);
     }
 
     frame_counter++;
   }
 }
 
-void sed_task(void *pv) {
-  nn_model_handle_t model_handle = static_cast<nn_model_handle_t>(pv);
-  float mfcc_buffer[SED_FEATURES_LEN] = {0};
+// Detection with hysteresis: trigger once detect_count of the last window
+// results are detections, rearm when none is.
+static void aggregate(size_t idx, int category) {
+  sed_model_state_t *model = &s_models[idx];
+
+  const uint32_t mask = model->conf.window < 32
+                          ? (1u << model->conf.window) - 1
+                          : UINT32_MAX;
+  model->history = ((model->history << 1) |
+                    (category == model->conf.category)) &
+                   mask;
+  const size_t num_det = __builtin_popcount(model->history);
+
+  if (!model->trig) {
+    if (num_det >= model->conf.detect_count) {
+      model->trig = 1;
+      const sed_result_t result = {.model = idx, .category = category};
+      xQueueSend(xSEDResultQueue, &result, 0);
+    }
+  } else if (num_det == 0) {
+    model->trig = 0;
+  }
+}
 
-  int cats_buffer[SED_WINDOW] = {-1};
-  size_t num_det = 0;
-  uint8_t trig = 0;
+void sed_task(void *pv) {
+  size_t windows = 0;
   i2s_rx_slot_start();
-  for (size_t counter = 0;; counter++) {
-    const auto xReceivedBytes = xStreamBufferReceive(
-      xSEDFramesBuffer, mfcc_buffer, MFCC_DATA_BUFFER_SZ, portMAX_DELAY);
-    ESP_LOGV(TAG, "recv bytes=%d", xReceivedBytes);
-
-    xEventGroupSetBits(xSEDEventGroup, SED_STATUS_BUSY_MSK);
-    int category = -1;
-    if (nn_model_inference(model_handle, mfcc_buffer, SED_FEATURES_LEN,
-                           &category) < 0) {
-      ESP_LOGE(TAG, "inference error");
-      continue;
+  for (;;) {
+    nn_engine_result_t result;
+    xQueueReceive(xSEDEngineResultQueue, &result, portMAX_DELAY);
+    const size_t worker =
+      std::find(s_engines, s_engines + s_engines_num, result.engine) -
+      s_engines;
+    ESP_LOGV(TAG, "engine %d: window %u, %lld us", worker, result.request_id,
+             result.latency_us);
+
+    for (size_t i = 0; i < result.models_num; i++) {
+      const nn_engine_model_result_t &model = result.models[i];
+      const size_t idx = worker + model.model * SED_WORKERS_NUM;
+      if (model.scores_num) {
+        const float *best =
+          std::max_element(model.scores, model.scores + model.scores_num);
+        ESP_LOGD(TAG, "model %d: top=%d, score=%.2f", idx,
+                 best - model.scores, *best);
+      }
+      aggregate(idx, model.category);
     }
-    num_det += category == REQ_CAT_IDX;
-    cats_buffer[counter % SED_WINDOW] = category;
 
-    if (!trig) {
-      if (num_det == SED_WINDOW) {
-        trig = 1;
-        xQueueSend(xSEDResultQueue, &category, 0);
-      }
-    } else {
-      if (num_det == 0) {
-        trig = 0;
+    if (worker == 0) {
+      windows++;
+    }
+#if CONFIG_SED_GATE
+    if (worker == 0 && windows % SED_GATE_STATS_WINDOWS == 0) {
+      log_gate_stats();
+    }
+#endif
+#if CONFIG_NN_MODEL_PROFILER
+    if (worker == 0 && windows % SED_PROFILER_DUMP_WINDOWS == 0) {
+      for (size_t i = 0; i < s_models_num; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "sed[%d]", i);
+        nn_model_profiler_dump(s_models[i].conf.model_handle, name, false);
       }
     }
-    num_det -= cats_buffer[(counter + 1) % SED_WINDOW] == REQ_CAT_IDX;
-
-    xEventGroupClearBits(xSEDEventGroup, SED_STATUS_BUSY_MSK);
+#endif
   }
 }
 
@@ -148,6 +277,55 @@ int sed_task_init(sed_task_conf_t conf) {
            "MFCC_DATA_FRAME_SZ=%d, MFCC_DATA_BUFFER_SZ=%d, SED_FEATURES_LEN=%d",
            MFCC_DATA_FRAME_SZ, MFCC_DATA_BUFFER_SZ, SED_FEATURES_LEN);
 
+  if (conf.models_num == 0 || conf.models_num > SED_MODELS_MAX) {
+    ESP_LOGE(TAG, "Unsupported number of SED models %d", conf.models_num);
+    return -1;
+  }
+  s_models_num = conf.models_num;
+  for (size_t i = 0; i < s_models_num; i++) {
+    sed_model_state_t *model = &s_models[i];
+    *model = sed_model_state_t{};
+    model->conf = conf.models[i];
+    // Streaming models start a new stream.
+    if (nn_model_reset_state(model->conf.model_handle) < 0) {
+      return -1;
+    }
+  }
+  // Windows are quantized for the first model, the engines requantize them
+  // for the others, their own first model included.
+  float scale = 0;
+  int zero_point = 0;
+  nn_model_tensor_t input;
+  if (nn_model_get_input_quant(s_models[0].conf.model_handle, &scale,
+                               &zero_point) < 0 ||
+      nn_model_get_input(s_models[0].conf.model_handle, &input) < 0) {
+    ESP_LOGE(TAG, "SED model input must be int8");
+    return -1;
+  }
+#if CONFIG_SED_STREAMING
+  s_request_frames = input.bytes / MFCC_DATA_FRAME_SZ;
+  if (input.bytes % MFCC_DATA_FRAME_SZ || !s_request_frames ||
+      s_request_frames > SED_FRAME_NUM) {
+    ESP_LOGE(TAG, "SED streaming model input must be up to %d frames of %d",
+             SED_FRAME_NUM, MFCC_DATA_FRAME_SZ);
+    return -1;
+  }
+  ESP_LOGI(TAG, "streaming models, %d frames per step", s_request_frames);
+#else
+  if (input.bytes != MFCC_DATA_BUFFER_SZ) {
+    ESP_LOGE(TAG, "SED model input must be %d int8", MFCC_DATA_BUFFER_SZ);
+    return -1;
+  }
+#endif
+  s_input_quant.scale = scale;
+  s_input_quant.zeroPoint = zero_point;
+#if CONFIG_SED_GATE
+  if (set_gates() < 0) {
+    ESP_LOGE(TAG, "Error setting SED gates");
+    return -1;
+  }
+#endif
+
   s_agc_handle = esp_agc_open(3, CONFIG_SAMPLE_RATE);
   if (!s_agc_handle) {
     ESP_LOGE(TAG, "Unable to create agc");
@@ -155,26 +333,55 @@ int sed_task_init(sed_task_conf_t conf) {
   }
   set_agc_config(s_agc_handle, conf.mic_gain, 1, 0);
 
-  xSEDFramesBuffer =
-    xStreamBufferCreate(MFCC_DATA_BUFFER_SZ, MFCC_DATA_BUFFER_SZ);
-  if (xSEDFramesBuffer == NULL) {
-    ESP_LOGE(TAG, "Error creating sed frames buffer");
-    return -1;
-  }
-  xSEDResultQueue = xQueueCreate(1, sizeof(int));
+  xSEDResultQueue = xQueueCreate(SED_MODELS_MAX, sizeof(sed_result_t));
   if (xSEDResultQueue == NULL) {
     ESP_LOGE(TAG, "Error creating SED result queue");
     return -1;
   }
 
-  xSEDEventGroup = xEventGroupCreate();
-  if (xSEDEventGroup == NULL) {
-    ESP_LOGE(TAG, "Error creating xSEDEventGroup");
+  // Each engine has at most both of its windows in flight.
+  xSEDEngineResultQueue =
+    xQueueCreate(2 * SED_WORKERS_NUM, sizeof(nn_engine_result_t));
+  if (xSEDEngineResultQueue == NULL) {
+    ESP_LOGE(TAG, "Error creating SED engine result queue");
     return -1;
   }
 
-  pp = new AudioPreprocessor(10, SED_FRAME_LEN, SED_NUM_FBANK_BINS,
-                             SED_MEL_LOW_FREQ, SED_MEL_HIGH_FREQ);
+  // The first engine stays unpinned with pp_task and sed_task, the second
+  // takes the other core than the one running the app.
+  s_engines_num = std::min<size_t>(s_models_num, SED_WORKERS_NUM);
+  for (size_t w = 0; w < s_engines_num; w++) {
+    nn_engine_config_t engine_conf = {
+      .models_num = 0,
+      .input_scale = s_input_quant.scale,
+      .input_zero_point = s_input_quant.zeroPoint,
+      .float_input = false,
+      .in_place = SED_IN_PLACE && s_models_num == 1,
+      .budget_us = SED_INFERENCE_BUDGET_US,
+      .core_id = w ? !xPortGetCoreID() : tskNO_AFFINITY,
+      .priority = 1,
+      .result_queue = xSEDEngineResultQueue};
+    for (size_t i = w; i < s_models_num; i += SED_WORKERS_NUM) {
+      engine_conf.models[engine_conf.models_num++] =
+        s_models[i].conf.model_handle;
+    }
+    if (nn_engine_create(&s_engines[w], engine_conf) < 0) {
+      ESP_LOGE(TAG, "Error creating SED engine %d", w);
+      return -1;
+    }
+  }
+
+#if CONFIG_PREPROCESSING_FIXED_POINT
+  pp = new AudioPreprocessor(0, SED_FRAME_LEN, SED_NUM_FBANK_BINS,
+                             SED_MEL_LOW_FREQ, SED_MEL_HIGH_FREQ,
+                             AudioPreprocessor::Arithmetic::Fixed);
+#else
+  pp = new sed_preprocessor_t();
+#endif
+  if (!pp->IsReady()) {
+    ESP_LOGE(TAG, "Error initializing the SED preprocessor");
+    return -1;
+  }
   auto xReturned =
     xTaskCreate(pp_task, "pp_task", configMINIMAL_STACK_SIZE + 1024 * 10, pp, 1,
                 &xPPTaskHandle);
@@ -184,7 +391,7 @@ int sed_task_init(sed_task_conf_t conf) {
   }
   xReturned =
     xTaskCreate(sed_task, "sed_task", configMINIMAL_STACK_SIZE + 1024 * 10,
-                conf.model_handle, 1, &xSEDTaskHandle);
+                NULL, 1, &xSEDTaskHandle);
   if (xReturned != pdPASS) {
     ESP_LOGE(TAG, "Error creating sed_task");
     return -1;
@@ -199,18 +406,10 @@ void sed_task_release() {
     esp_agc_close(s_agc_handle);
     s_agc_handle = NULL;
   }
-  if (xSEDFramesBuffer) {
-    vStreamBufferDelete(xSEDFramesBuffer);
-    xSEDFramesBuffer = NULL;
-  }
   if (xSEDResultQueue) {
     vQueueDelete(xSEDResultQueue);
     xSEDResultQueue = NULL;
   }
-  if (xSEDEventGroup) {
-    vEventGroupDelete(xSEDEventGroup);
-    xSEDEventGroup = NULL;
-  }
   if (xPPTaskHandle) {
     vTaskDelete(xPPTaskHandle);
     xPPTaskHandle = NULL;
@@ -219,6 +418,16 @@ void sed_task_release() {
     vTaskDelete(xSEDTaskHandle);
     xSEDTaskHandle = NULL;
   }
+  for (size_t w = 0; w < SED_WORKERS_NUM; w++) {
+    nn_engine_release(s_engines[w]);
+    s_engines[w] = NULL;
+  }
+  s_engines_num = 0;
+  if (xSEDEngineResultQueue) {
+    vQueueDelete(xSEDEngineResultQueue);
+    xSEDEngineResultQueue = NULL;
+  }
+  s_models_num = 0;
   if (pp) {
     delete pp;
   }
@@ -19,11 +19,42 @@
 
 #define SED_FEATURES_LEN SED_FRAME_NUM *SED_NUM_FBANK_BINS
 
+/*! \brief Maximum number of models in the SED bank. */
+#define SED_MODELS_MAX 4
+
+#if CONFIG_SED_DUAL_CORE
+#define SED_WORKERS_NUM 2
+#else
+#define SED_WORKERS_NUM 1
+#endif
+/*! \brief Worker running model idx: models are dealt to workers in turn. */
+#define SED_MODEL_WORKER(idx) ((idx) % SED_WORKERS_NUM)
+
+/*! \brief Detection reported to xSEDResultQueue. */
+struct sed_result_t {
+  /*! Index of the model in sed_task_conf_t::models. */
+  size_t model;
+  int category;
+};
+
 /*! \brief Global SED result queue. */
 extern QueueHandle_t xSEDResultQueue;
 
-struct sed_task_conf_t {
+/*!
+ * \brief A model of the bank. It is detected when at least detect_count of
+ * its last window results are category.
+ */
+struct sed_model_conf_t {
   nn_model_handle_t model_handle;
+  int category;
+  /*! Aggregation length, up to 32 results. */
+  size_t window;
+  size_t detect_count;
+};
+
+struct sed_task_conf_t {
+  sed_model_conf_t models[SED_MODELS_MAX];
+  size_t models_num;
   int mic_gain;
 };
 
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+"""Fuse the depthwise-separable blocks of an int8 .tflite model.
+
+Each DepthwiseConv2D with depth multiplier 1, optionally followed by a ReLU,
+then a 1x1 Conv2D, optionally followed by a ReLU, becomes one
+GRC_DS_CONV_BLOCK custom op (components/nn_model/ds_conv_block.h) when the
+intermediate tensors have no other consumer. A ReLU op is only folded when
+its input and output share their quantization, the fused op then gives the
+same results bit for bit.
+
+    fuse_ds_conv.py main/sed/sed_model_bark.tflite sed_model_bark.tflite
+
+Needs the tensorflow Python package for the .tflite schema.
+"""
+
+import argparse
+import struct
+import sys
+
+from tensorflow.lite.python import schema_py_generated as schema
+from tensorflow.lite.tools import flatbuffer_utils
+
+OP_NAME = "GRC_DS_CONV_BLOCK"
+OPTIONS_VERSION = 1
+
+Op = schema.BuiltinOperator
+Act = schema.ActivationFunctionType
+
+
+def builtin_code(model, op):
+    code = model.operatorCodes[op.opcodeIndex]
+    return max(code.builtinCode, code.deprecatedBuiltinCode)
+
+
+def same_quant(a, b):
+    qa, qb = a.quantization, b.quantization
+    return (qa is not None and qb is not None and
+            list(qa.scale) == list(qb.scale) and
+            list(qa.zeroPoint) == list(qb.zeroPoint))
+
+
+def merge_activation(a, b):
+    """Activation equivalent to a then b, None if the kernel lacks it."""
+    acts = {a, b}
+    if not acts <= {Act.NONE, Act.RELU, Act.RELU6}:
+        return None
+    if Act.RELU6 in acts:
+        return Act.RELU6
+    return Act.RELU if Act.RELU in acts else Act.NONE
+
+
+class Graph:
+    def __init__(self, model):
+        self.model = model
+        self.graph = model.subgraphs[0]
+        self.consumers = {}
+        for i, op in enumerate(self.graph.operators):
+            for t in op.inputs:
+                self.consumers.setdefault(t, []).append(i)
+        self.outputs = set(self.graph.outputs)
+
+    def tensor(self, idx):
+        return self.graph.tensors[idx]
+
+    def sole_consumer(self, tensor):
+        consumers = self.consumers.get(tensor, [])
+        if tensor in self.outputs or len(consumers) != 1:
+            return None
+        return consumers[0]
+
+    def fold_relu(self, tensor, activation, chain):
+        """Follow tensor through a ReLU keeping its quantization."""
+        idx = self.sole_consumer(tensor)
+        if idx is None:
+            return tensor, activation
+        op = self.graph.operators[idx]
+        if (builtin_code(self.model, op) != Op.RELU or
+                not same_quant(self.tensor(tensor),
+                               self.tensor(op.outputs[0]))):
+            return tensor, activation
+        chain.append(idx)
+        return op.outputs[0], merge_activation(activation, Act.RELU)
+
+    def match(self, idx):
+        """Fused op replacing the block starting at op idx, and its ops."""
+        dw = self.graph.operators[idx]
+        if builtin_code(self.model, dw) != Op.DEPTHWISE_CONV_2D:
+            return None
+        dw_opts = dw.builtinOptions
+        src = self.tensor(dw.inputs[0])
+        mid = self.tensor(dw.outputs[0])
+        if (src.type != schema.TensorType.INT8 or
+                mid.quantization is None or len(mid.quantization.scale) != 1 or
+                self.tensor(dw.inputs[1]).shape[3] != src.shape[3]):
+            return None
+
+        chain = [idx]
+        tensor, dw_act = self.fold_relu(dw.outputs[0],
+                                        dw_opts.fusedActivationFunction,
+                                        chain)
+        conv_idx = self.sole_consumer(tensor)
+        if conv_idx is None:
+            return None
+        conv = self.graph.operators[conv_idx]
+        if builtin_code(self.model, conv) != Op.CONV_2D:
+            return None
+        opts = conv.builtinOptions
+        filt = self.tensor(conv.inputs[1])
+        if (conv.inputs[0] != tensor or list(filt.shape[1:3]) != [1, 1] or
+                opts.strideW != 1 or opts.strideH != 1 or
+                opts.dilationWFactor != 1 or opts.dilationHFactor != 1):
+            return None
+        chain.append(conv_idx)
+        out, pw_act = self.fold_relu(conv.outputs[0],
+                                     opts.fusedActivationFunction, chain)
+        if dw_act is None or pw_act is None:
+            return None
+
+        options = struct.pack(
+            "<BBBBHHHHfi", OPTIONS_VERSION, dw_opts.padding, dw_act, pw_act,
+            dw_opts.strideW, dw_opts.strideH, dw_opts.dilationWFactor,
+            dw_opts.dilationHFactor, mid.quantization.scale[0],
+            mid.quantization.zeroPoint[0])
+        fused = schema.OperatorT()
+        fused.inputs = [dw.inputs[0], dw.inputs[1], dw.inputs[2],
+                        conv.inputs[1], conv.inputs[2]]
+        fused.outputs = [out]
+        fused.customOptions = list(options)
+        fused.customOptionsFormat = schema.CustomOptionsFormat.FLEXBUFFERS
+        return fused, chain
+
+
+def custom_opcode(model):
+    for i, code in enumerate(model.operatorCodes):
+        name = code.customCode
+        if isinstance(name, bytes):
+            name = name.decode()
+        if name == OP_NAME:
+            return i
+    code = schema.OperatorCodeT()
+    code.builtinCode = Op.CUSTOM
+    code.deprecatedBuiltinCode = Op.CUSTOM
+    code.customCode = OP_NAME
+    code.version = 1
+    model.operatorCodes.append(code)
+    return len(model.operatorCodes) - 1
+
+
+def prune_tensors(model):
+    """Drop the tensors no op uses anymore and renumber the others."""
+    graph = model.subgraphs[0]
+    used = set(graph.inputs) | set(graph.outputs)
+    for op in graph.operators:
+        used.update(t for t in op.inputs if t >= 0)
+        used.update(op.outputs)
+    remap = {}
+    tensors = []
+    for i, tensor in enumerate(graph.tensors):
+        if i in used:
+            remap[i] = len(tensors)
+            tensors.append(tensor)
+    graph.tensors = tensors
+
+    def renumber(indices):
+        return [remap[t] if t >= 0 else t for t in indices]
+
+    graph.inputs = renumber(graph.inputs)
+    graph.outputs = renumber(graph.outputs)
+    for op in graph.operators:
+        op.inputs = renumber(op.inputs)
+        op.outputs = renumber(op.outputs)
+    for signature in model.signatureDefs or []:
+        for item in (signature.inputs or []) + (signature.outputs or []):
+            item.tensorIndex = remap[item.tensorIndex]
+
+
+def fuse(model):
+    if len(model.subgraphs) != 1:
+        sys.exit("only single subgraph models are supported")
+    graph = Graph(model)
+    operators = []
+    removed = set()
+    fused_num = 0
+    for i, op in enumerate(graph.graph.operators):
+        if i in removed:
+            continue
+        match = graph.match(i)
+        if match is None:
+            operators.append(op)
+            continue
+        fused, chain = match
+        fused.opcodeIndex = custom_opcode(model)
+        # Later ops of the block only depend on it, the fused op takes the
+        # place of the first one.
+        removed.update(chain)
+        operators.append(fused)
+        fused_num += 1
+    graph.graph.operators = operators
+    prune_tensors(model)
+    return fused_num
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="int8 .tflite model")
+    parser.add_argument("output", help="rewritten .tflite model")
+    args = parser.parse_args()
+
+    model = flatbuffer_utils.read_model(args.input)
+    fused_num = fuse(model)
+    flatbuffer_utils.write_model(model, args.output)
+    print(f"{args.output}: {fused_num} blocks fused")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Build a model pack for the model partition, see model_pack.h.
+
+Models are given as NAME=MODEL[:LABELS], MODEL being a .tflite file and
+LABELS a text file with one label per line.
+
+    pack_models.py -o models.bin \
+        kws=main/kws/kws_model.tflite:main/kws/kws_model_labels.txt
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b"NNMP"
+VERSION = 1
+HEADER_SIZE = 16
+ENTRY_SIZE = 56
+NAME_LEN = 32
+MODEL_ALIGN = 16
+
+
+def load(spec):
+    name, sep, source = spec.partition("=")
+    if not sep or not name or len(name.encode()) >= NAME_LEN:
+        sys.exit(f"{spec}: expected NAME=MODEL[:LABELS], name below "
+                 f"{NAME_LEN} bytes")
+    model_path, _, labels_path = source.partition(":")
+    with open(model_path, "rb") as f:
+        model = f.read()
+    labels = []
+    if labels_path:
+        with open(labels_path) as f:
+            labels = [line.strip() for line in f if line.strip()]
+    return name, model, labels
+
+
+def align(offset):
+    return (offset + MODEL_ALIGN - 1) // MODEL_ALIGN * MODEL_ALIGN
+
+
+def pack(models):
+    data = bytearray()
+    entries = bytearray()
+    offset = align(HEADER_SIZE + ENTRY_SIZE * len(models))
+    for name, model, labels in models:
+        blob = b"".join(label.encode() + b"\0" for label in labels)
+        model_offset = offset
+        labels_offset = model_offset + len(model)
+        crc = zlib.crc32(blob, zlib.crc32(model))
+        entries += struct.pack(f"<{NAME_LEN}s6I", name.encode(), model_offset,
+                               len(model), labels_offset, len(blob),
+                               len(labels), crc)
+        data += model + blob
+        offset = align(labels_offset + len(blob))
+        data += bytes(offset - labels_offset - len(blob))
+
+    header = struct.pack("<4sHHII", MAGIC, VERSION, len(models),
+                         zlib.crc32(entries), 0)
+    table = header + entries
+    return table + bytes(align(len(table)) - len(table)) + data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("--size", type=lambda x: int(x, 0),
+                        help="partition size to check the pack against")
+    parser.add_argument("models", nargs="+", metavar="NAME=MODEL[:LABELS]")
+    args = parser.parse_args()
+
+    image = pack([load(spec) for spec in args.models])
+    if args.size and len(image) > args.size:
+        sys.exit(f"pack of {len(image)} bytes exceeds {args.size}")
+    with open(args.output, "wb") as f:
+        f.write(image)
+    print(f"{args.output}: {len(args.models)} models, {len(image)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Repack the pruned FullyConnected weights of an int8 .tflite model.
+
+Weight rows are split into blocks of 4 inputs, all-zero blocks are dropped
+and a bitmap records the stored ones. An int8 FullyConnected op becomes a
+GRC_SPARSE_FC custom op (components/nn_model/sparse_fc.h) when at most
+--max-density of its blocks are stored and the packed weights with their
+bitmap are smaller than the dense ones. Results are the same as the dense
+op's. The kernel needs per-tensor weights of zero point 0, other int8
+FullyConnected weights stop the conversion with an error.
+
+    sparsify_fc.py kws_pruned.tflite main/kws/kws_model.tflite
+
+Needs the tensorflow Python package for the .tflite schema.
+"""
+
+import argparse
+import struct
+import sys
+
+import numpy as np
+from tensorflow.lite.python import schema_py_generated as schema
+from tensorflow.lite.tools import flatbuffer_utils
+
+from fuse_ds_conv import builtin_code, prune_tensors
+
+OP_NAME = "GRC_SPARSE_FC"
+OPTIONS_VERSION = 1
+BLOCK = 4
+
+Op = schema.BuiltinOperator
+
+
+def pack(weights):
+    """Stored blocks row after row and the LSB first bitmap of each row."""
+    out_features, in_features = weights.shape
+    blocks = -(-in_features // BLOCK)
+    padded = np.zeros((out_features, blocks * BLOCK), np.int8)
+    padded[:, :in_features] = weights
+    padded = padded.reshape(out_features, blocks, BLOCK)
+    stored = padded.any(axis=2)
+    bitmap = np.packbits(stored, axis=1, bitorder="little")
+    return padded[stored].reshape(-1), bitmap.reshape(-1), stored.mean()
+
+
+def custom_opcode(model):
+    for i, code in enumerate(model.operatorCodes):
+        name = code.customCode
+        if isinstance(name, bytes):
+            name = name.decode()
+        if name == OP_NAME:
+            return i
+    code = schema.OperatorCodeT()
+    code.builtinCode = Op.CUSTOM
+    code.deprecatedBuiltinCode = Op.CUSTOM
+    code.customCode = OP_NAME
+    code.version = 1
+    model.operatorCodes.append(code)
+    return len(model.operatorCodes) - 1
+
+
+def add_tensor(model, name, tensor_type, data, quantization=None):
+    buffer = schema.BufferT()
+    buffer.data = np.frombuffer(data.tobytes(), np.uint8)
+    model.buffers.append(buffer)
+    tensor = schema.TensorT()
+    tensor.name = name
+    tensor.type = tensor_type
+    tensor.shape = [data.size]
+    tensor.buffer = len(model.buffers) - 1
+    tensor.quantization = quantization
+    graph = model.subgraphs[0]
+    graph.tensors.append(tensor)
+    return len(graph.tensors) - 1
+
+
+def sparsify(model, op, max_density):
+    """Replace a FullyConnected op in place, returns a report or None."""
+    graph = model.subgraphs[0]
+    if builtin_code(model, op) != Op.FULLY_CONNECTED:
+        return None
+    opts = op.builtinOptions
+    src = graph.tensors[op.inputs[0]]
+    weights = graph.tensors[op.inputs[1]]
+    quant = weights.quantization
+    data = model.buffers[weights.buffer].data
+    if (opts.weightsFormat != schema.FullyConnectedOptionsWeightsFormat.DEFAULT
+            or src.type != schema.TensorType.INT8 or
+            weights.type != schema.TensorType.INT8 or data is None or
+            len(data) == 0):
+        return None
+    name = weights.name.decode() if isinstance(weights.name,
+                                               bytes) else weights.name
+    # The kernel requantizes with a single multiplier, and skipping a zero
+    # block only adds nothing when 0 is the zero point.
+    if quant is None or quant.scale is None or len(quant.scale) != 1:
+        sys.exit(f"{name}: {OP_NAME} needs per-tensor weights, convert the "
+                 "model without per-channel FullyConnected quantization")
+    if quant.zeroPoint is not None and any(quant.zeroPoint):
+        sys.exit(f"{name}: {OP_NAME} needs a weight zero point of 0, got "
+                 f"{list(quant.zeroPoint)}")
+
+    dense = np.frombuffer(bytes(data), np.int8).reshape(weights.shape)
+    packed, bitmap, density = pack(dense)
+    report = (f"{name}: {dense.shape[0]}x{dense.shape[1]}, "
+              f"{density:.0%} blocks stored, {dense.size} -> "
+              f"{packed.size + bitmap.size} bytes")
+    if density > max_density or packed.size + bitmap.size >= dense.size:
+        return report + ", kept dense"
+
+    packed_quant = schema.QuantizationParametersT()
+    packed_quant.scale = list(quant.scale)
+    packed_quant.zeroPoint = [0]
+    packed_idx = add_tensor(model, name + "/sparse", schema.TensorType.INT8,
+                            packed, packed_quant)
+    bitmap_idx = add_tensor(model, name + "/bitmap", schema.TensorType.UINT8,
+                            bitmap)
+    bias = op.inputs[2] if len(op.inputs) > 2 else -1
+
+    op.opcodeIndex = custom_opcode(model)
+    op.inputs = [op.inputs[0], packed_idx, bitmap_idx, bias]
+    op.builtinOptionsType = schema.BuiltinOptions.NONE
+    op.builtinOptions = None
+    op.customOptions = list(
+        struct.pack("<BBHII", OPTIONS_VERSION, opts.fusedActivationFunction,
+                    BLOCK, dense.shape[1], dense.shape[0]))
+    op.customOptionsFormat = schema.CustomOptionsFormat.FLEXBUFFERS
+    return report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="pruned int8 .tflite model")
+    parser.add_argument("output", help="rewritten .tflite model")
+    parser.add_argument(
+        "--max-density", type=float, default=0.25,
+        help="largest fraction of stored blocks worth the sparse kernel, "
+        "the dense one is vectorized (default: %(default)s)")
+    args = parser.parse_args()
+
+    model = flatbuffer_utils.read_model(args.input)
+    if len(model.subgraphs) != 1:
+        sys.exit("only single subgraph models are supported")
+    for op in model.subgraphs[0].operators:
+        report = sparsify(model, op, args.max_density)
+        if report:
+            print(report)
+    # Dense weights left without a user, their buffers emptied.
+    used = {t for op in model.subgraphs[0].operators for t in op.inputs}
+    for i, tensor in enumerate(model.subgraphs[0].tensors):
+        if i not in used and model.buffers[tensor.buffer].data is not None:
+            model.buffers[tensor.buffer].data = None
+    prune_tensors(model)
+    flatbuffer_utils.write_model(model, args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+"""Convert a convolutional .tflite model to streaming inference.
+
+The model input is a window of frames, time major: 1 x T x F x C, or flat
+and reshaped to it by the first op. Each layer with a time kernel gets a
+GRC_STREAM_BUFFER op (components/nn_model/stream_buffer.h) in front of it,
+keeping the rows it needs from previous inferences in a variable tensor,
+and computes with VALID padding in time. The converted model takes the new
+frames of one step, the product of the time strides, and computes one row
+of every layer per step up to the layer pooling the whole time axis.
+
+SAME padding in time is kept: the state starts as zero point rows, the
+padding before the first frames of the stream, and the rows each layer
+computes over that padding are zeroed again by the next buffer. The layers
+compute the rows of the full-window model run on the stream since the last
+reset, each row as soon as its frames are in. Padding after the window has
+no counterpart, the rows near the end of a window see the next frames.
+
+    stream_model.py main/sed/sed_model_bark.tflite sed_model_bark.tflite
+
+Run it before fuse_ds_conv.py. Needs the tensorflow Python package for the
+.tflite schema.
+"""
+
+import argparse
+import copy
+import struct
+import sys
+
+from tensorflow.lite.python import schema_py_generated as schema
+from tensorflow.lite.tools import flatbuffer_utils
+
+from fuse_ds_conv import builtin_code
+
+OP_NAME = "GRC_STREAM_BUFFER"
+OPTIONS_VERSION = 2
+
+Op = schema.BuiltinOperator
+
+WINDOWED = {Op.CONV_2D, Op.DEPTHWISE_CONV_2D, Op.AVERAGE_POOL_2D,
+            Op.MAX_POOL_2D}
+ROWWISE = {Op.RELU, Op.RELU6}
+
+
+def custom_opcode(model):
+    for i, code in enumerate(model.operatorCodes):
+        name = code.customCode
+        if isinstance(name, bytes):
+            name = name.decode()
+        if name == OP_NAME:
+            return i
+    code = schema.OperatorCodeT()
+    code.builtinCode = Op.CUSTOM
+    code.deprecatedBuiltinCode = Op.CUSTOM
+    code.customCode = OP_NAME
+    code.version = 1
+    model.operatorCodes.append(code)
+    return len(model.operatorCodes) - 1
+
+
+def window(model, op):
+    """Kernel, stride and dilation of a windowed op, time axis first."""
+    graph = model.subgraphs[0]
+    opts = op.builtinOptions
+    if builtin_code(model, op) in (Op.CONV_2D, Op.DEPTHWISE_CONV_2D):
+        shape = graph.tensors[op.inputs[1]].shape
+        return ((shape[1], shape[2]), (opts.strideH, opts.strideW),
+                (opts.dilationHFactor, opts.dilationWFactor))
+    return ((opts.filterHeight, opts.filterWidth),
+            (opts.strideH, opts.strideW), (1, 1))
+
+
+def set_rows(tensor, rows):
+    tensor.shape = [tensor.shape[0], rows] + list(tensor.shape[2:])
+    if tensor.shapeSignature is not None and len(tensor.shapeSignature):
+        tensor.shapeSignature = [tensor.shapeSignature[0], rows] + list(
+            tensor.shapeSignature[2:])
+
+
+def add_tensor(model, name, src, shape, variable=False):
+    """Tensor of the type and quantization of src, without data, or int32
+    without src."""
+    model.buffers.append(schema.BufferT())
+    tensor = schema.TensorT()
+    tensor.name = name
+    tensor.type = src.type if src else schema.TensorType.INT32
+    tensor.shape = shape
+    tensor.buffer = len(model.buffers) - 1
+    tensor.quantization = copy.deepcopy(src.quantization) if src else None
+    tensor.isVariable = variable
+    graph = model.subgraphs[0]
+    graph.tensors.append(tensor)
+    return len(graph.tensors) - 1
+
+
+def time_input(model):
+    """Time major tensor, and the Reshape op producing it or None."""
+    graph = model.subgraphs[0]
+    src = graph.inputs[0]
+    if len(graph.tensors[src].shape) == 4:
+        return src, None
+    op = graph.operators[0]
+    if (builtin_code(model, op) == Op.RESHAPE and op.inputs[0] == src and
+            len(graph.tensors[op.outputs[0]].shape) == 4):
+        return op.outputs[0], op
+    sys.exit("model input is neither 1 x T x F x C nor reshaped to it")
+
+
+def set_input_rows(model, reshape, rows):
+    graph = model.subgraphs[0]
+    src = graph.tensors[graph.inputs[0]]
+    if reshape is None:
+        set_rows(src, rows)
+        return
+    out = graph.tensors[reshape.outputs[0]]
+    frame = out.shape[2] * out.shape[3]
+    src.shape = [src.shape[0], rows * frame]
+    src.shapeSignature = None
+    set_rows(out, rows)
+    new_shape = [int(d) for d in out.shape]
+    if len(reshape.inputs) > 1:
+        buffer = model.buffers[graph.tensors[reshape.inputs[1]].buffer]
+        if buffer.data is not None and len(buffer.data):
+            buffer.data = list(struct.pack("<4i", *new_shape))
+    if reshape.builtinOptions is not None:
+        reshape.builtinOptions.newShape = new_shape
+
+
+def convert(model):
+    if len(model.subgraphs) != 1:
+        sys.exit("only single subgraph models are supported")
+    graph = model.subgraphs[0]
+    start, reshape = time_input(model)
+
+    # Ops on the time axis, up to the one pooling it.
+    chain = []
+    tracked = {start}
+    window_rows = {start: graph.tensors[start].shape[1]}
+    end = None
+    for idx, op in enumerate(graph.operators):
+        if not op.inputs or op.inputs[0] not in tracked:
+            if any(t in tracked for t in op.inputs):
+                sys.exit(f"op {idx} takes the time axis as a second input")
+            continue
+        code = builtin_code(model, op)
+        if code in WINDOWED:
+            chain.append(idx)
+            if graph.tensors[op.outputs[0]].shape[1] == 1:
+                end = idx
+                break
+        elif code in ROWWISE:
+            chain.append(idx)
+        else:
+            sys.exit(f"op {idx} ({code}) is not supported on the time axis")
+        tracked.add(op.outputs[0])
+        window_rows[op.outputs[0]] = graph.tensors[op.outputs[0]].shape[1]
+    if end is None:
+        sys.exit("no layer pools the time axis")
+
+    step = 1
+    for idx in chain[:-1]:
+        op = graph.operators[idx]
+        if builtin_code(model, op) in WINDOWED:
+            step *= window(model, op)[1][0]
+    set_input_rows(model, reshape, step)
+
+    # Rows per step, and rows computed over the padding before the stream
+    # start, of each tensor.
+    rows = {start: step}
+    padding_rows = {start: 0}
+    inserted = {}
+    for idx in chain:
+        op = graph.operators[idx]
+        src = op.inputs[0]
+        n_in = rows[src]
+        skip = padding_rows[src]
+        if builtin_code(model, op) in ROWWISE:
+            rows[op.outputs[0]] = n_in
+            padding_rows[op.outputs[0]] = skip
+            set_rows(graph.tensors[op.outputs[0]], n_in)
+            continue
+
+        (kt, kw), (st, sw), (dt, dw) = window(model, op)
+        eff = (kt - 1) * dt + 1
+        top = 0
+        if op.builtinOptions.padding == schema.Padding.SAME:
+            n = window_rows[src]
+            top = max((-(-n // st) - 1) * st + eff - n, 0) // 2
+        if idx == end:
+            if n_in != 1:
+                sys.exit(f"op {idx} pools {n_in} new rows per step")
+            if top:
+                sys.exit(f"op {idx} pads the time axis it pools")
+            st = 1
+        elif n_in % st:
+            sys.exit(f"op {idx}: stride {st} over {n_in} rows per step")
+        n_out = n_in // st
+        rows[op.outputs[0]] = n_out
+        if idx != end:
+            set_rows(graph.tensors[op.outputs[0]], n_out)
+        # The last output row of a step ends on the last input row with a
+        # state, on the first row of the last stride without.
+        end_row = skip + eff - top + (st - 1 if kt == 1 else 0)
+        if end_row % st:
+            sys.exit(f"op {idx}: padding in time off the stride of the "
+                     "stream")
+        padding_rows[op.outputs[0]] = end_row // st - 1
+        if kt == 1:
+            # Rows are computed on their own, no state needed.
+            continue
+
+        tensor = graph.tensors[src]
+        _, _, width, channels = tensor.shape
+        left = right = 0
+        if op.builtinOptions.padding == schema.Padding.SAME:
+            out_w = -(-width // sw)
+            total = max((out_w - 1) * sw + (kw - 1) * dw + 1 - width, 0)
+            left, right = total // 2, total - total // 2
+        state_rows = (kt - 1) * dt + 1 + st * (n_out - 1)
+        name = tensor.name.decode() if isinstance(tensor.name,
+                                                  bytes) else tensor.name
+        state = add_tensor(model, name + "/stream_state", tensor,
+                           [1, state_rows, width, channels], variable=True)
+        out = add_tensor(model, name + "/stream", tensor,
+                         [1, state_rows, width + left + right, channels])
+
+        stream = schema.OperatorT()
+        stream.opcodeIndex = custom_opcode(model)
+        stream.inputs = [src, state]
+        if skip:
+            stream.inputs.append(
+                add_tensor(model, name + "/stream_seen", None, [1],
+                           variable=True))
+        stream.outputs = [out]
+        stream.customOptions = list(
+            struct.pack("<BHHH", OPTIONS_VERSION, left, right, skip))
+        stream.customOptionsFormat = schema.CustomOptionsFormat.FLEXBUFFERS
+        inserted[idx] = stream
+
+        op.inputs[0] = out
+        op.builtinOptions.padding = schema.Padding.VALID
+        if idx == end:
+            op.builtinOptions.strideH = 1
+        print(f"op {idx}: {state_rows} rows of {name}, "
+              f"{n_in} in, {n_out} out, {skip} padding rows")
+
+    operators = []
+    for idx, op in enumerate(graph.operators):
+        if idx in inserted:
+            operators.append(inserted[idx])
+        operators.append(op)
+    # Results pooling rows over the padding before the stream start.
+    warmup = padding_rows[graph.operators[end].outputs[0]]
+    graph.operators = operators
+    return step, warmup
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="full-window .tflite model")
+    parser.add_argument("output", help="streaming .tflite model")
+    args = parser.parse_args()
+
+    model = flatbuffer_utils.read_model(args.input)
+    step, warmup = convert(model)
+    flatbuffer_utils.write_model(model, args.output)
+    print(f"{args.output}: {step} frames per step, the first {warmup} "
+          "results after a reset pool the padding before the stream")
+
+
+if __name__ == "__main__":
+    main()